@@ -1,10 +1,16 @@
+/*
+** Each of the four unsigned short tables below ends with one
+** spare zero entry, so that eval_5hand_batch can fetch entries
+** with 32-bit gathers without reading past the end of a table.
+*/
+
 /*
 ** This is a table lookup for all "flush" hands (e.g.  both
 ** flushes and straight-flushes.  Entries containing a zero
 ** mean that combination is not possible with a five-card
 ** flush hand.
 */
-unsigned short flushes[] =
+const unsigned short flushes[] =
 {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -419,7 +425,8 @@ unsigned short flushes[] =
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0
 };
 
 
@@ -429,7 +436,7 @@ unsigned short flushes[] =
 ** of five unique ranks (i.e.  either Straights or High Card
 ** hands).  It's similar to the above "flushes" array.
 */
-unsigned short unique5[] =
+const unsigned short unique5[] =
 {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 1608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -852,11 +859,12 @@ unsigned short unique5[] =
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1600
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1600,
+    0
 };
 
 
-unsigned short hash_adjust[] =
+const unsigned short hash_adjust[] =
 {
     0, 5628, 7017, 1298, 2918, 2442, 8070, 6383, 6383, 7425, 2442, 5628, 8044, 7425, 3155, 6383,
     2918, 7452, 1533, 6849, 5586, 7452, 7452, 1533, 2209, 6029, 2794, 3509, 7992, 7733, 7452, 131,
@@ -889,10 +897,11 @@ unsigned short hash_adjust[] =
     6110, 3210, 747, 3229, 3056, 2918, 7733, 330, 4055, 7322, 5628, 2987, 3056, 1905, 2903, 669,
     5325, 2845, 4099, 5225, 6283, 4099, 5000, 642, 4055, 5345, 8034, 2918, 1041, 5769, 7051, 1538,
     2918, 3366, 608, 4303, 3921, 0, 2918, 1905, 218, 6687, 5963, 859, 3083, 2987, 896, 5056,
-    1905, 2918, 4415, 7966, 7646, 2883, 5628, 7017, 8029, 6528, 4474, 6322, 5562, 6669, 4610, 7006
+    1905, 2918, 4415, 7966, 7646, 2883, 5628, 7017, 8029, 6528, 4474, 6322, 5562, 6669, 4610, 7006,
+    0
 };
 
-unsigned short hash_values[] =
+const unsigned short hash_values[] =
 {
      148, 2934,  166, 5107, 4628,  166,  166,  166,  166, 3033,  166, 4692,  166, 5571, 2225,  166,
     5340, 3423,  166, 3191, 1752,  166, 5212,  166,  166, 3520,  166,  166,  166, 1867,  166, 3313,
@@ -1405,7 +1414,8 @@ unsigned short hash_values[] =
     6040, 4525, 6044, 5866, 3613, 2907, 4615, 2135,  258,  166, 1681, 1941, 4888,  166, 4859, 6178,
     6174, 4858, 5209, 1912, 3340,  166, 4640, 5706,  166, 2763, 3153, 3951,  166, 5542, 5596, 5819,
     5330, 5048, 4037,  166, 6033, 4625, 3326, 2013, 5283,  136, 3373, 2154,  166,  166,  166, 4421,
-     166, 5438, 2627, 2266, 2320,  166, 2588, 4790, 4290,  166, 4767, 5829, 2925, 5916, 2133,  166
+     166, 5438, 2627, 2266, 2320,  166, 2588, 4790, 4290,  166, 4767, 5829, 2925, 5916, 2133,  166,
+       0
 };
 
 
@@ -1420,13 +1430,13 @@ unsigned short hash_values[] =
 ** king  = 37
 ** ace   = 41
 */
-int primes[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41 };
+const int primes[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41 };
 
 /*
 ** Used for a non-efficient method of permuting over all
 ** C(7,5) combinations of choosing five cards from seven.
 */
-int perm7[21][5] =
+const int perm7[21][5] =
 {
     { 0, 1, 2, 3, 4 },
     { 0, 1, 2, 3, 5 },
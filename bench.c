@@ -0,0 +1,334 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "poker.h"
+#include "cards.h"
+#include "enumerate.h"
+#include "range.h"
+#include "bench.h"
+
+#define MAX_THREADS 256
+#define BATCH       1024        // hands per batch call
+#define SHOWDOWN_PLAYERS 6
+
+// Hands of each category for every 5, 6 and 7 card hand.  The
+// five-card row is allfive's expected_freq; the others were
+// counted with eval_5hand over every subhand.
+static const uint64_t expected_freq[3][10] =
+{
+    { 0, 40, 624, 3744, 5108, 10200, 54912, 123552, 1098240, 1302540 },
+    { 0, 1844, 14664, 165984, 205792, 361620, 732160, 2532816,
+      9730740, 6612900 },
+    { 0, 41584, 224848, 3473184, 4047644, 6180020, 6461620, 31433400,
+      58627800, 23294460 },
+};
+
+static unsigned short
+eval_mask_ints(int *hand)
+{
+    return eval_mask(hand_mask(hand, 7));
+}
+
+const struct bench_evaluator bench_evaluators[] =
+{
+    { "eval_5hand",       5, eval_5hand,      NULL },
+    { "eval_5hand_fast",  5, eval_5hand_fast, NULL },
+    { "eval_5hand_batch", 5, NULL,            eval_5hand_batch },
+    { "eval_6hand",       6, eval_6hand,      NULL },
+    { "eval_7hand",       7, eval_7hand,      NULL },
+    { "eval_7hand_fast",  7, eval_7hand_fast, NULL },
+    { "eval_mask",        7, eval_mask_ints,  NULL },
+    { NULL, 0, NULL, NULL }
+};
+
+
+static struct range showdown_range;
+static pthread_once_t showdown_once = PTHREAD_ONCE_INIT;
+
+static void
+init_showdown_range(void)
+{
+    range_parse("20%", &showdown_range);
+}
+
+// Deals six players from the best 20% of starting hands onto one
+// board of ncards - 2 cards, so consecutive hands share a board
+// and lean towards the strong categories.
+static void
+deal_showdown(int *hands, size_t nhands, int ncards, struct rng_state *rng)
+{
+    const struct range *r = &showdown_range;
+    int deck[52];
+
+    pthread_once(&showdown_once, init_showdown_range);
+    init_deck(deck);
+    for (size_t h = 0; h < nhands; )
+    {
+        int nboard = ncards - 2, seat[SHOWDOWN_PLAYERS], n = 0;
+        uint64_t used;
+
+        shuffle_partial(deck, 52, nboard, rng);
+        used = hand_mask(deck, nboard);
+        for (int tries = 0; n < SHOWDOWN_PLAYERS && tries < 1000; tries++)
+        {
+            int c = rng_below(rng, r->n);
+            if (!(used & r->combo[c].mask))
+            {
+                used |= r->combo[c].mask;
+                seat[n++] = c;
+            }
+        }
+        for (int p = 0; p < n && h < nhands; p++, h++)
+        {
+            int *hand = hands + h * ncards;
+            memcpy(hand, deck, sizeof(int) * nboard);
+            hand[nboard] = r->combo[seat[p]].c1;
+            hand[nboard + 1] = r->combo[seat[p]].c2;
+        }
+    }
+}
+
+static int *
+make_hands(const struct bench_spec *spec)
+{
+    int k = spec->ev->ncards, deck[52], idx[7];
+    int *hands = malloc(sizeof(int) * k * spec->nhands);
+    uint64_t total = n_choose_k(52, k);
+    struct rng_state rng;
+
+    if (!hands)
+        return NULL;
+    init_deck(deck);
+    rng_seed(&rng, spec->seed);
+
+    switch (spec->workload)
+    {
+    case BENCH_ORDERED:
+        for (size_t h = 0; h < spec->nhands; h++)
+        {
+            colex_unrank(h % total, k, idx);
+            for (int i = 0; i < k; i++)
+                hands[h*k + i] = deck[idx[i]];
+        }
+        break;
+    case BENCH_RANDOM:
+        for (size_t h = 0; h < spec->nhands; h++)
+        {
+            shuffle_partial(deck, 52, k, &rng);
+            memcpy(hands + h*k, deck, sizeof(int) * k);
+        }
+        break;
+    default:
+        deal_showdown(hands, spec->nhands, k, &rng);
+    }
+    return hands;
+}
+
+
+struct gate
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int open;
+};
+
+struct worker
+{
+    const struct bench_spec *spec;
+    const int *hands;
+    struct gate *gate;
+    unsigned sum;
+} __attribute__((aligned(64)));
+
+static void *
+work(void *p)
+{
+    struct worker *w = p;
+    const struct bench_spec *spec = w->spec;
+    const struct bench_evaluator *ev = spec->ev;
+    int k = ev->ncards;
+    unsigned short out[BATCH];
+    unsigned sum = 0;
+
+    pthread_mutex_lock(&w->gate->lock);
+    while (!w->gate->open)
+        pthread_cond_wait(&w->gate->cond, &w->gate->lock);
+    pthread_mutex_unlock(&w->gate->lock);
+
+    for (int pass = 0; pass < spec->passes; pass++)
+    {
+        if (ev->batch)
+            for (size_t h = 0; h < spec->nhands; h += BATCH)
+            {
+                size_t n = spec->nhands - h < BATCH ? spec->nhands - h : BATCH;
+                ev->batch(w->hands + h*k, n, out);
+                for (size_t i = 0; i < n; i++)
+                    sum += out[i];
+            }
+        else
+            for (size_t h = 0; h < spec->nhands; h++)
+                sum += ev->eval((int *)w->hands + h*k);
+    }
+    w->sum = sum;
+    return NULL;
+}
+
+int
+bench_run(const struct bench_spec *spec, struct bench_result *res)
+{
+    const struct bench_evaluator *ev = spec->ev;
+    pthread_t tids[MAX_THREADS];
+    struct gate gate = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0 };
+    struct timespec start, end;
+    int n = spec->nthreads, running = 1;
+
+    if (!ev || (!ev->eval == !ev->batch) || ev->ncards < 5 || ev->ncards > 7)
+        return -1;
+    if (!spec->nhands || spec->passes < 1 || spec->workload < BENCH_ORDERED ||
+        spec->workload > BENCH_SHOWDOWN)
+        return -1;
+    if (n <= 0)
+        n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1)
+        n = 1;
+    if (n > MAX_THREADS)
+        n = MAX_THREADS;
+
+    int *hands = make_hands(spec);
+    struct worker *w = aligned_alloc(64, sizeof(*w) * n);
+    if (!hands || !w)
+    {
+        free(hands);
+        free(w);
+        return -1;
+    }
+
+    // Threads wait at the gate until all are up, so the clock
+    // starts with every one of them ready.  A thread that cannot
+    // be started is left out of the count.
+    for (int i = 0; i < n; i++)
+        w[i] = (struct worker){ spec, hands, &gate, 0 };
+    for (int i = 1; i < n; i++)
+        if (!pthread_create(&tids[running], NULL, work, &w[running]))
+            running++;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_mutex_lock(&gate.lock);
+    gate.open = 1;
+    pthread_cond_broadcast(&gate.cond);
+    pthread_mutex_unlock(&gate.lock);
+    work(&w[0]);
+    for (int i = 1; i < running; i++)
+        pthread_join(tids[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    res->nthreads = running;
+    res->evals = (uint64_t)spec->nhands * spec->passes * running;
+    res->seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    res->ns_per_eval = res->seconds * 1e9 * running / res->evals;
+    res->evals_per_sec = res->evals / res->seconds;
+    res->evals_per_sec_thread = res->evals_per_sec / running;
+    res->checksum = w[0].sum;
+
+    free(hands);
+    free(w);
+    return 0;
+}
+
+
+// Batch evaluators are checked by buffering each thread's hands
+// and evaluating them BATCH at a time; the merge evaluates what is
+// left in the buffer.
+struct batch_local
+{
+    uint64_t freq[10];
+    int n;
+    int hands[BATCH * 7];
+};
+
+static void
+flush_batch(const struct bench_evaluator *ev, const int *hands, int n,
+            uint64_t *freq)
+{
+    unsigned short out[BATCH];
+
+    ev->batch(hands, n, out);
+    for (int i = 0; i < n; i++)
+        freq[out[i] ? hand_rank(out[i]) : 0]++;
+}
+
+static void
+visit_batch(const int *cards, void *local, void *arg)
+{
+    const struct bench_evaluator *ev = arg;
+    struct batch_local *l = local;
+
+    memcpy(l->hands + l->n * ev->ncards, cards, sizeof(int) * ev->ncards);
+    if (++l->n == BATCH)
+    {
+        flush_batch(ev, l->hands, BATCH, l->freq);
+        l->n = 0;
+    }
+}
+
+static void
+merge_batch(void *total, const void *local, void *arg)
+{
+    struct batch_local *t = total;
+    const struct batch_local *l = local;
+
+    flush_batch(arg, l->hands, l->n, t->freq);
+    for (int i = 0; i < 10; i++)
+        t->freq[i] += l->freq[i];
+}
+
+int
+bench_check(const struct bench_evaluator *ev, int nthreads, uint64_t freq[10])
+{
+    int deck[52];
+
+    if (!ev || (!ev->eval == !ev->batch) || ev->ncards < 5 || ev->ncards > 7)
+        return -1;
+    init_deck(deck);
+    memset(freq, 0, sizeof(uint64_t) * 10);
+
+    if (ev->eval)
+    {
+        unsigned long *counts = calloc(7463, sizeof(unsigned long));
+
+        if (!counts || enum_values(deck, 52, ev->ncards, ev->eval, nthreads, counts) < 0)
+        {
+            free(counts);
+            return -1;
+        }
+        // A value of 0 is no hand at all; count it as a miss.
+        freq[0] = counts[0];
+        for (int v = 1; v <= 7462; v++)
+            freq[hand_rank(v)] += counts[v];
+        free(counts);
+    }
+    else
+    {
+        struct batch_local *total = calloc(1, sizeof(*total));
+        struct enum_spec spec = {
+            .pool = deck, .npool = 52, .k = ev->ncards, .nthreads = nthreads,
+            .visit = visit_batch, .merge = merge_batch,
+            .local_size = sizeof(struct batch_local), .arg = (void *)ev,
+        };
+
+        if (!total || enum_run(&spec, total) < 0)
+        {
+            free(total);
+            return -1;
+        }
+        memcpy(freq, total->freq, sizeof(uint64_t) * 10);
+        free(total);
+    }
+
+    for (int i = 0; i < 10; i++)
+        if (freq[i] != expected_freq[ev->ncards - 5][i])
+            return 0;
+    return 1;
+}
@@ -0,0 +1,69 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//
+//   Evaluator benchmarks.
+//
+//   A benchmark times one evaluator on a pre-generated set of hands
+//   in one of several orders: every thread evaluates the whole set,
+//   so the per-thread working set does not shrink as threads are
+//   added and the wall time shows how well the evaluator scales.
+//   bench_check() runs the exhaustive category counts that allfive
+//   prints, for 5, 6 or 7 cards, so a fast evaluator that gets
+//   hands wrong fails instead of posting a good time.
+//
+
+// Hand sets.
+#define BENCH_ORDERED   0       // colex order, as allfive enumerates
+#define BENCH_RANDOM    1       // uniformly random hands
+#define BENCH_SHOWDOWN  2       // six players from a 20% range on
+                                // one board, as at a showdown
+
+struct bench_evaluator
+{
+    const char *name;
+    int ncards;                                     // 5, 6 or 7
+    unsigned short (*eval)(int *hand);              // one hand per call
+    void (*batch)(const int *hands, size_t n,       // or many; one of
+                  unsigned short *out);             // the two is set
+};
+
+// The evaluators in poker.h, ending with a zeroed entry.
+extern const struct bench_evaluator bench_evaluators[];
+
+struct bench_spec
+{
+    const struct bench_evaluator *ev;
+    int workload;               // BENCH_ORDERED, ...
+    size_t nhands;              // hands in the set
+    int passes;                 // times each thread runs over the set
+    int nthreads;               // 0 = one per online CPU
+    uint64_t seed;
+};
+
+struct bench_result
+{
+    int nthreads;               // threads actually run
+    uint64_t evals;             // over all threads
+    double seconds;             // wall time
+    double ns_per_eval;         // per thread: seconds * nthreads / evals
+    double evals_per_sec;       // over all threads
+    double evals_per_sec_thread;
+    unsigned checksum;          // sum of values, the same for any thread count
+};
+
+// Runs the benchmark.  Returns 0, or -1 if the spec is invalid or
+// memory ran out.
+int
+bench_run(const struct bench_spec *spec, struct bench_result *res);
+
+// Evaluates every ev->ncards-card hand on nthreads threads and
+// counts hands per category into freq[1..9].  Returns 1 if every
+// count matches the known totals, 0 if not, -1 on error.
+int
+bench_check(const struct bench_evaluator *ev, int nthreads, uint64_t freq[10]);
+
+#endif
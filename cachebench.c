@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "poker.h"
+
+/****************************************************************
+    This code measures how the evaluator's lookup tables hold up
+    in cache next to other work.  It evaluates random five-card
+    hands, and between hands it touches random cache lines of a
+    buffer standing in for a simulator's own state.  Each run is
+    done twice, with and without the evaluation, so the difference
+    is the cost of the evaluator under that cache pressure.
+
+    "make cachebench" builds two copies, one against the normal
+    tables and one against the COMPACT_TABLES layout:
+
+        ./cachebench [-s state_kb] [-t touches] [-n hands]
+        ./cachebench_compact [-s state_kb] [-t touches] [-n hands]
+
+    L1d miss counts come from perf_event_open(2) and are only
+    shown where the kernel allows it.
+****************************************************************/
+
+static int
+open_l1d_misses(void)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_L1D |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static double
+elapsed_ns(struct timespec *start, struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+// Runs the measured loop once; returns ns per hand and stores
+// L1d misses per hand in *misses (negative if unavailable).
+static double
+run(const int *hands, int n, unsigned *state, int nlines, int touches,
+    int evaluate, int fd, double *misses, unsigned *sink)
+{
+    struct timespec start, end;
+    unsigned x = 1, sum = 0;
+    long long count = 0;
+
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (int i = 0; i < n; i++)
+    {
+        // Simulator work: read-modify-write random lines.
+        for (int t = 0; t < touches; t++)
+        {
+            x = x * 1664525 + 1013904223;
+            state[(x >> 8) % nlines * 16] += x;
+        }
+        if (evaluate)
+            sum += eval_5hand((int *)hands + 5*i);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &count, sizeof(count)) != sizeof(count))
+            count = -n;
+    }
+    *misses = (fd >= 0) ? (double)count / n : -1;
+    *sink += sum;
+    return elapsed_ns(&start, &end) / n;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int state_kb = 32, touches = 4, n = 1000000;
+    int deck[52], *hands;
+    unsigned *state, sink = 0;
+    struct rng_state rng;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-s") && i+1 < argc)
+            state_kb = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-t") && i+1 < argc)
+            touches = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-n") && i+1 < argc)
+            n = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-s state_kb] [-t touches] [-n hands]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (state_kb < 1 || touches < 0 || n < 1)
+        return 1;
+
+    int nlines = state_kb * 1024 / 64;
+    hands = malloc(sizeof(int) * 5 * n);
+    state = calloc(nlines, 64);
+    if (!hands || !state) {
+        perror("malloc");
+        return 1;
+    }
+
+    // Random hands: the first five cards of a fresh partial shuffle.
+    init_deck(deck);
+    rng_seed(&rng, 1);
+    for (int i = 0; i < n; i++)
+    {
+        shuffle_partial(deck, 52, 5, &rng);
+        memcpy(hands + 5*i, deck, sizeof(int) * 5);
+    }
+
+    int fd = open_l1d_misses();
+    double m0, m1, t0, t1;
+
+#ifdef COMPACT_TABLES
+    printf("table layout: compact (packed5)\n");
+#else
+    printf("table layout: standard (flushes + unique5)\n");
+#endif
+    printf("state %d KB, %d touches per hand, %d random hands\n\n",
+           state_kb, touches, n);
+
+    // Warm up, then measure.
+    run(hands, n, state, nlines, touches, 1, -1, &m1, &sink);
+    t0 = run(hands, n, state, nlines, touches, 0, fd, &m0, &sink);
+    t1 = run(hands, n, state, nlines, touches, 1, fd, &m1, &sink);
+
+    printf("state only:    %7.2f ns/hand", t0);
+    if (fd >= 0)
+        printf("  %6.3f L1d misses/hand", m0);
+    printf("\nstate + eval:  %7.2f ns/hand", t1);
+    if (fd >= 0)
+        printf("  %6.3f L1d misses/hand", m1);
+    printf("\nevaluator:     %7.2f ns/hand", t1 - t0);
+    if (fd >= 0)
+        printf("  %6.3f L1d misses/hand", m1 - m0);
+    else
+        printf("  (L1d counters unavailable)");
+    printf("\n");
+
+    free(hands);
+    free(state);
+    return sink == 0xdeadbeef;
+}
@@ -0,0 +1,131 @@
+#ifndef CARDS_H
+#define CARDS_H
+
+#include <stdint.h>
+#include "pokereval.h"
+
+//
+//   Compact card formats.
+//
+//   The int encoding of init_deck() makes a seven-card hand 28
+//   bytes.  Two smaller forms are provided for storing and
+//   streaming large numbers of hands:
+//
+//   - a card index, one byte 0..51: the card's position in the
+//     init_deck() order, suit * 13 + rank, with clubs first and
+//     Deuce as rank 0;
+//
+//   - a card mask, one uint64_t per hand with bit i set for card
+//     index i.  Bits 13s..13s+12 are the rank mask of suit s, so
+//     a suit is one shift and mask away and its card count one
+//     popcount; no pext is needed with this layout.
+//
+//   A seven-card hand is then 7 or 8 bytes.  Converting to and
+//   from the int encoding is a few instructions or one load.
+//
+
+#define CARD_SUIT_MASK(m, s)  ((int)((m) >> (13 * (s))) & 0x1fff)
+
+// Card index of a card in the init_deck() encoding.
+static inline int
+card_index(int card)
+{
+    return (3 - __builtin_ctz((card >> 12) & 0xF)) * 13 + ((card >> 8) & 0xF) - 2;
+}
+
+// Card in the init_deck() encoding of a card index.
+static inline int
+index_card(int i)
+{
+    return index_cards[i];
+}
+
+static inline uint64_t
+hand_mask(const int *hand, int n)
+{
+    uint64_t m = 0;
+
+    for (int i = 0; i < n; i++)
+        m |= 1ull << card_index(hand[i]);
+    return m;
+}
+
+static inline uint64_t
+index_mask(const uint8_t *idx, int n)
+{
+    uint64_t m = 0;
+
+    for (int i = 0; i < n; i++)
+        m |= 1ull << idx[i];
+    return m;
+}
+
+static inline void
+pack_hand(const int *hand, int n, uint8_t *idx)
+{
+    for (int i = 0; i < n; i++)
+        idx[i] = card_index(hand[i]);
+}
+
+static inline void
+unpack_hand(const uint8_t *idx, int n, int *hand)
+{
+    for (int i = 0; i < n; i++)
+        hand[i] = index_cards[idx[i]];
+}
+
+// Writes the cards of a mask to hand[], lowest index first, and
+// returns how many there were.
+static inline int
+mask_hand(uint64_t m, int *hand)
+{
+    int n = 0;
+
+    for (; m; m &= m - 1)
+        hand[n++] = index_cards[__builtin_ctzll(m)];
+    return n;
+}
+
+// Evaluates a hand of five, six or seven cards given as a mask;
+// returns the same value as eval_5hand/eval_6hand/eval_7hand, or
+// 0 for any other number of cards.  With at most seven cards a
+// suit of five or more rules out quads and full houses, so a flush
+// returns at once; otherwise the four suit masks are turned into
+// rank counts through quinary_lo/hi and hashed.  Build with
+// -mpopcnt (or -march) where available; the one popcount here is
+// a library call otherwise.
+static inline unsigned short
+eval_mask(uint64_t m)
+{
+    unsigned key = 0;
+
+    for (int s = 0; s < 4; s++)
+    {
+        int r = CARD_SUIT_MASK(m, s);
+
+        // flushes7[] is zero for masks of fewer than five ranks.
+        if (flushes7[r])
+            return flushes7[r];
+        key += quinary_lo[r & 0x7f] + quinary_hi[r >> 7];
+    }
+
+    switch (__builtin_popcountll(m))
+    {
+    case 5:
+        return hash5q_values[find_fast5q(key)];
+    case 6:
+        return hash6_values[find_fast6(key)];
+    case 7:
+        return hash7_values[find_fast7(key)];
+    }
+    return 0;
+}
+
+// Evaluates n (5, 6 or 7) cards given as card indexes.
+static inline unsigned short
+eval_index(const uint8_t *idx, int n)
+{
+    return eval_mask(index_mask(idx, n));
+}
+
+#endif
@@ -0,0 +1,326 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "enumerate.h"
+
+// Multithreaded enumeration of k-card combinations.
+//
+// The rank range is cut into one contiguous slice per worker.
+// Each worker takes CHUNK ranks at a time from the front of its
+// own slice; when that runs dry it steals the back half of the
+// largest slice left, so threads that finish early keep busy
+// until the whole range is done.
+//
+
+#define CHUNK      4096     // ranks taken per lock acquisition
+#define MAX_THREADS 256
+
+static uint64_t binom[53][ENUM_MAX_K + 2];
+static pthread_once_t binom_once = PTHREAD_ONCE_INIT;
+
+static void
+init_binom(void)
+{
+    for (int n = 0; n <= 52; n++)
+    {
+        binom[n][0] = 1;
+        for (int k = 1; k <= ENUM_MAX_K + 1; k++)
+            binom[n][k] = n ? binom[n-1][k-1] + binom[n-1][k] : 0;
+    }
+}
+
+uint64_t
+n_choose_k(int n, int k)
+{
+    pthread_once(&binom_once, init_binom);
+    if (n < 0 || k < 0 || k > ENUM_MAX_K + 1 || n > 52)
+        return 0;
+    return binom[n][k];
+}
+
+uint64_t
+colex_rank(const int *idx, int k)
+{
+    uint64_t r = 0;
+
+    pthread_once(&binom_once, init_binom);
+    for (int i = 0; i < k; i++)
+        r += binom[idx[i]][i+1];
+    return r;
+}
+
+void
+colex_unrank(uint64_t rank, int k, int *idx)
+{
+    int c = 52;
+
+    pthread_once(&binom_once, init_binom);
+    for (int i = k-1; i >= 0; i--)
+    {
+        // Largest c with C(c, i+1) <= rank; positions decrease.
+        while (binom[c][i+1] > rank)
+            c--;
+        idx[i] = c;
+        rank -= binom[c][i+1];
+    }
+}
+
+
+struct slice
+{
+    pthread_mutex_t lock;
+    uint64_t next, end;
+} __attribute__((aligned(64)));
+
+struct run
+{
+    const struct enum_spec *spec;
+    unsigned short (*eval)(int *);  // enum_values fast path
+    struct slice *slices;
+    int nworkers;
+    char *locals;
+    size_t stride;
+};
+
+struct worker
+{
+    struct run *run;
+    int id;
+};
+
+// Takes the next chunk from the worker's own slice, or steals
+// half of the largest other slice.  Returns 0 when all work is
+// gone.
+static int
+take_work(struct run *run, int id, uint64_t *first, uint64_t *count)
+{
+    struct slice *own = &run->slices[id];
+
+    for (;;)
+    {
+        pthread_mutex_lock(&own->lock);
+        if (own->next < own->end)
+        {
+            uint64_t n = own->end - own->next;
+            *first = own->next;
+            *count = n < CHUNK ? n : CHUNK;
+            __atomic_store_n(&own->next, own->next + *count, __ATOMIC_RELAXED);
+            pthread_mutex_unlock(&own->lock);
+            return 1;
+        }
+        pthread_mutex_unlock(&own->lock);
+
+        // Pick the victim with the most work left.  The sizes are
+        // read without locks; the steal itself re-checks.
+        int victim = -1;
+        uint64_t most = 0;
+        for (int i = 0; i < run->nworkers; i++)
+        {
+            uint64_t next = __atomic_load_n(&run->slices[i].next, __ATOMIC_RELAXED);
+            uint64_t end  = __atomic_load_n(&run->slices[i].end, __ATOMIC_RELAXED);
+            if (i != id && end > next && end - next > most)
+            {
+                most = end - next;
+                victim = i;
+            }
+        }
+        if (victim < 0)
+            return 0;
+
+        struct slice *v = &run->slices[victim];
+        uint64_t lo = 0, hi = 0;
+        pthread_mutex_lock(&v->lock);
+        if (v->next < v->end)
+        {
+            uint64_t left = v->end - v->next;
+            uint64_t half = left > CHUNK ? left / 2 : left;
+            hi = v->end;
+            lo = v->end - half;
+            __atomic_store_n(&v->end, lo, __ATOMIC_RELAXED);
+        }
+        pthread_mutex_unlock(&v->lock);
+
+        if (lo < hi)
+        {
+            pthread_mutex_lock(&own->lock);
+            __atomic_store_n(&own->next, lo, __ATOMIC_RELAXED);
+            __atomic_store_n(&own->end, hi, __ATOMIC_RELAXED);
+            pthread_mutex_unlock(&own->lock);
+        }
+    }
+}
+
+// Visits count combinations in colex order, starting at rank first.
+static void
+visit_range(struct run *run, void *local, uint64_t first, uint64_t count)
+{
+    const struct enum_spec *spec = run->spec;
+    const int *pool = spec->pool;
+    int k = spec->k, idx[ENUM_MAX_K + 1], hand[ENUM_MAX_K];
+
+    colex_unrank(first, k, idx);
+    idx[k] = spec->npool;
+    for (int i = 0; i < k; i++)
+        hand[i] = pool[idx[i]];
+
+    for (;;)
+    {
+        if (run->eval)
+            ((unsigned long *)local)[run->eval(hand)]++;
+        else
+            spec->visit(hand, local, spec->arg);
+
+        if (--count == 0)
+            break;
+
+        // Colex successor: bump the lowest position that has room,
+        // and reset the ones below it.
+        int j = 0;
+        while (idx[j] + 1 == idx[j+1])
+            j++;
+        idx[j]++;
+        hand[j] = pool[idx[j]];
+        for (int i = 0; i < j; i++)
+        {
+            idx[i] = i;
+            hand[i] = pool[i];
+        }
+    }
+}
+
+static void *
+work(void *p)
+{
+    struct worker *w = p;
+    struct run *run = w->run;
+    void *local = run->locals + w->id * run->stride;
+    uint64_t first, count;
+
+    while (take_work(run, w->id, &first, &count))
+        visit_range(run, local, first, count);
+    return NULL;
+}
+
+static int
+run_spec(const struct enum_spec *spec, unsigned short (*eval)(int *),
+         void *total)
+{
+    struct run run;
+    struct worker workers[MAX_THREADS];
+    pthread_t tids[MAX_THREADS];
+    int started[MAX_THREADS];
+    uint64_t total_ranks, first, count;
+    int n = spec->nthreads;
+
+    if (spec->k < 1 || spec->k > ENUM_MAX_K || spec->npool > 52 || spec->npool < spec->k)
+        return -1;
+    if (!eval && (!spec->visit || (spec->local_size && !spec->merge)))
+        return -1;
+
+    total_ranks = n_choose_k(spec->npool, spec->k);
+    first = spec->first;
+    if (first > total_ranks)
+        return -1;
+    count = spec->count ? spec->count : total_ranks - first;
+    if (count > total_ranks - first)
+        return -1;
+    if (count == 0)
+        return 0;
+
+    if (n <= 0)
+        n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1)
+        n = 1;
+    if (n > MAX_THREADS)
+        n = MAX_THREADS;
+    if ((uint64_t)n > count / CHUNK + 1)
+        n = (int)(count / CHUNK + 1);
+
+    run.spec = spec;
+    run.eval = eval;
+    run.nworkers = n;
+    run.stride = (spec->local_size + 63) & ~(size_t)63;
+    run.slices = aligned_alloc(64, sizeof(struct slice) * n);
+    run.locals = run.stride ? aligned_alloc(64, run.stride * n) : NULL;
+    if (!run.slices || (run.stride && !run.locals))
+    {
+        free(run.slices);
+        free(run.locals);
+        return -1;
+    }
+    if (run.locals)
+        memset(run.locals, 0, run.stride * n);
+
+    for (int i = 0; i < n; i++)
+    {
+        pthread_mutex_init(&run.slices[i].lock, NULL);
+        run.slices[i].next = first + count * i / n;
+        run.slices[i].end  = first + count * (i+1) / n;
+        workers[i].run = &run;
+        workers[i].id = i;
+    }
+
+    // The calling thread is worker 0.  If a thread cannot be
+    // created its slice is simply stolen by the others.
+    for (int i = 1; i < n; i++)
+        started[i] = !pthread_create(&tids[i], NULL, work, &workers[i]);
+    work(&workers[0]);
+    for (int i = 1; i < n; i++)
+        if (started[i])
+            pthread_join(tids[i], NULL);
+
+    for (int i = 0; i < n; i++)
+    {
+        if (spec->local_size)
+            spec->merge(total, run.locals + i * run.stride, spec->arg);
+        pthread_mutex_destroy(&run.slices[i].lock);
+    }
+
+    free(run.slices);
+    free(run.locals);
+    return 0;
+}
+
+int
+enum_run(const struct enum_spec *spec, void *total)
+{
+    return run_spec(spec, NULL, total);
+}
+
+
+static void
+merge_counts(void *total, const void *local, void *arg)
+{
+    unsigned long *t = total;
+    const unsigned long *l = local;
+
+    (void)arg;
+    for (int v = 0; v <= 7462; v++)
+        t[v] += l[v];
+}
+
+int
+enum_values(const int *pool, int npool, int k,
+            unsigned short (*eval)(int *), int nthreads,
+            unsigned long *counts)
+{
+    return enum_values_range(pool, npool, k, eval, nthreads, 0, 0, counts);
+}
+
+int
+enum_values_range(const int *pool, int npool, int k,
+                  unsigned short (*eval)(int *), int nthreads,
+                  uint64_t first, uint64_t count, unsigned long *counts)
+{
+    struct enum_spec spec = {
+        .pool = pool, .npool = npool, .k = k, .nthreads = nthreads,
+        .first = first, .count = count,
+        .merge = merge_counts,
+        .local_size = sizeof(unsigned long) * 7463,
+    };
+
+    if (!eval)
+        return -1;
+    return run_spec(&spec, eval, counts);
+}
@@ -0,0 +1,83 @@
+#ifndef ENUMERATE_H
+#define ENUMERATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//
+//   Exhaustive enumeration of k-card combinations.
+//
+//   A combination is a set of k distinct positions into a pool of
+//   at most 52 cards, written in ascending order.  Combinations are
+//   numbered by their colex rank,
+//
+//       rank = C(idx[0], 1) + C(idx[1], 2) + ... + C(idx[k-1], k)
+//
+//   which runs from 0 to C(npool, k) - 1 and does not depend on the
+//   size of the pool, so any range of ranks can be handed to a
+//   thread (or another machine) on its own.
+//
+
+#define ENUM_MAX_K  10
+
+// Number of ways to choose k of n things, for n <= 52 and
+// k <= ENUM_MAX_K (0 when k > n).
+uint64_t
+n_choose_k(int n, int k);
+
+// Colex rank of the ascending positions idx[0..k-1].
+uint64_t
+colex_rank(const int *idx, int k);
+
+// Inverse of colex_rank.
+void
+colex_unrank(uint64_t rank, int k, int *idx);
+
+// Called once per combination with its k cards.  local is the
+// calling thread's private state (local_size bytes, zeroed before
+// the run) and arg is passed through unchanged.
+typedef void (*enum_visit_fn)(const int *cards, void *local, void *arg);
+
+// Folds one thread's local state into total once all threads
+// have finished.  Called in thread order, one thread at a time.
+typedef void (*enum_merge_fn)(void *total, const void *local, void *arg);
+
+struct enum_spec
+{
+    const int *pool;        // cards to choose from
+    int npool;              // pool size, at most 52
+    int k;                  // cards per combination, 1..ENUM_MAX_K
+    int nthreads;           // worker threads, 0 = one per online CPU
+
+    uint64_t first;         // first colex rank to visit
+    uint64_t count;         // number of ranks to visit, 0 = to the end
+
+    enum_visit_fn visit;
+    enum_merge_fn merge;    // may be NULL if local_size is 0
+    size_t local_size;
+    void *arg;
+};
+
+// Visits every combination in the spec's rank range, split over
+// a pool of threads that steal work from each other, then merges
+// the per-thread state into total.  Returns 0 on success, -1 if
+// the spec is invalid or memory ran out.
+int
+enum_run(const struct enum_spec *spec, void *total);
+
+// Convenience wrapper: evaluates every k-card combination of the
+// pool with eval and adds the number of hands of each value to
+// counts[0..7462].  counts is not cleared first.
+int
+enum_values(const int *pool, int npool, int k,
+            unsigned short (*eval)(int *), int nthreads,
+            unsigned long *counts);
+
+// Same, over the colex ranks first to first + count - 1 only
+// (count 0 = to the end), so a run can be split into pieces.
+int
+enum_values_range(const int *pool, int npool, int k,
+                  unsigned short (*eval)(int *), int nthreads,
+                  uint64_t first, uint64_t count, unsigned long *counts);
+
+#endif
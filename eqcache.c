@@ -0,0 +1,378 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "poker.h"
+#include "iso.h"
+#include "eqcache.h"
+
+// Layout: SHARDS shards, each an array of sets of WAYS entries.
+// The low bits of a key's hash pick the shard and the next ones
+// the set.  Lookups take the shard's lock shared and mark the hit
+// entry's reference bit atomically; inserts take it exclusively
+// and sweep the set's clock hand past referenced entries.
+
+#define SHARDS      64
+#define WAYS        8
+
+#define FILE_MAGIC      "PKEQCACH"
+#define FILE_VERSION    2
+#define FILE_BYTE_ORDER 0x01020304
+
+struct entry
+{
+    struct eqcache_key key;
+    struct equity_result res;
+};
+
+struct set
+{
+    uint8_t valid;                  // one bit per way
+    uint8_t ref;                    // CLOCK reference bits
+    uint8_t hand;                   // next way to consider
+    uint64_t hash[WAYS];
+    struct entry e[WAYS];
+};
+
+struct shard
+{
+    pthread_rwlock_t lock;
+    struct set *sets;
+    uint64_t hits, misses, insertions, evictions;
+} __attribute__((aligned(64)));
+
+struct eqcache
+{
+    struct shard shards[SHARDS];
+    size_t nsets;                   // per shard, a power of two
+};
+
+struct file_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t key_size;
+    uint32_t result_size;
+    uint32_t byte_order;            // FILE_BYTE_ORDER as written
+    uint64_t count;
+};
+
+
+static int
+position(int card)
+{
+    return (3 - __builtin_ctz((card >> 12) & 0xF)) * 13 + RANK(card) - Deuce;
+}
+
+uint64_t
+eqcache_key_hash(const struct eqcache_key *k)
+{
+    const unsigned char *b = (const unsigned char *)k;
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    for (size_t i = 0; i < sizeof(*k); i++)
+    {
+        h ^= b[i];
+        h *= 0x100000001b3ull;
+    }
+    return h ^ (h >> 29);
+}
+
+int
+eqcache_key(const struct equity_query *q, struct eqcache_key *k,
+            struct equity_query *cq, int *cdead)
+{
+    int cards[2*EQ_MAX_PLAYERS + 5 + EQC_MAX_DEAD], sizes[EQ_MAX_PLAYERS + 2];
+    int n = 0, ng = 0;
+
+    if (q->nplayers < 1 || q->nplayers > EQ_MAX_PLAYERS)
+        return -1;
+    if (q->nboard < 0 || q->nboard > 5 || q->ndead < 0 || (q->ndead && !q->dead))
+        return -1;
+    if (q->ndead > EQC_MAX_DEAD)
+        return 1;
+
+    for (int p = 0; p < q->nplayers; p++)
+    {
+        cards[n++] = q->hole[p][0];
+        cards[n++] = q->hole[p][1];
+        sizes[ng++] = 2;
+    }
+    for (int i = 0; i < q->nboard; i++)
+        cards[n++] = q->board[i];
+    sizes[ng++] = q->nboard;
+    for (int i = 0; i < q->ndead; i++)
+        cards[n++] = q->dead[i];
+    sizes[ng++] = q->ndead;
+
+    if (iso_canonical(cards, sizes, ng, cards, NULL) < 0)
+        return -1;
+
+    memset(k, 0, sizeof(*k));
+    k->max_evals = q->max_evals;
+    k->trials = q->trials;
+    k->seed = q->seed;
+    k->ci_width = q->ci_width;
+    k->nplayers = q->nplayers;
+    k->nboard = q->nboard;
+    k->ndead = q->ndead;
+    for (int i = 0; i < n; i++)
+        k->cards[i] = position(cards[i]);
+
+    *cq = *q;
+    n = 0;
+    for (int p = 0; p < q->nplayers; p++)
+    {
+        cq->hole[p][0] = cards[n++];
+        cq->hole[p][1] = cards[n++];
+    }
+    for (int i = 0; i < q->nboard; i++)
+        cq->board[i] = cards[n++];
+    for (int i = 0; i < q->ndead; i++)
+        cdead[i] = cards[n++];
+    cq->dead = cdead;
+    return 0;
+}
+
+static struct set *
+find_set(struct eqcache *c, uint64_t hash, struct shard **shard)
+{
+    *shard = &c->shards[hash % SHARDS];
+    return &(*shard)->sets[(hash / SHARDS) & (c->nsets - 1)];
+}
+
+// Returns the way holding the key, or -1.  Called with the lock held.
+static int
+find_way(const struct set *s, uint64_t hash, const struct eqcache_key *k)
+{
+    for (int w = 0; w < WAYS; w++)
+        if ((s->valid >> w & 1) && s->hash[w] == hash &&
+            !memcmp(&s->e[w].key, k, sizeof(*k)))
+            return w;
+    return -1;
+}
+
+static int
+lookup(struct eqcache *c, uint64_t hash, const struct eqcache_key *k,
+       struct equity_result *res)
+{
+    struct shard *sh;
+    struct set *s = find_set(c, hash, &sh);
+    int w;
+
+    pthread_rwlock_rdlock(&sh->lock);
+    if ((w = find_way(s, hash, k)) >= 0)
+    {
+        *res = s->e[w].res;
+        __atomic_fetch_or(&s->ref, 1 << w, __ATOMIC_RELAXED);
+    }
+    pthread_rwlock_unlock(&sh->lock);
+
+    __atomic_fetch_add(w >= 0 ? &sh->hits : &sh->misses, 1, __ATOMIC_RELAXED);
+    return w >= 0;
+}
+
+static void
+insert(struct eqcache *c, uint64_t hash, const struct eqcache_key *k,
+       const struct equity_result *res)
+{
+    struct shard *sh;
+    struct set *s = find_set(c, hash, &sh);
+    int w;
+
+    pthread_rwlock_wrlock(&sh->lock);
+    if (find_way(s, hash, k) >= 0)
+    {
+        // Another thread got here first with the same answer.
+        pthread_rwlock_unlock(&sh->lock);
+        return;
+    }
+
+    if (s->valid != (1 << WAYS) - 1)
+        w = __builtin_ctz(~s->valid);
+    else
+    {
+        // Second chance: clear referenced ways until one is not.
+        while (s->ref >> s->hand & 1)
+        {
+            s->ref &= ~(1 << s->hand);
+            s->hand = (s->hand + 1) % WAYS;
+        }
+        w = s->hand;
+        s->hand = (s->hand + 1) % WAYS;
+        sh->evictions++;
+    }
+
+    s->valid |= 1 << w;
+    s->ref &= ~(1 << w);
+    s->hash[w] = hash;
+    memcpy(&s->e[w].key, k, sizeof(*k));     // padding too
+    s->e[w].res = *res;
+    sh->insertions++;
+    pthread_rwlock_unlock(&sh->lock);
+}
+
+
+struct eqcache *
+eqcache_create(size_t max_entries)
+{
+    struct eqcache *c = aligned_alloc(64, sizeof(*c));
+    size_t nsets = 1;
+
+    if (!c)
+        return NULL;
+    while (nsets * 2 * SHARDS * WAYS <= max_entries)
+        nsets *= 2;
+
+    c->nsets = nsets;
+    for (int i = 0; i < SHARDS; i++)
+    {
+        struct shard *sh = &c->shards[i];
+
+        memset(sh, 0, sizeof(*sh));
+        sh->sets = calloc(nsets, sizeof(struct set));
+        if (!sh->sets)
+        {
+            while (--i >= 0)
+            {
+                free(c->shards[i].sets);
+                pthread_rwlock_destroy(&c->shards[i].lock);
+            }
+            free(c);
+            return NULL;
+        }
+        pthread_rwlock_init(&sh->lock, NULL);
+    }
+    return c;
+}
+
+size_t
+eqcache_entry_bytes(void)
+{
+    return sizeof(struct set) / WAYS;
+}
+
+void
+eqcache_destroy(struct eqcache *c)
+{
+    if (!c)
+        return;
+    for (int i = 0; i < SHARDS; i++)
+    {
+        free(c->shards[i].sets);
+        pthread_rwlock_destroy(&c->shards[i].lock);
+    }
+    free(c);
+}
+
+int
+eqcache_calc(struct eqcache *c, const struct equity_query *q,
+             struct equity_result *res)
+{
+    struct equity_query cq;
+    struct eqcache_key k;
+    int cdead[EQC_MAX_DEAD];
+    int rc = eqcache_key(q, &k, &cq, cdead);
+
+    if (rc < 0)
+        return -1;
+    if (rc > 0)
+        return equity_calc(q, res);
+
+    uint64_t hash = eqcache_key_hash(&k);
+    if (lookup(c, hash, &k, res))
+        return 0;
+    if (equity_calc(&cq, res) < 0)
+        return -1;
+    insert(c, hash, &k, res);
+    return 0;
+}
+
+void
+eqcache_get_stats(struct eqcache *c, struct eqcache_stats *s)
+{
+    memset(s, 0, sizeof(*s));
+    s->capacity = c->nsets * SHARDS * WAYS;
+    for (int i = 0; i < SHARDS; i++)
+    {
+        struct shard *sh = &c->shards[i];
+
+        s->hits += __atomic_load_n(&sh->hits, __ATOMIC_RELAXED);
+        s->misses += __atomic_load_n(&sh->misses, __ATOMIC_RELAXED);
+        pthread_rwlock_rdlock(&sh->lock);
+        s->insertions += sh->insertions;
+        s->evictions += sh->evictions;
+        for (size_t j = 0; j < c->nsets; j++)
+            s->entries += __builtin_popcount(sh->sets[j].valid);
+        pthread_rwlock_unlock(&sh->lock);
+    }
+}
+
+int
+eqcache_save(struct eqcache *c, const char *path)
+{
+    struct file_header h;
+    FILE *f = fopen(path, "wb");
+    int ok = 1;
+
+    if (!f)
+        return -1;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, FILE_MAGIC, 8);
+    h.version = FILE_VERSION;
+    h.byte_order = FILE_BYTE_ORDER;
+    h.key_size = sizeof(struct eqcache_key);
+    h.result_size = sizeof(struct equity_result);
+
+    // The count is filled in once the entries are written.
+    ok = fwrite(&h, sizeof(h), 1, f) == 1;
+    for (int i = 0; ok && i < SHARDS; i++)
+    {
+        struct shard *sh = &c->shards[i];
+
+        pthread_rwlock_rdlock(&sh->lock);
+        for (size_t j = 0; ok && j < c->nsets; j++)
+            for (int w = 0; ok && w < WAYS; w++)
+                if (sh->sets[j].valid >> w & 1)
+                {
+                    ok = fwrite(&sh->sets[j].e[w], sizeof(struct entry), 1, f) == 1;
+                    h.count++;
+                }
+        pthread_rwlock_unlock(&sh->lock);
+    }
+    if (ok)
+        ok = !fseek(f, 0, SEEK_SET) && fwrite(&h, sizeof(h), 1, f) == 1;
+    if (fclose(f) != 0)
+        ok = 0;
+    return ok ? 0 : -1;
+}
+
+int
+eqcache_load(struct eqcache *c, const char *path)
+{
+    struct file_header h;
+    struct entry e;
+    FILE *f = fopen(path, "rb");
+
+    if (!f)
+        return -1;
+    if (fread(&h, sizeof(h), 1, f) != 1 || memcmp(h.magic, FILE_MAGIC, 8) ||
+        h.version != FILE_VERSION || h.byte_order != FILE_BYTE_ORDER ||
+        h.key_size != sizeof(struct eqcache_key) ||
+        h.result_size != sizeof(struct equity_result))
+    {
+        fclose(f);
+        return -1;
+    }
+    for (uint64_t i = 0; i < h.count; i++)
+    {
+        if (fread(&e, sizeof(e), 1, f) != 1)
+        {
+            fclose(f);
+            return -1;
+        }
+        insert(c, eqcache_key_hash(&e.key), &e.key, &e.res);
+    }
+    fclose(f);
+    return 0;
+}
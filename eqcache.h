@@ -0,0 +1,98 @@
+#ifndef EQCACHE_H
+#define EQCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "equity.h"
+
+//
+//   Equity result cache.
+//
+//   eqcache_calc() answers an equity query like equity_calc(), but
+//   first maps it to its suit-canonical form (see iso.h) and looks
+//   that up, so repeated and suit-isomorphic queries are computed
+//   once.  The cache is split into shards, each behind its own
+//   reader/writer lock, so lookups from many threads run side by
+//   side.  Each shard is set-associative, and a full set evicts
+//   with the CLOCK (second chance) policy.
+//
+//   The key is the canonical cards plus max_evals, trials, seed and
+//   ci_width; nthreads is not part of it, so a Monte Carlo answer may come
+//   from a run with a different thread count.  Results are always
+//   computed on the canonical query, so a hit returns exactly what
+//   the first caller got.  Queries with more than EQC_MAX_DEAD dead
+//   cards bypass the cache.
+//
+
+#define EQC_MAX_DEAD    8
+
+struct eqcache;
+
+struct eqcache_stats
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+    uint64_t evictions;
+    size_t entries;                 // results held now
+    size_t capacity;                // most results it will hold
+};
+
+// Creates a cache of at most max_entries results (rounded down
+// to a power of two, with a floor of 512), each taking
+// eqcache_entry_bytes(), about 420 bytes on x86-64.  Returns NULL
+// if memory runs out.
+struct eqcache *
+eqcache_create(size_t max_entries);
+
+size_t
+eqcache_entry_bytes(void);
+
+void
+eqcache_destroy(struct eqcache *c);
+
+// equity_calc() through the cache.  Returns 0 or -1, as equity_calc.
+int
+eqcache_calc(struct eqcache *c, const struct equity_query *q,
+             struct equity_result *res);
+
+void
+eqcache_get_stats(struct eqcache *c, struct eqcache_stats *s);
+
+// Writes every cached result to a file, or reads such a file back
+// in, for example to start a service with a precomputed table of
+// preflop matchups.  Entries are written as raw structs, in the
+// host's byte order and struct layout.  The header records a byte
+// order marker and the key and result sizes, so a file from a host
+// of the other byte order, or from a build with another
+// EQ_MAX_PLAYERS or key layout, is refused on load.  Both return
+// 0, or -1 on I/O errors or a file that does not match.
+int
+eqcache_save(struct eqcache *c, const char *path);
+
+int
+eqcache_load(struct eqcache *c, const char *path);
+
+// The key a query is cached under: its suit-canonical cards and the
+// parameters that change the answer.  Queries whose keys compare
+// equal with memcmp() get the same result.
+struct eqcache_key
+{
+    uint64_t max_evals, trials, seed;
+    double ci_width;
+    uint8_t nplayers, nboard, ndead;
+    uint8_t cards[2*EQ_MAX_PLAYERS + 5 + EQC_MAX_DEAD];    // positions
+};
+
+// Fills in the key of q, and cq with the canonical query that is
+// computed for it; cq's dead cards are stored in cdead, which needs
+// room for EQC_MAX_DEAD.  Returns 0, -1 if the query is invalid, or
+// 1 if it has too many dead cards to be keyed.
+int
+eqcache_key(const struct equity_query *q, struct eqcache_key *k,
+            struct equity_query *cq, int *cdead);
+
+uint64_t
+eqcache_key_hash(const struct eqcache_key *k);
+
+#endif
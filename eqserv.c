@@ -0,0 +1,367 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "eqcache.h"
+#include "eqserv.h"
+
+// Queued queries form a singly linked FIFO behind one mutex.  A
+// worker holding the lock either takes a batch from the front or
+// sleeps on the condition variable, with a timeout when the oldest
+// query's latency budget has not yet run out.  Submitters only
+// signal when a sleeping worker could have something new to do:
+// the queue was empty, or it has just reached a full batch.
+//
+// A batch is keyed with eqcache_key() outside the lock, sorted by
+// key and answered one run of equal keys at a time, each run with
+// one equity_calc or eqcache_calc call of its own.
+//
+
+#define MAX_THREADS     256
+#define DEFAULT_BATCH   64
+#define MAX_BATCH       1024
+
+struct request
+{
+    struct request *next;
+    struct equity_query q;
+    int dead[52];                   // q.dead points here
+    eqserv_done done;
+    void *arg;
+    uint64_t queued_at;             // CLOCK_MONOTONIC, ns
+
+    // Filled in by the worker.
+    uint64_t hash;
+    struct eqcache_key key;
+    struct equity_query cq;         // canonical query
+    int cdead[EQC_MAX_DEAD];
+};
+
+struct eqserv
+{
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    struct request *head, *tail;
+    size_t queued;
+    int stop;
+
+    int nworkers, batch_max, query_threads;
+    uint64_t latency_ns;
+    struct eqcache *cache;
+    pthread_t tids[MAX_THREADS];
+
+    uint64_t submitted, batches;    // under the lock
+    uint64_t completed, computed, deduplicated;     // atomic
+};
+
+static uint64_t
+now_ns(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+static int
+cmp_request(const void *a, const void *b)
+{
+    const struct request *x = *(const struct request * const *)a;
+    const struct request *y = *(const struct request * const *)b;
+
+    if (x->hash != y->hash)
+        return x->hash < y->hash ? -1 : 1;
+    return memcmp(&x->key, &y->key, sizeof(x->key));
+}
+
+static void
+finish(struct eqserv *s, struct request *r, int status,
+       const struct equity_result *res)
+{
+    // Counted first, so that a caller woken by the answer finds it
+    // in the statistics.
+    __atomic_fetch_add(&s->completed, 1, __ATOMIC_RELAXED);
+    r->done(r->arg, status, res);
+    free(r);
+}
+
+// Answers one query, through the cache if there is one.
+static int
+compute(struct eqserv *s, const struct equity_query *q,
+        struct equity_result *res)
+{
+    __atomic_fetch_add(&s->computed, 1, __ATOMIC_RELAXED);
+    if (s->cache)
+        return eqcache_calc(s->cache, q, res);
+    return equity_calc(q, res);
+}
+
+static void
+run_batch(struct eqserv *s, struct request **batch, int n)
+{
+    struct equity_result res;
+    int nkeyed = 0;
+
+    // Key every query; the keyed ones go to the front, in order
+    // of key, and the rest are answered on their own.
+    for (int i = 0; i < n; i++)
+    {
+        struct request *r = batch[i];
+        int rc;
+
+        r->q.nthreads = s->query_threads;
+        rc = eqcache_key(&r->q, &r->key, &r->cq, r->cdead);
+        if (rc < 0)
+        {
+            memset(&res, 0, sizeof(res));
+            finish(s, r, -1, &res);
+            continue;
+        }
+        if (rc > 0)
+        {
+            int status = compute(s, &r->q, &res);
+            if (status < 0)
+                memset(&res, 0, sizeof(res));
+            finish(s, r, status, &res);
+            continue;
+        }
+        r->hash = eqcache_key_hash(&r->key);
+        batch[nkeyed++] = r;
+    }
+    qsort(batch, nkeyed, sizeof(batch[0]), cmp_request);
+
+    for (int i = 0, j; i < nkeyed; i = j)
+    {
+        // The cache computes on the canonical query too, so the
+        // answer is the same whichever way it gets there.
+        int status = s->cache ? compute(s, &batch[i]->q, &res)
+                              : compute(s, &batch[i]->cq, &res);
+        if (status < 0)
+            memset(&res, 0, sizeof(res));
+
+        for (j = i + 1; j < nkeyed && !cmp_request(&batch[i], &batch[j]); j++)
+            ;
+        __atomic_fetch_add(&s->deduplicated, j - i - 1, __ATOMIC_RELAXED);
+        for (int k = i; k < j; k++)
+            finish(s, batch[k], status, &res);
+    }
+}
+
+static void *
+work(void *p)
+{
+    struct eqserv *s = p;
+    struct request *batch[MAX_BATCH];
+
+    pthread_mutex_lock(&s->lock);
+    for (;;)
+    {
+        while (!s->head && !s->stop)
+            pthread_cond_wait(&s->wake, &s->lock);
+        if (!s->head)
+            break;
+
+        // Wait for a full batch while the oldest query has budget
+        // left; shutting down takes whatever is there.
+        if (s->queued < (size_t)s->batch_max && !s->stop && s->latency_ns)
+        {
+            uint64_t deadline = s->head->queued_at + s->latency_ns;
+            if (now_ns() < deadline)
+            {
+                struct timespec ts = {
+                    .tv_sec = deadline / 1000000000,
+                    .tv_nsec = deadline % 1000000000,
+                };
+                pthread_cond_timedwait(&s->wake, &s->lock, &ts);
+                continue;
+            }
+        }
+
+        int n = 0;
+        while (s->head && n < s->batch_max)
+        {
+            batch[n++] = s->head;
+            s->head = s->head->next;
+        }
+        if (!s->head)
+            s->tail = NULL;
+        s->queued -= n;
+        s->batches++;
+
+        // Leave the lock with the rest of the queue for another
+        // worker.
+        if (s->head)
+            pthread_cond_signal(&s->wake);
+        pthread_mutex_unlock(&s->lock);
+
+        run_batch(s, batch, n);
+
+        pthread_mutex_lock(&s->lock);
+    }
+    pthread_mutex_unlock(&s->lock);
+    return NULL;
+}
+
+struct eqserv *
+eqserv_create(const struct eqserv_config *cfg)
+{
+    struct eqserv *s;
+    pthread_condattr_t attr;
+    int n = cfg->nworkers;
+
+    if (cfg->nworkers < 0 || cfg->batch_max < 0 || cfg->batch_max > MAX_BATCH ||
+        cfg->query_threads < 0)
+        return NULL;
+    if (!(s = aligned_alloc(64, (sizeof(*s) + 63) & ~(size_t)63)))
+        return NULL;
+    memset(s, 0, sizeof(*s));
+
+    if (n <= 0)
+        n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1)
+        n = 1;
+    if (n > MAX_THREADS)
+        n = MAX_THREADS;
+    s->batch_max = cfg->batch_max ? cfg->batch_max : DEFAULT_BATCH;
+    s->query_threads = cfg->query_threads ? cfg->query_threads : 1;
+    s->latency_ns = (uint64_t)cfg->latency_us * 1000;
+
+    if (cfg->cache_entries && !(s->cache = eqcache_create(cfg->cache_entries)))
+    {
+        free(s);
+        return NULL;
+    }
+
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&s->wake, &attr);
+    pthread_condattr_destroy(&attr);
+
+    // Run with the workers that could be started, if any.
+    for (int i = 0; i < n; i++)
+        if (!pthread_create(&s->tids[s->nworkers], NULL, work, s))
+            s->nworkers++;
+    if (!s->nworkers)
+    {
+        eqserv_destroy(s);
+        return NULL;
+    }
+    return s;
+}
+
+void
+eqserv_destroy(struct eqserv *s)
+{
+    if (!s)
+        return;
+    pthread_mutex_lock(&s->lock);
+    s->stop = 1;
+    pthread_cond_broadcast(&s->wake);
+    pthread_mutex_unlock(&s->lock);
+    for (int i = 0; i < s->nworkers; i++)
+        pthread_join(s->tids[i], NULL);
+
+    pthread_cond_destroy(&s->wake);
+    pthread_mutex_destroy(&s->lock);
+    eqcache_destroy(s->cache);
+    free(s);
+}
+
+int
+eqserv_submit(struct eqserv *s, const struct equity_query *q,
+              eqserv_done done, void *arg)
+{
+    struct request *r = malloc(sizeof(*r));
+
+    if (!r)
+        return -1;
+    r->next = NULL;
+    r->q = *q;
+    r->done = done;
+    r->arg = arg;
+
+    // An invalid dead card count is left for the worker to report.
+    if (q->ndead > 0 && q->ndead <= 52 && q->dead)
+    {
+        memcpy(r->dead, q->dead, sizeof(int) * q->ndead);
+        r->q.dead = r->dead;
+    }
+    else if (q->ndead)
+        r->q.dead = NULL;
+
+    pthread_mutex_lock(&s->lock);
+    r->queued_at = now_ns();
+    if (s->tail)
+        s->tail->next = r;
+    else
+        s->head = r;
+    s->tail = r;
+    s->queued++;
+    s->submitted++;
+    if (s->queued == 1 || s->queued == (size_t)s->batch_max)
+        pthread_cond_signal(&s->wake);
+    pthread_mutex_unlock(&s->lock);
+    return 0;
+}
+
+
+static void
+future_done(void *arg, int status, const struct equity_result *res)
+{
+    struct eqserv_future *f = arg;
+
+    pthread_mutex_lock(&f->lock);
+    f->status = status;
+    f->res = *res;
+    f->done = 1;
+    pthread_cond_signal(&f->cond);
+    pthread_mutex_unlock(&f->lock);
+}
+
+int
+eqserv_submit_future(struct eqserv *s, const struct equity_query *q,
+                     struct eqserv_future *f)
+{
+    pthread_mutex_init(&f->lock, NULL);
+    pthread_cond_init(&f->cond, NULL);
+    f->done = 0;
+    if (eqserv_submit(s, q, future_done, f) < 0)
+    {
+        pthread_cond_destroy(&f->cond);
+        pthread_mutex_destroy(&f->lock);
+        return -1;
+    }
+    return 0;
+}
+
+int
+eqserv_wait(struct eqserv_future *f, struct equity_result *res)
+{
+    int status;
+
+    pthread_mutex_lock(&f->lock);
+    while (!f->done)
+        pthread_cond_wait(&f->cond, &f->lock);
+    status = f->status;
+    *res = f->res;
+    pthread_mutex_unlock(&f->lock);
+
+    pthread_cond_destroy(&f->cond);
+    pthread_mutex_destroy(&f->lock);
+    return status;
+}
+
+void
+eqserv_get_stats(struct eqserv *s, struct eqserv_stats *st)
+{
+    pthread_mutex_lock(&s->lock);
+    st->submitted = s->submitted;
+    st->batches = s->batches;
+    st->queued = s->queued;
+    pthread_mutex_unlock(&s->lock);
+    st->completed = __atomic_load_n(&s->completed, __ATOMIC_RELAXED);
+    st->computed = __atomic_load_n(&s->computed, __ATOMIC_RELAXED);
+    st->deduplicated = __atomic_load_n(&s->deduplicated, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,105 @@
+#ifndef EQSERV_H
+#define EQSERV_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "equity.h"
+
+//
+//   Asynchronous equity service.
+//
+//   eqserv_submit() queues an equity query and returns at once;
+//   the answer is delivered later through a callback, or through
+//   a future with eqserv_submit_future() and eqserv_wait().  A
+//   pool of worker threads takes queued queries in batches.  A
+//   batch only deduplicates: its queries are grouped by
+//   suit-canonical situation (the eqcache key), so identical and
+//   suit-isomorphic ones are computed once, but each distinct
+//   situation is still its own equity_calc (or eqcache_calc) run.
+//   No boards are shared between different situations.  With a
+//   result cache, answers are also kept across batches.
+//
+//   The latency budget bounds how long a query may wait in the
+//   queue for duplicates to arrive.  A worker takes a batch as
+//   soon as batch_max queries are waiting, or when the oldest one
+//   has waited latency_us microseconds.  latency_us = 0 takes the
+//   queue as it stands, for the lowest latency; a larger budget
+//   finds more duplicates under load.
+//
+//   Queries run on the worker that took them with nthreads set to
+//   query_threads, so throughput comes from running many queries
+//   side by side rather than from splitting each one.
+//
+
+struct eqserv_config
+{
+    int nworkers;               // 0 = one per online CPU
+    int batch_max;              // 0 = 64, at most 1024
+    unsigned latency_us;        // most time a query waits for a batch
+    int query_threads;          // threads per query; 0 = 1
+    size_t cache_entries;       // 0 = no result cache (see eqcache.h)
+};
+
+// Called once per query, on a worker thread, with status 0 and
+// the result, or status -1 (and a zeroed result) if the query was
+// invalid or memory ran out.  The result is only valid during the
+// call.
+typedef void (*eqserv_done)(void *arg, int status,
+                            const struct equity_result *res);
+
+struct eqserv_stats
+{
+    uint64_t submitted;
+    uint64_t completed;
+    uint64_t batches;
+    uint64_t computed;          // equity_calc or cache calls made
+    uint64_t deduplicated;      // queries answered by another in their batch
+    size_t queued;              // waiting now
+};
+
+struct eqserv;
+
+// Starts the workers.  Returns NULL if the config is invalid or
+// threads or memory ran out.
+struct eqserv *
+eqserv_create(const struct eqserv_config *cfg);
+
+// Answers every query still queued, then stops the workers and
+// frees the service.  No query may be submitted once this starts.
+void
+eqserv_destroy(struct eqserv *s);
+
+// Queues a copy of q (dead cards included), to be answered through
+// done(arg, ...).  Returns 0, or -1 if memory ran out, in which
+// case done is never called.
+int
+eqserv_submit(struct eqserv *s, const struct equity_query *q,
+              eqserv_done done, void *arg);
+
+// A future: the caller owns the storage and must not touch the
+// fields; they are only here so that futures need no allocation.
+struct eqserv_future
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int done;
+    int status;
+    struct equity_result res;
+};
+
+// eqserv_submit() answered through f.  Returns 0, or -1 as
+// eqserv_submit, in which case f must not be waited on.
+int
+eqserv_submit_future(struct eqserv *s, const struct equity_query *q,
+                     struct eqserv_future *f);
+
+// Waits for the answer, copies it to res and releases f.  Returns
+// the query's status, 0 or -1.
+int
+eqserv_wait(struct eqserv_future *f, struct equity_result *res);
+
+void
+eqserv_get_stats(struct eqserv *s, struct eqserv_stats *st);
+
+#endif
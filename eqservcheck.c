@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "poker.h"
+#include "equity.h"
+#include "eqserv.h"
+
+/****************************************************************
+    This code checks the equity service (see eqserv.h) against
+    equity_calc.  It builds heads-up flop queries, each situation
+    asked several times over, as it is and with its suits
+    relabelled, plus one invalid query.  Every answer from the
+    service must equal the one equity_calc gives for the same
+    query, with the result cache off and on, and the statistics
+    must show the duplicates being found.  Finally it stops a
+    service with every query still queued and checks that each
+    one is answered all the same.
+
+        eqservcheck [--workers n]
+
+    It prints one line per check and exits nonzero if any fails.
+****************************************************************/
+
+#define NSITUATIONS     40
+#define COPIES          10
+#define NQUERIES        (NSITUATIONS * COPIES)
+#define INVALID         7
+
+struct answer
+{
+    int called;
+    int status;
+    struct equity_result res;
+};
+
+static struct equity_query queries[NQUERIES];
+static struct equity_result expected[NQUERIES];
+static int expected_status[NQUERIES];
+static struct answer answers[NQUERIES];
+static struct eqserv_future futures[NQUERIES];
+
+// Relabels the suits of one card: suit i becomes perm[i].
+static int
+relabel(int card, const int *perm, int *deck)
+{
+    int suit = __builtin_ctz(card >> 12 & 0xF);
+
+    return deck[find_card(RANK(card), 1 << (12 + perm[suit]), deck)];
+}
+
+// COPIES queries per situation, next to each other: the first as
+// dealt, the odd ones the same again, the rest with random suits.
+static void
+build_queries(void)
+{
+    struct rng_state rng;
+    int deck[52], cards[52];
+
+    init_deck(deck);
+    memcpy(cards, deck, sizeof(cards));
+    rng_seed(&rng, 5);
+    for (int i = 0; i < NQUERIES; i++)
+    {
+        struct equity_query *q = &queries[i];
+        int perm[4] = { 0, 1, 2, 3 };
+
+        if (i % COPIES == 0)
+        {
+            shuffle_partial(cards, 52, 7, &rng);
+            memset(q, 0, sizeof(*q));
+            q->nplayers = 2;
+            q->hole[0][0] = cards[0];
+            q->hole[0][1] = cards[1];
+            q->hole[1][0] = cards[2];
+            q->hole[1][1] = cards[3];
+            q->nboard = 3;
+            memcpy(q->board, cards + 4, 3 * sizeof(int));
+            q->nthreads = 1;
+            continue;
+        }
+
+        *q = queries[i - i % COPIES];
+        if (i % 2)
+            continue;
+        shuffle_partial(perm, 4, 3, &rng);
+        for (int p = 0; p < 2; p++)
+            for (int c = 0; c < 2; c++)
+                q->hole[p][c] = relabel(q->hole[p][c], perm, deck);
+        for (int b = 0; b < 3; b++)
+            q->board[b] = relabel(q->board[b], perm, deck);
+    }
+    queries[INVALID].nplayers = 0;
+
+    for (int i = 0; i < NQUERIES; i++)
+        expected_status[i] = equity_calc(&queries[i], &expected[i]);
+}
+
+static int
+same_answer(int i, int status, const struct equity_result *res)
+{
+    const struct equity_result *e = &expected[i];
+
+    if (status != expected_status[i])
+        return 0;
+    if (status < 0)
+        return 1;
+    if (res->boards != e->boards || res->exhaustive != e->exhaustive)
+        return 0;
+    for (int p = 0; p < queries[i].nplayers; p++)
+        if (res->wins[p] != e->wins[p] || res->ties[p] != e->ties[p] ||
+            res->equity[p] != e->equity[p])
+            return 0;
+    return 1;
+}
+
+static void
+record(void *arg, int status, const struct equity_result *res)
+{
+    struct answer *a = arg;
+
+    a->status = status;
+    a->res = *res;
+    __atomic_store_n(&a->called, 1, __ATOMIC_RELEASE);
+}
+
+static double
+seconds_since(struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+// Every query through futures, the answers checked against
+// equity_calc and the statistics against what was sent.
+static int
+check_answers(int nworkers, size_t cache_entries)
+{
+    struct eqserv_config cfg = {
+        .nworkers = nworkers, .batch_max = 64, .latency_us = 2000,
+        .cache_entries = cache_entries,
+    };
+    struct eqserv *s = eqserv_create(&cfg);
+    struct eqserv_stats st;
+    struct equity_result res;
+    struct timespec start;
+    int wrong = 0, first = -1;
+
+    if (!s) {
+        fprintf(stderr, "eqserv_create failed\n");
+        return 1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < NQUERIES; i++)
+        if (eqserv_submit_future(s, &queries[i], &futures[i]) < 0) {
+            fprintf(stderr, "eqserv_submit_future failed\n");
+            return 1;
+        }
+    for (int i = 0; i < NQUERIES; i++)
+    {
+        int status = eqserv_wait(&futures[i], &res);
+
+        if (!same_answer(i, status, &res) && !wrong++)
+            first = i;
+    }
+    double secs = seconds_since(&start);
+
+    eqserv_get_stats(s, &st);
+    eqserv_destroy(s);
+
+    printf("%s cache: %d queries in %.1f ms, %llu batches, %llu computed, "
+           "%llu deduplicated\n", cache_entries ? "with" : "no",
+           NQUERIES, secs * 1e3, (unsigned long long)st.batches,
+           (unsigned long long)st.computed, (unsigned long long)st.deduplicated);
+    if (wrong)
+        printf("    %d answers differ from equity_calc, the first query %d\n",
+               wrong, first);
+    if (st.submitted != NQUERIES || st.completed != NQUERIES || st.queued)
+        printf("    %llu submitted, %llu completed, %zu queued\n",
+               (unsigned long long)st.submitted, (unsigned long long)st.completed,
+               st.queued);
+    if (!st.batches || !st.deduplicated || st.computed >= st.submitted)
+        printf("    no duplicates found\n");
+
+    return wrong || st.submitted != NQUERIES || st.completed != NQUERIES ||
+           st.queued || !st.batches || !st.deduplicated ||
+           st.computed >= st.submitted;
+}
+
+// Queries held back by a long latency budget, then the service
+// destroyed at once: each must still get its answer, the invalid
+// one included, without the budget running out first.
+static int
+check_drain(void)
+{
+    struct eqserv_config cfg = {
+        .nworkers = 1, .batch_max = 1024, .latency_us = 10000000,
+    };
+    struct eqserv *s = eqserv_create(&cfg);
+    struct eqserv_stats st;
+    struct timespec start;
+    int missing = 0, wrong = 0;
+
+    if (!s) {
+        fprintf(stderr, "eqserv_create failed\n");
+        return 1;
+    }
+    memset(answers, 0, sizeof(answers));
+    for (int i = 0; i < NQUERIES; i++)
+        if (eqserv_submit(s, &queries[i], record, &answers[i]) < 0) {
+            fprintf(stderr, "eqserv_submit failed\n");
+            return 1;
+        }
+    eqserv_get_stats(s, &st);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    eqserv_destroy(s);
+    double secs = seconds_since(&start);
+
+    for (int i = 0; i < NQUERIES; i++)
+    {
+        if (!__atomic_load_n(&answers[i].called, __ATOMIC_ACQUIRE))
+            missing++;
+        else if (!same_answer(i, answers[i].status, &answers[i].res))
+            wrong++;
+    }
+    printf("destroy: %zu of %d queries queued, answered in %.1f ms, "
+           "%d missing, %d wrong\n", st.queued, NQUERIES, secs * 1e3,
+           missing, wrong);
+    return st.queued != NQUERIES || missing || wrong ||
+           secs >= cfg.latency_us / 1e6;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int nworkers = 0, usage = 0, failed = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--workers") && i+1 < argc)
+            nworkers = atoi(argv[++i]);
+        else
+            usage = 1;
+    }
+    if (usage || nworkers < 0) {
+        fprintf(stderr, "usage: eqservcheck [--workers n]\n");
+        return 1;
+    }
+
+    build_queries();
+    if (expected_status[INVALID] != -1) {
+        fprintf(stderr, "equity_calc accepted the invalid query\n");
+        return 1;
+    }
+
+    failed |= check_answers(nworkers, 0);
+    failed |= check_answers(nworkers, 4096);
+    failed |= check_drain();
+    printf("%s\n", failed ? "FAILED" : "ok");
+    return failed;
+}
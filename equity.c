@@ -0,0 +1,491 @@
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "pokereval.h"
+#include "cards.h"
+#include "enumerate.h"
+#include "equity.h"
+#include "sim.h"
+
+// Hold'em equity engine.
+//
+// Every board is scored the same way: the five board cards are
+// folded into an eval_partial once, and each player's hole cards
+// are then added to it, so a board costs the board's share of the
+// evaluation once and two cards' worth per player.  The known
+// board cards are folded in once per query, before any dealing.
+//
+// Dead cards are removed once, when the pool of live cards is
+// built; exhaustive runs hand that pool to the enumeration engine
+// and each Monte Carlo thread deals from it through its own struct
+// sim (see sim.h), so no trial rebuilds a deck.
+//
+// Adaptive runs take the first board card from each live card in
+// turn (one round is one board per live card) and keep per-card
+// sums of each player's pot share and its square.  Within a card
+// the boards are independent, so the variance of the overall
+// estimate is the mean of the per-card variances divided by the
+// number of cards and rounds, which is never more than plain
+// sampling gives.  Passes end on whole rounds, so every card
+// carries the same weight.
+//
+
+#define MAX_THREADS 256
+
+struct context
+{
+    int nplayers;
+    int hole[EQ_MAX_PLAYERS][2];
+    int board[5];
+    int nboard;
+    struct eval_partial known;  // the known board cards
+    int need;                   // board cards still to come
+    int live[52];               // cards not in anyone's hand
+    int nlive;
+};
+
+// Returns the position (0-51) of the card in the init_deck()
+// order, or -1 if it is not a valid card.
+static int
+card_position(int card, const int *deck)
+{
+    int suit = (card >> 12) & 0xF, rank = RANK(card);
+
+    if (rank < Deuce || rank > Ace || !suit || (suit & (suit - 1)))
+        return -1;
+
+    int i = (3 - __builtin_ctz(suit)) * 13 + rank - Deuce;
+    return (deck[i] == card) ? i : -1;
+}
+
+// Scores one complete board.  If units is not NULL, it gets each
+// player's share of this board's pot.
+static void
+score_board(const struct context *ctx, const struct eval_partial *board,
+            struct equity_counts *c, unsigned *units)
+{
+    unsigned short val[EQ_MAX_PLAYERS], best = 9999;
+    int nbest = 0;
+
+    for (int p = 0; p < ctx->nplayers; p++)
+    {
+        val[p] = eval_partial_hole(board, ctx->hole[p][0], ctx->hole[p][1], 7);
+        if (val[p] < best)
+        {
+            best = val[p];
+            nbest = 1;
+        }
+        else if (val[p] == best)
+            nbest++;
+    }
+
+    c->boards++;
+    for (int p = 0; p < ctx->nplayers; p++)
+    {
+        if (val[p] == best)
+        {
+            if (nbest == 1)
+                c->wins[p]++;
+            else
+                c->ties[p]++;
+            c->share[p] += EQ_SHARE_UNIT / nbest;
+        }
+        if (units)
+            units[p] = (val[p] == best) ? EQ_SHARE_UNIT / nbest : 0;
+    }
+}
+
+static void
+visit_board(const int *cards, void *local, void *arg)
+{
+    const struct context *ctx = arg;
+    struct eval_partial board = ctx->known;
+
+    for (int i = 0; i < ctx->need; i++)
+        eval_partial_add(&board, cards[i]);
+    score_board(ctx, &board, local, NULL);
+}
+
+static void
+merge_counts(void *total, const void *local, void *arg)
+{
+    struct equity_counts *t = total;
+    const struct equity_counts *l = local;
+
+    (void)arg;
+    t->boards += l->boards;
+    for (int p = 0; p < EQ_MAX_PLAYERS; p++)
+    {
+        t->wins[p]  += l->wins[p];
+        t->ties[p]  += l->ties[p];
+        t->share[p] += l->share[p];
+    }
+}
+
+
+struct mc_worker
+{
+    const struct context *ctx;
+    uint64_t trials;
+    struct sim *sim;                // deals this worker's boards
+    struct equity_counts counts;
+} __attribute__((aligned(64)));
+
+static void *
+mc_work(void *p)
+{
+    struct mc_worker *w = p;
+    const struct context *ctx = w->ctx;
+
+    for (uint64_t t = 0; t < w->trials; t++)
+    {
+        struct eval_partial board = ctx->known;
+        const int *cards = sim_deal(w->sim, ctx->need);
+
+        for (int i = 0; i < ctx->need; i++)
+            eval_partial_add(&board, cards[i]);
+        score_board(ctx, &board, &w->counts, NULL);
+    }
+    return NULL;
+}
+
+static int
+run_monte_carlo(const struct context *ctx, uint64_t trials, uint64_t seed,
+                int nthreads, struct equity_counts *total)
+{
+    pthread_t tids[MAX_THREADS];
+    int started[MAX_THREADS];
+    struct mc_worker *w = aligned_alloc(64, sizeof(*w) * nthreads);
+    uint64_t dead = ((1ull << 52) - 1) & ~hand_mask(ctx->live, ctx->nlive);
+    int rc = 0;
+
+    if (!w)
+        return -1;
+    for (int i = 0; i < nthreads; i++)
+    {
+        memset(&w[i], 0, sizeof(w[i]));
+        w[i].ctx = ctx;
+        w[i].trials = trials * (i+1) / nthreads - trials * i / nthreads;
+        uint64_t wseed = seed + 0x632be59bd9b4e019ull * i;
+
+        if ((w[i].sim = sim_create(0, wseed)))
+            sim_reset(w[i].sim, dead, wseed);
+        else
+            rc = -1;
+    }
+    if (rc < 0)
+        goto out;
+
+    // A thread that cannot be started runs its share here instead.
+    for (int i = 1; i < nthreads; i++)
+        started[i] = !pthread_create(&tids[i], NULL, mc_work, &w[i]);
+    mc_work(&w[0]);
+    for (int i = 1; i < nthreads; i++)
+    {
+        if (started[i])
+            pthread_join(tids[i], NULL);
+        else
+            mc_work(&w[i]);
+    }
+
+    for (int i = 0; i < nthreads; i++)
+        merge_counts(total, &w[i].counts, NULL);
+
+out:
+    for (int i = 0; i < nthreads; i++)
+        sim_destroy(w[i].sim);
+    free(w);
+    return rc;
+}
+
+
+struct ad_worker
+{
+    const struct context *ctx;
+    uint64_t rounds;                // to run in this pass
+    struct rng_state rng;
+    int card[52], pos[52];          // live[] order, and its inverse
+    struct equity_counts counts;
+    uint64_t sum[52][EQ_MAX_PLAYERS];       // share units, per first card
+    uint64_t sumsq[52][EQ_MAX_PLAYERS];
+} __attribute__((aligned(64)));
+
+static inline void
+swap_slots(struct ad_worker *w, int a, int b)
+{
+    int t = w->card[a];
+
+    w->card[a] = w->card[b];
+    w->card[b] = t;
+    w->pos[w->card[a]] = a;
+    w->pos[w->card[b]] = b;
+}
+
+static void *
+ad_work(void *p)
+{
+    struct ad_worker *w = p;
+    const struct context *ctx = w->ctx;
+    int last = ctx->nlive - 1;
+    unsigned units[EQ_MAX_PLAYERS];
+
+    for (uint64_t r = 0; r < w->rounds; r++)
+        for (int h = 0; h <= last; h++)
+        {
+            // Park the first card at the end and deal the rest of
+            // the board from the cards before it.
+            struct eval_partial board = ctx->known;
+
+            swap_slots(w, w->pos[h], last);
+            eval_partial_add(&board, ctx->live[h]);
+            for (int i = 0; i < ctx->need - 1; i++)
+            {
+                swap_slots(w, i, i + rng_below(&w->rng, last - i));
+                eval_partial_add(&board, ctx->live[w->card[i]]);
+            }
+            score_board(ctx, &board, &w->counts, units);
+
+            for (int q = 0; q < ctx->nplayers; q++)
+            {
+                w->sum[h][q] += units[q];
+                w->sumsq[h][q] += (uint64_t)units[q] * units[q];
+            }
+        }
+    return NULL;
+}
+
+// Runs rounds of boards until every player's 95% interval is at
+// most width wide or max_rounds have been run, and fills in the
+// counts and each player's interval half-width.
+static int
+run_adaptive(const struct context *ctx, double width, uint64_t max_rounds,
+             uint64_t seed, int nthreads, struct equity_counts *total,
+             double *error)
+{
+    pthread_t tids[MAX_THREADS];
+    int started[MAX_THREADS];
+    struct ad_worker *w = aligned_alloc(64, sizeof(*w) * nthreads);
+    int nstrata = ctx->nlive;
+    uint64_t done = 0, next;
+
+    if (!w)
+        return -1;
+    for (int i = 0; i < nthreads; i++)
+    {
+        memset(&w[i], 0, sizeof(w[i]));
+        w[i].ctx = ctx;
+        rng_seed(&w[i].rng, seed + 0x632be59bd9b4e019ull * i);
+        for (int j = 0; j < nstrata; j++)
+            w[i].card[j] = w[i].pos[j] = j;
+    }
+
+    // A first pass of about a thousand boards, and at least two
+    // rounds, so that every card has a variance.
+    next = (1000 + nstrata - 1) / nstrata;
+    if (next < 2)
+        next = 2;
+    for (;;)
+    {
+        if (next > max_rounds - done)
+            next = max_rounds - done;
+        for (int i = 0; i < nthreads; i++)
+            w[i].rounds = next * (i+1) / nthreads - next * i / nthreads;
+
+        for (int i = 1; i < nthreads; i++)
+            started[i] = !pthread_create(&tids[i], NULL, ad_work, &w[i]);
+        ad_work(&w[0]);
+        for (int i = 1; i < nthreads; i++)
+        {
+            if (started[i])
+                pthread_join(tids[i], NULL);
+            else
+                ad_work(&w[i]);
+        }
+        done += next;
+
+        // Stratified variance: the per-card sample variances,
+        // averaged over cards and divided by the boards drawn.
+        double worst = 0;
+        for (int p = 0; p < ctx->nplayers; p++)
+        {
+            double var = 0;
+            for (int h = 0; h < nstrata; h++)
+            {
+                double s = 0, ss = 0;
+                for (int i = 0; i < nthreads; i++)
+                {
+                    s += w[i].sum[h][p];
+                    ss += w[i].sumsq[h][p];
+                }
+                if (done > 1)
+                    var += (ss - s * s / done) / (done - 1);
+            }
+            var /= (double)EQ_SHARE_UNIT * EQ_SHARE_UNIT * nstrata;
+            error[p] = 1.96 * sqrt(var > 0 ? var / (done * nstrata) : 0);
+            if (2 * error[p] > worst)
+                worst = 2 * error[p];
+        }
+        if (worst <= width || done >= max_rounds)
+            break;
+
+        // The width shrinks as one over the square root of the
+        // boards; aim a little past the estimate, and grow by at
+        // least an eighth so that passes do not get too small.
+        double want = done * (worst / width) * (worst / width) * 1.1;
+        next = want > done ? (uint64_t)(want - done) : 1;
+        if (next < done / 8)
+            next = done / 8 ? done / 8 : 1;
+    }
+
+    for (int i = 0; i < nthreads; i++)
+        merge_counts(total, &w[i].counts, NULL);
+    free(w);
+    return 0;
+}
+
+
+// Checks the query and fills in the context.  Returns -1 on a
+// bad query.
+static int
+setup(const struct equity_query *q, struct context *ctx)
+{
+    int deck[52], used[52] = { 0 };
+
+    if (q->nplayers < 1 || q->nplayers > EQ_MAX_PLAYERS)
+        return -1;
+    if (q->nboard < 0 || q->nboard > 5 || q->ndead < 0 || (q->ndead && !q->dead))
+        return -1;
+
+    init_deck(deck);
+
+    // Mark every known card, rejecting bad or repeated ones.
+    ctx->nplayers = q->nplayers;
+    ctx->nboard = q->nboard;
+    ctx->need = 5 - q->nboard;
+    for (int p = 0; p < q->nplayers; p++)
+        for (int j = 0; j < 2; j++)
+        {
+            int i = card_position(q->hole[p][j], deck);
+            if (i < 0 || used[i]++)
+                return -1;
+            ctx->hole[p][j] = q->hole[p][j];
+        }
+    for (int b = 0; b < q->nboard; b++)
+    {
+        int i = card_position(q->board[b], deck);
+        if (i < 0 || used[i]++)
+            return -1;
+        ctx->board[b] = q->board[b];
+    }
+    for (int d = 0; d < q->ndead; d++)
+    {
+        int i = card_position(q->dead[d], deck);
+        if (i < 0 || used[i]++)
+            return -1;
+    }
+
+    eval_partial_init(&ctx->known, ctx->board, ctx->nboard);
+
+    ctx->nlive = 0;
+    for (int i = 0; i < 52; i++)
+        if (!used[i])
+            ctx->live[ctx->nlive++] = deck[i];
+    return ctx->nlive < ctx->need ? -1 : 0;
+}
+
+// Scores the boards of colex rank first to first + count - 1.
+static int
+count_boards(const struct context *ctx, uint64_t first, uint64_t count,
+             int nthreads, struct equity_counts *total)
+{
+    if (ctx->need == 0)
+    {
+        // The board is complete: rank 0 is the only one.
+        if (first == 0 && count)
+            score_board(ctx, &ctx->known, total, NULL);
+        return 0;
+    }
+
+    struct enum_spec spec = {
+        .pool = ctx->live, .npool = ctx->nlive, .k = ctx->need,
+        .nthreads = nthreads, .first = first, .count = count,
+        .visit = visit_board, .merge = merge_counts,
+        .local_size = sizeof(struct equity_counts), .arg = (void *)ctx,
+    };
+    return count ? enum_run(&spec, total) : 0;
+}
+
+uint64_t
+equity_boards(const struct equity_query *q)
+{
+    struct context ctx;
+
+    return setup(q, &ctx) < 0 ? 0 : n_choose_k(ctx.nlive, ctx.need);
+}
+
+int
+equity_count(const struct equity_query *q, uint64_t first, uint64_t count,
+             struct equity_counts *c)
+{
+    struct context ctx;
+
+    if (setup(q, &ctx) < 0)
+        return -1;
+
+    uint64_t boards = n_choose_k(ctx.nlive, ctx.need);
+    if (first > boards || count > boards - first)
+        return -1;
+    return count_boards(&ctx, first, count, q->nthreads, c);
+}
+
+int
+equity_calc(const struct equity_query *q, struct equity_result *res)
+{
+    struct context ctx;
+    struct equity_counts total;
+    int nthreads = q->nthreads;
+    uint64_t max_evals = q->max_evals ? q->max_evals : EQ_DEFAULT_MAX_EVALS;
+    uint64_t trials = q->trials ? q->trials : EQ_DEFAULT_TRIALS;
+
+    if (setup(q, &ctx) < 0)
+        return -1;
+
+    if (nthreads <= 0)
+        nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads < 1)
+        nthreads = 1;
+    if (nthreads > MAX_THREADS)
+        nthreads = MAX_THREADS;
+
+    memset(&total, 0, sizeof(total));
+    memset(res, 0, sizeof(*res));
+
+    uint64_t boards = n_choose_k(ctx.nlive, ctx.need);
+    if (boards * q->nplayers <= max_evals)
+    {
+        res->exhaustive = 1;
+        if (count_boards(&ctx, 0, boards, nthreads, &total) < 0)
+            return -1;
+    }
+    else if (q->ci_width > 0)
+    {
+        uint64_t rounds = trials / ctx.nlive;
+        if (run_adaptive(&ctx, q->ci_width, rounds > 2 ? rounds : 2, q->seed,
+                         nthreads, &total, res->error) < 0)
+            return -1;
+    }
+    else if (run_monte_carlo(&ctx, trials, q->seed, nthreads, &total) < 0)
+        return -1;
+
+    res->boards = total.boards;
+    for (int p = 0; p < q->nplayers; p++)
+    {
+        res->wins[p] = total.wins[p];
+        res->ties[p] = total.ties[p];
+        res->equity[p] = total.boards ?
+            (double)total.share[p] / EQ_SHARE_UNIT / total.boards : 0;
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+#ifndef EQUITY_H
+#define EQUITY_H
+
+#include <stdint.h>
+
+//
+//   Hold'em equity: given each player's hole cards and a partial
+//   board (0-5 cards), how often does each player win or split?
+//
+//   When the number of remaining boards is small enough every one
+//   of them is dealt (exhaustive mode); otherwise boards are drawn
+//   at random (Monte Carlo mode).  Either way the work is spread
+//   over threads.  Cards use the init_deck() encoding.
+//
+//   A Monte Carlo run normally draws a fixed number of boards.  With
+//   ci_width set it is adaptive instead: the first board card still
+//   to come is stratified (every live card leads the same number of
+//   boards) and boards are drawn in growing passes until the 95%
+//   confidence interval of every player's equity is at most
+//   ci_width wide, or trials boards have been drawn.
+//
+
+#define EQ_MAX_PLAYERS  10
+
+// Default limit on boards * players for exhaustive mode.  That is
+// a few tenths of a second of evaluation on one core, and covers
+// every heads-up preflop matchup (1,712,304 boards).
+#define EQ_DEFAULT_MAX_EVALS  50000000
+
+// Default number of Monte Carlo boards, and the most an adaptive
+// run draws.
+#define EQ_DEFAULT_TRIALS     1000000
+
+// Pot shares are counted in units of 1/EQ_SHARE_UNIT, which divides
+// evenly for any number of players up to ten.
+#define EQ_SHARE_UNIT  2520
+
+struct equity_query
+{
+    int nplayers;                       // 1..EQ_MAX_PLAYERS
+    int hole[EQ_MAX_PLAYERS][2];
+    int board[5];                       // known board cards
+    int nboard;                         // 0..5
+    const int *dead;                    // other cards known to be out
+    int ndead;
+
+    uint64_t max_evals;                 // 0 = EQ_DEFAULT_MAX_EVALS
+    uint64_t trials;                    // 0 = EQ_DEFAULT_TRIALS
+    uint64_t seed;                      // Monte Carlo seed
+    double ci_width;                    // 0 = fixed trials, else adaptive
+    int nthreads;                       // 0 = one per online CPU
+};
+
+struct equity_result
+{
+    int exhaustive;                     // 1 if every board was dealt
+    uint64_t boards;                    // boards evaluated
+    uint64_t wins[EQ_MAX_PLAYERS];      // boards won outright
+    uint64_t ties[EQ_MAX_PLAYERS];      // boards split with others
+    double equity[EQ_MAX_PLAYERS];      // share of the pot, 0..1
+    double error[EQ_MAX_PLAYERS];       // adaptive runs: half-width of
+                                        // the 95% interval, else 0
+};
+
+// Computes the equity of every player in the query.  Returns 0
+// on success, or -1 if the query is invalid (bad or duplicate
+// cards, too many players) or memory ran out.
+int
+equity_calc(const struct equity_query *q, struct equity_result *res);
+
+// Raw counts behind an exhaustive result.  Every field only ever
+// grows by adding, so counts over disjoint sets of boards merge
+// exactly by adding them up.
+struct equity_counts
+{
+    uint64_t boards;
+    uint64_t wins[EQ_MAX_PLAYERS];
+    uint64_t ties[EQ_MAX_PLAYERS];
+    uint64_t share[EQ_MAX_PLAYERS];     // in units of 1/EQ_SHARE_UNIT pot
+};
+
+// Number of boards still to deal for the query (1 if the board is
+// complete), or 0 if the query is invalid.
+uint64_t
+equity_boards(const struct equity_query *q);
+
+// Scores, as exhaustive mode does, the boards whose colex ranks
+// over the live cards (see enumerate.h) run from first to
+// first + count - 1, and adds their counts to c.  max_evals, trials
+// and seed are ignored.  Returns 0, or -1 if the query is invalid,
+// the range runs past the last board or memory ran out.
+int
+equity_count(const struct equity_query *q, uint64_t first, uint64_t count,
+             struct equity_counts *c);
+
+#endif
@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench.h"
+
+/****************************************************************
+    This code benchmarks the evaluators on hand sets that are
+    harder on them than allfive's ordered sweep: uniformly random
+    hands and showdown mixes (see bench.h), one hand per call or
+    in batches.  Each evaluator is first checked against the
+    known category counts over every hand of its size, and the
+    program exits with status 1 if any count is off.
+
+        evalbench [-n hands] [-p passes] [--threads n] [--no-check]
+                  [evaluator ...]
+
+    With no names every evaluator is run.  The scaling table runs
+    the random set on 1, 2, 4, ... threads up to --threads, which
+    defaults to one per CPU.
+****************************************************************/
+
+static const char *workloads[] = { "ordered", "random", "showdown" };
+
+int
+main(int argc, char *argv[])
+{
+    size_t nhands = 1 << 20;
+    int passes = 3, nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int check = 1, failed = 0, nnames = 0;
+    const char *names[32];
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-n") && i+1 < argc)
+            nhands = strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "-p") && i+1 < argc)
+            passes = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && i+1 < argc)
+            nthreads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--no-check"))
+            check = 0;
+        else if (argv[i][0] != '-' && nnames < 32)
+            names[nnames++] = argv[i];
+        else {
+            fprintf(stderr, "usage: %s [-n hands] [-p passes] [--threads n] "
+                            "[--no-check] [evaluator ...]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (nhands < 1 || passes < 1)
+        return 1;
+    if (nthreads < 1)
+        nthreads = 1;
+
+    printf("%zu hands per set, %d passes\n\n", nhands, passes);
+    printf("%-18s %-9s %9s %12s\n", "evaluator", "hands", "ns/eval", "Mevals/s");
+
+    for (const struct bench_evaluator *ev = bench_evaluators; ev->name; ev++)
+    {
+        int wanted = !nnames;
+        for (int i = 0; i < nnames; i++)
+            wanted |= !strcmp(names[i], ev->name);
+        if (!wanted)
+            continue;
+
+        if (check)
+        {
+            uint64_t freq[10];
+            int ok = bench_check(ev, 0, freq);
+            if (ok != 1)
+            {
+                printf("%-18s FAILED category check", ev->name);
+                for (int i = 0; i < 10; i++)
+                    printf(" %llu", (unsigned long long)freq[i]);
+                printf("\n");
+                failed = 1;
+                continue;
+            }
+        }
+
+        for (int wl = BENCH_ORDERED; wl <= BENCH_SHOWDOWN; wl++)
+        {
+            struct bench_spec spec = { ev, wl, nhands, passes, 1, 1 };
+            struct bench_result res;
+
+            if (bench_run(&spec, &res) < 0) {
+                fprintf(stderr, "%s: benchmark failed\n", ev->name);
+                return 1;
+            }
+            printf("%-18s %-9s %9.2f %12.1f\n", ev->name, workloads[wl],
+                   res.ns_per_eval, res.evals_per_sec / 1e6);
+        }
+    }
+
+    // Scaling: threads each run the whole random set, so perfect
+    // scaling keeps the per-thread rate flat.
+    printf("\n%-18s %7s %12s %16s %8s\n", "evaluator", "threads",
+           "Mevals/s", "Mevals/s/thread", "speedup");
+    for (const struct bench_evaluator *ev = bench_evaluators; ev->name; ev++)
+    {
+        int wanted = !nnames;
+        double base = 0;
+
+        for (int i = 0; i < nnames; i++)
+            wanted |= !strcmp(names[i], ev->name);
+        if (!wanted)
+            continue;
+        for (int t = 1; ; t = t*2 < nthreads ? t*2 : nthreads)
+        {
+            struct bench_spec spec = { ev, BENCH_RANDOM, nhands, passes, t, 1 };
+            struct bench_result res;
+
+            if (bench_run(&spec, &res) < 0) {
+                fprintf(stderr, "%s: benchmark failed\n", ev->name);
+                return 1;
+            }
+            if (t == 1)
+                base = res.evals_per_sec;
+            printf("%-18s %7d %12.1f %16.1f %7.2fx\n", ev->name, res.nthreads,
+                   res.evals_per_sec / 1e6, res.evals_per_sec_thread / 1e6,
+                   res.evals_per_sec / base);
+            if (t == nthreads)
+                break;
+        }
+    }
+
+    return failed;
+}
@@ -0,0 +1,241 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "evalstats.h"
+
+// Per-thread counter blocks.  Blocks are pushed onto one list
+// under a lock and never freed; a thread that exits marks its
+// block free, and the next thread to attach takes it over with
+// its counts intact.  Only the owning thread writes a block, so
+// the snapshot reads it with relaxed loads and no lock beyond
+// the one guarding the list head.
+//
+// Hardware counters are one perf_event group per thread, opened
+// the first time that thread samples with sampling on, so a
+// single read(2) fetches every counter at once.
+
+__thread struct eval_stats_block *eval_stats_local;
+
+static pthread_mutex_t blocks_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct eval_stats_block *blocks;
+static pthread_key_t blocks_key;
+static pthread_once_t blocks_once = PTHREAD_ONCE_INIT;
+
+static int perf_on;
+static int perf_seen[EVAL_PERF_COUNT];
+
+static const char *stat_names[EVAL_STAT_COUNT] = {
+    "5_flush", "5_unique", "5_hash", "n_flush", "n_hash",
+    "7hand", "batch_calls", "batch_hands",
+};
+
+static const char *perf_names[EVAL_PERF_COUNT] = {
+    "cycles", "branch_misses", "l1d_misses",
+};
+
+static void
+detach(void *p)
+{
+    struct eval_stats_block *b = p;
+
+    for (int i = 0; i < EVAL_PERF_COUNT; i++)
+        if (b->perf_fd[i] >= 0)
+        {
+            close(b->perf_fd[i]);
+            b->perf_fd[i] = -1;
+        }
+    b->perf_group = -1;
+    pthread_mutex_lock(&blocks_lock);
+    b->in_use = 0;
+    pthread_mutex_unlock(&blocks_lock);
+}
+
+static void
+init_key(void)
+{
+    pthread_key_create(&blocks_key, detach);
+}
+
+struct eval_stats_block *
+eval_stats_attach(void)
+{
+    struct eval_stats_block *b;
+
+    pthread_once(&blocks_once, init_key);
+    pthread_mutex_lock(&blocks_lock);
+    for (b = blocks; b && b->in_use; b = b->next)
+        ;
+    if (!b)
+    {
+        // Without memory there is nowhere to count; abort rather
+        // than hand the hot path a null block.
+        if (!(b = aligned_alloc(64, sizeof(*b))))
+            abort();
+        memset(b, 0, sizeof(*b));
+        for (int i = 0; i < EVAL_PERF_COUNT; i++)
+            b->perf_fd[i] = -1;
+        b->perf_group = -1;
+        b->next = blocks;
+        __atomic_store_n(&blocks, b, __ATOMIC_RELEASE);
+    }
+    b->in_use = 1;
+    pthread_mutex_unlock(&blocks_lock);
+
+    pthread_setspecific(blocks_key, b);
+    eval_stats_local = b;
+    return b;
+}
+
+void
+eval_stats_snapshot(struct eval_stats *s)
+{
+    struct eval_stats_block *b;
+
+    memset(s, 0, sizeof(*s));
+#ifdef EVAL_STATS
+    s->enabled = 1;
+#endif
+    s->perf = __atomic_load_n(&perf_on, __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&blocks_lock);
+    b = blocks;
+    pthread_mutex_unlock(&blocks_lock);
+
+    for (; b; b = b->next)
+    {
+        for (int i = 0; i < EVAL_STAT_COUNT; i++)
+            s->count[i] += __atomic_load_n(&b->count[i], __ATOMIC_RELAXED);
+        s->perf_calls += __atomic_load_n(&b->perf_calls, __ATOMIC_RELAXED);
+        for (int i = 0; i < EVAL_PERF_COUNT; i++)
+            s->perf_count[i] += __atomic_load_n(&b->perf_count[i], __ATOMIC_RELAXED);
+    }
+    for (int i = 0; i < EVAL_PERF_COUNT; i++)
+        s->perf_available[i] = __atomic_load_n(&perf_seen[i], __ATOMIC_RELAXED);
+}
+
+const char *
+eval_stats_name(int i)
+{
+    return (i >= 0 && i < EVAL_STAT_COUNT) ? stat_names[i] : NULL;
+}
+
+const char *
+eval_perf_name(int i)
+{
+    return (i >= 0 && i < EVAL_PERF_COUNT) ? perf_names[i] : NULL;
+}
+
+int
+eval_stats_perf(int on)
+{
+#ifdef EVAL_STATS
+    __atomic_store_n(&perf_on, !!on, __ATOMIC_RELAXED);
+    return 0;
+#else
+    (void)on;
+    return -1;
+#endif
+}
+
+
+static int
+open_counter(int i, int group)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    switch (i)
+    {
+    case EVAL_PERF_CYCLES:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case EVAL_PERF_BRANCH_MISSES:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    default:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_L1D |
+                      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+// Opens this thread's group.  The first counter that opens leads
+// it; the group stays empty (and sampling a no-op) if none does.
+static void
+open_group(struct eval_stats_block *b)
+{
+    for (int i = 0; i < EVAL_PERF_COUNT; i++)
+    {
+        b->perf_fd[i] = open_counter(i, b->perf_group);
+        if (b->perf_fd[i] < 0)
+            continue;
+        if (b->perf_group < 0)
+            b->perf_group = b->perf_fd[i];
+        __atomic_store_n(&perf_seen[i], 1, __ATOMIC_RELAXED);
+    }
+}
+
+// Reads the group into v[], in counter order.  Returns 0 or -1.
+static int
+read_group(const struct eval_stats_block *b, uint64_t *v)
+{
+    uint64_t buf[1 + EVAL_PERF_COUNT];
+    int n = 1;
+
+    if (read(b->perf_group, buf, sizeof(buf)) < (ssize_t)sizeof(uint64_t))
+        return -1;
+    for (int i = 0; i < EVAL_PERF_COUNT; i++)
+        v[i] = (b->perf_fd[i] >= 0 && n <= (int)buf[0]) ? buf[n++] : 0;
+    return 0;
+}
+
+void
+eval_stats_perf_begin(struct eval_perf_sample *ps)
+{
+    struct eval_stats_block *b;
+
+    ps->active = 0;
+    if (!__atomic_load_n(&perf_on, __ATOMIC_RELAXED))
+        return;
+    if (!(b = eval_stats_local))
+        b = eval_stats_attach();
+    if (b->perf_group < 0)
+    {
+        // Tried once per thread; -2 marks a thread with no group.
+        if (b->perf_group == -2)
+            return;
+        open_group(b);
+        if (b->perf_group < 0)
+        {
+            b->perf_group = -2;
+            return;
+        }
+    }
+    ps->active = !read_group(b, ps->start);
+}
+
+void
+eval_stats_perf_end(struct eval_perf_sample *ps)
+{
+    struct eval_stats_block *b = eval_stats_local;
+    uint64_t end[EVAL_PERF_COUNT];
+
+    if (!ps->active || read_group(b, end) < 0)
+        return;
+    for (int i = 0; i < EVAL_PERF_COUNT; i++)
+        __atomic_store_n(&b->perf_count[i],
+                         b->perf_count[i] + end[i] - ps->start[i], __ATOMIC_RELAXED);
+    __atomic_store_n(&b->perf_calls, b->perf_calls + 1, __ATOMIC_RELAXED);
+}
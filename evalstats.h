@@ -0,0 +1,123 @@
+#ifndef EVALSTATS_H
+#define EVALSTATS_H
+
+#include <stdint.h>
+
+//
+//   Evaluator statistics.
+//
+//   Building everything with -DEVAL_STATS makes the evaluators
+//   count which path each hand takes, and lets eval_5hand_batch()
+//   (or any caller, with eval_stats_perf_begin/end) read hardware
+//   counters around a call.  Without the flag the counting macros
+//   in pokereval.h are empty and the snapshot reads all zeros, so
+//   the hot path is the same code as before.
+//
+//   Each thread counts into its own cache line, with plain stores,
+//   so the counts cost an add each and no locked instructions.  A
+//   thread's line is kept when it exits and reused by the next new
+//   thread, so counts are never lost and only grow; exporters
+//   should treat them as monotonic counters.
+//
+
+// Counters.  The eval_5cards paths count scalar five-card
+// evaluation only: the AVX2/AVX-512 batch loops do all three paths
+// for every lane and show up under EVAL_STAT_BATCH_HANDS.
+enum
+{
+    EVAL_STAT_5_FLUSH,          // eval_5cards: flushes[] hits
+    EVAL_STAT_5_UNIQUE,         // eval_5cards: unique5[] hits
+    EVAL_STAT_5_HASH,           // eval_5cards: perfect-hash lookups
+    EVAL_STAT_N_FLUSH,          // eval_6cards/eval_7cards: flushes7[]
+    EVAL_STAT_N_HASH,           // eval_6cards/eval_7cards: quinary hash
+    EVAL_STAT_7HAND,            // eval_7hand calls (21 subhands each)
+    EVAL_STAT_BATCH_CALLS,      // eval_5hand_batch calls
+    EVAL_STAT_BATCH_HANDS,      // hands passed to them
+    EVAL_STAT_COUNT
+};
+
+// Hardware counters, summed over sampled calls.
+enum
+{
+    EVAL_PERF_CYCLES,
+    EVAL_PERF_BRANCH_MISSES,
+    EVAL_PERF_L1D_MISSES,
+    EVAL_PERF_COUNT
+};
+
+struct eval_stats
+{
+    int enabled;                        // built with EVAL_STATS
+    int perf;                           // sampling is on
+    uint64_t count[EVAL_STAT_COUNT];
+    uint64_t perf_calls;                // calls sampled
+    uint64_t perf_count[EVAL_PERF_COUNT];
+    int perf_available[EVAL_PERF_COUNT];    // counter could be opened
+};
+
+// Sums every thread's counters into s.
+void
+eval_stats_snapshot(struct eval_stats *s);
+
+// Name of counter i, e.g. "5_flush", for exporters.
+const char *
+eval_stats_name(int i);
+const char *
+eval_perf_name(int i);
+
+// Turns hardware counter sampling on or off for all threads.
+// Returns 0, or -1 if the library was built without EVAL_STATS.
+// Counters the kernel refuses are reported as unavailable.
+int
+eval_stats_perf(int on);
+
+// Brackets a call to sample.  The same thread must end what it
+// began; calls do nothing while sampling is off.
+struct eval_perf_sample
+{
+    int active;
+    uint64_t start[EVAL_PERF_COUNT];
+};
+
+void
+eval_stats_perf_begin(struct eval_perf_sample *ps);
+void
+eval_stats_perf_end(struct eval_perf_sample *ps);
+
+
+// Used by the counting macros.
+struct eval_stats_block
+{
+    uint64_t count[EVAL_STAT_COUNT];
+    uint64_t perf_calls;
+    uint64_t perf_count[EVAL_PERF_COUNT];
+    int perf_fd[EVAL_PERF_COUNT];       // -1 when not open
+    int perf_group;                     // leader fd; -1 not tried, -2 none
+    int in_use;
+    struct eval_stats_block *next;
+} __attribute__((aligned(64)));
+
+extern __thread struct eval_stats_block *eval_stats_local;
+
+struct eval_stats_block *
+eval_stats_attach(void);
+
+static inline void
+eval_stats_add(int c, uint64_t n)
+{
+    struct eval_stats_block *b = eval_stats_local;
+
+    if (__builtin_expect(!b, 0))
+        b = eval_stats_attach();
+    __atomic_store_n(&b->count[c], b->count[c] + n, __ATOMIC_RELAXED);
+}
+
+#ifdef EVAL_STATS
+#define EVAL_COUNT(c)       eval_stats_add((c), 1)
+#define EVAL_COUNT_N(c, n)  eval_stats_add((c), (n))
+#else
+#define EVAL_COUNT(c)       ((void)0)
+#define EVAL_COUNT_N(c, n)  ((void)0)
+#endif
+
+#endif
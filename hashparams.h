@@ -0,0 +1,24 @@
+/*
+** Perfect-hash parameters for the tables in tables.h, used by
+** pokereval.h.  Generated by mktables.c; do not edit it by hand.
+*/
+#ifndef HASHPARAMS_H
+#define HASHPARAMS_H
+
+#define HASH5_MUL   0x9e3779b1u
+#define HASH5_ABITS 13
+#define HASH5_BBITS 12
+
+#define HASH6_MUL   0xfd4b6fbfu
+#define HASH6_ABITS 15
+#define HASH6_BBITS 12
+
+#define HASH7_MUL   0x9e3779b1u
+#define HASH7_ABITS 16
+#define HASH7_BBITS 13
+
+#define HASH5Q_MUL   0x9e3779b1u
+#define HASH5Q_ABITS 14
+#define HASH5Q_BBITS 12
+
+#endif
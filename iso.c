@@ -0,0 +1,145 @@
+#include "pokereval.h"
+#include "iso.h"
+
+// Canonical suits are found by sorting the four suits on the rank
+// masks they hold in each group, first group first.  Suits with
+// equal masks in every group can be swapped without changing the
+// situation; they are what makes a class smaller than 24.
+
+static int
+make_card(int field, int r)
+{
+    return primes[r] | ((2+r) << 8) | (CLUB >> field) | (1 << (16+r));
+}
+
+// Splits a card into its suit field and rank index, or returns -1.
+static int
+card_parts(int card, int *field, int *r)
+{
+    int suit = (card >> 12) & 0xF, rank = RANK(card);
+
+    if (rank < Deuce || rank > Ace || !suit || (suit & (suit - 1)))
+        return -1;
+    *field = 3 - __builtin_ctz(suit);
+    *r = rank - Deuce;
+    return make_card(*field, *r) == card ? 0 : -1;
+}
+
+// Compares two suits' mask lists, the first group most significant.
+static int
+compare_masks(const unsigned short *a, const unsigned short *b, int ngroups)
+{
+    for (int g = 0; g < ngroups; g++)
+        if (a[g] != b[g])
+            return a[g] > b[g] ? 1 : -1;
+    return 0;
+}
+
+int
+iso_canonical(const int *cards, const int *sizes, int ngroups,
+              int *out, int *suit_map)
+{
+    unsigned short masks[4][ISO_MAX_GROUPS] = { { 0 } };
+    int order[4] = { 0, 1, 2, 3 }, map[4];
+    uint64_t used = 0;
+    int parts[52][2];                   // suit field, rank index
+    int n = 0;
+
+    if (ngroups < 0 || ngroups > ISO_MAX_GROUPS)
+        return -1;
+    for (int g = 0; g < ngroups; g++)
+    {
+        if (sizes[g] < 0 || n + sizes[g] > 52)
+            return -1;
+        for (int i = 0; i < sizes[g]; i++, n++)
+        {
+            int f, r;
+            if (card_parts(cards[n], &f, &r) < 0 || (used >> (f*13 + r) & 1))
+                return -1;
+            used |= 1ull << (f*13 + r);
+            masks[f][g] |= 1 << r;
+            parts[n][0] = f;
+            parts[n][1] = r;
+        }
+    }
+
+    // Highest masks first; insertion sort keeps it stable.
+    for (int i = 1; i < 4; i++)
+        for (int j = i; j > 0 && compare_masks(masks[order[j]], masks[order[j-1]], ngroups) > 0; j--)
+        {
+            int t = order[j];
+            order[j] = order[j-1];
+            order[j-1] = t;
+        }
+    for (int i = 0; i < 4; i++)
+        map[order[i]] = i;
+
+    // 24 relabellings, divided by those that fix the situation.
+    int fixed = 1, run = 1;
+    for (int i = 1; i < 4; i++)
+    {
+        if (compare_masks(masks[order[i]], masks[order[i-1]], ngroups) == 0)
+            fixed *= ++run;
+        else
+            run = 1;
+    }
+
+    // Rewrite each group in ascending canonical position.
+    n = 0;
+    for (int g = 0; g < ngroups; g++)
+    {
+        uint64_t group = 0;
+        for (int i = 0; i < sizes[g]; i++)
+            group |= 1ull << (map[parts[n + i][0]]*13 + parts[n + i][1]);
+        for (int i = 0; i < sizes[g]; i++, n++)
+        {
+            int p = __builtin_ctzll(group);
+            group &= group - 1;
+            out[n] = make_card(p / 13, p % 13);
+        }
+    }
+
+    if (suit_map)
+        for (int f = 0; f < 4; f++)
+            suit_map[f] = map[f];
+    return 24 / fixed;
+}
+
+int
+iso_preflop_class(int c1, int c2)
+{
+    int f1, r1, f2, r2;
+
+    if (card_parts(c1, &f1, &r1) < 0 || card_parts(c2, &f2, &r2) < 0)
+        return -1;
+    if (c1 == c2)
+        return -1;
+
+    // Row and column count down from the Ace.
+    int hi = 12 - (r1 > r2 ? r1 : r2), lo = 12 - (r1 > r2 ? r2 : r1);
+    return (f1 == f2) ? hi * 13 + lo : lo * 13 + hi;
+}
+
+int
+iso_preflop_hand(int cls, int *c1, int *c2)
+{
+    if (cls < 0 || cls >= 169)
+        return -1;
+
+    int row = cls / 13, col = cls % 13;
+    if (row == col)
+    {
+        *c1 = make_card(0, 12 - row);
+        *c2 = make_card(1, 12 - row);
+        return 6;
+    }
+    if (row < col)
+    {
+        *c1 = make_card(0, 12 - row);
+        *c2 = make_card(0, 12 - col);
+        return 4;
+    }
+    *c1 = make_card(0, 12 - col);
+    *c2 = make_card(1, 12 - row);
+    return 12;
+}
@@ -0,0 +1,54 @@
+#ifndef ISO_H
+#define ISO_H
+
+#include <stdint.h>
+
+//
+//   Suit isomorphism.
+//
+//   Suits have no order in hold'em, so any situation and the one
+//   you get by relabelling its suits have the same equities.  The
+//   functions here pick one representative of each such class, so
+//   that enumerations and caches can work per class instead of per
+//   deal: the 1326 starting hands fall into 169 classes and the
+//   22100 flops into 1755.
+//
+//   A situation is a list of card groups, for example the hole
+//   cards of each player followed by the board, or the board split
+//   into flop, turn and river when the streets matter.  Cards
+//   within a group are unordered; the groups themselves are not.
+//   Cards use the init_deck() encoding.
+//
+
+#define ISO_MAX_GROUPS  16
+
+// Writes the canonical form of the situation to out[], laid out
+// like cards[]: ngroups groups of sizes[g] cards each, the cards
+// of each group sorted by init_deck() position.  Two situations
+// are suit-isomorphic exactly when their canonical forms are equal.
+// out may be the same array as cards.
+//
+// If suit_map is not NULL, suit_map[f] is set to the canonical
+// counter field (0 = clubs ... 3 = spades) that field f becomes.
+//
+// Returns the number of distinct situations in the class (1 to 24),
+// or -1 if a card is invalid or repeated or there are too many
+// groups.
+int
+iso_canonical(const int *cards, const int *sizes, int ngroups,
+              int *out, int *suit_map);
+
+// Starting-hand class of two hole cards, 0..168, laid out as the
+// usual 13x13 grid with Aces first: pairs on the diagonal, suited
+// hands above it and offsuit hands below.  Returns -1 if the
+// cards are invalid or equal.
+int
+iso_preflop_class(int c1, int c2);
+
+// The canonical hand of a starting-hand class, and the number of
+// hands in it (6 for pairs, 4 suited, 12 offsuit), or -1 if the
+// class is out of range.
+int
+iso_preflop_hand(int cls, int *c1, int *c2);
+
+#endif
@@ -0,0 +1,202 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "poker.h"
+#include "pokereval.h"
+#include "enumerate.h"
+#include "table7.h"
+
+/****************************************************************
+    This code writes the dense seven-card value table described
+    in table7.h, then maps the file it wrote and checks every
+    entry against eval_7hand.
+
+        mktable7 [--threads n] [-c] file
+
+    -c skips the writing and only checks an existing file.  The
+    threads default to one per CPU.
+****************************************************************/
+
+struct job
+{
+    int deck[52];
+    int pos[52];                    // 0..51, the enumeration pool
+    unsigned short *values;         // table being filled
+    const struct table7 *table;     // table being checked
+};
+
+// The pool is the card positions 0..51, so each combination is
+// its own sorted position list.
+static void
+fill(const int *pos, void *local, void *arg)
+{
+    struct job *job = arg;
+    int hand[7];
+
+    (void)local;
+    for (int i = 0; i < 7; i++)
+        hand[i] = job->deck[pos[i]];
+    job->values[colex_rank(pos, 7)] = eval_7cards(hand);
+}
+
+static void
+check(const int *pos, void *local, void *arg)
+{
+    struct job *job = arg;
+    int hand[7];
+
+    // Reversed, so table7_index() has to do its own sorting.
+    for (int i = 0; i < 7; i++)
+        hand[6-i] = job->deck[pos[i]];
+    if (table7_eval(job->table, hand) != eval_7hand(hand))
+        ++*(uint64_t *)local;
+}
+
+static void
+add_bad(void *total, const void *local, void *arg)
+{
+    (void)arg;
+    *(uint64_t *)total += *(const uint64_t *)local;
+}
+
+static double
+seconds_since(struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static int
+write_table(const char *path, struct job *job, int nthreads)
+{
+    struct enum_spec spec = {
+        .pool = job->pos, .npool = 52, .k = 7, .nthreads = nthreads,
+        .visit = fill, .arg = job,
+    };
+    struct table7_header h;
+    FILE *f;
+
+    job->values = malloc((size_t)TABLE7_ENTRIES * 2);
+    if (!job->values) {
+        perror("malloc");
+        return -1;
+    }
+    if (enum_run(&spec, NULL) < 0) {
+        fprintf(stderr, "enumeration failed\n");
+        free(job->values);
+        return -1;
+    }
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, TABLE7_MAGIC, 8);
+    h.version = TABLE7_VERSION;
+    h.header_size = TABLE7_HEADER_SIZE;
+    h.entries = TABLE7_ENTRIES;
+    h.entry_size = 2;
+    h.card_order = 0;
+    h.byte_order = TABLE7_BYTE_ORDER;
+    h.hash = table7_hash(job->values, TABLE7_ENTRIES);
+
+    if (!(f = fopen(path, "wb"))) {
+        perror(path);
+        free(job->values);
+        return -1;
+    }
+    if (fwrite(&h, sizeof(h), 1, f) != 1 ||
+        fwrite(job->values, 2, TABLE7_ENTRIES, f) != TABLE7_ENTRIES ||
+        fclose(f) != 0)
+    {
+        perror(path);
+        free(job->values);
+        return -1;
+    }
+    free(job->values);
+    return 0;
+}
+
+static int
+check_table(const char *path, struct job *job, int nthreads)
+{
+    struct table7 t;
+    struct enum_spec spec = {
+        .pool = job->pos, .npool = 52, .k = 7, .nthreads = nthreads,
+        .visit = check, .merge = add_bad, .local_size = sizeof(uint64_t),
+        .arg = job,
+    };
+    const struct table7_header *h;
+    uint64_t bad = 0;
+
+    if (table7_open(&t, path) < 0) {
+        fprintf(stderr, "%s: not a version %d table file\n", path, TABLE7_VERSION);
+        return -1;
+    }
+    h = t.map;
+    if (table7_hash(t.values, TABLE7_ENTRIES) != h->hash) {
+        fprintf(stderr, "%s: hash mismatch\n", path);
+        table7_close(&t);
+        return -1;
+    }
+
+    job->table = &t;
+    if (enum_run(&spec, &bad) < 0) {
+        fprintf(stderr, "enumeration failed\n");
+        table7_close(&t);
+        return -1;
+    }
+    table7_close(&t);
+
+    if (bad) {
+        fprintf(stderr, "%s: %llu entries differ from eval_7hand\n",
+                path, (unsigned long long)bad);
+        return -1;
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    struct job job;
+    struct timespec start;
+    const char *path = NULL;
+    int nthreads = 0, check_only = 0, usage = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--threads") && i+1 < argc)
+            nthreads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-c"))
+            check_only = 1;
+        else if (!path && argv[i][0] != '-')
+            path = argv[i];
+        else
+            usage = 1;
+    }
+    if (usage || !path || nthreads < 0) {
+        fprintf(stderr, "usage: mktable7 [--threads n] [-c] file\n");
+        return 1;
+    }
+
+    init_deck(job.deck);
+    for (int i = 0; i < 52; i++)
+        job.pos[i] = i;
+
+    if (!check_only)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        if (write_table(path, &job, nthreads) < 0)
+            return 1;
+        printf("wrote %s: %d entries in %.1f s\n", path, TABLE7_ENTRIES,
+               seconds_since(&start));
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (check_table(path, &job, nthreads) < 0)
+        return 1;
+    printf("checked %s against eval_7hand in %.1f s\n", path,
+           seconds_since(&start));
+    return 0;
+}
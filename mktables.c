@@ -0,0 +1,686 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arrays.h"
+
+/****************************************************************
+    This program generates the derived lookup tables in tables.h,
+    and the perfect-hash parameters in hashparams.h, from the base
+    tables in arrays.h.  It is only needed when the table layout
+    changes; the generated headers are checked in.
+
+        make tables        (runs: mktables tables.h hashparams.h)
+
+    Every table is produced by brute force from the five-card
+    evaluator below, so the generated values agree with
+    eval_5hand by construction.
+****************************************************************/
+
+#define CLUB    0x8000
+
+#define RANK(x)  ((x >> 8) & 0xF)
+
+// Scratch space for building perfect hashes.
+#define MAX_KEYS  65536
+
+// Generated table definitions and hash parameters.
+static FILE *out, *params;
+
+static unsigned keys[MAX_KEYS];
+static unsigned short vals[MAX_KEYS];
+static int nkeys;
+
+
+// Same perfect hash lookup as find_fast() in pokereval.h.
+static unsigned
+find_fast(unsigned u)
+{
+    unsigned a, b, r;
+
+    u += 0xe91aaa35;
+    u ^= u >> 16;
+    u += u << 8;
+    u ^= u >> 4;
+    b  = (u >> 8) & 0x1ff;
+    a  = (u + (u << 2)) >> 19;
+    r  = a ^ hash_adjust[b];
+    return r;
+}
+
+// Builds a card from a rank index (0-12) and a suit index (0-3),
+// using the same encoding as init_deck().
+static int
+make_card(int r, int s)
+{
+    return primes[r] | ((2+r) << 8) | (CLUB >> s) | (1 << (16+r));
+}
+
+// Reference five-card evaluator (same logic as eval_5cards).
+static unsigned short
+eval5(const int *c)
+{
+    int q = (c[0] | c[1] | c[2] | c[3] | c[4]) >> 16;
+
+    if (c[0] & c[1] & c[2] & c[3] & c[4] & 0xf000)
+        return flushes[q];
+    if (unique5[q])
+        return unique5[q];
+    q = (c[0] & 0xff) * (c[1] & 0xff) * (c[2] & 0xff) * (c[3] & 0xff) * (c[4] & 0xff);
+    return hash_values[find_fast(q)];
+}
+
+// Best five-card value among the n (5-7) given cards.
+static unsigned short
+eval_best(const int *cards, int n)
+{
+    int sub[5];
+    unsigned short best = 9999;
+
+    for (int a = 0; a < n; a++)
+      for (int b = a+1; b < n; b++)
+        for (int c = b+1; c < n; c++)
+          for (int d = c+1; d < n; d++)
+            for (int e = d+1; e < n; e++)
+            {
+                sub[0] = cards[a]; sub[1] = cards[b]; sub[2] = cards[c];
+                sub[3] = cards[d]; sub[4] = cards[e];
+                unsigned short v = eval5(sub);
+                if (v < best)
+                    best = v;
+            }
+    return best;
+}
+
+static void
+print_table(const char *type, const char *name, const unsigned short *t, int n)
+{
+    fprintf(out, "%s %s[] =\n{", type, name);
+    for (int i = 0; i < n; i++)
+        fprintf(out, "%s%d%s", (i % 16) ? " " : "\n    ", t[i], (i < n-1) ? "," : "");
+    fprintf(out, "\n};\n\n");
+}
+
+
+//
+//   Flushes with five to seven suited cards.  Indexed by the
+//   13-bit rank mask of the suited cards, exactly like flushes[],
+//   but the mask may have five, six or seven bits set; the entry
+//   holds the best flush (or straight flush) those ranks make.
+//
+static void
+gen_flushes7(void)
+{
+    static unsigned short t[8192];
+    int cards[7];
+
+    for (int m = 0; m < 8192; m++)
+    {
+        int n = 0;
+        for (int r = 0; r < 13 && n < 8; r++)
+            if (m & (1 << r))
+            {
+                if (n < 7)
+                    cards[n] = make_card(r, 0);
+                n++;
+            }
+        t[m] = (n >= 5 && n <= 7) ? eval_best(cards, n) : 0;
+    }
+
+    fprintf(out, "/*\n"
+           "** Best flush (or straight flush) for five, six or seven\n"
+           "** suited cards, indexed by the 13-bit rank mask of those\n"
+           "** cards.  Entries containing a zero mean that mask does\n"
+           "** not hold between five and seven ranks.\n"
+           "*/\n");
+    print_table("const unsigned short", "flushes7", t, 8192);
+}
+
+
+//
+//   Perfect hash over the rank multisets of n-card non-flush
+//   hands.  The key of a hand is the sum of 5^r over its cards
+//   (r = rank index 0-12), i.e. its rank counts written in base
+//   five, which fits in 32 bits and can be accumulated one card
+//   at a time.  The hash has the same shape as find_fast():
+//
+//       u *= MUL;
+//       slot = ((u >> (32 - B - A)) & (2^A - 1)) ^ adjust[u >> (32 - B)];
+//
+static unsigned quinary[13];
+
+static void
+collect_multisets(int n, int r, int left, unsigned key, int *counts)
+{
+    if (r == 13)
+    {
+        if (left)
+            return;
+
+        // Deal the ranks out round-robin over the suits; with at
+        // most seven cards no suit gets five, so this is never a
+        // flush hand.
+        int cards[7], k = 0;
+        for (int i = 0; i < 13; i++)
+            for (int j = 0; j < counts[i]; j++, k++)
+                cards[k] = make_card(i, k & 3);
+        keys[nkeys] = key;
+        vals[nkeys] = eval_best(cards, n);
+        nkeys++;
+        return;
+    }
+    for (int c = 0; c <= 4 && c <= left; c++)
+    {
+        counts[r] = c;
+        collect_multisets(n, r+1, left-c, key + c * quinary[r], counts);
+    }
+}
+
+static int
+cmp_bucket(const void *a, const void *b)
+{
+    const int *x = a, *y = b;
+    return (y[0] != x[0]) ? y[0] - x[0] : x[1] - y[1];
+}
+
+// Tries to build the hash for the collected keys with the given
+// multiplier.  Returns 1 on success, filling adjust[] and table[].
+static int
+try_hash(unsigned mul, int abits, int bbits,
+         unsigned short *adjust, unsigned short *table)
+{
+    int nslots = 1 << abits, nbuckets = 1 << bbits;
+    static int size[MAX_KEYS], start[MAX_KEYS + 1], order[MAX_KEYS][2];
+    static int members[MAX_KEYS];
+    static unsigned char used[MAX_KEYS];
+    static int fill[MAX_KEYS];
+
+#define SLOT(u)  (((u) >> (32 - bbits - abits)) & (nslots - 1))
+
+    memset(size, 0, sizeof(int) * nbuckets);
+    for (int i = 0; i < nkeys; i++)
+        size[(keys[i] * mul) >> (32 - bbits)]++;
+
+    start[0] = 0;
+    for (int b = 0; b < nbuckets; b++)
+        start[b+1] = start[b] + size[b];
+    memcpy(fill, start, sizeof(int) * nbuckets);
+    for (int i = 0; i < nkeys; i++)
+        members[fill[(keys[i] * mul) >> (32 - bbits)]++] = i;
+
+    for (int b = 0; b < nbuckets; b++)
+    {
+        order[b][0] = size[b];
+        order[b][1] = b;
+    }
+    qsort(order, nbuckets, sizeof(order[0]), cmp_bucket);
+
+    memset(used, 0, nslots);
+    memset(table, 0, sizeof(unsigned short) * nslots);
+    memset(adjust, 0, sizeof(unsigned short) * nbuckets);
+
+    for (int o = 0; o < nbuckets && order[o][0]; o++)
+    {
+        int b = order[o][1], d;
+
+        // Two members of a bucket on the same slot can never be
+        // separated by any displacement.
+        for (int j = start[b]; j < start[b+1]; j++)
+            for (int k = start[b]; k < j; k++)
+                if (SLOT(keys[members[j]] * mul) == SLOT(keys[members[k]] * mul))
+                    return 0;
+
+        for (d = 0; d < nslots; d++)
+        {
+            int ok = 1;
+            for (int j = start[b]; ok && j < start[b+1]; j++)
+                if (used[SLOT(keys[members[j]] * mul) ^ d])
+                    ok = 0;
+            if (ok)
+                break;
+        }
+        if (d == nslots)
+            return 0;
+
+        adjust[b] = d;
+        for (int j = start[b]; j < start[b+1]; j++)
+        {
+            unsigned s = SLOT(keys[members[j]] * mul) ^ d;
+            used[s] = 1;
+            table[s] = vals[members[j]];
+        }
+    }
+    return 1;
+#undef SLOT
+}
+
+// Finds a multiplier for which the collected keys hash without
+// collisions, then prints the hash constants and tables.
+static void
+print_hash(const char *macro, const char *prefix, int abits, int bbits)
+{
+    static unsigned short adjust[MAX_KEYS], table[MAX_KEYS];
+    unsigned mul = 0x9e3779b1;
+    char name[64];
+
+    while (!try_hash(mul, abits, bbits, adjust, table))
+        mul = mul * 69069 + 2;      // next odd candidate
+
+    fprintf(params, "#define %s_MUL   0x%08xu\n", macro, mul);
+    fprintf(params, "#define %s_ABITS %d\n", macro, abits);
+    fprintf(params, "#define %s_BBITS %d\n\n", macro, bbits);
+    snprintf(name, sizeof(name), "%s_adjust", prefix);
+    print_table("const unsigned short", name, adjust, 1 << bbits);
+    snprintf(name, sizeof(name), "%s_values", prefix);
+    print_table("const unsigned short", name, table, 1 << abits);
+}
+
+static void
+gen_quinary_hash(int n, const char *prefix, const char *macro,
+                 const char *finder, int abits, int bbits)
+{
+    int counts[13];
+
+    nkeys = 0;
+    collect_multisets(n, 0, n, 0, counts);
+
+    fprintf(out, "/*\n"
+           "** Perfect hash for %d-card non-flush hands (%d rank\n"
+           "** multisets), keyed on the sum of quinary[] over the cards.\n"
+           "** See %s() in pokereval.h.\n"
+           "*/\n", n, nkeys, finder);
+    print_hash(macro, prefix, abits, bbits);
+}
+
+
+//
+//   Perfect hash over all 7462 five-card equivalence classes,
+//   flushes included.  The key is the prime product of the five
+//   cards (below 2^27) with bit 27 set for flushes, so a single
+//   lookup replaces the flush, unique5 and hash_values paths.
+//
+static void
+collect_products(int r, int left, unsigned prod, int *counts)
+{
+    if (r == 13)
+    {
+        if (left)
+            return;
+
+        int cards[5], k = 0, distinct = 0;
+        for (int i = 0; i < 13; i++)
+        {
+            distinct += (counts[i] != 0);
+            for (int j = 0; j < counts[i]; j++, k++)
+                cards[k] = make_card(i, k & 3);
+        }
+        keys[nkeys] = prod;
+        vals[nkeys] = eval5(cards);
+        nkeys++;
+
+        // Five distinct ranks can also be dealt as a flush.
+        if (distinct == 5)
+        {
+            for (k = 0; k < 5; k++)
+                cards[k] = make_card(RANK(cards[k]) - 2, 0);
+            keys[nkeys] = prod | (1 << 27);
+            vals[nkeys] = eval5(cards);
+            nkeys++;
+        }
+        return;
+    }
+    for (int c = 0, p = 1; c <= 4 && c <= left; c++, p *= primes[r])
+    {
+        counts[r] = c;
+        collect_products(r+1, left-c, prod * p, counts);
+    }
+}
+
+static void
+gen_prime_hash5(void)
+{
+    int counts[13];
+
+    nkeys = 0;
+    collect_products(0, 5, 1, counts);
+
+    fprintf(out, "/*\n"
+           "** Perfect hash for all %d five-card hands, keyed on the\n"
+           "** prime product of the cards with bit 27 set for flushes.\n"
+           "** See find_fast5() in pokereval.h.\n"
+           "*/\n", nkeys);
+    print_hash("HASH5", "hash5", 13, 12);
+}
+
+
+//
+//   Compact layout for the COMPACT_TABLES build.  flushes[] and
+//   unique5[] are only ever non-zero for masks with exactly five
+//   bits set, so both fit in one table of C(13,5) = 1287 pairs,
+//   indexed by the colex rank of the mask.  That rank is split
+//   between the low seven and the high six bits of the mask:
+//
+//       lo = ranks5_lo[q & 0x7f];
+//       i  = (lo & 0xff) + ranks5_hi[lo >> 8][q >> 7];
+//
+//   where the high byte of ranks5_lo[] is the number of low bits
+//   set.  Masks without five bits land in a zero-filled tail.
+//
+static int
+binomial(int n, int k)
+{
+    int r = 1;
+
+    if (k < 0 || k > n)
+        return 0;
+    for (int i = 1; i <= k; i++)
+        r = r * (n - k + i) / i;
+    return r;
+}
+
+//
+//   Ace-to-five lows.  Indexed by a 13-bit rank mask with the Ace
+//   moved to the bottom (bit 0 = Ace, bit 1 = Deuce ... bit 12 =
+//   King); the entry ranks the best unpaired low those ranks hold,
+//   i.e. their five lowest ranks.  Comparing lows from the top card
+//   down is comparing their masks as numbers, so the rank is one
+//   plus the colex rank of the five bits: 1 is 5-4-3-2-A, 56 is
+//   8-7-6-5-4 (the last 8-or-better low) and 1287 is K-Q-J-T-9.
+//
+static void
+gen_low5(void)
+{
+    static unsigned short t[8192];
+
+    for (int m = 0; m < 8192; m++)
+    {
+        int p = 0, r = 0;
+        for (int j = 0; j < 13 && p < 5; j++)
+            if (m & (1 << j))
+                r += binomial(j, ++p);
+        t[m] = (p == 5) ? r + 1 : 0;
+    }
+
+    fprintf(out, "/*\n"
+           "** Best ace-to-five low, 1 (5-4-3-2-A) to 1287 (K-Q-J-T-9),\n"
+           "** indexed by the ace-low rank mask of the cards (see\n"
+           "** low_mask() in pokereval.h); 0 if fewer than five ranks.\n"
+           "*/\n");
+    print_table("const unsigned short", "low5", t, 8192);
+}
+
+//
+//   Tables for the compact card formats (see cards.h): the card of
+//   each deck position, and the quinary key of a 13-bit rank mask,
+//   split into its low seven and high six bits.
+//
+static void
+gen_mask_tables(void)
+{
+    unsigned lo[128], hi[64];
+
+    fprintf(out, "/*\n"
+           "** The card at each position 0-51 of the init_deck() order.\n"
+           "*/\n");
+    fprintf(out, "const int index_cards[52] =\n{");
+    for (int i = 0; i < 52; i++)
+        fprintf(out, "%s0x%08x%s", (i % 6) ? " " : "\n    ",
+               make_card(i % 13, i / 13), (i < 51) ? "," : "");
+    fprintf(out, "\n};\n\n");
+
+    for (int m = 0; m < 128; m++)
+    {
+        lo[m] = 0;
+        for (int r = 0; r < 7; r++)
+            if (m & (1 << r))
+                lo[m] += quinary[r];
+    }
+    for (int m = 0; m < 64; m++)
+    {
+        hi[m] = 0;
+        for (int r = 0; r < 6; r++)
+            if (m & (1 << r))
+                hi[m] += quinary[7 + r];
+    }
+
+    fprintf(out, "/*\n"
+           "** Sum of quinary[] over the ranks in a 13-bit rank mask m:\n"
+           "** quinary_lo[m & 0x7f] + quinary_hi[m >> 7].\n"
+           "*/\n");
+    fprintf(out, "const unsigned quinary_lo[128] =\n{");
+    for (int m = 0; m < 128; m++)
+        fprintf(out, "%s%u%s", (m % 8) ? " " : "\n    ", lo[m], (m < 127) ? "," : "");
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "const unsigned quinary_hi[64] =\n{");
+    for (int m = 0; m < 64; m++)
+        fprintf(out, "%s%u%s", (m % 8) ? " " : "\n    ", hi[m], (m < 63) ? "," : "");
+    fprintf(out, "\n};\n\n");
+}
+
+static void
+gen_packed5(void)
+{
+    static unsigned short packed[1287 + 35][2], lo[128], hi[8][64];
+
+    for (int m = 0; m < 128; m++)
+    {
+        int p = 0, r = 0;
+        for (int j = 0; j < 7; j++)
+            if (m & (1 << j))
+                r += binomial(j, ++p);
+        lo[m] = r | (p << 8);
+    }
+    for (int p = 0; p < 8; p++)
+        for (int h = 0; h < 64; h++)
+        {
+            int i = p, r = 0;
+            for (int j = 0; j < 6; j++)
+                if (h & (1 << j))
+                    r += binomial(7 + j, ++i);
+            hi[p][h] = (i == 5) ? r : 1287;
+        }
+    for (int m = 0; m < 8192; m++)
+        if (__builtin_popcount(m) == 5)
+        {
+            int i = (lo[m & 0x7f] & 0xff) + hi[lo[m & 0x7f] >> 8][m >> 7];
+            packed[i][0] = flushes[m];
+            packed[i][1] = unique5[m];
+        }
+
+    fprintf(out, "#ifdef COMPACT_TABLES\n\n");
+    fprintf(out, "/*\n"
+           "** Compact replacement for flushes[] and unique5[]: entry i\n"
+           "** holds { flushes[q], unique5[q] } for the five-bit mask q\n"
+           "** of colex rank i.  See rank5_index() in pokereval.h.\n"
+           "*/\n");
+    fprintf(out, "const unsigned short packed5[][2] =\n{");
+    for (int i = 0; i < 1287 + 35; i++)
+        fprintf(out, "%s{ %d, %d }%s", (i % 6) ? " " : "\n    ",
+               packed[i][0], packed[i][1], (i < 1287 + 34) ? "," : "");
+    fprintf(out, "\n};\n\n");
+    print_table("const unsigned short", "ranks5_lo", lo, 128);
+    fprintf(out, "const unsigned short ranks5_hi[8][64] =\n{");
+    for (int p = 0; p < 8; p++)
+    {
+        fprintf(out, "\n    {");
+        for (int h = 0; h < 64; h++)
+            fprintf(out, "%s%d%s", (h % 16) ? " " : "\n        ", hi[p][h], (h < 63) ? "," : "");
+        fprintf(out, "\n    }%s", (p < 7) ? "," : "");
+    }
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "#endif  // COMPACT_TABLES\n\n");
+}
+
+//
+//   Hand classes.  Every one of the 7462 values is one rank
+//   pattern (plus flush or not), so its category and the ranks
+//   that make it up can be stored per value and read back with one
+//   load instead of being recovered from the cards.  The word is
+//
+//       category << 24 | primary << 20 | secondary << 16 | kickers
+//
+//   with ranks as card rank nibbles (2-14) and kickers as a 13-bit
+//   rank mask (bit r-2 for rank r), the same bits as card >> 16:
+//
+//       straight (flush)    primary = top card (5 for the wheel)
+//       four of a kind      primary = quads, one kicker
+//       full house          primary = trips, secondary = pair
+//       three of a kind     primary = trips, two kickers
+//       two pair            primary, secondary = pairs, one kicker
+//       one pair            primary = pair, three kickers
+//       flush, high card    primary = top card, four kickers
+//
+static unsigned classes[7463];
+
+static void
+collect_classes(int r, int left, int *counts)
+{
+    if (r == 13)
+    {
+        if (left)
+            return;
+
+        int cards[5], k = 0, mask = 0, top = -1, second = -1, kickers = 0;
+        int most = 0;
+        for (int i = 0; i < 13; i++)
+        {
+            for (int j = 0; j < counts[i]; j++, k++)
+                cards[k] = make_card(i, k & 3);
+            if (counts[i])
+                mask |= 1 << i;
+            if (counts[i] > most)
+                most = counts[i];
+        }
+
+        // The biggest group is primary, the next group of two or
+        // more is secondary and single cards are kickers; ties in
+        // group size go to the higher rank.
+        for (int i = 12; i >= 0; i--)
+            if (counts[i] == most && top < 0 && most > 1)
+                top = i;
+            else if (counts[i] >= 2 && second < 0)
+                second = i;
+            else if (counts[i] == 1)
+                kickers |= 1 << i;
+
+        unsigned short v = eval5(cards);
+        int straight = (most == 1) && (v <= 10 || (v >= 1600 && v <= 1609));
+        if (most == 1)
+        {
+            // No pairs: the top card leads, unless this is a
+            // straight, whose only rank is its top card.
+            top = 31 - __builtin_clz(mask);
+            kickers = mask & ~(1 << top);
+            if (straight)
+            {
+                if (mask == 0x100f)
+                    top = 3;                    // 5-4-3-2-A
+                kickers = 0;
+            }
+        }
+
+        unsigned c = (top + 2) << 20 | (second >= 0 ? second + 2 : 0) << 16 | kickers;
+        classes[v] = c | (unsigned)(most == 1 ? (straight ? 5 : 9) :
+                                    most == 4 ? 2 :
+                                    most == 3 ? (second >= 0 ? 3 : 6) :
+                                    second >= 0 ? 7 : 8) << 24;
+
+        // Five distinct ranks can also be dealt as a flush.
+        if (most == 1)
+        {
+            for (k = 0; k < 5; k++)
+                cards[k] = make_card(RANK(cards[k]) - 2, 0);
+            classes[eval5(cards)] = c | (unsigned)(straight ? 1 : 4) << 24;
+        }
+        return;
+    }
+    for (int c = 0; c <= 4 && c <= left; c++)
+    {
+        counts[r] = c;
+        collect_classes(r+1, left-c, counts);
+    }
+}
+
+static void
+gen_hand_classes(void)
+{
+    int counts[13];
+
+    collect_classes(0, 5, counts);
+    for (int v = 1; v <= 7462; v++)
+        if (!classes[v])
+        {
+            fprintf(stderr, "mktables: no class for value %d\n", v);
+            exit(1);
+        }
+
+    fprintf(out, "/*\n"
+           "** Category (bits 24-27), primary rank (20-23), secondary\n"
+           "** rank (16-19) and kicker rank mask (0-12) of each value\n"
+           "** 1-7462.  See hand_class() in poker.h.\n"
+           "*/\n");
+    fprintf(out, "const unsigned hand_classes[7463] =\n{");
+    for (int v = 0; v <= 7462; v++)
+        fprintf(out, "%s0x%07x%s", (v % 8) ? " " : "\n    ", classes[v], (v < 7462) ? "," : "");
+    fprintf(out, "\n};\n\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s tables.h hashparams.h\n", argv[0]);
+        return 1;
+    }
+    if (!(out = fopen(argv[1], "w")) || !(params = fopen(argv[2], "w"))) {
+        perror("fopen");
+        return 1;
+    }
+
+    quinary[0] = 1;
+    for (int r = 1; r < 13; r++)
+        quinary[r] = 5 * quinary[r-1];
+
+    fprintf(out, "/*\n"
+           "** Derived lookup tables.  This file is generated by\n"
+           "** mktables.c (\"make tables\"); do not edit it by hand.\n"
+           "*/\n\n");
+    fprintf(params, "/*\n"
+           "** Perfect-hash parameters for the tables in tables.h, used by\n"
+           "** pokereval.h.  Generated by mktables.c; do not edit it by hand.\n"
+           "*/\n#ifndef HASHPARAMS_H\n#define HASHPARAMS_H\n\n");
+
+    // quinary[] is indexed directly by the card's rank nibble
+    // (2-14), so the evaluators need no subtraction.
+    fprintf(out, "/*\n"
+           "** 5^(rank-2), indexed by the rank nibble of a card.  The sum\n"
+           "** over a hand gives its rank counts in base five.\n"
+           "*/\n");
+    fprintf(out, "const unsigned quinary[16] =\n{\n    0, 0");
+    for (int r = 0; r < 13; r++)
+        fprintf(out, ", %u", quinary[r]);
+    fprintf(out, ", 0\n};\n\n");
+
+    // suit_count[] turns the cdhs nibble into a 4-bit counter
+    // field, clubs in the low nibble and spades in the high one.
+    fprintf(out, "/*\n"
+           "** Per-suit counter increment, indexed by the cdhs nibble of\n"
+           "** a card.  Summed over a hand, each 4-bit field counts the\n"
+           "** cards of one suit (clubs lowest, spades highest).\n"
+           "*/\n");
+    fprintf(out, "const unsigned short suit_count[16] =\n{\n"
+           "    0, 0x1000, 0x0100, 0, 0x0010, 0, 0, 0,\n"
+           "    0x0001, 0, 0, 0, 0, 0, 0, 0\n};\n\n");
+
+    gen_prime_hash5();
+    gen_flushes7();
+    gen_packed5();
+    gen_low5();
+    gen_quinary_hash(6, "hash6", "HASH6", "find_fast6", 15, 12);
+    gen_quinary_hash(7, "hash7", "HASH7", "find_fast7", 16, 13);
+    gen_quinary_hash(5, "hash5q", "HASH5Q", "find_fast5q", 14, 12);
+    gen_mask_tables();
+    gen_hand_classes();
+
+    fprintf(params, "#endif\n");
+    return fclose(out) || fclose(params);
+}
@@ -1,3 +1,9 @@
+#ifndef POKER_H
+#define POKER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
 #define	STRAIGHT_FLUSH  1
 #define	FOUR_OF_A_KIND  2
 #define	FULL_HOUSE      3
@@ -10,7 +16,15 @@
 
 #define	RANK(x)  ((x >> 8) & 0xF)
 
-static char *value_str[] = {
+// Fields of a hand class word (see hand_class()).  Ranks are card
+// rank nibbles, Deuce to Ace; the kickers are a 13-bit rank mask,
+// bit r-2 for rank r, like the rank bits of a card shifted down 16.
+#define	CLASS_CATEGORY(c)   ((c) >> 24)
+#define	CLASS_PRIMARY(c)    (((c) >> 20) & 0xF)
+#define	CLASS_SECONDARY(c)  (((c) >> 16) & 0xF)
+#define	CLASS_KICKERS(c)    ((c) & 0x1FFF)
+
+static const char *const value_str[] = {
     "",
     "Straight Flush",
     "Four of a Kind",
@@ -52,17 +66,79 @@ find_card(int rank, int suit, int *deck);
 void
 shuffle_deck(int *deck);
 
+// Per-thread random number generator state (xoshiro256**).
+struct rng_state
+{
+    uint64_t s[4];
+};
+
+void
+rng_seed(struct rng_state *rng, uint64_t seed);
+
+uint64_t
+rng_next(struct rng_state *rng);
+
+unsigned
+rng_below(struct rng_state *rng, unsigned n);
+
+void
+shuffle_deck_r(int *deck, struct rng_state *rng);
+
+void
+shuffle_partial(int *cards, int n, int k, struct rng_state *rng);
+
 void
 print_hand(int *hand, int n);
 
+int
+parse_cards(const char *s, int *out);
+
+int
+format_hand(char *buf, const int *hand, int n);
+
 int
 hand_rank(unsigned short val);
 
+extern const unsigned hand_classes[7463];
+
+unsigned
+hand_class(unsigned short val);
+
 unsigned short
 eval_5hand(int *hand);
 
 unsigned short
 eval_5hand_fast(int *hand);
 
+void
+eval_5hand_batch(const int *hands, size_t n, unsigned short *out);
+
+unsigned short
+eval_6hand(int *hand);
+
 unsigned short
 eval_7hand(int *hand);
+
+unsigned short
+eval_7hand_fast(int *hand);
+
+unsigned short
+eval_omaha4(const int *hole, const int *board);
+
+unsigned short
+eval_omaha5(const int *hole, const int *board);
+
+unsigned short
+eval_low8(const int *hand, int n);
+
+unsigned short
+eval_hilo8(const int *hand, int n, unsigned short *lo);
+
+unsigned short
+eval_omaha_hilo(const int *hole, int nhole, const int *board, unsigned short *lo);
+
+unsigned
+eval_showdown(const int *board, const int (*holes)[2], int n,
+              unsigned short *values);
+
+#endif
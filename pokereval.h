@@ -0,0 +1,625 @@
+#ifndef POKEREVAL_H
+#define POKEREVAL_H
+
+#include "poker.h"
+#include "evalstats.h"
+
+//
+//   Header-only evaluators.
+//
+//   Everything here is static inline, so callers that include this
+//   header get the evaluators inlined into their own loops instead
+//   of calling eval_5hand() and friends in pokerlib.o.  The lookup
+//   tables stay defined once, read-only, in pokerlib.o (arrays.h and
+//   the generated tables.h); this header only declares them.
+//
+//   All evaluators return a value from 1 (Royal Flush) to 7462
+//   (75432 unsuited), the same scale as eval_5hand.
+//
+
+extern const unsigned short flushes[];
+extern const unsigned short unique5[];
+extern const unsigned short hash_adjust[];
+extern const unsigned short hash_values[];
+extern const int primes[];
+extern const int perm7[21][5];
+
+extern const unsigned quinary[16];
+extern const unsigned short suit_count[16];
+extern const unsigned short flushes7[];
+extern const unsigned short hash5_adjust[], hash5_values[];
+extern const unsigned short hash6_adjust[], hash6_values[];
+extern const unsigned short hash7_adjust[], hash7_values[];
+extern const unsigned short low5[];
+extern const unsigned short hash5q_adjust[], hash5q_values[];
+extern const unsigned quinary_lo[128], quinary_hi[64];
+extern const int index_cards[52];
+
+#ifdef COMPACT_TABLES
+extern const unsigned short packed5[][2];
+extern const unsigned short ranks5_lo[128];
+extern const unsigned short ranks5_hi[8][64];
+#endif
+
+#include "hashparams.h"
+
+
+// Perform a perfect hash lookup (courtesy of Paul Senzee).
+static inline unsigned
+find_fast(unsigned u)
+{
+    unsigned a, b, r;
+
+    u += 0xe91aaa35;
+    u ^= u >> 16;
+    u += u << 8;
+    u ^= u >> 4;
+    b  = (u >> 8) & 0x1ff;
+    a  = (u + (u << 2)) >> 19;
+    r  = a ^ hash_adjust[b];
+    return r;
+}
+
+#ifdef COMPACT_TABLES
+
+// Position of a five-bit rank mask in packed5[] (see mktables.c);
+// masks with any other number of bits map to a zero entry.
+static inline unsigned
+rank5_index(unsigned q)
+{
+    unsigned lo = ranks5_lo[q & 0x7f];
+    return (lo & 0xff) + ranks5_hi[lo >> 8][q >> 7];
+}
+
+#endif
+
+// Evaluates the given five-card poker cards.
+// Returns a number from 1 to 7462, where 1 is the best hand
+// possible (i.e. Royal Flush), and 7462 is the worst hand
+// possible (75432 unsuited).
+//
+// Building with -DCOMPACT_TABLES swaps the two 16 KB tables
+// flushes[] and unique5[] for the 5 KB interleaved packed5[],
+// so that everything this function touches fits in L1.
+static inline unsigned short
+eval_5cards(int c1, int c2, int c3, int c4, int c5)
+{
+    int q = (c1 | c2 | c3 | c4 | c5) >> 16;
+    short s;
+
+#ifdef COMPACT_TABLES
+    const unsigned short *e = packed5[rank5_index(q)];
+
+    // This checks for Flushes and Straight Flushes.
+    if (c1 & c2 & c3 & c4 & c5 & 0xf000)
+    {
+        EVAL_COUNT(EVAL_STAT_5_FLUSH);
+        return e[0];
+    }
+
+    // This checks for Straights and High Card hands.
+    if ((s = e[1]))
+    {
+        EVAL_COUNT(EVAL_STAT_5_UNIQUE);
+        return s;
+    }
+#else
+    // This checks for Flushes and Straight Flushes.
+    if (c1 & c2 & c3 & c4 & c5 & 0xf000)
+    {
+        EVAL_COUNT(EVAL_STAT_5_FLUSH);
+        return flushes[q];
+    }
+
+    // This checks for Straights and High Card hands.
+    if ((s = unique5[q]))
+    {
+        EVAL_COUNT(EVAL_STAT_5_UNIQUE);
+        return s;
+    }
+#endif
+
+    // This performs a perfect-hash lookup for remaining hands.
+    EVAL_COUNT(EVAL_STAT_5_HASH);
+    q = (c1 & 0xff) * (c2 & 0xff) * (c3 & 0xff) * (c4 & 0xff) * (c5 & 0xff);
+    return hash_values[find_fast(q)];
+}
+
+
+// Perfect hash lookup over all 7462 five-card classes, keyed on
+// the prime product with bit 27 set for flushes (see mktables.c).
+static inline unsigned
+find_fast5(unsigned u)
+{
+    u *= HASH5_MUL;
+    return ((u >> (32 - HASH5_BBITS - HASH5_ABITS)) & ((1 << HASH5_ABITS) - 1))
+        ^ hash5_adjust[u >> (32 - HASH5_BBITS)];
+}
+
+// Same as eval_5cards, but without the flush and unique5
+// branches: the flush test only sets a key bit, and every hand
+// costs the same prime product and a single perfect-hash probe.
+static inline unsigned short
+eval_5cards_fast(int c1, int c2, int c3, int c4, int c5)
+{
+    unsigned q;
+
+    q  = (c1 & 0xff) * (c2 & 0xff) * (c3 & 0xff) * (c4 & 0xff) * (c5 & 0xff);
+    q |= (unsigned)((c1 & c2 & c3 & c4 & c5 & 0xf000) != 0) << 27;
+    return hash5_values[find_fast5(q)];
+}
+
+
+// Perfect hash lookups for six- and seven-card non-flush hands,
+// keyed on the sum of quinary[] over the cards (see mktables.c).
+static inline unsigned
+find_fast6(unsigned u)
+{
+    u *= HASH6_MUL;
+    return ((u >> (32 - HASH6_BBITS - HASH6_ABITS)) & ((1 << HASH6_ABITS) - 1))
+        ^ hash6_adjust[u >> (32 - HASH6_BBITS)];
+}
+
+static inline unsigned
+find_fast7(unsigned u)
+{
+    u *= HASH7_MUL;
+    return ((u >> (32 - HASH7_BBITS - HASH7_ABITS)) & ((1 << HASH7_ABITS) - 1))
+        ^ hash7_adjust[u >> (32 - HASH7_BBITS)];
+}
+
+// Five-card non-flush hands keyed like find_fast6(); used where
+// the cards come as rank masks and no prime product is at hand.
+static inline unsigned
+find_fast5q(unsigned u)
+{
+    u *= HASH5Q_MUL;
+    return ((u >> (32 - HASH5Q_BBITS - HASH5Q_ABITS)) & ((1 << HASH5Q_ABITS) - 1))
+        ^ hash5q_adjust[u >> (32 - HASH5Q_BBITS)];
+}
+
+// Given the per-suit counters of an n-card hand (see suit_count[]),
+// returns the rank mask of the suit holding five or more cards, or
+// zero if there is no such suit.  With six or seven cards a hand
+// holding a flush cannot also hold quads or a full house, so that
+// mask alone decides the hand through flushes7[].
+static inline int
+flush_ranks(const int *hand, int n, unsigned suits)
+{
+    int suit, q = 0;
+
+    // A field of five or more carries into its top bit.
+    suits = (suits + 0x3333) & 0x8888;
+    if (!suits)
+        return 0;
+
+    suit = CLUB >> (__builtin_ctz(suits) >> 2);
+    for (int i = 0; i < n; i++)
+        if (hand[i] & suit)
+            q |= hand[i] >> 16;
+    return q;
+}
+
+// Evaluates six or seven cards in one pass: the cards' quinary
+// rank key and per-suit counters are summed, then either the
+// suited rank mask indexes flushes7[] or the key goes through
+// the perfect hash for that many cards.
+static inline unsigned short
+eval_6cards(const int *hand)
+{
+    unsigned key = 0, suits = 0;
+    int q;
+
+    for (int i = 0; i < 6; i++)
+    {
+        key   += quinary[(hand[i] >> 8) & 0xF];
+        suits += suit_count[(hand[i] >> 12) & 0xF];
+    }
+
+    if ((q = flush_ranks(hand, 6, suits)))
+    {
+        EVAL_COUNT(EVAL_STAT_N_FLUSH);
+        return flushes7[q];
+    }
+
+    EVAL_COUNT(EVAL_STAT_N_HASH);
+    return hash6_values[find_fast6(key)];
+}
+
+static inline unsigned short
+eval_7cards(const int *hand)
+{
+    unsigned key = 0, suits = 0;
+    int q;
+
+    for (int i = 0; i < 7; i++)
+    {
+        key   += quinary[(hand[i] >> 8) & 0xF];
+        suits += suit_count[(hand[i] >> 12) & 0xF];
+    }
+
+    if ((q = flush_ranks(hand, 7, suits)))
+    {
+        EVAL_COUNT(EVAL_STAT_N_FLUSH);
+        return flushes7[q];
+    }
+
+    EVAL_COUNT(EVAL_STAT_N_HASH);
+    return hash7_values[find_fast7(key)];
+}
+
+
+// Evaluates n cards (5, 6 or 7).  Forced inline, so a constant n
+// at the call site leaves only that evaluator behind.
+static inline __attribute__((always_inline)) unsigned short
+eval_cards(const int *hand, int n)
+{
+    if (n == 5)
+        return eval_5cards(hand[0], hand[1], hand[2], hand[3], hand[4]);
+    if (n == 6)
+        return eval_6cards(hand);
+    return eval_7cards(hand);
+}
+
+
+//
+//   Partial hands.  When many hole-card pairs are evaluated
+//   against the same board, the board's share of the work (its
+//   rank key, suit counters, per-suit rank masks and prime product)
+//   is done once by eval_partial_init, and each pair then only
+//   folds in its own two cards:
+//
+//       struct eval_partial b;
+//       eval_partial_init(&b, board, 5);
+//       for (...)
+//           v[i] = eval_partial_hole(&b, hole[i][0], hole[i][1], 7);
+//
+//   Cards can be taken out again with eval_partial_remove, so the
+//   same state also serves street-by-street updates and depth-first
+//   enumeration (see struct eval_state below).
+//
+
+struct eval_partial
+{
+    int n;                  // number of cards folded in
+    unsigned key;           // sum of quinary[]: rank counts in base 5
+    unsigned suits;         // sum of suit_count[]: 4-bit count per suit
+    int smask[4];           // rank mask per suit, clubs first
+    unsigned prod;          // odd prime product, modulo 2^32
+};
+
+// Counter field (0 = clubs ... 3 = spades) of a card's suit.
+static inline int
+suit_field(int card)
+{
+    return 3 - __builtin_ctz((card >> 12) & 0xF);
+}
+
+// The deuce's prime, 2, is left out of prod so that every factor
+// can be divided out again; the deuces are put back from the rank
+// count in key when a five-card value is looked up.
+static inline unsigned
+odd_prime(int card)
+{
+    return (card & 0xff) >> !(card & 1);
+}
+
+// Inverse of an odd number modulo 2^32, by Newton's iteration;
+// each step doubles the number of correct low bits, from three.
+static inline unsigned
+odd_inverse(unsigned a)
+{
+    unsigned x = a;
+
+    x *= 2 - a * x;
+    x *= 2 - a * x;
+    x *= 2 - a * x;
+    x *= 2 - a * x;
+    return x;
+}
+
+static inline void
+eval_partial_add(struct eval_partial *p, int card)
+{
+    p->key   += quinary[(card >> 8) & 0xF];
+    p->suits += suit_count[(card >> 12) & 0xF];
+    p->smask[suit_field(card)] |= card >> 16;
+    p->prod  *= odd_prime(card);
+    p->n++;
+}
+
+// Takes out a card that was added before.  Dividing the odd
+// product is multiplying by an inverse, which stays exact even
+// after the product has wrapped.
+static inline void
+eval_partial_remove(struct eval_partial *p, int card)
+{
+    p->key   -= quinary[(card >> 8) & 0xF];
+    p->suits -= suit_count[(card >> 12) & 0xF];
+    p->smask[suit_field(card)] &= ~(card >> 16);
+    p->prod  *= odd_inverse(odd_prime(card));
+    p->n--;
+}
+
+static inline void
+eval_partial_init(struct eval_partial *p, const int *cards, int n)
+{
+    p->n = 0;
+    p->key = p->suits = 0;
+    p->smask[0] = p->smask[1] = p->smask[2] = p->smask[3] = 0;
+    p->prod = 1;
+    for (int i = 0; i < n; i++)
+        eval_partial_add(p, cards[i]);
+}
+
+// Finishes an evaluation of total (5, 6 or 7) cards from their
+// rank key, suit counters, prime product and the rank masks of
+// all cards and of each suit.
+static inline __attribute__((always_inline)) unsigned short
+eval_partial_finish(unsigned key, unsigned suits, unsigned prod,
+                    int ranks, const int *smask, int extra1, int extra2,
+                    int total)
+{
+    // A field of five or more carries into its top bit.  Five
+    // cards of one suit rule out anything but a (straight) flush.
+    suits = (suits + 0x3333) & 0x8888;
+    if (suits)
+    {
+        int f = __builtin_ctz(suits) >> 2, q = smask[f];
+        q |= (extra1 >> 16) & -(suit_field(extra1) == f);
+        q |= (extra2 >> 16) & -(suit_field(extra2) == f);
+        return flushes7[q];
+    }
+
+    if (total == 5)
+    {
+        short s;
+
+#ifdef COMPACT_TABLES
+        if ((s = packed5[rank5_index(ranks)][1]))
+            return s;
+#else
+        if ((s = unique5[ranks]))
+            return s;
+#endif
+        return hash_values[find_fast(prod << key % 5)];
+    }
+    if (total == 6)
+        return hash6_values[find_fast6(key)];
+    return hash7_values[find_fast7(key)];
+}
+
+// Evaluates the partial hand plus the cards c1 and c2, where
+// total = p->n + 2 is 5, 6 or 7.  Pass total as a constant so
+// the other two paths compile away.
+static inline __attribute__((always_inline)) unsigned short
+eval_partial_hole(const struct eval_partial *p, int c1, int c2, int total)
+{
+    unsigned key = p->key + quinary[(c1 >> 8) & 0xF] + quinary[(c2 >> 8) & 0xF];
+    unsigned suits = p->suits + suit_count[(c1 >> 12) & 0xF]
+                              + suit_count[(c2 >> 12) & 0xF];
+    int ranks = 0;
+
+    if (total == 5)
+        ranks = (p->smask[0] | p->smask[1] | p->smask[2] | p->smask[3] |
+                 c1 >> 16 | c2 >> 16);
+    return eval_partial_finish(key, suits, p->prod * odd_prime(c1) * odd_prime(c2),
+                               ranks, p->smask, c1, c2, total);
+}
+
+// Evaluates the p->n (5, 6 or 7) cards of the partial hand.
+static inline unsigned short
+eval_partial_value(const struct eval_partial *p)
+{
+    int ranks = p->smask[0] | p->smask[1] | p->smask[2] | p->smask[3];
+
+    // CLUB with no rank bits stands in for the two extra cards,
+    // and adds nothing to the flush mask.
+    switch (p->n)
+    {
+    case 5:
+        return eval_partial_finish(p->key, p->suits, p->prod, ranks, p->smask, CLUB, CLUB, 5);
+    case 6:
+        return eval_partial_finish(p->key, p->suits, p->prod, ranks, p->smask, CLUB, CLUB, 6);
+    case 7:
+        return eval_partial_finish(p->key, p->suits, p->prod, ranks, p->smask, CLUB, CLUB, 7);
+    }
+    return 0;
+}
+
+
+//
+//   Incremental evaluation.  An eval_state is a partial hand that
+//   also keeps the value of its best five cards up to date, for
+//   game servers that score the same players at the flop, turn
+//   and river:
+//
+//       eval_state_init(&s, hand, 5);      // hole cards + flop
+//       eval_state_add(&s, turn);          // s.value is 6-card best
+//       eval_state_add(&s, river);         // s.value is 7-card best
+//
+//   Each update is a few adds and one table lookup, instead of the
+//   21 five-card evaluations of eval_7hand.  value is 0 while the
+//   state holds fewer than five or more than seven cards.
+//
+
+struct eval_state
+{
+    struct eval_partial p;
+    unsigned short value;
+};
+
+static inline void
+eval_state_init(struct eval_state *s, const int *cards, int n)
+{
+    eval_partial_init(&s->p, cards, n);
+    s->value = eval_partial_value(&s->p);
+}
+
+static inline void
+eval_state_add(struct eval_state *s, int card)
+{
+    eval_partial_add(&s->p, card);
+    s->value = eval_partial_value(&s->p);
+}
+
+static inline void
+eval_state_remove(struct eval_state *s, int card)
+{
+    eval_partial_remove(&s->p, card);
+    s->value = eval_partial_value(&s->p);
+}
+
+
+//
+//   Lowball.  An ace-to-five low ignores straights and flushes and
+//   counts the Ace low, so the best unpaired low of a set of cards
+//   depends only on the OR of their rank bits.  low5[] ranks it
+//   from 1 (5-4-3-2-A) up; the 8-or-better lows are the first 56,
+//   exactly those whose mask fits in the bottom eight bits.
+//
+
+#define LOW8_MAX    56
+
+// Rank mask with the Ace moved from the top (bit 12) to bit 0.
+static inline int
+low_mask(int ranks)
+{
+    return ((ranks << 1) | (ranks >> 12)) & 0x1fff;
+}
+
+// 8-or-better low (1..LOW8_MAX) of a 13-bit rank mask, or 0.
+static inline unsigned short
+low8_ranks(int ranks)
+{
+    return low5[low_mask(ranks) & 0xff];
+}
+
+// High value and 8-or-better low of n (5, 6 or 7) cards, from one
+// pass over them.
+static inline unsigned short
+eval_hilo_cards(const int *hand, int n, unsigned short *lo)
+{
+    struct eval_partial p;
+
+    eval_partial_init(&p, hand, n);
+    *lo = low8_ranks(p.smask[0] | p.smask[1] | p.smask[2] | p.smask[3]);
+    return eval_partial_value(&p);
+}
+
+
+//
+//   Omaha.  A hand must use exactly two of the player's hole cards
+//   and exactly three of the board's.  Each pair and each triple
+//   is reduced once to its prime product and suit bits, and a
+//   combination is then one multiply and one find_fast5 probe.  A
+//   flush needs a suited pair on a board with three of that suit,
+//   so the flush bit is only worked out for those pairs.
+//
+//       struct omaha_board b;
+//       omaha_board_init(&b, board, 5);
+//       v = eval_omaha_cards(&b, hole, 4);
+//
+
+struct omaha_board
+{
+    int ntriples;                   // C(n, 3) for a board of n
+    unsigned prod[10];              // prime product of each triple
+    int suit[10];                   // suit bit of a one-suit triple
+    int flush_suits;                // suits some triple is all of
+    int low[10];                    // A-8 low mask of three low ranks, or 0
+    int any_low;                    // some triple has one
+};
+
+static inline void
+omaha_board_init(struct omaha_board *b, const int *board, int n)
+{
+    b->ntriples = 0;
+    b->flush_suits = 0;
+    b->any_low = 0;
+    for (int i = 0; i < n; i++)
+        for (int j = i+1; j < n; j++)
+            for (int k = j+1; k < n; k++)
+            {
+                int t = b->ntriples++;
+                b->prod[t] = (board[i] & 0xff) * (board[j] & 0xff) * (board[k] & 0xff);
+                b->suit[t] = board[i] & board[j] & board[k] & 0xf000;
+                b->flush_suits |= b->suit[t];
+
+                int m = low_mask(board[i] >> 16) | low_mask(board[j] >> 16) |
+                        low_mask(board[k] >> 16);
+                b->low[t] = (__builtin_popcount(m & 0xff) == 3) ? m & 0xff : 0;
+                b->any_low |= b->low[t];
+            }
+}
+
+// Lowers best to the best value the hole pair with prime product
+// pp and suit bits ps makes with any triple of the board.
+static inline unsigned short
+omaha_pair(const struct omaha_board *b, unsigned pp, int ps, unsigned short best)
+{
+    ps &= b->flush_suits;
+    if (ps)
+        for (int t = 0; t < b->ntriples; t++)
+        {
+            unsigned key = pp * b->prod[t] | (unsigned)((ps & b->suit[t]) != 0) << 27;
+            unsigned short v = hash5_values[find_fast5(key)];
+            if (v < best)
+                best = v;
+        }
+    else
+        for (int t = 0; t < b->ntriples; t++)
+        {
+            unsigned short v = hash5_values[find_fast5(pp * b->prod[t])];
+            if (v < best)
+                best = v;
+        }
+    return best;
+}
+
+// Best value of nhole (4 to 6) hole cards on the board.
+static inline unsigned short
+eval_omaha_cards(const struct omaha_board *b, const int *hole, int nhole)
+{
+    unsigned short best = 9999;
+
+    for (int i = 0; i < nhole; i++)
+        for (int j = i+1; j < nhole; j++)
+            best = omaha_pair(b, (hole[i] & 0xff) * (hole[j] & 0xff),
+                              hole[i] & hole[j], best);
+    return best;
+}
+
+// Omaha hi/lo: the best high value, and in *lo the best 8-or-better
+// low (0 if none), each made of two hole cards and three board
+// cards, in one pass over the hole pairs.  The low part of a pair
+// is skipped unless it holds two different low ranks and some
+// triple on the board three others.
+static inline unsigned short
+eval_omaha_hilo_cards(const struct omaha_board *b, const int *hole, int nhole,
+                      unsigned short *lo)
+{
+    unsigned short best = 9999, low = 0xffff;
+
+    for (int i = 0; i < nhole; i++)
+        for (int j = i+1; j < nhole; j++)
+        {
+            int pm = (low_mask(hole[i] >> 16) | low_mask(hole[j] >> 16)) & 0xff;
+
+            best = omaha_pair(b, (hole[i] & 0xff) * (hole[j] & 0xff),
+                              hole[i] & hole[j], best);
+            if (!b->any_low || __builtin_popcount(pm) != 2)
+                continue;
+            for (int t = 0; t < b->ntriples; t++)
+                if (b->low[t] && !(b->low[t] & pm))
+                {
+                    unsigned short v = low5[b->low[t] | pm];
+                    if (v < low)
+                        low = v;
+                }
+        }
+    *lo = (low == 0xffff) ? 0 : low;
+    return best;
+}
+
+#endif
@@ -1,7 +1,14 @@
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD
+#endif
 #include "arrays.h"
+#include "tables.h"
 #include "poker.h"
+#include "pokereval.h"
 
 // Poker hand evaluator
 //
@@ -73,23 +80,103 @@ find_card(int rank, int suit, int *deck)
 
 //
 //  This routine takes a deck and randomly mixes up
-//  the order of the cards.
+//  the order of the cards.  It uses the global drand48()
+//  state, so it is not safe to call from several threads;
+//  use shuffle_deck_r for that.
 //
 void
 shuffle_deck(int *deck)
 {
-    int n, temp[52];
+    // Fisher-Yates: every order is equally likely, and each
+    // card costs exactly one draw.
+    for (int i = 51; i > 0; i--)
+    {
+        int n = (int)((i + 1) * drand48());
+        int t = deck[i];
+        deck[i] = deck[n];
+        deck[n] = t;
+    }
+}
 
-    for (int i = 0; i < 52; i++)
-        temp[i] = deck[i];
 
-    for (int i = 0; i < 52; i++)
+//
+//  A small, fast random number generator (xoshiro256**)
+//  whose whole state lives in the caller's rng_state, so
+//  each thread can keep its own.
+//
+static uint64_t
+splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+void
+rng_seed(struct rng_state *rng, uint64_t seed)
+{
+    for (int i = 0; i < 4; i++)
+        rng->s[i] = splitmix64(&seed);
+}
+
+uint64_t
+rng_next(struct rng_state *rng)
+{
+    uint64_t *s = rng->s, t = s[1] << 17;
+    uint64_t out = s[1] * 5;
+
+    out = ((out << 7) | (out >> 57)) * 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return out;
+}
+
+// Returns a uniform integer in [0, n), without modulo bias
+// (Lemire's multiply-and-reject method).
+unsigned
+rng_below(struct rng_state *rng, unsigned n)
+{
+    uint64_t m = (rng_next(rng) >> 32) * n;
+
+    if ((uint32_t)m < n)
+    {
+        uint32_t floor = -n % n;
+        while ((uint32_t)m < floor)
+            m = (rng_next(rng) >> 32) * n;
+    }
+    return (unsigned)(m >> 32);
+}
+
+//
+//  Reentrant version of shuffle_deck, drawing from the
+//  caller's generator.
+//
+void
+shuffle_deck_r(int *deck, struct rng_state *rng)
+{
+    shuffle_partial(deck, 52, 51, rng);
+}
+
+//
+//  Moves a uniformly random choice of k of the n cards to
+//  cards[0..k-1], in random order, at a cost of k draws.
+//  The array stays a permutation of the same cards, so it
+//  can be dealt from again without being rebuilt.
+//
+void
+shuffle_partial(int *cards, int n, int k, struct rng_state *rng)
+{
+    for (int i = 0; i < k && i < n - 1; i++)
     {
-        do {
-            n = (int)(51.9999999 * drand48());
-        } while (temp[n] == 0);
-        deck[i] = temp[n];
-        temp[n] = 0;
+        int j = i + rng_below(rng, n - i);
+        int t = cards[i];
+        cards[i] = cards[j];
+        cards[j] = t;
     }
 }
 
@@ -124,6 +211,82 @@ print_hand(int *hand, int n)
 }
 
 
+//  Character classes for parse_cards.  A rank character maps to
+//  its rank (2-14) and a suit character to its suit bit shifted
+//  down by 8, so either one is already in the layout of the
+//  card's second byte (cdhsrrrr).  Everything else maps to 0.
+//
+static const unsigned char card_chars[256] = {
+    ['2'] = 2, ['3'] = 3, ['4'] = 4, ['5'] = 5, ['6'] = 6,
+    ['7'] = 7, ['8'] = 8, ['9'] = 9,
+    ['T'] = 10, ['J'] = 11, ['Q'] = 12, ['K'] = 13, ['A'] = 14,
+    ['t'] = 10, ['j'] = 11, ['q'] = 12, ['k'] = 13, ['a'] = 14,
+    ['c'] = CLUB >> 8, ['d'] = DIAMOND >> 8, ['h'] = HEART >> 8, ['s'] = SPADE >> 8,
+    ['C'] = CLUB >> 8, ['D'] = DIAMOND >> 8, ['H'] = HEART >> 8, ['S'] = SPADE >> 8,
+};
+
+//  This routine parses a string of cards such as "AcKd" or
+//  "Ac Kd, 7h" into the init_deck() encoding.  Cards may be run
+//  together or separated by spaces and commas; ranks and suits
+//  may be either case.  It returns the number of cards stored in
+//  out, which must have room for 52, or -1 if the string holds
+//  anything else or names a card twice.
+//
+int
+parse_cards(const char *s, int *out)
+{
+    const unsigned char *p = (const unsigned char *)s;
+    uint64_t seen = 0;
+    int n = 0;
+
+    for (;;)
+    {
+        while (*p == ' ' || *p == ',' || *p == '\t')
+            p++;
+        if (!*p)
+            return n;
+
+        int r = card_chars[p[0]], su = card_chars[p[1]];
+        if (r < Deuce || r > Ace || su <= Ace)
+            return -1;
+
+        int bit = (3 - __builtin_ctz(su >> 4)) * 13 + r - Deuce;
+        if (seen >> bit & 1)
+            return -1;
+        seen |= 1ull << bit;
+
+        out[n++] = primes[r - Deuce] | ((su | r) << 8) | (1 << (14 + r));
+        p += 2;
+    }
+}
+
+//  This routine writes the given hand into buf as a string, e.g.
+//
+//      Ac 4d 7c Jh 2s
+//
+//  with no trailing space, and returns its length.  buf must have
+//  room for 3*n bytes (one for an empty hand) and is always
+//  NUL-terminated.  Unlike print_hand it does no I/O.
+//
+int
+format_hand(char *buf, const int *hand, int n)
+{
+    static const char rank[] = "??23456789TJQKA?";
+    static const char suit[] = "sshhddddcccccccc";  // same order as print_hand
+    char *p = buf;
+
+    for (int i = 0; i < n; i++)
+    {
+        if (i)
+            *p++ = ' ';
+        *p++ = rank[(hand[i] >> 8) & 0xF];
+        *p++ = suit[(hand[i] >> 12) & 0xF];
+    }
+    *p = '\0';
+    return (int)(p - buf);
+}
+
+
 // Returns the hand rank of the given equivalence class value.
 // Note: the parameter "val" should be in the range of 1-7462.
 int
@@ -140,44 +303,26 @@ hand_rank(unsigned short val)
     return STRAIGHT_FLUSH;                   //   10 straight-flushes
 }
 
-// Perform a perfect hash lookup (courtesy of Paul Senzee).
-static unsigned
-find_fast(unsigned u)
-{
-    unsigned a, b, r;
-
-    u += 0xe91aaa35;
-    u ^= u >> 16;
-    u += u << 8;
-    u ^= u >> 4;
-    b  = (u >> 8) & 0x1ff;
-    a  = (u + (u << 2)) >> 19;
-    r  = a ^ hash_adjust[b];
-    return r;
-}
-
-
-// Evaluates the given five-card poker cards.
-// Returns a number from 1 to 7462, where 1 is the best hand
-// possible (i.e. Royal Flush), and 7462 is the worst hand
-// possible (75432 unsuited).
-static unsigned short
-eval_5cards(int c1, int c2, int c3, int c4, int c5)
+// Returns the class word of the given equivalence class value,
+// or 0 if "val" is not in the range 1-7462.  The word packs the
+// category (as hand_rank() gives it) with the ranks that make the
+// hand, read out with the CLASS_ macros in poker.h:
+//
+//     straight (flush)    primary = top card (Five for the wheel)
+//     four of a kind      primary = quads, one kicker
+//     full house          primary = trips, secondary = pair
+//     three of a kind     primary = trips, two kickers
+//     two pair            primary = high pair, secondary = low
+//                         pair, one kicker
+//     one pair            primary = pair, three kickers
+//     flush, high card    primary = top card, four kickers
+//
+// Fields that do not apply are 0.  Callers that already hold a
+// valid value can index hand_classes[] directly.
+unsigned
+hand_class(unsigned short val)
 {
-    int q = (c1 | c2 | c3 | c4 | c5) >> 16;
-    short s;
-
-    // This checks for Flushes and Straight Flushes.
-    if (c1 & c2 & c3 & c4 & c5 & 0xf000)
-        return flushes[q];
-
-    // This checks for Straights and High Card hands.
-    if ((s = unique5[q]))
-        return s;
-
-    // This performs a perfect-hash lookup for remaining hands.
-    q = (c1 & 0xff) * (c2 & 0xff) * (c3 & 0xff) * (c4 & 0xff) * (c5 & 0xff);
-    return hash_values[find_fast(q)];
+    return (val >= 1 && val <= 7462) ? hand_classes[val] : 0;
 }
 
 // Evaluates the given five-card poker hand array.
@@ -194,9 +339,192 @@ eval_5hand(int *hand)
 }
 
 
+// Evaluates the given five-card poker hand array, like
+// eval_5hand, but without the flush and unique5 branches: the
+// flush test only sets a key bit, and every hand costs the same
+// prime product and a single perfect-hash probe.  The gain is
+// largest on random mixes of hands, where the eval_5cards
+// branches mispredict; see README.md for timings.
+unsigned short
+eval_5hand_fast(int *hand)
+{
+    return eval_5cards_fast(hand[0], hand[1], hand[2], hand[3], hand[4]);
+}
+
+
+// Evaluates n five-card hands stored back to back in hands[]
+// (five cards per hand, so hands[] holds 5*n cards) and writes
+// each hand's value to out[].  Gives the same values as calling
+// eval_5hand on each hand; the AVX2 and AVX-512 versions below
+// are picked at run time when the CPU supports them.
+//
+static void
+eval_5hand_batch_scalar(const int *hands, size_t n, unsigned short *out)
+{
+    for (size_t i = 0; i < n; i++, hands += 5)
+        out[i] = eval_5cards(hands[0], hands[1], hands[2], hands[3], hands[4]);
+}
+
+#ifdef HAVE_X86_SIMD
+
+// Looks up eight unsigned short table entries at once.  The
+// 32-bit gather also fetches the entry after each one, which is
+// why the tables in arrays.h end with a spare entry.
+__attribute__((target("avx2")))
+static inline __m256i
+gather16_avx2(const unsigned short *table, __m256i idx)
+{
+    __m256i v = _mm256_i32gather_epi32((const int *)table, idx, 2);
+    return _mm256_and_si256(v, _mm256_set1_epi32(0xffff));
+}
+
+// Eight hands per iteration; the same steps as eval_5cards and
+// find_fast, computed for every lane and blended at the end.
+__attribute__((target("avx2")))
+static void
+eval_5hand_batch_avx2(const int *hands, size_t n, unsigned short *out)
+{
+    const __m256i stride = _mm256_setr_epi32(0, 5, 10, 15, 20, 25, 30, 35);
+    const __m256i lo8 = _mm256_set1_epi32(0xff);
+    size_t i;
+
+    for (i = 0; i + 8 <= n; i += 8, hands += 40)
+    {
+        __m256i c1 = _mm256_i32gather_epi32(hands + 0, stride, 4);
+        __m256i c2 = _mm256_i32gather_epi32(hands + 1, stride, 4);
+        __m256i c3 = _mm256_i32gather_epi32(hands + 2, stride, 4);
+        __m256i c4 = _mm256_i32gather_epi32(hands + 3, stride, 4);
+        __m256i c5 = _mm256_i32gather_epi32(hands + 4, stride, 4);
+
+        __m256i or = _mm256_or_si256(_mm256_or_si256(c1, c2),
+                     _mm256_or_si256(_mm256_or_si256(c3, c4), c5));
+        __m256i and = _mm256_and_si256(_mm256_and_si256(c1, c2),
+                      _mm256_and_si256(_mm256_and_si256(c3, c4), c5));
+        __m256i q = _mm256_srli_epi32(or, 16);
+
+        // Flushes and Straight Flushes.
+        __m256i isflush = _mm256_cmpgt_epi32(
+            _mm256_and_si256(and, _mm256_set1_epi32(0xf000)), _mm256_setzero_si256());
+        __m256i fl = gather16_avx2(flushes, q);
+
+        // Straights and High Card hands.
+        __m256i u5 = gather16_avx2(unique5, q);
+
+        // Perfect-hash lookup for the remaining hands.
+        __m256i p = _mm256_mullo_epi32(
+            _mm256_mullo_epi32(_mm256_and_si256(c1, lo8), _mm256_and_si256(c2, lo8)),
+            _mm256_mullo_epi32(_mm256_and_si256(c3, lo8), _mm256_and_si256(c4, lo8)));
+        __m256i u = _mm256_mullo_epi32(p, _mm256_and_si256(c5, lo8));
+
+        u = _mm256_add_epi32(u, _mm256_set1_epi32(0xe91aaa35));
+        u = _mm256_xor_si256(u, _mm256_srli_epi32(u, 16));
+        u = _mm256_add_epi32(u, _mm256_slli_epi32(u, 8));
+        u = _mm256_xor_si256(u, _mm256_srli_epi32(u, 4));
+        __m256i b = _mm256_and_si256(_mm256_srli_epi32(u, 8), _mm256_set1_epi32(0x1ff));
+        __m256i a = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_slli_epi32(u, 2)), 19);
+        __m256i r = _mm256_xor_si256(a, gather16_avx2(hash_adjust, b));
+        __m256i hv = gather16_avx2(hash_values, r);
+
+        __m256i v = _mm256_blendv_epi8(hv, u5,
+            _mm256_xor_si256(_mm256_cmpeq_epi32(u5, _mm256_setzero_si256()),
+                             _mm256_set1_epi32(-1)));
+        v = _mm256_blendv_epi8(v, fl, isflush);
+
+        // Pack the eight 32-bit values down to unsigned shorts.
+        __m128i lo = _mm256_castsi256_si128(v), hi = _mm256_extracti128_si256(v, 1);
+        _mm_storeu_si128((__m128i *)(out + i), _mm_packus_epi32(lo, hi));
+    }
+    eval_5hand_batch_scalar(hands, n - i, out + i);
+}
+
+// Sixteen hands per iteration, otherwise as the AVX2 version.
+__attribute__((target("avx512f")))
+static void
+eval_5hand_batch_avx512(const int *hands, size_t n, unsigned short *out)
+{
+    const __m512i stride = _mm512_setr_epi32(0, 5, 10, 15, 20, 25, 30, 35,
+                                             40, 45, 50, 55, 60, 65, 70, 75);
+    const __m512i lo8 = _mm512_set1_epi32(0xff), lo16 = _mm512_set1_epi32(0xffff);
+    size_t i;
+
+    for (i = 0; i + 16 <= n; i += 16, hands += 80)
+    {
+        __m512i c1 = _mm512_i32gather_epi32(stride, hands + 0, 4);
+        __m512i c2 = _mm512_i32gather_epi32(stride, hands + 1, 4);
+        __m512i c3 = _mm512_i32gather_epi32(stride, hands + 2, 4);
+        __m512i c4 = _mm512_i32gather_epi32(stride, hands + 3, 4);
+        __m512i c5 = _mm512_i32gather_epi32(stride, hands + 4, 4);
+
+        __m512i or = _mm512_or_si512(_mm512_or_si512(c1, c2),
+                     _mm512_or_si512(_mm512_or_si512(c3, c4), c5));
+        __m512i and = _mm512_and_si512(_mm512_and_si512(c1, c2),
+                      _mm512_and_si512(_mm512_and_si512(c3, c4), c5));
+        __m512i q = _mm512_srli_epi32(or, 16);
+
+        // Flushes and Straight Flushes.
+        __mmask16 isflush = _mm512_test_epi32_mask(and, _mm512_set1_epi32(0xf000));
+        __m512i fl = _mm512_and_si512(
+            _mm512_i32gather_epi32(q, (const int *)flushes, 2), lo16);
+
+        // Straights and High Card hands.
+        __m512i u5 = _mm512_and_si512(
+            _mm512_i32gather_epi32(q, (const int *)unique5, 2), lo16);
+        __mmask16 isunique = _mm512_test_epi32_mask(u5, u5);
+
+        // Perfect-hash lookup for the remaining hands.
+        __m512i p = _mm512_mullo_epi32(
+            _mm512_mullo_epi32(_mm512_and_si512(c1, lo8), _mm512_and_si512(c2, lo8)),
+            _mm512_mullo_epi32(_mm512_and_si512(c3, lo8), _mm512_and_si512(c4, lo8)));
+        __m512i u = _mm512_mullo_epi32(p, _mm512_and_si512(c5, lo8));
+
+        u = _mm512_add_epi32(u, _mm512_set1_epi32(0xe91aaa35));
+        u = _mm512_xor_si512(u, _mm512_srli_epi32(u, 16));
+        u = _mm512_add_epi32(u, _mm512_slli_epi32(u, 8));
+        u = _mm512_xor_si512(u, _mm512_srli_epi32(u, 4));
+        __m512i b = _mm512_and_si512(_mm512_srli_epi32(u, 8), _mm512_set1_epi32(0x1ff));
+        __m512i a = _mm512_srli_epi32(_mm512_add_epi32(u, _mm512_slli_epi32(u, 2)), 19);
+        __m512i adj = _mm512_and_si512(
+            _mm512_i32gather_epi32(b, (const int *)hash_adjust, 2), lo16);
+        __m512i r = _mm512_xor_si512(a, adj);
+        __m512i hv = _mm512_and_si512(
+            _mm512_i32gather_epi32(r, (const int *)hash_values, 2), lo16);
+
+        __m512i v = _mm512_mask_blend_epi32(isunique, hv, u5);
+        v = _mm512_mask_blend_epi32(isflush, v, fl);
+        _mm256_storeu_si256((__m256i *)(out + i), _mm512_cvtepi32_epi16(v));
+    }
+    eval_5hand_batch_scalar(hands, n - i, out + i);
+}
+
+#endif  // HAVE_X86_SIMD
+
+void
+eval_5hand_batch(const int *hands, size_t n, unsigned short *out)
+{
+#ifdef EVAL_STATS
+    struct eval_perf_sample ps;
+
+    EVAL_COUNT(EVAL_STAT_BATCH_CALLS);
+    EVAL_COUNT_N(EVAL_STAT_BATCH_HANDS, n);
+    eval_stats_perf_begin(&ps);
+#endif
+#ifdef HAVE_X86_SIMD
+    if (__builtin_cpu_supports("avx512f"))
+        eval_5hand_batch_avx512(hands, n, out);
+    else if (__builtin_cpu_supports("avx2"))
+        eval_5hand_batch_avx2(hands, n, out);
+    else
+#endif
+        eval_5hand_batch_scalar(hands, n, out);
+#ifdef EVAL_STATS
+    eval_stats_perf_end(&ps);
+#endif
+}
+
+
 // This is a non-optimized method of determining the
 // best five-card hand possible out of seven cards.
-// I am working on a faster algorithm.
+// It is kept as the reference for eval_7hand_fast.
 //
 unsigned short
 eval_7hand(int *hand)
@@ -204,6 +532,7 @@ eval_7hand(int *hand)
     int subhand[5];
     unsigned short best = 9999;
 
+    EVAL_COUNT(EVAL_STAT_7HAND);
     for (int i = 0; i < 21; i++)
     {
         for (int j = 0; j < 5; j++)
@@ -214,3 +543,132 @@ eval_7hand(int *hand)
     }
     return best;
 }
+
+
+// Evaluates the given six-card poker hand array.  Returns the
+// value of its best five-card hand, from 1 to 7462 just like
+// eval_5hand.  Works the same way as eval_7hand_fast.
+unsigned short
+eval_6hand(int *hand)
+{
+    return eval_6cards(hand);
+}
+
+
+// Evaluates the given seven-card poker hand array directly,
+// without looping over its 21 five-card subhands.  Returns the
+// same value as eval_7hand.
+//
+// One pass over the cards accumulates the rank counts (in base
+// five) and a 4-bit counter per suit.  If some suit holds five
+// or more cards, the suited rank mask indexes flushes7[].
+// Otherwise the rank counts alone decide the hand and go
+// through a perfect hash.
+//
+unsigned short
+eval_7hand_fast(int *hand)
+{
+    return eval_7cards(hand);
+}
+
+
+// Evaluates an Omaha hand: four (or, for eval_omaha5, five) hole
+// cards and a five-card board, of which exactly two and three
+// cards must be used.  Returns the best value, 1 to 7462, over
+// the 60 (or 100) legal combinations.
+//
+unsigned short
+eval_omaha4(const int *hole, const int *board)
+{
+    struct omaha_board b;
+
+    omaha_board_init(&b, board, 5);
+    return eval_omaha_cards(&b, hole, 4);
+}
+
+unsigned short
+eval_omaha5(const int *hole, const int *board)
+{
+    struct omaha_board b;
+
+    omaha_board_init(&b, board, 5);
+    return eval_omaha_cards(&b, hole, 5);
+}
+
+
+// Evaluates the best 8-or-better ace-to-five low among any n
+// cards (Stud8, Hold'em hi/lo).  Returns 1 (5-4-3-2-A) to 56
+// (8-7-6-5-4), or 0 if the cards make no qualifying low.
+//
+unsigned short
+eval_low8(const int *hand, int n)
+{
+    int ranks = 0;
+
+    for (int i = 0; i < n; i++)
+        ranks |= hand[i];
+    return low8_ranks(ranks >> 16);
+}
+
+// Evaluates five to seven cards for both halves of an 8-or-better
+// split pot: returns the high value as eval_7hand would, and
+// stores the eval_low8 value in *lo.
+//
+unsigned short
+eval_hilo8(const int *hand, int n, unsigned short *lo)
+{
+    return eval_hilo_cards(hand, n, lo);
+}
+
+// Omaha hi/lo with four or five hole cards and a five-card board:
+// returns the high value as eval_omaha4/5 and stores the 8-or-better
+// low made of exactly two hole and three board cards in *lo (0 if
+// there is none).
+//
+unsigned short
+eval_omaha_hilo(const int *hole, int nhole, const int *board, unsigned short *lo)
+{
+    struct omaha_board b;
+
+    omaha_board_init(&b, board, 5);
+    return eval_omaha_hilo_cards(&b, hole, nhole, lo);
+}
+
+
+// Scores a Hold'em showdown: n players (1 to 23), each with two
+// hole cards, on one five-card board.  The board's rank counts,
+// suit counters and suited rank masks are worked out once, so each
+// player costs two cards' worth of adds and one table lookup.
+// values[i] (if values is not NULL) gets player i's value, 1 to
+// 7462.  Returns a mask with bit i set for every player holding
+// the best hand, so more than one bit means a split pot, or 0 if
+// n is out of range.
+//
+unsigned
+eval_showdown(const int *board, const int (*holes)[2], int n,
+              unsigned short *values)
+{
+    struct eval_partial b;
+    unsigned short best = 9999;
+    unsigned winners = 0;
+
+    if (n < 1 || n > 23)
+        return 0;
+
+    eval_partial_init(&b, board, 5);
+    for (int i = 0; i < n; i++)
+    {
+        unsigned short v = eval_partial_hole(&b, holes[i][0], holes[i][1], 7);
+
+        if (values)
+            values[i] = v;
+        if (v < best)
+        {
+            best = v;
+            winners = 1u << i;
+        }
+        else if (v == best)
+            winners |= 1u << i;
+    }
+    return winners;
+}
@@ -0,0 +1,724 @@
+#include <ctype.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "pokereval.h"
+#include "cards.h"
+#include "enumerate.h"
+#include "equity.h"
+#include "range.h"
+#include "sim.h"
+
+// Range-against-range equity.
+//
+// Each board costs one evaluation per distinct live combo of the
+// two ranges, through the board's eval_partial.  Both sides are
+// then sorted by value and swept together: walking range[0] from
+// its best hand down, two pointers into range[1] keep the weight
+// of its hands that are strictly better and better-or-equal, in
+// total and per card.  Subtracting the per-card sums of the two
+// hole cards takes out the combos that conflict, so each combo of
+// range[0] is settled in O(1) instead of against every combo of
+// range[1].
+//
+
+#define MAX_THREADS 256
+
+// Starting-hand classes (iso_preflop_class) from best to worst by
+// all-in equity against one random hand, from 3,000,000 random
+// deals per class.
+static const unsigned char preflop_order[169] =
+{
+    0, 14, 28, 42, 56, 70, 84, 1, 98, 2, 3, 13, 4, 26, 39, 15, 112, 52,
+    5, 16, 6, 17, 27, 7, 65, 40, 126, 29, 9, 18, 8, 78, 53, 30, 10, 91,
+    19, 11, 41, 66, 117, 31, 104, 20, 43, 12, 54, 140, 130, 21, 32, 79,
+    143, 22, 44, 67, 55, 92, 156, 23, 33, 105, 24, 45, 57, 154, 34, 80,
+    118, 25, 68, 35, 131, 46, 58, 36, 93, 69, 81, 144, 106, 37, 71, 59,
+    47, 157, 168, 38, 119, 48, 82, 94, 132, 72, 49, 60, 145, 50, 83,
+    85, 95, 107, 73, 51, 158, 61, 120, 62, 96, 86, 133, 108, 74, 63,
+    99, 146, 97, 64, 109, 87, 159, 121, 75, 100, 134, 76, 110, 113, 88,
+    122, 147, 77, 111, 101, 160, 127, 123, 114, 89, 135, 124, 90, 102,
+    148, 125, 128, 115, 136, 161, 141, 137, 139, 103, 138, 129, 116,
+    149, 162, 142, 150, 152, 151, 155, 153, 163, 165, 164, 166, 167
+};
+
+
+//
+//   Parsing.
+//
+
+struct parser
+{
+    const char *s;
+    int deck[52];
+    short slot[RANGE_MAX_COMBOS];       // index -> place in the range
+    struct range *r;
+};
+
+static int
+pair_index(int p1, int p2)
+{
+    if (p1 > p2)
+    {
+        int t = p1;
+        p1 = p2;
+        p2 = t;
+    }
+    return p2 * (p2 - 1) / 2 + p1;
+}
+
+static const char rank_chars[] = "23456789TJQKA";
+static const char suit_chars[] = "cdhs";
+
+// Rank index (0 = Deuce) or suit field of a character, or -1.
+static int
+rank_of(int ch)
+{
+    const char *p = ch ? strchr(rank_chars, toupper(ch)) : NULL;
+    return p ? (int)(p - rank_chars) : -1;
+}
+
+static int
+suit_of(int ch)
+{
+    const char *p = ch ? strchr(suit_chars, tolower(ch)) : NULL;
+    return p ? (int)(p - suit_chars) : -1;
+}
+
+static void
+add_combo(struct parser *ps, int p1, int p2, double w)
+{
+    struct range *r = ps->r;
+    int i = pair_index(p1, p2);
+
+    if (ps->slot[i] < 0)
+    {
+        struct range_combo *c = &r->combo[r->n];
+        ps->slot[i] = r->n++;
+        c->mask = (1ull << p1) | (1ull << p2);
+        c->c1 = ps->deck[p1];
+        c->c2 = ps->deck[p2];
+        c->index = i;
+    }
+    r->combo[ps->slot[i]].weight = w;
+}
+
+// Adds every combo of ranks hi/lo (rank indexes) of the given kind:
+// 's' suited, 'o' offsuit, 0 both.  For pairs kind is ignored.
+static void
+add_hand(struct parser *ps, int hi, int lo, int kind, double w)
+{
+    for (int f1 = 0; f1 < 4; f1++)
+        for (int f2 = 0; f2 < 4; f2++)
+        {
+            if (hi == lo ? f2 <= f1 : (kind == 's' && f1 != f2) || (kind == 'o' && f1 == f2))
+                continue;
+            add_combo(ps, f1*13 + hi, f2*13 + lo, w);
+        }
+}
+
+static int
+add_percent(struct parser *ps, double pct, double w)
+{
+    int target = (int)(pct / 100 * RANGE_MAX_COMBOS + 0.5), count = 0;
+
+    if (pct <= 0 || pct > 100)
+        return -1;
+    for (int i = 0; i < 169 && count < target; i++)
+    {
+        int cls = preflop_order[i], row = cls / 13, col = cls % 13;
+        int hi = 12 - (row < col ? row : col), lo = 12 - (row < col ? col : row);
+
+        add_hand(ps, hi, lo, row == col ? 0 : row < col ? 's' : 'o', w);
+        count += (row == col) ? 6 : (row < col) ? 4 : 12;
+    }
+    return 0;
+}
+
+// Reads "XY", "XYs" or "XYo"; returns 0 or -1.
+static int
+read_hand(struct parser *ps, int *hi, int *lo, int *kind)
+{
+    int a = rank_of(ps->s[0]), b = a < 0 ? -1 : rank_of(ps->s[1]);
+
+    if (a < 0 || b < 0)
+        return -1;
+    ps->s += 2;
+    *hi = a > b ? a : b;
+    *lo = a > b ? b : a;
+    *kind = 0;
+    if (a != b && (*ps->s == 's' || *ps->s == 'o'))
+        *kind = *ps->s++;
+    return 0;
+}
+
+static int
+read_weight(struct parser *ps, double *w)
+{
+    char *end;
+
+    *w = 1;
+    if (*ps->s != ':')
+        return 0;
+    *w = strtod(ps->s + 1, &end);
+    if (end == ps->s + 1 || *w < 0)
+        return -1;
+    ps->s = end;
+    return 0;
+}
+
+static int
+read_item(struct parser *ps)
+{
+    const char *s = ps->s;
+    int hi, lo, kind, hi2, lo2, kind2;
+    double w;
+
+    if (isdigit((unsigned char)*s))
+    {
+        // A percentage, unless it is a hand like 99.
+        char *end;
+        double pct = strtod(s, &end);
+        if (*end == '%')
+        {
+            ps->s = end + 1;
+            return (read_weight(ps, &w) < 0) ? -1 : add_percent(ps, pct, w);
+        }
+    }
+
+    if (rank_of(s[0]) >= 0 && suit_of(s[1]) >= 0)
+    {
+        // One combo, e.g. AhKh.
+        int r1 = rank_of(s[0]), f1 = suit_of(s[1]);
+        int r2 = rank_of(s[2]), f2 = r2 < 0 ? -1 : suit_of(s[3]);
+        if (f2 < 0 || (r1 == r2 && f1 == f2))
+            return -1;
+        ps->s += 4;
+        if (read_weight(ps, &w) < 0)
+            return -1;
+        add_combo(ps, f1*13 + r1, f2*13 + r2, w);
+        return 0;
+    }
+
+    if (read_hand(ps, &hi, &lo, &kind) < 0)
+        return -1;
+
+    if (*ps->s == '+')
+    {
+        ps->s++;
+        if (read_weight(ps, &w) < 0)
+            return -1;
+        if (hi == lo)
+            for (int r = lo; r <= 12; r++)
+                add_hand(ps, r, r, 0, w);
+        else
+            for (int r = lo; r < hi; r++)
+                add_hand(ps, hi, r, kind, w);
+        return 0;
+    }
+
+    if (*ps->s == '-')
+    {
+        ps->s++;
+        if (read_hand(ps, &hi2, &lo2, &kind2) < 0 || read_weight(ps, &w) < 0)
+            return -1;
+        if (hi == lo && hi2 == lo2)
+        {
+            for (int r = (lo < lo2 ? lo : lo2); r <= (lo < lo2 ? lo2 : lo); r++)
+                add_hand(ps, r, r, 0, w);
+            return 0;
+        }
+        if (hi != hi2 || hi == lo || hi2 == lo2 || kind != kind2)
+            return -1;
+        for (int r = (lo < lo2 ? lo : lo2); r <= (lo < lo2 ? lo2 : lo); r++)
+            add_hand(ps, hi, r, kind, w);
+        return 0;
+    }
+
+    if (read_weight(ps, &w) < 0)
+        return -1;
+    add_hand(ps, hi, lo, kind, w);
+    return 0;
+}
+
+int
+range_parse(const char *text, struct range *r)
+{
+    struct parser ps;
+
+    ps.s = text;
+    ps.r = r;
+    init_deck(ps.deck);
+    memset(ps.slot, -1, sizeof(ps.slot));
+    r->n = 0;
+
+    for (;;)
+    {
+        while (isspace((unsigned char)*ps.s))
+            ps.s++;
+        if (!*ps.s)
+            break;
+        if (read_item(&ps) < 0)
+            return -1;
+        while (isspace((unsigned char)*ps.s))
+            ps.s++;
+        if (*ps.s == ',')
+            ps.s++;
+        else if (*ps.s)
+            return -1;
+    }
+    return r->n;
+}
+
+
+//
+//   Equity.
+//
+
+struct combo
+{
+    uint64_t mask;
+    int c1, c2;
+    int p1, p2;                     // card positions
+    int index;                      // pair index
+    int u;                          // place in the union of both sides
+    double w;
+};
+
+struct context
+{
+    struct combo side[2][RANGE_MAX_COMBOS];
+    int n[2];
+    double wsame[RANGE_MAX_COMBOS]; // range[1] weight of each pair index
+
+    // Distinct combos of both sides, each evaluated once per board.
+    int nunion;
+    int uc1[RANGE_MAX_COMBOS], uc2[RANGE_MAX_COMBOS];
+    uint64_t umask[RANGE_MAX_COMBOS];
+
+    struct eval_partial known;      // the known board cards
+    uint64_t known_mask;
+    int need;                       // board cards still to come
+    int live[52];                   // cards not on the board or dead
+    int nlive;
+};
+
+// Per-thread state: the tally and scratch space for one board.
+struct scratch
+{
+    struct range_counts t;
+    unsigned short val[RANGE_MAX_COMBOS];
+    uint32_t key[2][RANGE_MAX_COMBOS], tmp[RANGE_MAX_COMBOS];
+    double wcard[52], ltcard[52], lecard[52];
+};
+
+// Returns the position (0-51) of the card in the init_deck()
+// order, or -1 if it is not a valid card.
+static int
+card_position(int card, const int *deck)
+{
+    int suit = (card >> 12) & 0xF, rank = RANK(card);
+
+    if (rank < Deuce || rank > Ace || !suit || (suit & (suit - 1)))
+        return -1;
+
+    int i = (3 - __builtin_ctz(suit)) * 13 + rank - Deuce;
+    return (deck[i] == card) ? i : -1;
+}
+
+// Sorts keys of value << 11 | combo by value, in two radix passes
+// over the 13 value bits.
+static void
+sort_keys(uint32_t *key, uint32_t *tmp, int n)
+{
+    int count[128];
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        int shift = pass ? 18 : 11;
+        uint32_t *from = pass ? tmp : key, *to = pass ? key : tmp;
+
+        memset(count, 0, sizeof(count));
+        for (int i = 0; i < n; i++)
+            count[(from[i] >> shift) & 127]++;
+        for (int d = 0, sum = 0; d < 128; d++)
+        {
+            int c = count[d];
+            count[d] = sum;
+            sum += c;
+        }
+        for (int i = 0; i < n; i++)
+            to[count[(from[i] >> shift) & 127]++] = from[i];
+    }
+}
+
+// Scores one complete board: the known cards plus dealt[0..need-1].
+static void
+score_board(const struct context *ctx, const int *dealt, struct scratch *s)
+{
+    struct eval_partial board = ctx->known;
+    uint64_t bmask = ctx->known_mask;
+    struct range_counts *t = &s->t;
+    int n[2];
+
+    for (int i = 0; i < ctx->need; i++)
+    {
+        int c = dealt[i];
+        eval_partial_add(&board, c);
+        bmask |= 1ull << ((3 - __builtin_ctz((c >> 12) & 0xF)) * 13 + RANK(c) - Deuce);
+    }
+
+    for (int u = 0; u < ctx->nunion; u++)
+        s->val[u] = (ctx->umask[u] & bmask) ? 0 :
+            eval_partial_hole(&board, ctx->uc1[u], ctx->uc2[u], 7);
+
+    for (int side = 0; side < 2; side++)
+    {
+        n[side] = 0;
+        for (int i = 0; i < ctx->n[side]; i++)
+            if (!(ctx->side[side][i].mask & bmask))
+                s->key[side][n[side]++] = (uint32_t)s->val[ctx->side[side][i].u] << 11 | i;
+        sort_keys(s->key[side], s->tmp, n[side]);
+    }
+
+    double wtot = 0, lt = 0, le = 0;
+    memset(s->wcard, 0, sizeof(s->wcard));
+    memset(s->ltcard, 0, sizeof(s->ltcard));
+    memset(s->lecard, 0, sizeof(s->lecard));
+    for (int j = 0; j < n[1]; j++)
+    {
+        const struct combo *b = &ctx->side[1][s->key[1][j] & 2047];
+        wtot += b->w;
+        s->wcard[b->p1] += b->w;
+        s->wcard[b->p2] += b->w;
+    }
+
+    // lt and le follow range[1]'s weight strictly better than, and
+    // better than or equal to, the current combo of range[0].  The
+    // same pair of cards in range[1] ties, and is subtracted once
+    // per card, so it is added back once.
+    for (int i = 0, ilt = 0, ile = 0; i < n[0]; i++)
+    {
+        const struct combo *a = &ctx->side[0][s->key[0][i] & 2047];
+        uint32_t v = s->key[0][i] >> 11;
+
+        for (; ilt < n[1] && s->key[1][ilt] >> 11 < v; ilt++)
+        {
+            const struct combo *b = &ctx->side[1][s->key[1][ilt] & 2047];
+            lt += b->w;
+            s->ltcard[b->p1] += b->w;
+            s->ltcard[b->p2] += b->w;
+        }
+        for (; ile < n[1] && s->key[1][ile] >> 11 <= v; ile++)
+        {
+            const struct combo *b = &ctx->side[1][s->key[1][ile] & 2047];
+            le += b->w;
+            s->lecard[b->p1] += b->w;
+            s->lecard[b->p2] += b->w;
+        }
+
+        double same = ctx->wsame[a->index];
+        double live = wtot - s->wcard[a->p1] - s->wcard[a->p2] + same;
+        double lose = lt - s->ltcard[a->p1] - s->ltcard[a->p2];
+        double tie = le - s->lecard[a->p1] - s->lecard[a->p2] + same - lose;
+
+        t->win[0] += a->w * (live - lose - tie);
+        t->win[1] += a->w * lose;
+        t->tie    += a->w * tie;
+        t->weight += a->w * live;
+    }
+    t->boards++;
+}
+
+static void
+visit_board(const int *cards, void *local, void *arg)
+{
+    score_board(arg, cards, local);
+}
+
+static void
+merge_tally(void *total, const void *local, void *arg)
+{
+    struct range_counts *t = total;
+    const struct range_counts *l = local;
+
+    (void)arg;
+    t->boards += l->boards;
+    t->win[0] += l->win[0];
+    t->win[1] += l->win[1];
+    t->tie    += l->tie;
+    t->weight += l->weight;
+}
+
+
+struct mc_worker
+{
+    const struct context *ctx;
+    uint64_t trials;
+    struct sim *sim;                // deals this worker's boards
+    struct scratch s;
+} __attribute__((aligned(64)));
+
+static void *
+mc_work(void *p)
+{
+    struct mc_worker *w = p;
+    const struct context *ctx = w->ctx;
+
+    for (uint64_t t = 0; t < w->trials; t++)
+        score_board(ctx, sim_deal(w->sim, ctx->need), &w->s);
+    return NULL;
+}
+
+static int
+run_monte_carlo(const struct context *ctx, uint64_t trials, uint64_t seed,
+                int nthreads, struct range_counts *total)
+{
+    pthread_t tids[MAX_THREADS];
+    int started[MAX_THREADS];
+    struct mc_worker *w = aligned_alloc(64, sizeof(*w) * nthreads);
+    uint64_t dead = ((1ull << 52) - 1) & ~hand_mask(ctx->live, ctx->nlive);
+    int rc = 0;
+
+    if (!w)
+        return -1;
+    for (int i = 0; i < nthreads; i++)
+    {
+        memset(&w[i].s.t, 0, sizeof(w[i].s.t));
+        w[i].ctx = ctx;
+        w[i].trials = trials * (i+1) / nthreads - trials * i / nthreads;
+        uint64_t wseed = seed + 0x632be59bd9b4e019ull * i;
+
+        if ((w[i].sim = sim_create(0, wseed)))
+            sim_reset(w[i].sim, dead, wseed);
+        else
+            rc = -1;
+    }
+    if (rc < 0)
+        goto out;
+
+    // A thread that cannot be started runs its share here instead.
+    for (int i = 1; i < nthreads; i++)
+        started[i] = !pthread_create(&tids[i], NULL, mc_work, &w[i]);
+    mc_work(&w[0]);
+    for (int i = 1; i < nthreads; i++)
+    {
+        if (started[i])
+            pthread_join(tids[i], NULL);
+        else
+            mc_work(&w[i]);
+    }
+
+    for (int i = 0; i < nthreads; i++)
+        merge_tally(total, &w[i].s.t, NULL);
+
+out:
+    for (int i = 0; i < nthreads; i++)
+        sim_destroy(w[i].sim);
+    free(w);
+    return rc;
+}
+
+// Fills in the combos of both ranges that survive the known board
+// and dead cards.  Returns -1 on a bad card.
+static int
+build_sides(const struct range_query *q, struct context *ctx,
+            const int *deck, uint64_t out)
+{
+    short upos[RANGE_MAX_COMBOS];
+
+    memset(upos, -1, sizeof(upos));
+    memset(ctx->wsame, 0, sizeof(ctx->wsame));
+    ctx->nunion = 0;
+
+    for (int side = 0; side < 2; side++)
+    {
+        const struct range *r = q->range[side];
+
+        ctx->n[side] = 0;
+        for (int i = 0; i < r->n; i++)
+        {
+            const struct range_combo *rc = &r->combo[i];
+            struct combo *c = &ctx->side[side][ctx->n[side]];
+            int p1 = card_position(rc->c1, deck), p2 = card_position(rc->c2, deck);
+
+            if (p1 < 0 || p2 < 0 || p1 == p2)
+                return -1;
+            if (rc->weight <= 0 || (out >> p1 & 1) || (out >> p2 & 1))
+                continue;
+
+            c->mask = (1ull << p1) | (1ull << p2);
+            c->c1 = rc->c1;
+            c->c2 = rc->c2;
+            c->p1 = p1;
+            c->p2 = p2;
+            c->index = p1 > p2 ? p1 * (p1 - 1) / 2 + p2 : p2 * (p2 - 1) / 2 + p1;
+            c->w = rc->weight;
+            if (upos[c->index] < 0)
+            {
+                upos[c->index] = ctx->nunion;
+                ctx->uc1[ctx->nunion] = c->c1;
+                ctx->uc2[ctx->nunion] = c->c2;
+                ctx->umask[ctx->nunion++] = c->mask;
+            }
+            c->u = upos[c->index];
+            if (side == 1)
+                ctx->wsame[c->index] = c->w;
+            ctx->n[side]++;
+        }
+    }
+    return 0;
+}
+
+// Checks the query and fills in the context.  Returns -1 on a
+// bad query or if either side has no combo left.
+static int
+setup(const struct range_query *q, struct context *ctx)
+{
+    int deck[52];
+    uint64_t out = 0;
+
+    if (!q->range[0] || !q->range[1])
+        return -1;
+    if (q->nboard < 0 || q->nboard > 5 || q->ndead < 0 || (q->ndead && !q->dead))
+        return -1;
+
+    // Mark the board and then the dead cards, rejecting bad or
+    // repeated ones.
+    init_deck(deck);
+    eval_partial_init(&ctx->known, q->board, q->nboard);
+    for (int i = 0; i < q->nboard + q->ndead; i++)
+    {
+        int c = i < q->nboard ? q->board[i] : q->dead[i - q->nboard];
+        int p = card_position(c, deck);
+        if (p < 0 || (out >> p & 1))
+            return -1;
+        if (i == q->nboard)
+            ctx->known_mask = out;
+        out |= 1ull << p;
+    }
+    if (q->ndead == 0)
+        ctx->known_mask = out;
+
+    ctx->need = 5 - q->nboard;
+    ctx->nlive = 0;
+    for (int i = 0; i < 52; i++)
+        if (!(out >> i & 1))
+            ctx->live[ctx->nlive++] = deck[i];
+
+    if (build_sides(q, ctx, deck, out) < 0 || !ctx->n[0] || !ctx->n[1] ||
+        ctx->nlive < ctx->need)
+        return -1;
+    return 0;
+}
+
+// Scores the boards of colex rank first to first + count - 1.
+static int
+count_boards(const struct context *ctx, uint64_t first, uint64_t count,
+             int nthreads, struct range_counts *total)
+{
+    if (ctx->need == 0)
+    {
+        // The board is complete: rank 0 is the only one.
+        struct scratch *s;
+
+        if (first || !count)
+            return 0;
+        if (!(s = malloc(sizeof(*s))))
+            return -1;
+        memset(&s->t, 0, sizeof(s->t));
+        score_board(ctx, NULL, s);
+        merge_tally(total, &s->t, NULL);
+        free(s);
+        return 0;
+    }
+
+    struct enum_spec spec = {
+        .pool = ctx->live, .npool = ctx->nlive, .k = ctx->need,
+        .nthreads = nthreads, .first = first, .count = count,
+        .visit = visit_board, .merge = merge_tally,
+        .local_size = sizeof(struct scratch), .arg = (void *)ctx,
+    };
+    return count ? enum_run(&spec, total) : 0;
+}
+
+uint64_t
+range_boards(const struct range_query *q)
+{
+    struct context *ctx = malloc(sizeof(*ctx));
+    uint64_t boards = 0;
+
+    if (ctx && setup(q, ctx) == 0)
+        boards = n_choose_k(ctx->nlive, ctx->need);
+    free(ctx);
+    return boards;
+}
+
+int
+range_count(const struct range_query *q, uint64_t first, uint64_t count,
+            struct range_counts *c)
+{
+    struct context *ctx = malloc(sizeof(*ctx));
+    int rc = -1;
+
+    if (ctx && setup(q, ctx) == 0)
+    {
+        uint64_t boards = n_choose_k(ctx->nlive, ctx->need);
+        if (first <= boards && count <= boards - first)
+            rc = count_boards(ctx, first, count, q->nthreads, c);
+    }
+    free(ctx);
+    return rc;
+}
+
+int
+range_equity(const struct range_query *q, struct range_result *res)
+{
+    struct context *ctx;
+    struct range_counts total;
+    int nthreads = q->nthreads;
+    uint64_t max_evals = q->max_evals ? q->max_evals : EQ_DEFAULT_MAX_EVALS;
+    uint64_t trials = q->trials ? q->trials : EQ_DEFAULT_TRIALS;
+
+    if (!(ctx = malloc(sizeof(*ctx))))
+        return -1;
+    if (setup(q, ctx) < 0)
+    {
+        free(ctx);
+        return -1;
+    }
+
+    if (nthreads <= 0)
+        nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads < 1)
+        nthreads = 1;
+    if (nthreads > MAX_THREADS)
+        nthreads = MAX_THREADS;
+
+    memset(&total, 0, sizeof(total));
+    memset(res, 0, sizeof(*res));
+
+    int rc;
+    uint64_t boards = n_choose_k(ctx->nlive, ctx->need);
+    if (boards * ctx->nunion <= max_evals)
+    {
+        res->exhaustive = 1;
+        rc = count_boards(ctx, 0, boards, nthreads, &total);
+    }
+    else
+        rc = run_monte_carlo(ctx, trials, q->seed, nthreads, &total);
+    free(ctx);
+
+    // No pair of combos could meet on any board.
+    if (rc < 0 || total.weight <= 0)
+        return -1;
+
+    res->boards = total.boards;
+    res->win[0] = total.win[0] / total.weight;
+    res->win[1] = total.win[1] / total.weight;
+    res->tie = total.tie / total.weight;
+    res->equity[0] = res->win[0] + res->tie / 2;
+    res->equity[1] = res->win[1] + res->tie / 2;
+    return 0;
+}
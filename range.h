@@ -0,0 +1,106 @@
+#ifndef RANGE_H
+#define RANGE_H
+
+#include <stdint.h>
+
+//
+//   Hand ranges and range-against-range equity.
+//
+//   A range is a weighted set of two-card combos, parsed from the
+//   usual notation: comma-separated items, each optionally followed
+//   by ":weight" (default 1).
+//
+//       QQ        one pair, all 6 combos     22-55  pairs 22 to 55
+//       QQ+       QQ, KK, AA                 AKs    4 suited combos
+//       ATs+      ATs, AJs, AQs, AKs         AKo    12 offsuit combos
+//       KTo-K7o   KTo, K9o, K8o, K7o         AK     AKs and AKo
+//       AhKh      one combo                  20%    the best 20% of
+//                                                   combos (see below)
+//
+//   Percentages take whole starting-hand classes in order of their
+//   equity against one random hand until that share of the 1326
+//   combos is covered.  An item that repeats a combo replaces its
+//   weight.
+//
+//   Each combo carries its two cards as a 52-bit mask of init_deck()
+//   positions, so card conflicts are one AND.
+//
+
+#define RANGE_MAX_COMBOS    1326
+
+struct range_combo
+{
+    uint64_t mask;                  // bits of the two card positions
+    int c1, c2;                     // the cards, init_deck() encoding
+    int index;                      // 0..1325, one per pair of cards
+    double weight;
+};
+
+struct range
+{
+    int n;
+    struct range_combo combo[RANGE_MAX_COMBOS];
+};
+
+// Parses text into r.  Returns the number of combos, or -1 on a
+// syntax error.
+int
+range_parse(const char *text, struct range *r);
+
+struct range_query
+{
+    const struct range *range[2];
+    int board[5];                       // known board cards
+    int nboard;                         // 0..5
+    const int *dead;                    // other cards known to be out
+    int ndead;
+
+    uint64_t max_evals;                 // 0 = EQ_DEFAULT_MAX_EVALS
+    uint64_t trials;                    // 0 = EQ_DEFAULT_TRIALS
+    uint64_t seed;                      // Monte Carlo seed
+    int nthreads;                       // 0 = one per online CPU
+};
+
+struct range_result
+{
+    int exhaustive;                     // 1 if every board was dealt
+    uint64_t boards;                    // boards evaluated
+    double win[2];                      // weighted share won outright
+    double tie;                         // weighted share split
+    double equity[2];                   // share of the pot, 0..1
+};
+
+// Equity of range[0] against range[1].  Every pair of combos that
+// share no card with each other, the board or the dead cards is
+// weighted by the product of their weights.  As with equity_calc,
+// every board is dealt when boards * combos fits in max_evals and
+// boards are sampled otherwise.  Returns 0, or -1 if the query is
+// invalid, no pair of combos is possible or memory ran out.
+int
+range_equity(const struct range_query *q, struct range_result *res);
+
+// Raw weighted sums behind an exhaustive result: win[] and tie
+// are weight won and split, weight the weight of every pair that
+// could meet.  Counts over disjoint sets of boards merge by adding;
+// with whole-number weights the sums are exact.
+struct range_counts
+{
+    uint64_t boards;
+    double win[2], tie, weight;
+};
+
+// Number of boards still to deal for the query (1 if the board is
+// complete), or 0 if the query is invalid.
+uint64_t
+range_boards(const struct range_query *q);
+
+// Scores, as exhaustive mode does, the boards whose colex ranks
+// over the live cards (see enumerate.h) run from first to
+// first + count - 1, and adds their sums to c.  Returns 0, or -1
+// if the query is invalid, the range runs past the last board or
+// memory ran out.
+int
+range_count(const struct range_query *q, uint64_t first, uint64_t count,
+            struct range_counts *c);
+
+#endif
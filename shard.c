@@ -0,0 +1,615 @@
+#include <ctype.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "poker.h"
+#include "enumerate.h"
+#include "shard.h"
+
+// Sharded exhaustive runs.
+//
+// The job hash covers every parsed field that decides what a unit
+// computes, including the range combos and their weights, so two
+// results can only merge if they were cut from the same run.  It
+// does not hash the job text itself, so comments and spacing do
+// not matter.
+//
+
+#define MAX_LINE 4096
+
+#define FNV_OFFSET  0xcbf29ce484222325ull
+#define FNV_PRIME   0x100000001b3ull
+
+static uint64_t
+hash_u64(uint64_t h, uint64_t v)
+{
+    for (int i = 0; i < 8; i++, v >>= 8)
+        h = (h ^ (v & 0xff)) * FNV_PRIME;
+    return h;
+}
+
+static uint64_t
+hash_job(const struct shard_job *job)
+{
+    uint64_t h = FNV_OFFSET;
+
+    h = hash_u64(h, job->type);
+    h = hash_u64(h, job->nplayers);
+    for (int p = 0; p < job->nplayers; p++)
+        h = hash_u64(hash_u64(h, job->hole[p][0]), job->hole[p][1]);
+    h = hash_u64(h, job->nranges);
+    for (int r = 0; r < job->nranges; r++)
+    {
+        h = hash_u64(h, job->range[r].n);
+        for (int i = 0; i < job->range[r].n; i++)
+        {
+            uint64_t w;
+            memcpy(&w, &job->range[r].combo[i].weight, sizeof(w));
+            h = hash_u64(hash_u64(h, job->range[r].combo[i].index), w);
+        }
+    }
+    h = hash_u64(h, job->nboard);
+    for (int i = 0; i < job->nboard; i++)
+        h = hash_u64(h, job->board[i]);
+    h = hash_u64(h, job->ndead);
+    for (int i = 0; i < job->ndead; i++)
+        h = hash_u64(h, job->dead[i]);
+    h = hash_u64(h, job->ncards);
+    return hash_u64(h, job->nunits);
+}
+
+static void
+equity_query_of(const struct shard_job *job, struct equity_query *q, int nthreads)
+{
+    memset(q, 0, sizeof(*q));
+    q->nplayers = job->nplayers;
+    memcpy(q->hole, job->hole, sizeof(q->hole));
+    memcpy(q->board, job->board, sizeof(q->board));
+    q->nboard = job->nboard;
+    q->dead = job->dead;
+    q->ndead = job->ndead;
+    q->nthreads = nthreads;
+}
+
+static void
+range_query_of(const struct shard_job *job, struct range_query *q, int nthreads)
+{
+    memset(q, 0, sizeof(*q));
+    q->range[0] = &job->range[0];
+    q->range[1] = &job->range[1];
+    memcpy(q->board, job->board, sizeof(q->board));
+    q->nboard = job->nboard;
+    q->dead = job->dead;
+    q->ndead = job->ndead;
+    q->nthreads = nthreads;
+}
+
+// The cards not listed as dead, for values jobs.  Returns the
+// pool size, or -1 if the dead cards repeat.
+static int
+values_pool(const struct shard_job *job, int *pool)
+{
+    int deck[52], n = 0;
+    uint64_t dead = 0;
+
+    init_deck(deck);
+    for (int i = 0; i < job->ndead; i++)
+    {
+        for (int j = 0; j < 52; j++)
+            if (deck[j] == job->dead[i])
+            {
+                if (dead >> j & 1)
+                    return -1;
+                dead |= 1ull << j;
+            }
+    }
+    for (int i = 0; i < 52; i++)
+        if (!(dead >> i & 1))
+            pool[n++] = deck[i];
+    return n;
+}
+
+// Parses a card list item into cards[], up to max.  Returns the
+// number of cards, or -1.
+static int
+parse_list(const char *s, int *cards, int max)
+{
+    int tmp[52], n = parse_cards(s, tmp);
+
+    if (n < 0 || n > max)
+        return -1;
+    memcpy(cards, tmp, sizeof(int) * n);
+    return n;
+}
+
+int
+shard_job_parse(const char *text, struct shard_job *job)
+{
+    char line[MAX_LINE];
+    int lineno = 0;
+
+    memset(job, 0, sizeof(*job));
+    job->type = -1;
+
+    while (*text)
+    {
+        size_t len = strcspn(text, "\n");
+        char *s, *arg, *hash;
+        int n;
+
+        lineno++;
+        if (len >= sizeof(line))
+            return lineno;
+        memcpy(line, text, len);
+        line[len] = '\0';
+        text += len + (text[len] == '\n');
+
+        if ((hash = strchr(line, '#')))
+            *hash = '\0';
+        for (s = line; isspace((unsigned char)*s); s++)
+            ;
+        if (!*s)
+            continue;
+        for (arg = s; *arg && !isspace((unsigned char)*arg); arg++)
+            ;
+        if (*arg)
+            *arg++ = '\0';
+        while (isspace((unsigned char)*arg))
+            arg++;
+        for (char *e = arg + strlen(arg); e > arg && isspace((unsigned char)e[-1]); )
+            *--e = '\0';
+
+        if (!strcmp(s, "type"))
+        {
+            if (!strcmp(arg, "equity"))
+                job->type = SHARD_EQUITY;
+            else if (!strcmp(arg, "range"))
+                job->type = SHARD_RANGE;
+            else if (!strcmp(arg, "values"))
+                job->type = SHARD_VALUES;
+            else
+                return lineno;
+        }
+        else if (!strcmp(s, "hand"))
+        {
+            if (job->nplayers == EQ_MAX_PLAYERS ||
+                parse_list(arg, job->hole[job->nplayers], 2) != 2)
+                return lineno;
+            job->nplayers++;
+        }
+        else if (!strcmp(s, "range"))
+        {
+            if (job->nranges == 2 || range_parse(arg, &job->range[job->nranges]) < 1)
+                return lineno;
+            job->nranges++;
+        }
+        else if (!strcmp(s, "board"))
+        {
+            if ((n = parse_list(arg, job->board, 5)) < 0)
+                return lineno;
+            job->nboard = n;
+        }
+        else if (!strcmp(s, "dead"))
+        {
+            if ((n = parse_list(arg, job->dead, 52)) < 0)
+                return lineno;
+            job->ndead = n;
+        }
+        else if (!strcmp(s, "cards") || !strcmp(s, "units"))
+        {
+            char *end;
+            unsigned long v = strtoul(arg, &end, 10);
+            if (end == arg || *end)
+                return lineno;
+            if (*s == 'c')
+                job->ncards = (int)(v < 100 ? v : 100);
+            else
+                job->nunits = (uint32_t)(v < SHARD_MAX_UNITS + 1 ? v : 0);
+        }
+        else
+            return lineno;
+    }
+
+    if (job->nunits < 1 || job->nunits > SHARD_MAX_UNITS)
+        return -1;
+
+    switch (job->type)
+    {
+    case SHARD_EQUITY:
+    {
+        struct equity_query q;
+        if (job->nplayers < 2 || job->nranges || job->ncards)
+            return -1;
+        equity_query_of(job, &q, 1);
+        job->total = equity_boards(&q);
+        break;
+    }
+    case SHARD_RANGE:
+    {
+        struct range_query q;
+        if (job->nranges != 2 || job->nplayers || job->ncards)
+            return -1;
+        range_query_of(job, &q, 1);
+        job->total = range_boards(&q);
+        break;
+    }
+    case SHARD_VALUES:
+    {
+        int pool[52], n = values_pool(job, pool);
+        if (job->ncards < 5 || job->ncards > 7 || job->nplayers ||
+            job->nranges || job->nboard || n < job->ncards)
+            return -1;
+        job->total = n_choose_k(n, job->ncards);
+        break;
+    }
+    default:
+        return -1;
+    }
+    if (!job->total)
+        return -1;
+
+    job->id = hash_job(job);
+    return 0;
+}
+
+void
+shard_unit(const struct shard_job *job, uint32_t index,
+           uint64_t *first, uint64_t *count)
+{
+    // total * nunits stays far below 2^64: at most C(52, 7) hands
+    // times SHARD_MAX_UNITS.
+    *first = job->total * index / job->nunits;
+    *count = job->total * (index + 1) / job->nunits - *first;
+}
+
+void
+shard_unit_id(const struct shard_job *job, uint32_t index, char *buf)
+{
+    snprintf(buf, 32, "%016" PRIx64 "-%" PRIu32, job->id, index);
+}
+
+void
+shard_result_init(const struct shard_job *job, struct shard_result *r)
+{
+    memset(r, 0, sizeof(*r));
+    r->job = job->id;
+    r->type = job->type;
+    r->nunits = job->nunits;
+}
+
+int
+shard_run(const struct shard_job *job, uint32_t index, int nthreads,
+          struct shard_result *r)
+{
+    uint64_t first, count;
+    int rc = 0;
+
+    if (r->job != job->id || index >= job->nunits || (r->done[index / 8] >> (index % 8) & 1))
+        return -1;
+    shard_unit(job, index, &first, &count);
+
+    if (count)
+        switch (job->type)
+        {
+        case SHARD_EQUITY:
+        {
+            struct equity_query q;
+            equity_query_of(job, &q, nthreads);
+            rc = equity_count(&q, first, count, &r->equity);
+            break;
+        }
+        case SHARD_RANGE:
+        {
+            struct range_query q;
+            range_query_of(job, &q, nthreads);
+            rc = range_count(&q, first, count, &r->range);
+            break;
+        }
+        default:
+        {
+            static unsigned short (*const evals[3])(int *) = {
+                eval_5hand_fast, eval_6hand, eval_7hand_fast,
+            };
+            int pool[52], n = values_pool(job, pool);
+            rc = enum_values_range(pool, n, job->ncards, evals[job->ncards - 5],
+                                   nthreads, first, count, r->freq);
+        }
+        }
+
+    if (rc < 0)
+        return -1;
+    r->done[index / 8] |= 1 << (index % 8);
+    return 0;
+}
+
+int
+shard_merge(struct shard_result *into, const struct shard_result *from)
+{
+    if (into->job != from->job || into->type != from->type || into->nunits != from->nunits)
+        return -1;
+    for (size_t i = 0; i < sizeof(into->done); i++)
+        if (into->done[i] & from->done[i])
+            return -1;
+
+    for (size_t i = 0; i < sizeof(into->done); i++)
+        into->done[i] |= from->done[i];
+    into->equity.boards += from->equity.boards;
+    for (int p = 0; p < EQ_MAX_PLAYERS; p++)
+    {
+        into->equity.wins[p]  += from->equity.wins[p];
+        into->equity.ties[p]  += from->equity.ties[p];
+        into->equity.share[p] += from->equity.share[p];
+    }
+    into->range.boards += from->range.boards;
+    into->range.win[0] += from->range.win[0];
+    into->range.win[1] += from->range.win[1];
+    into->range.tie    += from->range.tie;
+    into->range.weight += from->range.weight;
+    for (int v = 0; v <= 7462; v++)
+        into->freq[v] += from->freq[v];
+    return 0;
+}
+
+uint32_t
+shard_missing(const struct shard_result *r, uint32_t *missing)
+{
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < r->nunits; i++)
+        if (!(r->done[i / 8] >> (i % 8) & 1))
+        {
+            if (missing)
+                missing[n] = i;
+            n++;
+        }
+    return n;
+}
+
+
+//
+//   Result files are text, one item per line:
+//
+//       PKSHARD 1
+//       job 3f9c0e2a7d15b804
+//       type 0
+//       units 100
+//       done 0-41,43,45-99
+//       boards 1712304                           (equity and range)
+//       wins <one count per player slot>
+//       ties ...
+//       share ...
+//       range <win0> <win1> <tie> <weight>       (hex floats, exact)
+//       freq <value> <count>                     (one line per value)
+//
+//   Only the lines for the result's type are written.
+//
+
+static void
+write_counts(FILE *fp, const char *name, const uint64_t *c)
+{
+    fprintf(fp, "%s", name);
+    for (int p = 0; p < EQ_MAX_PLAYERS; p++)
+        fprintf(fp, " %" PRIu64, c[p]);
+    fprintf(fp, "\n");
+}
+
+int
+shard_result_save(const struct shard_result *r, const char *path)
+{
+    char tmp[4096];
+    FILE *fp;
+
+    if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp) ||
+        !(fp = fopen(tmp, "w")))
+        return -1;
+
+    fprintf(fp, "PKSHARD 1\njob %016" PRIx64 "\ntype %d\nunits %" PRIu32 "\ndone ",
+            r->job, r->type, r->nunits);
+    const char *sep = "";
+    for (uint32_t i = 0; i < r->nunits; )
+    {
+        uint32_t j = i;
+        if (!(r->done[i / 8] >> (i % 8) & 1))
+        {
+            i++;
+            continue;
+        }
+        while (j + 1 < r->nunits && (r->done[(j+1) / 8] >> ((j+1) % 8) & 1))
+            j++;
+        if (j > i)
+            fprintf(fp, "%s%" PRIu32 "-%" PRIu32, sep, i, j);
+        else
+            fprintf(fp, "%s%" PRIu32, sep, i);
+        sep = ",";
+        i = j + 1;
+    }
+    fprintf(fp, "\n");
+
+    if (r->type == SHARD_EQUITY)
+    {
+        fprintf(fp, "boards %" PRIu64 "\n", r->equity.boards);
+        write_counts(fp, "wins", r->equity.wins);
+        write_counts(fp, "ties", r->equity.ties);
+        write_counts(fp, "share", r->equity.share);
+    }
+    else if (r->type == SHARD_RANGE)
+        fprintf(fp, "boards %" PRIu64 "\nrange %a %a %a %a\n", r->range.boards,
+                r->range.win[0], r->range.win[1], r->range.tie, r->range.weight);
+    else
+        for (int v = 0; v <= 7462; v++)
+            if (r->freq[v])
+                fprintf(fp, "freq %d %lu\n", v, r->freq[v]);
+
+    if (fclose(fp) || rename(tmp, path))
+    {
+        remove(tmp);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+read_counts(const char *s, uint64_t *c)
+{
+    for (int p = 0; p < EQ_MAX_PLAYERS; p++)
+    {
+        char *end;
+        c[p] = strtoull(s, &end, 10);
+        if (end == s)
+            return -1;
+        s = end;
+    }
+    return 0;
+}
+
+// Parses "0-41,43" into r->done.
+static int
+read_done(const char *s, struct shard_result *r)
+{
+    while (*s)
+    {
+        char *end;
+        unsigned long a = strtoul(s, &end, 10), b = a;
+
+        if (end == s)
+            return -1;
+        s = end;
+        if (*s == '-')
+        {
+            b = strtoul(++s, &end, 10);
+            if (end == s)
+                return -1;
+            s = end;
+        }
+        if (a > b || b >= r->nunits)
+            return -1;
+        for (unsigned long i = a; i <= b; i++)
+            r->done[i / 8] |= 1 << (i % 8);
+        if (*s == ',')
+            s++;
+        else if (*s)
+            return -1;
+    }
+    return 0;
+}
+
+int
+shard_result_load(const char *path, struct shard_result *r)
+{
+    // The done line of a fragmented result lists every run of
+    // units and has no useful bound, so lines are read whole.
+    char *line = NULL;
+    size_t cap = 0;
+    FILE *fp = fopen(path, "r");
+    int ok = 1, version = 0;
+
+    if (!fp)
+        return -1;
+    memset(r, 0, sizeof(*r));
+    if (getline(&line, &cap, fp) < 0 || sscanf(line, "PKSHARD %d", &version) != 1 ||
+        version != 1)
+        ok = 0;
+
+    while (ok && getline(&line, &cap, fp) >= 0)
+    {
+        char *arg = strchr(line, ' ');
+        uint64_t boards;
+        int v;
+
+        line[strcspn(line, "\n")] = '\0';
+        if (!arg)
+        {
+            ok = 0;
+            break;
+        }
+        *arg++ = '\0';
+
+        if (!strcmp(line, "job"))
+            ok = sscanf(arg, "%" SCNx64, &r->job) == 1;
+        else if (!strcmp(line, "type"))
+            ok = sscanf(arg, "%d", &r->type) == 1 && r->type >= 0 && r->type <= 2;
+        else if (!strcmp(line, "units"))
+            ok = sscanf(arg, "%" SCNu32, &r->nunits) == 1 &&
+                 r->nunits >= 1 && r->nunits <= SHARD_MAX_UNITS;
+        else if (!strcmp(line, "done"))
+            ok = read_done(arg, r) == 0;
+        else if (!strcmp(line, "boards"))
+        {
+            ok = sscanf(arg, "%" SCNu64, &boards) == 1;
+            if (r->type == SHARD_RANGE)
+                r->range.boards = boards;
+            else
+                r->equity.boards = boards;
+        }
+        else if (!strcmp(line, "wins"))
+            ok = read_counts(arg, r->equity.wins) == 0;
+        else if (!strcmp(line, "ties"))
+            ok = read_counts(arg, r->equity.ties) == 0;
+        else if (!strcmp(line, "share"))
+            ok = read_counts(arg, r->equity.share) == 0;
+        else if (!strcmp(line, "range"))
+        {
+            char *s = arg, *end;
+            double *d[4] = { &r->range.win[0], &r->range.win[1], &r->range.tie,
+                             &r->range.weight };
+            for (int i = 0; ok && i < 4; i++, s = end)
+            {
+                *d[i] = strtod(s, &end);
+                ok = end != s;
+            }
+        }
+        else if (!strcmp(line, "freq"))
+        {
+            unsigned long c;
+            ok = sscanf(arg, "%d %lu", &v, &c) == 2 && v >= 0 && v <= 7462;
+            if (ok)
+                r->freq[v] = c;
+        }
+        else
+            ok = 0;
+    }
+    if (ferror(fp) || !r->nunits)
+        ok = 0;
+    free(line);
+    fclose(fp);
+    return ok ? 0 : -1;
+}
+
+int
+shard_equity(const struct shard_result *r, struct equity_result *res)
+{
+    const struct equity_counts *c = &r->equity;
+
+    if (r->type != SHARD_EQUITY || shard_missing(r, NULL))
+        return -1;
+    memset(res, 0, sizeof(*res));
+    res->exhaustive = 1;
+    res->boards = c->boards;
+    for (int p = 0; p < EQ_MAX_PLAYERS; p++)
+    {
+        res->wins[p] = c->wins[p];
+        res->ties[p] = c->ties[p];
+        res->equity[p] = c->boards ?
+            (double)c->share[p] / EQ_SHARE_UNIT / c->boards : 0;
+    }
+    return 0;
+}
+
+int
+shard_range(const struct shard_result *r, struct range_result *res)
+{
+    const struct range_counts *c = &r->range;
+
+    if (r->type != SHARD_RANGE || shard_missing(r, NULL) || c->weight <= 0)
+        return -1;
+    memset(res, 0, sizeof(*res));
+    res->exhaustive = 1;
+    res->boards = c->boards;
+    res->win[0] = c->win[0] / c->weight;
+    res->win[1] = c->win[1] / c->weight;
+    res->tie = c->tie / c->weight;
+    res->equity[0] = res->win[0] + res->tie / 2;
+    res->equity[1] = res->win[1] + res->tie / 2;
+    return 0;
+}
@@ -0,0 +1,125 @@
+#ifndef SHARD_H
+#define SHARD_H
+
+#include <stdint.h>
+#include "equity.h"
+#include "range.h"
+
+//
+//   Sharded exhaustive runs.
+//
+//   A job is a text description of one exhaustive run, with one
+//   item per line and "#" starting a comment:
+//
+//       type equity             type range               type values
+//       hand AcKd               range QQ+,AKs            cards 7
+//       hand QsQh               range 20%                dead 2c
+//       board 2c7d9h            board 2c7d9h             units 64
+//       units 100               units 400
+//
+//   "equity" runs equity_count() for two or more hands, "range"
+//   runs range_count() for two ranges, and "values" counts the
+//   hands of each value over every "cards"-card combination of the
+//   cards not listed as dead.  The boards (or hands) of the job,
+//   in colex order, are cut into "units" work units that differ in
+//   size by at most one, the same way enumerate.c cuts ranks across
+//   threads.  Unit i of a job always covers the same ranks, and its
+//   id is the job's hash and i, so any node can run any unit.
+//
+//   Each result records which units went into it, and results of
+//   one job merge by adding their counts, which gives exactly the
+//   numbers of a single run.  For range jobs the sums are doubles;
+//   they are exact with whole-number weights, as in the default of
+//   1.  A coordinator resumes after a node failure by merging the
+//   results it has and re-issuing the units shard_missing() lists.
+//
+
+#define SHARD_EQUITY    0
+#define SHARD_RANGE     1
+#define SHARD_VALUES    2
+
+#define SHARD_MAX_UNITS 65536
+
+struct shard_job
+{
+    int type;
+    int nplayers;                       // equity
+    int hole[EQ_MAX_PLAYERS][2];
+    struct range range[2];              // range
+    int nranges;
+    int board[5];                       // equity, range
+    int nboard;
+    int dead[52];
+    int ndead;
+    int ncards;                         // values, 5 to 7
+    uint32_t nunits;
+
+    uint64_t total;                     // boards or hands in the job
+    uint64_t id;                        // hash of everything above
+};
+
+struct shard_result
+{
+    uint64_t job;                       // shard_job.id
+    int type;
+    uint32_t nunits;
+    uint8_t done[SHARD_MAX_UNITS / 8];  // bit i: unit i is included
+
+    struct equity_counts equity;
+    struct range_counts range;
+    unsigned long freq[7463];           // values: hands of each value
+};
+
+// Parses a job.  Returns 0, or the (1-based) number of the first
+// bad line, or -1 if the whole job is inconsistent (wrong number
+// of hands or ranges, units out of range, cards that collide).
+int
+shard_job_parse(const char *text, struct shard_job *job);
+
+// The colex ranks covered by unit index of the job.
+void
+shard_unit(const struct shard_job *job, uint32_t index,
+           uint64_t *first, uint64_t *count);
+
+// Writes the unit's id, "<job hash in hex>-<index>", into buf,
+// which must hold 32 bytes.
+void
+shard_unit_id(const struct shard_job *job, uint32_t index, char *buf);
+
+// Sets r to an empty result for the job.
+void
+shard_result_init(const struct shard_job *job, struct shard_result *r);
+
+// Runs one unit on nthreads threads (0 = one per CPU) and adds it
+// to r.  Returns 0, or -1 if the unit is out of range, already in
+// r, or the run failed.
+int
+shard_run(const struct shard_job *job, uint32_t index, int nthreads,
+          struct shard_result *r);
+
+// Adds from into into.  Returns 0, or -1 if the two are results of
+// different jobs or share a unit.
+int
+shard_merge(struct shard_result *into, const struct shard_result *from);
+
+// Number of units not in r; their indexes go to missing[] if it
+// is not NULL.
+uint32_t
+shard_missing(const struct shard_result *r, uint32_t *missing);
+
+// Writes r to path (through a temporary file and a rename, so a
+// node that dies mid-write leaves no partial result), or reads it
+// back.  Return 0, or -1 on an I/O or format error.
+int
+shard_result_save(const struct shard_result *r, const char *path);
+int
+shard_result_load(const char *path, struct shard_result *r);
+
+// Final equity of a complete equity or range result.  Return 0,
+// or -1 if r is of another type or units are missing.
+int
+shard_equity(const struct shard_result *r, struct equity_result *res);
+int
+shard_range(const struct shard_result *r, struct range_result *res);
+
+#endif
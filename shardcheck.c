@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "poker.h"
+#include "equity.h"
+#include "shard.h"
+
+/****************************************************************
+    This code checks that sharded results survive a trip through
+    their files.  For a values job cut into the most units a job
+    may have, and for an equity and a range job, it runs the units
+    in two interleaved halves, so that each half is as fragmented
+    as a result can be.  Each half is saved, loaded back and
+    compared with the result in memory, byte for byte; the halves
+    are then merged from the files and must give the numbers of
+    the whole run.
+
+        shardcheck [-d dir]
+
+    The result files are written to dir (default ".") and removed
+    afterwards.  It prints one line per job and exits nonzero if
+    any check fails.
+****************************************************************/
+
+static const char *const jobs[3] =
+{
+    "type values\ncards 5\nunits 65536\n",
+    "type equity\nhand AcKd\nhand QsQh\nboard 2c7d9h\nunits 990\n",
+    "type range\nrange QQ+\nrange AKs\nboard 2c7d9hTs\nunits 44\n",
+};
+
+static const char *const type_str[3] = { "equity", "range", "values" };
+
+static struct shard_job job;
+static struct shard_result half[2], back[2];
+
+// Saves r, reads it into out and checks that nothing changed.
+static int
+round_trip(const struct shard_result *r, const char *path,
+           struct shard_result *out)
+{
+    if (shard_result_save(r, path) < 0) {
+        perror(path);
+        return -1;
+    }
+    if (shard_result_load(path, out) < 0) {
+        fprintf(stderr, "%s: cannot be read back\n", path);
+        return -1;
+    }
+    if (memcmp(r, out, sizeof(*r))) {
+        fprintf(stderr, "%s: reads back different\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+check_job(const char *text, const char *dir)
+{
+    char path[2][4096];
+    int failed = 0;
+
+    if (shard_job_parse(text, &job)) {
+        fprintf(stderr, "bad job:\n%s", text);
+        return 1;
+    }
+
+    // Unit i goes to half i % 2, so every run of units in either
+    // half is a single unit long.
+    for (int h = 0; h < 2; h++)
+    {
+        snprintf(path[h], sizeof(path[h]), "%s/shardcheck-%d.res", dir, h);
+        shard_result_init(&job, &half[h]);
+    }
+    for (uint32_t u = 0; u < job.nunits; u++)
+        if (shard_run(&job, u, 1, &half[u % 2]) < 0) {
+            fprintf(stderr, "unit %u failed\n", u);
+            return 1;
+        }
+
+    for (int h = 0; h < 2; h++)
+        failed |= round_trip(&half[h], path[h], &back[h]) < 0;
+    if (!failed)
+        failed |= shard_merge(&back[0], &back[1]) < 0 ||
+                  shard_missing(&back[0], NULL) != 0;
+
+    // The merged files against the whole job run at once.
+    if (!failed && job.type == SHARD_EQUITY)
+    {
+        struct equity_query q = { .nplayers = job.nplayers, .nboard = job.nboard,
+                                  .nthreads = 1 };
+        struct equity_result want, got;
+
+        memcpy(q.hole, job.hole, sizeof(q.hole));
+        memcpy(q.board, job.board, sizeof(q.board));
+        failed |= equity_calc(&q, &want) < 0 || shard_equity(&back[0], &got) < 0 ||
+                  got.boards != want.boards;
+        for (int p = 0; !failed && p < job.nplayers; p++)
+            failed |= got.wins[p] != want.wins[p] || got.ties[p] != want.ties[p] ||
+                      got.equity[p] != want.equity[p];
+    }
+    else if (!failed && job.type == SHARD_VALUES)
+    {
+        uint64_t hands = 0;
+
+        for (int v = 1; v <= 7462; v++)
+            hands += back[0].freq[v];
+        failed |= hands != job.total;
+    }
+    else if (!failed)
+    {
+        struct range_result res;
+
+        failed |= shard_range(&back[0], &res) < 0 || !res.boards;
+    }
+
+    printf("%-6s job, %5u units: %s\n", type_str[job.type], job.nunits,
+           failed ? "FAILED" : "ok");
+    for (int h = 0; h < 2; h++)
+        remove(path[h]);
+    return failed;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *dir = ".";
+    int failed = 0;
+
+    if (argc == 3 && !strcmp(argv[1], "-d"))
+        dir = argv[2];
+    else if (argc != 1) {
+        fprintf(stderr, "usage: shardcheck [-d dir]\n");
+        return 1;
+    }
+
+    for (int i = 0; i < 3; i++)
+        failed |= check_job(jobs[i], dir);
+    return failed;
+}
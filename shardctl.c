@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "poker.h"
+#include "shard.h"
+
+/****************************************************************
+    This code is a minimal front end for sharded runs (see
+    shard.h).  A coordinator can drive it from a shell:
+
+        shardctl plan job.txt
+            prints the job id and every unit's id and ranks
+        shardctl run [--threads n] [-d dir] job.txt unit...
+            runs units, one result file <unit id>.res each,
+            skipping units whose file already exists
+        shardctl merge job.txt out.res in.res...
+            merges results, lists the units still missing and,
+            once none are, prints the final numbers
+
+    A failed node only loses the units it had not written yet:
+    merge what is there and re-run the units merge lists.
+****************************************************************/
+
+static struct shard_job job;
+static struct shard_result total, part;
+
+static int
+load_job(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char *text = NULL;
+    long size;
+    int rc;
+
+    if (!fp || fseek(fp, 0, SEEK_END) || (size = ftell(fp)) < 0 ||
+        fseek(fp, 0, SEEK_SET) || !(text = malloc(size + 1)) ||
+        fread(text, 1, size, fp) != (size_t)size)
+    {
+        perror(path);
+        free(text);
+        if (fp)
+            fclose(fp);
+        return -1;
+    }
+    text[size] = '\0';
+    fclose(fp);
+
+    rc = shard_job_parse(text, &job);
+    free(text);
+    if (rc > 0)
+        fprintf(stderr, "%s:%d: bad line\n", path, rc);
+    else if (rc < 0)
+        fprintf(stderr, "%s: inconsistent job\n", path);
+    return rc ? -1 : 0;
+}
+
+static void
+print_final(void)
+{
+    if (job.type == SHARD_EQUITY)
+    {
+        struct equity_result res;
+        shard_equity(&total, &res);
+        printf("boards %llu\n", (unsigned long long)res.boards);
+        for (int p = 0; p < job.nplayers; p++)
+            printf("hand %d: equity %.6f  wins %llu  ties %llu\n", p + 1,
+                   res.equity[p], (unsigned long long)res.wins[p],
+                   (unsigned long long)res.ties[p]);
+    }
+    else if (job.type == SHARD_RANGE)
+    {
+        struct range_result res;
+        if (shard_range(&total, &res) < 0) {
+            printf("no pair of combos can meet\n");
+            return;
+        }
+        printf("boards %llu\n", (unsigned long long)res.boards);
+        printf("range 1: equity %.6f  win %.6f\nrange 2: equity %.6f  win %.6f\n"
+               "tie %.6f\n", res.equity[0], res.win[0], res.equity[1], res.win[1],
+               res.tie);
+    }
+    else
+    {
+        unsigned long freq[10] = { 0 };
+        for (int v = 1; v <= 7462; v++)
+            freq[hand_rank(v)] += total.freq[v];
+        for (int i = 1; i <= 9; i++)
+            printf("%15s: %10lu\n", value_str[i], freq[i]);
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    int nthreads = 0, i = 2;
+    const char *dir = ".";
+    char id[32], path[4096];
+
+    if (argc < 3)
+        goto usage;
+
+    if (!strcmp(argv[1], "plan"))
+    {
+        if (load_job(argv[2]) < 0)
+            return 1;
+        printf("job %016llx: %llu %s in %u units\n", (unsigned long long)job.id,
+               (unsigned long long)job.total,
+               job.type == SHARD_VALUES ? "hands" : "boards", job.nunits);
+        for (uint32_t u = 0; u < job.nunits; u++)
+        {
+            uint64_t first, count;
+            shard_unit(&job, u, &first, &count);
+            shard_unit_id(&job, u, id);
+            printf("%s %llu %llu\n", id, (unsigned long long)first,
+                   (unsigned long long)count);
+        }
+        return 0;
+    }
+
+    if (!strcmp(argv[1], "run"))
+    {
+        for (; i < argc && argv[i][0] == '-'; i++)
+        {
+            if (!strcmp(argv[i], "--threads") && i+1 < argc)
+                nthreads = atoi(argv[++i]);
+            else if (!strcmp(argv[i], "-d") && i+1 < argc)
+                dir = argv[++i];
+            else
+                goto usage;
+        }
+        if (i >= argc || load_job(argv[i++]) < 0)
+            return 1;
+        for (; i < argc; i++)
+        {
+            char *end;
+            unsigned long u = strtoul(argv[i], &end, 10);
+
+            if (end == argv[i] || *end || u >= job.nunits) {
+                fprintf(stderr, "%s: no such unit\n", argv[i]);
+                return 1;
+            }
+            shard_unit_id(&job, u, id);
+            snprintf(path, sizeof(path), "%s/%s.res", dir, id);
+            if (access(path, F_OK) == 0)
+                continue;
+            shard_result_init(&job, &part);
+            if (shard_run(&job, u, nthreads, &part) < 0 ||
+                shard_result_save(&part, path) < 0) {
+                fprintf(stderr, "%s: unit failed\n", id);
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    if (!strcmp(argv[1], "merge") && argc >= 4)
+    {
+        static uint32_t missing[SHARD_MAX_UNITS];
+        uint32_t n;
+
+        if (load_job(argv[2]) < 0)
+            return 1;
+        shard_result_init(&job, &total);
+        for (i = 4; i < argc; i++)
+            if (shard_result_load(argv[i], &part) < 0 ||
+                shard_merge(&total, &part) < 0) {
+                fprintf(stderr, "%s: not a result of this job, or overlaps\n", argv[i]);
+                return 1;
+            }
+        if (shard_result_save(&total, argv[3]) < 0) {
+            perror(argv[3]);
+            return 1;
+        }
+
+        n = shard_missing(&total, missing);
+        if (n)
+        {
+            printf("%u of %u units missing:", n, job.nunits);
+            for (uint32_t k = 0; k < n; k++)
+                printf(" %u", missing[k]);
+            printf("\n");
+            return 2;
+        }
+        print_final();
+        return 0;
+    }
+
+usage:
+    fprintf(stderr, "usage: %s plan job\n"
+                    "       %s run [--threads n] [-d dir] job unit...\n"
+                    "       %s merge job out in...\n", argv[0], argv[0], argv[0]);
+    return 1;
+}
@@ -0,0 +1,49 @@
+#include <stdlib.h>
+#include "cards.h"
+#include "sim.h"
+
+// The struct and out[] share one allocation; out[] starts on the
+// cache line after the struct.
+struct sim *
+sim_create(size_t nout, uint64_t seed)
+{
+    size_t size = sizeof(struct sim) + nout * sizeof(unsigned short);
+    struct sim *s = aligned_alloc(64, (size + 63) & ~(size_t)63);
+
+    if (!s)
+        return NULL;
+    s->nout = nout;
+    s->out = (unsigned short *)(s + 1);
+    sim_reset(s, 0, seed);
+    return s;
+}
+
+void
+sim_destroy(struct sim *s)
+{
+    free(s);
+}
+
+void
+sim_reset(struct sim *s, uint64_t dead, uint64_t seed)
+{
+    rng_seed(&s->rng, seed);
+    s->dead = dead & ((1ull << 52) - 1);
+    s->nlive = 0;
+    for (int i = 0; i < 52; i++)
+        if (!(s->dead >> i & 1))
+            s->live[s->nlive++] = index_card(i);
+}
+
+int
+sim_kill(struct sim *s, int card)
+{
+    for (int i = 0; i < s->nlive; i++)
+        if (s->live[i] == card)
+        {
+            s->live[i] = s->live[--s->nlive];
+            s->dead |= 1ull << card_index(card);
+            return 0;
+        }
+    return -1;
+}
@@ -0,0 +1,64 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "poker.h"
+
+//
+//   Simulation context.
+//
+//   A Monte Carlo trial needs a deck without the known cards, a
+//   random number generator and somewhere to put its results.  A
+//   struct sim holds all three in one 64-byte aligned allocation,
+//   made once per thread.  The deck is kept as the array of live
+//   cards: each deal moves the cards it picks to the front with
+//   a partial shuffle, and the array stays a permutation of the
+//   same cards, so the next trial deals from it as it is.  A trial
+//   touches the k cards it deals and nothing else; no deck is
+//   rebuilt, copied or allocated.
+//
+//   Known cards are given as a card mask (see cards.h).  sim_reset()
+//   starts a new situation in place, and sim_kill() takes out one
+//   more card, e.g. a hole card dealt from a range.
+//
+
+struct sim
+{
+    struct rng_state rng;
+    uint64_t dead;              // card mask of the cards out of the deck
+    int nlive;                  // cards left in live[]
+    int live[52];               // in dealing order after each deal
+    size_t nout;                // entries in out[]
+    unsigned short *out;        // per-trial results, after the struct
+} __attribute__((aligned(64)));
+
+// Creates a context with a full deck, the given seed and room for
+// nout results.  Returns NULL if memory runs out.
+struct sim *
+sim_create(size_t nout, uint64_t seed);
+
+void
+sim_destroy(struct sim *s);
+
+// Refills the deck with every card not in dead and reseeds the
+// generator, without allocating.  out[] is left as it is.
+void
+sim_reset(struct sim *s, uint64_t dead, uint64_t seed);
+
+// Takes one card out of the deck.  Returns 0, or -1 if the card
+// was not in it.
+int
+sim_kill(struct sim *s, int card);
+
+// Deals k random cards (k at most nlive) and returns them, in
+// live[0..k-1].  They stay valid until the next deal, kill or
+// reset.
+static inline const int *
+sim_deal(struct sim *s, int k)
+{
+    shuffle_partial(s->live, s->nlive, k, &s->rng);
+    return s->live;
+}
+
+#endif
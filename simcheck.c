@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "poker.h"
+#include "cards.h"
+#include "sim.h"
+
+/****************************************************************
+    This code checks the simulation context (see sim.h).  It
+    resets a context to a set of dead cards, kills more cards one
+    at a time, and checks the live count and that a card can only
+    be killed once.  It then deals many times, k cards at a time
+    for every k, and checks that no deal holds a dead or repeated
+    card, that every live card turns up, and that the deck stays
+    exactly the live cards.
+
+        simcheck [-n deals]
+
+    It prints one line per check and exits nonzero if any fails.
+****************************************************************/
+
+#define FULL_DECK   ((1ull << 52) - 1)
+
+static int
+check(const char *what, int ok)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAILED");
+    return !ok;
+}
+
+// The live cards must be exactly the cards not in s->dead.
+static int
+deck_intact(const struct sim *s)
+{
+    uint64_t m = hand_mask(s->live, s->nlive);
+
+    return s->nlive == 52 - __builtin_popcountll(s->dead) &&
+           __builtin_popcountll(m) == s->nlive && m == (FULL_DECK & ~s->dead);
+}
+
+int
+main(int argc, char *argv[])
+{
+    long deals = 100000;
+    int failed = 0, usage = 0, ok;
+    struct sim *s;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-n") && i+1 < argc)
+            deals = atol(argv[++i]);
+        else
+            usage = 1;
+    }
+    if (usage || deals < 1) {
+        fprintf(stderr, "usage: simcheck [-n deals]\n");
+        return 1;
+    }
+
+    if (!(s = sim_create(1000, 17))) {
+        fprintf(stderr, "sim_create failed\n");
+        return 1;
+    }
+    failed |= check("sim_create: full deck, room for results",
+                    s->nlive == 52 && !s->dead && s->nout == 1000 &&
+                    deck_intact(s));
+
+    // Five dead cards, then two hole cards killed one by one.
+    uint64_t dead = 0;
+    for (int i = 0; i < 5; i++)
+        dead |= 1ull << (i * 11);
+    sim_reset(s, dead, 18);
+    failed |= check("sim_reset: 47 live cards", s->nlive == 47 && deck_intact(s));
+
+    int hole[2] = { index_card(1), index_card(30) };
+    ok = sim_kill(s, hole[0]) == 0 && s->nlive == 46 &&
+         sim_kill(s, hole[1]) == 0 && s->nlive == 45 && deck_intact(s);
+    failed |= check("sim_kill: each kill takes one card", ok);
+    ok = sim_kill(s, hole[0]) == -1 && sim_kill(s, index_card(11)) == -1 &&
+         s->nlive == 45 && deck_intact(s);
+    failed |= check("sim_kill: a dead card cannot be killed again", ok);
+
+    // Deals of every size, each checked against the dead cards and
+    // itself; seen collects the cards dealt at all.
+    uint64_t seen = 0;
+    long bad = 0;
+    for (long t = 0; t < deals; t++)
+    {
+        int k = 1 + t % s->nlive;
+        const int *c = sim_deal(s, k);
+        uint64_t m = hand_mask(c, k);
+
+        if (__builtin_popcountll(m) != k || (m & s->dead) || (m & ~FULL_DECK))
+            bad++;
+        seen |= m;
+    }
+    failed |= check("sim_deal: no dead or repeated cards", !bad);
+    failed |= check("sim_deal: every live card dealt",
+                    seen == (FULL_DECK & ~s->dead));
+    failed |= check("sim_deal: the deck stays the live cards", deck_intact(s));
+
+    sim_destroy(s);
+    return failed;
+}
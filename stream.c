@@ -0,0 +1,179 @@
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "poker.h"
+#include "cards.h"
+#include "stream.h"
+
+// Each chunk is decoded into a small per-thread buffer.  Five-card
+// chunks are handed to eval_5hand_batch(), the SIMD path, in one
+// call.  There is no batch evaluator for six or seven cards, so
+// those hands go through the scalar eval_mask() one at a time, on
+// the card mask built straight from the indexes.
+
+#define CHUNK       4096            // hands per claim
+#define MAX_THREADS 256
+
+_Static_assert(sizeof(struct stream_header) == STREAM_HEADER_SIZE,
+               "stream header layout");
+
+struct job
+{
+    const uint8_t *hands;
+    int ncards;
+    uint64_t count;
+    unsigned short *out;
+    uint64_t next;                  // next chunk to claim
+};
+
+// Card mask of one hand, or 0 if a card is bad or repeated.
+static uint64_t
+decode_mask(const uint8_t *idx, int n)
+{
+    uint64_t m = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        if (idx[i] >= 52 || (m >> idx[i] & 1))
+            return 0;
+        m |= 1ull << idx[i];
+    }
+    return m;
+}
+
+static void
+eval_chunk(const struct job *job, uint64_t first, uint64_t n)
+{
+    const uint8_t *h = job->hands + first * job->ncards;
+    unsigned short *out = job->out + first;
+
+    if (n == 0)
+        return;
+    if (job->ncards == 5)
+    {
+        int cards[CHUNK * 5];
+        unsigned char ok[CHUNK];
+
+        for (uint64_t i = 0; i < n; i++, h += 5)
+        {
+            ok[i] = decode_mask(h, 5) != 0;
+            for (int j = 0; j < 5; j++)
+                cards[5*i + j] = ok[i] ? index_cards[h[j]] : index_cards[j];
+        }
+        eval_5hand_batch(cards, n, out);
+        for (uint64_t i = 0; i < n; i++)
+            if (!ok[i])
+                out[i] = 0;
+        return;
+    }
+
+    for (uint64_t i = 0; i < n; i++, h += job->ncards)
+    {
+        uint64_t m = decode_mask(h, job->ncards);
+        out[i] = m ? eval_mask(m) : 0;
+    }
+}
+
+static void *
+work(void *p)
+{
+    struct job *job = p;
+    uint64_t nchunks = (job->count + CHUNK - 1) / CHUNK, c;
+
+    while ((c = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < nchunks)
+    {
+        uint64_t first = c * CHUNK, n = job->count - first;
+        eval_chunk(job, first, n < CHUNK ? n : CHUNK);
+    }
+    return NULL;
+}
+
+int
+stream_eval(const uint8_t *hands, int ncards, uint64_t count,
+            unsigned short *out, int nthreads)
+{
+    struct job job = { hands, ncards, count, out, 0 };
+    pthread_t tids[MAX_THREADS];
+    int started[MAX_THREADS];
+
+    if (ncards < 5 || ncards > 7)
+        return -1;
+    if (nthreads <= 0)
+        nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads < 1)
+        nthreads = 1;
+    if (nthreads > MAX_THREADS)
+        nthreads = MAX_THREADS;
+
+    // The calling thread works too; a thread that cannot be
+    // started just leaves its chunks to the others.
+    for (int i = 1; i < nthreads; i++)
+        started[i] = !pthread_create(&tids[i], NULL, work, &job);
+    work(&job);
+    for (int i = 1; i < nthreads; i++)
+        if (started[i])
+            pthread_join(tids[i], NULL);
+    return 0;
+}
+
+int
+stream_eval_file(const char *in_path, const char *out_path, int nthreads)
+{
+    struct stream_header h;
+    struct stat st;
+    int in = open(in_path, O_RDONLY), out = -1, rc = -1;
+    void *src = MAP_FAILED, *dst = MAP_FAILED;
+    size_t in_size = 0, out_size = 0;
+
+    if (in < 0)
+        return -1;
+    if (fstat(in, &st) < 0 || pread(in, &h, sizeof(h), 0) != sizeof(h) ||
+        memcmp(h.magic, STREAM_MAGIC, 8) || h.version != STREAM_VERSION ||
+        h.ncards < 5 || h.ncards > 7 || st.st_size < STREAM_HEADER_SIZE)
+        goto done;
+
+    // Bound the count by the file before multiplying, so that a
+    // crafted header cannot wrap the size check.
+    uint64_t payload = (uint64_t)st.st_size - STREAM_HEADER_SIZE;
+    if (h.count > payload / h.ncards || h.count * h.ncards != payload)
+        goto done;
+
+    in_size = st.st_size;
+    out_size = h.count * sizeof(unsigned short);
+    src = mmap(NULL, in_size, PROT_READ, MAP_SHARED, in, 0);
+    if (src == MAP_FAILED)
+        goto done;
+    madvise(src, in_size, MADV_SEQUENTIAL);
+
+    // Truncating the input under its mapping would fault the
+    // readers, so the output is only sized once it is known to be
+    // another file.  Every value is written, so nothing old is left.
+    struct stat ost;
+    out = open(out_path, O_RDWR | O_CREAT, 0644);
+    if (out < 0 || fstat(out, &ost) < 0 ||
+        (ost.st_dev == st.st_dev && ost.st_ino == st.st_ino) ||
+        ftruncate(out, out_size) < 0)
+        goto done;
+    if (out_size)
+    {
+        dst = mmap(NULL, out_size, PROT_READ | PROT_WRITE, MAP_SHARED, out, 0);
+        if (dst == MAP_FAILED)
+            goto done;
+    }
+
+    rc = stream_eval((const uint8_t *)src + STREAM_HEADER_SIZE, h.ncards,
+                     h.count, dst == MAP_FAILED ? NULL : dst, nthreads);
+
+done:
+    if (dst != MAP_FAILED)
+        munmap(dst, out_size);
+    if (src != MAP_FAILED)
+        munmap(src, in_size);
+    if (out >= 0 && close(out) < 0)
+        rc = -1;
+    close(in);
+    return rc;
+}
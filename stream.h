@@ -0,0 +1,58 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdint.h>
+
+//
+//   Streaming evaluation of hand files.
+//
+//   A hand file holds fixed-size records of card indexes (see
+//   cards.h), one byte per card:
+//
+//       offset  size  field
+//            0     8  magic, "PKHANDS1"
+//            8     4  format version, 1
+//           12     4  cards per hand, 5 to 7
+//           16     8  number of hands
+//           24     8  zero
+//           32   ...  hands, cards-per-hand bytes each
+//
+//   Multi-byte fields are little-endian.  stream_eval_file() maps
+//   the file, evaluates every hand on a pool of threads and writes
+//   one 16-bit value per hand, in file order, to a plain array file
+//   (0 marks a hand with a bad or repeated card).  Threads claim
+//   fixed chunks of hands and write their values straight into the
+//   mapped output at the chunk's own offset, so the order holds
+//   without any reordering step and nothing is copied on the way.
+//
+//   Five-card files are evaluated with eval_5hand_batch(), which uses
+//   AVX2/AVX-512 where the CPU has them.  Six- and seven-card files
+//   go through the scalar eval_mask() path, one hand at a time.
+//
+
+#define STREAM_MAGIC        "PKHANDS1"
+#define STREAM_VERSION      1
+#define STREAM_HEADER_SIZE  32
+
+struct stream_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t ncards;
+    uint64_t count;
+    uint64_t reserved;
+};
+
+// Evaluates count hands of ncards card indexes each, writing
+// out[i] for hand i.  Returns 0, or -1 if ncards is not 5 to 7.
+int
+stream_eval(const uint8_t *hands, int ncards, uint64_t count,
+            unsigned short *out, int nthreads);
+
+// Evaluates a hand file into a value file.  Returns 0, or -1 if
+// the input is not a valid hand file, the output is the input
+// file itself or either file cannot be mapped.
+int
+stream_eval_file(const char *in_path, const char *out_path, int nthreads);
+
+#endif
@@ -0,0 +1,108 @@
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "enumerate.h"
+#include "table7.h"
+
+_Static_assert(sizeof(struct table7_header) == TABLE7_HEADER_SIZE,
+               "table7 header layout");
+
+// colex7[i][p] is the colex term C(p, i+1) of a card at position p
+// when it is the i-th lowest of the seven.
+static uint32_t colex7[7][52];
+static pthread_once_t colex7_once = PTHREAD_ONCE_INIT;
+
+static void
+init_colex7(void)
+{
+    for (int i = 0; i < 7; i++)
+        for (int p = 0; p < 52; p++)
+            colex7[i][p] = (uint32_t)n_choose_k(p, i+1);
+}
+
+uint32_t
+table7_index(const int *hand)
+{
+    uint64_t mask = 0;
+    uint32_t r = 0;
+
+    pthread_once(&colex7_once, init_colex7);
+
+    // Setting one bit per position sorts the cards for free.
+    for (int i = 0; i < 7; i++)
+    {
+        int c = hand[i];
+        int p = (3 - __builtin_ctz((c >> 12) & 0xF)) * 13 + ((c >> 8) & 0xF) - 2;
+        mask |= 1ull << p;
+    }
+    for (int i = 0; i < 7; i++)
+    {
+        r += colex7[i][__builtin_ctzll(mask)];
+        mask &= mask - 1;
+    }
+    return r;
+}
+
+unsigned short
+table7_eval(const struct table7 *t, const int *hand)
+{
+    return t->values[table7_index(hand)];
+}
+
+uint64_t
+table7_hash(const unsigned short *values, size_t n)
+{
+    const unsigned char *b = (const unsigned char *)values;
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    for (size_t i = 0; i < n * sizeof(*values); i++)
+    {
+        h ^= b[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+int
+table7_open(struct table7 *t, const char *path)
+{
+    struct table7_header h;
+    struct stat st;
+    size_t size = TABLE7_HEADER_SIZE + (size_t)TABLE7_ENTRIES * 2;
+    int fd = open(path, O_RDONLY);
+
+    memset(t, 0, sizeof(*t));
+    if (fd < 0)
+        return -1;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size != size ||
+        pread(fd, &h, sizeof(h), 0) != sizeof(h) ||
+        memcmp(h.magic, TABLE7_MAGIC, 8) || h.version != TABLE7_VERSION ||
+        h.header_size != TABLE7_HEADER_SIZE || h.entries != TABLE7_ENTRIES ||
+        h.entry_size != 2 || h.card_order != 0 ||
+        h.byte_order != TABLE7_BYTE_ORDER)
+    {
+        close(fd);
+        return -1;
+    }
+
+    void *map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return -1;
+
+    t->map = map;
+    t->size = size;
+    t->values = (const unsigned short *)((const char *)map + TABLE7_HEADER_SIZE);
+    return 0;
+}
+
+void
+table7_close(struct table7 *t)
+{
+    if (t->map)
+        munmap((void *)t->map, t->size);
+    memset(t, 0, sizeof(*t));
+}
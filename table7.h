@@ -0,0 +1,87 @@
+#ifndef TABLE7_H
+#define TABLE7_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//
+//   Dense seven-card value table.
+//
+//   mktable7 writes the value of every one of the 133,784,560
+//   seven-card hands to a file, and table7_open() maps that file
+//   read-only, so evaluating a hand is one index computation and
+//   one load.  The mapping is shared, so every process on a host
+//   that opens the same file reads the same page-cache copy.
+//
+//   File format, version 2.  All fields, entries included, are in
+//   the byte order of the host that wrote the file, since the
+//   entries are used in place from the mapping.  The byte order
+//   marker lets table7_open() refuse a file from a host of the
+//   other order instead of returning wrong values.
+//
+//       offset  size  field
+//            0     8  magic, "PKTABLE7"
+//            8     4  format version, 2
+//           12     4  header size in bytes, 64
+//           16     8  number of entries, 133784560
+//           24     4  bytes per entry, 2
+//           28     4  card order, 0 = init_deck() order
+//           32     8  FNV-1a (64-bit) hash of the entry bytes
+//           40     4  byte order marker, 0x01020304
+//           44    20  zero
+//           64   ...  entries
+//
+//   Entry i is the value (1..7462, as eval_7hand) of the hand whose
+//   sorted card positions have colex rank i (see enumerate.h).  A
+//   card's position is its index in the init_deck() order: clubs
+//   Deuce..Ace are 0..12, then diamonds, hearts and spades.
+//
+
+#define TABLE7_MAGIC        "PKTABLE7"
+#define TABLE7_VERSION      2
+#define TABLE7_BYTE_ORDER   0x01020304
+#define TABLE7_HEADER_SIZE  64
+#define TABLE7_ENTRIES      133784560
+
+struct table7_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t entries;
+    uint32_t entry_size;
+    uint32_t card_order;
+    uint64_t hash;
+    uint32_t byte_order;
+    uint8_t reserved[20];
+};
+
+struct table7
+{
+    const unsigned short *values;   // TABLE7_ENTRIES values
+    const void *map;                // the whole file
+    size_t size;
+};
+
+// Maps a table file.  Returns 0 on success, or -1 if the file
+// cannot be mapped or its header does not match this version.
+// The entries are not hashed here; mktable7 -c does that.
+int
+table7_open(struct table7 *t, const char *path);
+
+void
+table7_close(struct table7 *t);
+
+// Table index of a seven-card hand, in any order.
+uint32_t
+table7_index(const int *hand);
+
+// Value of a seven-card hand, from the table.
+unsigned short
+table7_eval(const struct table7 *t, const int *hand);
+
+// FNV-1a (64-bit) hash of n entries, as stored in the header.
+uint64_t
+table7_hash(const unsigned short *values, size_t n);
+
+#endif
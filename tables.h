@@ -0,0 +1,11372 @@
+/*
+** Derived lookup tables.  This file is generated by
+** mktables.c ("make tables"); do not edit it by hand.
+*/
+
+/*
+** 5^(rank-2), indexed by the rank nibble of a card.  The sum
+** over a hand gives its rank counts in base five.
+*/
+const unsigned quinary[16] =
+{
+    0, 0, 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 0
+};
+
+/*
+** Per-suit counter increment, indexed by the cdhs nibble of
+** a card.  Summed over a hand, each 4-bit field counts the
+** cards of one suit (clubs lowest, spades highest).
+*/
+const unsigned short suit_count[16] =
+{
+    0, 0x1000, 0x0100, 0, 0x0010, 0, 0, 0,
+    0x0001, 0, 0, 0, 0, 0, 0, 0
+};
+
+/*
+** Perfect hash for all 7462 five-card hands, keyed on the
+** prime product of the cards with bit 27 set for flushes.
+** See find_fast5() in pokereval.h.
+*/
+const unsigned short hash5_adjust[] =
+{
+    5, 6, 0, 3, 2, 7, 0, 0, 0, 15, 0, 0, 0, 1, 3, 0,
+    0, 4, 4, 10, 2, 0, 7, 1, 1, 1, 0, 2, 0, 6, 2, 0,
+    11, 2, 9, 1, 1, 5, 0, 8, 7, 2, 1, 8, 0, 0, 1, 4,
+    1, 1, 2, 0, 0, 5, 0, 1, 26, 1, 0, 0, 5, 2, 1, 27,
+    3, 0, 0, 17, 0, 0, 1, 3, 2, 8, 3, 0, 32, 1, 0, 0,
+    0, 0, 0, 1, 3, 0, 3, 12, 48, 0, 33, 3, 0, 18, 3, 2,
+    0, 0, 0, 0, 0, 0, 6, 1, 0, 0, 1, 1, 1, 0, 3, 8,
+    0, 1, 7, 5, 0, 0, 0, 4, 0, 1, 16, 11, 0, 0, 1, 3,
+    6, 0, 0, 35, 0, 0, 1, 5, 0, 0, 1, 0, 23, 6, 6, 0,
+    0, 5, 9, 0, 0, 20, 0, 0, 0, 0, 4, 1, 2, 2, 1, 0,
+    7, 0, 2, 10, 0, 0, 5, 0, 10, 9, 11, 3, 3, 5, 0, 0,
+    0, 1, 2, 2, 0, 0, 1, 4, 1, 2, 2, 1, 0, 4, 0, 0,
+    0, 0, 5, 20, 5, 5, 5, 0, 0, 4, 5, 0, 0, 4, 0, 1,
+    0, 0, 0, 3, 10, 2, 0, 0, 0, 1, 0, 0, 3, 1, 0, 2,
+    8, 0, 0, 22, 0, 0, 0, 10, 0, 0, 25, 6, 0, 5, 1, 2,
+    8, 0, 0, 0, 0, 5, 5, 0, 0, 5, 2, 0, 2, 0, 0, 6,
+    2, 3, 6, 8, 4, 5, 0, 0, 3, 1, 24, 4, 9, 1, 3, 0,
+    20, 4, 0, 101, 0, 4, 0, 1, 68, 14, 0, 0, 3, 2, 12, 1,
+    5, 1, 3, 1, 0, 4, 5, 8, 3, 0, 6, 8, 0, 0, 10, 1,
+    22, 3, 7, 7, 0, 0, 3, 1, 1, 0, 0, 6, 0, 3, 12, 0,
+    6, 3, 2, 0, 4, 5, 4, 0, 1, 3, 2, 16, 2, 2, 4, 11,
+    0, 40, 0, 0, 9, 4, 1, 0, 0, 105, 10, 0, 0, 0, 5, 0,
+    0, 7, 3, 2, 4, 1, 0, 0, 8, 1, 0, 9, 0, 4, 1, 0,
+    0, 5, 0, 3, 0, 4, 1, 0, 10, 1, 12, 2, 0, 16, 0, 0,
+    0, 0, 1, 0, 8, 0, 1, 3, 2, 4, 0, 0, 4, 13, 0, 0,
+    0, 0, 0, 0, 1, 5, 0, 1, 3, 10, 0, 0, 2, 0, 10, 2,
+    1, 0, 0, 11, 9, 0, 0, 4, 16, 0, 4, 0, 0, 4, 0, 0,
+    14, 0, 0, 1, 1, 1, 4, 16, 0, 2, 6, 1, 0, 3, 31, 1,
+    10, 0, 1, 0, 1, 2, 0, 0, 2, 11, 0, 2, 1, 0, 3, 0,
+    0, 0, 0, 1, 8, 10, 16, 0, 0, 2, 8, 5, 0, 0, 0, 0,
+    7, 75, 1, 11, 17, 1, 0, 0, 2, 4, 1, 0, 41, 3, 8, 0,
+    3, 0, 0, 2, 2, 8, 9, 0, 0, 0, 1, 0, 1, 3, 14, 4,
+    0, 17, 0, 21, 1, 2, 1, 0, 1, 2, 0, 0, 0, 4, 17, 6,
+    4, 0, 1, 21, 3, 2, 0, 3, 5, 18, 5, 7, 6, 0, 3, 0,
+    0, 8, 0, 0, 2, 4, 2, 8, 0, 4, 0, 3, 2, 0, 5, 32,
+    56, 1, 1, 2, 0, 0, 35, 0, 1, 2, 0, 3, 66, 2, 0, 15,
+    70, 0, 16, 2, 10, 0, 0, 0, 0, 6, 2, 2, 3, 0, 8, 25,
+    3, 0, 0, 0, 0, 0, 5, 11, 12, 0, 0, 0, 2, 6, 16, 0,
+    1, 4, 0, 5, 0, 3, 4, 2, 8, 3, 0, 0, 1, 0, 4, 5,
+    23, 1, 0, 0, 22, 4, 7, 1, 1, 19, 3, 0, 0, 0, 9, 0,
+    9, 1, 0, 0, 0, 0, 0, 0, 0, 3, 8, 0, 0, 2, 1, 0,
+    0, 34, 0, 1, 0, 1, 0, 1, 1, 3, 1, 0, 0, 10, 3, 9,
+    8, 4, 0, 29, 10, 0, 0, 81, 9, 0, 0, 2, 0, 0, 0, 0,
+    4, 4, 0, 2, 1, 28, 2, 10, 0, 99, 0, 5, 0, 0, 0, 0,
+    18, 0, 0, 0, 10, 0, 9, 0, 1, 3, 8, 22, 36, 3, 5, 0,
+    0, 4, 1, 0, 3, 16, 2, 0, 0, 9, 4, 1, 1, 0, 48, 0,
+    3, 0, 0, 0, 1, 7, 0, 1, 11, 0, 3, 1, 7, 30, 10, 1,
+    0, 0, 1, 29, 4, 0, 0, 0, 0, 7, 6, 6, 0, 19, 3, 0,
+    2, 0, 0, 0, 7, 0, 11, 0, 8, 1, 3, 0, 1, 3, 1, 0,
+    0, 1, 8, 1, 0, 5, 6, 1, 0, 11, 0, 11, 1, 10, 0, 5,
+    0, 43, 5, 3, 4, 4, 0, 2, 0, 1, 0, 5, 44, 5, 0, 0,
+    1, 0, 2, 0, 6, 1, 2, 2, 1, 0, 8, 22, 4, 5, 2, 0,
+    5, 4, 0, 0, 3, 5, 0, 2, 0, 8, 2, 0, 1, 15, 5, 0,
+    0, 4, 4, 0, 0, 2, 1, 0, 8, 1, 3, 0, 0, 3, 9, 0,
+    11, 1, 0, 0, 0, 2, 1, 0, 2, 40, 2, 2, 32, 2, 56, 0,
+    16, 1, 29, 0, 7, 0, 0, 0, 0, 2, 3, 6, 2, 0, 0, 0,
+    3, 0, 0, 4, 2, 8, 3, 5, 2, 5, 5, 3, 17, 0, 0, 2,
+    7, 3, 0, 0, 0, 0, 8, 37, 0, 1, 17, 9, 0, 1, 103, 0,
+    1, 1, 0, 5, 0, 0, 7, 0, 0, 0, 9, 5, 3, 3, 3, 7,
+    0, 0, 3, 0, 25, 2, 12, 1, 8, 1, 1, 13, 3, 0, 0, 0,
+    6, 4, 0, 0, 0, 0, 8, 2, 0, 2, 0, 0, 0, 0, 3, 0,
+    0, 1, 1, 4, 0, 3, 1, 19, 12, 0, 0, 0, 0, 64, 88, 0,
+    0, 69, 2, 18, 2, 6, 5, 3, 0, 0, 33, 0, 148, 0, 12, 5,
+    6, 6, 0, 10, 1, 43, 0, 0, 18, 2, 0, 0, 29, 0, 4, 1,
+    12, 23, 0, 0, 5, 0, 2, 2, 0, 0, 16, 2, 3, 2, 0, 18,
+    0, 5, 4, 0, 1, 2, 6, 2, 6, 13, 0, 0, 0, 5, 11, 2,
+    4, 16, 10, 8, 4, 0, 3, 0, 1, 6, 2, 0, 0, 4, 0, 0,
+    1, 0, 4, 26, 0, 0, 4, 20, 2, 2, 0, 0, 0, 1, 0, 0,
+    12, 3, 7, 2, 4, 2, 0, 3, 0, 3, 174, 2, 11, 0, 0, 3,
+    2, 2, 3, 1, 0, 3, 8, 0, 0, 86, 0, 7, 0, 0, 0, 0,
+    1, 0, 0, 2, 1, 0, 0, 9, 3, 16, 0, 33, 29, 0, 0, 4,
+    0, 130, 8, 1, 0, 32, 0, 0, 0, 2, 0, 0, 12, 0, 0, 4,
+    1, 13, 5, 1, 3, 0, 1, 128, 0, 0, 0, 1, 0, 3, 3, 1,
+    0, 2, 9, 12, 0, 22, 13, 5, 1, 8, 9, 2, 0, 5, 0, 5,
+    27, 9, 0, 0, 21, 0, 0, 1, 0, 1, 1, 2, 4, 6, 0, 0,
+    7, 3, 0, 39, 2, 0, 5, 0, 1, 0, 0, 0, 1, 0, 4, 0,
+    3, 15, 9, 0, 35, 32, 10, 73, 8, 0, 0, 4, 5, 8, 3, 144,
+    2, 0, 9, 0, 0, 0, 4, 0, 2, 5, 7, 4, 35, 0, 2, 10,
+    3, 0, 15, 6, 0, 0, 1, 1, 0, 0, 8, 0, 5, 0, 0, 0,
+    0, 1, 0, 0, 2, 21, 1, 1, 5, 0, 17, 6, 1, 2, 1, 0,
+    1, 0, 1, 6, 0, 8, 25, 0, 0, 2, 16, 0, 3, 5, 0, 83,
+    5, 3, 2, 0, 16, 7, 16, 46, 1, 0, 0, 3, 7, 1, 0, 2,
+    16, 4, 9, 3, 1, 8, 2, 14, 0, 18, 0, 8, 0, 0, 11, 12,
+    4, 0, 4, 2, 0, 12, 2, 0, 0, 3, 3, 4, 1, 32, 82, 1,
+    2, 19, 0, 2, 0, 1, 0, 8, 5, 1, 4, 2, 3, 1, 0, 3,
+    11, 1, 1, 8, 2, 32, 0, 6, 8, 24, 0, 0, 7, 8, 0, 0,
+    163, 4, 0, 15, 2, 12, 1, 21, 8, 24, 0, 2, 0, 0, 0, 1,
+    8, 10, 0, 2, 2, 4, 0, 2, 17, 2, 2, 0, 0, 0, 2, 65,
+    1, 0, 2, 42, 0, 1, 1, 1, 0, 0, 0, 20, 0, 2, 0, 0,
+    121, 1, 1, 0, 6, 0, 1, 3, 19, 26, 0, 0, 3, 0, 3, 8,
+    21, 31, 1, 0, 32, 1, 32, 0, 4, 0, 0, 8, 0, 3, 5, 1,
+    2, 0, 6, 0, 14, 0, 8, 12, 1, 1, 0, 42, 5, 2, 3, 19,
+    0, 0, 10, 0, 1, 3, 3, 0, 0, 34, 4, 8, 1, 1, 12, 0,
+    6, 1, 0, 0, 4, 1, 5, 13, 0, 1, 1, 33, 0, 35, 1, 0,
+    14, 0, 0, 4, 7, 15, 38, 0, 0, 0, 1, 0, 65, 2, 0, 3,
+    8, 23, 0, 97, 0, 4, 2, 20, 0, 32, 0, 0, 1, 1, 0, 2,
+    0, 4, 0, 24, 17, 7, 3, 5, 11, 39, 12, 0, 0, 0, 7, 1,
+    1, 55, 11, 0, 0, 1, 0, 2, 2, 1, 0, 0, 0, 5, 0, 8,
+    0, 0, 0, 5, 0, 68, 0, 0, 2, 0, 0, 0, 11, 1, 0, 0,
+    6, 4, 0, 0, 0, 1, 3, 0, 0, 3, 0, 0, 0, 0, 0, 2,
+    1, 9, 3, 1, 0, 18, 4, 5, 30, 1, 0, 0, 17, 1, 0, 2,
+    8, 1, 136, 1, 0, 0, 1, 0, 7, 3, 19, 1, 3, 1, 8, 1,
+    1, 0, 0, 3, 10, 0, 9, 2, 0, 0, 0, 0, 0, 0, 4, 0,
+    4, 16, 34, 4, 0, 10, 5, 16, 0, 0, 2, 0, 11, 2, 7, 7,
+    51, 14, 2, 0, 10, 4, 6, 4, 0, 2, 1, 0, 6, 1, 0, 7,
+    31, 0, 0, 0, 16, 0, 3, 0, 2, 32, 4, 9, 1, 72, 36, 16,
+    160, 1, 3, 6, 0, 1, 0, 3, 6, 17, 4, 0, 0, 21, 6, 0,
+    18, 26, 8, 0, 3, 2, 0, 0, 0, 1, 1, 0, 1, 0, 1, 24,
+    2, 0, 0, 24, 0, 8, 4, 6, 2, 0, 0, 3, 9, 0, 32, 31,
+    1, 6, 6, 1, 1, 0, 0, 0, 3, 0, 0, 0, 1, 3, 0, 0,
+    2, 6, 0, 10, 0, 1, 0, 3, 6, 2, 4, 7, 0, 0, 0, 5,
+    0, 0, 3, 0, 0, 0, 0, 16, 4, 0, 57, 0, 1, 4, 0, 10,
+    64, 0, 0, 3, 0, 0, 0, 4, 0, 29, 0, 4, 3, 0, 0, 72,
+    10, 28, 0, 17, 0, 3, 23, 1, 11, 0, 4, 0, 0, 4, 7, 12,
+    38, 1, 1, 0, 0, 1, 1, 2, 0, 23, 3, 0, 0, 33, 0, 9,
+    0, 3, 4, 0, 6, 51, 12, 16, 3, 0, 2, 0, 0, 4, 0, 5,
+    2, 0, 8, 0, 2, 6, 0, 5, 0, 17, 6, 6, 3, 36, 0, 8,
+    3, 2, 0, 0, 1, 2, 2, 13, 1, 0, 0, 0, 0, 5, 0, 1,
+    13, 5, 17, 2, 2, 0, 4, 1, 2, 4, 16, 0, 0, 2, 1, 24,
+    34, 2, 23, 3, 0, 2, 30, 0, 6, 2, 0, 4, 5, 3, 26, 60,
+    0, 0, 0, 2, 0, 2, 0, 3, 2, 0, 2, 2, 3, 1, 1, 0,
+    162, 11, 18, 0, 14, 9, 1, 0, 75, 0, 0, 0, 0, 0, 19, 2,
+    9, 4, 6, 0, 1, 1, 4, 7, 8, 4, 0, 0, 0, 1, 66, 6,
+    4, 1, 9, 6, 2, 2, 35, 8, 14, 0, 0, 0, 3, 4, 72, 0,
+    5, 6, 121, 0, 2, 5, 0, 67, 0, 72, 8, 8, 18, 3, 0, 4,
+    2, 0, 8, 18, 1, 1, 40, 6, 83, 33, 11, 9, 0, 12, 1, 32,
+    1, 4, 0, 0, 1, 1, 19, 0, 37, 1, 0, 2, 0, 3, 2, 0,
+    3, 4, 32, 23, 2, 11, 0, 0, 0, 0, 2, 0, 10, 32, 0, 5,
+    0, 16, 0, 19, 0, 5, 58, 0, 18, 0, 9, 121, 6, 0, 0, 19,
+    1, 2, 155, 6, 1, 3, 0, 0, 5, 2, 11, 5, 23, 0, 1, 17,
+    0, 2, 0, 0, 4, 4, 0, 11, 0, 6, 0, 0, 15, 1, 1, 2,
+    3, 0, 0, 0, 0, 3, 135, 1, 0, 0, 2, 25, 2, 6, 0, 0,
+    0, 21, 11, 0, 0, 0, 0, 0, 66, 5, 0, 0, 5, 21, 2, 2,
+    2, 3, 11, 1, 3, 0, 24, 0, 10, 4, 0, 10, 0, 0, 10, 3,
+    1, 2, 0, 4, 1, 0, 0, 0, 0, 0, 11, 1, 12, 7, 0, 4,
+    78, 21, 1, 50, 36, 5, 17, 1, 15, 0, 5, 1, 2, 326, 0, 4,
+    0, 34, 0, 6, 16, 2, 1, 5, 5, 5, 0, 66, 0, 0, 25, 1,
+    0, 0, 37, 0, 0, 257, 1, 0, 0, 22, 1, 8, 7, 7, 5, 4,
+    1, 0, 5, 213, 35, 1, 1, 104, 0, 1, 2, 27, 1, 0, 7, 17,
+    0, 16, 1, 1, 0, 50, 4, 3, 0, 22, 1, 1, 164, 6, 4, 26,
+    5, 26, 1, 17, 26, 0, 8, 0, 5, 23, 10, 24, 2, 0, 0, 7,
+    0, 8, 13, 12, 278, 4, 8, 20, 15, 0, 2, 2, 2, 2, 17, 11,
+    67, 13, 0, 1, 8, 26, 2, 2, 0, 14, 0, 0, 0, 52, 0, 0,
+    16, 0, 25, 6, 5, 1, 0, 6, 0, 9, 19, 67, 13, 1, 3, 0,
+    4, 4, 2, 0, 0, 3, 2, 0, 51, 2, 0, 17, 6, 5, 14, 131,
+    69, 0, 8, 7, 4, 7, 7, 2, 0, 129, 20, 1, 0, 75, 0, 8,
+    0, 6, 7, 0, 1, 2, 6, 0, 49, 0, 0, 0, 0, 0, 1, 11,
+    36, 194, 2, 0, 19, 0, 4, 1, 3, 0, 9, 0, 1, 0, 8, 5,
+    3, 0, 103, 23, 1, 1, 0, 29, 322, 2, 0, 18, 0, 0, 0, 0,
+    8, 0, 37, 9, 0, 0, 48, 0, 6, 17, 10, 1, 2, 45, 37, 10,
+    0, 17, 4, 64, 2, 0, 48, 0, 1, 0, 0, 4, 20, 88, 65, 12,
+    14, 15, 1, 2, 3, 12, 3, 2, 22, 36, 40, 5, 7, 2, 1, 0,
+    0, 263, 0, 5, 8, 9, 8, 1, 1, 0, 4, 3, 1, 0, 0, 0,
+    2, 3, 2, 2, 4, 1, 1, 0, 1, 3, 7, 2, 0, 3, 0, 2,
+    13, 49, 11, 0, 1, 5, 0, 0, 3, 34, 8, 1, 0, 0, 65, 1,
+    0, 8, 5, 0, 22, 13, 1, 2, 0, 12, 0, 4, 0, 7, 14, 16,
+    0, 1, 0, 12, 3, 198, 96, 0, 2, 19, 4, 114, 0, 9, 0, 5,
+    2, 6, 0, 8, 0, 3, 0, 0, 16, 49, 0, 4, 0, 1, 2, 1,
+    5, 17, 5, 0, 12, 0, 15, 5, 5, 2, 4, 3, 0, 3, 14, 0,
+    1, 2, 32, 16, 75, 88, 39, 4, 70, 22, 1, 17, 0, 2, 0, 8,
+    11, 0, 0, 7, 257, 2, 41, 2, 3, 5, 0, 0, 0, 24, 14, 24,
+    3, 6, 0, 0, 0, 4, 50, 8, 0, 1, 3, 0, 1, 35, 1, 4,
+    0, 8, 242, 64, 0, 1, 0, 15, 0, 67, 259, 12, 1, 6, 3, 1,
+    0, 6, 16, 12, 39, 8, 0, 3, 0, 256, 4, 2, 72, 2, 41, 0,
+    29, 4, 134, 4, 1, 4, 9, 0, 0, 5, 16, 0, 3, 0, 0, 5,
+    0, 0, 8, 0, 16, 1, 5, 0, 1, 5, 1, 128, 19, 70, 0, 2,
+    12, 21, 24, 0, 0, 15, 1, 1, 8, 8, 259, 4, 3, 0, 0, 21,
+    103, 10, 2, 0, 3, 6, 1, 0, 1, 14, 34, 0, 6, 5, 0, 0,
+    1, 4, 0, 2, 6, 4, 5, 4, 1, 54, 10, 2, 3, 8, 0, 3,
+    1, 10, 0, 6, 1, 152, 1, 4, 0, 1, 18, 0, 0, 0, 9, 0,
+    1, 0, 16, 0, 2, 0, 4, 3, 5, 76, 11, 1, 5, 336, 3, 20,
+    0, 18, 15, 0, 4, 0, 3, 7, 0, 74, 9, 0, 128, 8, 1, 3,
+    0, 256, 1, 19, 0, 15, 3, 4, 36, 21, 4, 0, 0, 19, 6, 0,
+    1, 1, 0, 1, 4, 0, 60, 0, 0, 8, 42, 1, 0, 0, 1, 0,
+    83, 2, 273, 9, 0, 1, 18, 0, 0, 16, 1, 3, 2, 2, 1, 0,
+    1, 0, 8, 19, 14, 36, 2, 0, 38, 44, 0, 5, 0, 0, 137, 6,
+    6, 0, 12, 1, 4, 3, 12, 5, 9, 0, 12, 1, 0, 3, 79, 0,
+    0, 260, 57, 0, 2, 2, 8, 2, 3, 0, 0, 0, 13, 4, 4, 0,
+    0, 0, 3, 0, 0, 3, 8, 19, 12, 19, 4, 5, 6, 30, 1, 29,
+    44, 2, 0, 34, 0, 16, 6, 17, 6, 7, 0, 0, 0, 0, 328, 0,
+    4, 6, 6, 0, 8, 0, 0, 0, 2, 325, 32, 21, 0, 65, 46, 42,
+    3, 8, 13, 41, 18, 4, 0, 0, 2, 0, 0, 6, 0, 2, 0, 8,
+    147, 0, 0, 1, 1, 12, 0, 0, 8, 0, 0, 13, 258, 0, 0, 4,
+    0, 34, 4, 4, 0, 38, 0, 0, 4, 0, 17, 3, 0, 0, 20, 0,
+    1, 0, 36, 1, 32, 0, 0, 20, 4, 27, 26, 0, 45, 0, 3, 4,
+    4, 0, 14, 16, 5, 0, 0, 0, 3, 0, 16, 4, 6, 10, 2, 4,
+    0, 23, 12, 71, 0, 8, 1, 1, 1, 28, 5, 3, 19, 0, 0, 17,
+    20, 4, 3, 0, 16, 2, 14, 13, 0, 1, 0, 16, 25, 32, 24, 0,
+    41, 2, 0, 13, 17, 23, 0, 4, 7, 6, 0, 10, 0, 0, 0, 0,
+    17, 1, 1, 15, 16, 0, 8, 0, 1, 0, 6, 1, 16, 6, 3, 0,
+    30, 1, 28, 27, 4, 1, 2, 74, 5, 2, 0, 18, 8, 16, 3, 7,
+    4, 64, 1, 84, 2, 18, 25, 43, 9, 0, 0, 4, 0, 1, 0, 10,
+    32, 1, 3, 24, 1, 23, 0, 32, 68, 4, 4, 5, 269, 262, 0, 0,
+    0, 9, 1, 0, 7, 5, 17, 11, 5, 6, 2, 10, 8, 24, 86, 0,
+    0, 27, 2, 0, 302, 6, 0, 0, 33, 17, 11, 44, 293, 16, 7, 3,
+    0, 0, 326, 3, 1, 0, 8, 256, 0, 0, 3, 14, 0, 0, 31, 1,
+    0, 5, 31, 18, 4, 0, 3, 8, 1, 0, 20, 0, 48, 1, 30, 35,
+    1, 2, 8, 0, 0, 11, 5, 0, 4, 6, 4, 2, 1, 12, 282, 0,
+    13, 25, 85, 4, 258, 16, 0, 1, 33, 88, 42, 0, 293, 268, 5, 6,
+    271, 4, 69, 2, 4, 0, 9, 19, 0, 0, 14, 10, 2, 0, 15, 3,
+    0, 3, 0, 52, 10, 10, 264, 1, 30, 12, 33, 3, 0, 0, 7, 8,
+    56, 37, 0, 0, 9, 19, 69, 1, 7, 7, 9, 8, 0, 1, 7, 5,
+    81, 0, 0, 1, 1, 11, 9, 134, 12, 0, 19, 262, 2, 6, 0, 0,
+    312, 0, 31, 32, 0, 11, 2, 34, 5, 0, 52, 2, 0, 13, 0, 6,
+    258, 1, 0, 1, 0, 0, 0, 0, 35, 0, 0, 0, 13, 33, 9, 112,
+    19, 17, 9, 0, 13, 261, 0, 299, 0, 11, 5, 11, 17, 0, 0, 6,
+    8, 6, 2, 3, 33, 4, 7, 8, 0, 19, 38, 7, 3, 261, 1, 6,
+    42, 0, 46, 56, 6, 0, 73, 32, 1, 0, 10, 2, 1, 8, 0, 6,
+    16, 132, 91, 0, 1, 2, 20, 9, 3, 8, 9, 0, 12, 6, 32, 260,
+    0, 50, 16, 2, 0, 3, 7, 17, 0, 6, 9, 42, 274, 0, 52, 2,
+    0, 1, 17, 0, 6, 3, 50, 17, 13, 13, 8, 48, 3, 3, 1, 0,
+    8, 257, 1, 32, 36, 11, 0, 4, 1, 7, 32, 8, 9, 1, 13, 6,
+    6, 7, 3, 2, 0, 5, 1, 1, 19, 71, 258, 9, 0, 26, 9, 12,
+    91, 0, 265, 97, 1, 0, 0, 0, 2, 3, 0, 256, 0, 0, 20, 64,
+    1, 11, 272, 5, 70, 0, 29, 0, 10, 0, 4, 0, 0, 0, 10, 9,
+    13, 20, 34, 1, 0, 65, 3, 4, 16, 3, 2, 27, 0, 0, 1, 7,
+    0, 137, 7, 4, 42, 0, 36, 4, 75, 5, 12, 18, 3, 12, 0, 98,
+    0, 1, 19, 0, 78, 1, 59, 1, 0, 3, 8, 33, 3, 2, 0, 4,
+    11, 4, 8, 0, 1, 17, 4, 0, 2, 0, 5, 34, 1, 33, 0, 9,
+    0, 45, 37, 12, 4, 8, 3, 0, 0, 15, 1, 45, 4, 24, 1, 0,
+    5, 13, 13, 20, 6, 0, 6, 12, 0, 37, 0, 3, 0, 64, 23, 0,
+    0, 0, 3, 0, 9, 2, 1, 24, 6, 20, 2, 1, 54, 10, 0, 131,
+    0, 0, 19, 0, 1, 0, 20, 1, 11, 6, 2, 2, 0, 0, 6, 3,
+    9, 0, 64, 0, 24, 48, 19, 1, 75, 0, 3, 20, 4, 0, 10, 0,
+    0, 8, 16, 0, 66, 0, 2, 62, 96, 3, 0, 0, 47, 7, 36, 20,
+    0, 0, 12, 1, 80, 33, 32, 33, 0, 0, 1, 0, 0, 68, 8, 62,
+    2, 5, 0, 4, 0, 0, 0, 0, 11, 39, 1, 6, 6, 5, 0, 5,
+    44, 32, 13, 1, 7, 45, 11, 7, 0, 18, 3, 3, 9, 0, 2, 16,
+    0, 82, 0, 258, 15, 28, 32, 4, 48, 3, 3, 0, 13, 5, 78, 1,
+    0, 43, 32, 6, 0, 0, 12, 0, 29, 379, 3, 65, 0, 13, 1, 32,
+    0, 3, 5, 36, 33, 73, 0, 8, 2, 3, 4, 0, 0, 109, 3, 1,
+    18, 1, 0, 2, 3, 7, 3, 0, 0, 165, 0, 8, 9, 17, 263, 18,
+    0, 2, 9, 0, 0, 1, 18, 0, 22, 13, 32, 3, 24, 333, 11, 11,
+    65, 128, 4, 11, 5, 0, 1, 22, 9, 26, 0, 3, 1, 8, 0, 4,
+    0, 256, 38, 0, 0, 9, 0, 4, 0, 16, 15, 4, 4, 16, 0, 0,
+    128, 0, 6, 0, 29, 19, 3, 2, 2, 23, 15, 11, 65, 24, 0, 51,
+    31, 97, 2, 46, 3, 5, 298, 47, 29, 0, 1, 30, 0, 0, 2, 1,
+    9, 60, 25, 114, 7, 42, 0, 13, 0, 0, 17, 4, 5, 1, 18, 0,
+    9, 101, 3, 2, 87, 97, 8, 13, 1, 1, 6, 8, 8, 0, 0, 6,
+    0, 1, 128, 0, 12, 55, 4, 11, 0, 1, 1, 0, 84, 3, 0, 24,
+    31, 3, 0, 3, 16, 0, 77, 2, 6, 0, 3, 5, 20, 4, 32, 0,
+    339, 343, 7, 1, 32, 32, 0, 0, 4, 33, 0, 18, 1, 0, 3, 11,
+    32, 0, 72, 1, 0, 35, 0, 0, 0, 58, 1, 0, 0, 23, 24, 2,
+    65, 0, 0, 10, 0, 14, 9, 44, 3, 8, 0, 4, 1, 320, 5, 130,
+    10, 0, 486, 0, 10, 4, 16, 41, 145, 0, 69, 0, 0, 2, 17, 161,
+    0, 40, 5, 518, 27, 9, 0, 0, 1, 41, 67, 14, 6, 0, 0, 0,
+    35, 2, 1, 16, 1, 5, 0, 0, 0, 10, 9, 0, 14, 0, 1, 32,
+    35, 233, 0, 0, 0, 1, 19, 33, 7, 1, 43, 9, 3, 268, 10, 2,
+    12, 3, 49, 21, 256, 8, 0, 1, 514, 0, 8, 133, 0, 8, 30, 5,
+    0, 162, 0, 24, 8, 43, 0, 24, 96, 0, 1, 8, 0, 0, 0, 0,
+    127, 99, 0, 5, 2, 2, 5, 1, 4, 21, 0, 3, 0, 0, 19, 51,
+    5, 37, 40, 0, 49, 65, 5, 34, 2, 14, 24, 13, 1, 0, 1, 4,
+    0, 9, 45, 0, 1, 3, 0, 0, 264, 1, 9, 7, 49, 11, 4, 72,
+    14, 0, 39, 2, 13, 28, 0, 2, 0, 14, 66, 0, 0, 34, 78, 0,
+    15, 531, 2, 18, 192, 36, 18, 9, 3, 15, 0, 20, 32, 0, 0, 19,
+    258, 177, 4, 0, 10, 1, 1, 3, 16, 3, 7, 13, 0, 5, 181, 8
+};
+
+const unsigned short hash5_values[] =
+{
+    6712, 5481, 5486, 3507, 6711, 2981, 5485, 3220, 5477, 849, 4008, 1020, 5472, 848, 6883, 4071,
+    1103, 5417, 2245, 4321, 2745, 6966, 3888, 5445, 5487, 2667, 845, 5381, 5336, 6708, 5728, 5581,
+    6705, 4452, 2345, 5800, 5398, 4164, 3122, 4163, 2110, 3800, 1846, 0, 0, 6011, 0, 2761,
+    4882, 842, 4451, 7015, 3039, 6790, 5076, 3917, 4085, 838, 1152, 927, 6701, 65, 3013, 2951,
+    3584, 286, 3519, 6280, 6101, 0, 2240, 4028, 0, 0, 833, 6696, 3818, 0, 0, 417,
+    6347, 4450, 484, 4162, 6690, 2079, 827, 3293, 3038, 1912, 2806, 5979, 4415, 3561, 3621, 5089,
+    1620, 3518, 1772, 142, 820, 0, 6683, 6936, 0, 6138, 0, 0, 1073, 2123, 5408, 5189,
+    6210, 2952, 5554, 4449, 235, 4161, 3692, 6119, 5809, 586, 5798, 6449, 4216, 3323, 347, 5625,
+    4047, 6731, 868, 7156, 2841, 3661, 3251, 631, 3716, 3827, 2108, 3796, 2479, 6494, 3002, 6158,
+    2036, 1619, 2070, 5112, 141, 3844, 3037, 3469, 7446, 5346, 1792, 6194, 4414, 4725, 5620, 7354,
+    1293, 2925, 3162, 5899, 3113, 3607, 3517, 126, 0, 2031, 2347, 331, 1491, 2853, 0, 0,
+    3687, 3901, 4795, 5759, 213, 6191, 5796, 2010, 1583, 5562, 4603, 4054, 4448, 4335, 2178, 328,
+    2879, 6873, 1181, 7044, 6730, 4156, 867, 0, 4939, 6297, 1576, 7439, 585, 4298, 5221, 6448,
+    1406, 6031, 1240, 1010, 2453, 3234, 7103, 7269, 5111, 1999, 4676, 4412, 4447, 253, 2564, 3843,
+    6595, 2142, 4825, 13, 5629, 2069, 3376, 3516, 5144, 6056, 732, 4413, 4145, 1791, 4195, 2967,
+    1618, 1743, 4287, 3036, 5640, 2322, 5793, 3448, 0, 393, 6256, 434, 2368, 0, 2637, 0,
+    1690, 6380, 2508, 7274, 517, 7161, 1298, 2432, 2252, 4531, 1411, 7326, 160, 386, 1634, 1463,
+    3335, 2811, 0, 5808, 1000, 5713, 6863, 6249, 6111, 4901, 229, 5203, 4480, 583, 4213, 6446,
+    6761, 2092, 5233, 5789, 4446, 186, 5527, 148, 898, 3243, 0, 0, 5938, 0, 4151, 4475,
+    2656, 2359, 5280, 584, 5455, 3063, 5309, 311, 562, 3415, 6425, 6447, 3732, 4890, 6000, 5709,
+    6808, 1405, 7268, 945, 3035, 7287, 1942, 4411, 866, 5784, 6169, 5019, 5220, 6729, 983, 2848,
+    3157, 4443, 1617, 7389, 7049, 4409, 6846, 1186, 7357, 3533, 6998, 1526, 140, 2157, 1135, 1682,
+    1034, 6589, 1494, 726, 1301, 7164, 6897, 4272, 18, 5436, 5496, 2914, 2550, 5005, 3313, 5639,
+    5110, 5719, 2591, 1424, 3842, 248, 0, 3144, 0, 0, 1979, 0, 1462, 7325, 0, 0,
+    4794, 1594, 952, 6815, 7457, 2452, 256, 2991, 6330, 0, 5778, 6135, 1790, 5807, 4445, 467,
+    1833, 6801, 4194, 938, 7218, 1946, 4343, 5898, 1731, 1362, 4124, 4981, 7225, 2962, 0, 1355,
+    6656, 793, 4771, 2619, 2420, 5468, 6375, 2476, 512, 582, 4086, 0, 3511, 6445, 3388, 1539,
+    653, 1963, 0, 0, 23, 2934, 5159, 3845, 6516, 1259, 7122, 7402, 4966, 4894, 2113, 0,
+    580, 6443, 865, 1335, 0, 1922, 3899, 7198, 0, 5218, 6848, 6728, 640, 2091, 2813, 6503,
+    1479, 7261, 7342, 985, 3123, 0, 4928, 3653, 1574, 3414, 1398, 7437, 4570, 2402, 0, 4178,
+    5811, 244, 1839, 0, 5741, 545, 6408, 5495, 0, 0, 4507, 2272, 2721, 3541, 0, 0,
+    7179, 1316, 2842, 3479, 7460, 3034, 1597, 0, 5771, 1848, 5539, 25, 2208, 5291, 5718, 4731,
+    4986, 6845, 1616, 5982, 3752, 1282, 2284, 4408, 1915, 642, 3841, 3553, 2297, 3028, 5109, 3148,
+    4395, 576, 4683, 6439, 7145, 3855, 1697, 5763, 1380, 960, 6823, 5666, 2066, 2467, 1499, 3908,
+    4096, 3089, 4410, 1804, 4108, 458, 4037, 6321, 139, 1789, 6168, 3964, 5836, 3461, 1094, 6008,
+    2529, 4638, 476, 6339, 4192, 3056, 1102, 6965, 5876, 233, 7362, 7243, 982, 4228, 6215, 352,
+    5915, 28, 3381, 4380, 6765, 6399, 6019, 536, 1134, 4793, 2640, 5195, 6997, 2607, 1708, 6505,
+    1825, 2023, 3695, 4540, 4854, 5235, 1459, 172, 4193, 3503, 83, 7322, 902, 5830, 4436, 768,
+    2961, 3374, 4581, 6957, 2163, 2292, 3762, 1968, 3299, 3438, 1864, 1882, 5507, 5052, 4310, 2301,
+    2429, 2653, 5806, 6120, 1615, 6458, 3491, 3897, 5897, 3066, 5754, 595, 4427, 4556, 4586, 6631,
+    2370, 3724, 2710, 6746, 3927, 2630, 2349, 3281, 1245, 7108, 3463, 4060, 138, 2223, 3016, 883,
+    1748, 4803, 3526, 4221, 32, 3400, 5323, 0, 161, 5633, 5765, 2929, 4336, 6146, 4015, 2451,
+    2728, 579, 6442, 4323, 2590, 0, 4728, 5678, 6318, 66, 5119, 0, 5946, 6002, 5191, 455,
+    5348, 6030, 3354, 3033, 2181, 0, 4664, 3470, 0, 0, 0, 0, 5364, 0, 6619, 756,
+    3085, 2718, 7316, 2587, 1042, 7436, 6943, 1573, 581, 5512, 6444, 1080, 7064, 1929, 4716, 5975,
+    6208, 6064, 6727, 864, 2167, 345, 6061, 6905, 3394, 2869, 3652, 2514, 523, 1453, 4755, 3547,
+    2984, 1877, 5805, 980, 1201, 1571, 7434, 5501, 2246, 6886, 1023, 6843, 4910, 5474, 4010, 3788,
+    5083, 5338, 5446, 2211, 6386, 3592, 1106, 6969, 2980, 1994, 5956, 3740, 4065, 2602, 2090, 3871,
+    7415, 4637, 2583, 4895, 1982, 4952, 6167, 1552, 556, 1894, 3009, 6419, 6352, 6856, 4036, 116,
+    1795, 5995, 3342, 2125, 204, 6870, 4128, 3413, 3613, 800, 4394, 1640, 575, 1007, 6438, 3998,
+    6844, 2404, 6431, 981, 4165, 3840, 3325, 1310, 6770, 993, 907, 568, 60, 1895, 3907, 240,
+    6663, 7173, 4568, 3654, 86, 2063, 6995, 1614, 4856, 2132, 1734, 4737, 277, 1132, 2140, 3963,
+    6304, 3717, 2851, 2580, 1429, 4931, 4350, 4922, 7292, 5172, 4191, 5839, 2316, 3041, 1738, 125,
+    5215, 1257, 1635, 7120, 2435, 489, 137, 5379, 1047, 5638, 4407, 4606, 4319, 5584, 4491, 6910,
+    3876, 1752, 3532, 441, 6779, 1788, 3032, 916, 0, 0, 2365, 0, 1133, 767, 5064, 6996,
+    281, 4734, 411, 6274, 4189, 1191, 5941, 3640, 4379, 5250, 7054, 0, 6327, 1512, 464, 0,
+    177, 4331, 5896, 2350, 6630, 5856, 5122, 5307, 3914, 4743, 3910, 5326, 2777, 4359, 3600, 2450,
+    3867, 87, 268, 5833, 6160, 3862, 1613, 5599, 7332, 5000, 6888, 2193, 3460, 5072, 6112, 4809,
+    6977, 1647, 3975, 2778, 3187, 2213, 332, 6948, 6398, 1085, 5515, 535, 4534, 3811, 1469, 4018,
+    5910, 597, 3031, 2219, 1114, 3936, 6460, 1460, 7323, 2468, 1342, 3442, 7205, 747, 136, 4703,
+    2413, 5804, 5108, 7375, 7409, 6124, 4091, 1244, 2059, 308, 3839, 1683, 266, 1121, 7107, 6984,
+    5413, 1850, 4460, 3338, 5819, 2782, 669, 6532, 2131, 4775, 4792, 1025, 5531, 3956, 3858, 5613,
+    1157, 113, 3979, 3894, 3942, 6610, 3968, 4315, 6195, 5319, 6069, 3231, 2903, 1546, 2645, 1905,
+    6128, 7020, 214, 3671, 2784, 2960, 4597, 5164, 6613, 1445, 7308, 5930, 3406, 232, 750, 5118,
+    777, 0, 3578, 6640, 0, 7191, 1787, 0, 1423, 3760, 0, 2372, 7286, 1328, 5520, 5256,
+    0, 0, 1754, 4968, 1937, 0, 3412, 2874, 4571, 0, 5555, 2459, 3483, 2168, 6481, 618,
+    4525, 0, 6879, 1016, 5895, 3346, 4611, 0, 3575, 5402, 56, 5511, 5242, 0, 0, 3203,
+    2089, 7063, 2723, 3223, 1928, 6004, 2681, 1200, 0, 4935, 4021, 5844, 1990, 5803, 4663, 5407,
+    1062, 6925, 6207, 2118, 344, 3655, 4940, 4897, 558, 4371, 2824, 5211, 2530, 1783, 2633, 5026,
+    35, 1570, 4820, 2149, 5742, 4003, 2820, 3030, 1612, 858, 53, 7433, 6721, 3136, 6421, 3131,
+    578, 6842, 3072, 4259, 6441, 2203, 979, 4909, 0, 0, 6478, 0, 0, 0, 1896, 615,
+    2170, 5585, 2937, 0, 1910, 2523, 0, 0, 1555, 261, 5875, 0, 6227, 7418, 364, 4848,
+    4650, 4762, 135, 4295, 5850, 1664, 7398, 1893, 90, 2713, 2522, 2045, 6418, 555, 4134, 5574,
+    1535, 1473, 7336, 622, 3509, 5542, 6840, 977, 4979, 3890, 739, 3651, 5717, 6602, 5266, 6485,
+    2389, 6026, 6370, 2763, 5257, 7262, 507, 2490, 4668, 5079, 5974, 4434, 4406, 320, 3274, 3564,
+    367, 6044, 1204, 6230, 6063, 1399, 2989, 5985, 2807, 7067, 2401, 4267, 6089, 6166, 2679, 5197,
+    5130, 607, 7010, 6470, 1055, 3361, 6918, 110, 418, 5246, 6994, 7227, 6140, 2860, 5441, 3881,
+    6715, 1147, 3622, 6599, 6650, 787, 5992, 736, 3029, 6259, 1131, 396, 6281, 1364, 4567, 3776,
+    852, 440, 1388, 3805, 1333, 7196, 7251, 46, 5284, 6303, 0, 0, 2933, 5107, 4123, 2278,
+    5206, 4828, 2215, 241, 4251, 2911, 3838, 1038, 1766, 8, 1607, 4917, 1737, 4250, 92, 6901,
+    3197, 4516, 5179, 48, 4634, 0, 5055, 303, 4636, 2116, 0, 0, 5714, 0, 2775, 3877,
+    4035, 2173, 3363, 3458, 0, 6310, 447, 5067, 7344, 5802, 2018, 4551, 7444, 3057, 1579, 0,
+    3091, 2787, 6267, 662, 5063, 6525, 6508, 6875, 95, 3314, 4393, 1012, 6437, 574, 2407, 6284,
+    4141, 4188, 7053, 5458, 5093, 645, 1190, 5591, 3906, 6411, 4421, 3992, 421, 1506, 145, 7369,
+    3214, 196, 1511, 1867, 4275, 5637, 3459, 1656, 7311, 5536, 2971, 6074, 3142, 4358, 4484, 1448,
+    6662, 1581, 6735, 1831, 2882, 7442, 799, 3195, 4175, 4791, 872, 5681, 1481, 3235, 226, 3861,
+    548, 1565, 404, 3627, 5860, 2353, 7327, 1442, 7374, 4117, 7305, 5071, 973, 2803, 4422, 6836,
+    1464, 4040, 543, 3702, 4486, 1951, 6406, 6643, 780, 7256, 1611, 5667, 1393, 5106, 7428, 2483,
+    4993, 534, 4190, 7149, 3212, 6397, 1286, 2907, 4774, 2744, 6174, 2423, 2054, 6736, 2011, 3644,
+    3226, 2260, 675, 4223, 6538, 7112, 4559, 2634, 1646, 2449, 3211, 1249, 6154, 2119, 107, 3154,
+    6356, 493, 5451, 2491, 5158, 3711, 0, 0, 429, 6292, 4330, 2959, 4052, 4372, 0, 2916,
+    134, 2699, 2439, 3209, 5616, 3163, 7320, 162, 4404, 2130, 5412, 0, 3670, 873, 5688, 0,
+    1403, 5703, 5312, 4160, 3639, 1211, 3396, 3086, 3112, 358, 6221, 3681, 5186, 3569, 4378, 3208,
+    5488, 3286, 5484, 1457, 5829, 2923, 6629, 2039, 2940, 3556, 1610, 2408, 766, 3138, 3176, 3368,
+    7266, 1780, 6214, 5926, 5544, 4264, 5556, 351, 5908, 7074, 4675, 3536, 5200, 1661, 3631, 4718,
+    4305, 2541, 5163, 4987, 3421, 1747, 3719, 7016, 3205, 5369, 4168, 5334, 5470, 1153, 1962, 4959,
+    200, 3217, 2176, 3077, 0, 0, 1710, 3885, 424, 2975, 0, 0, 4687, 317, 6287, 5889,
+    5519, 182, 1501, 5124, 1541, 398, 5185, 133, 5628, 2790, 6261, 7331, 3630, 1468, 7364, 6114,
+    1685, 577, 4833, 0, 6440, 2999, 1624, 2873, 4185, 3482, 0, 1474, 176, 6180, 7337, 4976,
+    0, 0, 0, 2674, 6878, 1015, 3355, 2608, 0, 0, 4232, 5636, 0, 0, 0, 0,
+    264, 0, 2898, 2589, 0, 0, 2032, 4588, 1321, 4690, 0, 0, 1627, 6075, 7184, 4311,
+    4903, 1243, 4573, 3280, 7106, 1477, 3599, 4285, 1989, 2354, 0, 5883, 5720, 1724, 5950, 1630,
+    0, 346, 3617, 712, 0, 4077, 4969, 6209, 2532, 0, 0, 5801, 6575, 6021, 0, 4087,
+    415, 847, 2506, 6278, 4431, 5497, 1974, 6710, 7340, 3255, 2729, 3919, 3650, 251, 4819, 0,
+    885, 6748, 3983, 1516, 1677, 7379, 6698, 835, 839, 6702, 6605, 5707, 6892, 2719, 3410, 4960,
+    6065, 7070, 5361, 1029, 1207, 2088, 3283, 3658, 3694, 5228, 6041, 5973, 2448, 2856, 2810, 742,
+    6684, 5105, 4754, 821, 7295, 3820, 2281, 5997, 3609, 0, 5117, 4672, 0, 0, 0, 1700,
+    6639, 776, 2231, 189, 3830, 3916, 6299, 4518, 6083, 2048, 436, 5300, 7417, 3879, 1554, 2566,
+    5315, 2148, 3411, 4294, 3777, 4468, 1140, 7003, 3242, 4880, 4198, 4662, 5939, 1088, 3508, 3709,
+    6512, 832, 3816, 6695, 5004, 2343, 4215, 4058, 4133, 2884, 649, 2660, 3715, 7276, 1413, 2868,
+    6839, 4892, 4524, 2795, 947, 6810, 1451, 2521, 976, 5785, 7314, 4745, 1215, 3493, 6233, 7078,
+    1129, 506, 6369, 3832, 5517, 37, 5438, 5510, 2121, 4991, 4026, 3402, 5091, 167, 5902, 4921,
+    3058, 7062, 1199, 964, 2538, 5010, 163, 886, 4374, 1927, 1144, 6177, 6749, 7007, 968, 2886,
+    3909, 3464, 7404, 6831, 6206, 3691, 343, 5959, 1337, 5602, 5329, 7200, 7358, 4831, 5332, 1773,
+    6688, 2516, 825, 6410, 5772, 2887, 7246, 2012, 547, 153, 4709, 6157, 6084, 5245, 5920, 2411,
+    5917, 6237, 5056, 5129, 2567, 3555, 3273, 7245, 4705, 4139, 1495, 374, 5014, 1382, 5816, 5660,
+    573, 5716, 4392, 132, 460, 2825, 6323, 6436, 3128, 499, 144, 3696, 1265, 3606, 6841, 7128,
+    1649, 3905, 4908, 4656, 6907, 904, 6767, 45, 7195, 1332, 4724, 211, 3156, 2969, 3739, 2513,
+    718, 5538, 4701, 6581, 978, 1892, 1383, 2894, 6185, 6362, 1972, 3804, 6635, 772, 3164, 315,
+    5033, 6680, 817, 6827, 4916, 5193, 3133, 4730, 1667, 6855, 5350, 6016, 2320, 1801, 992, 4249,
+    1044, 2189, 6296, 4045, 2493, 463, 2419, 6326, 7273, 5178, 231, 433, 4633, 6417, 180, 6951,
+    3742, 3664, 3960, 888, 554, 6751, 1722, 6942, 1984, 5354, 275, 3457, 5296, 67, 1876, 2891,
+    4684, 2747, 6861, 2765, 2337, 6086, 1432, 1289, 6858, 2855, 995, 5020, 6916, 4751, 559, 6422,
+    2892, 2774, 2331, 4739, 5981, 7152, 1079, 3471, 11, 1410, 3704, 4023, 6776, 2027, 3778, 913,
+    4942, 3745, 1113, 370, 1914, 4974, 6976, 4363, 5147, 96, 4497, 4748, 466, 1053, 4582, 6329,
+    4742, 4135, 3303, 5022, 3923, 4566, 7228, 2846, 5508, 6979, 5359, 998, 3003, 1116, 1365, 2930,
+    4337, 596, 2390, 2486, 3944, 6990, 6459, 7231, 5991, 4212, 1124, 33, 6987, 1119, 6982, 6993,
+    6992, 2786, 3455, 291, 4932, 1636, 1127, 4346, 3981, 3978, 7234, 1368, 1148, 7011, 1130, 1371,
+    5943, 2051, 6835, 3848, 871, 944, 4174, 3999, 1939, 6734, 2535, 58, 131, 735, 5937, 299,
+    1608, 80, 3204, 2647, 5933, 3352, 4252, 4520, 2700, 6598, 3343, 4377, 2162, 4889, 2639, 7318,
+    5635, 5892, 439, 4505, 6302, 972, 3007, 9, 3069, 5084, 3872, 4461, 77, 7170, 1455, 3093,
+    2358, 6151, 5783, 3310, 4261, 5341, 5194, 1658, 76, 2546, 4550, 5532, 1307, 5828, 117, 1796,
+    1940, 6378, 0, 515, 4778, 0, 4389, 1736, 4269, 0, 319, 5081, 0, 15, 6073, 2671,
+    7021, 1691, 1158, 0, 5791, 2064, 5155, 2665, 1251, 2906, 2814, 3225, 5523, 7114, 2230, 2875,
+    6807, 2197, 4830, 6038, 6025, 3106, 5570, 74, 5456, 0, 7429, 1566, 2303, 4790, 3486, 3045,
+    4227, 4612, 2041, 3822, 5095, 5065, 3022, 4720, 3233, 4758, 3641, 7371, 6291, 428, 4595, 1508,
+    72, 5885, 1278, 7141, 2973, 6931, 7087, 71, 1068, 2525, 5050, 4068, 5253, 7329, 2495, 1466,
+    4403, 6956, 1906, 2568, 932, 2534, 1776, 3603, 513, 6376, 6461, 5687, 2551, 598, 2056, 3774,
+    4561, 6540, 677, 4102, 5872, 5363, 4187, 5303, 5236, 1224, 6076, 3930, 1093, 2447, 4092, 178,
+    4120, 4577, 5039, 5001, 3370, 2701, 2958, 670, 3570, 3188, 5490, 5627, 2364, 6533, 4971, 5483,
+    6714, 4170, 3638, 6666, 4143, 7017, 803, 753, 4072, 2217, 184, 2380, 1521, 6489, 6795, 7384,
+    4357, 6213, 3761, 3597, 2979, 626, 1154, 2750, 851, 285, 3987, 350, 7073, 1823, 1210, 5430,
+    6880, 5655, 5414, 1017, 6014, 2021, 6616, 4958, 5139, 0, 0, 5571, 4905, 2307, 4936, 0,
+    288, 5096, 7441, 658, 0, 5153, 0, 2997, 1840, 4159, 3860, 6521, 4810, 1578, 1765, 5499,
+    5370, 4471, 3160, 861, 151, 7363, 4807, 5746, 7277, 1755, 5070, 1441, 7304, 2569, 5317, 2033,
+    5634, 4649, 6724, 1500, 3239, 2817, 4282, 1829, 2427, 323, 1414, 5152, 6186, 3588, 5426, 3261,
+    7263, 5770, 1263, 1863, 1544, 7407, 6928, 3510, 4653, 0, 1505, 7368, 4416, 1400, 533, 3495,
+    1645, 5261, 4842, 3404, 4112, 5133, 0, 1065, 0, 6396, 5287, 0, 3552, 2913, 0, 0,
+    0, 0, 3245, 0, 5960, 2002, 419, 6282, 0, 0, 0, 3799, 3623, 5097, 2561, 0,
+    2767, 4381, 5255, 5116, 0, 1515, 7242, 1379, 0, 0, 6637, 5923, 2669, 774, 4231, 3262,
+    2080, 0, 4587, 0, 3380, 3962, 457, 6320, 6136, 628, 3451, 2623, 6893, 1030, 2099, 2759,
+    0, 0, 4329, 0, 3772, 3834, 0, 0, 3598, 0, 2617, 6428, 4025, 565, 3612, 4661,
+    1162, 7025, 5814, 5641, 4944, 2497, 6268, 3932, 2722, 7213, 5411, 1350, 3114, 405, 4787, 3669,
+    5557, 7392, 520, 3616, 2287, 1370, 6383, 5295, 941, 7221, 40, 1358, 6804, 7233, 1529, 4773,
+    6360, 497, 6387, 4692, 6544, 681, 3431, 4522, 6344, 1449, 7312, 5462, 4364, 901, 5099, 1660,
+    6277, 414, 2129, 5663, 3560, 1004, 3779, 6867, 1834, 5879, 5887, 3290, 4852, 1253, 524, 7116,
+    4812, 1028, 6961, 4111, 6891, 1098, 2876, 1075, 6077, 2043, 1070, 3697, 5706, 5351, 1198, 7061,
+    2256, 7341, 4288, 3409, 3765, 5149, 5405, 1868, 6933, 5227, 6938, 5848, 2509, 4326, 1926, 3265,
+    7126, 5037, 5162, 4055, 410, 4973, 6273, 4789, 6764, 481, 2804, 5643, 342, 316, 6205, 6491,
+    68, 6170, 5776, 1478, 276, 490, 4104, 7378, 6353, 5031, 3249, 745, 3062, 3015, 6608, 129,
+    0, 4671, 2228, 2139, 0, 2298, 2076, 3733, 0, 3618, 1502, 7365, 2754, 7177, 1707, 1314,
+    7284, 1421, 3472, 0, 1425, 7288, 190, 5289, 6627, 764, 0, 0, 5190, 0, 2609, 3267,
+    3127, 4209, 4628, 3649, 1856, 6515, 4727, 652, 353, 4013, 2821, 6216, 4197, 2209, 4312, 7430,
+    3130, 0, 2087, 0, 4589, 4218, 3747, 2702, 6511, 2872, 1567, 6385, 648, 5371, 522, 2436,
+    4694, 5972, 1637, 5888, 3662, 6904, 1041, 2147, 280, 3481, 3771, 2730, 3298, 4106, 255, 3714,
+    3727, 1920, 2720, 6036, 5595, 1961, 6060, 2293, 4990, 4938, 5102, 284, 3316, 2013, 4907, 4061,
+    0, 0, 4600, 4233, 4912, 0, 5306, 5931, 5314, 3177, 7081, 1218, 2668, 5143, 61, 6046,
+    6849, 0, 986, 5701, 0, 0, 0, 0, 164, 4240, 4780, 170, 5260, 2694, 6179, 2570,
+    1159, 6196, 1058, 2682, 7022, 4508, 553, 5646, 5343, 729, 6592, 3986, 6654, 791, 3405, 4544,
+    4242, 7461, 1220, 1598, 5843, 6314, 1988, 3754, 451, 5104, 5036, 3673, 6416, 2932, 3488, 3675,
+    333, 2796, 3000, 967, 1981, 5877, 6830, 5013, 3780, 5331, 4710, 4489, 4887, 237, 5087, 4620,
+    7083, 2375, 4708, 5224, 0, 6921, 5171, 1891, 2396, 1104, 6967, 0, 0, 0, 5237, 0,
+    6020, 5780, 379, 2308, 0, 0, 5399, 1196, 2603, 7059, 6242, 1826, 0, 0, 2024, 5607,
+    770, 6633, 0, 4138, 4279, 5372, 5131, 2544, 373, 4514, 1770, 6236, 4818, 3819, 2655, 5727,
+    3926, 3146, 3785, 2161, 0, 0, 5397, 5580, 3111, 4736, 2430, 0, 0, 0, 0, 0,
+    5297, 0, 0, 5965, 0, 0, 5722, 0, 5168, 6719, 856, 2770, 2464, 1977, 4613, 3738,
+    2987, 6646, 6423, 3688, 4050, 3301, 2520, 2992, 3047, 0, 3189, 2186, 0, 4723, 3416, 0,
+    0, 0, 0, 560, 0, 0, 6854, 991, 3937, 6772, 2703, 3443, 5990, 198, 0, 909,
+    1081, 6678, 6944, 149, 4031, 2265, 4306, 5355, 608, 4604, 2798, 6471, 6144, 815, 4344, 1687,
+    5396, 4082, 7229, 7012, 4696, 4299, 5428, 5711, 4122, 783, 2279, 1366, 4565, 1149, 2693, 3306,
+    3391, 4146, 3812, 733, 1952, 122, 4293, 1031, 4639, 1699, 3846, 462, 4953, 3582, 6894, 6325,
+    0, 0, 5576, 6596, 1782, 6912, 1049, 4253, 0, 0, 3708, 5391, 7026, 4667, 1163, 4132,
+    2086, 6301, 1078, 6941, 572, 4391, 438, 3806, 589, 6435, 6184, 2273, 6452, 6664, 2386, 1704,
+    975, 3882, 1756, 1898, 5353, 2571, 3499, 5935, 5866, 6838, 5682, 7294, 1431, 5244, 801, 5592,
+    3951, 5173, 3904, 6950, 2285, 4785, 2966, 3571, 1653, 4493, 5647, 654, 2572, 3922, 1957, 3534,
+    6097, 505, 187, 6368, 4199, 5994, 2318, 7165, 5689, 602, 6465, 5851, 5624, 5449, 3490, 1302,
+    2158, 1112, 7100, 933, 97, 4075, 6975, 5384, 2226, 6171, 1155, 14, 6117, 5478, 1237, 6796,
+    2865, 309, 6609, 746, 1880, 3436, 2779, 2440, 7018, 5611, 2704, 4278, 2978, 227, 3996, 4741,
+    3580, 5264, 1087, 5380, 5760, 3522, 6657, 5358, 794, 5304, 238, 4384, 5393, 2237, 6306, 3399,
+    2724, 1336, 4680, 2547, 2034, 495, 6517, 7199, 7109, 3941, 1123, 6986, 1246, 3686, 5406, 4362,
+    5128, 2974, 685, 3957, 6548, 7395, 5831, 2112, 3059, 4179, 2783, 1837, 1532, 3311, 2106, 2504,
+    3454, 1800, 4496, 690, 1692, 3768, 5834, 3977, 5812, 6358, 3648, 307, 2014, 4602, 443, 6553,
+    4297, 5060, 2326, 0, 6078, 5439, 1648, 3351, 356, 0, 5373, 6219, 1943, 165, 0, 0,
+    4796, 1518, 0, 0, 0, 4064, 0, 1222, 2714, 5563, 0, 1935, 7085, 4186, 7381, 3348,
+    7214, 1351, 6594, 0, 0, 1386, 731, 0, 1437, 3345, 1187, 7050, 4153, 7300, 6545, 682,
+    7249, 55, 0, 5971, 4144, 263, 0, 6057, 0, 2363, 44, 6050, 0, 0, 5648, 0,
+    3202, 641, 3573, 0, 7169, 1306, 4756, 3698, 6504, 20, 1869, 3050, 1886, 3428, 0, 2235,
+    3446, 3940, 3898, 5735, 0, 3928, 0, 0, 5136, 1948, 0, 1621, 5617, 69, 3803, 4356,
+    0, 1179, 0, 0, 2844, 0, 4777, 314, 2182, 4066, 0, 0, 0, 5207, 4915, 3259,
+    0, 7042, 3473, 3417, 2144, 5853, 0, 0, 4949, 3710, 0, 4398, 0, 1902, 4248, 0,
+    6090, 5030, 4032, 3545, 2664, 1623, 5502, 3165, 6924, 1061, 4643, 1841, 4781, 1638, 5522, 2788,
+    2666, 2385, 6115, 4257, 5569, 3068, 6787, 924, 7091, 5311, 1228, 2471, 3781, 2861, 5248, 2196,
+    6970, 50, 2773, 4805, 1107, 3676, 3485, 5374, 5454, 7416, 1553, 6401, 4665, 1995, 4575, 3178,
+    1746, 538, 808, 3512, 2556, 3456, 6007, 6671, 4148, 1160, 2705, 7023, 5177, 5619, 4594, 4376,
+    0, 0, 3489, 3078, 4614, 0, 0, 0, 3767, 0, 0, 0, 0, 0, 0, 0,
+    0, 49, 0, 0, 0, 62, 3198, 0, 2096, 6395, 1418, 5948, 532, 5238, 7281, 5827,
+    2346, 4884, 0, 2573, 829, 4030, 6625, 7163, 4320, 1644, 843, 6692, 5077, 4607, 6706, 5865,
+    0, 5051, 7443, 210, 0, 3317, 4385, 762, 3790, 2646, 6588, 1580, 4097, 2037, 1300, 725,
+    4049, 7136, 98, 1273, 6955, 1295, 29, 4266, 1675, 2335, 3993, 4626, 7029, 7158, 4119, 5767,
+    5073, 3196, 2156, 272, 4419, 2344, 4881, 2826, 0, 0, 6192, 525, 1166, 5664, 1092, 3828,
+    1242, 2071, 4027, 1492, 1461, 7324, 6388, 6247, 5732, 7206, 1343, 7355, 1032, 384, 6079, 147,
+    1520, 7105, 519, 7027, 5794, 7383, 6382, 1164, 2706, 4328, 6895, 329, 6134, 5120, 1002, 6865,
+    3684, 836, 6689, 4477, 6794, 3596, 7270, 931, 826, 5558, 3044, 3952, 6699, 5723, 1407, 6148,
+    6109, 3549, 4826, 5909, 6762, 5654, 672, 6535, 6899, 2225, 2791, 2128, 2574, 1036, 6087, 7426,
+    792, 4173, 870, 5138, 6733, 6655, 6172, 1938, 2253, 3668, 4532, 3183, 5231, 6584, 721, 5779,
+    655, 2858, 2957, 5243, 4300, 4219, 4879, 2621, 6518, 4772, 1832, 899, 6263, 400, 2341, 1563,
+    5421, 1063, 2690, 6834, 4046, 5281, 5649, 1924, 3060, 4784, 6926, 859, 4004, 971, 2915, 5546,
+    7303, 1440, 3782, 274, 2015, 5061, 2964, 1853, 6722, 5610, 6181, 3903, 2584, 3149, 5092, 2333,
+    3427, 6095, 1911, 2764, 0, 1223, 166, 4651, 778, 6641, 5859, 7086, 5425, 5267, 6681, 818,
+    1543, 1862, 0, 4020, 4549, 0, 0, 4351, 7367, 0, 4441, 7386, 1504, 3891, 7406, 1523,
+    4177, 1680, 5041, 3440, 5080, 1136, 7137, 2477, 5469, 2085, 1884, 4841, 7346, 3929, 4609, 1274,
+    2970, 2329, 334, 6072, 6197, 2808, 2441, 2661, 6999, 1483, 290, 0, 0, 2216, 0, 5145,
+    788, 3594, 3418, 5161, 5626, 0, 0, 6651, 727, 2001, 3279, 4033, 823, 6686, 6590, 5551,
+    7102, 3798, 4967, 1239, 0, 5460, 0, 4829, 0, 0, 3224, 4149, 0, 0, 0, 0,
+    0, 6958, 4140, 6033, 3868, 0, 0, 2067, 5715, 1709, 1095, 448, 0, 5792, 6311, 5810,
+    6826, 2134, 0, 3953, 3945, 0, 2578, 0, 963, 0, 2103, 0, 7282, 0, 1419, 5730,
+    5567, 3450, 0, 2053, 1281, 7144, 5328, 5528, 6781, 321, 2986, 918, 4453, 0, 4386, 2261,
+    0, 5180, 5316, 3339, 2757, 6427, 2283, 0, 1482, 2078, 7030, 1167, 2707, 7345, 564, 3824,
+    3392, 4342, 2575, 2845, 114, 2990, 5673, 2631, 4270, 6412, 2919, 4866, 6080, 2336, 475, 549,
+    487, 1349, 2871, 5916, 4677, 5668, 6350, 6862, 1954, 5269, 6338, 999, 6472, 6147, 2305, 609,
+    6803, 4224, 6153, 3480, 7223, 3559, 940, 7220, 3289, 5049, 5042, 4560, 1360, 2294, 1357, 3238,
+    1742, 2061, 6620, 5855, 757, 3051, 197, 3367, 5375, 4918, 4704, 7212, 39, 4851, 4557, 0,
+    6972, 7057, 3397, 1064, 4043, 3021, 2622, 7153, 3679, 7435, 3783, 5482, 2247, 6927, 4011, 1109,
+    1572, 5447, 3244, 4169, 1290, 3637, 4180, 1194, 2433, 3386, 2755, 2314, 6013, 4763, 5489, 4541,
+    325, 6487, 4110, 2141, 1097, 3720, 624, 4166, 6188, 3682, 169, 5415, 2126, 3228, 4610, 6960,
+    4059, 3990, 5006, 2604, 310, 269, 5579, 6262, 5378, 4512, 4591, 4857, 1169, 5125, 2708, 7032,
+    2057, 0, 0, 349, 1209, 7072, 2487, 3254, 0, 6212, 4325, 1686, 287, 3272, 0, 3896,
+    468, 6331, 1987, 0, 4957, 5069, 3090, 3954, 3946, 0, 0, 2801, 0, 2732, 0, 0,
+    1593, 4926, 7055, 1192, 2383, 795, 4574, 6658, 7456, 4303, 4660, 0, 2324, 6717, 854, 5308,
+    2533, 399, 0, 4158, 0, 5893, 1655, 4424, 7258, 5650, 5777, 4277, 2902, 1395, 1768, 4053,
+    6232, 239, 2928, 2867, 369, 5996, 1288, 188, 6068, 875, 6738, 5270, 7151, 2956, 2180, 2421,
+    3012, 5043, 0, 3793, 5863, 2618, 5376, 1851, 4817, 6223, 4307, 0, 0, 360, 0, 0,
+    3159, 1741, 4519, 0, 4902, 5983, 7309, 5826, 1446, 3538, 6239, 5691, 3880, 376, 2659, 1916,
+    4286, 0, 3865, 3126, 0, 0, 3817, 5183, 0, 651, 146, 6514, 1806, 5846, 300, 2885,
+    3602, 382, 1777, 6245, 7315, 1452, 6005, 0, 2576, 3821, 5518, 0, 2507, 208, 1921, 127,
+    5500, 2122, 0, 3222, 0, 2020, 4375, 6126, 0, 2641, 0, 4898, 0, 1885, 4975, 0,
+    6142, 0, 4962, 3632, 4599, 0, 0, 0, 1925, 5589, 5188, 4862, 4867, 4183, 1821, 3660,
+    0, 2250, 7462, 1599, 2751, 0, 0, 0, 922, 4234, 6785, 2050, 6881, 4528, 1018, 0,
+    1229, 7005, 1142, 6251, 0, 0, 388, 4470, 0, 0, 2356, 6466, 4230, 603, 3527, 5903,
+    0, 4472, 6820, 3117, 0, 0, 957, 3726, 6204, 7092, 341, 5608, 2458, 713, 0, 2725,
+    2818, 1993, 3731, 3379, 2038, 3147, 1415, 5560, 0, 3647, 5166, 155, 7278, 3065, 1669, 2799,
+    4844, 1334, 5121, 6252, 5259, 6576, 7414, 4113, 1267, 2466, 889, 6752, 7130, 7197, 1966, 1551,
+    389, 5230, 6920, 93, 3615, 6583, 6526, 2425, 5786, 390, 5202, 4719, 6253, 4429, 2688, 6045,
+    4292, 1057, 0, 720, 5251, 2174, 5277, 6110, 5957, 5970, 3364, 2469, 3046, 6254, 391, 5271,
+    2715, 3706, 663, 570, 6024, 6032, 4131, 5749, 3282, 3151, 6450, 3166, 5278, 6039, 2184, 5023,
+    6051, 1702, 6055, 6433, 2896, 5276, 6052, 4753, 260, 6053, 587, 6054, 2827, 7235, 1372, 108,
+    5757, 2560, 5944, 3505, 3135, 4488, 3506, 82, 2769, 3441, 1470, 974, 7333, 6837, 1262, 4673,
+    3501, 1745, 2028, 413, 3497, 2519, 1600, 1, 3215, 3492, 7319, 6182, 1456, 6276, 2257, 4994,
+    5157, 3645, 3465, 2936, 1881, 0, 0, 4906, 212, 6379, 0, 516, 3437, 1681, 3401, 7125,
+    6367, 5294, 6293, 430, 504, 0, 4088, 2625, 6670, 2854, 6632, 769, 807, 1651, 3356, 0,
+    1404, 2685, 4605, 2543, 4318, 2921, 6890, 0, 0, 1757, 0, 2093, 6603, 0, 0, 2950,
+    3925, 2311, 2377, 740, 6132, 2651, 2909, 7267, 6932, 5541, 6789, 1069, 3408, 806, 926, 6669,
+    1027, 1514, 7377, 4439, 7088, 6523, 660, 2698, 3775, 0, 0, 5226, 4284, 1235, 0, 2399,
+    3590, 3278, 5404, 5721, 1205, 7068, 0, 1225, 483, 4834, 5040, 1976, 5881, 7098, 6346, 2327,
+    0, 2282, 2612, 5904, 804, 2675, 1673, 6667, 7134, 2733, 0, 2160, 1271, 6788, 0, 0,
+    4083, 620, 6847, 2101, 984, 2269, 120, 6483, 5677, 5431, 881, 6744, 2949, 925, 203, 1725,
+    7394, 1531, 5822, 3020, 0, 0, 0, 6607, 3997, 3433, 4670, 2205, 6415, 552, 0, 4366,
+    1978, 3294, 0, 744, 0, 0, 3974, 0, 5127, 3984, 5924, 2398, 3219, 0, 3591, 4506,
+    630, 6493, 2481, 6552, 4569, 0, 7176, 0, 2840, 1784, 4081, 5342, 1890, 5134, 1313, 0,
+    4462, 2232, 1490, 5661, 5533, 0, 7353, 5366, 689, 3874, 0, 0, 5301, 0, 2948, 1858,
+    0, 0, 0, 0, 7445, 5652, 3749, 1582, 0, 0, 0, 0, 453, 6316, 2414, 0,
+    0, 0, 4208, 99, 4914, 4196, 5849, 2268, 1537, 0, 0, 0, 7400, 0, 0, 0,
+    7, 2792, 4616, 4546, 7393, 0, 3707, 4788, 2473, 6510, 647, 1530, 0, 0, 6934, 0,
+    0, 5463, 0, 0, 1071, 0, 0, 7247, 4334, 2146, 5695, 6244, 381, 5575, 1384, 3713,
+    43, 2348, 7192, 1329, 5313, 2528, 7216, 6868, 4714, 3240, 500, 2289, 4698, 2381, 1353, 6363,
+    0, 5170, 0, 0, 2188, 0, 5964, 1005, 4022, 259, 1439, 3052, 0, 0, 1830, 4078,
+    785, 0, 6492, 629, 5034, 6648, 2897, 4941, 1998, 4989, 5088, 3246, 0, 0, 6017, 3079,
+    3665, 3802, 5146, 2839, 130, 5115, 0, 0, 0, 4945, 0, 1824, 2947, 0, 0, 0,
+    2022, 1958, 7285, 375, 6628, 5761, 765, 3172, 5690, 2084, 6238, 3296, 7190, 4629, 1327, 4681,
+    2242, 5976, 1897, 4886, 1422, 6884, 224, 5480, 4074, 0, 5383, 1021, 5418, 0, 0, 4247,
+    935, 5476, 2880, 4005, 445, 6308, 3646, 2207, 2428, 2492, 5725, 4630, 5989, 295, 915, 4526,
+    1904, 5176, 5882, 3334, 4564, 2994, 5002, 223, 3167, 3626, 1606, 5738, 2946, 6778, 5623, 3849,
+    4347, 5582, 4659, 3524, 7171, 5241, 5861, 897, 3073, 7302, 6798, 4155, 2772, 5548, 6006, 406,
+    6593, 730, 6175, 3521, 4383, 1308, 2005, 22, 6760, 5963, 5969, 966, 1434, 6829, 1950, 2558,
+    3001, 2838, 5325, 4390, 5330, 2917, 4797, 761, 684, 2274, 5442, 5600, 4782, 7215, 6108, 1352,
+    5919, 3092, 6340, 477, 5708, 6624, 6058, 4333, 6547, 6048, 4002, 1197, 6403, 540, 4094, 7060,
+    7048, 1185, 4759, 437, 6269, 4515, 5045, 1657, 1836, 7350, 4861, 5263, 5219, 1487, 6300, 3304,
+    4069, 5949, 3423, 5018, 7297, 4707, 3902, 3831, 3384, 222, 857, 6720, 3792, 1771, 5012, 2599,
+    905, 2202, 4702, 4578, 1711, 2266, 4235, 1941, 6768, 5078, 2881, 194, 5352, 0, 3795, 1250,
+    4137, 6218, 6235, 1808, 6092, 2058, 7113, 2442, 5774, 1909, 5165, 243, 5506, 372, 355, 26,
+    754, 1348, 674, 7211, 6334, 1997, 3216, 3730, 1732, 6617, 3043, 4063, 1221, 7084, 4697, 471,
+    6537, 5958, 3513, 4646, 1859, 2117, 1193, 7056, 862, 0, 4951, 5423, 6725, 2006, 221, 5745,
+    7408, 890, 1545, 2040, 3320, 6753, 7388, 5951, 590, 3500, 1276, 2849, 5265, 1525, 6453, 7139,
+    1138, 6814, 4454, 7001, 4417, 1066, 4654, 951, 2945, 1730, 1654, 6929, 5252, 2615, 3889, 3737,
+    5450, 1705, 3184, 5799, 4722, 30, 2762, 2463, 4273, 1238, 340, 6203, 3049, 2081, 7101, 4098,
+    4511, 3190, 4947, 1389, 2263, 6374, 4396, 5998, 3445, 1900, 5467, 3939, 511, 7252, 4770, 2183,
+    869, 1296, 7159, 4200, 0, 6324, 6107, 3543, 1284, 289, 3875, 1045, 4764, 0, 6908, 7147,
+    156, 3115, 2494, 4332, 639, 6139, 4836, 0, 12, 4056, 4679, 5494, 2083, 4970, 5621, 0,
+    3308, 1729, 1758, 2635, 5008, 4686, 3478, 3248, 6333, 6853, 3333, 2357, 6264, 5890, 2510, 990,
+    4289, 2758, 1936, 5217, 6502, 5632, 1519, 7382, 786, 4732, 6649, 470, 5503, 4172, 4476, 168,
+    6660, 6923, 7301, 2837, 797, 2843, 1338, 4478, 1438, 6488, 6732, 1060, 4256, 7201, 5884, 3734,
+    461, 5583, 4642, 3120, 4150, 5247, 5577, 3300, 1426, 625, 220, 7289, 1799, 4868, 2403, 1918,
+    2416, 202, 831, 2153, 6716, 1568, 853, 2585, 7178, 6611, 1315, 3132, 3807, 5137, 4950, 7431,
+    4101, 1547, 4147, 6833, 2643, 4352, 5614, 970, 3619, 1903, 1077, 6940, 1767, 5057, 5453, 4399,
+    6850, 3141, 2598, 5618, 605, 3529, 1498, 6468, 1484, 7347, 1626, 1996, 6309, 3854, 3751, 4621,
+    987, 6623, 2077, 809, 7181, 760, 4806, 2315, 5670, 4985, 4625, 4509, 5858, 3833, 2312, 1318,
+    7047, 1184, 5086, 2044, 7361, 6672, 17, 2581, 3027, 5344, 4207, 219, 4548, 7453, 446, 3755,
+    4860, 5385, 1803, 1105, 1693, 2136, 3229, 2484, 2362, 2802, 2259, 119, 1590, 5017, 3869, 4016,
+    601, 3315, 1827, 6707, 844, 6484, 621, 6740, 3743, 2025, 771, 2836, 5751, 250, 5978, 6457,
+    1101, 6964, 5286, 6968, 1945, 1587, 2431, 6464, 4883, 143, 7450, 298, 2400, 2905, 4029, 192,
+    828, 6071, 6634, 3340, 6691, 479, 6542, 2374, 2552, 2627, 3829, 6130, 4339, 1111, 6193, 6974,
+    4355, 4853, 724, 841, 910, 2776, 6773, 6704, 1082, 3179, 4539, 6945, 283, 330, 5356, 6587,
+    4740, 4048, 1294, 1786, 7157, 4492, 6813, 5392, 2781, 1793, 5790, 2496, 4585, 297, 2943, 4827,
+    5825, 4954, 7146, 100, 1480, 3260, 2944, 7343, 6141, 6106, 6913, 5605, 1842, 3080, 2254, 4533,
+    3931, 6414, 5537, 1241, 6859, 7427, 996, 1564, 3453, 6100, 3915, 401, 5282, 1489, 6023, 4370,
+    7104, 5731, 3373, 4039, 551, 3856, 5174, 4222, 2073, 2334, 3535, 2342, 3332, 594, 249, 1050,
+    6165, 691, 3425, 950, 5612, 3892, 3723, 1283, 3921, 518, 4361, 3447, 6381, 6288, 2611, 425,
+    4495, 4632, 2478, 3285, 4425, 1001, 6980, 1889, 3813, 6864, 4802, 6694, 3237, 3271, 246, 2746,
+    679, 2734, 4691, 877, 2457, 7299, 1436, 748, 2864, 2918, 5854, 5832, 4811, 5066, 6342, 228,
+    6757, 3958, 5886, 3966, 3826, 894, 7410, 5552, 6554, 2300, 7352, 2351, 5047, 5394, 1117, 3976,
+    1096, 526, 2068, 6389, 6825, 1713, 1035, 2965, 3064, 6687, 962, 4103, 3350, 4400, 4051, 824,
+    0, 6959, 3347, 0, 0, 1964, 0, 6898, 3263, 4769, 7051, 3576, 0, 0, 5952, 1188,
+    510, 4877, 0, 3633, 6373, 4964, 4558, 5674, 3764, 2339, 2926, 0, 0, 0, 2620, 2405,
+    0, 327, 6190, 5755, 6394, 5098, 531, 2597, 7006, 2632, 1143, 0, 5766, 2443, 2166, 3336,
+    2835, 0, 0, 6479, 3395, 0, 6621, 616, 0, 0, 3835, 3690, 1923, 0, 758, 2470,
+    1643, 6091, 2862, 6577, 2248, 5249, 5961, 3565, 5059, 3677, 714, 1809, 6156, 111, 3264, 4012,
+    7046, 5448, 2983, 2244, 1183, 0, 0, 0, 4007, 5082, 0, 6198, 3636, 335, 305, 0,
+    2127, 3121, 4274, 322, 6012, 5444, 5609, 52, 4167, 3548, 1701, 5642, 0, 1394, 4858, 4455,
+    1774, 2498, 638, 4044, 7452, 2901, 6501, 3933, 1285, 7148, 4203, 5016, 6800, 2325, 1589, 5100,
+    2373, 4341, 896, 3787, 5942, 6067, 5216, 2942, 3718, 2910, 1006, 3200, 5123, 5788, 3605, 3266,
+    7259, 1396, 3994, 4776, 1883, 3439, 4530, 2988, 5362, 1208, 348, 6211, 124, 7071, 6869, 3466,
+    4608, 2812, 2505, 3258, 1684, 4813, 3357, 6430, 3496, 1601, 567, 2328, 234, 1852, 5586, 2,
+    2834, 7090, 5988, 1602, 937, 610, 5493, 6473, 1447, 4127, 397, 1354, 6149, 6759, 4402, 4327,
+    1227, 4563, 2663, 7310, 3268, 3539, 6260, 4956, 7217, 2406, 722, 6585, 3593, 4226, 4301, 5644,
+    101, 3656, 207, 3477, 5747, 357, 2352, 6220, 3, 3221, 5101, 3837, 923, 4899, 3322, 6786,
+    432, 6295, 2515, 4863, 193, 1650, 4157, 6113, 2748, 3434, 1878, 5410, 2275, 1256, 258, 7119,
+    2500, 0, 0, 0, 6123, 5214, 3935, 0, 3667, 3823, 604, 2195, 6467, 4368, 0, 0,
+    3750, 1008, 1751, 4815, 3985, 2563, 6871, 3484, 2133, 3531, 4089, 6351, 2941, 0, 296, 47,
+    6088, 361, 4846, 6224, 4869, 4241, 1280, 94, 3158, 4463, 2512, 4984, 2046, 2270, 3672, 3108,
+    2624, 2175, 0, 191, 7360, 3270, 1662, 4572, 6780, 3853, 3365, 488, 917, 1497, 7143, 4593,
+    363, 6527, 2649, 3026, 664, 7454, 2859, 5205, 4617, 4245, 6812, 1591, 4466, 1676, 949, 5181,
+    4624, 3913, 6226, 6164, 5603, 1234, 3382, 7097, 1471, 3067, 6413, 2531, 7334, 318, 1875, 1802,
+    5048, 0, 4243, 0, 0, 0, 0, 5729, 4995, 2711, 0, 0, 2192, 0, 0, 4977,
+    0, 2475, 2060, 5545, 4798, 1409, 5968, 7272, 3194, 2920, 2321, 6337, 2815, 1728, 550, 474,
+    3277, 4041, 7154, 1291, 1100, 2241, 3585, 6963, 5900, 4432, 5927, 0, 5268, 4181, 6105, 0,
+    1631, 1991, 7093, 6604, 1091, 1230, 2434, 741, 2029, 0, 0, 0, 4211, 6042, 0, 0,
+    2220, 6187, 3305, 1206, 1476, 6029, 1609, 7069, 7339, 2676, 692, 4107, 1674, 324, 2488, 6555,
+    6742, 2899, 1272, 6954, 5521, 4835, 2109, 10, 7135, 4084, 1726, 879, 1605, 5726, 4768, 6,
+    6531, 5820, 3583, 668, 6270, 4229, 407, 5936, 6372, 4538, 2367, 5914, 1873, 509, 5550, 2151,
+    5320, 3134, 2828, 2239, 1739, 0, 0, 1182, 0, 0, 7045, 218, 4999, 4517, 3331, 2822,
+    2233, 0, 1011, 3256, 0, 1778, 3878, 4888, 2313, 3377, 7080, 811, 4584, 6674, 0, 0,
+    0, 0, 0, 3173, 6874, 6806, 943, 2379, 1217, 623, 0, 0, 0, 6486, 5696, 0,
+    2752, 2935, 6081, 6118, 154, 5782, 3657, 7248, 3815, 6935, 387, 1385, 1072, 501, 6364, 3759,
+    934, 4699, 2290, 5817, 3084, 5867, 4933, 5587, 6797, 5234, 6099, 1688, 3372, 2883, 5578, 3863,
+    7279, 3595, 6754, 4845, 6821, 958, 5285, 2409, 5675, 891, 4079, 2857, 5035, 301, 4473, 252,
+    1416, 781, 6644, 3074, 4444, 2047, 4635, 7390, 5540, 4114, 5386, 2295, 1527, 2107, 3666, 174,
+    5068, 4322, 2120, 3611, 3581, 5516, 4467, 5401, 5340, 4870, 2238, 3852, 3614, 3218, 6250, 7432,
+    7253, 1390, 637, 3227, 4373, 5847, 247, 812, 3991, 6500, 1930, 3309, 3139, 6279, 3722, 4236,
+    4801, 3700, 5475, 217, 4961, 7226, 1373, 7236, 4923, 5901, 4837, 2049, 3850, 4348, 2995, 1871,
+    1540, 7403, 3004, 5025, 4263, 5196, 1363, 3389, 6082, 7123, 7257, 1260, 2456, 6183, 2291, 4276,
+    7150, 3011, 2870, 1287, 1048, 4205, 2026, 5566, 412, 3950, 1805, 3900, 4929, 5210, 2686, 6275,
+    6737, 6104, 2596, 874, 5739, 16, 3071, 4258, 7043, 273, 4760, 2115, 2605, 4070, 2548, 1180,
+    3808, 4405, 3424, 3053, 2249, 6872, 3407, 5114, 6176, 4893, 5292, 4579, 6222, 4442, 270, 359,
+    4865, 5672, 1847, 5753, 6750, 2361, 5596, 4527, 4712, 6426, 606, 6469, 6824, 961, 3537, 2955,
+    6618, 6094, 6889, 2629, 755, 1009, 5573, 2644, 3375, 4308, 4648, 1969, 4099, 2502, 5424, 2236,
+    1861, 1944, 7397, 863, 3476, 2355, 5365, 2410, 4840, 6726, 6145, 4655, 1534, 1744, 5705, 5529,
+    3504, 5187, 1666, 6116, 6981, 7366, 1503, 6930, 6601, 738, 4418, 1026, 1694, 3330, 3763, 1067,
+    1513, 7376, 3019, 2082, 6793, 1125, 930, 2654, 3705, 530, 1128, 486, 3685, 4316, 5225, 6349,
+    3292, 5906, 6497, 1297, 884, 7127, 6747, 1264, 5824, 7066, 3563, 1203, 5324, 4601, 3116, 2553,
+    4057, 2007, 5868, 2683, 6675, 7193, 2224, 5015, 6248, 385, 7160, 5679, 6319, 1330, 7449, 456,
+    2852, 4290, 717, 6580, 2511, 5504, 1843, 3659, 7290, 2165, 5622, 887, 2000, 3625, 5588, 5471,
+    4717, 4479, 2601, 634, 4641, 3735, 4296, 4590, 5775, 1586, 4816, 1427, 1959, 3797, 4983, 2726,
+    6882, 3566, 5840, 1569, 206, 1024, 6887, 395, 6393, 5339, 123, 2888, 5232, 2982, 4009, 6258,
+    4669, 1019, 2369, 4469, 2105, 3525, 2234, 5272, 416, 1986, 5419, 3191, 1810, 3025, 541, 6404,
+    3558, 988, 1037, 5283, 5345, 6851, 1311, 4510, 6390, 5335, 6178, 4019, 527, 6085, 7219, 2716,
+    3620, 6771, 908, 6900, 5564, 6047, 6777, 4622, 7174, 1735, 3378, 2616, 2437, 2889, 199, 5878,
+    2412, 6059, 6001, 5769, 2124, 1668, 1828, 1118, 5697, 3449, 1759, 7293, 1588, 5175, 157, 7451,
+    2890, 4843, 2595, 3959, 7129, 6911, 3324, 1266, 2756, 6335, 4752, 4340, 6614, 6985, 1430, 2524,
+    4746, 719, 4735, 6774, 911, 6946, 3551, 1083, 5357, 465, 6582, 2680, 336, 751, 6328, 644,
+    6474, 3744, 4747, 472, 3124, 3153, 6507, 3514, 4955, 563, 1248, 5387, 6914, 6199, 5021, 1051,
+    997, 2893, 2833, 6860, 5593, 1086, 1089, 6010, 7296, 2214, 1433, 84, 3814, 7224, 6354, 491,
+    6150, 566, 4749, 6429, 5656, 1919, 6949, 5223, 914, 2323, 6509, 278, 3288, 4744, 1122, 646,
+    1866, 1361, 6917, 4750, 5054, 1054, 6991, 1822, 2895, 5395, 3859, 5360, 2075, 6432, 569, 3895,
+    3712, 6988, 1356, 7111, 5090, 6952, 2145, 5615, 6802, 3969, 5662, 939, 4126, 611, 5835, 3980,
+    0, 6661, 3988, 798, 1642, 5702, 2204, 0, 0, 2384, 282, 81, 6560, 3276, 5940, 2735,
+    0, 0, 1189, 7052, 6482, 619, 1261, 3081, 339, 79, 5085, 6202, 5913, 4537, 3579, 697,
+    7041, 1178, 5864, 0, 3387, 0, 78, 4850, 4988, 2908, 4353, 0, 0, 7124, 0, 0,
+    0, 7121, 0, 1258, 2426, 5838, 5156, 3678, 7348, 3252, 2863, 1485, 0, 0, 0, 5743,
+    4927, 75, 0, 0, 3054, 0, 0, 0, 5293, 2800, 5748, 1454, 2793, 2137, 7317, 2743,
+    7118, 948, 365, 6228, 1255, 3948, 6811, 3643, 6763, 900, 0, 1665, 0, 0, 5213, 0,
+    6162, 3683, 6122, 4946, 4109, 2415, 85, 2104, 2968, 4596, 3995, 4980, 514, 6377, 5954, 5075,
+    1750, 4674, 4435, 3530, 5154, 38, 4121, 1899, 5606, 3546, 4849, 1397, 7260, 2557, 73, 3145,
+    6668, 3284, 1231, 2072, 2444, 4765, 4456, 0, 216, 7094, 1849, 3540, 805, 2954, 3318, 3371,
+    2697, 723, 659, 6522, 1299, 7162, 4302, 4217, 2461, 0, 6265, 6586, 6103, 0, 402, 0,
+    0, 1727, 0, 0, 0, 1596, 426, 4283, 5403, 5290, 7411, 1548, 6289, 4324, 7459, 2008,
+    3006, 878, 5029, 3589, 0, 0, 6606, 2150, 591, 2155, 6454, 6741, 2829, 3883, 0, 3137,
+    2472, 2206, 7307, 5590, 6876, 205, 7265, 1444, 0, 1013, 0, 5409, 4291, 5459, 2939, 102,
+    2847, 3014, 5543, 965, 5601, 2100, 6828, 1402, 7455, 1592, 1507, 2657, 1811, 2371, 7370, 5182,
+    3912, 2736, 5604, 5199, 4965, 181, 6163, 3786, 1967, 0, 5842, 63, 3721, 5977, 5011, 3634,
+    6407, 4423, 6133, 5918, 3095, 743, 544, 4706, 5368, 6003, 4118, 4130, 3703, 4920, 4800, 3432,
+    4365, 0, 4767, 715, 6578, 0, 7155, 1292, 2159, 4182, 2191, 3773, 0, 0, 3329, 5464,
+    4726, 3110, 6286, 2455, 494, 6357, 3973, 423, 5631, 2489, 2518, 4204, 508, 6371, 2376, 6018,
+    158, 7321, 5347, 1467, 0, 4428, 7175, 0, 5894, 0, 3629, 7330, 5513, 5704, 1312, 959,
+    5038, 3502, 4896, 3467, 2712, 0, 0, 0, 6246, 383, 3295, 1458, 3358, 1740, 0, 5151,
+    3864, 2832, 1622, 919, 4115, 88, 2652, 6791, 3422, 6903, 802, 6665, 6234, 5534, 1779, 3008,
+    3125, 371, 5113, 2819, 2696, 7399, 4136, 657, 3748, 1319, 1040, 3886, 7182, 6822, 6520, 5150,
+    1857, 6513, 7280, 6028, 928, 195, 6037, 3250, 1625, 693, 6782, 2267, 4369, 6556, 4913, 4474,
+    2924, 1475, 5429, 7338, 503, 6366, 4689, 1417, 1536, 2753, 3462, 650, 3155, 1879, 3435, 4464,
+    5905, 0, 3587, 2102, 2222, 4545, 4281, 0, 1322, 7185, 0, 0, 5525, 5201, 6125, 1629,
+    2177, 7335, 0, 6745, 4618, 0, 882, 6713, 6102, 1812, 5823, 5547, 5322, 1472, 850, 1931,
+    380, 3096, 5694, 2462, 4237, 3736, 4598, 1172, 6709, 846, 2169, 1872, 7035, 6495, 3353, 632,
+    6703, 840, 3918, 236, 2687, 0, 89, 4871, 6243, 4176, 0, 0, 0, 5740, 4721, 0,
+    3185, 3390, 822, 2302, 6697, 1584, 5160, 834, 5169, 454, 6685, 4658, 5597, 2397, 5273, 6317,
+    2636, 0, 0, 2187, 6271, 4930, 294, 2809, 7004, 6348, 7447, 485, 408, 1980, 3725, 1141,
+    784, 5845, 6550, 687, 6647, 3693, 2164, 5797, 6700, 837, 3982, 6159, 636, 6499, 0, 0,
+    3297, 0, 0, 0, 7079, 1216, 1760, 0, 1888, 4715, 4206, 2171, 3608, 0, 3360, 0,
+    2098, 91, 1326, 6676, 1496, 5141, 1955, 5132, 1331, 775, 6638, 813, 6519, 7391, 7194, 4440,
+    3168, 0, 6298, 4700, 0, 2485, 0, 0, 2565, 2695, 5299, 435, 892, 6755, 5473, 5337,
+    6682, 5479, 656, 2768, 2143, 1678, 2648, 7359, 215, 989, 1960, 1528, 5258, 6852, 2296, 1632,
+    185, 1022, 175, 6885, 1391, 7254, 2465, 5420, 7189, 7275, 2594, 1412, 819, 279, 3328, 4838,
+    2382, 2831, 3180, 6919, 2172, 4214, 6098, 4799, 444, 946, 6652, 5416, 6307, 789, 3107, 3362,
+    2996, 1056, 4523, 2418, 686, 4891, 5565, 6549, 3082, 5310, 2977, 6809, 4878, 2340, 3523, 830,
+    0, 0, 661, 3809, 6524, 0, 0, 4280, 0, 5737, 0, 0, 4685, 3586, 5492, 5764,
+    3430, 5400, 2606, 3970, 473, 4000, 6336, 2332, 3515, 0, 5437, 0, 0, 6312, 449, 6693,
+    1949, 5955, 0, 5891, 4786, 201, 4154, 4583, 5922, 0, 1695, 36, 0, 0, 5862, 0,
+    5509, 2737, 21, 1076, 5698, 6769, 6939, 4100, 5980, 254, 906, 2210, 0, 4014, 34, 2554,
+    7036, 1173, 1913, 5795, 2445, 5505, 0, 0, 5869, 1844, 4309, 7172, 4457, 1309, 3097, 4338,
+    7438, 0, 4487, 3770, 2588, 1733, 1575, 5461, 2613, 4485, 2218, 4644, 6409, 3475, 5024, 546,
+    3825, 7291, 1317, 2387, 4483, 4876, 3213, 118, 6971, 1108, 7002, 1428, 6402, 539, 1139, 3554,
+    1797, 7349, 1486, 4482, 2338, 6391, 2850, 3873, 1212, 5659, 7180, 7075, 7244, 528, 3344, 1381,
+    262, 459, 6866, 6322, 2065, 3689, 3965, 4426, 3949, 0, 1003, 42, 4354, 0, 5209, 4992,
+    6561, 5818, 2985, 5318, 6679, 292, 1046, 6909, 3210, 1764, 3791, 698, 4481, 3642, 816, 4855,
+    903, 6766, 1855, 3098, 2201, 1907, 1052, 4766, 0, 337, 5561, 6200, 0, 2727, 0, 0,
+    4360, 5967, 4733, 6462, 1359, 5733, 2111, 2717, 1344, 2638, 6290, 2542, 4093, 7207, 427, 1813,
+    3017, 3207, 2789, 5987, 2097, 3746, 5530, 599, 326, 5758, 6189, 4225, 6973, 4562, 7008, 4490,
+    1775, 6475, 7222, 3924, 673, 6536, 3801, 5874, 5192, 1110, 3018, 4729, 1145, 6022, 3319, 5349,
+    1043, 3206, 3635, 6035, 6906, 6229, 3604, 5422, 6062, 0, 0, 4937, 4125, 694, 0, 6557,
+    612, 2276, 128, 3118, 209, 0, 7396, 3468, 6579, 4808, 4911, 4647, 4982, 3741, 716, 3302,
+    64, 4017, 2738, 7264, 7387, 366, 1524, 2317, 2927, 5925, 1975, 103, 2593, 994, 3359, 1983,
+    1084, 5514, 3851, 6947, 7138, 1533, 2212, 1401, 4246, 5669, 2179, 6857, 6626, 5837, 1275, 763,
+    6600, 3624, 1232, 3385, 6283, 1493, 1985, 7356, 4465, 3769, 4042, 4821, 4543, 420, 7095, 4738,
+    4627, 3562, 3024, 3887, 6775, 912, 737, 2749, 6792, 929, 7412, 1549, 521, 6121, 3010, 2692,
+    2154, 2540, 2830, 431, 1254, 592, 7117, 6294, 6983, 6565, 5535, 3429, 2760, 3129, 1014, 6455,
+    2262, 4494, 635, 5750, 5212, 6915, 6384, 4619, 1202, 7065, 6498, 1074, 3291, 702, 1120, 6937,
+    6496, 6978, 3542, 1798, 1585, 5427, 1450, 7271, 3169, 1408, 3857, 633, 2780, 2626, 6241, 2771,
+    1749, 2562, 5465, 3920, 1115, 953, 3893, 7313, 2251, 3140, 6816, 7448, 5693, 265, 1814, 3040,
+    4529, 4678, 4900, 1126, 6127, 4832, 1542, 7405, 1268, 7131, 688, 6989, 409, 6551, 3943, 6272,
+    749, 3452, 6612, 2794, 5710, 3967, 2319, 2785, 2526, 2805, 1670, 6877, 2673, 2816, 378, 4080,
+    2299, 0, 0, 4872, 6131, 2480, 469, 5229, 6783, 3150, 920, 3099, 225, 7420, 5007, 1557,
+    6597, 6137, 3349, 893, 5921, 57, 3087, 6332, 734, 4925, 1723, 306, 6257, 2610, 394, 4313,
+    5787, 2539, 1392, 7255, 6480, 2501, 2309, 2931, 1932, 5167, 312, 4238, 4839, 2877, 5870, 2422,
+    2731, 5204, 3577, 617, 6653, 3574, 790, 3186, 728, 2003, 5962, 4645, 6591, 6756, 4260, 5388,
+    1992, 3810, 3327, 7419, 2185, 0, 0, 5274, 4711, 54, 1556, 3232, 1917, 3192, 5009, 5984,
+    0, 0, 0, 0, 1761, 6313, 450, 0, 1807, 0, 2797, 1696, 0, 0, 0, 0,
+    6645, 0, 2691, 5491, 2555, 0, 3201, 699, 6562, 5598, 3794, 3557, 4388, 6677, 5327, 814,
+    3911, 4210, 1973, 0, 4268, 3287, 1633, 1845, 0, 2642, 0, 0, 0, 0, 782, 0,
+    4682, 1174, 1819, 5657, 3528, 51, 3181, 5762, 0, 0, 614, 6477, 0, 0, 0, 1679,
+    3143, 2017, 1039, 6392, 529, 0, 6902, 0, 24, 3601, 6622, 121, 304, 7037, 759, 2330,
+    2190, 5934, 5298, 7166, 3610, 1195, 0, 0, 5744, 2114, 1303, 0, 561, 3199, 6424, 2537,
+    5094, 6201, 4095, 3100, 0, 338, 3971, 0, 104, 4536, 5912, 1854, 2392, 7058, 4513, 5734,
+    5526, 1277, 2280, 4859, 2391, 2972, 7140, 2074, 1150, 6476, 613, 7013, 3174, 4438, 643, 4847,
+    7328, 4458, 5302, 1953, 6434, 2258, 1465, 6805, 2446, 942, 4640, 1663, 1367, 2135, 4254, 6506,
+    27, 0, 5683, 1753, 703, 6009, 0, 0, 2255, 7076, 4142, 1213, 0, 5781, 2055, 5966,
+    6539, 3119, 4978, 855, 2672, 6718, 676, 6155, 4822, 3075, 1323, 7186, 7230, 6566, 1769, 571,
+    2306, 3257, 4580, 6463, 7096, 1233, 1887, 600, 0, 6817, 954, 0, 4433, 2243, 152, 3369,
+    7413, 1550, 2739, 245, 5953, 593, 3567, 3275, 3307, 6456, 1226, 313, 7089, 4073, 6034, 3572,
+    2912, 4873, 6027, 7019, 6043, 1865, 4006, 5053, 4498, 4317, 1156, 31, 695, 2662, 6558, 3055,
+    5382, 5443, 2474, 2264, 0, 1247, 2536, 0, 5466, 0, 5712, 0, 6266, 7110, 2035, 403,
+    2976, 0, 1785, 0, 3161, 6143, 5432, 4695, 5333, 0, 0, 0, 0, 0, 0, 1965,
+    6305, 1721, 5815, 442, 2953, 0, 2288, 2004, 3728, 5440, 5568, 6784, 921, 7014, 1151, 1815,
+    7440, 498, 2684, 1689, 7401, 6096, 1538, 1971, 4904, 5262, 4171, 2545, 665, 6361, 1577, 2095,
+    2194, 683, 6231, 6528, 1933, 3170, 6546, 5142, 5880, 2586, 7250, 1387, 2009, 4239, 368, 5498,
+    3520, 7132, 3699, 2766, 5275, 7372, 2559, 1509, 4129, 1698, 1175, 4382, 3193, 1269, 7038, 1870,
+    0, 0, 1671, 70, 0, 4542, 1762, 0, 0, 4038, 0, 6015, 4265, 5736, 4076, 5032,
+    7421, 3474, 5699, 557, 0, 1558, 0, 0, 1703, 0, 2582, 0, 5658, 5549, 3182, 3023,
+    6420, 2360, 5945, 5389, 3083, 6451, 588, 3005, 3870, 1639, 3236, 4592, 4996, 4314, 4631, 5027,
+    678, 3494, 6832, 257, 3663, 4499, 7024, 3498, 3152, 3312, 1161, 0, 1835, 3972, 302, 3403,
+    4152, 1435, 969, 6541, 3321, 6739, 2549, 7298, 6563, 4615, 700, 3341, 159, 876, 2592, 115,
+    478, 0, 0, 1652, 5239, 1794, 6341, 2393, 2740, 2689, 0, 0, 5928, 2517, 0, 4459,
+    5594, 1214, 2030, 242, 1488, 7351, 5046, 7077, 2527, 0, 7167, 1304, 6161, 0, 2670, 2579,
+    19, 5457, 6569, 4823, 5074, 1706, 1712, 3766, 105, 773, 7202, 4349, 1339, 7458, 4420, 6636,
+    1236, 5692, 706, 5857, 7099, 502, 1595, 6240, 1816, 2062, 696, 377, 354, 6217, 6896, 1033,
+    3961, 3109, 4024, 2454, 7028, 4547, 1165, 2388, 3398, 1560, 4500, 3756, 6567, 704, 2904, 5559,
+    7187, 1324, 1090, 5871, 2016, 6365, 5724, 6559, 6818, 1947, 4963, 4062, 3101, 3729, 955, 6129,
+    2229, 3544, 4943, 4116, 1604, 173, 5999, 5148, 5, 4874, 2650, 5630, 480, 7423, 3171, 59,
+    7373, 3426, 5841, 2460, 3866, 1672, 4201, 5986, 2993, 6799, 3061, 1510, 936, 6953, 7133, 1270,
+    183, 7009, 1146, 4345, 3701, 5062, 5222, 7232, 6405, 1603, 4, 3042, 542, 7422, 1369, 1559,
+    6642, 779, 3847, 6070, 4521, 5700, 3094, 1820, 666, 6529, 171, 5028, 1970, 2678, 6343, 5390,
+    2394, 2277, 2138, 1874, 537, 2019, 1659, 2823, 7000, 5058, 7039, 2482, 1176, 293, 2152, 4783,
+    6564, 701, 3241, 6400, 4997, 1714, 2741, 3419, 0, 2938, 1137, 7115, 4034, 1252, 5553, 271,
+    7168, 1305, 810, 3247, 2963, 2042, 2922, 2221, 6743, 880, 0, 2094, 1279, 0, 3337, 6673,
+    5768, 5524, 112, 492, 2271, 7142, 6355, 3048, 6173, 7283, 4824, 5254, 5665, 106, 5821, 1420,
+    7188, 2378, 4262, 5321, 5907, 956, 4202, 2438, 705, 3444, 5198, 1517, 6568, 7424, 1325, 7380,
+    6570, 7031, 3550, 2424, 4972, 1340, 707, 4501, 2998, 1781, 267, 1934, 1168, 4875, 4387, 1817,
+    4090, 1522, 3383, 5126, 5433, 3757, 6490, 1715, 7385, 627, 5947, 3938, 5367, 4430, 3102, 5932,
+    2310, 6819, 1838, 7203, 3789, 5671, 5003, 1763, 0, 4919, 6530, 667, 2677, 0, 5140, 1561,
+    4552, 6040, 3680, 7040, 2198, 1177, 3784, 4401, 0, 6543, 6049, 4535, 0, 0, 3175, 5911,
+    7237, 1374, 1716, 5305, 4757, 5676, 4885, 4998, 4220, 230, 150, 5240, 0, 5752, 3088, 5653,
+    1170, 5852, 5288, 6315, 680, 7033, 4067, 6285, 2742, 709, 4502, 6572, 6758, 5929, 895, 452,
+    0, 3076, 422, 2878, 3420, 2628, 3947, 4657, 7204, 6571, 1341, 3955, 708, 5135, 1818, 3103,
+    796, 6922, 5434, 1059, 6659, 3628, 0, 4304, 3758, 179, 5680, 4553, 7306, 1443, 0, 5208,
+    7425, 5651, 1562, 3253, 4397, 4255, 4666, 5756, 4576, 4105, 3836, 671, 4271, 5044, 3070, 4948,
+    1641, 4693, 3884, 3230, 1375, 6345, 7238, 5377, 2366, 2052, 6534, 2395, 2866, 482, 7034, 4001,
+    3104, 7208, 4437, 1345, 3326, 1099, 6962, 6573, 5184, 1717, 1171, 710, 2199, 1901, 2709, 4503,
+    2499, 5435, 4934, 5773, 0, 0, 0, 2577, 3934, 0, 4713, 0, 6152, 0, 0, 0,
+    4554, 1718, 7239, 4367, 3989, 4761, 109, 2200, 4184, 5813, 1376, 2900, 2503, 4814, 0, 5684,
+    0, 6615, 4504, 0, 7209, 3105, 5452, 1346, 6574, 752, 6066, 711, 2286, 0, 5873, 4924,
+    2600, 0, 0, 4555, 496, 4779, 6359, 0, 0, 2304, 4688, 1908, 4804, 1719, 7240, 1377,
+    3393, 0, 0, 0, 4864, 0, 0, 5993, 1347, 7210, 0, 0, 0, 0, 0, 5645,
+    7241, 1378, 2614, 5103, 7183, 1320, 1720, 5685, 2658, 41, 1219, 5572, 7082, 6093, 1956, 3269,
+    392, 3366, 3753, 6723, 362, 3487, 860, 5686, 6255, 6225, 0, 0, 0, 1628, 0, 2227,
+    0, 0, 0, 1860, 4244, 3674, 0, 0, 3568, 0, 5279, 0, 4652, 4623, 2417, 0
+};
+
+/*
+** Best flush (or straight flush) for five, six or seven
+** suited cards, indexed by the 13-bit rank mask of those
+** cards.  Entries containing a zero mean that mask does
+** not hold between five and seven ranks.
+*/
+const unsigned short flushes7[] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1599,
+    0, 0, 0, 0, 0, 0, 0, 1598, 0, 0, 0, 1597, 0, 1596, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1595,
+    0, 0, 0, 0, 0, 0, 0, 1594, 0, 0, 0, 1593, 0, 1592, 1591, 9,
+    0, 0, 0, 0, 0, 0, 0, 1590, 0, 0, 0, 1589, 0, 1588, 1587, 1587,
+    0, 0, 0, 1586, 0, 1585, 1584, 1584, 0, 1583, 1582, 1582, 7, 7, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1581,
+    0, 0, 0, 0, 0, 0, 0, 1580, 0, 0, 0, 1579, 0, 1578, 1577, 9,
+    0, 0, 0, 0, 0, 0, 0, 1576, 0, 0, 0, 1575, 0, 1574, 1573, 1573,
+    0, 0, 0, 1572, 0, 1571, 1570, 1570, 0, 1569, 1568, 1568, 1567, 1567, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1566, 0, 0, 0, 1565, 0, 1564, 1563, 1563,
+    0, 0, 0, 1562, 0, 1561, 1560, 1560, 0, 1559, 1558, 1558, 1557, 1557, 1557, 9,
+    0, 0, 0, 1556, 0, 1555, 1554, 1554, 0, 1553, 1552, 1552, 1551, 1551, 1551, 1551,
+    0, 1550, 1549, 1549, 1548, 1548, 1548, 1548, 6, 6, 6, 6, 6, 6, 6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1547,
+    0, 0, 0, 0, 0, 0, 0, 1546, 0, 0, 0, 1545, 0, 1544, 1543, 9,
+    0, 0, 0, 0, 0, 0, 0, 1542, 0, 0, 0, 1541, 0, 1540, 1539, 1539,
+    0, 0, 0, 1538, 0, 1537, 1536, 1536, 0, 1535, 1534, 1534, 1533, 1533, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1532, 0, 0, 0, 1531, 0, 1530, 1529, 1529,
+    0, 0, 0, 1528, 0, 1527, 1526, 1526, 0, 1525, 1524, 1524, 1523, 1523, 1523, 9,
+    0, 0, 0, 1522, 0, 1521, 1520, 1520, 0, 1519, 1518, 1518, 1517, 1517, 1517, 1517,
+    0, 1516, 1515, 1515, 1514, 1514, 1514, 1514, 1513, 1513, 1513, 1513, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1512, 0, 0, 0, 1511, 0, 1510, 1509, 1509,
+    0, 0, 0, 1508, 0, 1507, 1506, 1506, 0, 1505, 1504, 1504, 1503, 1503, 1503, 9,
+    0, 0, 0, 1502, 0, 1501, 1500, 1500, 0, 1499, 1498, 1498, 1497, 1497, 1497, 1497,
+    0, 1496, 1495, 1495, 1494, 1494, 1494, 1494, 1493, 1493, 1493, 1493, 1493, 1493, 8, 0,
+    0, 0, 0, 1492, 0, 1491, 1490, 1490, 0, 1489, 1488, 1488, 1487, 1487, 1487, 1487,
+    0, 1486, 1485, 1485, 1484, 1484, 1484, 1484, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 0,
+    0, 1482, 1481, 1481, 1480, 1480, 1480, 1480, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1478,
+    0, 0, 0, 0, 0, 0, 0, 1477, 0, 0, 0, 1476, 0, 1475, 1474, 9,
+    0, 0, 0, 0, 0, 0, 0, 1473, 0, 0, 0, 1472, 0, 1471, 1470, 1470,
+    0, 0, 0, 1469, 0, 1468, 1467, 1467, 0, 1466, 1465, 1465, 1464, 1464, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1463, 0, 0, 0, 1462, 0, 1461, 1460, 1460,
+    0, 0, 0, 1459, 0, 1458, 1457, 1457, 0, 1456, 1455, 1455, 1454, 1454, 1454, 9,
+    0, 0, 0, 1453, 0, 1452, 1451, 1451, 0, 1450, 1449, 1449, 1448, 1448, 1448, 1448,
+    0, 1447, 1446, 1446, 1445, 1445, 1445, 1445, 1444, 1444, 1444, 1444, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1443, 0, 0, 0, 1442, 0, 1441, 1440, 1440,
+    0, 0, 0, 1439, 0, 1438, 1437, 1437, 0, 1436, 1435, 1435, 1434, 1434, 1434, 9,
+    0, 0, 0, 1433, 0, 1432, 1431, 1431, 0, 1430, 1429, 1429, 1428, 1428, 1428, 1428,
+    0, 1427, 1426, 1426, 1425, 1425, 1425, 1425, 1424, 1424, 1424, 1424, 1424, 1424, 8, 0,
+    0, 0, 0, 1423, 0, 1422, 1421, 1421, 0, 1420, 1419, 1419, 1418, 1418, 1418, 1418,
+    0, 1417, 1416, 1416, 1415, 1415, 1415, 1415, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 0,
+    0, 1413, 1412, 1412, 1411, 1411, 1411, 1411, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 0,
+    1409, 1409, 1409, 1409, 1409, 1409, 1409, 0, 6, 6, 6, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1408, 0, 0, 0, 1407, 0, 1406, 1405, 1405,
+    0, 0, 0, 1404, 0, 1403, 1402, 1402, 0, 1401, 1400, 1400, 1399, 1399, 1399, 9,
+    0, 0, 0, 1398, 0, 1397, 1396, 1396, 0, 1395, 1394, 1394, 1393, 1393, 1393, 1393,
+    0, 1392, 1391, 1391, 1390, 1390, 1390, 1390, 1389, 1389, 1389, 1389, 1389, 1389, 8, 0,
+    0, 0, 0, 1388, 0, 1387, 1386, 1386, 0, 1385, 1384, 1384, 1383, 1383, 1383, 1383,
+    0, 1382, 1381, 1381, 1380, 1380, 1380, 1380, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 0,
+    0, 1378, 1377, 1377, 1376, 1376, 1376, 1376, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 0,
+    1374, 1374, 1374, 1374, 1374, 1374, 1374, 0, 1374, 1374, 1374, 0, 7, 0, 0, 0,
+    0, 0, 0, 1373, 0, 1372, 1371, 1371, 0, 1370, 1369, 1369, 1368, 1368, 1368, 1368,
+    0, 1367, 1366, 1366, 1365, 1365, 1365, 1365, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 0,
+    0, 1363, 1362, 1362, 1361, 1361, 1361, 1361, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 0,
+    1359, 1359, 1359, 1359, 1359, 1359, 1359, 0, 1359, 1359, 1359, 0, 1359, 0, 0, 0,
+    0, 1358, 1357, 1357, 1356, 1356, 1356, 1356, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 0,
+    1354, 1354, 1354, 1354, 1354, 1354, 1354, 0, 1354, 1354, 1354, 0, 1354, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 0, 0, 0,
+    4, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1353,
+    0, 0, 0, 0, 0, 0, 0, 1352, 0, 0, 0, 1351, 0, 1350, 1349, 9,
+    0, 0, 0, 0, 0, 0, 0, 1348, 0, 0, 0, 1347, 0, 1346, 1345, 1345,
+    0, 0, 0, 1344, 0, 1343, 1342, 1342, 0, 1341, 1340, 1340, 1339, 1339, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1338, 0, 0, 0, 1337, 0, 1336, 1335, 1335,
+    0, 0, 0, 1334, 0, 1333, 1332, 1332, 0, 1331, 1330, 1330, 1329, 1329, 1329, 9,
+    0, 0, 0, 1328, 0, 1327, 1326, 1326, 0, 1325, 1324, 1324, 1323, 1323, 1323, 1323,
+    0, 1322, 1321, 1321, 1320, 1320, 1320, 1320, 1319, 1319, 1319, 1319, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1318, 0, 0, 0, 1317, 0, 1316, 1315, 1315,
+    0, 0, 0, 1314, 0, 1313, 1312, 1312, 0, 1311, 1310, 1310, 1309, 1309, 1309, 9,
+    0, 0, 0, 1308, 0, 1307, 1306, 1306, 0, 1305, 1304, 1304, 1303, 1303, 1303, 1303,
+    0, 1302, 1301, 1301, 1300, 1300, 1300, 1300, 1299, 1299, 1299, 1299, 1299, 1299, 8, 0,
+    0, 0, 0, 1298, 0, 1297, 1296, 1296, 0, 1295, 1294, 1294, 1293, 1293, 1293, 1293,
+    0, 1292, 1291, 1291, 1290, 1290, 1290, 1290, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 0,
+    0, 1288, 1287, 1287, 1286, 1286, 1286, 1286, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 0,
+    1284, 1284, 1284, 1284, 1284, 1284, 1284, 0, 6, 6, 6, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1283, 0, 0, 0, 1282, 0, 1281, 1280, 1280,
+    0, 0, 0, 1279, 0, 1278, 1277, 1277, 0, 1276, 1275, 1275, 1274, 1274, 1274, 9,
+    0, 0, 0, 1273, 0, 1272, 1271, 1271, 0, 1270, 1269, 1269, 1268, 1268, 1268, 1268,
+    0, 1267, 1266, 1266, 1265, 1265, 1265, 1265, 1264, 1264, 1264, 1264, 1264, 1264, 8, 0,
+    0, 0, 0, 1263, 0, 1262, 1261, 1261, 0, 1260, 1259, 1259, 1258, 1258, 1258, 1258,
+    0, 1257, 1256, 1256, 1255, 1255, 1255, 1255, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 0,
+    0, 1253, 1252, 1252, 1251, 1251, 1251, 1251, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 0,
+    1249, 1249, 1249, 1249, 1249, 1249, 1249, 0, 1249, 1249, 1249, 0, 7, 0, 0, 0,
+    0, 0, 0, 1248, 0, 1247, 1246, 1246, 0, 1245, 1244, 1244, 1243, 1243, 1243, 1243,
+    0, 1242, 1241, 1241, 1240, 1240, 1240, 1240, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 0,
+    0, 1238, 1237, 1237, 1236, 1236, 1236, 1236, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 0,
+    1234, 1234, 1234, 1234, 1234, 1234, 1234, 0, 1234, 1234, 1234, 0, 1234, 0, 0, 0,
+    0, 1233, 1232, 1232, 1231, 1231, 1231, 1231, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 0,
+    1229, 1229, 1229, 1229, 1229, 1229, 1229, 0, 1229, 1229, 1229, 0, 1229, 0, 0, 0,
+    1228, 1228, 1228, 1228, 1228, 1228, 1228, 0, 1228, 1228, 1228, 0, 1228, 0, 0, 0,
+    5, 5, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1227, 0, 0, 0, 1226, 0, 1225, 1224, 1224,
+    0, 0, 0, 1223, 0, 1222, 1221, 1221, 0, 1220, 1219, 1219, 1218, 1218, 1218, 9,
+    0, 0, 0, 1217, 0, 1216, 1215, 1215, 0, 1214, 1213, 1213, 1212, 1212, 1212, 1212,
+    0, 1211, 1210, 1210, 1209, 1209, 1209, 1209, 1208, 1208, 1208, 1208, 1208, 1208, 8, 0,
+    0, 0, 0, 1207, 0, 1206, 1205, 1205, 0, 1204, 1203, 1203, 1202, 1202, 1202, 1202,
+    0, 1201, 1200, 1200, 1199, 1199, 1199, 1199, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 0,
+    0, 1197, 1196, 1196, 1195, 1195, 1195, 1195, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 0,
+    1193, 1193, 1193, 1193, 1193, 1193, 1193, 0, 1193, 1193, 1193, 0, 7, 0, 0, 0,
+    0, 0, 0, 1192, 0, 1191, 1190, 1190, 0, 1189, 1188, 1188, 1187, 1187, 1187, 1187,
+    0, 1186, 1185, 1185, 1184, 1184, 1184, 1184, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 0,
+    0, 1182, 1181, 1181, 1180, 1180, 1180, 1180, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 0,
+    1178, 1178, 1178, 1178, 1178, 1178, 1178, 0, 1178, 1178, 1178, 0, 1178, 0, 0, 0,
+    0, 1177, 1176, 1176, 1175, 1175, 1175, 1175, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 0,
+    1173, 1173, 1173, 1173, 1173, 1173, 1173, 0, 1173, 1173, 1173, 0, 1173, 0, 0, 0,
+    1172, 1172, 1172, 1172, 1172, 1172, 1172, 0, 1172, 1172, 1172, 0, 1172, 0, 0, 0,
+    1172, 1172, 1172, 0, 1172, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1171, 0, 1170, 1169, 1169, 0, 1168, 1167, 1167, 1166, 1166, 1166, 1166,
+    0, 1165, 1164, 1164, 1163, 1163, 1163, 1163, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 0,
+    0, 1161, 1160, 1160, 1159, 1159, 1159, 1159, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 0,
+    1157, 1157, 1157, 1157, 1157, 1157, 1157, 0, 1157, 1157, 1157, 0, 1157, 0, 0, 0,
+    0, 1156, 1155, 1155, 1154, 1154, 1154, 1154, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 0,
+    1152, 1152, 1152, 1152, 1152, 1152, 1152, 0, 1152, 1152, 1152, 0, 1152, 0, 0, 0,
+    1151, 1151, 1151, 1151, 1151, 1151, 1151, 0, 1151, 1151, 1151, 0, 1151, 0, 0, 0,
+    1151, 1151, 1151, 0, 1151, 0, 0, 0, 1151, 0, 0, 0, 0, 0, 0, 0,
+    0, 1150, 1149, 1149, 1148, 1148, 1148, 1148, 1147, 1147, 1147, 1147, 1147, 1147, 1147, 0,
+    1146, 1146, 1146, 1146, 1146, 1146, 1146, 0, 1146, 1146, 1146, 0, 1146, 0, 0, 0,
+    1145, 1145, 1145, 1145, 1145, 1145, 1145, 0, 1145, 1145, 1145, 0, 1145, 0, 0, 0,
+    1145, 1145, 1145, 0, 1145, 0, 0, 0, 1145, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 0, 0, 0,
+    3, 3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1144,
+    0, 0, 0, 0, 0, 0, 0, 1143, 0, 0, 0, 1142, 0, 1141, 1140, 9,
+    0, 0, 0, 0, 0, 0, 0, 1139, 0, 0, 0, 1138, 0, 1137, 1136, 1136,
+    0, 0, 0, 1135, 0, 1134, 1133, 1133, 0, 1132, 1131, 1131, 1130, 1130, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1129, 0, 0, 0, 1128, 0, 1127, 1126, 1126,
+    0, 0, 0, 1125, 0, 1124, 1123, 1123, 0, 1122, 1121, 1121, 1120, 1120, 1120, 9,
+    0, 0, 0, 1119, 0, 1118, 1117, 1117, 0, 1116, 1115, 1115, 1114, 1114, 1114, 1114,
+    0, 1113, 1112, 1112, 1111, 1111, 1111, 1111, 1110, 1110, 1110, 1110, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1109, 0, 0, 0, 1108, 0, 1107, 1106, 1106,
+    0, 0, 0, 1105, 0, 1104, 1103, 1103, 0, 1102, 1101, 1101, 1100, 1100, 1100, 9,
+    0, 0, 0, 1099, 0, 1098, 1097, 1097, 0, 1096, 1095, 1095, 1094, 1094, 1094, 1094,
+    0, 1093, 1092, 1092, 1091, 1091, 1091, 1091, 1090, 1090, 1090, 1090, 1090, 1090, 8, 0,
+    0, 0, 0, 1089, 0, 1088, 1087, 1087, 0, 1086, 1085, 1085, 1084, 1084, 1084, 1084,
+    0, 1083, 1082, 1082, 1081, 1081, 1081, 1081, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 0,
+    0, 1079, 1078, 1078, 1077, 1077, 1077, 1077, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 0,
+    1075, 1075, 1075, 1075, 1075, 1075, 1075, 0, 6, 6, 6, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1074, 0, 0, 0, 1073, 0, 1072, 1071, 1071,
+    0, 0, 0, 1070, 0, 1069, 1068, 1068, 0, 1067, 1066, 1066, 1065, 1065, 1065, 9,
+    0, 0, 0, 1064, 0, 1063, 1062, 1062, 0, 1061, 1060, 1060, 1059, 1059, 1059, 1059,
+    0, 1058, 1057, 1057, 1056, 1056, 1056, 1056, 1055, 1055, 1055, 1055, 1055, 1055, 8, 0,
+    0, 0, 0, 1054, 0, 1053, 1052, 1052, 0, 1051, 1050, 1050, 1049, 1049, 1049, 1049,
+    0, 1048, 1047, 1047, 1046, 1046, 1046, 1046, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 0,
+    0, 1044, 1043, 1043, 1042, 1042, 1042, 1042, 1041, 1041, 1041, 1041, 1041, 1041, 1041, 0,
+    1040, 1040, 1040, 1040, 1040, 1040, 1040, 0, 1040, 1040, 1040, 0, 7, 0, 0, 0,
+    0, 0, 0, 1039, 0, 1038, 1037, 1037, 0, 1036, 1035, 1035, 1034, 1034, 1034, 1034,
+    0, 1033, 1032, 1032, 1031, 1031, 1031, 1031, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 0,
+    0, 1029, 1028, 1028, 1027, 1027, 1027, 1027, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 0,
+    1025, 1025, 1025, 1025, 1025, 1025, 1025, 0, 1025, 1025, 1025, 0, 1025, 0, 0, 0,
+    0, 1024, 1023, 1023, 1022, 1022, 1022, 1022, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 0,
+    1020, 1020, 1020, 1020, 1020, 1020, 1020, 0, 1020, 1020, 1020, 0, 1020, 0, 0, 0,
+    1019, 1019, 1019, 1019, 1019, 1019, 1019, 0, 1019, 1019, 1019, 0, 1019, 0, 0, 0,
+    5, 5, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1018, 0, 0, 0, 1017, 0, 1016, 1015, 1015,
+    0, 0, 0, 1014, 0, 1013, 1012, 1012, 0, 1011, 1010, 1010, 1009, 1009, 1009, 9,
+    0, 0, 0, 1008, 0, 1007, 1006, 1006, 0, 1005, 1004, 1004, 1003, 1003, 1003, 1003,
+    0, 1002, 1001, 1001, 1000, 1000, 1000, 1000, 999, 999, 999, 999, 999, 999, 8, 0,
+    0, 0, 0, 998, 0, 997, 996, 996, 0, 995, 994, 994, 993, 993, 993, 993,
+    0, 992, 991, 991, 990, 990, 990, 990, 989, 989, 989, 989, 989, 989, 989, 0,
+    0, 988, 987, 987, 986, 986, 986, 986, 985, 985, 985, 985, 985, 985, 985, 0,
+    984, 984, 984, 984, 984, 984, 984, 0, 984, 984, 984, 0, 7, 0, 0, 0,
+    0, 0, 0, 983, 0, 982, 981, 981, 0, 980, 979, 979, 978, 978, 978, 978,
+    0, 977, 976, 976, 975, 975, 975, 975, 974, 974, 974, 974, 974, 974, 974, 0,
+    0, 973, 972, 972, 971, 971, 971, 971, 970, 970, 970, 970, 970, 970, 970, 0,
+    969, 969, 969, 969, 969, 969, 969, 0, 969, 969, 969, 0, 969, 0, 0, 0,
+    0, 968, 967, 967, 966, 966, 966, 966, 965, 965, 965, 965, 965, 965, 965, 0,
+    964, 964, 964, 964, 964, 964, 964, 0, 964, 964, 964, 0, 964, 0, 0, 0,
+    963, 963, 963, 963, 963, 963, 963, 0, 963, 963, 963, 0, 963, 0, 0, 0,
+    963, 963, 963, 0, 963, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 962, 0, 961, 960, 960, 0, 959, 958, 958, 957, 957, 957, 957,
+    0, 956, 955, 955, 954, 954, 954, 954, 953, 953, 953, 953, 953, 953, 953, 0,
+    0, 952, 951, 951, 950, 950, 950, 950, 949, 949, 949, 949, 949, 949, 949, 0,
+    948, 948, 948, 948, 948, 948, 948, 0, 948, 948, 948, 0, 948, 0, 0, 0,
+    0, 947, 946, 946, 945, 945, 945, 945, 944, 944, 944, 944, 944, 944, 944, 0,
+    943, 943, 943, 943, 943, 943, 943, 0, 943, 943, 943, 0, 943, 0, 0, 0,
+    942, 942, 942, 942, 942, 942, 942, 0, 942, 942, 942, 0, 942, 0, 0, 0,
+    942, 942, 942, 0, 942, 0, 0, 0, 942, 0, 0, 0, 0, 0, 0, 0,
+    0, 941, 940, 940, 939, 939, 939, 939, 938, 938, 938, 938, 938, 938, 938, 0,
+    937, 937, 937, 937, 937, 937, 937, 0, 937, 937, 937, 0, 937, 0, 0, 0,
+    936, 936, 936, 936, 936, 936, 936, 0, 936, 936, 936, 0, 936, 0, 0, 0,
+    936, 936, 936, 0, 936, 0, 0, 0, 936, 0, 0, 0, 0, 0, 0, 0,
+    935, 935, 935, 935, 935, 935, 935, 0, 935, 935, 935, 0, 935, 0, 0, 0,
+    935, 935, 935, 0, 935, 0, 0, 0, 935, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 934, 0, 0, 0, 933, 0, 932, 931, 931,
+    0, 0, 0, 930, 0, 929, 928, 928, 0, 927, 926, 926, 925, 925, 925, 9,
+    0, 0, 0, 924, 0, 923, 922, 922, 0, 921, 920, 920, 919, 919, 919, 919,
+    0, 918, 917, 917, 916, 916, 916, 916, 915, 915, 915, 915, 915, 915, 8, 0,
+    0, 0, 0, 914, 0, 913, 912, 912, 0, 911, 910, 910, 909, 909, 909, 909,
+    0, 908, 907, 907, 906, 906, 906, 906, 905, 905, 905, 905, 905, 905, 905, 0,
+    0, 904, 903, 903, 902, 902, 902, 902, 901, 901, 901, 901, 901, 901, 901, 0,
+    900, 900, 900, 900, 900, 900, 900, 0, 900, 900, 900, 0, 7, 0, 0, 0,
+    0, 0, 0, 899, 0, 898, 897, 897, 0, 896, 895, 895, 894, 894, 894, 894,
+    0, 893, 892, 892, 891, 891, 891, 891, 890, 890, 890, 890, 890, 890, 890, 0,
+    0, 889, 888, 888, 887, 887, 887, 887, 886, 886, 886, 886, 886, 886, 886, 0,
+    885, 885, 885, 885, 885, 885, 885, 0, 885, 885, 885, 0, 885, 0, 0, 0,
+    0, 884, 883, 883, 882, 882, 882, 882, 881, 881, 881, 881, 881, 881, 881, 0,
+    880, 880, 880, 880, 880, 880, 880, 0, 880, 880, 880, 0, 880, 0, 0, 0,
+    879, 879, 879, 879, 879, 879, 879, 0, 879, 879, 879, 0, 879, 0, 0, 0,
+    879, 879, 879, 0, 879, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 878, 0, 877, 876, 876, 0, 875, 874, 874, 873, 873, 873, 873,
+    0, 872, 871, 871, 870, 870, 870, 870, 869, 869, 869, 869, 869, 869, 869, 0,
+    0, 868, 867, 867, 866, 866, 866, 866, 865, 865, 865, 865, 865, 865, 865, 0,
+    864, 864, 864, 864, 864, 864, 864, 0, 864, 864, 864, 0, 864, 0, 0, 0,
+    0, 863, 862, 862, 861, 861, 861, 861, 860, 860, 860, 860, 860, 860, 860, 0,
+    859, 859, 859, 859, 859, 859, 859, 0, 859, 859, 859, 0, 859, 0, 0, 0,
+    858, 858, 858, 858, 858, 858, 858, 0, 858, 858, 858, 0, 858, 0, 0, 0,
+    858, 858, 858, 0, 858, 0, 0, 0, 858, 0, 0, 0, 0, 0, 0, 0,
+    0, 857, 856, 856, 855, 855, 855, 855, 854, 854, 854, 854, 854, 854, 854, 0,
+    853, 853, 853, 853, 853, 853, 853, 0, 853, 853, 853, 0, 853, 0, 0, 0,
+    852, 852, 852, 852, 852, 852, 852, 0, 852, 852, 852, 0, 852, 0, 0, 0,
+    852, 852, 852, 0, 852, 0, 0, 0, 852, 0, 0, 0, 0, 0, 0, 0,
+    851, 851, 851, 851, 851, 851, 851, 0, 851, 851, 851, 0, 851, 0, 0, 0,
+    851, 851, 851, 0, 851, 0, 0, 0, 851, 0, 0, 0, 0, 0, 0, 0,
+    851, 851, 851, 0, 851, 0, 0, 0, 851, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 850, 0, 849, 848, 848, 0, 847, 846, 846, 845, 845, 845, 845,
+    0, 844, 843, 843, 842, 842, 842, 842, 841, 841, 841, 841, 841, 841, 841, 0,
+    0, 840, 839, 839, 838, 838, 838, 838, 837, 837, 837, 837, 837, 837, 837, 0,
+    836, 836, 836, 836, 836, 836, 836, 0, 836, 836, 836, 0, 836, 0, 0, 0,
+    0, 835, 834, 834, 833, 833, 833, 833, 832, 832, 832, 832, 832, 832, 832, 0,
+    831, 831, 831, 831, 831, 831, 831, 0, 831, 831, 831, 0, 831, 0, 0, 0,
+    830, 830, 830, 830, 830, 830, 830, 0, 830, 830, 830, 0, 830, 0, 0, 0,
+    830, 830, 830, 0, 830, 0, 0, 0, 830, 0, 0, 0, 0, 0, 0, 0,
+    0, 829, 828, 828, 827, 827, 827, 827, 826, 826, 826, 826, 826, 826, 826, 0,
+    825, 825, 825, 825, 825, 825, 825, 0, 825, 825, 825, 0, 825, 0, 0, 0,
+    824, 824, 824, 824, 824, 824, 824, 0, 824, 824, 824, 0, 824, 0, 0, 0,
+    824, 824, 824, 0, 824, 0, 0, 0, 824, 0, 0, 0, 0, 0, 0, 0,
+    823, 823, 823, 823, 823, 823, 823, 0, 823, 823, 823, 0, 823, 0, 0, 0,
+    823, 823, 823, 0, 823, 0, 0, 0, 823, 0, 0, 0, 0, 0, 0, 0,
+    823, 823, 823, 0, 823, 0, 0, 0, 823, 0, 0, 0, 0, 0, 0, 0,
+    823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 822, 821, 821, 820, 820, 820, 820, 819, 819, 819, 819, 819, 819, 819, 0,
+    818, 818, 818, 818, 818, 818, 818, 0, 818, 818, 818, 0, 818, 0, 0, 0,
+    817, 817, 817, 817, 817, 817, 817, 0, 817, 817, 817, 0, 817, 0, 0, 0,
+    817, 817, 817, 0, 817, 0, 0, 0, 817, 0, 0, 0, 0, 0, 0, 0,
+    816, 816, 816, 816, 816, 816, 816, 0, 816, 816, 816, 0, 816, 0, 0, 0,
+    816, 816, 816, 0, 816, 0, 0, 0, 816, 0, 0, 0, 0, 0, 0, 0,
+    816, 816, 816, 0, 816, 0, 0, 0, 816, 0, 0, 0, 0, 0, 0, 0,
+    816, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 0, 0, 0,
+    2, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 815, 0, 0, 0, 814, 0, 813, 812, 9,
+    0, 0, 0, 0, 0, 0, 0, 811, 0, 0, 0, 810, 0, 809, 808, 10,
+    0, 0, 0, 807, 0, 806, 805, 805, 0, 804, 803, 803, 802, 802, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 801, 0, 0, 0, 800, 0, 799, 798, 10,
+    0, 0, 0, 797, 0, 796, 795, 795, 0, 794, 793, 793, 792, 792, 792, 9,
+    0, 0, 0, 791, 0, 790, 789, 789, 0, 788, 787, 787, 786, 786, 786, 10,
+    0, 785, 784, 784, 783, 783, 783, 783, 782, 782, 782, 782, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 781, 0, 0, 0, 780, 0, 779, 778, 10,
+    0, 0, 0, 777, 0, 776, 775, 775, 0, 774, 773, 773, 772, 772, 772, 9,
+    0, 0, 0, 771, 0, 770, 769, 769, 0, 768, 767, 767, 766, 766, 766, 10,
+    0, 765, 764, 764, 763, 763, 763, 763, 762, 762, 762, 762, 762, 762, 8, 0,
+    0, 0, 0, 761, 0, 760, 759, 759, 0, 758, 757, 757, 756, 756, 756, 10,
+    0, 755, 754, 754, 753, 753, 753, 753, 752, 752, 752, 752, 752, 752, 752, 0,
+    0, 751, 750, 750, 749, 749, 749, 749, 748, 748, 748, 748, 748, 748, 748, 0,
+    747, 747, 747, 747, 747, 747, 747, 0, 6, 6, 6, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 746, 0, 0, 0, 745, 0, 744, 743, 10,
+    0, 0, 0, 742, 0, 741, 740, 740, 0, 739, 738, 738, 737, 737, 737, 9,
+    0, 0, 0, 736, 0, 735, 734, 734, 0, 733, 732, 732, 731, 731, 731, 10,
+    0, 730, 729, 729, 728, 728, 728, 728, 727, 727, 727, 727, 727, 727, 8, 0,
+    0, 0, 0, 726, 0, 725, 724, 724, 0, 723, 722, 722, 721, 721, 721, 10,
+    0, 720, 719, 719, 718, 718, 718, 718, 717, 717, 717, 717, 717, 717, 717, 0,
+    0, 716, 715, 715, 714, 714, 714, 714, 713, 713, 713, 713, 713, 713, 713, 0,
+    712, 712, 712, 712, 712, 712, 712, 0, 712, 712, 712, 0, 7, 0, 0, 0,
+    0, 0, 0, 711, 0, 710, 709, 709, 0, 708, 707, 707, 706, 706, 706, 10,
+    0, 705, 704, 704, 703, 703, 703, 703, 702, 702, 702, 702, 702, 702, 702, 0,
+    0, 701, 700, 700, 699, 699, 699, 699, 698, 698, 698, 698, 698, 698, 698, 0,
+    697, 697, 697, 697, 697, 697, 697, 0, 697, 697, 697, 0, 697, 0, 0, 0,
+    0, 696, 695, 695, 694, 694, 694, 694, 693, 693, 693, 693, 693, 693, 693, 0,
+    692, 692, 692, 692, 692, 692, 692, 0, 692, 692, 692, 0, 692, 0, 0, 0,
+    691, 691, 691, 691, 691, 691, 691, 0, 691, 691, 691, 0, 691, 0, 0, 0,
+    5, 5, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 689, 0, 688, 687, 10,
+    0, 0, 0, 686, 0, 685, 684, 684, 0, 683, 682, 682, 681, 681, 681, 9,
+    0, 0, 0, 680, 0, 679, 678, 678, 0, 677, 676, 676, 675, 675, 675, 10,
+    0, 674, 673, 673, 672, 672, 672, 672, 671, 671, 671, 671, 671, 671, 8, 0,
+    0, 0, 0, 670, 0, 669, 668, 668, 0, 667, 666, 666, 665, 665, 665, 10,
+    0, 664, 663, 663, 662, 662, 662, 662, 661, 661, 661, 661, 661, 661, 661, 0,
+    0, 660, 659, 659, 658, 658, 658, 658, 657, 657, 657, 657, 657, 657, 657, 0,
+    656, 656, 656, 656, 656, 656, 656, 0, 656, 656, 656, 0, 7, 0, 0, 0,
+    0, 0, 0, 655, 0, 654, 653, 653, 0, 652, 651, 651, 650, 650, 650, 10,
+    0, 649, 648, 648, 647, 647, 647, 647, 646, 646, 646, 646, 646, 646, 646, 0,
+    0, 645, 644, 644, 643, 643, 643, 643, 642, 642, 642, 642, 642, 642, 642, 0,
+    641, 641, 641, 641, 641, 641, 641, 0, 641, 641, 641, 0, 641, 0, 0, 0,
+    0, 640, 639, 639, 638, 638, 638, 638, 637, 637, 637, 637, 637, 637, 637, 0,
+    636, 636, 636, 636, 636, 636, 636, 0, 636, 636, 636, 0, 636, 0, 0, 0,
+    635, 635, 635, 635, 635, 635, 635, 0, 635, 635, 635, 0, 635, 0, 0, 0,
+    635, 635, 635, 0, 635, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 634, 0, 633, 632, 632, 0, 631, 630, 630, 629, 629, 629, 10,
+    0, 628, 627, 627, 626, 626, 626, 626, 625, 625, 625, 625, 625, 625, 625, 0,
+    0, 624, 623, 623, 622, 622, 622, 622, 621, 621, 621, 621, 621, 621, 621, 0,
+    620, 620, 620, 620, 620, 620, 620, 0, 620, 620, 620, 0, 620, 0, 0, 0,
+    0, 619, 618, 618, 617, 617, 617, 617, 616, 616, 616, 616, 616, 616, 616, 0,
+    615, 615, 615, 615, 615, 615, 615, 0, 615, 615, 615, 0, 615, 0, 0, 0,
+    614, 614, 614, 614, 614, 614, 614, 0, 614, 614, 614, 0, 614, 0, 0, 0,
+    614, 614, 614, 0, 614, 0, 0, 0, 614, 0, 0, 0, 0, 0, 0, 0,
+    0, 613, 612, 612, 611, 611, 611, 611, 610, 610, 610, 610, 610, 610, 610, 0,
+    609, 609, 609, 609, 609, 609, 609, 0, 609, 609, 609, 0, 609, 0, 0, 0,
+    608, 608, 608, 608, 608, 608, 608, 0, 608, 608, 608, 0, 608, 0, 0, 0,
+    608, 608, 608, 0, 608, 0, 0, 0, 608, 0, 0, 0, 0, 0, 0, 0,
+    607, 607, 607, 607, 607, 607, 607, 0, 607, 607, 607, 0, 607, 0, 0, 0,
+    607, 607, 607, 0, 607, 0, 0, 0, 607, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 606, 0, 0, 0, 605, 0, 604, 603, 10,
+    0, 0, 0, 602, 0, 601, 600, 600, 0, 599, 598, 598, 597, 597, 597, 9,
+    0, 0, 0, 596, 0, 595, 594, 594, 0, 593, 592, 592, 591, 591, 591, 10,
+    0, 590, 589, 589, 588, 588, 588, 588, 587, 587, 587, 587, 587, 587, 8, 0,
+    0, 0, 0, 586, 0, 585, 584, 584, 0, 583, 582, 582, 581, 581, 581, 10,
+    0, 580, 579, 579, 578, 578, 578, 578, 577, 577, 577, 577, 577, 577, 577, 0,
+    0, 576, 575, 575, 574, 574, 574, 574, 573, 573, 573, 573, 573, 573, 573, 0,
+    572, 572, 572, 572, 572, 572, 572, 0, 572, 572, 572, 0, 7, 0, 0, 0,
+    0, 0, 0, 571, 0, 570, 569, 569, 0, 568, 567, 567, 566, 566, 566, 10,
+    0, 565, 564, 564, 563, 563, 563, 563, 562, 562, 562, 562, 562, 562, 562, 0,
+    0, 561, 560, 560, 559, 559, 559, 559, 558, 558, 558, 558, 558, 558, 558, 0,
+    557, 557, 557, 557, 557, 557, 557, 0, 557, 557, 557, 0, 557, 0, 0, 0,
+    0, 556, 555, 555, 554, 554, 554, 554, 553, 553, 553, 553, 553, 553, 553, 0,
+    552, 552, 552, 552, 552, 552, 552, 0, 552, 552, 552, 0, 552, 0, 0, 0,
+    551, 551, 551, 551, 551, 551, 551, 0, 551, 551, 551, 0, 551, 0, 0, 0,
+    551, 551, 551, 0, 551, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 550, 0, 549, 548, 548, 0, 547, 546, 546, 545, 545, 545, 10,
+    0, 544, 543, 543, 542, 542, 542, 542, 541, 541, 541, 541, 541, 541, 541, 0,
+    0, 540, 539, 539, 538, 538, 538, 538, 537, 537, 537, 537, 537, 537, 537, 0,
+    536, 536, 536, 536, 536, 536, 536, 0, 536, 536, 536, 0, 536, 0, 0, 0,
+    0, 535, 534, 534, 533, 533, 533, 533, 532, 532, 532, 532, 532, 532, 532, 0,
+    531, 531, 531, 531, 531, 531, 531, 0, 531, 531, 531, 0, 531, 0, 0, 0,
+    530, 530, 530, 530, 530, 530, 530, 0, 530, 530, 530, 0, 530, 0, 0, 0,
+    530, 530, 530, 0, 530, 0, 0, 0, 530, 0, 0, 0, 0, 0, 0, 0,
+    0, 529, 528, 528, 527, 527, 527, 527, 526, 526, 526, 526, 526, 526, 526, 0,
+    525, 525, 525, 525, 525, 525, 525, 0, 525, 525, 525, 0, 525, 0, 0, 0,
+    524, 524, 524, 524, 524, 524, 524, 0, 524, 524, 524, 0, 524, 0, 0, 0,
+    524, 524, 524, 0, 524, 0, 0, 0, 524, 0, 0, 0, 0, 0, 0, 0,
+    523, 523, 523, 523, 523, 523, 523, 0, 523, 523, 523, 0, 523, 0, 0, 0,
+    523, 523, 523, 0, 523, 0, 0, 0, 523, 0, 0, 0, 0, 0, 0, 0,
+    523, 523, 523, 0, 523, 0, 0, 0, 523, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 522, 0, 521, 520, 520, 0, 519, 518, 518, 517, 517, 517, 10,
+    0, 516, 515, 515, 514, 514, 514, 514, 513, 513, 513, 513, 513, 513, 513, 0,
+    0, 512, 511, 511, 510, 510, 510, 510, 509, 509, 509, 509, 509, 509, 509, 0,
+    508, 508, 508, 508, 508, 508, 508, 0, 508, 508, 508, 0, 508, 0, 0, 0,
+    0, 507, 506, 506, 505, 505, 505, 505, 504, 504, 504, 504, 504, 504, 504, 0,
+    503, 503, 503, 503, 503, 503, 503, 0, 503, 503, 503, 0, 503, 0, 0, 0,
+    502, 502, 502, 502, 502, 502, 502, 0, 502, 502, 502, 0, 502, 0, 0, 0,
+    502, 502, 502, 0, 502, 0, 0, 0, 502, 0, 0, 0, 0, 0, 0, 0,
+    0, 501, 500, 500, 499, 499, 499, 499, 498, 498, 498, 498, 498, 498, 498, 0,
+    497, 497, 497, 497, 497, 497, 497, 0, 497, 497, 497, 0, 497, 0, 0, 0,
+    496, 496, 496, 496, 496, 496, 496, 0, 496, 496, 496, 0, 496, 0, 0, 0,
+    496, 496, 496, 0, 496, 0, 0, 0, 496, 0, 0, 0, 0, 0, 0, 0,
+    495, 495, 495, 495, 495, 495, 495, 0, 495, 495, 495, 0, 495, 0, 0, 0,
+    495, 495, 495, 0, 495, 0, 0, 0, 495, 0, 0, 0, 0, 0, 0, 0,
+    495, 495, 495, 0, 495, 0, 0, 0, 495, 0, 0, 0, 0, 0, 0, 0,
+    495, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 494, 493, 493, 492, 492, 492, 492, 491, 491, 491, 491, 491, 491, 491, 0,
+    490, 490, 490, 490, 490, 490, 490, 0, 490, 490, 490, 0, 490, 0, 0, 0,
+    489, 489, 489, 489, 489, 489, 489, 0, 489, 489, 489, 0, 489, 0, 0, 0,
+    489, 489, 489, 0, 489, 0, 0, 0, 489, 0, 0, 0, 0, 0, 0, 0,
+    488, 488, 488, 488, 488, 488, 488, 0, 488, 488, 488, 0, 488, 0, 0, 0,
+    488, 488, 488, 0, 488, 0, 0, 0, 488, 0, 0, 0, 0, 0, 0, 0,
+    488, 488, 488, 0, 488, 0, 0, 0, 488, 0, 0, 0, 0, 0, 0, 0,
+    488, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    487, 487, 487, 487, 487, 487, 487, 0, 487, 487, 487, 0, 487, 0, 0, 0,
+    487, 487, 487, 0, 487, 0, 0, 0, 487, 0, 0, 0, 0, 0, 0, 0,
+    487, 487, 487, 0, 487, 0, 0, 0, 487, 0, 0, 0, 0, 0, 0, 0,
+    487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 486, 0, 0, 0, 485, 0, 484, 483, 10,
+    0, 0, 0, 482, 0, 481, 480, 480, 0, 479, 478, 478, 477, 477, 477, 9,
+    0, 0, 0, 476, 0, 475, 474, 474, 0, 473, 472, 472, 471, 471, 471, 10,
+    0, 470, 469, 469, 468, 468, 468, 468, 467, 467, 467, 467, 467, 467, 8, 0,
+    0, 0, 0, 466, 0, 465, 464, 464, 0, 463, 462, 462, 461, 461, 461, 10,
+    0, 460, 459, 459, 458, 458, 458, 458, 457, 457, 457, 457, 457, 457, 457, 0,
+    0, 456, 455, 455, 454, 454, 454, 454, 453, 453, 453, 453, 453, 453, 453, 0,
+    452, 452, 452, 452, 452, 452, 452, 0, 452, 452, 452, 0, 7, 0, 0, 0,
+    0, 0, 0, 451, 0, 450, 449, 449, 0, 448, 447, 447, 446, 446, 446, 10,
+    0, 445, 444, 444, 443, 443, 443, 443, 442, 442, 442, 442, 442, 442, 442, 0,
+    0, 441, 440, 440, 439, 439, 439, 439, 438, 438, 438, 438, 438, 438, 438, 0,
+    437, 437, 437, 437, 437, 437, 437, 0, 437, 437, 437, 0, 437, 0, 0, 0,
+    0, 436, 435, 435, 434, 434, 434, 434, 433, 433, 433, 433, 433, 433, 433, 0,
+    432, 432, 432, 432, 432, 432, 432, 0, 432, 432, 432, 0, 432, 0, 0, 0,
+    431, 431, 431, 431, 431, 431, 431, 0, 431, 431, 431, 0, 431, 0, 0, 0,
+    431, 431, 431, 0, 431, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 430, 0, 429, 428, 428, 0, 427, 426, 426, 425, 425, 425, 10,
+    0, 424, 423, 423, 422, 422, 422, 422, 421, 421, 421, 421, 421, 421, 421, 0,
+    0, 420, 419, 419, 418, 418, 418, 418, 417, 417, 417, 417, 417, 417, 417, 0,
+    416, 416, 416, 416, 416, 416, 416, 0, 416, 416, 416, 0, 416, 0, 0, 0,
+    0, 415, 414, 414, 413, 413, 413, 413, 412, 412, 412, 412, 412, 412, 412, 0,
+    411, 411, 411, 411, 411, 411, 411, 0, 411, 411, 411, 0, 411, 0, 0, 0,
+    410, 410, 410, 410, 410, 410, 410, 0, 410, 410, 410, 0, 410, 0, 0, 0,
+    410, 410, 410, 0, 410, 0, 0, 0, 410, 0, 0, 0, 0, 0, 0, 0,
+    0, 409, 408, 408, 407, 407, 407, 407, 406, 406, 406, 406, 406, 406, 406, 0,
+    405, 405, 405, 405, 405, 405, 405, 0, 405, 405, 405, 0, 405, 0, 0, 0,
+    404, 404, 404, 404, 404, 404, 404, 0, 404, 404, 404, 0, 404, 0, 0, 0,
+    404, 404, 404, 0, 404, 0, 0, 0, 404, 0, 0, 0, 0, 0, 0, 0,
+    403, 403, 403, 403, 403, 403, 403, 0, 403, 403, 403, 0, 403, 0, 0, 0,
+    403, 403, 403, 0, 403, 0, 0, 0, 403, 0, 0, 0, 0, 0, 0, 0,
+    403, 403, 403, 0, 403, 0, 0, 0, 403, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 402, 0, 401, 400, 400, 0, 399, 398, 398, 397, 397, 397, 10,
+    0, 396, 395, 395, 394, 394, 394, 394, 393, 393, 393, 393, 393, 393, 393, 0,
+    0, 392, 391, 391, 390, 390, 390, 390, 389, 389, 389, 389, 389, 389, 389, 0,
+    388, 388, 388, 388, 388, 388, 388, 0, 388, 388, 388, 0, 388, 0, 0, 0,
+    0, 387, 386, 386, 385, 385, 385, 385, 384, 384, 384, 384, 384, 384, 384, 0,
+    383, 383, 383, 383, 383, 383, 383, 0, 383, 383, 383, 0, 383, 0, 0, 0,
+    382, 382, 382, 382, 382, 382, 382, 0, 382, 382, 382, 0, 382, 0, 0, 0,
+    382, 382, 382, 0, 382, 0, 0, 0, 382, 0, 0, 0, 0, 0, 0, 0,
+    0, 381, 380, 380, 379, 379, 379, 379, 378, 378, 378, 378, 378, 378, 378, 0,
+    377, 377, 377, 377, 377, 377, 377, 0, 377, 377, 377, 0, 377, 0, 0, 0,
+    376, 376, 376, 376, 376, 376, 376, 0, 376, 376, 376, 0, 376, 0, 0, 0,
+    376, 376, 376, 0, 376, 0, 0, 0, 376, 0, 0, 0, 0, 0, 0, 0,
+    375, 375, 375, 375, 375, 375, 375, 0, 375, 375, 375, 0, 375, 0, 0, 0,
+    375, 375, 375, 0, 375, 0, 0, 0, 375, 0, 0, 0, 0, 0, 0, 0,
+    375, 375, 375, 0, 375, 0, 0, 0, 375, 0, 0, 0, 0, 0, 0, 0,
+    375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 374, 373, 373, 372, 372, 372, 372, 371, 371, 371, 371, 371, 371, 371, 0,
+    370, 370, 370, 370, 370, 370, 370, 0, 370, 370, 370, 0, 370, 0, 0, 0,
+    369, 369, 369, 369, 369, 369, 369, 0, 369, 369, 369, 0, 369, 0, 0, 0,
+    369, 369, 369, 0, 369, 0, 0, 0, 369, 0, 0, 0, 0, 0, 0, 0,
+    368, 368, 368, 368, 368, 368, 368, 0, 368, 368, 368, 0, 368, 0, 0, 0,
+    368, 368, 368, 0, 368, 0, 0, 0, 368, 0, 0, 0, 0, 0, 0, 0,
+    368, 368, 368, 0, 368, 0, 0, 0, 368, 0, 0, 0, 0, 0, 0, 0,
+    368, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    367, 367, 367, 367, 367, 367, 367, 0, 367, 367, 367, 0, 367, 0, 0, 0,
+    367, 367, 367, 0, 367, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0,
+    367, 367, 367, 0, 367, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0,
+    367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    367, 367, 367, 0, 367, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0,
+    367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 366, 0, 365, 364, 364, 0, 363, 362, 362, 361, 361, 361, 10,
+    0, 360, 359, 359, 358, 358, 358, 358, 357, 357, 357, 357, 357, 357, 357, 0,
+    0, 356, 355, 355, 354, 354, 354, 354, 353, 353, 353, 353, 353, 353, 353, 0,
+    352, 352, 352, 352, 352, 352, 352, 0, 352, 352, 352, 0, 352, 0, 0, 0,
+    0, 351, 350, 350, 349, 349, 349, 349, 348, 348, 348, 348, 348, 348, 348, 0,
+    347, 347, 347, 347, 347, 347, 347, 0, 347, 347, 347, 0, 347, 0, 0, 0,
+    346, 346, 346, 346, 346, 346, 346, 0, 346, 346, 346, 0, 346, 0, 0, 0,
+    346, 346, 346, 0, 346, 0, 0, 0, 346, 0, 0, 0, 0, 0, 0, 0,
+    0, 345, 344, 344, 343, 343, 343, 343, 342, 342, 342, 342, 342, 342, 342, 0,
+    341, 341, 341, 341, 341, 341, 341, 0, 341, 341, 341, 0, 341, 0, 0, 0,
+    340, 340, 340, 340, 340, 340, 340, 0, 340, 340, 340, 0, 340, 0, 0, 0,
+    340, 340, 340, 0, 340, 0, 0, 0, 340, 0, 0, 0, 0, 0, 0, 0,
+    339, 339, 339, 339, 339, 339, 339, 0, 339, 339, 339, 0, 339, 0, 0, 0,
+    339, 339, 339, 0, 339, 0, 0, 0, 339, 0, 0, 0, 0, 0, 0, 0,
+    339, 339, 339, 0, 339, 0, 0, 0, 339, 0, 0, 0, 0, 0, 0, 0,
+    339, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 338, 337, 337, 336, 336, 336, 336, 335, 335, 335, 335, 335, 335, 335, 0,
+    334, 334, 334, 334, 334, 334, 334, 0, 334, 334, 334, 0, 334, 0, 0, 0,
+    333, 333, 333, 333, 333, 333, 333, 0, 333, 333, 333, 0, 333, 0, 0, 0,
+    333, 333, 333, 0, 333, 0, 0, 0, 333, 0, 0, 0, 0, 0, 0, 0,
+    332, 332, 332, 332, 332, 332, 332, 0, 332, 332, 332, 0, 332, 0, 0, 0,
+    332, 332, 332, 0, 332, 0, 0, 0, 332, 0, 0, 0, 0, 0, 0, 0,
+    332, 332, 332, 0, 332, 0, 0, 0, 332, 0, 0, 0, 0, 0, 0, 0,
+    332, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    331, 331, 331, 331, 331, 331, 331, 0, 331, 331, 331, 0, 331, 0, 0, 0,
+    331, 331, 331, 0, 331, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0, 0,
+    331, 331, 331, 0, 331, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0, 0,
+    331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    331, 331, 331, 0, 331, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0, 0,
+    331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 330, 329, 329, 328, 328, 328, 328, 327, 327, 327, 327, 327, 327, 327, 0,
+    326, 326, 326, 326, 326, 326, 326, 0, 326, 326, 326, 0, 326, 0, 0, 0,
+    325, 325, 325, 325, 325, 325, 325, 0, 325, 325, 325, 0, 325, 0, 0, 0,
+    325, 325, 325, 0, 325, 0, 0, 0, 325, 0, 0, 0, 0, 0, 0, 0,
+    324, 324, 324, 324, 324, 324, 324, 0, 324, 324, 324, 0, 324, 0, 0, 0,
+    324, 324, 324, 0, 324, 0, 0, 0, 324, 0, 0, 0, 0, 0, 0, 0,
+    324, 324, 324, 0, 324, 0, 0, 0, 324, 0, 0, 0, 0, 0, 0, 0,
+    324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    323, 323, 323, 323, 323, 323, 323, 0, 323, 323, 323, 0, 323, 0, 0, 0,
+    323, 323, 323, 0, 323, 0, 0, 0, 323, 0, 0, 0, 0, 0, 0, 0,
+    323, 323, 323, 0, 323, 0, 0, 0, 323, 0, 0, 0, 0, 0, 0, 0,
+    323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    323, 323, 323, 0, 323, 0, 0, 0, 323, 0, 0, 0, 0, 0, 0, 0,
+    323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+#ifdef COMPACT_TABLES
+
+/*
+** Compact replacement for flushes[] and unique5[]: entry i
+** holds { flushes[q], unique5[q] } for the five-bit mask q
+** of colex rank i.  See rank5_index() in pokereval.h.
+*/
+const unsigned short packed5[][2] =
+{
+    { 9, 1608 }, { 1599, 7462 }, { 1598, 7461 }, { 1597, 7460 }, { 1596, 7459 }, { 8, 1607 },
+    { 1595, 7458 }, { 1594, 7457 }, { 1593, 7456 }, { 1592, 7455 }, { 1591, 7454 }, { 1590, 7453 },
+    { 1589, 7452 }, { 1588, 7451 }, { 1587, 7450 }, { 1586, 7449 }, { 1585, 7448 }, { 1584, 7447 },
+    { 1583, 7446 }, { 1582, 7445 }, { 7, 1606 }, { 1581, 7444 }, { 1580, 7443 }, { 1579, 7442 },
+    { 1578, 7441 }, { 1577, 7440 }, { 1576, 7439 }, { 1575, 7438 }, { 1574, 7437 }, { 1573, 7436 },
+    { 1572, 7435 }, { 1571, 7434 }, { 1570, 7433 }, { 1569, 7432 }, { 1568, 7431 }, { 1567, 7430 },
+    { 1566, 7429 }, { 1565, 7428 }, { 1564, 7427 }, { 1563, 7426 }, { 1562, 7425 }, { 1561, 7424 },
+    { 1560, 7423 }, { 1559, 7422 }, { 1558, 7421 }, { 1557, 7420 }, { 1556, 7419 }, { 1555, 7418 },
+    { 1554, 7417 }, { 1553, 7416 }, { 1552, 7415 }, { 1551, 7414 }, { 1550, 7413 }, { 1549, 7412 },
+    { 1548, 7411 }, { 6, 1605 }, { 1547, 7410 }, { 1546, 7409 }, { 1545, 7408 }, { 1544, 7407 },
+    { 1543, 7406 }, { 1542, 7405 }, { 1541, 7404 }, { 1540, 7403 }, { 1539, 7402 }, { 1538, 7401 },
+    { 1537, 7400 }, { 1536, 7399 }, { 1535, 7398 }, { 1534, 7397 }, { 1533, 7396 }, { 1532, 7395 },
+    { 1531, 7394 }, { 1530, 7393 }, { 1529, 7392 }, { 1528, 7391 }, { 1527, 7390 }, { 1526, 7389 },
+    { 1525, 7388 }, { 1524, 7387 }, { 1523, 7386 }, { 1522, 7385 }, { 1521, 7384 }, { 1520, 7383 },
+    { 1519, 7382 }, { 1518, 7381 }, { 1517, 7380 }, { 1516, 7379 }, { 1515, 7378 }, { 1514, 7377 },
+    { 1513, 7376 }, { 1512, 7375 }, { 1511, 7374 }, { 1510, 7373 }, { 1509, 7372 }, { 1508, 7371 },
+    { 1507, 7370 }, { 1506, 7369 }, { 1505, 7368 }, { 1504, 7367 }, { 1503, 7366 }, { 1502, 7365 },
+    { 1501, 7364 }, { 1500, 7363 }, { 1499, 7362 }, { 1498, 7361 }, { 1497, 7360 }, { 1496, 7359 },
+    { 1495, 7358 }, { 1494, 7357 }, { 1493, 7356 }, { 1492, 7355 }, { 1491, 7354 }, { 1490, 7353 },
+    { 1489, 7352 }, { 1488, 7351 }, { 1487, 7350 }, { 1486, 7349 }, { 1485, 7348 }, { 1484, 7347 },
+    { 1483, 7346 }, { 1482, 7345 }, { 1481, 7344 }, { 1480, 7343 }, { 1479, 7342 }, { 5, 1604 },
+    { 1478, 7341 }, { 1477, 7340 }, { 1476, 7339 }, { 1475, 7338 }, { 1474, 7337 }, { 1473, 7336 },
+    { 1472, 7335 }, { 1471, 7334 }, { 1470, 7333 }, { 1469, 7332 }, { 1468, 7331 }, { 1467, 7330 },
+    { 1466, 7329 }, { 1465, 7328 }, { 1464, 7327 }, { 1463, 7326 }, { 1462, 7325 }, { 1461, 7324 },
+    { 1460, 7323 }, { 1459, 7322 }, { 1458, 7321 }, { 1457, 7320 }, { 1456, 7319 }, { 1455, 7318 },
+    { 1454, 7317 }, { 1453, 7316 }, { 1452, 7315 }, { 1451, 7314 }, { 1450, 7313 }, { 1449, 7312 },
+    { 1448, 7311 }, { 1447, 7310 }, { 1446, 7309 }, { 1445, 7308 }, { 1444, 7307 }, { 1443, 7306 },
+    { 1442, 7305 }, { 1441, 7304 }, { 1440, 7303 }, { 1439, 7302 }, { 1438, 7301 }, { 1437, 7300 },
+    { 1436, 7299 }, { 1435, 7298 }, { 1434, 7297 }, { 1433, 7296 }, { 1432, 7295 }, { 1431, 7294 },
+    { 1430, 7293 }, { 1429, 7292 }, { 1428, 7291 }, { 1427, 7290 }, { 1426, 7289 }, { 1425, 7288 },
+    { 1424, 7287 }, { 1423, 7286 }, { 1422, 7285 }, { 1421, 7284 }, { 1420, 7283 }, { 1419, 7282 },
+    { 1418, 7281 }, { 1417, 7280 }, { 1416, 7279 }, { 1415, 7278 }, { 1414, 7277 }, { 1413, 7276 },
+    { 1412, 7275 }, { 1411, 7274 }, { 1410, 7273 }, { 1409, 7272 }, { 1408, 7271 }, { 1407, 7270 },
+    { 1406, 7269 }, { 1405, 7268 }, { 1404, 7267 }, { 1403, 7266 }, { 1402, 7265 }, { 1401, 7264 },
+    { 1400, 7263 }, { 1399, 7262 }, { 1398, 7261 }, { 1397, 7260 }, { 1396, 7259 }, { 1395, 7258 },
+    { 1394, 7257 }, { 1393, 7256 }, { 1392, 7255 }, { 1391, 7254 }, { 1390, 7253 }, { 1389, 7252 },
+    { 1388, 7251 }, { 1387, 7250 }, { 1386, 7249 }, { 1385, 7248 }, { 1384, 7247 }, { 1383, 7246 },
+    { 1382, 7245 }, { 1381, 7244 }, { 1380, 7243 }, { 1379, 7242 }, { 1378, 7241 }, { 1377, 7240 },
+    { 1376, 7239 }, { 1375, 7238 }, { 1374, 7237 }, { 1373, 7236 }, { 1372, 7235 }, { 1371, 7234 },
+    { 1370, 7233 }, { 1369, 7232 }, { 1368, 7231 }, { 1367, 7230 }, { 1366, 7229 }, { 1365, 7228 },
+    { 1364, 7227 }, { 1363, 7226 }, { 1362, 7225 }, { 1361, 7224 }, { 1360, 7223 }, { 1359, 7222 },
+    { 1358, 7221 }, { 1357, 7220 }, { 1356, 7219 }, { 1355, 7218 }, { 1354, 7217 }, { 4, 1603 },
+    { 1353, 7216 }, { 1352, 7215 }, { 1351, 7214 }, { 1350, 7213 }, { 1349, 7212 }, { 1348, 7211 },
+    { 1347, 7210 }, { 1346, 7209 }, { 1345, 7208 }, { 1344, 7207 }, { 1343, 7206 }, { 1342, 7205 },
+    { 1341, 7204 }, { 1340, 7203 }, { 1339, 7202 }, { 1338, 7201 }, { 1337, 7200 }, { 1336, 7199 },
+    { 1335, 7198 }, { 1334, 7197 }, { 1333, 7196 }, { 1332, 7195 }, { 1331, 7194 }, { 1330, 7193 },
+    { 1329, 7192 }, { 1328, 7191 }, { 1327, 7190 }, { 1326, 7189 }, { 1325, 7188 }, { 1324, 7187 },
+    { 1323, 7186 }, { 1322, 7185 }, { 1321, 7184 }, { 1320, 7183 }, { 1319, 7182 }, { 1318, 7181 },
+    { 1317, 7180 }, { 1316, 7179 }, { 1315, 7178 }, { 1314, 7177 }, { 1313, 7176 }, { 1312, 7175 },
+    { 1311, 7174 }, { 1310, 7173 }, { 1309, 7172 }, { 1308, 7171 }, { 1307, 7170 }, { 1306, 7169 },
+    { 1305, 7168 }, { 1304, 7167 }, { 1303, 7166 }, { 1302, 7165 }, { 1301, 7164 }, { 1300, 7163 },
+    { 1299, 7162 }, { 1298, 7161 }, { 1297, 7160 }, { 1296, 7159 }, { 1295, 7158 }, { 1294, 7157 },
+    { 1293, 7156 }, { 1292, 7155 }, { 1291, 7154 }, { 1290, 7153 }, { 1289, 7152 }, { 1288, 7151 },
+    { 1287, 7150 }, { 1286, 7149 }, { 1285, 7148 }, { 1284, 7147 }, { 1283, 7146 }, { 1282, 7145 },
+    { 1281, 7144 }, { 1280, 7143 }, { 1279, 7142 }, { 1278, 7141 }, { 1277, 7140 }, { 1276, 7139 },
+    { 1275, 7138 }, { 1274, 7137 }, { 1273, 7136 }, { 1272, 7135 }, { 1271, 7134 }, { 1270, 7133 },
+    { 1269, 7132 }, { 1268, 7131 }, { 1267, 7130 }, { 1266, 7129 }, { 1265, 7128 }, { 1264, 7127 },
+    { 1263, 7126 }, { 1262, 7125 }, { 1261, 7124 }, { 1260, 7123 }, { 1259, 7122 }, { 1258, 7121 },
+    { 1257, 7120 }, { 1256, 7119 }, { 1255, 7118 }, { 1254, 7117 }, { 1253, 7116 }, { 1252, 7115 },
+    { 1251, 7114 }, { 1250, 7113 }, { 1249, 7112 }, { 1248, 7111 }, { 1247, 7110 }, { 1246, 7109 },
+    { 1245, 7108 }, { 1244, 7107 }, { 1243, 7106 }, { 1242, 7105 }, { 1241, 7104 }, { 1240, 7103 },
+    { 1239, 7102 }, { 1238, 7101 }, { 1237, 7100 }, { 1236, 7099 }, { 1235, 7098 }, { 1234, 7097 },
+    { 1233, 7096 }, { 1232, 7095 }, { 1231, 7094 }, { 1230, 7093 }, { 1229, 7092 }, { 1228, 7091 },
+    { 1227, 7090 }, { 1226, 7089 }, { 1225, 7088 }, { 1224, 7087 }, { 1223, 7086 }, { 1222, 7085 },
+    { 1221, 7084 }, { 1220, 7083 }, { 1219, 7082 }, { 1218, 7081 }, { 1217, 7080 }, { 1216, 7079 },
+    { 1215, 7078 }, { 1214, 7077 }, { 1213, 7076 }, { 1212, 7075 }, { 1211, 7074 }, { 1210, 7073 },
+    { 1209, 7072 }, { 1208, 7071 }, { 1207, 7070 }, { 1206, 7069 }, { 1205, 7068 }, { 1204, 7067 },
+    { 1203, 7066 }, { 1202, 7065 }, { 1201, 7064 }, { 1200, 7063 }, { 1199, 7062 }, { 1198, 7061 },
+    { 1197, 7060 }, { 1196, 7059 }, { 1195, 7058 }, { 1194, 7057 }, { 1193, 7056 }, { 1192, 7055 },
+    { 1191, 7054 }, { 1190, 7053 }, { 1189, 7052 }, { 1188, 7051 }, { 1187, 7050 }, { 1186, 7049 },
+    { 1185, 7048 }, { 1184, 7047 }, { 1183, 7046 }, { 1182, 7045 }, { 1181, 7044 }, { 1180, 7043 },
+    { 1179, 7042 }, { 1178, 7041 }, { 1177, 7040 }, { 1176, 7039 }, { 1175, 7038 }, { 1174, 7037 },
+    { 1173, 7036 }, { 1172, 7035 }, { 1171, 7034 }, { 1170, 7033 }, { 1169, 7032 }, { 1168, 7031 },
+    { 1167, 7030 }, { 1166, 7029 }, { 1165, 7028 }, { 1164, 7027 }, { 1163, 7026 }, { 1162, 7025 },
+    { 1161, 7024 }, { 1160, 7023 }, { 1159, 7022 }, { 1158, 7021 }, { 1157, 7020 }, { 1156, 7019 },
+    { 1155, 7018 }, { 1154, 7017 }, { 1153, 7016 }, { 1152, 7015 }, { 1151, 7014 }, { 1150, 7013 },
+    { 1149, 7012 }, { 1148, 7011 }, { 1147, 7010 }, { 1146, 7009 }, { 1145, 7008 }, { 3, 1602 },
+    { 1144, 7007 }, { 1143, 7006 }, { 1142, 7005 }, { 1141, 7004 }, { 1140, 7003 }, { 1139, 7002 },
+    { 1138, 7001 }, { 1137, 7000 }, { 1136, 6999 }, { 1135, 6998 }, { 1134, 6997 }, { 1133, 6996 },
+    { 1132, 6995 }, { 1131, 6994 }, { 1130, 6993 }, { 1129, 6992 }, { 1128, 6991 }, { 1127, 6990 },
+    { 1126, 6989 }, { 1125, 6988 }, { 1124, 6987 }, { 1123, 6986 }, { 1122, 6985 }, { 1121, 6984 },
+    { 1120, 6983 }, { 1119, 6982 }, { 1118, 6981 }, { 1117, 6980 }, { 1116, 6979 }, { 1115, 6978 },
+    { 1114, 6977 }, { 1113, 6976 }, { 1112, 6975 }, { 1111, 6974 }, { 1110, 6973 }, { 1109, 6972 },
+    { 1108, 6971 }, { 1107, 6970 }, { 1106, 6969 }, { 1105, 6968 }, { 1104, 6967 }, { 1103, 6966 },
+    { 1102, 6965 }, { 1101, 6964 }, { 1100, 6963 }, { 1099, 6962 }, { 1098, 6961 }, { 1097, 6960 },
+    { 1096, 6959 }, { 1095, 6958 }, { 1094, 6957 }, { 1093, 6956 }, { 1092, 6955 }, { 1091, 6954 },
+    { 1090, 6953 }, { 1089, 6952 }, { 1088, 6951 }, { 1087, 6950 }, { 1086, 6949 }, { 1085, 6948 },
+    { 1084, 6947 }, { 1083, 6946 }, { 1082, 6945 }, { 1081, 6944 }, { 1080, 6943 }, { 1079, 6942 },
+    { 1078, 6941 }, { 1077, 6940 }, { 1076, 6939 }, { 1075, 6938 }, { 1074, 6937 }, { 1073, 6936 },
+    { 1072, 6935 }, { 1071, 6934 }, { 1070, 6933 }, { 1069, 6932 }, { 1068, 6931 }, { 1067, 6930 },
+    { 1066, 6929 }, { 1065, 6928 }, { 1064, 6927 }, { 1063, 6926 }, { 1062, 6925 }, { 1061, 6924 },
+    { 1060, 6923 }, { 1059, 6922 }, { 1058, 6921 }, { 1057, 6920 }, { 1056, 6919 }, { 1055, 6918 },
+    { 1054, 6917 }, { 1053, 6916 }, { 1052, 6915 }, { 1051, 6914 }, { 1050, 6913 }, { 1049, 6912 },
+    { 1048, 6911 }, { 1047, 6910 }, { 1046, 6909 }, { 1045, 6908 }, { 1044, 6907 }, { 1043, 6906 },
+    { 1042, 6905 }, { 1041, 6904 }, { 1040, 6903 }, { 1039, 6902 }, { 1038, 6901 }, { 1037, 6900 },
+    { 1036, 6899 }, { 1035, 6898 }, { 1034, 6897 }, { 1033, 6896 }, { 1032, 6895 }, { 1031, 6894 },
+    { 1030, 6893 }, { 1029, 6892 }, { 1028, 6891 }, { 1027, 6890 }, { 1026, 6889 }, { 1025, 6888 },
+    { 1024, 6887 }, { 1023, 6886 }, { 1022, 6885 }, { 1021, 6884 }, { 1020, 6883 }, { 1019, 6882 },
+    { 1018, 6881 }, { 1017, 6880 }, { 1016, 6879 }, { 1015, 6878 }, { 1014, 6877 }, { 1013, 6876 },
+    { 1012, 6875 }, { 1011, 6874 }, { 1010, 6873 }, { 1009, 6872 }, { 1008, 6871 }, { 1007, 6870 },
+    { 1006, 6869 }, { 1005, 6868 }, { 1004, 6867 }, { 1003, 6866 }, { 1002, 6865 }, { 1001, 6864 },
+    { 1000, 6863 }, { 999, 6862 }, { 998, 6861 }, { 997, 6860 }, { 996, 6859 }, { 995, 6858 },
+    { 994, 6857 }, { 993, 6856 }, { 992, 6855 }, { 991, 6854 }, { 990, 6853 }, { 989, 6852 },
+    { 988, 6851 }, { 987, 6850 }, { 986, 6849 }, { 985, 6848 }, { 984, 6847 }, { 983, 6846 },
+    { 982, 6845 }, { 981, 6844 }, { 980, 6843 }, { 979, 6842 }, { 978, 6841 }, { 977, 6840 },
+    { 976, 6839 }, { 975, 6838 }, { 974, 6837 }, { 973, 6836 }, { 972, 6835 }, { 971, 6834 },
+    { 970, 6833 }, { 969, 6832 }, { 968, 6831 }, { 967, 6830 }, { 966, 6829 }, { 965, 6828 },
+    { 964, 6827 }, { 963, 6826 }, { 962, 6825 }, { 961, 6824 }, { 960, 6823 }, { 959, 6822 },
+    { 958, 6821 }, { 957, 6820 }, { 956, 6819 }, { 955, 6818 }, { 954, 6817 }, { 953, 6816 },
+    { 952, 6815 }, { 951, 6814 }, { 950, 6813 }, { 949, 6812 }, { 948, 6811 }, { 947, 6810 },
+    { 946, 6809 }, { 945, 6808 }, { 944, 6807 }, { 943, 6806 }, { 942, 6805 }, { 941, 6804 },
+    { 940, 6803 }, { 939, 6802 }, { 938, 6801 }, { 937, 6800 }, { 936, 6799 }, { 935, 6798 },
+    { 934, 6797 }, { 933, 6796 }, { 932, 6795 }, { 931, 6794 }, { 930, 6793 }, { 929, 6792 },
+    { 928, 6791 }, { 927, 6790 }, { 926, 6789 }, { 925, 6788 }, { 924, 6787 }, { 923, 6786 },
+    { 922, 6785 }, { 921, 6784 }, { 920, 6783 }, { 919, 6782 }, { 918, 6781 }, { 917, 6780 },
+    { 916, 6779 }, { 915, 6778 }, { 914, 6777 }, { 913, 6776 }, { 912, 6775 }, { 911, 6774 },
+    { 910, 6773 }, { 909, 6772 }, { 908, 6771 }, { 907, 6770 }, { 906, 6769 }, { 905, 6768 },
+    { 904, 6767 }, { 903, 6766 }, { 902, 6765 }, { 901, 6764 }, { 900, 6763 }, { 899, 6762 },
+    { 898, 6761 }, { 897, 6760 }, { 896, 6759 }, { 895, 6758 }, { 894, 6757 }, { 893, 6756 },
+    { 892, 6755 }, { 891, 6754 }, { 890, 6753 }, { 889, 6752 }, { 888, 6751 }, { 887, 6750 },
+    { 886, 6749 }, { 885, 6748 }, { 884, 6747 }, { 883, 6746 }, { 882, 6745 }, { 881, 6744 },
+    { 880, 6743 }, { 879, 6742 }, { 878, 6741 }, { 877, 6740 }, { 876, 6739 }, { 875, 6738 },
+    { 874, 6737 }, { 873, 6736 }, { 872, 6735 }, { 871, 6734 }, { 870, 6733 }, { 869, 6732 },
+    { 868, 6731 }, { 867, 6730 }, { 866, 6729 }, { 865, 6728 }, { 864, 6727 }, { 863, 6726 },
+    { 862, 6725 }, { 861, 6724 }, { 860, 6723 }, { 859, 6722 }, { 858, 6721 }, { 857, 6720 },
+    { 856, 6719 }, { 855, 6718 }, { 854, 6717 }, { 853, 6716 }, { 852, 6715 }, { 851, 6714 },
+    { 850, 6713 }, { 849, 6712 }, { 848, 6711 }, { 847, 6710 }, { 846, 6709 }, { 845, 6708 },
+    { 844, 6707 }, { 843, 6706 }, { 842, 6705 }, { 841, 6704 }, { 840, 6703 }, { 839, 6702 },
+    { 838, 6701 }, { 837, 6700 }, { 836, 6699 }, { 835, 6698 }, { 834, 6697 }, { 833, 6696 },
+    { 832, 6695 }, { 831, 6694 }, { 830, 6693 }, { 829, 6692 }, { 828, 6691 }, { 827, 6690 },
+    { 826, 6689 }, { 825, 6688 }, { 824, 6687 }, { 823, 6686 }, { 822, 6685 }, { 821, 6684 },
+    { 820, 6683 }, { 819, 6682 }, { 818, 6681 }, { 817, 6680 }, { 816, 6679 }, { 2, 1601 },
+    { 10, 1609 }, { 815, 6678 }, { 814, 6677 }, { 813, 6676 }, { 812, 6675 }, { 811, 6674 },
+    { 810, 6673 }, { 809, 6672 }, { 808, 6671 }, { 807, 6670 }, { 806, 6669 }, { 805, 6668 },
+    { 804, 6667 }, { 803, 6666 }, { 802, 6665 }, { 801, 6664 }, { 800, 6663 }, { 799, 6662 },
+    { 798, 6661 }, { 797, 6660 }, { 796, 6659 }, { 795, 6658 }, { 794, 6657 }, { 793, 6656 },
+    { 792, 6655 }, { 791, 6654 }, { 790, 6653 }, { 789, 6652 }, { 788, 6651 }, { 787, 6650 },
+    { 786, 6649 }, { 785, 6648 }, { 784, 6647 }, { 783, 6646 }, { 782, 6645 }, { 781, 6644 },
+    { 780, 6643 }, { 779, 6642 }, { 778, 6641 }, { 777, 6640 }, { 776, 6639 }, { 775, 6638 },
+    { 774, 6637 }, { 773, 6636 }, { 772, 6635 }, { 771, 6634 }, { 770, 6633 }, { 769, 6632 },
+    { 768, 6631 }, { 767, 6630 }, { 766, 6629 }, { 765, 6628 }, { 764, 6627 }, { 763, 6626 },
+    { 762, 6625 }, { 761, 6624 }, { 760, 6623 }, { 759, 6622 }, { 758, 6621 }, { 757, 6620 },
+    { 756, 6619 }, { 755, 6618 }, { 754, 6617 }, { 753, 6616 }, { 752, 6615 }, { 751, 6614 },
+    { 750, 6613 }, { 749, 6612 }, { 748, 6611 }, { 747, 6610 }, { 746, 6609 }, { 745, 6608 },
+    { 744, 6607 }, { 743, 6606 }, { 742, 6605 }, { 741, 6604 }, { 740, 6603 }, { 739, 6602 },
+    { 738, 6601 }, { 737, 6600 }, { 736, 6599 }, { 735, 6598 }, { 734, 6597 }, { 733, 6596 },
+    { 732, 6595 }, { 731, 6594 }, { 730, 6593 }, { 729, 6592 }, { 728, 6591 }, { 727, 6590 },
+    { 726, 6589 }, { 725, 6588 }, { 724, 6587 }, { 723, 6586 }, { 722, 6585 }, { 721, 6584 },
+    { 720, 6583 }, { 719, 6582 }, { 718, 6581 }, { 717, 6580 }, { 716, 6579 }, { 715, 6578 },
+    { 714, 6577 }, { 713, 6576 }, { 712, 6575 }, { 711, 6574 }, { 710, 6573 }, { 709, 6572 },
+    { 708, 6571 }, { 707, 6570 }, { 706, 6569 }, { 705, 6568 }, { 704, 6567 }, { 703, 6566 },
+    { 702, 6565 }, { 701, 6564 }, { 700, 6563 }, { 699, 6562 }, { 698, 6561 }, { 697, 6560 },
+    { 696, 6559 }, { 695, 6558 }, { 694, 6557 }, { 693, 6556 }, { 692, 6555 }, { 691, 6554 },
+    { 690, 6553 }, { 689, 6552 }, { 688, 6551 }, { 687, 6550 }, { 686, 6549 }, { 685, 6548 },
+    { 684, 6547 }, { 683, 6546 }, { 682, 6545 }, { 681, 6544 }, { 680, 6543 }, { 679, 6542 },
+    { 678, 6541 }, { 677, 6540 }, { 676, 6539 }, { 675, 6538 }, { 674, 6537 }, { 673, 6536 },
+    { 672, 6535 }, { 671, 6534 }, { 670, 6533 }, { 669, 6532 }, { 668, 6531 }, { 667, 6530 },
+    { 666, 6529 }, { 665, 6528 }, { 664, 6527 }, { 663, 6526 }, { 662, 6525 }, { 661, 6524 },
+    { 660, 6523 }, { 659, 6522 }, { 658, 6521 }, { 657, 6520 }, { 656, 6519 }, { 655, 6518 },
+    { 654, 6517 }, { 653, 6516 }, { 652, 6515 }, { 651, 6514 }, { 650, 6513 }, { 649, 6512 },
+    { 648, 6511 }, { 647, 6510 }, { 646, 6509 }, { 645, 6508 }, { 644, 6507 }, { 643, 6506 },
+    { 642, 6505 }, { 641, 6504 }, { 640, 6503 }, { 639, 6502 }, { 638, 6501 }, { 637, 6500 },
+    { 636, 6499 }, { 635, 6498 }, { 634, 6497 }, { 633, 6496 }, { 632, 6495 }, { 631, 6494 },
+    { 630, 6493 }, { 629, 6492 }, { 628, 6491 }, { 627, 6490 }, { 626, 6489 }, { 625, 6488 },
+    { 624, 6487 }, { 623, 6486 }, { 622, 6485 }, { 621, 6484 }, { 620, 6483 }, { 619, 6482 },
+    { 618, 6481 }, { 617, 6480 }, { 616, 6479 }, { 615, 6478 }, { 614, 6477 }, { 613, 6476 },
+    { 612, 6475 }, { 611, 6474 }, { 610, 6473 }, { 609, 6472 }, { 608, 6471 }, { 607, 6470 },
+    { 606, 6469 }, { 605, 6468 }, { 604, 6467 }, { 603, 6466 }, { 602, 6465 }, { 601, 6464 },
+    { 600, 6463 }, { 599, 6462 }, { 598, 6461 }, { 597, 6460 }, { 596, 6459 }, { 595, 6458 },
+    { 594, 6457 }, { 593, 6456 }, { 592, 6455 }, { 591, 6454 }, { 590, 6453 }, { 589, 6452 },
+    { 588, 6451 }, { 587, 6450 }, { 586, 6449 }, { 585, 6448 }, { 584, 6447 }, { 583, 6446 },
+    { 582, 6445 }, { 581, 6444 }, { 580, 6443 }, { 579, 6442 }, { 578, 6441 }, { 577, 6440 },
+    { 576, 6439 }, { 575, 6438 }, { 574, 6437 }, { 573, 6436 }, { 572, 6435 }, { 571, 6434 },
+    { 570, 6433 }, { 569, 6432 }, { 568, 6431 }, { 567, 6430 }, { 566, 6429 }, { 565, 6428 },
+    { 564, 6427 }, { 563, 6426 }, { 562, 6425 }, { 561, 6424 }, { 560, 6423 }, { 559, 6422 },
+    { 558, 6421 }, { 557, 6420 }, { 556, 6419 }, { 555, 6418 }, { 554, 6417 }, { 553, 6416 },
+    { 552, 6415 }, { 551, 6414 }, { 550, 6413 }, { 549, 6412 }, { 548, 6411 }, { 547, 6410 },
+    { 546, 6409 }, { 545, 6408 }, { 544, 6407 }, { 543, 6406 }, { 542, 6405 }, { 541, 6404 },
+    { 540, 6403 }, { 539, 6402 }, { 538, 6401 }, { 537, 6400 }, { 536, 6399 }, { 535, 6398 },
+    { 534, 6397 }, { 533, 6396 }, { 532, 6395 }, { 531, 6394 }, { 530, 6393 }, { 529, 6392 },
+    { 528, 6391 }, { 527, 6390 }, { 526, 6389 }, { 525, 6388 }, { 524, 6387 }, { 523, 6386 },
+    { 522, 6385 }, { 521, 6384 }, { 520, 6383 }, { 519, 6382 }, { 518, 6381 }, { 517, 6380 },
+    { 516, 6379 }, { 515, 6378 }, { 514, 6377 }, { 513, 6376 }, { 512, 6375 }, { 511, 6374 },
+    { 510, 6373 }, { 509, 6372 }, { 508, 6371 }, { 507, 6370 }, { 506, 6369 }, { 505, 6368 },
+    { 504, 6367 }, { 503, 6366 }, { 502, 6365 }, { 501, 6364 }, { 500, 6363 }, { 499, 6362 },
+    { 498, 6361 }, { 497, 6360 }, { 496, 6359 }, { 495, 6358 }, { 494, 6357 }, { 493, 6356 },
+    { 492, 6355 }, { 491, 6354 }, { 490, 6353 }, { 489, 6352 }, { 488, 6351 }, { 487, 6350 },
+    { 486, 6349 }, { 485, 6348 }, { 484, 6347 }, { 483, 6346 }, { 482, 6345 }, { 481, 6344 },
+    { 480, 6343 }, { 479, 6342 }, { 478, 6341 }, { 477, 6340 }, { 476, 6339 }, { 475, 6338 },
+    { 474, 6337 }, { 473, 6336 }, { 472, 6335 }, { 471, 6334 }, { 470, 6333 }, { 469, 6332 },
+    { 468, 6331 }, { 467, 6330 }, { 466, 6329 }, { 465, 6328 }, { 464, 6327 }, { 463, 6326 },
+    { 462, 6325 }, { 461, 6324 }, { 460, 6323 }, { 459, 6322 }, { 458, 6321 }, { 457, 6320 },
+    { 456, 6319 }, { 455, 6318 }, { 454, 6317 }, { 453, 6316 }, { 452, 6315 }, { 451, 6314 },
+    { 450, 6313 }, { 449, 6312 }, { 448, 6311 }, { 447, 6310 }, { 446, 6309 }, { 445, 6308 },
+    { 444, 6307 }, { 443, 6306 }, { 442, 6305 }, { 441, 6304 }, { 440, 6303 }, { 439, 6302 },
+    { 438, 6301 }, { 437, 6300 }, { 436, 6299 }, { 435, 6298 }, { 434, 6297 }, { 433, 6296 },
+    { 432, 6295 }, { 431, 6294 }, { 430, 6293 }, { 429, 6292 }, { 428, 6291 }, { 427, 6290 },
+    { 426, 6289 }, { 425, 6288 }, { 424, 6287 }, { 423, 6286 }, { 422, 6285 }, { 421, 6284 },
+    { 420, 6283 }, { 419, 6282 }, { 418, 6281 }, { 417, 6280 }, { 416, 6279 }, { 415, 6278 },
+    { 414, 6277 }, { 413, 6276 }, { 412, 6275 }, { 411, 6274 }, { 410, 6273 }, { 409, 6272 },
+    { 408, 6271 }, { 407, 6270 }, { 406, 6269 }, { 405, 6268 }, { 404, 6267 }, { 403, 6266 },
+    { 402, 6265 }, { 401, 6264 }, { 400, 6263 }, { 399, 6262 }, { 398, 6261 }, { 397, 6260 },
+    { 396, 6259 }, { 395, 6258 }, { 394, 6257 }, { 393, 6256 }, { 392, 6255 }, { 391, 6254 },
+    { 390, 6253 }, { 389, 6252 }, { 388, 6251 }, { 387, 6250 }, { 386, 6249 }, { 385, 6248 },
+    { 384, 6247 }, { 383, 6246 }, { 382, 6245 }, { 381, 6244 }, { 380, 6243 }, { 379, 6242 },
+    { 378, 6241 }, { 377, 6240 }, { 376, 6239 }, { 375, 6238 }, { 374, 6237 }, { 373, 6236 },
+    { 372, 6235 }, { 371, 6234 }, { 370, 6233 }, { 369, 6232 }, { 368, 6231 }, { 367, 6230 },
+    { 366, 6229 }, { 365, 6228 }, { 364, 6227 }, { 363, 6226 }, { 362, 6225 }, { 361, 6224 },
+    { 360, 6223 }, { 359, 6222 }, { 358, 6221 }, { 357, 6220 }, { 356, 6219 }, { 355, 6218 },
+    { 354, 6217 }, { 353, 6216 }, { 352, 6215 }, { 351, 6214 }, { 350, 6213 }, { 349, 6212 },
+    { 348, 6211 }, { 347, 6210 }, { 346, 6209 }, { 345, 6208 }, { 344, 6207 }, { 343, 6206 },
+    { 342, 6205 }, { 341, 6204 }, { 340, 6203 }, { 339, 6202 }, { 338, 6201 }, { 337, 6200 },
+    { 336, 6199 }, { 335, 6198 }, { 334, 6197 }, { 333, 6196 }, { 332, 6195 }, { 331, 6194 },
+    { 330, 6193 }, { 329, 6192 }, { 328, 6191 }, { 327, 6190 }, { 326, 6189 }, { 325, 6188 },
+    { 324, 6187 }, { 323, 6186 }, { 1, 1600 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    { 0, 0 }, { 0, 0 }
+};
+
+const unsigned short ranks5_lo[] =
+{
+    0, 256, 257, 512, 258, 513, 514, 768, 259, 515, 516, 769, 517, 770, 771, 1024,
+    260, 518, 519, 772, 520, 773, 774, 1025, 521, 775, 776, 1026, 777, 1027, 1028, 1280,
+    261, 522, 523, 778, 524, 779, 780, 1029, 525, 781, 782, 1030, 783, 1031, 1032, 1281,
+    526, 784, 785, 1033, 786, 1034, 1035, 1282, 787, 1036, 1037, 1283, 1038, 1284, 1285, 1536,
+    262, 527, 528, 788, 529, 789, 790, 1039, 530, 791, 792, 1040, 793, 1041, 1042, 1286,
+    531, 794, 795, 1043, 796, 1044, 1045, 1287, 797, 1046, 1047, 1288, 1048, 1289, 1290, 1537,
+    532, 798, 799, 1049, 800, 1050, 1051, 1291, 801, 1052, 1053, 1292, 1054, 1293, 1294, 1538,
+    802, 1055, 1056, 1295, 1057, 1296, 1297, 1539, 1058, 1298, 1299, 1540, 1300, 1541, 1542, 1792
+};
+
+const unsigned short ranks5_hi[8][64] =
+{
+    {
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 791,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1121,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1241, 1287, 1287, 1287, 1277, 1287, 1285, 1286, 1287
+    },
+    {
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 455,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 665, 1287, 1287, 1287, 749, 1287, 777, 784, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 995, 1287, 1287, 1287, 1079, 1287, 1107, 1114, 1287,
+        1287, 1287, 1287, 1199, 1287, 1227, 1234, 1287, 1287, 1263, 1270, 1287, 1278, 1287, 1287, 1287
+    },
+    {
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 231, 1287, 1287, 1287, 357, 1287, 413, 434, 1287,
+        1287, 1287, 1287, 567, 1287, 623, 644, 1287, 1287, 707, 728, 1287, 756, 1287, 1287, 1287,
+        1287, 1287, 1287, 897, 1287, 953, 974, 1287, 1287, 1037, 1058, 1287, 1086, 1287, 1287, 1287,
+        1287, 1157, 1178, 1287, 1206, 1287, 1287, 1287, 1242, 1287, 1287, 1287, 1287, 1287, 1287, 1287
+    },
+    {
+        1287, 1287, 1287, 91, 1287, 161, 196, 1287, 1287, 287, 322, 1287, 378, 1287, 1287, 1287,
+        1287, 497, 532, 1287, 588, 1287, 1287, 1287, 672, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 827, 862, 1287, 918, 1287, 1287, 1287, 1002, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1122, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287
+    },
+    {
+        1287, 21, 56, 1287, 126, 1287, 1287, 1287, 252, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        462, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        792, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287
+    },
+    {
+        0, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287
+    },
+    {
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287
+    },
+    {
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
+        1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287
+    }
+};
+
+#endif  // COMPACT_TABLES
+
+/*
+** Best ace-to-five low, 1 (5-4-3-2-A) to 1287 (K-Q-J-T-9),
+** indexed by the ace-low rank mask of the cards (see
+** low_mask() in pokereval.h); 0 if fewer than five ranks.
+*/
+const unsigned short low5[] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 4, 0, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 9, 0, 10, 11, 1,
+    0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 13, 0, 14, 15, 2,
+    0, 0, 0, 16, 0, 17, 18, 3, 0, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+    0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 24, 0, 25, 26, 1,
+    0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 28, 0, 29, 30, 2,
+    0, 0, 0, 31, 0, 32, 33, 3, 0, 34, 35, 4, 36, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 38, 0, 39, 40, 7,
+    0, 0, 0, 41, 0, 42, 43, 8, 0, 44, 45, 9, 46, 10, 11, 1,
+    0, 0, 0, 47, 0, 48, 49, 12, 0, 50, 51, 13, 52, 14, 15, 2,
+    0, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57,
+    0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 59, 0, 60, 61, 1,
+    0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 63, 0, 64, 65, 2,
+    0, 0, 0, 66, 0, 67, 68, 3, 0, 69, 70, 4, 71, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 73, 0, 74, 75, 7,
+    0, 0, 0, 76, 0, 77, 78, 8, 0, 79, 80, 9, 81, 10, 11, 1,
+    0, 0, 0, 82, 0, 83, 84, 12, 0, 85, 86, 13, 87, 14, 15, 2,
+    0, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 93, 0, 94, 95, 22,
+    0, 0, 0, 96, 0, 97, 98, 23, 0, 99, 100, 24, 101, 25, 26, 1,
+    0, 0, 0, 102, 0, 103, 104, 27, 0, 105, 106, 28, 107, 29, 30, 2,
+    0, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    0, 0, 0, 112, 0, 113, 114, 37, 0, 115, 116, 38, 117, 39, 40, 7,
+    0, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    0, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127,
+    0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 129, 0, 130, 131, 1,
+    0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 133, 0, 134, 135, 2,
+    0, 0, 0, 136, 0, 137, 138, 3, 0, 139, 140, 4, 141, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 142, 0, 0, 0, 143, 0, 144, 145, 7,
+    0, 0, 0, 146, 0, 147, 148, 8, 0, 149, 150, 9, 151, 10, 11, 1,
+    0, 0, 0, 152, 0, 153, 154, 12, 0, 155, 156, 13, 157, 14, 15, 2,
+    0, 158, 159, 16, 160, 17, 18, 3, 161, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 163, 0, 164, 165, 22,
+    0, 0, 0, 166, 0, 167, 168, 23, 0, 169, 170, 24, 171, 25, 26, 1,
+    0, 0, 0, 172, 0, 173, 174, 27, 0, 175, 176, 28, 177, 29, 30, 2,
+    0, 178, 179, 31, 180, 32, 33, 3, 181, 34, 35, 4, 36, 5, 6, 1,
+    0, 0, 0, 182, 0, 183, 184, 37, 0, 185, 186, 38, 187, 39, 40, 7,
+    0, 188, 189, 41, 190, 42, 43, 8, 191, 44, 45, 9, 46, 10, 11, 1,
+    0, 192, 193, 47, 194, 48, 49, 12, 195, 50, 51, 13, 52, 14, 15, 2,
+    196, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0, 198, 0, 199, 200, 57,
+    0, 0, 0, 201, 0, 202, 203, 58, 0, 204, 205, 59, 206, 60, 61, 1,
+    0, 0, 0, 207, 0, 208, 209, 62, 0, 210, 211, 63, 212, 64, 65, 2,
+    0, 213, 214, 66, 215, 67, 68, 3, 216, 69, 70, 4, 71, 5, 6, 1,
+    0, 0, 0, 217, 0, 218, 219, 72, 0, 220, 221, 73, 222, 74, 75, 7,
+    0, 223, 224, 76, 225, 77, 78, 8, 226, 79, 80, 9, 81, 10, 11, 1,
+    0, 227, 228, 82, 229, 83, 84, 12, 230, 85, 86, 13, 87, 14, 15, 2,
+    231, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 232, 0, 233, 234, 92, 0, 235, 236, 93, 237, 94, 95, 22,
+    0, 238, 239, 96, 240, 97, 98, 23, 241, 99, 100, 24, 101, 25, 26, 1,
+    0, 242, 243, 102, 244, 103, 104, 27, 245, 105, 106, 28, 107, 29, 30, 2,
+    246, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    0, 247, 248, 112, 249, 113, 114, 37, 250, 115, 116, 38, 117, 39, 40, 7,
+    251, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    252, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253,
+    0, 0, 0, 0, 0, 0, 0, 254, 0, 0, 0, 255, 0, 256, 257, 1,
+    0, 0, 0, 0, 0, 0, 0, 258, 0, 0, 0, 259, 0, 260, 261, 2,
+    0, 0, 0, 262, 0, 263, 264, 3, 0, 265, 266, 4, 267, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 268, 0, 0, 0, 269, 0, 270, 271, 7,
+    0, 0, 0, 272, 0, 273, 274, 8, 0, 275, 276, 9, 277, 10, 11, 1,
+    0, 0, 0, 278, 0, 279, 280, 12, 0, 281, 282, 13, 283, 14, 15, 2,
+    0, 284, 285, 16, 286, 17, 18, 3, 287, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 288, 0, 0, 0, 289, 0, 290, 291, 22,
+    0, 0, 0, 292, 0, 293, 294, 23, 0, 295, 296, 24, 297, 25, 26, 1,
+    0, 0, 0, 298, 0, 299, 300, 27, 0, 301, 302, 28, 303, 29, 30, 2,
+    0, 304, 305, 31, 306, 32, 33, 3, 307, 34, 35, 4, 36, 5, 6, 1,
+    0, 0, 0, 308, 0, 309, 310, 37, 0, 311, 312, 38, 313, 39, 40, 7,
+    0, 314, 315, 41, 316, 42, 43, 8, 317, 44, 45, 9, 46, 10, 11, 1,
+    0, 318, 319, 47, 320, 48, 49, 12, 321, 50, 51, 13, 52, 14, 15, 2,
+    322, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 323, 0, 0, 0, 324, 0, 325, 326, 57,
+    0, 0, 0, 327, 0, 328, 329, 58, 0, 330, 331, 59, 332, 60, 61, 1,
+    0, 0, 0, 333, 0, 334, 335, 62, 0, 336, 337, 63, 338, 64, 65, 2,
+    0, 339, 340, 66, 341, 67, 68, 3, 342, 69, 70, 4, 71, 5, 6, 1,
+    0, 0, 0, 343, 0, 344, 345, 72, 0, 346, 347, 73, 348, 74, 75, 7,
+    0, 349, 350, 76, 351, 77, 78, 8, 352, 79, 80, 9, 81, 10, 11, 1,
+    0, 353, 354, 82, 355, 83, 84, 12, 356, 85, 86, 13, 87, 14, 15, 2,
+    357, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 358, 0, 359, 360, 92, 0, 361, 362, 93, 363, 94, 95, 22,
+    0, 364, 365, 96, 366, 97, 98, 23, 367, 99, 100, 24, 101, 25, 26, 1,
+    0, 368, 369, 102, 370, 103, 104, 27, 371, 105, 106, 28, 107, 29, 30, 2,
+    372, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    0, 373, 374, 112, 375, 113, 114, 37, 376, 115, 116, 38, 117, 39, 40, 7,
+    377, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    378, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 379, 0, 0, 0, 380, 0, 381, 382, 127,
+    0, 0, 0, 383, 0, 384, 385, 128, 0, 386, 387, 129, 388, 130, 131, 1,
+    0, 0, 0, 389, 0, 390, 391, 132, 0, 392, 393, 133, 394, 134, 135, 2,
+    0, 395, 396, 136, 397, 137, 138, 3, 398, 139, 140, 4, 141, 5, 6, 1,
+    0, 0, 0, 399, 0, 400, 401, 142, 0, 402, 403, 143, 404, 144, 145, 7,
+    0, 405, 406, 146, 407, 147, 148, 8, 408, 149, 150, 9, 151, 10, 11, 1,
+    0, 409, 410, 152, 411, 153, 154, 12, 412, 155, 156, 13, 157, 14, 15, 2,
+    413, 158, 159, 16, 160, 17, 18, 3, 161, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 414, 0, 415, 416, 162, 0, 417, 418, 163, 419, 164, 165, 22,
+    0, 420, 421, 166, 422, 167, 168, 23, 423, 169, 170, 24, 171, 25, 26, 1,
+    0, 424, 425, 172, 426, 173, 174, 27, 427, 175, 176, 28, 177, 29, 30, 2,
+    428, 178, 179, 31, 180, 32, 33, 3, 181, 34, 35, 4, 36, 5, 6, 1,
+    0, 429, 430, 182, 431, 183, 184, 37, 432, 185, 186, 38, 187, 39, 40, 7,
+    433, 188, 189, 41, 190, 42, 43, 8, 191, 44, 45, 9, 46, 10, 11, 1,
+    434, 192, 193, 47, 194, 48, 49, 12, 195, 50, 51, 13, 52, 14, 15, 2,
+    196, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 435, 0, 436, 437, 197, 0, 438, 439, 198, 440, 199, 200, 57,
+    0, 441, 442, 201, 443, 202, 203, 58, 444, 204, 205, 59, 206, 60, 61, 1,
+    0, 445, 446, 207, 447, 208, 209, 62, 448, 210, 211, 63, 212, 64, 65, 2,
+    449, 213, 214, 66, 215, 67, 68, 3, 216, 69, 70, 4, 71, 5, 6, 1,
+    0, 450, 451, 217, 452, 218, 219, 72, 453, 220, 221, 73, 222, 74, 75, 7,
+    454, 223, 224, 76, 225, 77, 78, 8, 226, 79, 80, 9, 81, 10, 11, 1,
+    455, 227, 228, 82, 229, 83, 84, 12, 230, 85, 86, 13, 87, 14, 15, 2,
+    231, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 456, 457, 232, 458, 233, 234, 92, 459, 235, 236, 93, 237, 94, 95, 22,
+    460, 238, 239, 96, 240, 97, 98, 23, 241, 99, 100, 24, 101, 25, 26, 1,
+    461, 242, 243, 102, 244, 103, 104, 27, 245, 105, 106, 28, 107, 29, 30, 2,
+    246, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    462, 247, 248, 112, 249, 113, 114, 37, 250, 115, 116, 38, 117, 39, 40, 7,
+    251, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    252, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 463,
+    0, 0, 0, 0, 0, 0, 0, 464, 0, 0, 0, 465, 0, 466, 467, 1,
+    0, 0, 0, 0, 0, 0, 0, 468, 0, 0, 0, 469, 0, 470, 471, 2,
+    0, 0, 0, 472, 0, 473, 474, 3, 0, 475, 476, 4, 477, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 478, 0, 0, 0, 479, 0, 480, 481, 7,
+    0, 0, 0, 482, 0, 483, 484, 8, 0, 485, 486, 9, 487, 10, 11, 1,
+    0, 0, 0, 488, 0, 489, 490, 12, 0, 491, 492, 13, 493, 14, 15, 2,
+    0, 494, 495, 16, 496, 17, 18, 3, 497, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 498, 0, 0, 0, 499, 0, 500, 501, 22,
+    0, 0, 0, 502, 0, 503, 504, 23, 0, 505, 506, 24, 507, 25, 26, 1,
+    0, 0, 0, 508, 0, 509, 510, 27, 0, 511, 512, 28, 513, 29, 30, 2,
+    0, 514, 515, 31, 516, 32, 33, 3, 517, 34, 35, 4, 36, 5, 6, 1,
+    0, 0, 0, 518, 0, 519, 520, 37, 0, 521, 522, 38, 523, 39, 40, 7,
+    0, 524, 525, 41, 526, 42, 43, 8, 527, 44, 45, 9, 46, 10, 11, 1,
+    0, 528, 529, 47, 530, 48, 49, 12, 531, 50, 51, 13, 52, 14, 15, 2,
+    532, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 533, 0, 0, 0, 534, 0, 535, 536, 57,
+    0, 0, 0, 537, 0, 538, 539, 58, 0, 540, 541, 59, 542, 60, 61, 1,
+    0, 0, 0, 543, 0, 544, 545, 62, 0, 546, 547, 63, 548, 64, 65, 2,
+    0, 549, 550, 66, 551, 67, 68, 3, 552, 69, 70, 4, 71, 5, 6, 1,
+    0, 0, 0, 553, 0, 554, 555, 72, 0, 556, 557, 73, 558, 74, 75, 7,
+    0, 559, 560, 76, 561, 77, 78, 8, 562, 79, 80, 9, 81, 10, 11, 1,
+    0, 563, 564, 82, 565, 83, 84, 12, 566, 85, 86, 13, 87, 14, 15, 2,
+    567, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 568, 0, 569, 570, 92, 0, 571, 572, 93, 573, 94, 95, 22,
+    0, 574, 575, 96, 576, 97, 98, 23, 577, 99, 100, 24, 101, 25, 26, 1,
+    0, 578, 579, 102, 580, 103, 104, 27, 581, 105, 106, 28, 107, 29, 30, 2,
+    582, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    0, 583, 584, 112, 585, 113, 114, 37, 586, 115, 116, 38, 117, 39, 40, 7,
+    587, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    588, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 589, 0, 0, 0, 590, 0, 591, 592, 127,
+    0, 0, 0, 593, 0, 594, 595, 128, 0, 596, 597, 129, 598, 130, 131, 1,
+    0, 0, 0, 599, 0, 600, 601, 132, 0, 602, 603, 133, 604, 134, 135, 2,
+    0, 605, 606, 136, 607, 137, 138, 3, 608, 139, 140, 4, 141, 5, 6, 1,
+    0, 0, 0, 609, 0, 610, 611, 142, 0, 612, 613, 143, 614, 144, 145, 7,
+    0, 615, 616, 146, 617, 147, 148, 8, 618, 149, 150, 9, 151, 10, 11, 1,
+    0, 619, 620, 152, 621, 153, 154, 12, 622, 155, 156, 13, 157, 14, 15, 2,
+    623, 158, 159, 16, 160, 17, 18, 3, 161, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 624, 0, 625, 626, 162, 0, 627, 628, 163, 629, 164, 165, 22,
+    0, 630, 631, 166, 632, 167, 168, 23, 633, 169, 170, 24, 171, 25, 26, 1,
+    0, 634, 635, 172, 636, 173, 174, 27, 637, 175, 176, 28, 177, 29, 30, 2,
+    638, 178, 179, 31, 180, 32, 33, 3, 181, 34, 35, 4, 36, 5, 6, 1,
+    0, 639, 640, 182, 641, 183, 184, 37, 642, 185, 186, 38, 187, 39, 40, 7,
+    643, 188, 189, 41, 190, 42, 43, 8, 191, 44, 45, 9, 46, 10, 11, 1,
+    644, 192, 193, 47, 194, 48, 49, 12, 195, 50, 51, 13, 52, 14, 15, 2,
+    196, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 645, 0, 646, 647, 197, 0, 648, 649, 198, 650, 199, 200, 57,
+    0, 651, 652, 201, 653, 202, 203, 58, 654, 204, 205, 59, 206, 60, 61, 1,
+    0, 655, 656, 207, 657, 208, 209, 62, 658, 210, 211, 63, 212, 64, 65, 2,
+    659, 213, 214, 66, 215, 67, 68, 3, 216, 69, 70, 4, 71, 5, 6, 1,
+    0, 660, 661, 217, 662, 218, 219, 72, 663, 220, 221, 73, 222, 74, 75, 7,
+    664, 223, 224, 76, 225, 77, 78, 8, 226, 79, 80, 9, 81, 10, 11, 1,
+    665, 227, 228, 82, 229, 83, 84, 12, 230, 85, 86, 13, 87, 14, 15, 2,
+    231, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 666, 667, 232, 668, 233, 234, 92, 669, 235, 236, 93, 237, 94, 95, 22,
+    670, 238, 239, 96, 240, 97, 98, 23, 241, 99, 100, 24, 101, 25, 26, 1,
+    671, 242, 243, 102, 244, 103, 104, 27, 245, 105, 106, 28, 107, 29, 30, 2,
+    246, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    672, 247, 248, 112, 249, 113, 114, 37, 250, 115, 116, 38, 117, 39, 40, 7,
+    251, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    252, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 673, 0, 0, 0, 674, 0, 675, 676, 253,
+    0, 0, 0, 677, 0, 678, 679, 254, 0, 680, 681, 255, 682, 256, 257, 1,
+    0, 0, 0, 683, 0, 684, 685, 258, 0, 686, 687, 259, 688, 260, 261, 2,
+    0, 689, 690, 262, 691, 263, 264, 3, 692, 265, 266, 4, 267, 5, 6, 1,
+    0, 0, 0, 693, 0, 694, 695, 268, 0, 696, 697, 269, 698, 270, 271, 7,
+    0, 699, 700, 272, 701, 273, 274, 8, 702, 275, 276, 9, 277, 10, 11, 1,
+    0, 703, 704, 278, 705, 279, 280, 12, 706, 281, 282, 13, 283, 14, 15, 2,
+    707, 284, 285, 16, 286, 17, 18, 3, 287, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 708, 0, 709, 710, 288, 0, 711, 712, 289, 713, 290, 291, 22,
+    0, 714, 715, 292, 716, 293, 294, 23, 717, 295, 296, 24, 297, 25, 26, 1,
+    0, 718, 719, 298, 720, 299, 300, 27, 721, 301, 302, 28, 303, 29, 30, 2,
+    722, 304, 305, 31, 306, 32, 33, 3, 307, 34, 35, 4, 36, 5, 6, 1,
+    0, 723, 724, 308, 725, 309, 310, 37, 726, 311, 312, 38, 313, 39, 40, 7,
+    727, 314, 315, 41, 316, 42, 43, 8, 317, 44, 45, 9, 46, 10, 11, 1,
+    728, 318, 319, 47, 320, 48, 49, 12, 321, 50, 51, 13, 52, 14, 15, 2,
+    322, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 729, 0, 730, 731, 323, 0, 732, 733, 324, 734, 325, 326, 57,
+    0, 735, 736, 327, 737, 328, 329, 58, 738, 330, 331, 59, 332, 60, 61, 1,
+    0, 739, 740, 333, 741, 334, 335, 62, 742, 336, 337, 63, 338, 64, 65, 2,
+    743, 339, 340, 66, 341, 67, 68, 3, 342, 69, 70, 4, 71, 5, 6, 1,
+    0, 744, 745, 343, 746, 344, 345, 72, 747, 346, 347, 73, 348, 74, 75, 7,
+    748, 349, 350, 76, 351, 77, 78, 8, 352, 79, 80, 9, 81, 10, 11, 1,
+    749, 353, 354, 82, 355, 83, 84, 12, 356, 85, 86, 13, 87, 14, 15, 2,
+    357, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 750, 751, 358, 752, 359, 360, 92, 753, 361, 362, 93, 363, 94, 95, 22,
+    754, 364, 365, 96, 366, 97, 98, 23, 367, 99, 100, 24, 101, 25, 26, 1,
+    755, 368, 369, 102, 370, 103, 104, 27, 371, 105, 106, 28, 107, 29, 30, 2,
+    372, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    756, 373, 374, 112, 375, 113, 114, 37, 376, 115, 116, 38, 117, 39, 40, 7,
+    377, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    378, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 757, 0, 758, 759, 379, 0, 760, 761, 380, 762, 381, 382, 127,
+    0, 763, 764, 383, 765, 384, 385, 128, 766, 386, 387, 129, 388, 130, 131, 1,
+    0, 767, 768, 389, 769, 390, 391, 132, 770, 392, 393, 133, 394, 134, 135, 2,
+    771, 395, 396, 136, 397, 137, 138, 3, 398, 139, 140, 4, 141, 5, 6, 1,
+    0, 772, 773, 399, 774, 400, 401, 142, 775, 402, 403, 143, 404, 144, 145, 7,
+    776, 405, 406, 146, 407, 147, 148, 8, 408, 149, 150, 9, 151, 10, 11, 1,
+    777, 409, 410, 152, 411, 153, 154, 12, 412, 155, 156, 13, 157, 14, 15, 2,
+    413, 158, 159, 16, 160, 17, 18, 3, 161, 19, 20, 4, 21, 5, 6, 1,
+    0, 778, 779, 414, 780, 415, 416, 162, 781, 417, 418, 163, 419, 164, 165, 22,
+    782, 420, 421, 166, 422, 167, 168, 23, 423, 169, 170, 24, 171, 25, 26, 1,
+    783, 424, 425, 172, 426, 173, 174, 27, 427, 175, 176, 28, 177, 29, 30, 2,
+    428, 178, 179, 31, 180, 32, 33, 3, 181, 34, 35, 4, 36, 5, 6, 1,
+    784, 429, 430, 182, 431, 183, 184, 37, 432, 185, 186, 38, 187, 39, 40, 7,
+    433, 188, 189, 41, 190, 42, 43, 8, 191, 44, 45, 9, 46, 10, 11, 1,
+    434, 192, 193, 47, 194, 48, 49, 12, 195, 50, 51, 13, 52, 14, 15, 2,
+    196, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 785, 786, 435, 787, 436, 437, 197, 788, 438, 439, 198, 440, 199, 200, 57,
+    789, 441, 442, 201, 443, 202, 203, 58, 444, 204, 205, 59, 206, 60, 61, 1,
+    790, 445, 446, 207, 447, 208, 209, 62, 448, 210, 211, 63, 212, 64, 65, 2,
+    449, 213, 214, 66, 215, 67, 68, 3, 216, 69, 70, 4, 71, 5, 6, 1,
+    791, 450, 451, 217, 452, 218, 219, 72, 453, 220, 221, 73, 222, 74, 75, 7,
+    454, 223, 224, 76, 225, 77, 78, 8, 226, 79, 80, 9, 81, 10, 11, 1,
+    455, 227, 228, 82, 229, 83, 84, 12, 230, 85, 86, 13, 87, 14, 15, 2,
+    231, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    792, 456, 457, 232, 458, 233, 234, 92, 459, 235, 236, 93, 237, 94, 95, 22,
+    460, 238, 239, 96, 240, 97, 98, 23, 241, 99, 100, 24, 101, 25, 26, 1,
+    461, 242, 243, 102, 244, 103, 104, 27, 245, 105, 106, 28, 107, 29, 30, 2,
+    246, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    462, 247, 248, 112, 249, 113, 114, 37, 250, 115, 116, 38, 117, 39, 40, 7,
+    251, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    252, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 793,
+    0, 0, 0, 0, 0, 0, 0, 794, 0, 0, 0, 795, 0, 796, 797, 1,
+    0, 0, 0, 0, 0, 0, 0, 798, 0, 0, 0, 799, 0, 800, 801, 2,
+    0, 0, 0, 802, 0, 803, 804, 3, 0, 805, 806, 4, 807, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 808, 0, 0, 0, 809, 0, 810, 811, 7,
+    0, 0, 0, 812, 0, 813, 814, 8, 0, 815, 816, 9, 817, 10, 11, 1,
+    0, 0, 0, 818, 0, 819, 820, 12, 0, 821, 822, 13, 823, 14, 15, 2,
+    0, 824, 825, 16, 826, 17, 18, 3, 827, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 828, 0, 0, 0, 829, 0, 830, 831, 22,
+    0, 0, 0, 832, 0, 833, 834, 23, 0, 835, 836, 24, 837, 25, 26, 1,
+    0, 0, 0, 838, 0, 839, 840, 27, 0, 841, 842, 28, 843, 29, 30, 2,
+    0, 844, 845, 31, 846, 32, 33, 3, 847, 34, 35, 4, 36, 5, 6, 1,
+    0, 0, 0, 848, 0, 849, 850, 37, 0, 851, 852, 38, 853, 39, 40, 7,
+    0, 854, 855, 41, 856, 42, 43, 8, 857, 44, 45, 9, 46, 10, 11, 1,
+    0, 858, 859, 47, 860, 48, 49, 12, 861, 50, 51, 13, 52, 14, 15, 2,
+    862, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 863, 0, 0, 0, 864, 0, 865, 866, 57,
+    0, 0, 0, 867, 0, 868, 869, 58, 0, 870, 871, 59, 872, 60, 61, 1,
+    0, 0, 0, 873, 0, 874, 875, 62, 0, 876, 877, 63, 878, 64, 65, 2,
+    0, 879, 880, 66, 881, 67, 68, 3, 882, 69, 70, 4, 71, 5, 6, 1,
+    0, 0, 0, 883, 0, 884, 885, 72, 0, 886, 887, 73, 888, 74, 75, 7,
+    0, 889, 890, 76, 891, 77, 78, 8, 892, 79, 80, 9, 81, 10, 11, 1,
+    0, 893, 894, 82, 895, 83, 84, 12, 896, 85, 86, 13, 87, 14, 15, 2,
+    897, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 898, 0, 899, 900, 92, 0, 901, 902, 93, 903, 94, 95, 22,
+    0, 904, 905, 96, 906, 97, 98, 23, 907, 99, 100, 24, 101, 25, 26, 1,
+    0, 908, 909, 102, 910, 103, 104, 27, 911, 105, 106, 28, 107, 29, 30, 2,
+    912, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    0, 913, 914, 112, 915, 113, 114, 37, 916, 115, 116, 38, 117, 39, 40, 7,
+    917, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    918, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 919, 0, 0, 0, 920, 0, 921, 922, 127,
+    0, 0, 0, 923, 0, 924, 925, 128, 0, 926, 927, 129, 928, 130, 131, 1,
+    0, 0, 0, 929, 0, 930, 931, 132, 0, 932, 933, 133, 934, 134, 135, 2,
+    0, 935, 936, 136, 937, 137, 138, 3, 938, 139, 140, 4, 141, 5, 6, 1,
+    0, 0, 0, 939, 0, 940, 941, 142, 0, 942, 943, 143, 944, 144, 145, 7,
+    0, 945, 946, 146, 947, 147, 148, 8, 948, 149, 150, 9, 151, 10, 11, 1,
+    0, 949, 950, 152, 951, 153, 154, 12, 952, 155, 156, 13, 157, 14, 15, 2,
+    953, 158, 159, 16, 160, 17, 18, 3, 161, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 954, 0, 955, 956, 162, 0, 957, 958, 163, 959, 164, 165, 22,
+    0, 960, 961, 166, 962, 167, 168, 23, 963, 169, 170, 24, 171, 25, 26, 1,
+    0, 964, 965, 172, 966, 173, 174, 27, 967, 175, 176, 28, 177, 29, 30, 2,
+    968, 178, 179, 31, 180, 32, 33, 3, 181, 34, 35, 4, 36, 5, 6, 1,
+    0, 969, 970, 182, 971, 183, 184, 37, 972, 185, 186, 38, 187, 39, 40, 7,
+    973, 188, 189, 41, 190, 42, 43, 8, 191, 44, 45, 9, 46, 10, 11, 1,
+    974, 192, 193, 47, 194, 48, 49, 12, 195, 50, 51, 13, 52, 14, 15, 2,
+    196, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 975, 0, 976, 977, 197, 0, 978, 979, 198, 980, 199, 200, 57,
+    0, 981, 982, 201, 983, 202, 203, 58, 984, 204, 205, 59, 206, 60, 61, 1,
+    0, 985, 986, 207, 987, 208, 209, 62, 988, 210, 211, 63, 212, 64, 65, 2,
+    989, 213, 214, 66, 215, 67, 68, 3, 216, 69, 70, 4, 71, 5, 6, 1,
+    0, 990, 991, 217, 992, 218, 219, 72, 993, 220, 221, 73, 222, 74, 75, 7,
+    994, 223, 224, 76, 225, 77, 78, 8, 226, 79, 80, 9, 81, 10, 11, 1,
+    995, 227, 228, 82, 229, 83, 84, 12, 230, 85, 86, 13, 87, 14, 15, 2,
+    231, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 996, 997, 232, 998, 233, 234, 92, 999, 235, 236, 93, 237, 94, 95, 22,
+    1000, 238, 239, 96, 240, 97, 98, 23, 241, 99, 100, 24, 101, 25, 26, 1,
+    1001, 242, 243, 102, 244, 103, 104, 27, 245, 105, 106, 28, 107, 29, 30, 2,
+    246, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    1002, 247, 248, 112, 249, 113, 114, 37, 250, 115, 116, 38, 117, 39, 40, 7,
+    251, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    252, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 1003, 0, 0, 0, 1004, 0, 1005, 1006, 253,
+    0, 0, 0, 1007, 0, 1008, 1009, 254, 0, 1010, 1011, 255, 1012, 256, 257, 1,
+    0, 0, 0, 1013, 0, 1014, 1015, 258, 0, 1016, 1017, 259, 1018, 260, 261, 2,
+    0, 1019, 1020, 262, 1021, 263, 264, 3, 1022, 265, 266, 4, 267, 5, 6, 1,
+    0, 0, 0, 1023, 0, 1024, 1025, 268, 0, 1026, 1027, 269, 1028, 270, 271, 7,
+    0, 1029, 1030, 272, 1031, 273, 274, 8, 1032, 275, 276, 9, 277, 10, 11, 1,
+    0, 1033, 1034, 278, 1035, 279, 280, 12, 1036, 281, 282, 13, 283, 14, 15, 2,
+    1037, 284, 285, 16, 286, 17, 18, 3, 287, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 1038, 0, 1039, 1040, 288, 0, 1041, 1042, 289, 1043, 290, 291, 22,
+    0, 1044, 1045, 292, 1046, 293, 294, 23, 1047, 295, 296, 24, 297, 25, 26, 1,
+    0, 1048, 1049, 298, 1050, 299, 300, 27, 1051, 301, 302, 28, 303, 29, 30, 2,
+    1052, 304, 305, 31, 306, 32, 33, 3, 307, 34, 35, 4, 36, 5, 6, 1,
+    0, 1053, 1054, 308, 1055, 309, 310, 37, 1056, 311, 312, 38, 313, 39, 40, 7,
+    1057, 314, 315, 41, 316, 42, 43, 8, 317, 44, 45, 9, 46, 10, 11, 1,
+    1058, 318, 319, 47, 320, 48, 49, 12, 321, 50, 51, 13, 52, 14, 15, 2,
+    322, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 1059, 0, 1060, 1061, 323, 0, 1062, 1063, 324, 1064, 325, 326, 57,
+    0, 1065, 1066, 327, 1067, 328, 329, 58, 1068, 330, 331, 59, 332, 60, 61, 1,
+    0, 1069, 1070, 333, 1071, 334, 335, 62, 1072, 336, 337, 63, 338, 64, 65, 2,
+    1073, 339, 340, 66, 341, 67, 68, 3, 342, 69, 70, 4, 71, 5, 6, 1,
+    0, 1074, 1075, 343, 1076, 344, 345, 72, 1077, 346, 347, 73, 348, 74, 75, 7,
+    1078, 349, 350, 76, 351, 77, 78, 8, 352, 79, 80, 9, 81, 10, 11, 1,
+    1079, 353, 354, 82, 355, 83, 84, 12, 356, 85, 86, 13, 87, 14, 15, 2,
+    357, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 1080, 1081, 358, 1082, 359, 360, 92, 1083, 361, 362, 93, 363, 94, 95, 22,
+    1084, 364, 365, 96, 366, 97, 98, 23, 367, 99, 100, 24, 101, 25, 26, 1,
+    1085, 368, 369, 102, 370, 103, 104, 27, 371, 105, 106, 28, 107, 29, 30, 2,
+    372, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    1086, 373, 374, 112, 375, 113, 114, 37, 376, 115, 116, 38, 117, 39, 40, 7,
+    377, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    378, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 1087, 0, 1088, 1089, 379, 0, 1090, 1091, 380, 1092, 381, 382, 127,
+    0, 1093, 1094, 383, 1095, 384, 385, 128, 1096, 386, 387, 129, 388, 130, 131, 1,
+    0, 1097, 1098, 389, 1099, 390, 391, 132, 1100, 392, 393, 133, 394, 134, 135, 2,
+    1101, 395, 396, 136, 397, 137, 138, 3, 398, 139, 140, 4, 141, 5, 6, 1,
+    0, 1102, 1103, 399, 1104, 400, 401, 142, 1105, 402, 403, 143, 404, 144, 145, 7,
+    1106, 405, 406, 146, 407, 147, 148, 8, 408, 149, 150, 9, 151, 10, 11, 1,
+    1107, 409, 410, 152, 411, 153, 154, 12, 412, 155, 156, 13, 157, 14, 15, 2,
+    413, 158, 159, 16, 160, 17, 18, 3, 161, 19, 20, 4, 21, 5, 6, 1,
+    0, 1108, 1109, 414, 1110, 415, 416, 162, 1111, 417, 418, 163, 419, 164, 165, 22,
+    1112, 420, 421, 166, 422, 167, 168, 23, 423, 169, 170, 24, 171, 25, 26, 1,
+    1113, 424, 425, 172, 426, 173, 174, 27, 427, 175, 176, 28, 177, 29, 30, 2,
+    428, 178, 179, 31, 180, 32, 33, 3, 181, 34, 35, 4, 36, 5, 6, 1,
+    1114, 429, 430, 182, 431, 183, 184, 37, 432, 185, 186, 38, 187, 39, 40, 7,
+    433, 188, 189, 41, 190, 42, 43, 8, 191, 44, 45, 9, 46, 10, 11, 1,
+    434, 192, 193, 47, 194, 48, 49, 12, 195, 50, 51, 13, 52, 14, 15, 2,
+    196, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 1115, 1116, 435, 1117, 436, 437, 197, 1118, 438, 439, 198, 440, 199, 200, 57,
+    1119, 441, 442, 201, 443, 202, 203, 58, 444, 204, 205, 59, 206, 60, 61, 1,
+    1120, 445, 446, 207, 447, 208, 209, 62, 448, 210, 211, 63, 212, 64, 65, 2,
+    449, 213, 214, 66, 215, 67, 68, 3, 216, 69, 70, 4, 71, 5, 6, 1,
+    1121, 450, 451, 217, 452, 218, 219, 72, 453, 220, 221, 73, 222, 74, 75, 7,
+    454, 223, 224, 76, 225, 77, 78, 8, 226, 79, 80, 9, 81, 10, 11, 1,
+    455, 227, 228, 82, 229, 83, 84, 12, 230, 85, 86, 13, 87, 14, 15, 2,
+    231, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    1122, 456, 457, 232, 458, 233, 234, 92, 459, 235, 236, 93, 237, 94, 95, 22,
+    460, 238, 239, 96, 240, 97, 98, 23, 241, 99, 100, 24, 101, 25, 26, 1,
+    461, 242, 243, 102, 244, 103, 104, 27, 245, 105, 106, 28, 107, 29, 30, 2,
+    246, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    462, 247, 248, 112, 249, 113, 114, 37, 250, 115, 116, 38, 117, 39, 40, 7,
+    251, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    252, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 1123, 0, 0, 0, 1124, 0, 1125, 1126, 463,
+    0, 0, 0, 1127, 0, 1128, 1129, 464, 0, 1130, 1131, 465, 1132, 466, 467, 1,
+    0, 0, 0, 1133, 0, 1134, 1135, 468, 0, 1136, 1137, 469, 1138, 470, 471, 2,
+    0, 1139, 1140, 472, 1141, 473, 474, 3, 1142, 475, 476, 4, 477, 5, 6, 1,
+    0, 0, 0, 1143, 0, 1144, 1145, 478, 0, 1146, 1147, 479, 1148, 480, 481, 7,
+    0, 1149, 1150, 482, 1151, 483, 484, 8, 1152, 485, 486, 9, 487, 10, 11, 1,
+    0, 1153, 1154, 488, 1155, 489, 490, 12, 1156, 491, 492, 13, 493, 14, 15, 2,
+    1157, 494, 495, 16, 496, 17, 18, 3, 497, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 1158, 0, 1159, 1160, 498, 0, 1161, 1162, 499, 1163, 500, 501, 22,
+    0, 1164, 1165, 502, 1166, 503, 504, 23, 1167, 505, 506, 24, 507, 25, 26, 1,
+    0, 1168, 1169, 508, 1170, 509, 510, 27, 1171, 511, 512, 28, 513, 29, 30, 2,
+    1172, 514, 515, 31, 516, 32, 33, 3, 517, 34, 35, 4, 36, 5, 6, 1,
+    0, 1173, 1174, 518, 1175, 519, 520, 37, 1176, 521, 522, 38, 523, 39, 40, 7,
+    1177, 524, 525, 41, 526, 42, 43, 8, 527, 44, 45, 9, 46, 10, 11, 1,
+    1178, 528, 529, 47, 530, 48, 49, 12, 531, 50, 51, 13, 52, 14, 15, 2,
+    532, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 1179, 0, 1180, 1181, 533, 0, 1182, 1183, 534, 1184, 535, 536, 57,
+    0, 1185, 1186, 537, 1187, 538, 539, 58, 1188, 540, 541, 59, 542, 60, 61, 1,
+    0, 1189, 1190, 543, 1191, 544, 545, 62, 1192, 546, 547, 63, 548, 64, 65, 2,
+    1193, 549, 550, 66, 551, 67, 68, 3, 552, 69, 70, 4, 71, 5, 6, 1,
+    0, 1194, 1195, 553, 1196, 554, 555, 72, 1197, 556, 557, 73, 558, 74, 75, 7,
+    1198, 559, 560, 76, 561, 77, 78, 8, 562, 79, 80, 9, 81, 10, 11, 1,
+    1199, 563, 564, 82, 565, 83, 84, 12, 566, 85, 86, 13, 87, 14, 15, 2,
+    567, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    0, 1200, 1201, 568, 1202, 569, 570, 92, 1203, 571, 572, 93, 573, 94, 95, 22,
+    1204, 574, 575, 96, 576, 97, 98, 23, 577, 99, 100, 24, 101, 25, 26, 1,
+    1205, 578, 579, 102, 580, 103, 104, 27, 581, 105, 106, 28, 107, 29, 30, 2,
+    582, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    1206, 583, 584, 112, 585, 113, 114, 37, 586, 115, 116, 38, 117, 39, 40, 7,
+    587, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    588, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 1207, 0, 1208, 1209, 589, 0, 1210, 1211, 590, 1212, 591, 592, 127,
+    0, 1213, 1214, 593, 1215, 594, 595, 128, 1216, 596, 597, 129, 598, 130, 131, 1,
+    0, 1217, 1218, 599, 1219, 600, 601, 132, 1220, 602, 603, 133, 604, 134, 135, 2,
+    1221, 605, 606, 136, 607, 137, 138, 3, 608, 139, 140, 4, 141, 5, 6, 1,
+    0, 1222, 1223, 609, 1224, 610, 611, 142, 1225, 612, 613, 143, 614, 144, 145, 7,
+    1226, 615, 616, 146, 617, 147, 148, 8, 618, 149, 150, 9, 151, 10, 11, 1,
+    1227, 619, 620, 152, 621, 153, 154, 12, 622, 155, 156, 13, 157, 14, 15, 2,
+    623, 158, 159, 16, 160, 17, 18, 3, 161, 19, 20, 4, 21, 5, 6, 1,
+    0, 1228, 1229, 624, 1230, 625, 626, 162, 1231, 627, 628, 163, 629, 164, 165, 22,
+    1232, 630, 631, 166, 632, 167, 168, 23, 633, 169, 170, 24, 171, 25, 26, 1,
+    1233, 634, 635, 172, 636, 173, 174, 27, 637, 175, 176, 28, 177, 29, 30, 2,
+    638, 178, 179, 31, 180, 32, 33, 3, 181, 34, 35, 4, 36, 5, 6, 1,
+    1234, 639, 640, 182, 641, 183, 184, 37, 642, 185, 186, 38, 187, 39, 40, 7,
+    643, 188, 189, 41, 190, 42, 43, 8, 191, 44, 45, 9, 46, 10, 11, 1,
+    644, 192, 193, 47, 194, 48, 49, 12, 195, 50, 51, 13, 52, 14, 15, 2,
+    196, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 1235, 1236, 645, 1237, 646, 647, 197, 1238, 648, 649, 198, 650, 199, 200, 57,
+    1239, 651, 652, 201, 653, 202, 203, 58, 654, 204, 205, 59, 206, 60, 61, 1,
+    1240, 655, 656, 207, 657, 208, 209, 62, 658, 210, 211, 63, 212, 64, 65, 2,
+    659, 213, 214, 66, 215, 67, 68, 3, 216, 69, 70, 4, 71, 5, 6, 1,
+    1241, 660, 661, 217, 662, 218, 219, 72, 663, 220, 221, 73, 222, 74, 75, 7,
+    664, 223, 224, 76, 225, 77, 78, 8, 226, 79, 80, 9, 81, 10, 11, 1,
+    665, 227, 228, 82, 229, 83, 84, 12, 230, 85, 86, 13, 87, 14, 15, 2,
+    231, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    1242, 666, 667, 232, 668, 233, 234, 92, 669, 235, 236, 93, 237, 94, 95, 22,
+    670, 238, 239, 96, 240, 97, 98, 23, 241, 99, 100, 24, 101, 25, 26, 1,
+    671, 242, 243, 102, 244, 103, 104, 27, 245, 105, 106, 28, 107, 29, 30, 2,
+    246, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    672, 247, 248, 112, 249, 113, 114, 37, 250, 115, 116, 38, 117, 39, 40, 7,
+    251, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    252, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 0, 0, 1243, 0, 1244, 1245, 673, 0, 1246, 1247, 674, 1248, 675, 676, 253,
+    0, 1249, 1250, 677, 1251, 678, 679, 254, 1252, 680, 681, 255, 682, 256, 257, 1,
+    0, 1253, 1254, 683, 1255, 684, 685, 258, 1256, 686, 687, 259, 688, 260, 261, 2,
+    1257, 689, 690, 262, 691, 263, 264, 3, 692, 265, 266, 4, 267, 5, 6, 1,
+    0, 1258, 1259, 693, 1260, 694, 695, 268, 1261, 696, 697, 269, 698, 270, 271, 7,
+    1262, 699, 700, 272, 701, 273, 274, 8, 702, 275, 276, 9, 277, 10, 11, 1,
+    1263, 703, 704, 278, 705, 279, 280, 12, 706, 281, 282, 13, 283, 14, 15, 2,
+    707, 284, 285, 16, 286, 17, 18, 3, 287, 19, 20, 4, 21, 5, 6, 1,
+    0, 1264, 1265, 708, 1266, 709, 710, 288, 1267, 711, 712, 289, 713, 290, 291, 22,
+    1268, 714, 715, 292, 716, 293, 294, 23, 717, 295, 296, 24, 297, 25, 26, 1,
+    1269, 718, 719, 298, 720, 299, 300, 27, 721, 301, 302, 28, 303, 29, 30, 2,
+    722, 304, 305, 31, 306, 32, 33, 3, 307, 34, 35, 4, 36, 5, 6, 1,
+    1270, 723, 724, 308, 725, 309, 310, 37, 726, 311, 312, 38, 313, 39, 40, 7,
+    727, 314, 315, 41, 316, 42, 43, 8, 317, 44, 45, 9, 46, 10, 11, 1,
+    728, 318, 319, 47, 320, 48, 49, 12, 321, 50, 51, 13, 52, 14, 15, 2,
+    322, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 1271, 1272, 729, 1273, 730, 731, 323, 1274, 732, 733, 324, 734, 325, 326, 57,
+    1275, 735, 736, 327, 737, 328, 329, 58, 738, 330, 331, 59, 332, 60, 61, 1,
+    1276, 739, 740, 333, 741, 334, 335, 62, 742, 336, 337, 63, 338, 64, 65, 2,
+    743, 339, 340, 66, 341, 67, 68, 3, 342, 69, 70, 4, 71, 5, 6, 1,
+    1277, 744, 745, 343, 746, 344, 345, 72, 747, 346, 347, 73, 348, 74, 75, 7,
+    748, 349, 350, 76, 351, 77, 78, 8, 352, 79, 80, 9, 81, 10, 11, 1,
+    749, 353, 354, 82, 355, 83, 84, 12, 356, 85, 86, 13, 87, 14, 15, 2,
+    357, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    1278, 750, 751, 358, 752, 359, 360, 92, 753, 361, 362, 93, 363, 94, 95, 22,
+    754, 364, 365, 96, 366, 97, 98, 23, 367, 99, 100, 24, 101, 25, 26, 1,
+    755, 368, 369, 102, 370, 103, 104, 27, 371, 105, 106, 28, 107, 29, 30, 2,
+    372, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    756, 373, 374, 112, 375, 113, 114, 37, 376, 115, 116, 38, 117, 39, 40, 7,
+    377, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    378, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    0, 1279, 1280, 757, 1281, 758, 759, 379, 1282, 760, 761, 380, 762, 381, 382, 127,
+    1283, 763, 764, 383, 765, 384, 385, 128, 766, 386, 387, 129, 388, 130, 131, 1,
+    1284, 767, 768, 389, 769, 390, 391, 132, 770, 392, 393, 133, 394, 134, 135, 2,
+    771, 395, 396, 136, 397, 137, 138, 3, 398, 139, 140, 4, 141, 5, 6, 1,
+    1285, 772, 773, 399, 774, 400, 401, 142, 775, 402, 403, 143, 404, 144, 145, 7,
+    776, 405, 406, 146, 407, 147, 148, 8, 408, 149, 150, 9, 151, 10, 11, 1,
+    777, 409, 410, 152, 411, 153, 154, 12, 412, 155, 156, 13, 157, 14, 15, 2,
+    413, 158, 159, 16, 160, 17, 18, 3, 161, 19, 20, 4, 21, 5, 6, 1,
+    1286, 778, 779, 414, 780, 415, 416, 162, 781, 417, 418, 163, 419, 164, 165, 22,
+    782, 420, 421, 166, 422, 167, 168, 23, 423, 169, 170, 24, 171, 25, 26, 1,
+    783, 424, 425, 172, 426, 173, 174, 27, 427, 175, 176, 28, 177, 29, 30, 2,
+    428, 178, 179, 31, 180, 32, 33, 3, 181, 34, 35, 4, 36, 5, 6, 1,
+    784, 429, 430, 182, 431, 183, 184, 37, 432, 185, 186, 38, 187, 39, 40, 7,
+    433, 188, 189, 41, 190, 42, 43, 8, 191, 44, 45, 9, 46, 10, 11, 1,
+    434, 192, 193, 47, 194, 48, 49, 12, 195, 50, 51, 13, 52, 14, 15, 2,
+    196, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1,
+    1287, 785, 786, 435, 787, 436, 437, 197, 788, 438, 439, 198, 440, 199, 200, 57,
+    789, 441, 442, 201, 443, 202, 203, 58, 444, 204, 205, 59, 206, 60, 61, 1,
+    790, 445, 446, 207, 447, 208, 209, 62, 448, 210, 211, 63, 212, 64, 65, 2,
+    449, 213, 214, 66, 215, 67, 68, 3, 216, 69, 70, 4, 71, 5, 6, 1,
+    791, 450, 451, 217, 452, 218, 219, 72, 453, 220, 221, 73, 222, 74, 75, 7,
+    454, 223, 224, 76, 225, 77, 78, 8, 226, 79, 80, 9, 81, 10, 11, 1,
+    455, 227, 228, 82, 229, 83, 84, 12, 230, 85, 86, 13, 87, 14, 15, 2,
+    231, 88, 89, 16, 90, 17, 18, 3, 91, 19, 20, 4, 21, 5, 6, 1,
+    792, 456, 457, 232, 458, 233, 234, 92, 459, 235, 236, 93, 237, 94, 95, 22,
+    460, 238, 239, 96, 240, 97, 98, 23, 241, 99, 100, 24, 101, 25, 26, 1,
+    461, 242, 243, 102, 244, 103, 104, 27, 245, 105, 106, 28, 107, 29, 30, 2,
+    246, 108, 109, 31, 110, 32, 33, 3, 111, 34, 35, 4, 36, 5, 6, 1,
+    462, 247, 248, 112, 249, 113, 114, 37, 250, 115, 116, 38, 117, 39, 40, 7,
+    251, 118, 119, 41, 120, 42, 43, 8, 121, 44, 45, 9, 46, 10, 11, 1,
+    252, 122, 123, 47, 124, 48, 49, 12, 125, 50, 51, 13, 52, 14, 15, 2,
+    126, 53, 54, 16, 55, 17, 18, 3, 56, 19, 20, 4, 21, 5, 6, 1
+};
+
+/*
+** Perfect hash for 6-card non-flush hands (18395 rank
+** multisets), keyed on the sum of quinary[] over the cards.
+** See find_fast6() in pokereval.h.
+*/
+const unsigned short hash6_adjust[] =
+{
+    0, 0, 4, 0, 1, 1, 11, 0, 0, 0, 0, 1, 10, 6, 2, 0,
+    16, 0, 12, 4, 8, 7, 2, 4, 3, 0, 3, 1, 1, 3, 0, 7,
+    0, 2, 10, 4, 0, 2, 7, 6, 0, 2, 0, 1, 0, 14, 1, 0,
+    0, 2, 1, 1, 5, 4, 18, 2, 1, 10, 0, 2, 0, 0, 3, 12,
+    10, 6, 3, 0, 3, 0, 1, 9, 0, 0, 0, 2, 2, 11, 0, 8,
+    0, 2, 1, 6, 0, 2, 0, 0, 8, 4, 0, 5, 10, 1, 0, 0,
+    0, 5, 1, 0, 2, 2, 20, 0, 1, 0, 0, 1, 6, 2, 1, 0,
+    18, 3, 2, 0, 1, 4, 14, 0, 10, 5, 4, 1, 0, 8, 0, 0,
+    2, 3, 19, 0, 3, 3, 1, 5, 0, 2, 6, 5, 3, 7, 14, 3,
+    0, 0, 3, 2, 2, 29, 0, 1, 1, 3, 1, 12, 1, 5, 1, 0,
+    3, 0, 6, 6, 21, 2, 19, 3, 12, 14, 3, 2, 18, 4, 0, 14,
+    0, 1, 1, 6, 2, 0, 1, 5, 3, 1, 4, 0, 0, 0, 1, 9,
+    0, 6, 1, 42, 3, 18, 6, 4, 0, 1, 1, 16, 4, 3, 4, 4,
+    1, 11, 6, 3, 0, 2, 3, 16, 0, 3, 10, 0, 0, 1, 0, 7,
+    4, 8, 0, 1, 1, 3, 2, 0, 2, 3, 7, 0, 4, 0, 0, 4,
+    4, 1, 3, 17, 2, 0, 2, 0, 1, 2, 0, 0, 1, 4, 14, 20,
+    0, 7, 1, 0, 1, 5, 6, 3, 0, 0, 13, 0, 9, 0, 9, 4,
+    0, 2, 0, 1, 1, 4, 7, 0, 1, 1, 3, 3, 2, 0, 1, 3,
+    0, 0, 1, 11, 0, 0, 11, 8, 1, 2, 7, 8, 6, 0, 1, 3,
+    4, 0, 0, 8, 2, 5, 8, 0, 4, 7, 2, 7, 3, 5, 1, 0,
+    0, 4, 4, 11, 0, 3, 6, 0, 0, 1, 3, 0, 2, 0, 0, 7,
+    6, 2, 2, 0, 15, 4, 5, 0, 6, 3, 0, 1, 0, 5, 5, 6,
+    2, 0, 0, 3, 9, 4, 15, 13, 3, 1, 0, 2, 1, 3, 3, 7,
+    2, 10, 6, 1, 0, 19, 0, 13, 8, 24, 5, 12, 13, 2, 1, 0,
+    0, 3, 0, 0, 2, 3, 0, 1, 0, 7, 0, 0, 1, 0, 6, 1,
+    0, 0, 12, 2, 6, 5, 1, 9, 3, 0, 5, 4, 9, 8, 1, 0,
+    2, 4, 1, 3, 2, 2, 0, 1, 4, 0, 1, 11, 16, 4, 1, 3,
+    7, 27, 21, 4, 3, 8, 0, 1, 1, 0, 6, 10, 13, 1, 0, 0,
+    0, 6, 1, 0, 2, 0, 2, 1, 4, 0, 0, 8, 2, 0, 5, 2,
+    1, 10, 8, 1, 0, 4, 8, 1, 13, 3, 2, 2, 11, 0, 2, 15,
+    0, 2, 1, 13, 1, 1, 1, 3, 10, 0, 1, 0, 0, 8, 5, 1,
+    3, 0, 0, 5, 3, 2, 1, 2, 0, 4, 6, 1, 0, 2, 0, 2,
+    3, 8, 0, 8, 1, 18, 1, 0, 0, 0, 2, 7, 1, 0, 1, 13,
+    3, 27, 4, 2, 0, 3, 0, 5, 9, 8, 2, 0, 1, 2, 0, 1,
+    2, 2, 3, 22, 2, 3, 0, 0, 2, 1, 0, 2, 0, 1, 13, 0,
+    25, 1, 3, 6, 5, 11, 3, 0, 10, 0, 0, 0, 1, 5, 0, 11,
+    4, 1, 1, 0, 0, 2, 0, 8, 1, 2, 28, 6, 1, 5, 5, 20,
+    0, 2, 6, 1, 2, 1, 0, 1, 0, 3, 1, 6, 2, 0, 0, 3,
+    1, 1, 6, 0, 6, 10, 0, 2, 2, 0, 0, 2, 0, 23, 4, 6,
+    2, 6, 2, 2, 1, 1, 0, 7, 1, 0, 0, 2, 2, 1, 4, 0,
+    0, 7, 3, 0, 22, 2, 2, 0, 1, 2, 0, 6, 9, 4, 5, 2,
+    0, 1, 0, 3, 0, 0, 19, 1, 1, 26, 3, 1, 0, 3, 1, 3,
+    9, 13, 0, 9, 0, 4, 0, 0, 0, 1, 11, 0, 18, 4, 11, 6,
+    3, 1, 4, 6, 0, 11, 4, 5, 2, 4, 5, 3, 4, 13, 4, 22,
+    2, 4, 1, 9, 3, 3, 0, 17, 3, 0, 3, 1, 0, 3, 18, 0,
+    0, 0, 3, 15, 0, 0, 0, 2, 0, 25, 2, 1, 5, 7, 4, 3,
+    0, 4, 1, 28, 3, 5, 4, 0, 8, 4, 8, 4, 15, 5, 0, 8,
+    2, 13, 3, 2, 0, 3, 0, 2, 3, 3, 1, 0, 13, 8, 0, 9,
+    19, 4, 15, 0, 3, 21, 5, 1, 0, 4, 22, 5, 19, 0, 0, 1,
+    2, 0, 6, 1, 5, 23, 2, 1, 7, 0, 3, 1, 0, 4, 9, 7,
+    2, 9, 15, 4, 1, 23, 6, 21, 1, 4, 18, 0, 2, 0, 1, 1,
+    1, 5, 11, 0, 8, 2, 3, 5, 14, 1, 5, 9, 10, 0, 19, 2,
+    0, 8, 2, 5, 0, 1, 3, 5, 0, 54, 3, 9, 3, 0, 1, 3,
+    2, 0, 1, 0, 10, 16, 3, 3, 0, 0, 6, 4, 21, 5, 4, 0,
+    1, 0, 1, 0, 1, 2, 1, 2, 1, 2, 0, 16, 0, 1, 0, 3,
+    2, 0, 7, 0, 0, 0, 7, 5, 1, 0, 2, 0, 1, 0, 1, 14,
+    11, 1, 6, 0, 5, 0, 6, 0, 1, 6, 7, 21, 0, 16, 11, 1,
+    0, 2, 9, 6, 3, 0, 2, 10, 2, 0, 0, 0, 0, 6, 0, 21,
+    4, 2, 6, 5, 19, 1, 2, 0, 2, 9, 0, 5, 0, 10, 2, 4,
+    1, 20, 16, 0, 0, 0, 11, 6, 8, 0, 5, 0, 10, 5, 1, 2,
+    13, 4, 1, 1, 16, 5, 11, 0, 0, 1, 4, 0, 1, 0, 1, 3,
+    8, 3, 6, 1, 1, 0, 1, 1, 7, 3, 0, 0, 0, 2, 0, 1,
+    8, 12, 10, 1, 0, 13, 1, 1, 0, 8, 1, 6, 4, 0, 0, 1,
+    7, 12, 12, 7, 6, 3, 1, 1, 0, 0, 7, 1, 2, 8, 3, 6,
+    5, 13, 0, 10, 9, 2, 4, 4, 1, 2, 10, 0, 0, 13, 0, 0,
+    3, 5, 0, 15, 3, 0, 10, 1, 5, 14, 0, 2, 2, 27, 0, 5,
+    1, 13, 0, 1, 0, 5, 0, 2, 5, 0, 3, 0, 2, 3, 0, 4,
+    8, 6, 0, 1, 2, 2, 0, 0, 0, 0, 2, 12, 2, 3, 4, 0,
+    0, 0, 2, 6, 9, 6, 15, 0, 4, 0, 0, 0, 8, 1, 2, 2,
+    0, 2, 0, 2, 6, 0, 6, 0, 4, 0, 2, 2, 1, 0, 4, 0,
+    3, 1, 0, 1, 0, 0, 5, 8, 20, 1, 3, 0, 6, 0, 2, 4,
+    8, 1, 0, 3, 0, 13, 0, 9, 1, 2, 0, 7, 3, 1, 12, 0,
+    3, 23, 2, 1, 6, 0, 0, 6, 2, 30, 0, 0, 0, 2, 1, 0,
+    2, 1, 8, 1, 1, 0, 16, 5, 0, 1, 2, 0, 5, 1, 0, 1,
+    3, 2, 0, 0, 7, 5, 3, 4, 3, 0, 2, 0, 0, 1, 2, 7,
+    1, 0, 0, 0, 6, 1, 0, 11, 4, 2, 3, 7, 1, 0, 3, 0,
+    2, 1, 1, 1, 0, 0, 6, 5, 4, 10, 3, 1, 2, 0, 3, 1,
+    0, 1, 1, 2, 0, 0, 0, 0, 5, 12, 0, 0, 6, 0, 28, 8,
+    2, 0, 3, 2, 0, 13, 2, 6, 3, 4, 1, 0, 14, 0, 0, 1,
+    0, 0, 2, 5, 8, 0, 1, 0, 1, 1, 6, 6, 0, 0, 1, 0,
+    17, 8, 8, 2, 9, 8, 4, 5, 2, 3, 0, 1, 1, 6, 2, 0,
+    1, 3, 0, 8, 0, 0, 0, 7, 1, 3, 1, 7, 1, 3, 9, 1,
+    8, 0, 1, 9, 26, 1, 3, 2, 0, 0, 0, 18, 0, 1, 1, 5,
+    0, 0, 3, 0, 1, 8, 6, 2, 0, 2, 0, 1, 5, 3, 9, 9,
+    0, 0, 10, 0, 6, 1, 1, 6, 1, 1, 0, 0, 0, 0, 6, 16,
+    10, 11, 1, 0, 0, 0, 24, 0, 7, 1, 3, 0, 2, 0, 0, 0,
+    0, 2, 1, 2, 11, 0, 0, 0, 1, 12, 16, 0, 0, 1, 16, 0,
+    0, 0, 0, 0, 3, 2, 1, 0, 1, 1, 0, 4, 4, 0, 1, 0,
+    0, 1, 7, 6, 11, 0, 5, 0, 32, 0, 1, 0, 0, 1, 2, 3,
+    0, 0, 11, 0, 1, 0, 7, 2, 6, 5, 4, 3, 0, 0, 0, 1,
+    1, 5, 0, 5, 4, 0, 1, 3, 19, 1, 6, 3, 1, 0, 2, 11,
+    4, 5, 11, 2, 0, 0, 0, 0, 0, 7, 4, 4, 0, 8, 1, 0,
+    7, 2, 1, 2, 13, 0, 36, 3, 8, 3, 41, 5, 3, 1, 2, 5,
+    6, 6, 4, 0, 7, 8, 2, 0, 4, 3, 1, 1, 0, 2, 10, 0,
+    0, 5, 1, 8, 2, 0, 5, 0, 4, 8, 8, 4, 26, 4, 10, 0,
+    2, 0, 3, 10, 3, 6, 3, 0, 0, 0, 6, 6, 0, 0, 0, 1,
+    10, 2, 0, 4, 6, 2, 7, 10, 4, 4, 1, 7, 5, 1, 0, 2,
+    0, 0, 1, 5, 0, 2, 28, 14, 5, 1, 0, 0, 9, 16, 9, 2,
+    4, 19, 0, 2, 2, 4, 8, 10, 7, 2, 9, 5, 3, 3, 0, 0,
+    3, 6, 0, 0, 2, 2, 0, 0, 0, 3, 3, 0, 1, 0, 0, 18,
+    2, 3, 14, 3, 10, 7, 6, 0, 46, 0, 2, 9, 14, 0, 2, 1,
+    2, 7, 5, 0, 5, 11, 1, 6, 4, 2, 0, 0, 2, 2, 1, 11,
+    1, 0, 0, 0, 18, 1, 0, 8, 26, 0, 3, 17, 2, 1, 2, 15,
+    20, 1, 1, 4, 0, 0, 8, 6, 2, 9, 2, 0, 4, 0, 8, 0,
+    0, 0, 7, 4, 8, 8, 0, 0, 1, 1, 0, 0, 7, 7, 0, 5,
+    0, 12, 0, 1, 0, 2, 14, 1, 8, 1, 13, 2, 23, 1, 5, 6,
+    2, 1, 3, 2, 2, 0, 1, 8, 0, 2, 5, 7, 0, 7, 3, 4,
+    1, 0, 8, 0, 1, 1, 1, 1, 0, 6, 0, 3, 2, 2, 0, 5,
+    0, 1, 10, 0, 2, 0, 5, 14, 3, 7, 0, 2, 2, 1, 0, 3,
+    0, 2, 4, 2, 1, 13, 7, 1, 8, 1, 3, 14, 8, 2, 23, 1,
+    0, 1, 6, 1, 0, 0, 1, 1, 3, 4, 11, 2, 1, 3, 9, 1,
+    38, 4, 34, 6, 2, 10, 0, 1, 2, 0, 0, 2, 4, 12, 21, 0,
+    0, 0, 0, 0, 2, 19, 10, 0, 1, 9, 4, 0, 0, 14, 0, 3,
+    2, 4, 37, 3, 6, 0, 10, 0, 1, 39, 17, 4, 2, 35, 5, 0,
+    5, 7, 1, 0, 7, 0, 0, 0, 1, 5, 10, 0, 1, 12, 14, 36,
+    1, 4, 21, 5, 13, 4, 2, 1, 16, 3, 4, 1, 5, 1, 39, 18,
+    1, 15, 14, 1, 0, 21, 0, 4, 4, 5, 0, 0, 1, 11, 3, 8,
+    6, 14, 8, 7, 0, 9, 3, 1, 10, 18, 6, 3, 9, 9, 2, 0,
+    5, 2, 2, 0, 0, 2, 9, 6, 1, 1, 0, 2, 1, 1, 10, 5,
+    3, 8, 5, 3, 16, 0, 2, 3, 9, 3, 16, 7, 8, 9, 2, 5,
+    13, 2, 0, 3, 16, 40, 21, 2, 1, 2, 2, 2, 2, 2, 1, 1,
+    0, 8, 1, 11, 1, 0, 3, 0, 8, 0, 3, 2, 2, 1, 2, 4,
+    6, 0, 2, 20, 0, 7, 6, 13, 0, 8, 0, 14, 3, 0, 7, 0,
+    0, 0, 0, 4, 8, 4, 12, 3, 10, 4, 0, 12, 8, 0, 1, 7,
+    7, 1, 10, 9, 6, 32, 6, 0, 7, 2, 11, 0, 1, 11, 2, 0,
+    7, 1, 12, 0, 3, 0, 4, 2, 5, 4, 0, 2, 1, 0, 24, 4,
+    0, 5, 0, 0, 0, 0, 3, 16, 8, 9, 15, 1, 8, 12, 6, 7,
+    19, 2, 2, 0, 11, 8, 2, 0, 9, 2, 3, 11, 2, 1, 8, 0,
+    0, 0, 6, 2, 7, 1, 5, 12, 1, 2, 22, 0, 10, 1, 0, 4,
+    0, 6, 2, 12, 2, 0, 3, 0, 8, 7, 4, 0, 14, 8, 4, 2,
+    6, 12, 3, 2, 10, 2, 1, 25, 12, 7, 0, 6, 23, 76, 9, 3,
+    0, 12, 0, 17, 0, 5, 4, 20, 13, 0, 1, 3, 0, 0, 6, 0,
+    2, 0, 18, 0, 0, 1, 1, 0, 25, 0, 1, 0, 8, 1, 1, 0,
+    1, 4, 17, 0, 8, 0, 3, 6, 10, 18, 22, 17, 0, 27, 0, 3,
+    21, 1, 1, 3, 0, 1, 8, 0, 5, 9, 1, 15, 7, 0, 4, 0,
+    1, 0, 2, 5, 12, 1, 6, 8, 0, 2, 0, 35, 9, 13, 1, 0,
+    0, 0, 33, 0, 0, 14, 10, 8, 2, 3, 5, 0, 0, 3, 1, 4,
+    0, 8, 1, 1, 6, 0, 11, 1, 1, 0, 12, 1, 0, 0, 2, 0,
+    16, 11, 6, 3, 23, 12, 2, 8, 0, 0, 7, 2, 5, 3, 1, 2,
+    0, 0, 0, 8, 65, 7, 3, 4, 6, 2, 11, 2, 1, 0, 34, 1,
+    0, 0, 0, 1, 2, 1, 24, 3, 0, 0, 5, 0, 6, 0, 4, 3,
+    0, 2, 0, 2, 0, 1, 0, 0, 1, 7, 10, 0, 3, 4, 6, 8,
+    7, 0, 8, 9, 8, 0, 1, 11, 5, 1, 0, 0, 23, 0, 0, 8,
+    3, 47, 1, 10, 1, 1, 12, 8, 6, 6, 4, 0, 1, 0, 3, 5,
+    11, 4, 47, 5, 20, 5, 17, 1, 2, 0, 1, 0, 2, 27, 0, 1,
+    1, 3, 0, 7, 27, 25, 1, 3, 0, 1, 1, 3, 10, 4, 30, 3,
+    4, 16, 25, 5, 2, 3, 0, 0, 10, 4, 18, 0, 10, 0, 0, 6,
+    6, 2, 8, 0, 21, 1, 6, 4, 6, 7, 1, 12, 1, 0, 11, 6,
+    13, 17, 0, 2, 2, 3, 5, 2, 1, 5, 1, 3, 15, 13, 1, 13,
+    15, 13, 1, 4, 8, 3, 8, 8, 15, 22, 2, 0, 11, 6, 3, 12,
+    1, 1, 4, 3, 0, 7, 2, 0, 0, 12, 2, 7, 0, 0, 2, 1,
+    7, 0, 2, 1, 21, 2, 3, 14, 0, 3, 0, 11, 6, 9, 9, 10,
+    1, 5, 5, 0, 2, 2, 8, 4, 0, 0, 29, 17, 1, 11, 2, 3,
+    0, 3, 0, 0, 10, 1, 0, 0, 4, 2, 4, 0, 12, 0, 22, 0,
+    1, 4, 6, 0, 17, 2, 4, 0, 0, 4, 0, 1, 0, 20, 3, 1,
+    0, 8, 3, 9, 0, 1, 6, 5, 14, 0, 1, 0, 0, 0, 8, 3,
+    5, 2, 4, 8, 1, 1, 0, 11, 5, 17, 8, 6, 7, 3, 3, 0,
+    21, 3, 4, 9, 0, 0, 3, 0, 5, 3, 5, 29, 3, 0, 0, 0,
+    7, 19, 0, 5, 12, 10, 0, 0, 1, 8, 0, 1, 7, 0, 7, 2,
+    0, 0, 5, 8, 0, 8, 9, 4, 0, 17, 4, 6, 1, 3, 5, 7,
+    11, 1, 2, 1, 1, 0, 5, 2, 0, 5, 0, 1, 0, 2, 14, 4,
+    0, 1, 9, 1, 3, 9, 0, 15, 20, 0, 0, 3, 1, 0, 1, 2,
+    2, 1, 12, 5, 7, 7, 6, 2, 0, 2, 10, 5, 2, 7, 22, 3,
+    5, 0, 4, 0, 11, 12, 1, 2, 5, 2, 1, 17, 4, 1, 2, 3,
+    2, 4, 4, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 8, 0,
+    0, 2, 3, 14, 1, 0, 3, 3, 23, 28, 4, 0, 0, 21, 7, 0,
+    4, 1, 21, 1, 10, 1, 0, 0, 3, 2, 0, 2, 0, 1, 0, 2,
+    0, 24, 0, 1, 1, 0, 6, 1, 2, 0, 0, 0, 0, 0, 0, 1,
+    2, 0, 0, 6, 0, 5, 14, 2, 2, 38, 0, 1, 0, 6, 1, 1,
+    0, 10, 11, 3, 0, 8, 6, 1, 1, 1, 24, 4, 1, 2, 0, 0,
+    4, 0, 4, 4, 1, 2, 0, 0, 0, 0, 0, 0, 1, 5, 25, 2,
+    0, 0, 5, 2, 0, 1, 2, 1, 4, 1, 5, 12, 13, 14, 0, 0,
+    16, 1, 0, 1, 1, 0, 13, 0, 9, 0, 5, 9, 0, 17, 0, 2,
+    2, 2, 0, 15, 25, 0, 5, 0, 14, 1, 2, 0, 2, 7, 0, 1,
+    2, 18, 5, 0, 5, 5, 10, 14, 3, 24, 16, 3, 3, 0, 14, 0,
+    3, 0, 0, 6, 5, 10, 0, 5, 6, 1, 6, 16, 0, 0, 8, 0,
+    2, 9, 0, 2, 0, 1, 0, 0, 0, 0, 20, 0, 2, 3, 2, 8,
+    10, 2, 1, 7, 39, 11, 4, 28, 3, 6, 3, 0, 3, 7, 2, 26,
+    1, 2, 18, 7, 1, 16, 0, 13, 0, 1, 0, 1, 10, 0, 13, 1,
+    0, 0, 0, 0, 0, 5, 13, 10, 2, 0, 1, 4, 2, 0, 30, 2,
+    6, 4, 1, 4, 5, 3, 3, 1, 2, 21, 0, 2, 9, 0, 1, 3,
+    1, 1, 2, 0, 3, 15, 10, 21, 3, 5, 0, 6, 2, 7, 0, 0,
+    2, 4, 0, 11, 1, 0, 1, 15, 8, 7, 1, 1, 26, 15, 5, 3,
+    2, 4, 0, 0, 0, 1, 0, 15, 8, 8, 4, 61, 3, 4, 8, 0,
+    1, 0, 14, 0, 3, 7, 15, 1, 0, 2, 6, 0, 3, 15, 0, 1,
+    0, 0, 2, 10, 0, 0, 0, 9, 3, 0, 2, 41, 6, 1, 0, 0,
+    6, 3, 18, 3, 10, 2, 5, 3, 4, 16, 0, 4, 2, 0, 1, 2,
+    8, 0, 0, 0, 0, 27, 1, 23, 2, 26, 1, 2, 2, 0, 4, 1,
+    2, 0, 2, 0, 22, 0, 7, 0, 2, 17, 8, 4, 0, 17, 5, 9,
+    10, 2, 5, 0, 9, 5, 0, 2, 1, 10, 2, 1, 1, 0, 0, 1,
+    7, 1, 5, 0, 9, 0, 1, 1, 2, 0, 0, 22, 0, 8, 0, 1,
+    3, 4, 0, 0, 15, 15, 3, 4, 1, 7, 6, 1, 1, 3, 12, 8,
+    0, 3, 2, 0, 4, 2, 2, 0, 0, 0, 4, 0, 0, 9, 2, 3,
+    6, 15, 0, 0, 0, 10, 15, 0, 9, 0, 2, 1, 2, 3, 7, 9,
+    2, 3, 0, 33, 0, 6, 7, 2, 10, 17, 1, 0, 10, 1, 2, 3,
+    5, 0, 16, 3, 5, 1, 2, 12, 0, 5, 0, 20, 2, 3, 3, 1,
+    1, 4, 0, 2, 10, 2, 5, 8, 1, 1, 9, 1, 1, 1, 0, 2,
+    1, 17, 0, 2, 11, 1, 13, 0, 1, 7, 4, 8, 0, 19, 0, 0,
+    5, 7, 14, 3, 2, 1, 5, 1, 1, 9, 10, 16, 7, 3, 3, 7,
+    8, 4, 2, 1, 2, 7, 4, 6, 0, 4, 1, 0, 1, 6, 2, 4,
+    0, 4, 0, 11, 2, 2, 5, 14, 1, 5, 0, 0, 0, 0, 8, 5,
+    5, 2, 3, 1, 3, 1, 2, 3, 5, 9, 2, 0, 0, 0, 3, 16,
+    4, 13, 2, 3, 13, 23, 7, 11, 4, 26, 3, 8, 1, 0, 21, 20,
+    1, 17, 9, 2, 6, 2, 1, 3, 5, 0, 15, 3, 2, 11, 0, 0,
+    16, 4, 6, 0, 0, 0, 0, 11, 0, 23, 1, 1, 0, 8, 1, 11,
+    2, 41, 4, 0, 10, 1, 18, 1, 0, 15, 0, 2, 6, 14, 9, 9,
+    0, 6, 0, 1, 9, 6, 0, 3, 0, 6, 0, 11, 4, 22, 5, 0,
+    11, 5, 1, 0, 1, 0, 8, 0, 13, 2, 0, 0, 0, 2, 3, 0,
+    2, 18, 10, 4, 57, 2, 18, 2, 13, 0, 0, 11, 2, 4, 0, 7,
+    0, 0, 5, 6, 2, 0, 17, 11, 1, 11, 2, 17, 9, 0, 2, 3,
+    5, 1, 0, 0, 0, 1, 20, 0, 5, 0, 10, 29, 10, 12, 2, 1,
+    11, 15, 3, 3, 5, 7, 0, 1, 59, 22, 0, 2, 10, 13, 1, 0,
+    1, 4, 7, 3, 0, 5, 9, 0, 6, 2, 7, 0, 2, 6, 6, 2,
+    3, 7, 19, 2, 0, 0, 14, 1, 2, 4, 4, 8, 12, 4, 1, 7,
+    3, 22, 3, 6, 17, 17, 18, 2, 2, 4, 0, 2, 2, 0, 0, 4,
+    0, 5, 6, 17, 11, 4, 5, 0, 3, 0, 24, 2, 17, 0, 1, 2,
+    5, 2, 0, 2, 5, 0, 13, 1, 4, 16, 13, 6, 4, 10, 2, 5,
+    1, 13, 2, 12, 2, 19, 1, 1, 10, 7, 13, 2, 3, 0, 3, 0,
+    9, 0, 3, 23, 11, 0, 0, 2, 4, 1, 4, 7, 1, 0, 15, 9,
+    0, 0, 0, 19, 1, 2, 1, 0, 1, 0, 0, 0, 0, 0, 6, 1,
+    1, 2, 2, 1, 10, 5, 10, 3, 4, 8, 0, 2, 1, 10, 1, 3,
+    4, 1, 0, 0, 0, 4, 26, 1, 4, 2, 8, 7, 8, 3, 0, 1,
+    0, 0, 7, 1, 0, 7, 3, 4, 1, 3, 16, 9, 11, 0, 2, 13,
+    10, 2, 1, 1, 0, 5, 0, 7, 10, 0, 3, 2, 0, 4, 6, 0,
+    8, 1, 8, 3, 8, 12, 3, 7, 0, 13, 4, 5, 0, 4, 0, 0,
+    17, 0, 1, 11, 10, 12, 0, 12, 3, 14, 5, 0, 5, 11, 1, 5,
+    6, 4, 8, 3, 0, 0, 5, 7, 7, 0, 20, 2, 24, 0, 11, 21,
+    4, 8, 11, 19, 3, 8, 0, 1, 9, 16, 13, 10, 0, 11, 3, 21,
+    0, 8, 1, 0, 3, 0, 6, 3, 12, 7, 0, 8, 12, 3, 6, 6,
+    5, 16, 3, 7, 1, 8, 0, 10, 0, 22, 8, 1, 1, 28, 0, 20,
+    0, 8, 9, 0, 0, 1, 3, 0, 0, 13, 2, 3, 8, 6, 0, 33,
+    1, 14, 15, 3, 4, 33, 3, 15, 1, 6, 3, 0, 12, 1, 2, 36,
+    9, 1, 8, 0, 6, 0, 6, 0, 2, 4, 9, 2, 6, 13, 0, 19,
+    1, 1, 5, 2, 2, 10, 6, 7, 1, 6, 11, 4, 9, 8, 4, 4,
+    2, 5, 4, 0, 0, 12, 2, 13, 2, 7, 0, 10, 3, 3, 10, 1,
+    0, 3, 10, 54, 1, 2, 7, 4, 3, 2, 0, 1, 0, 8, 13, 0,
+    17, 6, 2, 9, 1, 0, 4, 0, 11, 2, 0, 6, 8, 0, 2, 2,
+    4, 0, 1, 16, 6, 0, 5, 18, 11, 13, 3, 23, 6, 2, 1, 1,
+    23, 4, 10, 9, 5, 1, 1, 11, 0, 17, 41, 1, 9, 9, 0, 1,
+    0, 5, 4, 0, 19, 6, 30, 2, 10, 0, 1, 0, 21, 1, 12, 13,
+    0, 5, 19, 3, 3, 0, 0, 1, 4, 2, 0, 4, 28, 12, 0, 6,
+    8, 3, 17, 3, 9, 0, 0, 2, 5, 1, 18, 5, 11, 7, 5, 10,
+    9, 4, 6, 1, 1, 0, 1, 1, 54, 15, 2, 0, 2, 5, 6, 14,
+    0, 0, 0, 18, 14, 2, 1, 0, 2, 0, 1, 21, 11, 3, 1, 7,
+    0, 10, 0, 0, 12, 18, 13, 14, 7, 14, 5, 4, 2, 2, 5, 2,
+    0, 0, 0, 1, 14, 2, 0, 24, 7, 2, 25, 0, 39, 4, 21, 5,
+    17, 1, 0, 1, 1, 11, 5, 0, 15, 1, 16, 14, 5, 0, 0, 2,
+    4, 4, 0, 4, 10, 8, 6, 4, 2, 7, 4, 2, 21, 0, 13, 1,
+    0, 6, 1, 8, 1, 11, 3, 1, 3, 2, 12, 2, 8, 3, 4, 9,
+    9, 0, 0, 2, 0, 1, 4, 33, 3, 10, 24, 8, 21, 8, 6, 1,
+    1, 7, 1, 11, 0, 3, 6, 0, 5, 0, 3, 2, 1, 8, 8, 10,
+    3, 5, 14, 1, 1, 50, 1, 14, 29, 0, 24, 1, 9, 0, 9, 7,
+    7, 18, 4, 5, 1, 4, 4, 3, 10, 26, 3, 9, 30, 3, 6, 13,
+    31, 8, 2, 2, 1, 0, 2, 1, 1, 32, 18, 1, 2, 19, 6, 0,
+    31, 25, 0, 1, 0, 12, 18, 23, 2, 2, 0, 16, 29, 3, 14, 7,
+    2, 6, 13, 2, 17, 19, 3, 3, 0, 2, 10, 6, 1, 2, 1, 3
+};
+
+const unsigned short hash6_values[] =
+{
+    273, 3283, 7202, 0, 188, 5601, 260, 5328, 0, 4492, 0, 6015, 6973, 3085, 4448, 218,
+    0, 0, 6649, 3238, 0, 0, 0, 0, 3996, 6021, 0, 5708, 2738, 0, 175, 5933,
+    247, 221, 2512, 2281, 3277, 2602, 2627, 0, 24, 6953, 5202, 0, 2138, 3092, 0, 4218,
+    0, 5124, 74, 0, 3547, 0, 2887, 0, 0, 0, 0, 0, 0, 3078, 2944, 6610,
+    5846, 2505, 0, 2996, 5498, 3173, 5692, 0, 0, 2692, 3834, 0, 5131, 0, 0, 205,
+    0, 3041, 0, 2932, 2922, 1985, 0, 0, 0, 0, 0, 0, 3119, 6680, 0, 2303,
+    7012, 0, 1687, 0, 282, 0, 0, 0, 2243, 4626, 0, 0, 2591, 6231, 2854, 0,
+    0, 0, 0, 3785, 0, 1998, 287, 4275, 0, 5154, 3327, 179, 7021, 248, 0, 0,
+    6077, 0, 0, 50, 2711, 0, 2100, 1881, 7114, 0, 0, 1612, 0, 3394, 0, 5669,
+    5994, 0, 2727, 4719, 0, 0, 2867, 0, 4426, 0, 5746, 2028, 5464, 0, 0, 2616,
+    208, 0, 0, 2818, 0, 3998, 0, 0, 0, 0, 5730, 0, 2347, 2204, 0, 3428,
+    0, 0, 0, 6882, 2469, 0, 2405, 0, 0, 0, 2494, 0, 0, 0, 0, 0,
+    5196, 2908, 0, 6033, 6068, 108, 4939, 2787, 0, 3631, 11, 5803, 14, 5995, 3846, 4749,
+    6217, 0, 250, 2844, 3232, 6575, 2589, 0, 0, 177, 4445, 3580, 4646, 0, 0, 2008,
+    166, 3003, 0, 2702, 171, 2198, 5805, 0, 0, 0, 7036, 2368, 0, 2337, 0, 2792,
+    0, 0, 0, 1826, 4666, 0, 0, 6560, 0, 3574, 0, 299, 4590, 61, 95, 4009,
+    0, 0, 4933, 93, 1699, 5890, 132, 6806, 3251, 4895, 4890, 2791, 2989, 3366, 2776, 0,
+    0, 304, 0, 1979, 6422, 7056, 2655, 0, 4667, 2582, 3150, 0, 2021, 3406, 289, 2732,
+    2055, 1663, 2749, 277, 279, 5362, 7246, 60, 0, 3197, 0, 172, 0, 5073, 3322, 0,
+    0, 0, 3033, 0, 3132, 2058, 0, 0, 0, 2584, 0, 0, 0, 4430, 1763, 0,
+    3028, 0, 5105, 4438, 0, 7231, 5581, 3009, 3560, 0, 0, 2978, 3210, 2680, 0, 2162,
+    0, 0, 0, 0, 2755, 4832, 0, 0, 0, 0, 197, 2915, 0, 5444, 321, 0,
+    3106, 2132, 0, 4564, 0, 0, 0, 0, 0, 2718, 5586, 6260, 3170, 0, 0, 5258,
+    0, 0, 0, 3737, 6145, 2833, 2559, 0, 0, 5530, 0, 3102, 0, 0, 2635, 0,
+    0, 0, 3023, 198, 2721, 2901, 5659, 2821, 192, 5253, 2656, 0, 2954, 4746, 0, 5833,
+    0, 0, 3722, 0, 2600, 0, 2952, 3786, 0, 278, 2569, 2118, 0, 0, 0, 2832,
+    5680, 0, 0, 5261, 1927, 0, 0, 2524, 1759, 0, 2811, 0, 6969, 5643, 3746, 0,
+    5093, 0, 5757, 0, 4800, 0, 0, 0, 2574, 0, 2746, 0, 0, 2921, 0, 5560,
+    0, 3879, 2890, 4273, 0, 3824, 0, 2084, 1697, 1912, 0, 0, 0, 2228, 5397, 131,
+    5795, 0, 0, 2590, 0, 4517, 0, 0, 3062, 0, 0, 0, 1745, 6187, 4365, 2479,
+    6683, 3888, 0, 0, 0, 4221, 2534, 3219, 0, 3209, 0, 2827, 3012, 0, 0, 1610,
+    3953, 0, 0, 0, 3081, 49, 269, 2218, 4704, 5979, 0, 5561, 0, 241, 2866, 2486,
+    0, 2864, 0, 2743, 0, 4344, 0, 0, 0, 0, 2169, 3646, 0, 0, 0, 0,
+    0, 0, 0, 3384, 48, 119, 0, 4208, 2403, 6742, 0, 0, 0, 0, 4137, 0,
+    0, 115, 0, 12, 0, 2972, 252, 1633, 2782, 0, 0, 3702, 4391, 0, 2112, 0,
+    3431, 5968, 1824, 161, 3098, 3689, 5980, 0, 33, 2208, 2036, 4436, 6435, 4924, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4122, 5857, 5822, 0, 5774, 0, 2528, 2700, 0,
+    0, 171, 0, 0, 0, 5009, 1869, 306, 0, 6420, 0, 0, 235, 0, 0, 4541,
+    0, 0, 0, 3490, 0, 2924, 217, 4001, 7242, 296, 0, 0, 0, 2104, 3663, 6694,
+    6279, 5818, 0, 0, 4880, 189, 1744, 3211, 0, 0, 1681, 6572, 1848, 5634, 1964, 4647,
+    0, 0, 5813, 0, 0, 2539, 0, 0, 3988, 2226, 7065, 0, 2788, 1885, 0, 2374,
+    5222, 3130, 3031, 2317, 0, 3654, 0, 0, 4499, 0, 0, 0, 2578, 0, 2884, 6594,
+    0, 0, 0, 2024, 4171, 2823, 226, 37, 0, 0, 7050, 310, 5096, 0, 0, 6256,
+    5414, 0, 6828, 0, 2678, 3442, 2671, 258, 0, 0, 2177, 0, 0, 196, 0, 0,
+    4728, 0, 0, 5333, 0, 0, 0, 5409, 0, 6096, 1904, 0, 0, 320, 5331, 5590,
+    4494, 3184, 4529, 5209, 6984, 2557, 5087, 0, 0, 6008, 0, 0, 2723, 0, 4732, 0,
+    4692, 215, 0, 0, 1925, 0, 4446, 2627, 2392, 0, 2768, 0, 99, 42, 0, 5371,
+    6047, 6509, 0, 2944, 2138, 2605, 3277, 2756, 0, 1952, 5204, 0, 5165, 0, 1746, 4877,
+    0, 188, 6616, 0, 0, 2996, 3026, 2556, 0, 5212, 2483, 4329, 0, 3228, 0, 1601,
+    0, 5396, 3287, 0, 3188, 0, 5136, 1606, 1974, 2308, 314, 3041, 2809, 5932, 0, 0,
+    0, 195, 0, 6681, 0, 0, 1988, 2306, 0, 2083, 0, 5705, 0, 0, 2262, 1687,
+    0, 0, 0, 4279, 0, 5166, 131, 0, 2696, 6231, 0, 4637, 0, 4314, 0, 2142,
+    1838, 0, 0, 4612, 0, 2534, 7030, 0, 0, 3827, 0, 0, 0, 0, 0, 0,
+    0, 0, 5496, 3207, 6075, 0, 0, 3789, 0, 2492, 0, 0, 0, 4723, 2270, 0,
+    234, 0, 0, 4135, 98, 2616, 0, 0, 208, 7009, 3263, 0, 0, 0, 0, 0,
+    3602, 0, 0, 0, 0, 0, 0, 0, 0, 6470, 251, 3429, 6194, 2469, 0, 6038,
+    0, 0, 0, 4109, 7112, 0, 0, 4445, 2985, 0, 2908, 0, 0, 0, 5199, 0,
+    0, 3638, 0, 2097, 0, 0, 2405, 0, 3625, 5966, 0, 3387, 17, 6904, 6582, 2027,
+    0, 0, 3143, 0, 4674, 2077, 0, 0, 2414, 0, 4059, 6471, 0, 2816, 0, 0,
+    2368, 5807, 3584, 0, 4094, 5993, 2990, 3233, 0, 0, 0, 1604, 0, 0, 0, 3198,
+    2076, 4594, 5759, 1714, 6590, 3337, 2710, 2018, 0, 0, 0, 0, 0, 6864, 0, 3318,
+    1640, 7061, 5988, 0, 0, 4932, 7342, 2802, 2989, 35, 5803, 6432, 3587, 194, 6215, 95,
+    0, 4669, 0, 0, 0, 238, 0, 3373, 0, 0, 5901, 178, 0, 3360, 0, 2991,
+    277, 322, 0, 5749, 2733, 2359, 6454, 0, 0, 6168, 2022, 0, 5187, 5528, 4597, 0,
+    5113, 0, 0, 0, 315, 0, 2067, 4434, 60, 4484, 4666, 0, 0, 3574, 2586, 0,
+    5890, 212, 202, 3213, 0, 0, 2791, 4888, 2448, 2162, 3176, 0, 0, 0, 0, 0,
+    0, 0, 0, 6301, 1661, 279, 1979, 2052, 5318, 5446, 228, 2902, 5581, 3106, 0, 4306,
+    0, 0, 3245, 276, 0, 232, 0, 3155, 3032, 0, 5067, 0, 2582, 3132, 0, 0,
+    193, 0, 0, 0, 3123, 2502, 0, 2652, 0, 0, 3024, 2901, 0, 237, 0, 0,
+    97, 3612, 0, 2517, 4327, 197, 7227, 3657, 0, 4746, 0, 5057, 0, 0, 0, 0,
+    0, 4240, 0, 0, 2765, 0, 3307, 0, 0, 0, 0, 0, 1937, 1605, 2903, 0,
+    3917, 5757, 153, 0, 3228, 5265, 3756, 0, 0, 0, 0, 0, 2569, 0, 2722, 2128,
+    0, 314, 2176, 0, 2832, 0, 0, 5530, 0, 2293, 0, 0, 3825, 3902, 4930, 0,
+    0, 0, 0, 5656, 5403, 0, 0, 0, 2670, 0, 0, 0, 0, 0, 6715, 6187,
+    0, 1830, 5568, 3347, 0, 0, 0, 278, 3063, 0, 0, 0, 3897, 0, 3230, 0,
+    0, 0, 0, 2442, 0, 0, 0, 223, 0, 0, 6963, 2825, 0, 1749, 0, 2491,
+    0, 0, 5563, 0, 4708, 0, 2553, 0, 4107, 0, 0, 0, 0, 0, 2964, 0,
+    4020, 5002, 0, 0, 3876, 0, 0, 0, 3260, 3276, 0, 4342, 1697, 120, 0, 0,
+    6358, 0, 0, 3951, 3385, 4147, 3768, 6023, 6764, 4360, 0, 3062, 0, 3650, 271, 3463,
+    0, 1633, 2664, 3692, 2785, 5043, 2111, 2044, 0, 4397, 0, 5536, 48, 2403, 2974, 4798,
+    0, 4436, 6359, 0, 0, 0, 0, 6442, 0, 0, 0, 3141, 80, 0, 0, 4659,
+    6109, 0, 0, 0, 0, 3196, 0, 2342, 5635, 0, 0, 2532, 6230, 0, 119, 0,
+    0, 0, 0, 0, 0, 0, 6742, 5978, 4545, 0, 0, 0, 0, 0, 2889, 0,
+    0, 0, 267, 38, 2669, 2593, 0, 4649, 0, 5016, 5634, 1623, 30, 0, 2453, 6285,
+    210, 3195, 0, 6885, 1684, 0, 0, 0, 238, 0, 6450, 189, 2072, 218, 7148, 0,
+    5816, 3512, 1846, 124, 5636, 0, 5821, 0, 0, 0, 0, 291, 1609, 1754, 0, 0,
+    4548, 5526, 5009, 1864, 0, 1905, 0, 5098, 0, 0, 0, 0, 0, 0, 0, 4502,
+    4177, 308, 0, 296, 2886, 1885, 5223, 0, 0, 3490, 3662, 313, 0, 0, 6889, 3174,
+    0, 0, 0, 3577, 0, 0, 6566, 0, 0, 3167, 0, 1964, 0, 0, 0, 0,
+    0, 2367, 1904, 5411, 2226, 0, 0, 3866, 276, 5372, 5548, 3305, 0, 1944, 0, 0,
+    0, 1982, 0, 3130, 2207, 4740, 5087, 0, 0, 0, 0, 266, 1906, 0, 2481, 2605,
+    248, 176, 0, 3915, 0, 226, 2397, 7046, 5371, 4207, 0, 255, 2632, 97, 111, 0,
+    2756, 0, 0, 6500, 0, 47, 0, 215, 0, 6393, 0, 290, 4726, 264, 0, 0,
+    3299, 4339, 0, 0, 0, 2216, 0, 3184, 1795, 3283, 5329, 2997, 0, 5216, 4493, 5718,
+    6655, 2809, 0, 5172, 0, 0, 275, 0, 0, 0, 0, 1839, 4041, 0, 0, 0,
+    0, 2627, 0, 4921, 0, 26, 222, 0, 2161, 286, 3054, 4840, 2309, 4283, 2944, 3191,
+    3277, 0, 0, 3839, 107, 5167, 0, 0, 1838, 0, 0, 0, 1780, 0, 5120, 4620,
+    0, 0, 2646, 0, 0, 0, 0, 2427, 4292, 2996, 0, 2976, 3330, 5501, 3217, 0,
+    0, 0, 2145, 268, 5141, 1840, 2699, 0, 2621, 0, 0, 2922, 0, 5491, 0, 0,
+    254, 146, 1986, 0, 0, 0, 0, 2304, 2492, 59, 0, 1602, 1687, 1808, 2260, 4967,
+    4234, 0, 2939, 3047, 0, 0, 0, 6231, 2536, 1677, 4994, 0, 0, 4119, 0, 0,
+    7025, 0, 3399, 0, 0, 2270, 2909, 0, 0, 2029, 2798, 3606, 0, 0, 0, 0,
+    7118, 2096, 0, 5306, 3628, 0, 6039, 4490, 17, 4720, 0, 0, 2878, 4909, 6479, 184,
+    4677, 2616, 0, 0, 0, 4063, 208, 0, 0, 0, 0, 0, 0, 0, 5923, 0,
+    0, 6473, 0, 2803, 0, 6186, 0, 2547, 3143, 6883, 2404, 0, 1714, 3205, 0, 2469,
+    0, 0, 6903, 6034, 2888, 6849, 4072, 2908, 0, 2086, 2160, 5325, 0, 0, 2667, 0,
+    2802, 2710, 5114, 2079, 0, 5996, 7351, 3581, 3341, 0, 6745, 1721, 2018, 2633, 4445, 0,
+    0, 2831, 0, 5806, 3318, 3363, 6221, 2368, 175, 2851, 0, 2281, 0, 2993, 2804, 4014,
+    0, 3088, 2456, 5476, 1609, 36, 0, 0, 5113, 5750, 4487, 4591, 74, 3575, 0, 2076,
+    0, 4307, 1632, 2637, 0, 0, 2989, 0, 5153, 0, 308, 5891, 202, 5188, 0, 2733,
+    6535, 160, 6749, 0, 0, 5115, 2691, 7274, 5471, 3586, 1879, 6426, 6310, 4668, 0, 1980,
+    2300, 0, 5900, 233, 246, 277, 1667, 0, 2545, 4306, 228, 1764, 3248, 2459, 3493, 282,
+    88, 4577, 0, 1967, 4596, 7447, 2638, 0, 2585, 0, 5311, 3127, 3103, 2205, 0, 287,
+    0, 0, 3021, 0, 1886, 4431, 191, 4308, 0, 3009, 2520, 2062, 0, 5011, 1793, 2711,
+    2094, 0, 6156, 1600, 0, 2942, 109, 0, 2502, 0, 0, 3007, 0, 47, 0, 3800,
+    2905, 4836, 3073, 0, 5445, 0, 72, 269, 3497, 0, 2679, 0, 273, 0, 3927, 0,
+    0, 0, 5076, 0, 0, 5802, 0, 0, 0, 0, 0, 0, 0, 3123, 0, 0,
+    0, 0, 2722, 0, 0, 0, 0, 2901, 2965, 6030, 3024, 4007, 0, 0, 1831, 0,
+    0, 0, 3612, 3166, 6719, 2294, 0, 4746, 2645, 0, 2286, 24, 0, 0, 4240, 0,
+    2589, 3230, 1830, 1631, 0, 0, 0, 5883, 3566, 0, 1931, 2008, 0, 2179, 2630, 159,
+    0, 0, 6728, 0, 5757, 0, 2673, 0, 2699, 0, 0, 1820, 5605, 1832, 0, 2790,
+    0, 2934, 2921, 0, 0, 2777, 2581, 0, 87, 145, 0, 0, 4930, 0, 0, 7225,
+    2919, 0, 5400, 185, 2854, 2491, 3874, 0, 3260, 0, 0, 3075, 0, 6387, 6187, 0,
+    2044, 5005, 0, 3347, 0, 179, 0, 217, 0, 3892, 285, 2523, 4351, 3467, 6141, 0,
+    3957, 5747, 0, 0, 2716, 0, 5562, 0, 5038, 0, 6024, 2787, 0, 6367, 3153, 4481,
+    3476, 0, 2045, 4705, 105, 0, 4428, 2877, 4662, 0, 0, 0, 0, 177, 0, 0,
+    0, 2546, 0, 0, 4020, 0, 2433, 0, 5874, 2006, 310, 0, 2351, 6361, 0, 3141,
+    6743, 4141, 236, 0, 0, 0, 2619, 0, 0, 0, 0, 0, 1633, 0, 0, 0,
+    4649, 265, 3165, 2661, 5316, 2968, 7157, 3690, 2846, 5826, 4795, 6763, 28, 161, 4873, 0,
+    4436, 2721, 5099, 0, 2594, 0, 6115, 0, 5981, 0, 5638, 0, 4650, 0, 175, 0,
+    2514, 289, 0, 6234, 0, 3195, 0, 0, 0, 6912, 2342, 7272, 5427, 3086, 0, 2529,
+    0, 73, 0, 0, 4542, 1855, 0, 0, 0, 5098, 0, 0, 0, 65, 0, 0,
+    3018, 3867, 0, 5088, 0, 3491, 0, 5015, 4219, 1754, 5634, 3255, 0, 2689, 5100, 5422,
+    4903, 0, 0, 6897, 5553, 0, 1682, 0, 0, 1965, 0, 0, 304, 3511, 2291, 5814,
+    0, 0, 0, 0, 5551, 1944, 282, 5380, 3866, 4500, 6600, 0, 0, 321, 0, 3595,
+    0, 0, 0, 0, 287, 1908, 183, 0, 0, 2880, 0, 4261, 3868, 4547, 2371, 0,
+    4460, 0, 5591, 253, 3766, 0, 2610, 2962, 0, 2823, 0, 0, 4605, 270, 0, 0,
+    0, 0, 0, 5977, 4702, 0, 0, 0, 2481, 3299, 0, 5410, 2567, 0, 2216, 1904,
+    0, 0, 0, 1805, 2624, 0, 5616, 0, 3309, 0, 5327, 0, 2810, 0, 0, 0,
+    0, 0, 0, 0, 0, 2836, 0, 4736, 0, 0, 0, 222, 0, 0, 0, 0,
+    3999, 2779, 307, 0, 5739, 5371, 0, 2628, 26, 2605, 252, 3843, 6021, 3098, 2503, 2756,
+    0, 0, 0, 0, 0, 6393, 0, 255, 2589, 1621, 0, 0, 2007, 0, 3549, 0,
+    2526, 2235, 4301, 0, 2164, 5848, 3852, 3217, 3615, 4333, 3194, 0, 199, 157, 1842, 2809,
+    2579, 0, 4243, 1819, 0, 5127, 0, 5493, 4534, 0, 0, 3125, 0, 5716, 2874, 0,
+    2152, 85, 0, 4921, 2265, 7044, 1706, 0, 0, 4280, 0, 0, 194, 2255, 0, 134,
+    0, 2752, 4867, 0, 1838, 3794, 4237, 2591, 2617, 3412, 4616, 3330, 0, 3403, 0, 204,
+    4970, 2029, 6092, 0, 6813, 7016, 0, 0, 3000, 0, 22, 1614, 3096, 3221, 53, 4989,
+    0, 0, 0, 2878, 0, 4247, 0, 6006, 3350, 0, 2030, 2019, 4426, 254, 0, 0,
+    0, 0, 0, 203, 0, 0, 0, 6908, 0, 0, 0, 3319, 6798, 4945, 0, 0,
+    0, 4113, 0, 0, 0, 0, 2406, 0, 0, 0, 4081, 0, 2536, 0, 0, 0,
+    0, 0, 0, 0, 0, 5195, 0, 5325, 0, 3163, 6190, 4023, 6032, 17, 0, 0,
+    0, 2087, 1723, 3205, 0, 3626, 0, 0, 0, 0, 4906, 3029, 4675, 0, 0, 0,
+    4060, 0, 0, 0, 2806, 0, 0, 5921, 2705, 4017, 2644, 6472, 36, 5479, 3142, 171,
+    6772, 0, 0, 0, 5158, 0, 0, 0, 4901, 3557, 0, 0, 0, 193, 1714, 3034,
+    143, 1898, 3187, 3286, 4027, 0, 5156, 3022, 6757, 2912, 5989, 1765, 1883, 2802, 5116, 0,
+    3712, 1970, 7346, 6847, 3591, 3787, 0, 5086, 0, 5538, 0, 7284, 233, 1636, 2300, 2078,
+    0, 5904, 0, 6171, 164, 0, 2992, 2244, 0, 5365, 7311, 1887, 3087, 3134, 2691, 5108,
+    2640, 6460, 5314, 4601, 0, 4485, 0, 3361, 1764, 2666, 2141, 0, 256, 0, 0, 4310,
+    91, 0, 0, 0, 4429, 0, 3520, 0, 7291, 202, 0, 3241, 3821, 0, 3120, 2449,
+    0, 4556, 0, 2942, 228, 5471, 1766, 2681, 234, 6305, 0, 191, 2755, 2820, 3207, 0,
+    3175, 0, 0, 0, 174, 0, 4306, 0, 0, 6176, 1601, 273, 0, 0, 0, 0,
+    0, 4575, 0, 5287, 3505, 0, 4088, 0, 3124, 2562, 0, 0, 1957, 4225, 0, 3271,
+    2414, 0, 0, 4011, 0, 0, 0, 2518, 0, 198, 0, 2289, 3613, 2094, 0, 2965,
+    3097, 3566, 5277, 0, 3381, 0, 3111, 4241, 24, 0, 2904, 2945, 3800, 2075, 252, 0,
+    0, 0, 4050, 0, 2524, 0, 71, 0, 3921, 2960, 0, 5883, 224, 2608, 6737, 0,
+    0, 0, 1834, 0, 0, 3194, 0, 0, 0, 6396, 3168, 2934, 0, 3336, 0, 2747,
+    6102, 0, 0, 297, 6811, 0, 0, 0, 0, 0, 2854, 0, 0, 96, 0, 1700,
+    4370, 0, 0, 35, 1689, 6716, 131, 0, 6390, 3261, 0, 0, 0, 3348, 1830, 0,
+    0, 312, 6136, 6266, 272, 6701, 7257, 0, 2443, 179, 262, 0, 3883, 5854, 0, 5747,
+    0, 251, 0, 2985, 6400, 0, 0, 0, 0, 0, 3485, 1811, 0, 2877, 0, 3333,
+    4428, 2047, 0, 0, 0, 0, 2017, 0, 7222, 0, 3317, 0, 0, 3655, 4021, 0,
+    0, 6686, 3260, 0, 2351, 0, 6267, 2857, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3464, 0, 2900, 0, 2872, 2044, 2434, 0, 240, 0, 5316, 0, 5263, 0,
+    3748, 6768, 2471, 0, 4802, 2781, 3059, 2846, 5971, 2338, 5036, 3316, 2038, 102, 3449, 2660,
+    0, 0, 4660, 0, 1943, 20, 0, 4652, 0, 0, 4150, 0, 5872, 0, 5837, 0,
+    0, 239, 5430, 6109, 6360, 2343, 0, 0, 148, 0, 0, 0, 5786, 0, 5143, 0,
+    0, 0, 309, 0, 5101, 2897, 3434, 68, 3020, 0, 2737, 0, 304, 7307, 0, 4649,
+    7152, 319, 3284, 4223, 1961, 3185, 0, 5826, 4871, 1747, 0, 0, 0, 0, 0, 6632,
+    0, 0, 3516, 0, 0, 0, 5382, 2291, 0, 0, 5592, 4682, 5637, 0, 2229, 0,
+    2689, 4262, 2139, 0, 2382, 232, 5229, 0, 0, 0, 3030, 4915, 0, 4552, 5554, 0,
+    0, 1753, 0, 0, 3870, 0, 0, 0, 0, 315, 4462, 0, 2549, 0, 0, 5591,
+    2775, 0, 0, 0, 6893, 5422, 0, 2189, 0, 0, 0, 0, 0, 4702, 0, 1717,
+    3866, 0, 5593, 0, 0, 0, 0, 5340, 0, 0, 0, 3305, 0, 234, 0, 2955,
+    1944, 2601, 5473, 5549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1602, 2839, 0,
+    0, 2504, 0, 2726, 1907, 0, 2413, 4003, 0, 2624, 0, 0, 3313, 0, 2958, 2779,
+    253, 0, 3299, 2606, 0, 3065, 2567, 4783, 0, 2658, 0, 2480, 0, 0, 6394, 0,
+    0, 0, 2073, 4042, 0, 0, 3549, 4754, 0, 0, 2216, 0, 0, 2526, 0, 0,
+    1799, 5848, 4978, 2987, 0, 3861, 3228, 0, 0, 5775, 0, 0, 0, 5721, 2315, 0,
+    0, 3803, 0, 4534, 0, 0, 314, 3326, 0, 0, 0, 0, 6699, 122, 222, 6067,
+    0, 0, 0, 1607, 7091, 2257, 0, 26, 3840, 2628, 6245, 4938, 4278, 0, 3797, 311,
+    0, 0, 0, 6823, 0, 209, 3331, 0, 6202, 0, 0, 7076, 0, 0, 0, 4296,
+    0, 2428, 271, 0, 1710, 1614, 2813, 4255, 0, 6087, 5526, 1841, 56, 3807, 5492, 2493,
+    204, 3421, 4734, 0, 0, 2032, 2870, 4426, 0, 0, 2407, 0, 62, 0, 0, 2983,
+    283, 13, 7041, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4235, 0, 155, 3447,
+    6498, 0, 0, 3565, 6203, 0, 0, 6045, 0, 0, 5882, 3400, 2899, 2029, 0, 0,
+    0, 0, 5370, 0, 5545, 0, 18, 0, 0, 4987, 2408, 1648, 0, 4952, 5214, 83,
+    1941, 4447, 2617, 0, 266, 0, 6647, 0, 3144, 0, 231, 176, 0, 0, 3095, 0,
+    5926, 0, 0, 0, 2708, 261, 4058, 1874, 0, 5696, 0, 0, 171, 0, 0, 4886,
+    0, 4945, 0, 0, 0, 4076, 6001, 0, 0, 5691, 0, 0, 4614, 0, 1901, 4035,
+    0, 5325, 1774, 309, 0, 1888, 1649, 0, 0, 2677, 3791, 5159, 1722, 6853, 4911, 0,
+    0, 2895, 5052, 7323, 206, 0, 238, 2682, 0, 0, 0, 0, 0, 0, 4812, 0,
+    2350, 1887, 0, 2805, 5367, 3054, 3187, 286, 0, 0, 3830, 0, 5477, 4015, 0, 5531,
+    3161, 3036, 2424, 6112, 0, 3138, 0, 0, 0, 0, 0, 0, 0, 1768, 2150, 5539,
+    2141, 0, 1889, 0, 0, 0, 5110, 0, 1880, 5472, 6753, 259, 2622, 7278, 230, 2681,
+    2666, 303, 0, 0, 0, 0, 2755, 0, 233, 5424, 0, 3241, 6296, 2300, 1808, 5461,
+    0, 2462, 4966, 288, 1764, 2244, 0, 0, 0, 276, 4581, 219, 281, 3044, 5312, 5293,
+    2564, 0, 0, 2639, 3777, 0, 3134, 0, 0, 4091, 0, 4309, 0, 3390, 0, 4051,
+    0, 3601, 0, 0, 0, 198, 7287, 4976, 0, 285, 3254, 0, 2656, 4226, 4748, 0,
+    0, 184, 3052, 2942, 3801, 0, 4894, 0, 2758, 0, 4050, 0, 0, 3501, 0, 0,
+    0, 0, 0, 4413, 2524, 5296, 117, 0, 2773, 0, 2801, 0, 0, 0, 5760, 0,
+    3113, 0, 2948, 0, 0, 0, 0, 1947, 0, 0, 6030, 4052, 0, 2747, 0, 0,
+    4008, 190, 144, 267, 0, 2084, 131, 2287, 0, 0, 0, 2667, 2184, 2611, 0, 24,
+    3336, 4923, 4372, 6714, 2963, 0, 0, 213, 2534, 0, 23, 0, 3930, 6106, 0, 3566,
+    2845, 6732, 0, 6711, 2441, 5883, 6408, 297, 318, 0, 1693, 0, 2979, 0, 2701, 0,
+    2798, 0, 0, 1833, 0, 0, 0, 6275, 0, 0, 2636, 0, 0, 0, 0, 2934,
+    3273, 59, 5150, 1895, 7229, 1812, 0, 1700, 2854, 0, 2103, 3659, 0, 0, 0, 1603,
+    0, 0, 179, 0, 5847, 6269, 6388, 0, 0, 3548, 0, 4193, 0, 2545, 0, 0,
+    2860, 2538, 7252, 0, 0, 3253, 245, 3668, 0, 5536, 5361, 5747, 2717, 3462, 2130, 7377,
+    101, 0, 5308, 2046, 2402, 2041, 0, 0, 3480, 1962, 0, 3733, 4428, 2475, 1600, 266,
+    3316, 240, 0, 176, 284, 3459, 5877, 4152, 2338, 0, 0, 183, 2875, 3074, 0, 0,
+    0, 5647, 0, 2351, 41, 0, 5827, 0, 0, 0, 0, 4456, 0, 6239, 5789, 0,
+    6116, 2891, 72, 0, 2740, 0, 0, 5642, 5316, 2178, 4263, 2846, 1613, 0, 2672, 149,
+    0, 1751, 5144, 6004, 0, 0, 6331, 1829, 0, 4763, 3109, 0, 0, 2384, 0, 2558,
+    0, 0, 2831, 4651, 0, 0, 0, 0, 2283, 286, 6940, 5836, 3053, 4262, 0, 3185,
+    1609, 0, 0, 4513, 0, 1755, 3019, 0, 0, 307, 0, 170, 0, 5428, 0, 0,
+    0, 5229, 3117, 0, 5423, 159, 66, 216, 313, 4349, 308, 5235, 0, 4264, 0, 4220,
+    274, 0, 0, 2139, 0, 304, 0, 0, 0, 6626, 0, 5340, 4947, 0, 0, 0,
+    87, 2291, 2550, 2357, 5595, 4343, 0, 0, 0, 5381, 1808, 2229, 187, 2767, 3547, 2505,
+    0, 0, 0, 2932, 0, 0, 0, 2272, 2209, 3042, 2504, 1993, 2713, 0, 2729, 2482,
+    0, 3869, 0, 2955, 4043, 2601, 99, 2771, 5591, 0, 6232, 4461, 0, 3013, 0, 2246,
+    0, 6351, 0, 0, 184, 0, 0, 0, 47, 2506, 4702, 3153, 293, 0, 4879, 113,
+    0, 5672, 0, 0, 4042, 0, 1612, 0, 2006, 7134, 0, 0, 76, 3228, 0, 0,
+    0, 0, 3315, 0, 0, 0, 5819, 2315, 169, 200, 4757, 2837, 0, 0, 0, 158,
+    1608, 2613, 4044, 0, 0, 0, 4000, 6021, 0, 144, 1853, 0, 2958, 0, 2606, 265,
+    2658, 4783, 2321, 6891, 5967, 0, 7093, 2646, 3838, 2494, 3326, 5097, 29, 86, 0, 1847,
+    0, 0, 3549, 0, 6071, 0, 0, 0, 2526, 0, 0, 2844, 5848, 4941, 0, 3856,
+    4287, 3815, 3232, 5415, 2472, 3151, 2493, 0, 0, 4534, 209, 0, 3139, 0, 2426, 6211,
+    0, 0, 0, 2634, 5775, 0, 146, 2925, 0, 5141, 2734, 7048, 0, 2796, 2699, 3018,
+    2495, 6245, 0, 0, 4893, 1875, 7035, 0, 2591, 3077, 6502, 143, 3795, 0, 6205, 2416,
+    2545, 2256, 6817, 3251, 0, 0, 0, 7071, 0, 0, 249, 1703, 3398, 5545, 0, 13,
+    155, 7183, 0, 4251, 1614, 4491, 0, 3569, 6007, 5306, 6520, 0, 3416, 3084, 229, 4731,
+    4688, 6051, 2031, 2870, 5886, 0, 4426, 3144, 54, 0, 0, 0, 3203, 0, 0, 0,
+    1657, 1600, 2512, 0, 6505, 2937, 83, 5699, 3145, 0, 2547, 0, 2406, 0, 0, 6938,
+    0, 0, 0, 3089, 1777, 0, 72, 1651, 4441, 4067, 0, 0, 2163, 0, 0, 0,
+    0, 0, 18, 3308, 4447, 0, 3831, 0, 0, 3172, 0, 6011, 0, 7415, 238, 0,
+    5126, 0, 205, 0, 0, 0, 0, 0, 3996, 175, 4951, 0, 3242, 0, 0, 5702,
+    0, 2706, 0, 171, 2281, 3830, 0, 0, 5534, 5121, 3121, 3178, 0, 0, 0, 3090,
+    74, 4611, 1621, 157, 0, 0, 0, 0, 2234, 2354, 4031, 1899, 1891, 0, 7014, 2623,
+    5152, 2600, 3832, 1878, 2952, 85, 3788, 3177, 0, 0, 2692, 0, 3161, 3131, 5691, 0,
+    0, 0, 0, 0, 1991, 3035, 0, 3391, 2245, 3285, 0, 301, 0, 294, 2849, 7008,
+    0, 0, 276, 5366, 182, 7317, 1887, 259, 0, 71, 0, 2746, 0, 3135, 0, 0,
+    0, 287, 0, 0, 0, 0, 3390, 0, 4966, 4272, 1767, 3293, 2231, 5310, 7297, 6076,
+    0, 1915, 2140, 0, 97, 6188, 0, 0, 3152, 2681, 3778, 0, 0, 0, 0, 0,
+    0, 2755, 3392, 2711, 5994, 2501, 0, 3096, 0, 0, 3016, 0, 3220, 1610, 5460, 0,
+    3043, 3973, 2006, 3257, 0, 0, 0, 2218, 0, 0, 0, 3315, 0, 0, 2191, 2761,
+    0, 2612, 4054, 2563, 0, 4089, 0, 0, 0, 0, 5804, 2864, 0, 0, 0, 3206,
+    3163, 0, 0, 0, 0, 2656, 2186, 198, 0, 0, 4748, 132, 0, 0, 6751, 0,
+    3051, 4894, 2776, 2008, 4006, 1634, 2589, 0, 2655, 0, 0, 0, 3932, 181, 4407, 4050,
+    2979, 162, 2524, 3697, 2194, 3197, 0, 4926, 0, 6723, 0, 0, 2792, 0, 4786, 5760,
+    1823, 0, 0, 0, 0, 2747, 172, 3033, 0, 4125, 5150, 2583, 0, 0, 0, 0,
+    3018, 89, 1763, 7219, 0, 1701, 5013, 2084, 2732, 131, 4371, 2490, 2534, 0, 0, 3075,
+    3682, 0, 0, 0, 59, 4878, 0, 2928, 2339, 3499, 7263, 6705, 2106, 0, 3677, 0,
+    0, 7238, 2051, 0, 3212, 0, 3471, 136, 6404, 0, 6137, 5308, 0, 2715, 3552, 2125,
+    0, 0, 0, 0, 0, 5536, 2541, 0, 0, 0, 5851, 0, 3029, 245, 6248, 0,
+    5222, 0, 0, 0, 0, 3656, 0, 0, 0, 0, 1742, 5650, 4537, 0, 0, 6242,
+    0, 3140, 6268, 0, 1679, 0, 0, 0, 0, 2891, 0, 0, 0, 4187, 0, 0,
+    5972, 2181, 0, 2675, 5811, 44, 128, 258, 1756, 0, 6252, 3306, 0, 0, 0, 3731,
+    0, 0, 6950, 0, 0, 1953, 5333, 0, 2039, 0, 0, 5256, 2831, 0, 0, 3453,
+    0, 2283, 0, 0, 3240, 5840, 0, 4151, 0, 2721, 0, 1617, 1609, 5653, 1755, 6977,
+    3085, 220, 4450, 0, 0, 168, 5787, 5091, 0, 0, 3119, 0, 0, 0, 0, 0,
+    221, 0, 4353, 4266, 157, 2225, 308, 3881, 0, 2602, 3239, 4877, 6957, 1757, 1748, 5642,
+    2738, 2483, 0, 4218, 0, 5236, 3078, 0, 0, 5560, 0, 3118, 0, 0, 0, 6638,
+    3010, 2308, 0, 85, 2169, 2230, 0, 0, 0, 1688, 4262, 3875, 2383, 1607, 3173, 0,
+    195, 0, 0, 2003, 2209, 4511, 0, 0, 0, 0, 4208, 2482, 0, 4356, 0, 0,
+    113, 6680, 0, 2767, 315, 0, 0, 2826, 6236, 0, 0, 3218, 0, 4317, 312, 262,
+    2508, 0, 0, 3096, 0, 0, 5979, 0, 3327, 4630, 5340, 0, 0, 47, 0, 2484,
+    5594, 0, 6079, 0, 0, 0, 0, 0, 0, 0, 2856, 0, 3646, 5819, 0, 4343,
+    0, 1857, 0, 0, 0, 0, 0, 0, 3263, 2727, 2867, 0, 0, 4046, 2504, 235,
+    99, 96, 2470, 3998, 2323, 2969, 0, 0, 4784, 3695, 29, 0, 5765, 0, 6038, 2771,
+    0, 257, 2646, 0, 0, 0, 0, 0, 214, 3428, 0, 0, 4879, 0, 231, 0,
+    0, 0, 14, 0, 4042, 0, 0, 7128, 272, 6923, 0, 2528, 3633, 5415, 5776, 4751,
+    3847, 2315, 2374, 6577, 1860, 2699, 3988, 261, 0, 0, 0, 314, 3031, 0, 0, 0,
+    4097, 0, 5141, 0, 146, 2994, 2497, 3235, 0, 37, 1847, 0, 6888, 0, 7038, 0,
+    2337, 7092, 3077, 0, 6562, 1715, 1744, 4711, 0, 0, 6246, 1875, 0, 3618, 0, 0,
+    0, 2493, 0, 7082, 4673, 4935, 0, 0, 0, 5590, 7057, 0, 6088, 5911, 0, 0,
+    2417, 6529, 5306, 4491, 0, 0, 3811, 0, 0, 4738, 4896, 2336, 2881, 0, 0, 3368,
+    3407, 2021, 3322, 3150, 0, 0, 0, 0, 0, 0, 5187, 0, 0, 0, 0, 0,
+    5986, 2750, 6826, 0, 230, 2547, 6045, 3147, 6499, 6204, 0, 0, 0, 0, 0, 0,
+    2688, 0, 0, 0, 0, 0, 0, 0, 2978, 2166, 3353, 5545, 5328, 0, 0, 0,
+    2409, 6973, 5207, 0, 0, 0, 6153, 4448, 5318, 1951, 3144, 2906, 0, 6504, 1971, 5129,
+    0, 0, 4686, 3308, 175, 0, 3996, 3201, 0, 0, 2281, 3065, 5697, 0, 0, 0,
+    3249, 0, 5508, 0, 316, 0, 0, 2693, 0, 5165, 0, 74, 0, 4618, 2943, 0,
+    5692, 0, 0, 0, 2765, 0, 3023, 192, 0, 1775, 3834, 7018, 0, 0, 1650, 2954,
+    0, 1605, 0, 5131, 0, 260, 1972, 2692, 4249, 3287, 238, 0, 0, 3786, 0, 0,
+    0, 0, 122, 0, 0, 2303, 0, 0, 0, 282, 0, 0, 227, 0, 6066, 2694,
+    2293, 0, 2953, 3131, 0, 180, 0, 3830, 5701, 2142, 0, 0, 4626, 5532, 287, 0,
+    0, 4719, 6194, 2890, 4275, 7021, 3824, 3905, 1890, 262, 2424, 6192, 312, 182, 0, 0,
+    3177, 0, 0, 0, 0, 3293, 0, 0, 3063, 234, 0, 0, 3394, 0, 2405, 2479,
+    0, 0, 5464, 0, 0, 0, 223, 283, 0, 276, 7008, 2829, 0, 0, 0, 0,
+    2855, 0, 0, 3602, 5804, 0, 0, 0, 0, 1603, 3114, 0, 0, 0, 0, 0,
+    0, 0, 0, 3390, 2866, 0, 0, 2468, 4029, 2414, 4346, 0, 0, 120, 5196, 0,
+    97, 3631, 0, 6023, 6575, 0, 4749, 0, 0, 5756, 0, 3384, 0, 311, 1640, 5231,
+    3580, 95, 0, 1638, 3707, 2008, 0, 5895, 4419, 6783, 2865, 2198, 0, 1941, 4810, 2114,
+    2359, 2990, 0, 12, 0, 5761, 2792, 0, 0, 2208, 0, 1826, 0, 6437, 3967, 0,
+    0, 2732, 2889, 0, 4053, 181, 0, 3337, 4933, 93, 0, 0, 2583, 3295, 4590, 6110,
+    60, 0, 0, 0, 0, 6748, 0, 3075, 35, 0, 0, 11, 112, 3931, 5030, 6422,
+    0, 0, 250, 3366, 0, 2593, 0, 6294, 0, 0, 0, 0, 7246, 0, 5025, 4658,
+    5581, 5818, 0, 2979, 0, 5862, 3211, 2680, 5528, 4881, 0, 0, 0, 0, 2458, 0,
+    1850, 3654, 0, 0, 0, 0, 4430, 2058, 0, 0, 0, 0, 0, 186, 0, 0,
+    0, 59, 216, 5010, 0, 3531, 136, 0, 0, 2150, 0, 0, 0, 0, 0, 7217,
+    0, 0, 0, 4199, 4869, 0, 5225, 0, 3496, 0, 2902, 3672, 2051, 0, 0, 225,
+    0, 5258, 6260, 5414, 63, 187, 3170, 5536, 0, 3737, 2123, 0, 0, 5308, 0, 0,
+    0, 0, 1945, 0, 0, 2569, 0, 0, 2832, 0, 3272, 0, 0, 2721, 3306, 0,
+    0, 0, 0, 0, 5648, 3064, 2207, 6989, 0, 6240, 0, 3052, 0, 0, 0, 0,
+    0, 2757, 0, 0, 0, 0, 1927, 3128, 0, 220, 0, 2891, 111, 0, 0, 0,
+    3885, 1759, 264, 309, 6048, 42, 5643, 1952, 6402, 0, 5093, 6513, 0, 0, 6944, 2768,
+    0, 1746, 2831, 0, 0, 0, 5560, 0, 121, 2822, 0, 0, 0, 0, 303, 2611,
+    5652, 5397, 2283, 0, 3239, 4922, 0, 188, 0, 1608, 0, 1755, 213, 5933, 0, 4517,
+    2312, 0, 5566, 281, 0, 0, 3010, 0, 6683, 0, 3768, 0, 2834, 0, 4350, 4265,
+    2170, 313, 308, 318, 0, 3647, 1688, 0, 6953, 0, 3888, 0, 4642, 0, 0, 1783,
+    48, 0, 0, 2486, 0, 4209, 0, 5123, 4704, 0, 0, 2976, 0, 4344, 0, 0,
+    2102, 2403, 3875, 3646, 283, 0, 0, 0, 5497, 0, 0, 0, 0, 0, 0, 0,
+    1997, 2209, 0, 0, 4137, 2112, 0, 6358, 0, 0, 2482, 2537, 0, 3648, 2973, 7011,
+    1677, 2782, 2856, 2713, 6233, 0, 3098, 0, 34, 4355, 3431, 0, 252, 0, 1623, 0,
+    6435, 2507, 0, 47, 2470, 0, 302, 0, 4761, 0, 0, 0, 0, 280, 229, 0,
+    7140, 5765, 0, 0, 0, 3643, 2099, 4490, 5635, 5819, 3194, 6042, 189, 0, 214, 2528,
+    1854, 2930, 2375, 0, 51, 4045, 0, 4541, 0, 6587, 2322, 0, 0, 0, 0, 0,
+    1885, 267, 0, 29, 0, 0, 2669, 6895, 3989, 1744, 2807, 0, 3109, 1719, 2086, 2646,
+    5993, 0, 0, 7065, 1848, 2888, 0, 0, 0, 0, 4981, 6882, 6869, 5415, 6594, 0,
+    6918, 0, 0, 0, 0, 5526, 0, 5913, 1728, 2699, 5803, 3238, 0, 4714, 0, 2678,
+    0, 1859, 0, 0, 146, 0, 3378, 2885, 3117, 6828, 2024, 2149, 0, 0, 0, 0,
+    0, 0, 322, 3275, 0, 0, 0, 2622, 1905, 1875, 7036, 0, 0, 3077, 2496, 2336,
+    5087, 0, 0, 2642, 0, 0, 0, 0, 215, 0, 2998, 5190, 0, 0, 0, 4666,
+    5890, 0, 5372, 0, 3574, 5209, 6560, 3282, 3183, 2791, 219, 6524, 5306, 6052, 2842, 0,
+    1979, 2582, 279, 4491, 0, 3107, 4692, 5957, 0, 266, 0, 4041, 0, 2556, 0, 0,
+    2054, 176, 3288, 0, 3189, 2205, 0, 0, 0, 0, 0, 0, 0, 6509, 0, 4207,
+    263, 4571, 5165, 0, 0, 0, 293, 3146, 196, 0, 170, 0, 0, 3026, 0, 0,
+    3249, 0, 5662, 0, 0, 0, 3052, 3188, 3007, 5328, 320, 0, 109, 197, 4329, 4285,
+    3809, 1974, 0, 2143, 5171, 2943, 7421, 0, 1839, 0, 3054, 4832, 0, 298, 3040, 0,
+    3996, 0, 0, 5705, 2347, 5506, 286, 2281, 2696, 0, 4279, 0, 175, 260, 0, 2611,
+    2766, 3091, 213, 2492, 3827, 2142, 0, 74, 0, 0, 3045, 1808, 2270, 0, 6066, 0,
+    0, 0, 2519, 2297, 2844, 0, 7015, 3833, 318, 180, 3603, 3231, 5496, 4246, 2692, 2953,
+    234, 0, 3567, 0, 2144, 0, 3151, 6195, 0, 0, 2366, 0, 4665, 278, 0, 0,
+    0, 282, 0, 0, 2790, 7009, 0, 0, 0, 5608, 0, 2093, 2303, 3602, 0, 0,
+    169, 2935, 2535, 0, 3046, 6470, 0, 0, 0, 0, 4109, 249, 4273, 0, 287, 0,
+    0, 7020, 0, 2919, 3251, 299, 3878, 156, 0, 2855, 2711, 2097, 3604, 6189, 1697, 4065,
+    5994, 0, 292, 3387, 0, 4364, 3338, 0, 3393, 4719, 4814, 2468, 184, 2077, 5756, 2710,
+    0, 3219, 4059, 0, 0, 6477, 3979, 0, 3318, 1641, 6027, 5048, 84, 0, 4481, 2990,
+    0, 0, 0, 4817, 0, 5804, 0, 0, 6447, 3088, 4437, 3337, 0, 0, 0, 2865,
+    0, 2160, 2803, 144, 2360, 0, 4026, 2433, 6033, 0, 0, 0, 2667, 3139, 0, 2733,
+    3108, 3339, 35, 3580, 6755, 7342, 119, 5978, 1635, 5114, 0, 5864, 2589, 0, 0, 6742,
+    6298, 2008, 6121, 0, 2971, 11, 0, 115, 163, 2847, 3701, 32, 6778, 5895, 0, 0,
+    0, 5528, 6454, 3238, 2792, 0, 1824, 1604, 3084, 6316, 2597, 0, 0, 2453, 0, 250,
+    2637, 2514, 2583, 0, 244, 3117, 90, 3176, 5822, 4307, 3273, 7289, 3256, 0, 0, 3162,
+    2732, 3075, 3503, 6301, 221, 1868, 0, 5009, 0, 2600, 0, 0, 0, 2545, 0, 6420,
+    0, 0, 2502, 2902, 2052, 5020, 0, 3073, 140, 7242, 3663, 0, 2811, 0, 3490, 0,
+    1964, 0, 0, 2735, 5553, 3172, 0, 5067, 0, 3526, 0, 0, 0, 0, 0, 0,
+    4430, 0, 2057, 2226, 0, 2722, 1949, 0, 1600, 0, 0, 0, 0, 0, 63, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3917, 0, 2883, 293, 0, 0,
+    4467, 0, 0, 226, 0, 0, 1610, 72, 5627, 309, 0, 0, 270, 0, 6256, 0,
+    0, 5977, 0, 2217, 0, 2177, 2671, 1831, 0, 6721, 0, 0, 0, 0, 2757, 0,
+    0, 0, 0, 5656, 5330, 0, 3129, 0, 0, 2721, 301, 2864, 3283, 0, 0, 294,
+    4494, 0, 6715, 0, 5568, 6983, 0, 0, 0, 0, 0, 2491, 0, 0, 0, 0,
+    1925, 0, 0, 0, 0, 2822, 0, 0, 4922, 5003, 2724, 159, 2627, 1758, 1631, 3882,
+    0, 3550, 3277, 3229, 0, 6399, 0, 2138, 3769, 2944, 0, 0, 6963, 4656, 3151, 0,
+    0, 5396, 2834, 0, 3469, 5560, 2357, 0, 3876, 0, 199, 0, 0, 87, 5002, 0,
+    5503, 0, 0, 0, 0, 5135, 0, 0, 4535, 3041, 6358, 0, 2922, 0, 299, 0,
+    2996, 0, 4360, 249, 6681, 0, 1687, 236, 2102, 3887, 2261, 3650, 3209, 3463, 134, 2786,
+    0, 2485, 2665, 3153, 0, 4867, 6231, 0, 4636, 5979, 0, 6365, 0, 4704, 0, 0,
+    2537, 0, 4765, 0, 0, 7029, 0, 0, 3646, 0, 1615, 2533, 0, 0, 2966, 4999,
+    2006, 0, 25, 5635, 0, 4135, 3315, 0, 124, 1624, 0, 3195, 4768, 4722, 0, 0,
+    208, 3086, 0, 0, 2743, 2616, 0, 0, 0, 0, 0, 267, 0, 6801, 0, 0,
+    265, 3098, 2669, 0, 30, 0, 252, 2974, 258, 51, 7148, 3429, 4949, 2469, 1754, 0,
+    5099, 0, 0, 0, 0, 0, 0, 0, 6036, 6885, 2908, 0, 6929, 0, 0, 5198,
+    0, 2528, 3637, 0, 5997, 0, 2089, 6904, 3194, 5526, 0, 0, 3174, 4445, 1737, 6581,
+    0, 0, 3583, 4541, 0, 0, 0, 2368, 1905, 0, 0, 0, 3275, 0, 0, 1864,
+    3867, 0, 0, 5807, 5158, 192, 0, 1744, 0, 1716, 0, 2952, 3018, 6566, 3038, 0,
+    3577, 201, 4593, 2076, 0, 0, 0, 210, 0, 2481, 0, 0, 0, 0, 5893, 6863,
+    7061, 5372, 5548, 5912, 0, 0, 0, 291, 0, 5538, 2703, 195, 3587, 0, 0, 1982,
+    3372, 4669, 0, 266, 0, 2022, 0, 0, 6590, 0, 176, 5901, 0, 0, 277, 3323,
+    0, 2886, 0, 4207, 0, 0, 1896, 3766, 6827, 0, 5728, 4597, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2066, 4433, 2586, 0, 0, 0, 0, 3009, 0, 168,
+    4289, 1795, 5329, 0, 0, 0, 0, 5449, 0, 2820, 5172, 0, 0, 2215, 3845, 0,
+    0, 3309, 1839, 0, 4840, 0, 0, 0, 3263, 3106, 0, 196, 0, 0, 0, 2162,
+    0, 0, 286, 2864, 4225, 3008, 3245, 3054, 3839, 0, 0, 5106, 0, 0, 0, 0,
+    2152, 3123, 0, 0, 0, 0, 5511, 0, 0, 290, 0, 3191, 0, 1621, 3024, 0,
+    0, 3188, 4968, 4292, 3612, 3287, 2766, 4253, 4746, 157, 0, 3000, 1973, 3571, 3806, 2235,
+    4327, 4086, 0, 4240, 2304, 224, 0, 0, 0, 275, 2145, 2366, 2075, 3405, 1808, 5272,
+    3231, 2260, 85, 0, 4967, 2695, 0, 0, 2939, 0, 4279, 0, 0, 1706, 3047, 2748,
+    4710, 107, 0, 0, 0, 2921, 0, 4069, 7025, 5757, 3825, 0, 4930, 3399, 0, 3606,
+    0, 2093, 3261, 0, 3207, 0, 4377, 0, 0, 0, 3221, 6479, 0, 6187, 0, 0,
+    234, 5748, 184, 4720, 2535, 0, 3205, 3347, 257, 0, 0, 0, 3896, 0, 1811, 2920,
+    0, 6470, 0, 0, 4707, 0, 0, 3602, 0, 6143, 0, 2803, 0, 0, 0, 0,
+    4826, 0, 5186, 3557, 2274, 0, 0, 4107, 0, 4072, 0, 0, 0, 0, 4033, 2414,
+    0, 6745, 5114, 2912, 0, 3385, 6689, 2667, 0, 258, 6130, 2160, 36, 4020, 144, 0,
+    2900, 5317, 0, 3341, 0, 4811, 1970, 3581, 2077, 2437, 0, 0, 0, 0, 0, 2648,
+    4059, 0, 2851, 5476, 5042, 4797, 5896, 2691, 2990, 2784, 161, 0, 2637, 5982, 0, 2663,
+    0, 1633, 0, 4436, 6789, 6764, 4591, 3337, 0, 0, 256, 6325, 6441, 0, 0, 4157,
+    5153, 4307, 0, 6111, 3273, 1765, 0, 0, 0, 7274, 1879, 0, 2765, 5143, 35, 2531,
+    0, 0, 1940, 1604, 5969, 7328, 6426, 3710, 4544, 2545, 2037, 0, 3437, 2342, 6295, 191,
+    0, 0, 0, 0, 5016, 0, 319, 6166, 0, 6450, 2292, 5863, 3493, 0, 5528, 0,
+    5780, 188, 5311, 0, 0, 0, 1967, 3537, 0, 39, 2062, 0, 0, 0, 4431, 0,
+    0, 0, 0, 0, 5230, 0, 3294, 3512, 1600, 0, 1954, 0, 0, 2735, 0, 0,
+    4548, 3063, 0, 0, 0, 0, 0, 0, 6300, 72, 4476, 0, 0, 0, 2549, 5557,
+    246, 2902, 0, 0, 0, 0, 2823, 67, 0, 0, 0, 2196, 0, 6725, 0, 0,
+    0, 0, 1831, 0, 3167, 0, 0, 5341, 0, 1955, 0, 0, 0, 3262, 0, 0,
+    1904, 0, 0, 0, 4007, 120, 0, 0, 1946, 2286, 0, 0, 6022, 6350, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3129, 1631, 0, 2945, 0, 0, 0, 0, 0,
+    0, 0, 1931, 0, 3915, 2630, 7240, 6728, 255, 309, 2605, 5371, 6406, 0, 0, 2756,
+    2073, 5854, 0, 0, 3554, 0, 0, 6393, 0, 0, 0, 0, 0, 3473, 0, 0,
+    2724, 2357, 87, 2316, 1689, 6102, 2987, 3229, 6715, 0, 0, 5400, 0, 0, 0, 0,
+    2809, 0, 2592, 4539, 0, 0, 0, 2838, 0, 4701, 0, 0, 0, 5567, 0, 0,
+    0, 312, 0, 5005, 0, 3892, 4921, 2267, 0, 6266, 0, 106, 4282, 7098, 5167, 6254,
+    4705, 0, 317, 6367, 0, 3330, 0, 2442, 0, 1838, 0, 0, 3067, 0, 0, 5746,
+    0, 0, 0, 0, 2657, 0, 1619, 0, 0, 5002, 2778, 0, 6094, 0, 0, 2006,
+    322, 5831, 2966, 2857, 0, 0, 0, 4777, 5500, 3476, 4141, 254, 6358, 62, 0, 2619,
+    2471, 3463, 0, 0, 0, 3649, 0, 2661, 2525, 0, 0, 25, 265, 0, 0, 0,
+    5766, 3165, 6046, 4795, 0, 0, 0, 2536, 0, 2787, 5099, 0, 6081, 2899, 4762, 1961,
+    0, 5791, 5370, 17, 0, 1943, 0, 279, 177, 4542, 2529, 2010, 4961, 55, 4993, 5635,
+    0, 6912, 0, 0, 0, 0, 2689, 0, 0, 2381, 0, 4908, 5427, 0, 0, 0,
+    0, 0, 0, 3128, 4062, 0, 111, 0, 3297, 3867, 6883, 0, 0, 0, 3018, 264,
+    1605, 30, 6473, 4219, 4946, 0, 3079, 0, 0, 0, 4903, 0, 0, 1714, 197, 0,
+    0, 0, 225, 0, 6875, 0, 1732, 0, 5592, 0, 5161, 4680, 3304, 0, 0, 0,
+    206, 3199, 289, 0, 7350, 6600, 3595, 5526, 0, 0, 0, 0, 0, 0, 210, 2079,
+    2567, 0, 3766, 5907, 0, 0, 0, 1905, 0, 3275, 0, 0, 291, 2624, 2686, 0,
+    3310, 5542, 0, 0, 0, 4605, 0, 0, 1772, 3063, 0, 0, 3575, 5113, 0, 0,
+    0, 5471, 0, 223, 278, 0, 0, 0, 5891, 0, 5548, 202, 0, 0, 5372, 0,
+    321, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1980, 110, 3849, 6309,
+    0, 0, 0, 0, 0, 228, 176, 0, 0, 3999, 4306, 3311, 2236, 120, 3247, 4207,
+    5726, 0, 1677, 0, 3065, 3777, 2821, 0, 0, 0, 2909, 3125, 3800, 0, 0, 0,
+    0, 3852, 0, 1707, 4333, 0, 0, 2094, 3008, 2235, 1621, 1793, 4229, 7059, 3615, 3216,
+    4898, 2931, 0, 4286, 2153, 5716, 3813, 4754, 4243, 0, 0, 0, 2520, 290, 1839, 2813,
+    0, 3222, 0, 85, 204, 122, 3409, 0, 0, 2801, 4836, 0, 286, 6067, 0, 3190,
+    3001, 0, 4280, 3054, 1706, 0, 2085, 0, 2752, 0, 0, 119, 3839, 0, 0, 2888,
+    0, 0, 0, 0, 107, 2590, 0, 6202, 6813, 4970, 0, 0, 4291, 0, 2427, 0,
+    6718, 2963, 3221, 0, 0, 1708, 3937, 0, 3568, 0, 2407, 4710, 4386, 23, 0, 0,
+    3350, 300, 1830, 3412, 1808, 2366, 0, 0, 0, 2445, 0, 0, 2980, 283, 0, 0,
+    4967, 0, 0, 0, 295, 3096, 0, 2936, 0, 0, 0, 5748, 2636, 0, 268, 0,
+    0, 4113, 4886, 2920, 5186, 0, 1895, 0, 3399, 7224, 0, 0, 0, 207, 0, 3605,
+    0, 0, 4023, 3163, 296, 0, 0, 6478, 0, 1648, 1815, 0, 3558, 0, 3107, 4066,
+    2044, 4060, 184, 0, 3466, 3100, 4906, 0, 2913, 5361, 0, 1941, 0, 0, 0, 7399,
+    2803, 3753, 0, 4807, 104, 3286, 2205, 3187, 3787, 0, 4562, 0, 4821, 0, 6772, 0,
+    0, 2345, 0, 3128, 0, 3034, 0, 2651, 4166, 4071, 2875, 0, 0, 3250, 0, 0,
+    3295, 144, 264, 1765, 6109, 2141, 1888, 0, 6361, 226, 0, 7346, 0, 3340, 109, 6743,
+    0, 0, 3712, 0, 0, 4649, 2666, 2892, 2558, 2117, 6124, 0, 0, 0, 2997, 2848,
+    3241, 0, 0, 5146, 5476, 2454, 0, 7311, 5826, 7156, 3282, 6460, 0, 2682, 1829, 3183,
+    6320, 0, 0, 247, 2637, 4427, 0, 2150, 0, 0, 0, 3520, 0, 4307, 2292, 0,
+    0, 5233, 0, 2622, 3601, 4556, 39, 3044, 0, 7272, 0, 0, 0, 2941, 3273, 1879,
+    5098, 0, 0, 3271, 6305, 263, 0, 5598, 0, 0, 5240, 0, 0, 2739, 4507, 0,
+    3491, 274, 0, 219, 0, 1944, 5311, 0, 2999, 5287, 0, 0, 0, 0, 0, 5422,
+    5344, 2510, 0, 2552, 243, 1957, 0, 0, 246, 1965, 0, 0, 0, 2919, 0, 4051,
+    0, 0, 298, 2272, 1600, 3866, 0, 0, 2210, 2319, 3040, 1676, 0, 0, 0, 0,
+    0, 3052, 0, 2945, 0, 1908, 3336, 4471, 0, 0, 2758, 72, 0, 2909, 0, 0,
+    6103, 2960, 6354, 3921, 114, 2608, 253, 0, 1690, 6722, 6022, 1601, 0, 2946, 4883, 0,
+    0, 0, 1831, 6396, 0, 0, 4007, 0, 4648, 0, 79, 297, 2216, 0, 0, 0,
+    2611, 2432, 2286, 200, 0, 2349, 0, 208, 6716, 5855, 0, 2083, 0, 0, 1689, 0,
+    6104, 0, 2728, 0, 213, 7107, 7237, 6701, 6727, 0, 6266, 167, 26, 0, 222, 1631,
+    156, 159, 2327, 1691, 0, 2628, 5967, 2845, 0, 3661, 5097, 3842, 262, 242, 2499, 4701,
+    3551, 0, 7222, 2592, 2472, 3333, 2430, 6273, 5746, 2514, 0, 0, 2357, 3470, 0, 0,
+    87, 4300, 3217, 5416, 0, 0, 3655, 0, 98, 0, 2857, 4536, 3316, 2338, 84, 1842,
+    251, 0, 0, 0, 2778, 0, 3265, 0, 0, 2872, 3153, 3464, 2634, 2471, 0, 5004,
+    0, 4453, 6251, 2657, 3253, 2858, 0, 7043, 6366, 102, 2734, 2416, 5766, 2716, 2264, 0,
+    5768, 149, 2985, 0, 0, 3449, 3475, 0, 0, 0, 3402, 2473, 1943, 0, 3107, 2525,
+    0, 0, 2006, 6057, 2029, 1616, 277, 0, 7205, 4492, 0, 20, 5831, 3315, 3185, 3284,
+    4527, 0, 4772, 2381, 6652, 0, 2878, 0, 4454, 0, 2617, 0, 0, 0, 0, 0,
+    109, 270, 177, 0, 2013, 2512, 0, 244, 3297, 3007, 2387, 2661, 0, 4263, 3109, 6955,
+    3083, 0, 7152, 0, 0, 4945, 2139, 6001, 1747, 0, 0, 0, 0, 0, 0, 4080,
+    0, 0, 2810, 4682, 5325, 0, 0, 2529, 5427, 0, 0, 4956, 5937, 6908, 5592, 0,
+    3238, 0, 1723, 3042, 205, 0, 0, 0, 0, 0, 0, 4915, 0, 0, 3117, 0,
+    0, 2955, 0, 289, 0, 0, 3867, 0, 2601, 3181, 3018, 5478, 0, 0, 4219, 0,
+    0, 2897, 0, 0, 0, 0, 4656, 0, 4901, 0, 3079, 0, 0, 0, 2505, 3547,
+    5846, 0, 5549, 5155, 0, 199, 5473, 5669, 0, 1882, 0, 0, 76, 0, 5116, 5583,
+    0, 0, 3591, 2579, 2932, 0, 0, 0, 233, 0, 0, 0, 2028, 0, 134, 0,
+    4043, 0, 0, 0, 5904, 321, 1764, 2244, 0, 2919, 0, 4867, 3065, 3766, 5731, 0,
+    2640, 0, 293, 0, 0, 4601, 0, 0, 5313, 0, 4754, 3781, 0, 0, 3326, 4310,
+    0, 0, 1799, 0, 0, 1612, 0, 5670, 6068, 4978, 2744, 2821, 0, 3309, 0, 0,
+    0, 3846, 2942, 4939, 4646, 5995, 0, 0, 3803, 209, 4755, 0, 0, 0, 0, 0,
+    5736, 2814, 2571, 122, 2423, 0, 4270, 3999, 0, 0, 0, 0, 273, 2347, 0, 0,
+    3613, 3840, 0, 0, 2494, 3124, 0, 4938, 132, 0, 2844, 1621, 6030, 0, 0, 0,
+    3946, 6202, 7056, 6069, 4010, 4296, 24, 2965, 157, 2085, 2235, 1710, 0, 0, 13, 3851,
+    2776, 5883, 0, 4895, 0, 0, 4241, 0, 3406, 4667, 3566, 2590, 3232, 6209, 3151, 155,
+    0, 2513, 6736, 85, 306, 2983, 0, 0, 7041, 2655, 2793, 2964, 283, 0, 0, 0,
+    2749, 0, 172, 0, 0, 0, 1834, 3033, 0, 1706, 299, 2934, 0, 0, 6498, 4438,
+    1763, 249, 3400, 0, 0, 2854, 4969, 6811, 0, 1700, 0, 3251, 7234, 0, 4381, 0,
+    0, 271, 1648, 0, 5537, 0, 0, 3685, 6006, 4887, 1821, 3348, 0, 3096, 3411, 0,
+    0, 0, 4834, 7256, 0, 1941, 179, 0, 1655, 0, 5747, 6146, 0, 0, 2135, 2719,
+    3102, 5696, 0, 0, 0, 0, 0, 0, 0, 4076, 3484, 2047, 4428, 0, 2877, 3089,
+    0, 0, 0, 0, 4439, 0, 0, 0, 0, 4021, 0, 3295, 0, 0, 270, 1888,
+    5442, 2820, 2351, 0, 3831, 0, 0, 0, 0, 0, 0, 5052, 0, 2895, 3161, 2876,
+    0, 0, 0, 0, 0, 201, 0, 0, 5316, 0, 5262, 6117, 0, 0, 1876, 0,
+    5829, 4801, 3747, 2846, 6768, 2682, 259, 5531, 5477, 0, 0, 0, 0, 0, 0, 0,
+    0, 4652, 3034, 0, 4161, 0, 0, 2150, 0, 0, 0, 0, 0, 1765, 4966, 5837,
+    3787, 0, 7278, 2622, 255, 1880, 5307, 1912, 2343, 0, 2600, 5250, 0, 3711, 2754, 0,
+    0, 0, 0, 2811, 68, 5245, 2999, 0, 0, 0, 0, 0, 0, 43, 1606, 3391,
+    219, 3255, 5424, 304, 5101, 0, 0, 5312, 2746, 133, 0, 5385, 0, 0, 2488, 0,
+    3516, 0, 241, 4222, 0, 5429, 4051, 3261, 0, 0, 0, 1913, 2169, 5561, 2229, 0,
+    0, 0, 0, 0, 0, 2213, 0, 0, 4866, 4552, 4208, 3052, 5089, 0, 0, 0,
+    2758, 0, 0, 0, 0, 3870, 1810, 1610, 4462, 3013, 2282, 0, 0, 117, 0, 0,
+    4702, 2773, 2759, 0, 0, 5980, 0, 2218, 4924, 0, 2948, 0, 0, 5342, 2189, 0,
+    0, 0, 0, 1956, 2349, 0, 0, 254, 0, 2611, 4008, 0, 4122, 1601, 2287, 0,
+    2333, 4923, 0, 0, 0, 0, 0, 0, 0, 2432, 0, 213, 2839, 0, 0, 235,
+    2945, 0, 0, 4002, 2647, 173, 0, 2779, 0, 0, 6732, 2845, 6021, 7244, 2958, 0,
+    162, 0, 1693, 2104, 4783, 0, 2606, 2658, 0, 0, 0, 4880, 0, 2083, 6394, 6275,
+    0, 3549, 0, 3665, 0, 0, 4123, 0, 0, 6102, 0, 5848, 5419, 89, 2526, 2539,
+    3860, 147, 2103, 3988, 2317, 2712, 0, 5775, 0, 0, 5142, 0, 0, 3031, 0, 3426,
+    4534, 6699, 0, 2925, 0, 0, 6266, 0, 1679, 37, 0, 7252, 2538, 3668, 7053, 98,
+    2860, 6258, 312, 262, 0, 7102, 284, 6556, 2591, 3621, 0, 1689, 0, 0, 2798, 0,
+    3480, 0, 0, 0, 0, 2475, 251, 6245, 1953, 3331, 7075, 6097, 319, 5811, 5590, 5222,
+    3655, 0, 5770, 0, 2985, 4496, 2032, 1614, 2420, 0, 5832, 5647, 0, 0, 2857, 0,
+    2870, 6009, 3420, 4456, 4426, 56, 0, 2548, 0, 4733, 0, 0, 0, 0, 2471, 0,
+    2178, 6047, 3109, 6833, 2672, 102, 4263, 2389, 5766, 1756, 202, 0, 0, 5407, 0, 2406,
+    0, 6940, 3447, 0, 0, 0, 5333, 0, 0, 0, 3356, 1943, 2020, 0, 0, 228,
+    0, 0, 5213, 0, 18, 0, 0, 4216, 5428, 0, 3238, 6994, 237, 3320, 2381, 0,
+    0, 4447, 0, 6646, 0, 0, 0, 0, 0, 0, 6012, 0, 4952, 3117, 3297, 0,
+    5201, 0, 0, 3278, 2697, 4349, 3080, 2767, 4220, 0, 2073, 5166, 3547, 1747, 4314, 171,
+    0, 2897, 6626, 0, 0, 0, 4613, 0, 2505, 2483, 5846, 0, 0, 0, 0, 224,
+    4681, 0, 0, 0, 2308, 0, 5592, 0, 2932, 3790, 0, 0, 4911, 0, 0, 5936,
+    195, 0, 0, 0, 0, 0, 1993, 0, 0, 0, 0, 0, 0, 0, 4043, 0,
+    0, 232, 0, 3261, 0, 1887, 0, 0, 0, 5677, 0, 0, 6232, 0, 0, 0,
+    2246, 3036, 6194, 293, 1768, 0, 0, 4315, 0, 0, 0, 0, 0, 1612, 0, 1809,
+    6076, 0, 0, 0, 3227, 0, 0, 5672, 0, 0, 2405, 0, 0, 0, 2681, 6906,
+    0, 0, 4757, 0, 2755, 0, 0, 5472, 0, 0, 1853, 0, 0, 3263, 0, 4000,
+    0, 0, 2347, 3312, 4094, 3822, 0, 0, 3065, 3233, 0, 6038, 6471, 0, 0, 0,
+    0, 0, 0, 0, 0, 2564, 4754, 2899, 0, 0, 0, 0, 2975, 2423, 2645, 2494,
+    2844, 0, 3589, 1640, 198, 7063, 4976, 0, 2009, 3232, 0, 0, 4748, 6592, 4941, 0,
+    4894, 0, 2656, 5910, 95, 3801, 6211, 4671, 0, 4050, 0, 0, 317, 2369, 4095, 122,
+    2991, 0, 0, 2796, 6067, 2524, 3234, 0, 0, 0, 145, 0, 3856, 4938, 2777, 5760,
+    0, 4599, 185, 6817, 0, 0, 4711, 3382, 2747, 299, 5986, 249, 6202, 0, 7071, 0,
+    0, 1703, 60, 2964, 2084, 0, 0, 319, 4372, 0, 5032, 0, 3941, 2523, 1709, 206,
+    0, 0, 5749, 0, 0, 2407, 3416, 4731, 2534, 6520, 0, 3155, 7268, 0, 0, 6416,
+    0, 2680, 2981, 3214, 1951, 271, 0, 5187, 0, 5581, 3308, 0, 1657, 0, 0, 0,
+    0, 0, 0, 0, 4851, 0, 211, 0, 316, 0, 4441, 0, 0, 6498, 5537, 2546,
+    0, 0, 0, 7228, 0, 0, 2163, 0, 0, 0, 3658, 1648, 3831, 0, 0, 0,
+    6151, 4831, 0, 0, 0, 0, 6269, 0, 5126, 0, 2903, 1971, 0, 0, 0, 5318,
+    1941, 0, 5268, 0, 0, 2234, 0, 0, 4611, 0, 2129, 2832, 3759, 5696, 3776, 0,
+    2693, 0, 2569, 3178, 0, 0, 227, 248, 0, 3304, 0, 0, 0, 2876, 0, 0,
+    0, 0, 3293, 0, 4152, 1876, 3295, 0, 5843, 0, 7014, 0, 1888, 0, 0, 3788,
+    2952, 182, 3902, 0, 0, 1605, 0, 2600, 0, 0, 2893, 0, 253, 0, 0, 3391,
+    2811, 2293, 1921, 0, 0, 0, 0, 0, 0, 5827, 0, 2204, 3220, 2740, 0, 7317,
+    5531, 1750, 5564, 2682, 0, 0, 0, 0, 0, 0, 2746, 0, 0, 0, 0, 0,
+    0, 0, 108, 0, 0, 0, 5229, 0, 4262, 1915, 3903, 6188, 222, 0, 0, 2384,
+    2219, 5572, 2622, 0, 0, 0, 2231, 3063, 0, 3768, 0, 0, 0, 0, 23, 2999,
+    0, 315, 2172, 0, 0, 223, 0, 0, 0, 0, 5423, 0, 1610, 2218, 2701, 2826,
+    4212, 2403, 0, 3216, 2761, 48, 2625, 6766, 0, 219, 0, 2191, 5340, 1810, 61, 0,
+    0, 4051, 0, 0, 0, 2282, 0, 4343, 0, 0, 0, 0, 0, 181, 120, 2864,
+    6023, 0, 2211, 6359, 3052, 0, 1634, 0, 0, 0, 0, 0, 2729, 2758, 2504, 3099,
+    0, 0, 4131, 5361, 5018, 0, 0, 4407, 2771, 99, 0, 1623, 2007, 0, 3697, 4926,
+    0, 4786, 0, 0, 6452, 280, 0, 2947, 5861, 0, 2647, 0, 0, 0, 4879, 0,
+    4125, 295, 0, 0, 0, 0, 3514, 4042, 0, 5636, 2349, 0, 2611, 3208, 189, 89,
+    4550, 7093, 2875, 213, 5778, 0, 0, 4923, 0, 0, 314, 0, 0, 2889, 136, 0,
+    2593, 6705, 0, 2330, 0, 2712, 4869, 2106, 1885, 2845, 5223, 5142, 318, 3992, 3662, 147,
+    6248, 1692, 6105, 6890, 2558, 0, 206, 0, 2541, 6274, 0, 4983, 1847, 2614, 0, 0,
+    0, 0, 0, 0, 0, 7087, 0, 1680, 5417, 2678, 0, 0, 3656, 5222, 2103, 5812,
+    0, 0, 3306, 0, 0, 2798, 2493, 0, 0, 4743, 0, 5334, 4498, 0, 4187, 0,
+    5224, 0, 0, 1906, 2538, 0, 0, 274, 3667, 7047, 215, 2676, 6842, 2859, 0, 258,
+    0, 0, 0, 3453, 0, 5087, 1756, 6501, 0, 5333, 220, 6045, 0, 6205, 2548, 0,
+    0, 0, 0, 0, 0, 0, 2272, 0, 2225, 6658, 5373, 233, 5769, 2474, 5219, 6060,
+    0, 2207, 0, 4493, 5647, 1743, 2410, 6977, 0, 0, 0, 0, 6002, 4450, 4041, 3239,
+    0, 0, 0, 2556, 2633, 4455, 0, 3128, 111, 3881, 3010, 3281, 4216, 3144, 3192, 0,
+    2388, 3076, 4877, 4263, 6505, 2309, 1748, 5169, 0, 1688, 4623, 264, 1780, 6938, 247, 269,
+    0, 0, 0, 75, 0, 2483, 0, 0, 0, 200, 0, 2941, 0, 2997, 1651, 0,
+    2308, 5176, 0, 0, 3218, 4323, 5940, 273, 0, 1840, 238, 195, 0, 0, 7414, 6665,
+    0, 3647, 0, 0, 3117, 0, 0, 1781, 0, 0, 3278, 0, 2310, 4349, 23, 0,
+    5967, 3547, 0, 2492, 2963, 3830, 0, 242, 3049, 4317, 2270, 4630, 0, 0, 5121, 0,
+    2932, 0, 0, 0, 0, 2505, 0, 0, 3025, 2700, 2976, 0, 2470, 2424, 0, 1891,
+    0, 0, 0, 0, 6039, 0, 5846, 3177, 0, 5765, 0, 0, 0, 2634, 0, 6198,
+    0, 2930, 0, 214, 217, 1991, 0, 0, 1809, 0, 0, 4043, 3263, 0, 7008, 2245,
+    0, 276, 0, 6232, 2415, 6475, 0, 1677, 0, 2853, 0, 305, 293, 0, 0, 0,
+    3097, 0, 0, 4103, 2909, 3390, 0, 5671, 1612, 0, 2788, 2710, 7128, 167, 0, 0,
+    6903, 3633, 6484, 4490, 97, 2578, 5996, 2081, 6040, 0, 0, 5910, 1721, 4751, 6577, 4756,
+    0, 5916, 0, 1853, 0, 2009, 3235, 2645, 4097, 1644, 310, 0, 2994, 2875, 2512, 0,
+    0, 2804, 0, 2347, 5763, 2018, 6888, 0, 3088, 4711, 0, 0, 1715, 0, 2494, 96,
+    0, 2336, 0, 0, 2888, 0, 7361, 0, 0, 2844, 145, 0, 205, 6070, 2733, 4935,
+    0, 272, 5188, 4940, 0, 0, 3586, 4054, 6750, 185, 5987, 5115, 2557, 2777, 3932, 4712,
+    5749, 3151, 2794, 0, 3368, 0, 0, 4668, 2842, 2369, 3176, 6210, 0, 0, 0, 0,
+    5187, 2523, 0, 0, 2460, 2979, 0, 0, 0, 0, 0, 0, 5751, 4596, 0, 3158,
+    299, 2638, 0, 4483, 0, 3021, 249, 6499, 0, 5319, 5150, 4308, 5189, 0, 0, 1701,
+    274, 0, 5662, 0, 5012, 0, 59, 0, 0, 0, 0, 2447, 6519, 0, 0, 0,
+    5318, 3249, 2502, 3107, 2546, 243, 0, 1971, 7262, 0, 0, 2906, 0, 3498, 3676, 2051,
+    304, 1656, 0, 0, 5079, 0, 2271, 5697, 3288, 0, 5308, 2693, 2205, 0, 4838, 260,
+    0, 0, 0, 4569, 3089, 4846, 0, 4440, 0, 0, 0, 0, 0, 2722, 0, 0,
+    0, 6066, 0, 3776, 0, 2765, 2516, 0, 3007, 0, 2294, 180, 109, 5527, 2953, 3831,
+    0, 0, 1605, 2143, 0, 0, 0, 0, 0, 0, 73, 4646, 2891, 0, 0, 0,
+    0, 0, 2674, 0, 0, 5802, 2180, 0, 2293, 0, 44, 3178, 3911, 0, 0, 5532,
+    0, 5605, 0, 0, 0, 0, 0, 1832, 0, 0, 0, 0, 2831, 0, 0, 3045,
+    5840, 2491, 132, 0, 7014, 2295, 0, 5966, 242, 1755, 1609, 3603, 2952, 3905, 0, 2776,
+    2655, 2600, 0, 3063, 0, 0, 0, 4665, 0, 0, 3197, 0, 2746, 223, 3391, 2811,
+    308, 4266, 2790, 313, 4352, 5236, 0, 0, 5756, 3772, 5606, 2468, 6024, 0, 172, 2935,
+    0, 5562, 0, 2603, 0, 0, 0, 2919, 0, 0, 0, 0, 2581, 0, 0, 4437,
+    4346, 0, 194, 2865, 2230, 120, 1914, 0, 6188, 2625, 2413, 0, 6363, 3875, 0, 0,
+    0, 4810, 0, 305, 2209, 2045, 236, 1610, 0, 0, 3338, 113, 4356, 2482, 0, 178,
+    6025, 0, 6115, 6235, 2713, 5981, 2114, 3014, 4481, 0, 0, 6372, 2218, 0, 3967, 6763,
+    0, 0, 5861, 11, 0, 2512, 3099, 2508, 0, 0, 0, 0, 2594, 2760, 0, 0,
+    4650, 1627, 306, 5867, 6437, 2433, 2007, 2864, 0, 94, 124, 5639, 0, 47, 6748, 5819,
+    0, 3086, 4046, 0, 0, 0, 2889, 0, 1856, 4784, 0, 0, 0, 1634, 311, 6294,
+    1754, 0, 0, 2847, 3208, 2969, 162, 0, 0, 6900, 5015, 4925, 7167, 29, 137, 3695,
+    2646, 5100, 0, 0, 0, 193, 0, 0, 2595, 1850, 0, 0, 4124, 4870, 0, 2514,
+    0, 0, 2614, 0, 89, 6922, 0, 3511, 5010, 0, 0, 3174, 63, 5776, 5415, 0,
+    0, 0, 2699, 0, 1860, 15, 4547, 5225, 0, 2926, 0, 1910, 0, 0, 146, 0,
+    3868, 3672, 0, 3496, 2105, 4460, 0, 0, 0, 1875, 2497, 0, 5627, 0, 5141, 3171,
+    3077, 5378, 0, 0, 0, 0, 241, 0, 2668, 2481, 0, 2540, 0, 0, 0, 0,
+    7081, 5376, 5553, 6246, 0, 0, 0, 0, 0, 1945, 5648, 0, 0, 0, 2168, 2207,
+    6053, 0, 5306, 6528, 1874, 0, 0, 0, 4737, 3029, 0, 0, 3128, 2881, 4491, 0,
+    0, 0, 0, 0, 0, 111, 258, 0, 3300, 2822, 0, 1743, 0, 264, 0, 6837,
+    6513, 2547, 5333, 1756, 6944, 3147, 0, 5977, 0, 4922, 0, 2677, 0, 0, 0, 0,
+    2165, 0, 2754, 0, 0, 2834, 2997, 3274, 0, 0, 0, 5181, 2810, 5328, 0, 0,
+    0, 1789, 1606, 0, 0, 7426, 0, 4448, 235, 5128, 0, 3647, 0, 0, 0, 0,
+    0, 175, 0, 3996, 0, 2312, 4350, 2102, 3279, 0, 6015, 132, 3881, 1844, 1783, 0,
+    0, 4877, 134, 198, 3092, 0, 2152, 0, 5123, 5507, 74, 0, 0, 0, 4656, 4617,
+    0, 0, 0, 2483, 7017, 0, 2976, 3196, 2655, 3834, 3987, 0, 303, 2308, 199, 3243,
+    288, 4248, 0, 1997, 5131, 172, 195, 0, 0, 2537, 0, 3031, 0, 0, 2579, 0,
+    0, 0, 5497, 37, 0, 7011, 0, 2030, 0, 0, 2743, 281, 282, 6233, 0, 4316,
+    1677, 6798, 3610, 0, 2072, 0, 4626, 0, 131, 0, 0, 4233, 2909, 0, 51, 6191,
+    4761, 7021, 0, 0, 2986, 0, 0, 0, 2415, 6077, 173, 6493, 0, 2711, 2099, 0,
+    0, 0, 4719, 0, 1725, 3205, 2087, 0, 4490, 5994, 6910, 3394, 3097, 0, 1854, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3263, 2807, 6799, 0, 0, 0, 0,
+    5918, 5804, 6038, 190, 0, 0, 0, 6472, 0, 2888, 0, 2086, 0, 36, 0, 3557,
+    302, 0, 0, 3345, 0, 6033, 0, 6133, 4028, 0, 0, 5196, 6918, 5895, 0, 0,
+    4714, 96, 5118, 3593, 4749, 1970, 6760, 3631, 0, 1728, 2078, 0, 2703, 5910, 0, 2589,
+    3580, 0, 0, 2008, 2370, 0, 2691, 4096, 165, 272, 2992, 6575, 0, 5483, 6782, 0,
+    1715, 0, 2792, 5158, 0, 4590, 4603, 4013, 0, 0, 2642, 212, 4711, 1896, 5753, 5761,
+    0, 4933, 4312, 0, 0, 0, 0, 5190, 0, 0, 1766, 92, 0, 256, 2583, 7294,
+    3075, 3107, 7356, 0, 0, 3717, 6524, 0, 5363, 4791, 2732, 0, 0, 5538, 191, 5749,
+    0, 5024, 196, 3366, 0, 0, 0, 0, 6177, 2159, 3508, 2054, 1637, 5663, 0, 0,
+    0, 0, 2205, 320, 0, 0, 0, 3189, 5106, 4571, 4857, 4206, 0, 0, 0, 2340,
+    237, 0, 0, 3530, 2058, 4430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109,
+    0, 315, 0, 0, 4285, 0, 5449, 0, 2820, 2766, 6152, 0, 5318, 2143, 0, 0,
+    0, 0, 0, 3111, 5802, 0, 0, 0, 1971, 0, 2904, 0, 2560, 1602, 0, 0,
+    3169, 5527, 4225, 1836, 1605, 0, 3231, 0, 2693, 0, 0, 0, 5506, 0, 0, 0,
+    0, 0, 3045, 0, 0, 0, 7015, 0, 235, 0, 2721, 0, 170, 0, 2297, 0,
+    0, 5613, 0, 2093, 0, 0, 4246, 3603, 4370, 0, 2765, 0, 4665, 0, 0, 95,
+    0, 0, 0, 0, 0, 0, 5884, 0, 0, 2790, 224, 2535, 0, 0, 3567, 0,
+    3884, 2748, 2358, 3986, 2293, 1759, 0, 5608, 6401, 0, 2935, 0, 0, 2581, 3227, 0,
+    0, 0, 0, 2274, 2049, 0, 0, 0, 0, 0, 314, 0, 4065, 0, 0, 3878,
+    3261, 0, 0, 0, 0, 2956, 6189, 3904, 5575, 6686, 2603, 0, 0, 3063, 0, 0,
+    6267, 0, 0, 0, 0, 6386, 4364, 5581, 3154, 3888, 0, 223, 1811, 3338, 0, 0,
+    3209, 0, 2629, 2827, 2413, 2434, 4481, 169, 0, 6770, 6381, 0, 4817, 0, 0, 0,
+    5979, 0, 4704, 2486, 4344, 0, 0, 3070, 0, 4654, 0, 0, 0, 4026, 0, 158,
+    6687, 120, 0, 3646, 0, 0, 0, 5869, 4150, 6023, 6360, 0, 0, 2352, 0, 0,
+    0, 0, 0, 2900, 0, 1604, 0, 1635, 2648, 86, 3328, 3434, 0, 5969, 2971, 2435,
+    2782, 6435, 2112, 3701, 6778, 0, 32, 6084, 0, 5861, 7309, 2569, 252, 3098, 3139, 218,
+    0, 2514, 0, 5103, 6316, 2847, 0, 0, 1961, 90, 311, 3518, 2868, 0, 0, 5637,
+    0, 6934, 5434, 2528, 2735, 3194, 0, 0, 148, 4554, 2689, 0, 1868, 5143, 6110, 0,
+    3435, 3872, 5554, 2889, 4464, 0, 4541, 0, 2593, 2618, 6294, 0, 0, 5020, 0, 0,
+    64, 0, 0, 319, 0, 0, 0, 0, 1718, 5553, 1744, 6894, 7162, 0, 15, 0,
+    0, 0, 0, 0, 0, 0, 1848, 3526, 0, 6611, 5593, 0, 0, 238, 0, 1954,
+    0, 5628, 0, 0, 0, 5913, 0, 3164, 0, 5555, 0, 2217, 0, 0, 0, 0,
+    0, 0, 3767, 0, 0, 2883, 0, 2567, 1907, 4467, 0, 2168, 2624, 0, 2549, 248,
+    2668, 1874, 0, 2403, 0, 0, 270, 0, 0, 3303, 6721, 6828, 0, 0, 0, 0,
+    0, 0, 0, 48, 3172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5374, 0,
+    1945, 2207, 2810, 0, 2724, 5330, 0, 0, 0, 0, 3229, 0, 6983, 0, 6350, 276,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2835, 0, 285, 0, 3128,
+    3300, 0, 0, 0, 1622, 0, 5003, 3882, 108, 0, 0, 5513, 6399, 0, 6509, 0,
+    5165, 95, 7091, 0, 134, 4656, 3550, 0, 0, 0, 0, 0, 3026, 3469, 5849, 280,
+    0, 0, 2987, 2997, 199, 189, 294, 2155, 0, 3287, 4258, 5135, 1841, 3808, 301, 1974,
+    7420, 4535, 0, 2579, 0, 204, 0, 0, 0, 0, 0, 0, 0, 2034, 0, 0,
+    0, 303, 2966, 0, 3987, 60, 288, 0, 4974, 4867, 3225, 0, 3647, 25, 4279, 2261,
+    4636, 125, 0, 0, 2311, 6203, 2142, 0, 0, 0, 3152, 1782, 0, 3793, 0, 7029,
+    0, 1615, 2976, 62, 2799, 0, 0, 2678, 3207, 0, 0, 2408, 0, 5496, 6807, 0,
+    2974, 0, 4954, 52, 0, 4722, 0, 234, 0, 4768, 0, 0, 0, 0, 0, 0,
+    0, 7009, 0, 0, 0, 6801, 59, 0, 0, 3602, 0, 0, 0, 0, 1677, 5087,
+    0, 3206, 0, 4886, 0, 0, 0, 0, 2899, 0, 6470, 4761, 0, 0, 2909, 0,
+    0, 5198, 4038, 5370, 3199, 6041, 2414, 2089, 2097, 6488, 3637, 4813, 4490, 5159, 3561, 190,
+    0, 0, 183, 2568, 0, 2010, 4913, 6581, 302, 2077, 3583, 210, 1722, 2832, 1649, 2556,
+    5917, 0, 0, 0, 3286, 5898, 0, 2805, 6794, 4565, 0, 4059, 5158, 3187, 0, 291,
+    2704, 1716, 0, 206, 0, 3038, 5539, 1772, 2086, 4593, 2888, 0, 3337, 0, 0, 0,
+    1770, 1897, 0, 6863, 0, 6754, 6113, 0, 1727, 0, 2141, 7367, 1889, 5160, 0, 2886,
+    3726, 2666, 0, 35, 4713, 0, 5538, 0, 7342, 6297, 0, 3372, 0, 2119, 0, 0,
+    0, 307, 0, 7333, 0, 0, 2463, 5481, 0, 0, 0, 0, 2683, 2492, 5864, 4309,
+    3120, 5752, 3044, 5540, 0, 2215, 3310, 2639, 0, 1742, 1609, 2270, 0, 4433, 2066, 3074,
+    0, 0, 2159, 0, 0, 0, 0, 7288, 0, 3601, 0, 0, 3008, 4226, 0, 5449,
+    313, 4206, 0, 5107, 0, 0, 3845, 48, 0, 308, 6301, 0, 0, 269, 0, 0,
+    0, 2052, 0, 290, 0, 3502, 0, 2236, 4225, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2205, 0, 2950, 4570, 3288, 3113, 4052, 5299, 0, 3777, 0, 0, 3189, 0,
+    0, 0, 275, 0, 1948, 0, 4968, 0, 4227, 0, 4087, 168, 3007, 0, 0, 0,
+    3806, 4285, 5272, 4374, 2075, 3336, 0, 1707, 3930, 0, 2018, 107, 2710, 280, 0, 0,
+    2801, 3318, 47, 4392, 0, 224, 170, 0, 0, 297, 0, 5802, 0, 0, 0, 189,
+    0, 0, 6411, 0, 2940, 3405, 0, 1833, 0, 0, 5748, 0, 268, 2748, 0, 3222,
+    2920, 0, 0, 0, 0, 0, 1812, 0, 217, 2358, 0, 2296, 3603, 3986, 4377, 3261,
+    0, 2963, 6715, 5186, 3567, 2769, 23, 0, 0, 6271, 4665, 0, 0, 0, 2644, 2275,
+    2784, 0, 0, 2701, 3896, 0, 1811, 5884, 0, 6695, 2959, 0, 2790, 2862, 2607, 0,
+    0, 2935, 5607, 0, 3021, 0, 6280, 0, 2442, 4707, 2636, 5317, 3154, 0, 0, 2581,
+    0, 0, 1895, 2477, 240, 2919, 0, 0, 5002, 310, 3876, 4154, 6689, 143, 2046, 4065,
+    5086, 3265, 0, 1813, 2900, 0, 0, 0, 6358, 0, 169, 0, 4811, 0, 215, 3073,
+    0, 5361, 4360, 4172, 3650, 2648, 257, 3338, 2852, 0, 0, 0, 5042, 6026, 6376, 6116,
+    2663, 5144, 158, 4816, 0, 4797, 4481, 3463, 0, 0, 0, 0, 3443, 6441, 5970, 0,
+    4651, 2352, 2556, 86, 4427, 2875, 2649, 4157, 148, 0, 2433, 0, 0, 2531, 3284, 3185,
+    4764, 0, 2292, 0, 5143, 0, 5793, 4530, 2722, 5868, 0, 39, 0, 0, 3437, 0,
+    2871, 4544, 267, 6120, 3139, 6295, 5235, 0, 174, 2847, 0, 4264, 0, 163, 2669, 3019,
+    2139, 30, 7173, 5145, 2736, 0, 0, 4948, 5598, 7148, 0, 0, 2558, 0, 1829, 2596,
+    0, 0, 0, 6620, 2514, 0, 2550, 0, 1954, 6315, 150, 90, 5230, 6928, 5596, 5432,
+    2491, 1864, 0, 0, 5557, 0, 19, 0, 2270, 0, 3042, 1736, 0, 0, 5346, 0,
+    0, 3275, 3084, 0, 274, 4505, 3869, 2955, 3164, 2601, 1905, 71, 0, 0, 4461, 2549,
+    3767, 0, 6351, 0, 2506, 6022, 0, 0, 0, 0, 0, 0, 0, 5553, 5341, 0,
+    76, 0, 2551, 2688, 0, 0, 243, 0, 1946, 0, 0, 282, 3296, 0, 0, 0,
+    5372, 0, 0, 0, 0, 0, 0, 6350, 0, 0, 2272, 0, 3141, 0, 0, 236,
+    0, 4044, 266, 0, 4466, 0, 0, 0, 176, 2725, 0, 6103, 3301, 0, 0, 0,
+    4207, 0, 0, 6352, 1690, 5977, 2321, 3326, 114, 6721, 7095, 2710, 2073, 0, 0, 0,
+    2017, 0, 0, 209, 2316, 0, 0, 2592, 3317, 1622, 0, 77, 4648, 0, 0, 2987,
+    0, 123, 2810, 5329, 0, 4288, 0, 7113, 5172, 3818, 3195, 0, 0, 3086, 0, 200,
+    2495, 0, 1839, 0, 7098, 3133, 5746, 0, 0, 0, 0, 0, 0, 5967, 194, 286,
+    301, 0, 294, 2778, 0, 0, 5003, 5510, 0, 3839, 5097, 242, 2657, 3054, 4282, 3550,
+    0, 6207, 4656, 0, 0, 0, 0, 0, 0, 5849, 13, 0, 0, 0, 2472, 178,
+    4292, 6051, 239, 3469, 4252, 199, 5500, 5767, 155, 3570, 2145, 4535, 3174, 6216, 3152, 2427,
+    2579, 2634, 2787, 0, 0, 3020, 0, 4453, 1808, 2366, 2734, 134, 62, 0, 0, 2031,
+    0, 177, 0, 4967, 0, 0, 0, 2260, 6507, 2416, 3047, 4867, 0, 83, 2938, 0,
+    0, 305, 2481, 2899, 0, 4762, 3073, 0, 0, 7025, 0, 5370, 0, 3606, 4068, 0,
+    1615, 0, 1653, 2010, 0, 3206, 3399, 4993, 0, 3030, 6479, 0, 4951, 6011, 4889, 0,
+    4720, 5931, 193, 0, 0, 4908, 0, 184, 0, 4062, 0, 0, 0, 0, 1662, 0,
+    6800, 0, 2011, 2512, 4767, 5703, 1698, 0, 3200, 289, 4825, 3090, 0, 0, 4946, 0,
+    0, 0, 0, 0, 0, 0, 0, 1893, 4072, 0, 2088, 0, 0, 6034, 0, 4032,
+    2160, 2667, 5161, 5442, 3832, 0, 144, 0, 1773, 5061, 206, 0, 0, 1732, 7350, 3161,
+    3341, 0, 5114, 0, 0, 0, 3581, 5583, 0, 0, 205, 6127, 0, 0, 0, 0,
+    5896, 5486, 0, 321, 6788, 2480, 2686, 259, 0, 0, 5476, 0, 2151, 2850, 186, 5542,
+    0, 0, 3035, 0, 4966, 6324, 0, 4591, 0, 5669, 2637, 0, 2821, 0, 0, 1767,
+    0, 7300, 4307, 225, 0, 5153, 0, 3273, 5252, 0, 0, 1879, 3721, 3778, 0, 1742,
+    0, 0, 0, 5538, 6309, 3392, 0, 0, 0, 2028, 0, 0, 0, 0, 0, 0,
+    0, 0, 2545, 0, 1607, 0, 3258, 2571, 3777, 0, 4270, 0, 5726, 0, 0, 3272,
+    0, 5311, 2763, 0, 0, 4056, 3536, 236, 0, 0, 4431, 0, 0, 0, 0, 2062,
+    2236, 0, 0, 1707, 6068, 4229, 0, 1600, 0, 0, 5449, 4286, 3205, 0, 2820, 3779,
+    2085, 3845, 0, 3934, 0, 0, 0, 0, 0, 2590, 3195, 0, 0, 4475, 72, 0,
+    0, 4646, 0, 121, 2195, 4401, 0, 0, 2801, 0, 168, 4225, 3222, 6724, 3952, 0,
+    0, 3556, 2753, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2911, 0, 0, 1831,
+    0, 4007, 0, 4968, 36, 0, 0, 0, 6718, 0, 0, 3937, 3011, 2963, 132, 231,
+    4371, 2075, 2776, 2183, 0, 3682, 0, 261, 3095, 3568, 0, 252, 1631, 5885, 0, 0,
+    23, 3405, 224, 6728, 2980, 0, 7239, 159, 2701, 0, 2630, 2772, 6405, 2936, 1821, 6289,
+    172, 1895, 3472, 0, 0, 4438, 2636, 256, 1815, 0, 2543, 0, 0, 2357, 3553, 2748,
+    4066, 1763, 87, 0, 0, 0, 0, 0, 3261, 0, 0, 0, 7224, 0, 4376, 245,
+    3683, 4538, 1811, 4782, 0, 0, 6268, 0, 191, 0, 1679, 0, 0, 3466, 3100, 0,
+    6141, 5005, 5361, 0, 0, 0, 284, 3892, 2348, 2716, 0, 6253, 3153, 104, 4181, 0,
+    6367, 0, 0, 0, 0, 4705, 5773, 0, 4821, 2651, 257, 1953, 0, 0, 0, 3476,
+    6688, 5654, 0, 2923, 1618, 0, 207, 2875, 4151, 2006, 2353, 0, 0, 0, 0, 0,
+    3315, 2900, 6238, 2436, 2619, 3110, 0, 4776, 0, 0, 5831, 0, 2892, 0, 0, 0,
+    2648, 152, 0, 265, 0, 2848, 0, 5407, 1757, 5238, 5146, 0, 2661, 0, 4268, 3165,
+    6960, 4795, 6320, 2558, 0, 0, 40, 1829, 0, 5099, 0, 0, 0, 0, 4727, 0,
+    0, 0, 4156, 0, 0, 0, 148, 0, 0, 2529, 5437, 0, 4960, 7156, 3252, 0,
+    5599, 2149, 1912, 0, 0, 4507, 5791, 4542, 0, 0, 0, 5349, 0, 3436, 5427, 0,
+    0, 5089, 5240, 2767, 0, 0, 0, 4358, 3867, 274, 0, 0, 2998, 5203, 3018, 0,
+    0, 0, 0, 4219, 2484, 0, 3079, 0, 2510, 3183, 3282, 0, 243, 2552, 1942, 0,
+    6615, 0, 0, 0, 241, 5594, 0, 1954, 5385, 0, 0, 2272, 0, 0, 0, 2169,
+    5556, 1601, 0, 0, 0, 0, 2688, 0, 4208, 0, 0, 0, 4471, 2210, 0, 0,
+    263, 0, 3296, 0, 0, 0, 0, 0, 2432, 0, 1987, 6354, 114, 0, 3766, 4048,
+    2324, 0, 0, 5341, 3205, 1690, 3066, 0, 6722, 0, 2083, 0, 0, 0, 0, 0,
+    0, 0, 79, 0, 0, 0, 234, 4648, 1603, 0, 0, 200, 0, 0, 5820, 0,
+    7122, 298, 6350, 0, 3848, 0, 0, 0, 0, 0, 1862, 0, 0, 0, 235, 3546,
+    0, 0, 0, 3426, 4300, 0, 0, 2910, 3999, 0, 0, 3236, 2327, 7237, 6074, 2402,
+    2499, 3661, 0, 3842, 98, 3618, 7092, 0, 3551, 2073, 242, 3125, 5097, 0, 0, 2472,
+    1961, 1621, 5416, 157, 0, 5850, 3470, 0, 7058, 2987, 2689, 2235, 4673, 0, 3852, 251,
+    0, 0, 6225, 2374, 2417, 3812, 2316, 3988, 2985, 0, 256, 2634, 5767, 4897, 4536, 0,
+    0, 4453, 3408, 0, 2734, 0, 0, 0, 0, 2264, 85, 0, 0, 1611, 37, 7043,
+    6251, 4280, 156, 3619, 5986, 2751, 1706, 6826, 7097, 0, 0, 0, 35, 6204, 0, 0,
+    3402, 0, 0, 0, 0, 5590, 6554, 2418, 0, 4970, 4385, 6092, 1616, 4747, 3353, 305,
+    6539, 0, 3221, 0, 6975, 2409, 84, 4492, 5758, 0, 0, 3320, 4772, 0, 0, 0,
+    62, 3412, 3096, 1951, 216, 0, 0, 0, 0, 3308, 6006, 0, 1671, 2512, 2013, 0,
+    0, 4931, 0, 0, 6046, 5947, 1650, 0, 316, 0, 0, 0, 6504, 0, 0, 2567,
+    0, 2899, 0, 3108, 0, 4080, 5370, 0, 3354, 0, 0, 0, 187, 0, 3836, 0,
+    3163, 2897, 4956, 205, 0, 0, 2010, 5931, 5133, 0, 6157, 1972, 0, 0, 0, 0,
+    0, 4060, 0, 4906, 0, 2234, 0, 0, 0, 0, 0, 0, 0, 5701, 0, 0,
+    3162, 0, 0, 227, 3131, 5478, 232, 5584, 2694, 0, 4314, 4628, 3181, 0, 0, 0,
+    0, 0, 0, 0, 0, 3034, 4165, 0, 7023, 0, 0, 0, 1890, 0, 5155, 2151,
+    1765, 1882, 309, 2812, 186, 0, 206, 5056, 3787, 7346, 182, 0, 0, 3396, 0, 5669,
+    0, 0, 0, 0, 2028, 0, 0, 0, 204, 0, 225, 1608, 3220, 0, 0, 3712,
+    3310, 5675, 2684, 0, 0, 0, 0, 0, 3822, 5313, 0, 0, 0, 0, 0, 5541,
+    6194, 0, 0, 0, 0, 0, 0, 0, 5232, 0, 0, 0, 0, 0, 2572, 4271,
+    2405, 2423, 285, 0, 0, 0, 0, 0, 0, 3064, 4939, 3781, 0, 0, 3846, 0,
+    6305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4646, 0, 0, 0, 0, 0,
+    2201, 2236, 4094, 0, 3233, 0, 0, 0, 3777, 0, 3961, 4885, 0, 5343, 0, 0,
+    0, 0, 4053, 5805, 1957, 0, 0, 0, 0, 0, 4010, 3382, 0, 0, 0, 181,
+    4228, 0, 7056, 1640, 229, 3556, 0, 2964, 5030, 132, 4895, 0, 1707, 2824, 2776, 3931,
+    0, 0, 2945, 0, 2655, 0, 4667, 0, 2911, 3197, 0, 3406, 2984, 0, 0, 0,
+    7249, 2608, 2801, 2793, 2960, 4396, 3691, 271, 2359, 2933, 2749, 0, 4882, 172, 0, 3033,
+    5537, 0, 0, 6736, 0, 4658, 0, 1822, 0, 2060, 4438, 1763, 2584, 0, 6102, 60,
+    0, 0, 136, 0, 0, 4381, 0, 0, 267, 6716, 2666, 2110, 1689, 3685, 3936, 0,
+    3155, 0, 6414, 23, 4869, 0, 0, 0, 6266, 0, 3241, 0, 0, 2701, 7256, 5581,
+    2980, 2443, 0, 2680, 7106, 0, 6263, 262, 3102, 0, 6284, 3120, 2936, 0, 0, 312,
+    0, 1683, 1814, 3484, 2636, 0, 2567, 0, 0, 2623, 27, 0, 0, 2876, 1895, 2348,
+    0, 0, 3306, 0, 0, 0, 7222, 3655, 1876, 0, 0, 5834, 4501, 3271, 0, 0,
+    0, 0, 0, 3100, 2471, 2896, 0, 0, 2872, 0, 2857, 207, 0, 4176, 5361, 3464,
+    0, 4801, 5766, 5262, 0, 0, 1761, 2832, 3747, 0, 102, 0, 0, 220, 6049, 5307,
+    2569, 0, 0, 0, 3110, 0, 2650, 0, 0, 0, 4161, 0, 2225, 1943, 0, 0,
+    0, 0, 266, 0, 6999, 307, 0, 5652, 0, 20, 0, 0, 5796, 2501, 0, 1912,
+    3902, 2381, 0, 0, 3118, 5566, 0, 3252, 3010, 0, 5429, 2892, 0, 0, 0, 3890,
+    297, 2848, 151, 4265, 2170, 0, 2149, 0, 1919, 1688, 4222, 201, 0, 6954, 5385, 0,
+    0, 3082, 2558, 1829, 4209, 5561, 204, 2488, 0, 0, 1747, 5090, 241, 0, 0, 7152,
+    1810, 0, 2282, 0, 3218, 0, 2169, 0, 0, 0, 0, 5937, 0, 0, 0, 2219,
+    0, 0, 3768, 4208, 3183, 286, 5347, 3051, 2998, 0, 0, 4682, 0, 4355, 0, 4506,
+    0, 0, 6679, 3648, 118, 2171, 0, 0, 2403, 0, 0, 0, 2856, 0, 48, 4210,
+    0, 5342, 0, 0, 2507, 4924, 0, 0, 0, 2470, 243, 263, 0, 3056, 240, 0,
+    0, 203, 0, 0, 4122, 0, 2338, 0, 0, 0, 3264, 0, 0, 3316, 2272, 0,
+    2210, 4876, 4045, 0, 214, 0, 0, 235, 2930, 3040, 0, 0, 0, 0, 0, 0,
+    4129, 298, 3989, 1623, 0, 6103, 4002, 0, 6353, 147, 292, 2712, 0, 2322, 5142, 0,
+    1690, 3546, 4754, 0, 0, 0, 4880, 4981, 0, 280, 2910, 2104, 3427, 0, 78, 4648,
+    0, 184, 2539, 3988, 7117, 200, 3284, 7068, 3860, 4526, 3185, 5820, 2317, 6597, 189, 0,
+    0, 0, 3627, 3140, 0, 1859, 3031, 0, 2798, 0, 0, 0, 0, 4676, 0, 2374,
+    0, 0, 0, 122, 2376, 3990, 6067, 1885, 5223, 37, 2496, 5967, 3661, 2326, 7102, 3840,
+    3621, 2139, 242, 6830, 4938, 2095, 143, 2666, 1611, 0, 3019, 0, 0, 6556, 0, 0,
+    2548, 0, 0, 7075, 0, 6202, 4296, 2428, 156, 3945, 5990, 5416, 2678, 3085, 2472, 4733,
+    2842, 6220, 5767, 3042, 0, 6052, 0, 1710, 3420, 3240, 2634, 5334, 2407, 3119, 6848, 2734,
+    0, 0, 221, 4453, 3321, 5590, 2982, 2601, 0, 6833, 2633, 0, 0, 283, 5087, 7041,
+    2416, 6511, 4216, 3271, 0, 3076, 0, 4486, 0, 0, 305, 84, 215, 0, 6498, 3362,
+    3400, 0, 3356, 0, 0, 0, 3173, 75, 174, 5213, 0, 6056, 2450, 5662, 2556, 6534,
+    0, 1648, 3249, 0, 0, 1976, 2943, 0, 4492, 6646, 0, 0, 5171, 4833, 3108, 4041,
+    0, 0, 0, 1666, 0, 2697, 5166, 5706, 1941, 0, 3289, 2512, 0, 260, 0, 2012,
+    2309, 4576, 4314, 0, 1600, 0, 3091, 0, 0, 5932, 0, 1780, 0, 5946, 4076, 4613,
+    297, 6066, 0, 0, 0, 0, 5052, 0, 2519, 2894, 3833, 3162, 71, 180, 1888, 244,
+    3790, 0, 7431, 0, 205, 0, 2144, 0, 2953, 0, 209, 6195, 0, 0, 4321, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2812, 0, 2492, 5677, 3046, 3179, 0, 0,
+    5477, 3294, 0, 0, 0, 2682, 1809, 0, 0, 0, 0, 6194, 0, 0, 2270, 0,
+    0, 0, 0, 0, 0, 7020, 13, 0, 3604, 2855, 0, 2150, 0, 0, 0, 3823,
+    1880, 0, 155, 5669, 2622, 0, 0, 0, 0, 6196, 0, 0, 3393, 6477, 6039, 0,
+    5244, 2028, 0, 0, 0, 2468, 240, 0, 2999, 0, 2337, 0, 1641, 3316, 4094, 0,
+    0, 3233, 0, 3143, 3262, 0, 5312, 83, 0, 0, 6471, 219, 0, 4437, 0, 0,
+    0, 0, 0, 0, 0, 0, 4051, 2865, 0, 0, 1640, 3339, 95, 3780, 0, 6068,
+    2212, 0, 5995, 145, 2777, 0, 4939, 3150, 3052, 2710, 4885, 185, 7344, 0, 0, 2018,
+    2758, 0, 3956, 0, 3318, 4646, 2991, 2797, 0, 4101, 0, 5805, 116, 0, 2773, 1642,
+    2359, 0, 2745, 11, 0, 5037, 239, 6457, 3088, 2948, 3383, 0, 0, 0, 2588, 0,
+    4008, 0, 250, 5750, 0, 4661, 2361, 0, 60, 3019, 0, 0, 2611, 2733, 2977, 132,
+    5188, 0, 5032, 2655, 4923, 0, 265, 2349, 3161, 3941, 0, 0, 0, 213, 6303, 0,
+    4667, 317, 4872, 0, 2546, 6732, 140, 6106, 5581, 3197, 2845, 2981, 2793, 7243, 318, 2680,
+    0, 259, 0, 1693, 6416, 0, 2749, 3664, 172, 0, 3033, 0, 0, 3156, 6275, 5319,
+    2638, 4438, 0, 2584, 1763, 0, 3684, 2057, 7228, 2954, 192, 3021, 0, 5418, 63, 0,
+    2967, 2103, 0, 0, 3658, 0, 0, 3776, 0, 0, 0, 27, 2516, 0, 2502, 0,
+    0, 0, 2903, 0, 3073, 7252, 0, 0, 0, 3668, 0, 2538, 4831, 5627, 73, 3253,
+    6257, 0, 5378, 2860, 2129, 0, 0, 0, 2717, 0, 0, 2569, 2757, 3480, 0, 0,
+    211, 0, 2722, 3101, 0, 2475, 0, 2832, 0, 0, 0, 0, 0, 0, 0, 5569,
+    0, 6063, 0, 0, 4495, 5770, 0, 2294, 0, 3902, 0, 5832, 2479, 0, 0, 0,
+    4456, 0, 2893, 0, 0, 0, 4922, 5657, 0, 2822, 0, 0, 0, 0, 2178, 3304,
+    3109, 0, 4263, 1921, 0, 0, 6966, 1758, 0, 1750, 2672, 2389, 0, 209, 3909, 0,
+    0, 5605, 0, 0, 3769, 0, 2834, 0, 0, 0, 0, 0, 0, 0, 2879, 0,
+    1607, 201, 0, 0, 0, 5943, 0, 2491, 0, 1912, 2219, 5572, 2625, 5428, 0, 3238,
+    0, 3768, 3652, 0, 0, 0, 0, 4362, 3117, 3887, 2102, 0, 0, 155, 2172, 12,
+    3770, 3278, 4349, 0, 0, 6365, 0, 4220, 2206, 3080, 0, 6024, 4212, 3547, 48, 0,
+    241, 0, 5561, 0, 5385, 2485, 2505, 0, 245, 0, 0, 0, 2537, 5846, 0, 0,
+    0, 0, 2211, 0, 0, 1624, 0, 0, 2932, 6359, 83, 110, 2249, 0, 0, 4208,
+    0, 3141, 0, 2743, 236, 1678, 0, 0, 0, 0, 4131, 280, 0, 284, 0, 0,
+    0, 0, 4876, 1623, 6232, 3208, 0, 5810, 51, 0, 0, 4043, 0, 4236, 4924, 5980,
+    3216, 124, 231, 0, 0, 7150, 137, 0, 0, 0, 0, 1625, 1612, 2594, 3095, 0,
+    2301, 4122, 5821, 5636, 0, 261, 0, 189, 2614, 5998, 6905, 3086, 4988, 0, 4757, 1866,
+    2347, 0, 0, 0, 235, 1853, 0, 0, 0, 0, 0, 2104, 0, 0, 0, 4000,
+    0, 3992, 5223, 0, 2330, 1754, 0, 3662, 1885, 2494, 5406, 4983, 2378, 6890, 0, 3161,
+    0, 0, 0, 0, 0, 4718, 0, 0, 0, 0, 2539, 0, 0, 0, 0, 6071,
+    5417, 3988, 300, 3856, 2374, 6857, 2678, 259, 0, 3620, 7062, 295, 2844, 4941, 6591, 0,
+    3031, 0, 3151, 3588, 0, 6211, 5334, 0, 1906, 230, 7047, 37, 2369, 4670, 2795, 2767,
+    0, 0, 0, 1896, 6031, 4016, 0, 0, 5087, 5194, 0, 3029, 1743, 6827, 4598, 0,
+    0, 215, 0, 0, 299, 0, 0, 2481, 0, 0, 249, 6555, 6501, 5590, 7071, 0,
+    5373, 5363, 4493, 0, 3251, 2419, 6545, 0, 0, 5174, 5889, 0, 0, 6520, 188, 3573,
+    0, 0, 0, 196, 4041, 3416, 4731, 0, 2556, 0, 5666, 0, 1978, 6007, 4843, 0,
+    320, 0, 0, 1657, 3192, 0, 0, 6832, 2309, 5950, 0, 4585, 0, 5106, 3250, 0,
+    0, 0, 0, 1780, 4850, 0, 0, 0, 4441, 0, 3089, 0, 0, 0, 0, 3355,
+    5450, 0, 6160, 2147, 2163, 0, 0, 4294, 4323, 3831, 0, 1787, 0, 5176, 2766, 0,
+    3243, 0, 1973, 7414, 1840, 0, 0, 5126, 0, 0, 0, 0, 0, 4086, 0, 0,
+    247, 0, 1940, 0, 3231, 0, 5517, 0, 2560, 2492, 0, 3178, 2695, 0, 0, 2152,
+    2270, 4314, 0, 0, 0, 3049, 0, 0, 5276, 4611, 3610, 0, 0, 0, 7027, 0,
+    0, 3608, 0, 2941, 0, 3294, 2093, 7014, 0, 0, 3000, 2415, 6198, 3788, 6481, 2952,
+    0, 2600, 0, 0, 0, 0, 0, 0, 0, 2535, 0, 0, 0, 3391, 0, 0,
+    0, 245, 0, 0, 5985, 0, 0, 5676, 0, 0, 0, 2811, 0, 0, 1603, 0,
+    0, 2746, 0, 0, 3143, 0, 6194, 0, 0, 1676, 0, 0, 4074, 2274, 0, 0,
+    3345, 0, 284, 4103, 0, 1915, 0, 0, 0, 0, 6484, 0, 2405, 0, 6188, 5801,
+    6903, 6389, 0, 312, 3343, 1721, 96, 0, 4094, 0, 6130, 1951, 0, 0, 262, 0,
+    0, 1644, 322, 0, 0, 0, 0, 1610, 0, 2995, 2018, 2804, 7381, 5806, 272, 2218,
+    5983, 6471, 6765, 2761, 0, 0, 3557, 0, 0, 0, 0, 316, 0, 2853, 0, 0,
+    2912, 0, 36, 5750, 0, 2363, 2864, 2733, 2789, 0, 0, 6131, 1640, 0, 167, 5188,
+    0, 5115, 0, 4668, 0, 1604, 95, 3586, 5969, 2580, 4703, 3710, 0, 1634, 6750, 3131,
+    2794, 1970, 279, 5900, 2037, 2991, 0, 0, 2359, 2691, 3176, 162, 4926, 0, 227, 5017,
+    0, 0, 0, 6451, 6335, 4596, 0, 2064, 2638, 0, 5319, 2585, 2340, 3021, 100, 317,
+    0, 197, 4125, 0, 4308, 60, 3513, 0, 89, 5012, 182, 0, 2735, 0, 0, 0,
+    3293, 0, 5031, 0, 4789, 4549, 0, 2659, 2907, 2502, 6300, 3073, 0, 191, 3155, 0,
+    3498, 7262, 67, 3676, 2970, 0, 0, 2106, 3212, 2680, 2780, 6415, 0, 0, 5581, 0,
+    31, 0, 2527, 0, 2541, 5527, 2722, 0, 0, 0, 0, 4846, 5781, 0, 0, 1955,
+    5631, 0, 1963, 2217, 0, 0, 0, 0, 0, 0, 5222, 0, 0, 0, 0, 3656,
+    0, 2294, 0, 0, 0, 211, 0, 0, 0, 0, 0, 0, 0, 2903, 3129, 0,
+    3111, 0, 0, 0, 6730, 0, 0, 0, 0, 0, 0, 6841, 2180, 0, 2674, 258,
+    0, 0, 0, 0, 0, 0, 2569, 1756, 1832, 3911, 0, 5605, 5333, 0, 0, 2832,
+    0, 0, 0, 181, 2724, 0, 0, 0, 3229, 0, 0, 0, 1608, 0, 0, 0,
+    2838, 2491, 3304, 0, 0, 0, 2603, 0, 2956, 3062, 0, 0, 2882, 3902, 5567, 0,
+    0, 0, 0, 0, 0, 3894, 0, 0, 5611, 4352, 0, 3280, 4657, 3881, 5007, 1920,
+    2413, 5854, 2626, 5168, 4877, 1748, 0, 6369, 0, 3067, 0, 5562, 0, 0, 3478, 3772,
+    0, 0, 0, 2045, 0, 0, 2483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    135, 3768, 0, 5571, 5976, 2219, 6686, 0, 0, 5940, 0, 3141, 4868, 236, 0, 195,
+    0, 0, 0, 0, 0, 0, 110, 0, 119, 3649, 3328, 2966, 2434, 0, 6235, 25,
+    4317, 0, 6372, 125, 0, 6763, 2403, 4211, 6081, 0, 0, 1678, 3796, 48, 0, 0,
+    0, 0, 311, 0, 0, 0, 5810, 1627, 4650, 0, 3068, 3306, 229, 0, 0, 0,
+    55, 0, 2974, 6359, 283, 124, 7187, 0, 0, 0, 3195, 0, 6915, 316, 0, 0,
+    2868, 0, 0, 0, 0, 1856, 4130, 296, 2931, 3434, 0, 2615, 1754, 0, 0, 1623,
+    0, 5015, 0, 6038, 6474, 64, 6082, 0, 1961, 5100, 0, 3511, 0, 7147, 0, 280,
+    0, 0, 0, 0, 0, 2225, 15, 0, 5636, 0, 6922, 0, 0, 4680, 3239, 0,
+    3174, 306, 0, 189, 0, 6603, 227, 295, 2080, 2689, 3598, 210, 5554, 4547, 3118, 3130,
+    4460, 0, 0, 2168, 0, 226, 2372, 4097, 3991, 5910, 291, 0, 3868, 1885, 0, 2377,
+    182, 3293, 0, 300, 1772, 0, 0, 2668, 4608, 0, 6888, 4982, 0, 1874, 1715, 4711,
+    2481, 0, 0, 3184, 0, 0, 0, 0, 7081, 4900, 3283, 0, 0, 2886, 3218, 1900,
+    7360, 0, 0, 2843, 0, 0, 2678, 0, 6852, 0, 5334, 0, 0, 6528, 0, 0,
+    5749, 0, 1906, 2677, 4737, 0, 0, 2567, 2624, 0, 0, 5187, 0, 0, 0, 2835,
+    2215, 3274, 0, 0, 2138, 6837, 3311, 0, 0, 0, 4862, 0, 0, 0, 0, 215,
+    0, 0, 0, 6499, 0, 0, 0, 0, 5373, 2470, 0, 3008, 2996, 0, 3055, 5453,
+    214, 5128, 5109, 3854, 2165, 0, 0, 0, 4041, 5318, 0, 2153, 0, 6153, 3250, 1789,
+    219, 0, 290, 0, 2556, 0, 4837, 0, 1971, 3041, 0, 2237, 181, 0, 0, 0,
+    3290, 0, 0, 303, 3987, 4972, 4580, 3190, 5507, 3244, 0, 288, 2309, 0, 0, 1780,
+    4974, 0, 0, 2754, 3051, 4617, 4090, 247, 0, 0, 275, 0, 0, 2152, 0, 0,
+    7017, 5281, 4291, 0, 2154, 0, 1840, 4322, 4248, 2813, 107, 0, 2765, 0, 3611, 1708,
+    4710, 0, 204, 0, 0, 52, 2941, 3414, 0, 1605, 3000, 0, 0, 2030, 0, 0,
+    3002, 0, 0, 3223, 133, 0, 2492, 268, 0, 6798, 2469, 0, 2270, 0, 0, 0,
+    213, 0, 2920, 0, 0, 0, 4866, 0, 2336, 0, 5186, 0, 3605, 0, 0, 0,
+    6191, 190, 0, 0, 0, 6805, 6039, 5985, 292, 2842, 6197, 6478, 2278, 318, 2087, 3905,
+    3558, 0, 0, 0, 0, 3346, 0, 1676, 0, 0, 0, 0, 5801, 302, 223, 0,
+    0, 0, 6138, 2808, 0, 0, 0, 4482, 0, 6472, 5317, 4562, 0, 2074, 6775, 3557,
+    0, 3143, 2988, 0, 4071, 2653, 0, 0, 0, 0, 0, 2912, 0, 0, 4102, 0,
+    4028, 2440, 0, 6023, 120, 36, 0, 0, 3559, 220, 3249, 2853, 6362, 5159, 0, 2914,
+    1721, 3340, 1637, 1643, 3714, 2018, 2710, 2117, 1970, 4810, 2078, 173, 3318, 277, 7348, 6483,
+    2992, 2804, 3732, 167, 6782, 2691, 7376, 7314, 3239, 0, 0, 3286, 2580, 3088, 5973, 6463,
+    256, 1766, 3009, 2040, 260, 4427, 5539, 5861, 4559, 0, 2643, 0, 4563, 3523, 5750, 3118,
+    221, 2159, 2666, 2733, 2292, 2141, 92, 3717, 100, 2515, 39, 7356, 2362, 6748, 6110, 0,
+    0, 4206, 4791, 0, 6307, 2341, 3106, 191, 0, 180, 0, 2889, 2593, 3074, 6294, 3241,
+    2783, 0, 2739, 0, 3176, 5024, 0, 2458, 0, 0, 5598, 2662, 7166, 0, 3120, 0,
+    3044, 3496, 5783, 2554, 3021, 2638, 5319, 6330, 3530, 3157, 246, 1959, 212, 0, 0, 4308,
+    0, 0, 3271, 0, 0, 0, 2530, 2855, 0, 0, 1909, 0, 3601, 5010, 4226, 0,
+    2468, 2904, 0, 0, 0, 2502, 4512, 0, 3111, 3073, 3053, 0, 0, 5225, 0, 0,
+    3672, 0, 0, 5756, 0, 0, 0, 6022, 0, 170, 214, 0, 0, 0, 0, 3169,
+    0, 0, 0, 2946, 0, 0, 81, 0, 2865, 2930, 2722, 0, 0, 0, 0, 0,
+    3112, 5375, 0, 1945, 0, 0, 0, 0, 0, 3986, 0, 5613, 2358, 2207, 2294, 0,
+    0, 0, 2769, 0, 0, 0, 4370, 6104, 0, 0, 0, 0, 0, 2728, 3336, 293,
+    6727, 11, 0, 0, 0, 0, 297, 111, 5854, 0, 264, 0, 3884, 3910, 0, 5546,
+    1832, 6401, 2604, 0, 0, 4701, 5605, 2592, 1691, 2957, 0, 6273, 250, 0, 0, 4657,
+    1812, 0, 0, 0, 0, 0, 0, 5856, 5180, 0, 0, 0, 2491, 0, 0, 2997,
+    6686, 0, 0, 5713, 0, 0, 5575, 0, 6267, 2336, 0, 0, 1843, 0, 0, 169,
+    2778, 0, 5004, 3227, 2657, 135, 4350, 3279, 6366, 5976, 3647, 0, 6693, 0, 0, 0,
+    2045, 4868, 3771, 3070, 0, 2842, 6024, 0, 1783, 158, 0, 2858, 0, 0, 2473, 3475,
+    3150, 0, 4150, 2525, 3329, 2976, 2338, 0, 0, 3316, 240, 6089, 3265, 0, 0, 0,
+    0, 3141, 6360, 0, 0, 0, 4527, 2744, 236, 0, 0, 0, 2787, 4454, 0, 0,
+    0, 2869, 3434, 0, 5626, 0, 0, 177, 6233, 2975, 249, 6115, 6371, 2425, 0, 0,
+    1677, 149, 0, 7154, 3249, 0, 5144, 0, 0, 1961, 0, 3441, 4761, 2909, 0, 2736,
+    0, 0, 2594, 3086, 4650, 1626, 124, 4684, 0, 5637, 0, 3284, 2689, 260, 4490, 3195,
+    0, 6909, 4918, 2382, 16, 4528, 6492, 1724, 5554, 6042, 7182, 1854, 0, 0, 0, 0,
+    0, 1754, 2822, 4687, 0, 0, 3164, 3084, 3019, 289, 5918, 2513, 0, 306, 0, 0,
+    0, 7162, 0, 0, 2139, 1718, 2086, 180, 2953, 0, 6894, 3767, 2888, 0, 0, 218,
+    0, 0, 6611, 0, 0, 2550, 0, 5593, 1776, 3042, 0, 0, 7372, 0, 6918, 3174,
+    1728, 0, 5117, 0, 5583, 4714, 0, 3592, 0, 0, 0, 0, 3172, 0, 2567, 0,
+    255, 0, 1907, 0, 3868, 2887, 0, 2370, 0, 2601, 5482, 0, 321, 2725, 2624, 2506,
+    0, 0, 0, 2641, 0, 4602, 5753, 6351, 0, 0, 0, 0, 2481, 0, 4460, 0,
+    0, 2468, 0, 0, 1622, 5190, 5374, 0, 0, 0, 0, 0, 76, 2809, 5670, 0,
+    4311, 0, 0, 0, 6524, 0, 0, 2242, 0, 0, 0, 0, 3107, 0, 2821, 4755,
+    2571, 0, 1788, 0, 2240, 0, 0, 0, 4270, 2743, 0, 248, 5151, 5737, 2865, 0,
+    0, 1712, 3288, 0, 2205, 0, 294, 50, 7091, 4571, 4856, 301, 0, 0, 3326, 1877,
+    0, 0, 0, 0, 1841, 0, 3808, 6069, 109, 0, 4298, 5451, 2155, 209, 0, 0,
+    3851, 2085, 3007, 0, 0, 4285, 0, 4975, 204, 7420, 11, 2813, 0, 2204, 2590, 2143,
+    0, 2754, 3004, 250, 0, 0, 0, 0, 0, 0, 2815, 0, 3225, 0, 5802, 0,
+    0, 0, 0, 2495, 108, 1606, 0, 6209, 0, 1835, 0, 0, 0, 0, 0, 6203,
+    0, 0, 3045, 0, 0, 4246, 0, 0, 4969, 0, 0, 0, 133, 13, 6807, 7015,
+    3000, 0, 3603, 2185, 155, 2702, 0, 4866, 3206, 3567, 4887, 0, 0, 4665, 0, 0,
+    0, 0, 0, 1821, 3411, 83, 2030, 5884, 0, 0, 0, 0, 4005, 0, 61, 2790,
+    2284, 1655, 0, 0, 6798, 0, 3104, 0, 0, 4886, 0, 2935, 2581, 0, 1698, 0,
+    0, 0, 4078, 2048, 0, 4439, 0, 0, 0, 0, 2919, 0, 6488, 2800, 0, 4065,
+    2074, 6189, 1649, 0, 3561, 7218, 5159, 5362, 0, 0, 5054, 3205, 2087, 196, 0, 1722,
+    0, 2916, 4813, 3338, 0, 2988, 2805, 0, 5539, 0, 0, 173, 0, 320, 0, 6118,
+    6027, 6380, 3187, 6769, 0, 7387, 0, 5105, 3557, 3741, 0, 4565, 4481, 3039, 4817, 0,
+    0, 0, 0, 0, 0, 0, 6132, 0, 2912, 4653, 2433, 202, 5442, 4026, 1889, 0,
+    2352, 228, 36, 2766, 0, 5250, 2141, 6754, 2124, 6241, 1970, 2714, 2666, 258, 5869, 2119,
+    3711, 0, 2833, 1635, 0, 2971, 2559, 2847, 0, 3241, 0, 1742, 2639, 163, 6121, 5481,
+    43, 0, 7308, 103, 7178, 2683, 32, 2691, 3120, 6341, 0, 6778, 5825, 6297, 3044, 5102,
+    256, 0, 3601, 2597, 0, 0, 0, 4309, 1766, 6316, 2514, 0, 0, 2093, 90, 3517,
+    5602, 5433, 0, 1913, 0, 0, 7288, 4226, 4521, 3271, 4790, 5251, 3716, 212, 3778, 4553,
+    2535, 0, 5089, 0, 191, 0, 0, 3871, 0, 3502, 0, 0, 0, 4463, 5020, 0,
+    168, 0, 3256, 0, 0, 0, 0, 0, 0, 0, 0, 5386, 2950, 2227, 2273, 0,
+    195, 4052, 2759, 0, 1956, 3526, 5782, 0, 0, 0, 0, 3113, 0, 1948, 0, 0,
+    0, 1601, 0, 0, 0, 49, 4217, 0, 0, 0, 0, 0, 0, 3011, 3336, 0,
+    0, 3930, 297, 237, 0, 0, 2883, 269, 0, 2432, 0, 0, 0, 0, 0, 0,
+    0, 0, 6734, 0, 1695, 270, 0, 0, 2770, 5977, 1833, 4392, 2083, 6721, 4467, 0,
+    0, 0, 0, 0, 0, 0, 0, 6277, 0, 4123, 0, 0, 0, 1812, 0, 0,
+    3260, 0, 0, 0, 0, 0, 0, 0, 5858, 0, 5612, 0, 0, 2810, 0, 1604,
+    0, 0, 0, 5968, 0, 3426, 3682, 2036, 0, 0, 0, 0, 0, 7254, 0, 0,
+    0, 98, 5003, 0, 0, 6695, 2862, 3882, 0, 0, 3266, 6280, 3670, 6399, 2700, 5854,
+    0, 0, 0, 251, 0, 4656, 3482, 5773, 3550, 2477, 2046, 0, 0, 240, 5849, 245,
+    217, 2985, 2923, 0, 3997, 2338, 0, 322, 3265, 3469, 0, 0, 3227, 199, 4535, 6686,
+    3069, 3443, 0, 0, 6267, 0, 0, 4458, 0, 0, 2033, 1679, 0, 4647, 0, 0,
+    0, 0, 2579, 0, 284, 2434, 5811, 6376, 0, 149, 4172, 4867, 0, 2788, 5144, 7037,
+    0, 0, 0, 0, 40, 1953, 6561, 2020, 0, 0, 2578, 0, 5626, 0, 4651, 4764,
+    0, 320, 279, 0, 0, 1615, 4150, 3185, 0, 4530, 5836, 0, 310, 7193, 5096, 6013,
+    4953, 0, 0, 3129, 4768, 0, 3434, 0, 0, 0, 0, 0, 0, 4696, 0, 0,
+    3019, 0, 0, 2393, 6801, 4264, 5407, 0, 0, 6083, 197, 0, 2139, 5235, 0, 4948,
+    5201, 1961, 0, 0, 2550, 0, 0, 6000, 0, 0, 0, 0, 2723, 2557, 0, 4725,
+    0, 2897, 3305, 4681, 1942, 6928, 3229, 5432, 0, 2689, 0, 2089, 0, 0, 1736, 2382,
+    0, 4912, 3042, 2955, 0, 5554, 5346, 0, 0, 0, 218, 0, 0, 2688, 0, 3869,
+    0, 5587, 4461, 2601, 5488, 253, 3296, 232, 5158, 0, 4315, 0, 0, 0, 5202, 6351,
+    0, 0, 0, 1716, 0, 0, 0, 2506, 3066, 278, 1605, 0, 2484, 0, 3037, 0,
+    0, 5673, 1769, 5593, 0, 0, 76, 0, 0, 0, 0, 7366, 0, 0, 0, 3725,
+    0, 0, 3312, 0, 4759, 0, 0, 2271, 0, 0, 0, 2567, 4044, 0, 222, 0,
+    0, 0, 2624, 1985, 0, 0, 25, 5681, 3822, 0, 0, 0, 0, 123, 0, 2321,
+    2575, 0, 0, 6074, 3785, 0, 4274, 0, 0, 7113, 248, 0, 3062, 0, 0, 3326,
+    0, 0, 0, 3217, 0, 0, 0, 4288, 0, 0, 4943, 2423, 50, 223, 5449, 3858,
+    0, 2820, 0, 0, 3845, 0, 0, 209, 0, 0, 6213, 0, 0, 0, 0, 0,
+    0, 2238, 0, 2495, 0, 0, 0, 0, 2817, 3234, 0, 4095, 0, 0, 4225, 5510,
+    0, 0, 119, 0, 0, 0, 0, 1604, 3382, 5966, 0, 0, 0, 0, 0, 2027,
+    0, 0, 4673, 7073, 0, 2813, 2964, 13, 3198, 0, 0, 108, 1709, 4968, 4252, 3618,
+    3570, 0, 3806, 4373, 2075, 6216, 6522, 5758, 0, 204, 2031, 3418, 0, 0, 0, 5272,
+    5887, 2417, 0, 0, 210, 0, 224, 3405, 1659, 271, 0, 3003, 0, 194, 2702, 0,
+    5537, 0, 5986, 0, 4931, 83, 0, 0, 0, 3145, 2938, 0, 6203, 0, 4443, 2748,
+    0, 0, 1825, 4068, 61, 0, 2886, 0, 6806, 4377, 178, 4889, 1699, 0, 296, 3353,
+    0, 0, 2408, 0, 0, 4951, 0, 0, 0, 6270, 6421, 0, 6151, 0, 1951, 0,
+    0, 2800, 0, 0, 0, 0, 1811, 0, 0, 5443, 2215, 0, 0, 3308, 1662, 0,
+    0, 5071, 4032, 0, 0, 316, 4886, 0, 0, 0, 3129, 0, 0, 2876, 4825, 0,
+    226, 0, 5105, 2355, 1876, 0, 0, 6689, 5442, 1649, 4153, 0, 3832, 0, 0, 0,
+    186, 0, 2151, 3210, 0, 0, 0, 0, 0, 233, 4811, 259, 290, 5051, 3161, 2915,
+    225, 0, 193, 3560, 2648, 2234, 2437, 3187, 3286, 2850, 2687, 2784, 4564, 7320, 6788, 5307,
+    227, 2663, 5257, 0, 2635, 275, 3736, 3131, 0, 2833, 3035, 0, 5539, 6324, 0, 0,
+    0, 1767, 0, 0, 0, 4966, 4157, 182, 0, 0, 6111, 5439, 2531, 1889, 0, 1917,
+    5252, 148, 5143, 3903, 3293, 3272, 3778, 2942, 0, 2118, 0, 3721, 3392, 3437, 264, 3064,
+    0, 107, 0, 7327, 6295, 319, 273, 0, 0, 0, 0, 0, 0, 1926, 3220, 0,
+    0, 2683, 7172, 2996, 3120, 0, 268, 5092, 0, 2920, 2763, 0, 0, 5389, 3536, 0,
+    3601, 1810, 6619, 0, 0, 0, 2282, 2639, 0, 2220, 2965, 5230, 0, 24, 1954, 0,
+    0, 0, 0, 0, 2273, 121, 4226, 3271, 3556, 0, 4516, 0, 1745, 0, 0, 2824,
+    4475, 0, 0, 0, 0, 0, 2911, 2549, 0, 0, 2195, 0, 0, 0, 0, 6682,
+    5341, 4928, 3952, 49, 0, 2974, 6724, 2933, 2947, 269, 3060, 0, 0, 3012, 2647, 0,
+    0, 0, 0, 0, 208, 4127, 0, 0, 0, 1946, 4052, 181, 0, 0, 0, 0,
+    0, 3682, 0, 0, 0, 0, 4136, 0, 4371, 0, 0, 3336, 0, 6350, 2110, 179,
+    0, 0, 0, 0, 2712, 0, 6105, 0, 2908, 4658, 3930, 2108, 0, 297, 7239, 5142,
+    4391, 3430, 0, 1692, 6405, 3689, 3196, 5968, 0, 210, 2073, 3553, 2036, 4427, 6274, 0,
+    2543, 0, 0, 0, 1680, 5857, 3472, 5852, 0, 1812, 245, 0, 0, 0, 291, 7094,
+    0, 2348, 136, 2700, 0, 0, 38, 0, 2798, 0, 0, 0, 5774, 0, 6268, 0,
+    5224, 4498, 4538, 1679, 2072, 0, 0, 284, 2924, 3667, 2886, 217, 0, 0, 0, 207,
+    5811, 2859, 6694, 0, 6253, 7098, 2986, 0, 0, 0, 0, 6279, 0, 0, 6570, 0,
+    2548, 1953, 6206, 246, 0, 2474, 4647, 0, 240, 0, 0, 1681, 5813, 0, 0, 1618,
+    4151, 277, 3265, 3316, 5408, 2338, 0, 3306, 5335, 0, 0, 6980, 4499, 2411, 0, 4776,
+    0, 62, 0, 4455, 0, 0, 2578, 2023, 0, 2633, 0, 3008, 0, 4171, 310, 5407,
+    3252, 304, 149, 0, 5096, 1757, 0, 0, 4216, 6046, 2149, 6506, 220, 0, 0, 0,
+    0, 0, 4727, 290, 3442, 4762, 0, 75, 0, 0, 0, 2225, 0, 5370, 3106, 0,
+    3284, 6668, 2998, 3185, 4529, 3239, 2010, 2383, 1652, 5208, 0, 0, 0, 0, 4960, 5931,
+    0, 3118, 0, 275, 3282, 3010, 4446, 0, 3183, 4691, 2898, 0, 0, 2767, 2723, 3019,
+    2310, 2392, 4264, 4319, 0, 0, 5203, 1688, 2170, 1781, 4701, 0, 0, 107, 4946, 4633,
+    2511, 1892, 0, 2484, 0, 0, 0, 4209, 6615, 0, 0, 0, 5594, 3025, 263, 0,
+    3218, 5746, 5161, 0, 4328, 0, 0, 0, 3040, 0, 206, 0, 5690, 0, 1732, 268,
+    5060, 0, 0, 1809, 0, 5346, 2920, 0, 5687, 0, 0, 2955, 1987, 0, 2778, 2601,
+    5485, 0, 0, 0, 0, 2685, 2856, 0, 0, 2271, 0, 6351, 0, 298, 0, 0,
+    2910, 2506, 0, 0, 3546, 0, 0, 2657, 0, 0, 2470, 0, 3826, 3056, 0, 2525,
+    6075, 0, 5671, 0, 0, 0, 0, 5765, 0, 0, 76, 2787, 3848, 2645, 1602, 0,
+    4756, 6040, 0, 0, 0, 0, 2930, 0, 0, 4044, 214, 0, 4099, 177, 0, 5529,
+    0, 2009, 0, 3236, 2236, 0, 0, 0, 0, 2500, 2375, 3989, 3777, 0, 7092, 2321,
+    0, 0, 0, 4055, 3618, 0, 2095, 0, 3326, 4108, 0, 0, 6070, 0, 0, 0,
+    7112, 4712, 1707, 4229, 0, 0, 2777, 4940, 4286, 3812, 5987, 5911, 0, 3386, 5966, 4897,
+    4426, 185, 1611, 3933, 2027, 0, 6210, 7058, 4673, 0, 0, 4674, 3625, 0, 0, 3408,
+    0, 2816, 0, 0, 6826, 3198, 0, 0, 4400, 0, 2523, 0, 3222, 2404, 2495, 4483,
+    289, 2336, 3149, 209, 6204, 5759, 0, 156, 2751, 0, 0, 0, 0, 0, 0, 0,
+    5189, 6051, 0, 13, 0, 0, 2963, 3353, 4932, 4385, 155, 5582, 0, 2842, 5988, 3937,
+    2447, 3568, 194, 6215, 6519, 2546, 6430, 23, 0, 1951, 0, 0, 0, 246, 0, 5885,
+    2701, 1895, 4569, 2980, 0, 3360, 171, 178, 6167, 1656, 321, 2936, 83, 6504, 6288, 0,
+    5320, 0, 0, 2636, 3145, 0, 0, 4484, 160, 1815, 0, 4440, 0, 0, 0, 0,
+    3776, 0, 0, 0, 0, 0, 2821, 1650, 4066, 0, 4888, 2516, 2448, 0, 0, 5662,
+    3249, 2943, 3162, 0, 7412, 0, 0, 0, 0, 88, 73, 1972, 3100, 0, 2234, 2570,
+    4180, 1886, 227, 1661, 0, 5701, 0, 5361, 2694, 3182, 4821, 104, 0, 2812, 3131, 3032,
+    0, 0, 5066, 3090, 193, 0, 0, 0, 0, 0, 0, 0, 2651, 0, 0, 4165,
+    0, 0, 180, 5442, 1890, 0, 2517, 182, 2295, 2679, 2875, 3832, 0, 255, 5056, 3293,
+    0, 2755, 270, 0, 0, 6066, 0, 0, 2892, 2353, 2590, 3907, 6195, 0, 0, 0,
+    6124, 259, 2848, 3220, 3916, 0, 4267, 1935, 5237, 2684, 0, 5146, 0, 0, 152, 0,
+    2558, 5606, 2809, 1829, 0, 3035, 5641, 0, 0, 0, 6320, 0, 0, 0, 0, 0,
+    0, 2176, 2223, 5436, 4966, 0, 2656, 5232, 1914, 0, 0, 2625, 198, 0, 0, 0,
+    4885, 2855, 0, 3778, 0, 0, 0, 2670, 5348, 4507, 3392, 0, 2468, 1820, 0, 0,
+    5240, 0, 4357, 2524, 0, 0, 0, 0, 274, 0, 0, 6025, 5756, 1641, 0, 0,
+    0, 5387, 2825, 0, 199, 5343, 2745, 2509, 2760, 3099, 0, 2552, 243, 0, 4437, 4053,
+    0, 0, 0, 254, 0, 177, 0, 0, 2007, 131, 0, 2360, 181, 0, 285, 4342,
+    5030, 2210, 0, 0, 0, 0, 3931, 0, 0, 2534, 4145, 0, 0, 0, 4047, 4471,
+    6722, 3208, 0, 0, 0, 4658, 0, 0, 0, 114, 6354, 4396, 0, 6103, 0, 4925,
+    5862, 3951, 137, 0, 1690, 4882, 11, 3691, 2111, 0, 0, 0, 0, 0, 4870, 2595,
+    4124, 79, 0, 250, 0, 0, 2614, 4659, 200, 0, 0, 5820, 3196, 0, 136, 4648,
+    7121, 0, 1861, 6230, 0, 0, 2967, 0, 0, 0, 0, 3682, 27, 4869, 0, 0,
+    0, 7237, 5227, 0, 6284, 7106, 3674, 0, 38, 0, 2105, 138, 0, 0, 0, 5967,
+    3661, 5097, 2799, 3551, 1683, 242, 2498, 0, 0, 2072, 0, 2540, 0, 6884, 0, 0,
+    0, 4536, 0, 3470, 1846, 5815, 0, 0, 2472, 2986, 321, 5416, 63, 245, 5850, 0,
+    0, 0, 0, 5338, 0, 5767, 6224, 0, 0, 0, 6054, 5088, 2634, 0, 1679, 4501,
+    0, 3029, 0, 0, 0, 4176, 4453, 0, 284, 5627, 2734, 1743, 5811, 0, 0, 0,
+    0, 0, 5378, 6516, 0, 0, 1953, 220, 202, 6565, 305, 2757, 0, 6251, 2416, 3576,
+    2225, 0, 4772, 183, 2568, 0, 0, 0, 2367, 1616, 6057, 0, 6538, 5652, 2879, 1601,
+    0, 0, 0, 0, 4492, 3239, 0, 6016, 5566, 5934, 0, 3118, 201, 1981, 0, 6974,
+    315, 4265, 0, 0, 0, 0, 0, 2822, 2013, 2512, 2170, 0, 2396, 0, 5407, 2313,
+    1757, 1688, 1785, 2083, 1670, 5947, 0, 4209, 3093, 5326, 0, 0, 0, 2489, 0, 6954,
+    307, 0, 2898, 4726, 3769, 2834, 1794, 0, 0, 0, 4337, 0, 0, 3835, 0, 3218,
+    0, 5132, 0, 4956, 0, 0, 0, 7436, 0, 0, 205, 0, 2503, 0, 0, 5347,
+    0, 0, 0, 0, 4355, 0, 0, 0, 0, 2856, 3122, 2767, 0, 0, 3180, 98,
+    0, 4316, 0, 3264, 2161, 0, 3610, 0, 0, 0, 0, 3648, 0, 2507, 4876, 4627,
+    2484, 2470, 1624, 5120, 4233, 1819, 7022, 0, 0, 0, 0, 0, 3228, 0, 2415, 5765,
+    224, 0, 0, 3056, 0, 0, 0, 0, 214, 0, 0, 0, 0, 2249, 3395, 2301,
+    3097, 2930, 5684, 2028, 0, 0, 0, 4045, 0, 6799, 2743, 0, 0, 0, 0, 1986,
+    0, 0, 0, 3989, 2375, 0, 1602, 2322, 3260, 0, 0, 251, 51, 0, 4981, 4234,
+    3345, 0, 0, 0, 0, 0, 4117, 0, 3846, 0, 2019, 0, 0, 0, 0, 6068,
+    6920, 1730, 96, 7117, 203, 0, 3781, 3319, 4939, 3627, 2096, 5995, 4716, 1859, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4676, 4096, 0, 2336, 4646, 0, 5922, 272, 0,
+    0, 0, 5805, 0, 0, 0, 3960, 2496, 0, 4013, 0, 5194, 0, 6186, 0, 6031,
+    0, 3618, 0, 0, 0, 6848, 0, 0, 0, 5192, 0, 2897, 4673, 0, 0, 0,
+    2776, 2644, 2417, 2404, 5911, 7056, 0, 3945, 2842, 2703, 4895, 6220, 6744, 6526, 3142, 2655,
+    4573, 4667, 2982, 0, 0, 0, 0, 0, 0, 5582, 0, 3362, 3406, 3197, 0, 5663,
+    232, 0, 2793, 0, 1896, 3033, 4014, 2455, 5323, 5986, 6826, 172, 2749, 143, 4486, 3146,
+    0, 0, 5086, 0, 5662, 0, 0, 0, 6152, 6425, 1763, 1632, 2059, 0, 0, 4438,
+    4381, 3685, 0, 0, 6534, 5363, 160, 3353, 0, 7273, 319, 0, 2584, 2943, 238, 5171,
+    0, 0, 196, 0, 4833, 0, 0, 0, 1951, 4576, 1666, 5664, 0, 0, 3308, 0,
+    0, 1601, 320, 5527, 88, 2698, 260, 1940, 0, 3492, 7445, 0, 0, 5106, 316, 0,
+    2570, 1966, 0, 3102, 2953, 0, 0, 0, 1886, 2423, 0, 0, 0, 0, 0, 1972,
+    0, 2298, 3833, 0, 3175, 180, 2519, 3294, 174, 0, 0, 6156, 0, 2144, 0, 253,
+    0, 0, 0, 6195, 0, 0, 0, 2894, 4086, 2234, 0, 0, 2560, 5271, 276, 0,
+    1760, 3925, 3179, 3231, 0, 2694, 0, 227, 0, 5609, 0, 3131, 0, 0, 0, 0,
+    0, 5617, 0, 3381, 0, 0, 0, 0, 3046, 3904, 0, 7020, 4161, 0, 0, 0,
+    1912, 97, 0, 3604, 0, 182, 2855, 222, 3293, 0, 0, 3262, 3166, 2956, 2603, 6477,
+    0, 0, 0, 6386, 3393, 0, 0, 0, 3889, 4367, 251, 0, 5244, 0, 2468, 1930,
+    2629, 0, 271, 2413, 5756, 1641, 0, 2673, 0, 0, 0, 2985, 0, 0, 0, 3071,
+    1820, 5385, 4819, 0, 0, 0, 0, 4437, 241, 2865, 0, 2274, 0, 0, 0, 0,
+    0, 2360, 0, 0, 0, 2169, 6687, 2487, 0, 0, 0, 3874, 0, 2221, 2212, 0,
+    6387, 0, 4208, 3339, 0, 6130, 2435, 0, 0, 0, 0, 0, 0, 0, 0, 3328,
+    0, 6780, 2017, 2977, 0, 129, 0, 0, 116, 11, 3317, 0, 3956, 5037, 0, 5980,
+    0, 5342, 0, 59, 4924, 0, 0, 0, 6318, 0, 2876, 250, 181, 4661, 0, 0,
+    2868, 0, 0, 0, 4122, 5823, 5873, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2037, 4140, 0, 2780, 1604, 140, 5969, 235, 0, 2659, 0, 2618, 1871, 0, 0, 311,
+    0, 2897, 4658, 5022, 3664, 0, 7243, 64, 3435, 5307, 2104, 0, 5862, 2968, 3690, 0,
+    28, 15, 4880, 4872, 0, 0, 239, 0, 0, 2057, 0, 0, 5379, 0, 3528, 5780,
+    0, 136, 0, 0, 5418, 63, 5628, 232, 2799, 2735, 0, 2374, 0, 2539, 3988, 5555,
+    0, 0, 0, 3031, 0, 0, 0, 0, 0, 0, 4869, 211, 4469, 2168, 0, 0,
+    37, 0, 65, 0, 0, 0, 5627, 0, 0, 1874, 7102, 5378, 2668, 6257, 0, 6829,
+    5088, 0, 3621, 0, 2757, 1682, 233, 0, 4902, 0, 0, 183, 6556, 0, 0, 206,
+    5629, 0, 2282, 2217, 0, 0, 3306, 5814, 1753, 1609, 4495, 2420, 0, 0, 5336, 0,
+    0, 6986, 0, 2677, 0, 0, 0, 3304, 4922, 4500, 0, 0, 2568, 3129, 2835, 0,
+    313, 308, 2880, 0, 4261, 0, 0, 0, 0, 0, 1758, 0, 0, 6047, 6833, 5953,
+    6510, 3769, 220, 3055, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2834, 2626,
+    2225, 3356, 0, 0, 0, 0, 0, 2724, 1803, 0, 0, 273, 3229, 0, 6993, 6163,
+    0, 5138, 1975, 2206, 0, 3118, 5932, 0, 0, 1782, 5566, 2480, 2836, 0, 0, 3010,
+    3887, 3987, 0, 110, 0, 147, 2311, 0, 0, 307, 5519, 288, 1688, 2712, 2102, 2964,
+    4974, 0, 5166, 0, 4639, 281, 6365, 0, 4209, 0, 5810, 2485, 0, 1678, 2537, 3067,
+    2503, 4314, 0, 7032, 3793, 0, 0, 0, 0, 271, 0, 3614, 0, 4332, 1624, 0,
+    2249, 2798, 1607, 52, 0, 2743, 3216, 1819, 4770, 4242, 0, 2931, 25, 0, 0, 0,
+    0, 0, 0, 2966, 0, 0, 3648, 0, 0, 6803, 0, 0, 0, 2856, 2302, 2615,
+    6081, 0, 125, 0, 3056, 51, 0, 0, 4236, 6194, 3794, 2507, 0, 0, 0, 2470,
+    0, 0, 6041, 23, 0, 6812, 0, 0, 5406, 0, 0, 5765, 190, 0, 0, 2091,
+    53, 2974, 2699, 0, 0, 214, 2876, 6905, 2930, 0, 0, 0, 3349, 4988, 0, 146,
+    0, 2019, 2633, 0, 5808, 0, 0, 0, 3076, 3319, 4094, 1875, 203, 2405, 0, 0,
+    2375, 0, 6471, 3989, 0, 300, 0, 295, 0, 0, 0, 0, 4981, 0, 4112, 5306,
+    0, 1897, 0, 0, 75, 0, 0, 0, 3095, 5160, 0, 1640, 6032, 5912, 4022, 7062,
+    5195, 1727, 0, 4713, 3626, 0, 2703, 6591, 7343, 3588, 210, 95, 0, 4670, 261, 0,
+    5921, 4675, 0, 0, 5902, 0, 2644, 0, 0, 291, 2843, 0, 0, 4016, 1896, 2795,
+    4598, 5364, 1772, 0, 3142, 2336, 5540, 2705, 0, 0, 0, 2359, 0, 2587, 0, 0,
+    2496, 0, 2069, 3022, 3941, 0, 2159, 0, 60, 1898, 2886, 0, 6827, 5989, 0, 0,
+    7282, 0, 0, 6847, 5363, 2842, 5086, 5107, 143, 5032, 304, 3193, 4206, 196, 3250, 6302,
+    175, 1809, 0, 0, 5666, 2981, 2281, 3155, 0, 6416, 164, 0, 3361, 2215, 5455, 2680,
+    0, 4485, 5321, 0, 0, 0, 5106, 0, 6170, 74, 0, 0, 3087, 4850, 4570, 0,
+    0, 0, 0, 0, 4087, 0, 3821, 2561, 0, 5662, 4227, 91, 0, 5450, 4429, 3008,
+    2766, 0, 2690, 5108, 0, 2449, 1973, 274, 0, 2153, 5274, 3053, 2943, 0, 2645, 3115,
+    0, 282, 4831, 0, 2560, 290, 4086, 170, 0, 174, 0, 243, 0, 3289, 3231, 0,
+    0, 2695, 260, 3001, 0, 287, 0, 5286, 0, 3050, 0, 0, 0, 2832, 4575, 5985,
+    4088, 0, 0, 0, 6066, 0, 2518, 5623, 2093, 275, 0, 2711, 2777, 3986, 2296, 145,
+    2953, 107, 4379, 0, 3902, 2275, 180, 2769, 4710, 3381, 0, 0, 0, 5276, 185, 6195,
+    2535, 2893, 0, 0, 0, 0, 0, 1676, 2959, 0, 0, 0, 0, 3899, 3920, 71,
+    200, 1921, 0, 0, 0, 3168, 5607, 2523, 2607, 5748, 0, 2274, 268, 3154, 6395, 0,
+    5801, 0, 1813, 4482, 0, 5186, 0, 0, 0, 0, 0, 0, 2920, 0, 3604, 0,
+    6691, 3298, 0, 0, 0, 2855, 0, 2589, 2219, 2276, 0, 2440, 169, 6389, 6477, 3558,
+    3768, 2546, 0, 4361, 2468, 0, 0, 0, 2913, 158, 0, 2172, 6700, 3651, 0, 242,
+    167, 6026, 5756, 0, 2789, 1641, 48, 4212, 2403, 5317, 6136, 0, 0, 1603, 0, 4816,
+    0, 6765, 5970, 2649, 86, 2580, 4437, 2865, 0, 3317, 4159, 2017, 0, 3332, 0, 0,
+    2732, 0, 0, 0, 2633, 0, 2515, 2360, 0, 3339, 6359, 2211, 0, 1604, 0, 3075,
+    2402, 0, 3439, 3710, 73, 0, 0, 2871, 2037, 4131, 0, 6120, 0, 0, 100, 305,
+    2736, 5017, 2781, 1623, 5145, 11, 0, 0, 0, 5863, 6451, 0, 5971, 0, 2660, 3448,
+    2596, 4427, 2038, 0, 5780, 3513, 6315, 0, 4660, 0, 7149, 0, 0, 250, 280, 0,
+    5821, 5872, 0, 39, 2292, 4549, 189, 19, 5558, 239, 171, 0, 1865, 5036, 2735, 0,
+    5786, 2378, 6300, 0, 3084, 0, 4505, 0, 0, 0, 3992, 67, 1885, 3020, 3164, 0,
+    2737, 5223, 0, 0, 0, 3662, 0, 0, 139, 3767, 5598, 0, 0, 0, 0, 4871,
+    0, 0, 6630, 0, 0, 0, 2551, 1955, 5631, 205, 246, 0, 0, 0, 4983, 0,
+    0, 63, 2217, 5417, 2678, 0, 6856, 0, 0, 0, 0, 0, 0, 216, 3172, 0,
+    0, 5334, 3030, 0, 3129, 0, 0, 0, 0, 4466, 0, 1906, 2725, 0, 1753, 0,
+    0, 5087, 5627, 6841, 6022, 0, 6352, 0, 0, 5378, 0, 0, 0, 0, 187, 0,
+    5546, 215, 0, 2757, 2604, 0, 0, 0, 0, 2946, 0, 0, 77, 1622, 2724, 5373,
+    0, 3229, 0, 2242, 2007, 6544, 0, 0, 0, 0, 0, 4493, 6060, 5173, 5855, 0,
+    0, 0, 2726, 5567, 3208, 4041, 2838, 2556, 3133, 0, 0, 0, 0, 2822, 0, 0,
+    185, 3291, 198, 145, 5168, 294, 0, 4922, 7100, 4584, 0, 0, 4701, 0, 5976, 0,
+    2592, 2480, 1780, 0, 135, 4868, 3067, 0, 0, 2613, 0, 0, 2834, 5950, 3769, 0,
+    0, 0, 5176, 4977, 4293, 0, 2523, 1798, 4323, 0, 1608, 0, 0, 2146, 0, 0,
+    3152, 5746, 0, 5711, 0, 0, 1840, 3802, 0, 0, 2744, 0, 0, 2966, 0, 0,
+    252, 2102, 2778, 3649, 0, 0, 0, 25, 2492, 131, 0, 2858, 0, 0, 1607, 125,
+    6365, 3048, 0, 2425, 0, 3796, 0, 0, 2485, 2537, 0, 0, 0, 2473, 6821, 7026,
+    0, 2525, 3607, 0, 6039, 0, 0, 4278, 1624, 3194, 3206, 55, 2974, 6087, 6480, 6198,
+    0, 0, 2787, 2249, 0, 4527, 4767, 0, 2743, 16, 0, 3029, 0, 0, 0, 0,
+    0, 0, 306, 51, 0, 1743, 0, 6800, 0, 2513, 1698, 4073, 6474, 0, 2011, 177,
+    0, 3565, 0, 3143, 7147, 4235, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4103, 0, 0, 4680, 5163, 6903, 6484, 0, 1734, 3199, 2088, 5882, 1773, 0,
+    2710, 210, 4987, 2080, 1721, 231, 3342, 0, 0, 7353, 0, 0, 2018, 0, 5996, 3318,
+    1644, 3095, 0, 0, 5925, 1772, 0, 0, 5806, 4058, 2707, 261, 0, 289, 5543, 7380,
+    0, 0, 3088, 0, 291, 0, 0, 0, 0, 0, 0, 5750, 0, 0, 0, 0,
+    0, 2886, 0, 1900, 2363, 0, 2733, 0, 5188, 0, 6852, 0, 3242, 7360, 0, 1774,
+    2703, 5583, 1742, 0, 3586, 5115, 0, 0, 6312, 4668, 0, 3121, 0, 0, 0, 0,
+    321, 0, 5900, 0, 0, 0, 0, 0, 5458, 3176, 4015, 0, 2215, 2350, 2623, 2794,
+    0, 0, 0, 0, 2638, 5151, 6334, 3158, 2585, 0, 2063, 1877, 4596, 5319, 3021, 1896,
+    0, 0, 0, 315, 0, 3285, 3779, 0, 4231, 0, 0, 2821, 0, 230, 0, 7277,
+    5363, 0, 0, 2153, 290, 4308, 0, 3186, 2502, 3097, 5109, 196, 0, 3073, 4837, 0,
+    2571, 3001, 5665, 2237, 241, 2690, 0, 2227, 320, 168, 0, 5309, 4270, 4580, 3190, 0,
+    2140, 5291, 2814, 0, 0, 0, 0, 0, 1606, 0, 275, 4090, 0, 0, 0, 2722,
+    2501, 0, 0, 0, 0, 0, 0, 5450, 3207, 4291, 3011, 0, 96, 3254, 2766, 1708,
+    133, 3939, 4710, 0, 0, 0, 107, 234, 0, 2590, 2183, 0, 0, 0, 4866, 0,
+    2612, 0, 2560, 3223, 0, 0, 0, 0, 6729, 4086, 0, 4411, 2674, 2772, 272, 0,
+    0, 0, 4005, 5748, 0, 0, 0, 3911, 2284, 0, 314, 1832, 268, 0, 0, 1817,
+    2093, 5186, 0, 5620, 0, 0, 3605, 235, 3558, 0, 0, 4376, 0, 0, 0, 0,
+    6478, 2184, 6714, 3683, 4782, 0, 0, 0, 2278, 0, 2074, 0, 2491, 0, 0, 0,
+    2913, 2535, 0, 5006, 3029, 1821, 6709, 0, 2988, 0, 3269, 0, 3893, 0, 0, 0,
+    2441, 0, 5317, 2274, 4562, 4823, 3772, 6024, 2490, 0, 173, 2339, 257, 2653, 3477, 6368,
+    2045, 0, 0, 0, 2923, 0, 0, 0, 6688, 0, 4071, 0, 0, 0, 0, 35,
+    0, 6130, 1603, 3548, 6362, 236, 0, 2714, 3141, 3340, 6388, 0, 2117, 6238, 4191, 0,
+    0, 0, 6322, 0, 2436, 40, 0, 0, 3462, 5148, 5847, 7159, 0, 6115, 0, 0,
+    6372, 5981, 0, 4427, 7376, 3457, 2402, 6763, 101, 0, 5527, 0, 2040, 3732, 1962, 0,
+    3195, 0, 4156, 4650, 0, 2594, 0, 1627, 5969, 5876, 2292, 0, 3140, 0, 0, 0,
+    0, 39, 124, 0, 5599, 7186, 0, 0, 3086, 5788, 1604, 0, 6239, 3710, 3436, 0,
+    0, 2037, 4509, 0, 212, 0, 0, 5242, 0, 1754, 2739, 0, 0, 0, 0, 41,
+    1613, 3240, 5598, 0, 0, 5015, 7166, 0, 5100, 6003, 0, 6330, 2554, 0, 0, 6939,
+    3119, 0, 1942, 5780, 238, 246, 2735, 0, 3511, 0, 0, 0, 0, 0, 0, 5600,
+    2602, 3174, 0, 221, 5556, 0, 0, 5353, 0, 2688, 0, 0, 0, 4547, 0, 4512,
+    5089, 0, 4473, 237, 0, 0, 3868, 4217, 4460, 66, 0, 1909, 6356, 216, 0, 0,
+    0, 0, 0, 0, 0, 0, 3066, 309, 3173, 2946, 0, 0, 2413, 0, 6625, 2481,
+    0, 2759, 1955, 0, 0, 0, 81, 0, 5630, 5375, 0, 0, 0, 2217, 0, 0,
+    0, 0, 187, 1601, 0, 0, 5855, 0, 5547, 0, 3129, 0, 0, 0, 0, 0,
+    0, 0, 0, 1992, 0, 0, 2728, 3327, 0, 2432, 0, 0, 123, 0, 0, 2328,
+    6837, 6727, 6074, 1691, 0, 96, 0, 0, 0, 4701, 0, 0, 0, 3136, 311, 0,
+    0, 0, 6273, 0, 0, 4303, 0, 0, 5746, 2867, 0, 2724, 0, 0, 5452, 7132,
+    272, 5180, 3853, 0, 0, 0, 0, 1789, 0, 3997, 1843, 0, 5713, 0, 0, 0,
+    0, 3227, 3426, 0, 2613, 0, 0, 0, 2837, 0, 5004, 2778, 1608, 0, 0, 2657,
+    0, 0, 0, 0, 14, 4747, 7097, 0, 2152, 6366, 2858, 3619, 0, 0, 3266, 3838,
+    0, 0, 3067, 2975, 0, 3475, 2473, 6554, 0, 2525, 95, 0, 4971, 0, 0, 0,
+    0, 5626, 2787, 0, 0, 5768, 5280, 3000, 2985, 2418, 0, 2337, 4774, 4527, 0, 2426,
+    0, 0, 0, 0, 0, 0, 4454, 3413, 0, 0, 2030, 267, 177, 0, 2668, 0,
+    2015, 25, 0, 0, 0, 4931, 0, 59, 6798, 2387, 125, 0, 0, 0, 0, 6081,
+    3795, 4893, 0, 0, 4083, 0, 0, 1724, 0, 3398, 2974, 0, 6816, 3354, 0, 3150,
+    7035, 0, 6492, 1702, 4958, 0, 54, 0, 3205, 7182, 3320, 6909, 2677, 2020, 5526, 2087,
+    229, 0, 0, 0, 0, 0, 0, 0, 218, 4687, 0, 0, 0, 3274, 0, 0,
+    0, 0, 0, 289, 3202, 0, 0, 7392, 6472, 2937, 0, 5584, 0, 0, 3557, 0,
+    0, 0, 1970, 5201, 0, 0, 0, 0, 0, 0, 0, 2912, 0, 0, 2887, 2897,
+    2151, 36, 4680, 5117, 0, 0, 0, 0, 5583, 1776, 7347, 3199, 210, 3592, 186, 6133,
+    2078, 0, 0, 3713, 2831, 165, 176, 192, 0, 0, 225, 0, 5905, 0, 0, 0,
+    291, 5482, 2706, 5585, 5675, 232, 288, 3242, 1772, 0, 0, 2954, 5541, 1609, 0, 4602,
+    2641, 256, 92, 0, 0, 0, 0, 0, 0, 3785, 4311, 0, 1766, 0, 2572, 1899,
+    281, 0, 3783, 4271, 2623, 2886, 5152, 5670, 3064, 0, 7356, 308, 0, 0, 313, 3717,
+    50, 286, 4755, 6306, 4791, 1878, 191, 0, 0, 0, 0, 2571, 0, 0, 0, 0,
+    3822, 3186, 0, 2849, 3311, 0, 4270, 5456, 0, 0, 0, 0, 0, 2814, 2215, 0,
+    2824, 0, 0, 5783, 0, 1958, 2573, 2423, 0, 4856, 2204, 0, 0, 0, 4272, 2479,
+    3008, 2140, 0, 190, 5451, 0, 4228, 121, 0, 0, 3556, 2085, 0, 0, 3851, 108,
+    302, 2501, 0, 0, 47, 3015, 290, 0, 0, 0, 6209, 0, 3111, 0, 311, 2237,
+    2866, 0, 3001, 2933, 0, 3226, 3971, 0, 3169, 0, 3043, 0, 2702, 0, 0, 2190,
+    0, 1835, 4710, 0, 0, 0, 4089, 275, 3382, 1822, 0, 0, 2612, 0, 0, 0,
+    0, 0, 4969, 6739, 3687, 4006, 2964, 0, 4383, 1708, 61, 2110, 3936, 0, 2285, 2185,
+    12, 184, 4887, 0, 0, 4406, 0, 0, 3411, 0, 0, 280, 0, 1821, 0, 6414,
+    0, 0, 4370, 1655, 0, 0, 271, 2800, 4785, 5854, 7259, 3696, 5362, 5537, 5748, 0,
+    2159, 0, 0, 3104, 189, 0, 3487, 1823, 2920, 0, 0, 2048, 1814, 112, 0, 4439,
+    0, 0, 144, 0, 6686, 2277, 2667, 0, 0, 0, 0, 1874, 5105, 2490, 7218, 2339,
+    3558, 3074, 0, 0, 0, 0, 3210, 6267, 0, 2927, 0, 4878, 0, 0, 0, 207,
+    0, 6704, 0, 0, 6137, 2913, 0, 0, 5443, 5317, 0, 0, 0, 0, 6380, 2434,
+    0, 2715, 0, 4562, 0, 2677, 2124, 2635, 2876, 2559, 2650, 4150, 2833, 3110, 0, 0,
+    4163, 0, 292, 3273, 4653, 5838, 6247, 1876, 0, 0, 6769, 0, 0, 0, 0, 7198,
+    6241, 2545, 6360, 3053, 6084, 0, 5250, 0, 0, 3711, 4186, 3140, 0, 2117, 170, 0,
+    0, 3252, 7308, 3434, 0, 0, 0, 0, 43, 2149, 0, 0, 1919, 0, 5307, 0,
+    5102, 5256, 3731, 7153, 5972, 3452, 0, 6948, 4427, 2039, 0, 5090, 0, 1961, 0, 0,
+    3240, 0, 3517, 2292, 288, 4683, 175, 303, 1600, 5602, 5433, 1913, 0, 0, 39, 2382,
+    0, 3085, 2768, 3282, 281, 4553, 2273, 4449, 6679, 5391, 0, 5089, 72, 3183, 4506, 0,
+    1745, 0, 0, 5787, 2738, 4463, 3871, 0, 221, 0, 0, 2602, 0, 0, 2171, 5598,
+    0, 3078, 7162, 5386, 49, 4210, 4218, 2951, 0, 0, 2759, 0, 1810, 1956, 263, 5091,
+    0, 2282, 6611, 1601, 0, 188, 0, 246, 0, 0, 0, 6636, 0, 0, 282, 5693,
+    0, 2083, 0, 0, 0, 5351, 0, 0, 0, 2001, 169, 4511, 1907, 287, 0, 3040,
+    0, 158, 0, 0, 2624, 4129, 0, 6680, 6022, 0, 298, 0, 190, 6353, 0, 0,
+    3546, 2946, 0, 0, 2647, 3057, 5968, 0, 6078, 302, 0, 0, 3427, 3327, 0, 0,
+    86, 78, 0, 0, 4123, 0, 0, 5374, 0, 0, 0, 0, 0, 4526, 3863, 0,
+    0, 0, 0, 0, 2700, 0, 0, 0, 0, 0, 0, 3426, 2867, 0, 147, 2727,
+    0, 0, 2712, 5855, 2239, 2326, 6104, 217, 2863, 5142, 3139, 0, 3998, 98, 3990, 0,
+    0, 1691, 3623, 3266, 7104, 2095, 1680, 4701, 7091, 0, 6273, 7127, 0, 0, 2592, 2006,
+    3428, 2478, 1611, 14, 156, 5812, 0, 7078, 0, 6558, 4297, 1711, 0, 2155, 251, 3315,
+    2813, 2985, 0, 1841, 4750, 2798, 3423, 0, 5746, 5712, 265, 204, 3632, 0, 6576, 3084,
+    2033, 4498, 0, 2578, 0, 2788, 0, 3164, 3004, 0, 3224, 84, 2858, 2657, 0, 6835,
+    2337, 0, 6561, 310, 0, 0, 5096, 7037, 0, 0, 3074, 0, 0, 6203, 0, 2548,
+    0, 0, 2473, 0, 2732, 2525, 3358, 6056, 0, 0, 2020, 4934, 0, 6807, 0, 5408,
+    5768, 6088, 2408, 322, 3108, 2633, 0, 3172, 2021, 0, 4953, 4527, 2787, 0, 0, 0,
+    0, 0, 2723, 4216, 3150, 177, 3367, 2557, 3018, 0, 4454, 3322, 2012, 0, 0, 0,
+    0, 0, 0, 0, 0, 3076, 0, 0, 2750, 4886, 2387, 5201, 0, 0, 0, 0,
+    0, 0, 4077, 75, 0, 0, 0, 170, 2897, 2521, 4681, 0, 0, 0, 0, 6488,
+    0, 0, 3561, 3162, 1649, 5936, 244, 5159, 0, 0, 4912, 1722, 279, 5587, 5053, 4321,
+    2916, 3132, 0, 0, 0, 5207, 294, 4686, 2721, 0, 301, 0, 5678, 289, 3286, 232,
+    3201, 4315, 0, 4565, 7386, 0, 0, 197, 3740, 0, 0, 0, 0, 2271, 0, 3037,
+    2954, 0, 0, 0, 0, 0, 0, 0, 0, 3023, 3307, 1769, 0, 1889, 0, 1775,
+    0, 0, 7366, 192, 0, 3786, 5583, 2141, 3725, 0, 6196, 2666, 3823, 2119, 3152, 0,
+    0, 0, 321, 0, 0, 0, 1809, 5529, 3241, 0, 5681, 0, 5481, 0, 0, 0,
+    3822, 0, 0, 2683, 0, 3120, 0, 0, 3044, 5644, 6340, 169, 0, 0, 0, 2639,
+    0, 2575, 0, 0, 0, 4274, 157, 4309, 278, 3601, 0, 4101, 0, 0, 3824, 0,
+    3206, 0, 4755, 0, 3780, 2821, 4885, 4226, 5670, 3271, 0, 0, 0, 0, 0, 4520,
+    4270, 3383, 5966, 0, 2645, 0, 85, 2479, 0, 1642, 2571, 2238, 2009, 0, 0, 4095,
+    2828, 2814, 0, 1697, 3234, 0, 0, 2745, 0, 3198, 0, 3113, 2949, 0, 0, 0,
+    3382, 0, 0, 0, 0, 4052, 2964, 2866, 0, 6069, 3139, 236, 4345, 0, 0, 0,
+    1709, 194, 3219, 4373, 0, 2085, 185, 2777, 3336, 5034, 0, 5987, 0, 0, 3096, 3384,
+    0, 145, 0, 2590, 6209, 3943, 0, 6418, 6107, 3930, 0, 0, 0, 0, 0, 4417,
+    0, 4392, 6733, 3966, 178, 1694, 12, 2113, 3705, 271, 3194, 5537, 0, 2523, 1833, 1825,
+    3156, 119, 141, 6436, 0, 0, 0, 0, 3084, 4483, 6276, 3163, 0, 0, 1812, 0,
+    0, 2861, 0, 5858, 3684, 0, 2967, 0, 0, 112, 0, 4887, 1742, 0, 0, 27,
+    0, 6270, 2447, 0, 1821, 0, 6421, 2546, 0, 0, 0, 7253, 0, 0, 0, 0,
+    1655, 0, 0, 5443, 6695, 3669, 0, 0, 3211, 5818, 0, 0, 0, 0, 3172, 6280,
+    0, 0, 3032, 0, 3101, 0, 2046, 1849, 0, 4439, 2476, 0, 240, 3481, 193, 2876,
+    3316, 0, 3776, 4153, 2338, 0, 0, 3654, 296, 0, 1876, 0, 0, 2516, 0, 0,
+    0, 0, 0, 5051, 0, 4457, 4197, 0, 0, 0, 0, 7217, 73, 4172, 0, 168,
+    0, 1923, 0, 0, 2123, 6116, 6376, 5307, 149, 5257, 2226, 3909, 0, 5144, 0, 3736,
+    0, 0, 3443, 0, 0, 0, 0, 0, 4651, 3130, 0, 0, 0, 2879, 0, 0,
+    201, 0, 3283, 3284, 5836, 226, 294, 0, 4530, 0, 3903, 7192, 5394, 2385, 6240, 5573,
+    0, 0, 0, 0, 2670, 2176, 0, 0, 0, 0, 0, 0, 4695, 0, 2174, 0,
+    3019, 0, 0, 2393, 4264, 0, 2768, 5235, 42, 1926, 0, 4214, 5326, 3184, 2139, 5092,
+    1952, 0, 2764, 6943, 1746, 0, 3770, 0, 0, 0, 0, 6619, 2282, 1810, 2550, 7172,
+    5432, 0, 188, 0, 0, 5601, 2220, 0, 0, 1913, 0, 0, 0, 2625, 0, 5356,
+    3042, 4516, 3276, 0, 0, 3869, 2955, 2138, 0, 2944, 5346, 0, 4133, 0, 6682, 0,
+    3264, 4461, 2601, 0, 0, 2947, 6351, 0, 0, 0, 3206, 4876, 0, 0, 0, 5386,
+    0, 3060, 0, 5122, 2506, 2996, 2647, 2759, 0, 234, 2922, 0, 0, 0, 257, 0,
+    2301, 1625, 0, 0, 1601, 76, 0, 0, 1687, 0, 0, 0, 2007, 0, 0, 2250,
+    3196, 4044, 0, 4758, 0, 0, 6230, 0, 0, 4136, 0, 0, 2432, 0, 0, 1996,
+    0, 0, 0, 5142, 7010, 3994, 147, 312, 0, 2083, 262, 1692, 0, 0, 4985, 38,
+    3430, 3326, 0, 7094, 2072, 2331, 0, 0, 6274, 137, 4718, 2544, 0, 0, 1680, 0,
+    4123, 6072, 0, 0, 2614, 0, 209, 3857, 3641, 5812, 208, 2098, 0, 2986, 7113, 7138,
+    2798, 0, 3426, 0, 4498, 0, 6585, 0, 4942, 0, 0, 0, 2469, 6212, 0, 0,
+    0, 0, 0, 98, 0, 3667, 0, 0, 2859, 2908, 3266, 5224, 6031, 5194, 0, 2817,
+    0, 5993, 6882, 0, 0, 35, 0, 0, 6206, 3620, 2548, 1942, 6555, 251, 2474, 2495,
+    3573, 6867, 0, 2419, 7072, 13, 155, 0, 0, 0, 5408, 0, 0, 5769, 2985, 2367,
+    2688, 0, 5335, 6051, 0, 0, 5803, 6521, 0, 0, 3417, 3296, 4455, 6216, 2031, 3376,
+    322, 1978, 2023, 3076, 0, 2633, 0, 1743, 1658, 4216, 0, 6832, 0, 256, 7036, 83,
+    0, 2938, 0, 6506, 0, 0, 3574, 6560, 4442, 3145, 2388, 0, 0, 0, 0, 75,
+    4666, 0, 3355, 0, 168, 2898, 5178, 0, 0, 2020, 1652, 0, 4889, 277, 3320, 5890,
+    0, 5208, 0, 0, 7417, 4951, 0, 6011, 0, 1787, 0, 1979, 0, 0, 0, 4325,
+    1662, 2310, 1940, 4691, 0, 2053, 123, 2582, 0, 0, 0, 0, 0, 0, 3009, 5956,
+    5070, 1781, 3090, 0, 0, 0, 2161, 3132, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3025, 0, 1892, 5442, 3106, 309, 4328, 0, 197, 2897, 3832, 0,
+    3243, 6200, 5060, 0, 3161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3307, 0, 0, 0, 0, 5485, 0, 0, 5676, 232, 259, 0, 5586, 2685, 4315, 2850,
+    3122, 0, 0, 0, 3610, 0, 0, 1809, 1602, 0, 0, 0, 0, 5530, 0, 3035,
+    4233, 4105, 0, 1767, 0, 2415, 3826, 0, 3262, 0, 0, 5671, 5252, 6486, 1916, 4966,
+    0, 0, 0, 0, 3721, 3778, 0, 0, 257, 4756, 122, 0, 5757, 2645, 0, 3392,
+    5680, 0, 0, 0, 2921, 0, 1646, 0, 0, 2009, 3822, 3237, 0, 0, 4930, 0,
+    0, 4055, 0, 5388, 0, 0, 0, 5916, 0, 0, 2762, 0, 2574, 0, 6186, 0,
+    3345, 1697, 145, 0, 4108, 2423, 0, 0, 0, 0, 4273, 3877, 0, 0, 2777, 4940,
+    0, 6131, 2404, 185, 0, 0, 4712, 0, 3386, 0, 0, 0, 0, 3933, 6210, 0,
+    0, 0, 4703, 0, 283, 4013, 4095, 0, 0, 3062, 2977, 2523, 3977, 0, 0, 272,
+    4400, 4927, 0, 0, 5582, 0, 5046, 3952, 0, 0, 0, 317, 5751, 6445, 3382, 0,
+    0, 0, 4483, 4126, 0, 0, 0, 0, 5189, 1632, 0, 0, 0, 0, 0, 267,
+    0, 2780, 0, 0, 5031, 0, 6742, 4371, 186, 2659, 160, 0, 3682, 6519, 5978, 4789,
+    6415, 2546, 0, 0, 69, 7265, 0, 1941, 2970, 0, 0, 2107, 0, 3700, 115, 5663,
+    0, 31, 1656, 0, 2527, 5537, 6288, 2453, 5320, 2688, 4848, 0, 1824, 2340, 4569, 3679,
+    4440, 0, 3295, 0, 0, 1963, 2570, 0, 0, 0, 2542, 1886, 0, 3272, 245, 3776,
+    0, 0, 0, 2516, 0, 0, 5009, 0, 0, 0, 3064, 0, 211, 6420, 6151, 6268,
+    0, 0, 1679, 0, 0, 284, 73, 0, 0, 0, 4180, 0, 5443, 0, 3490, 5811,
+    0, 2679, 0, 0, 5527, 0, 3913, 0, 0, 5066, 0, 0, 0, 0, 0, 6569,
+    0, 0, 0, 1953, 0, 0, 0, 266, 0, 1964, 4151, 176, 121, 1876, 0, 0,
+    2622, 0, 0, 2823, 0, 2295, 5841, 3304, 0, 5611, 3166, 0, 3130, 0, 0, 2840,
+    0, 0, 1920, 2882, 0, 0, 0, 219, 0, 0, 4267, 3916, 0, 5407, 2399, 226,
+    1757, 0, 0, 0, 5307, 5237, 2177, 0, 2671, 2626, 0, 0, 0, 0, 3774, 5606,
+    5571, 0, 2206, 4727, 5348, 1820, 0, 3184, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1914, 5436, 2383, 3903, 0, 2625, 3052, 5392, 0, 0, 2603, 0, 286, 255, 2756,
+    0, 0, 0, 0, 0, 0, 6386, 0, 0, 1925, 0, 110, 0, 4357, 2767, 0,
+    5387, 0, 4318, 2627, 0, 5203, 2944, 285, 0, 3068, 2413, 4211, 0, 1678, 2138, 6374,
+    204, 2509, 2484, 3099, 1810, 2760, 6615, 0, 2809, 1629, 2931, 0, 0, 2282, 2007, 2348,
+    2253, 0, 0, 0, 57, 4921, 2220, 2996, 0, 5867, 0, 0, 0, 0, 3041, 3216,
+    0, 0, 2922, 0, 0, 1987, 4047, 0, 207, 318, 2305, 6681, 3328, 4130, 0, 2615,
+    0, 0, 1687, 126, 0, 0, 4925, 0, 6231, 6082, 137, 0, 0, 3058, 2947, 0,
+    0, 2647, 0, 0, 0, 311, 4870, 0, 28, 0, 5406, 0, 4124, 2614, 254, 0,
+    0, 0, 0, 0, 4997, 0, 6925, 0, 0, 0, 7121, 2799, 0, 0, 0, 0,
+    1861, 4721, 0, 0, 4135, 2149, 0, 2536, 0, 0, 2616, 3252, 0, 4098, 208, 2712,
+    3991, 2105, 147, 2498, 144, 64, 0, 295, 15, 0, 4982, 186, 0, 0, 7092, 3429,
+    0, 6884, 2469, 2540, 6035, 5088, 0, 0, 2908, 4900, 1680, 0, 7084, 225, 0, 4673,
+    5197, 0, 6531, 2843, 3636, 0, 5628, 5812, 3282, 0, 2798, 5911, 5379, 3183, 6224, 2417,
+    6580, 0, 4445, 3618, 0, 3582, 4498, 0, 0, 0, 0, 3029, 2568, 183, 2168, 0,
+    0, 4261, 2668, 2859, 2368, 6826, 3272, 6839, 0, 0, 0, 1874, 0, 0, 1743, 5986,
+    0, 6565, 3323, 3148, 0, 0, 2751, 2076, 4592, 0, 0, 2474, 6204, 5335, 263, 2409,
+    0, 6862, 0, 2989, 3250, 5408, 3238, 6538, 5892, 3576, 6974, 0, 0, 1791, 3353, 0,
+    3040, 2677, 6154, 6429, 1981, 3117, 0, 0, 0, 3371, 0, 0, 2633, 2835, 3274, 1670,
+    0, 202, 2022, 298, 121, 0, 4216, 0, 0, 1951, 1600, 3076, 307, 7450, 0, 6504,
+    316, 247, 3055, 0, 0, 0, 2503, 0, 2932, 0, 0, 4432, 0, 2565, 2910, 0,
+    0, 1650, 3009, 0, 3611, 0, 3835, 1794, 3243, 5132, 2162, 75, 72, 6157, 2154, 4322,
+    1972, 0, 0, 7411, 2310, 2234, 0, 0, 0, 3106, 0, 2941, 0, 0, 3122, 0,
+    0, 1819, 4316, 0, 0, 303, 2094, 3245, 3180, 227, 3987, 288, 0, 3610, 1781, 293,
+    0, 0, 0, 0, 0, 7022, 281, 0, 4233, 4627, 0, 1611, 0, 0, 2901, 3793,
+    0, 0, 0, 0, 156, 0, 3024, 5985, 3612, 1890, 182, 3906, 6805, 4746, 5056, 297,
+    6197, 52, 0, 0, 0, 4240, 1676, 3395, 0, 3097, 0, 0, 0, 1809, 5684, 0,
+    0, 1934, 3346, 5757, 6799, 3220, 0, 84, 0, 0, 2684, 2347, 3319, 203, 0, 4327,
+    0, 4482, 0, 0, 207, 0, 0, 0, 6040, 2921, 0, 0, 0, 0, 0, 3345,
+    4102, 0, 2222, 4930, 0, 0, 3825, 0, 0, 6483, 2440, 96, 3559, 190, 3230, 0,
+    272, 0, 3151, 3347, 0, 0, 0, 3108, 6187, 0, 2645, 302, 0, 0, 0, 0,
+    4096, 2789, 1643, 0, 6142, 2009, 167, 2853, 6785, 0, 0, 240, 4563, 3960, 5916, 0,
+    2704, 4013, 249, 0, 0, 299, 0, 3260, 0, 0, 4053, 3315, 4107, 4144, 4706, 0,
+    244, 0, 0, 3251, 0, 181, 2515, 0, 145, 0, 0, 3162, 7358, 4020, 265, 1897,
+    4658, 4793, 3719, 5987, 3385, 5030, 3931, 0, 185, 0, 100, 5086, 0, 143, 4712, 0,
+    0, 2523, 5027, 1633, 6744, 0, 2662, 5663, 2783, 0, 5041, 0, 2741, 4396, 0, 161,
+    5862, 4796, 3691, 5751, 3183, 3157, 4436, 3087, 0, 3282, 6440, 5364, 3533, 0, 4483, 0,
+    0, 0, 2059, 0, 2159, 0, 2340, 0, 0, 0, 2530, 0, 0, 0, 3018, 3821,
+    4206, 0, 5107, 2342, 0, 0, 2447, 0, 3074, 0, 7273, 4543, 0, 4869, 6425, 263,
+    0, 5226, 3673, 0, 0, 0, 174, 0, 0, 0, 5527, 3492, 0, 3175, 0, 5634,
+    6166, 3112, 6284, 0, 0, 5320, 0, 0, 1683, 0, 0, 1966, 4569, 0, 3040, 0,
+    0, 0, 0, 0, 298, 5815, 2561, 0, 0, 0, 2952, 0, 3776, 0, 0, 4087,
+    2600, 5337, 0, 5614, 2730, 2516, 4501, 3053, 0, 3381, 5271, 0, 0, 0, 0, 0,
+    0, 0, 0, 73, 0, 4176, 0, 0, 2823, 0, 0, 0, 2745, 170, 0, 1760,
+    3305, 3910, 5546, 71, 3167, 0, 2957, 2604, 0, 220, 0, 0, 2603, 5617, 0, 0,
+    0, 4657, 0, 0, 2225, 3986, 1904, 0, 0, 0, 2295, 2358, 3239, 0, 0, 0,
+    0, 3904, 0, 2956, 0, 0, 253, 5576, 3298, 0, 0, 3010, 0, 2275, 0, 156,
+    1610, 3889, 2629, 3118, 6386, 4265, 0, 1930, 3915, 5976, 135, 2396, 255, 2216, 1688, 2170,
+    2756, 2605, 1784, 0, 5606, 3771, 0, 2487, 222, 3154, 4868, 4209, 0, 3071, 6393, 0,
+    6693, 0, 0, 0, 0, 0, 3329, 0, 0, 3218, 0, 84, 209, 2221, 4336, 6687,
+    0, 26, 5717, 3317, 129, 0, 2809, 2625, 0, 0, 2744, 0, 0, 5347, 169, 0,
+    4355, 0, 2856, 0, 0, 0, 3328, 158, 2869, 0, 4921, 3648, 0, 0, 0, 0,
+    0, 6371, 6025, 4281, 0, 3217, 0, 0, 2007, 0, 2425, 1838, 2507, 3099, 2760, 155,
+    5970, 2470, 2649, 3441, 5765, 0, 3330, 3056, 2868, 0, 86, 0, 1626, 6043, 6093, 0,
+    0, 0, 2930, 2251, 0, 0, 0, 0, 0, 16, 0, 4528, 0, 83, 214, 4140,
+    3435, 3208, 0, 2618, 0, 0, 3139, 254, 0, 4045, 5867, 64, 2513, 0, 0, 0,
+    244, 0, 0, 3989, 137, 2375, 3162, 2736, 15, 0, 150, 0, 0, 0, 4981, 0,
+    7164, 4870, 0, 5628, 2595, 6613, 201, 2878, 0, 4116, 2614, 0, 0, 0, 2536, 6919,
+    17, 1729, 5555, 4992, 0, 5379, 7117, 0, 4715, 3627, 5914, 1859, 0, 0, 0, 0,
+    0, 0, 4907, 0, 2168, 3084, 3030, 4676, 4061, 2668, 0, 0, 0, 0, 5922, 258,
+    0, 1753, 0, 0, 3767, 1874, 5325, 6829, 6883, 0, 0, 2336, 0, 0, 2496, 0,
+    0, 4902, 0, 0, 2540, 0, 0, 1714, 0, 0, 0, 5191, 6873, 0, 0, 0,
+    5470, 5990, 5336, 6848, 2802, 259, 0, 2842, 6052, 6525, 6220, 2677, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3029, 0, 2835, 3274, 2982, 0, 3362, 0, 0, 2725, 0,
+    0, 5151, 0, 1743, 4876, 0, 0, 6173, 4486, 5322, 1877, 3146, 3055, 5113, 6510, 4572,
+    3575, 0, 0, 2480, 0, 0, 0, 5891, 0, 0, 1622, 77, 0, 0, 0, 2300,
+    202, 5171, 2157, 3249, 2242, 0, 0, 6534, 0, 0, 4975, 2450, 2943, 1975, 7423, 1788,
+    0, 1980, 5309, 195, 0, 0, 228, 2754, 3133, 3987, 303, 0, 0, 4306, 1666, 2311,
+    288, 3246, 4576, 1782, 260, 3289, 0, 0, 4974, 1606, 0, 0, 3091, 0, 281, 0,
+    301, 0, 6066, 0, 0, 0, 2942, 0, 0, 3793, 0, 2519, 0, 0, 4332, 0,
+    2953, 0, 1793, 3614, 2094, 0, 180, 273, 133, 2144, 3833, 6809, 0, 4242, 4866, 52,
+    3152, 0, 0, 2894, 0, 3800, 6195, 0, 0, 0, 7430, 0, 0, 0, 0, 3122,
+    3924, 2965, 0, 4005, 3179, 0, 0, 0, 0, 2284, 24, 6030, 0, 0, 0, 3046,
+    0, 3565, 0, 0, 0, 0, 4233, 0, 0, 0, 0, 3610, 6812, 7020, 0, 0,
+    3230, 2855, 190, 6490, 0, 2468, 3604, 2415, 3563, 6717, 0, 2074, 6477, 0, 0, 262,
+    3097, 0, 0, 3393, 3349, 302, 5882, 1830, 2988, 0, 0, 0, 0, 0, 0, 231,
+    1641, 4567, 6799, 6028, 245, 2444, 5756, 0, 5917, 0, 173, 1698, 261, 0, 2854, 2704,
+    0, 4818, 0, 0, 0, 4437, 4112, 0, 0, 0, 2865, 0, 0, 3345, 0, 0,
+    2714, 2121, 179, 4022, 0, 6132, 1897, 5160, 96, 7223, 1727, 0, 4713, 5747, 2360, 284,
+    0, 3339, 0, 0, 0, 0, 0, 1940, 1773, 0, 6122, 0, 3465, 2877, 7343, 2044,
+    5037, 0, 6317, 0, 45, 6779, 4805, 116, 5865, 3751, 2344, 5752, 11, 4013, 3956, 5540,
+    0, 4661, 0, 2350, 0, 2598, 0, 0, 0, 7397, 2159, 250, 0, 5364, 0, 0,
+    0, 0, 0, 0, 0, 5873, 6109, 3294, 5107, 0, 103, 5251, 5316, 0, 3716, 4206,
+    3074, 1742, 0, 0, 6743, 6302, 0, 212, 0, 0, 230, 0, 0, 0, 0, 4790,
+    5321, 0, 0, 0, 5021, 5455, 4649, 5663, 5826, 2690, 0, 0, 0, 0, 2454, 0,
+    0, 0, 4872, 0, 4570, 0, 5421, 2340, 0, 4087, 3527, 0, 2561, 2057, 0, 3115,
+    0, 0, 0, 0, 0, 63, 4227, 0, 0, 3262, 0, 2765, 0, 0, 0, 1605,
+    0, 0, 3254, 4217, 0, 5098, 0, 3053, 0, 237, 0, 0, 0, 4468, 170, 0,
+    0, 0, 0, 168, 3491, 2291, 0, 0, 0, 0, 5527, 4394, 5286, 2227, 0, 5378,
+    0, 0, 2770, 0, 0, 0, 2757, 0, 1965, 0, 0, 0, 0, 0, 0, 0,
+    2358, 0, 0, 0, 0, 3866, 0, 2296, 1944, 0, 3305, 3011, 5612, 2769, 3986, 3063,
+    0, 0, 0, 0, 2183, 0, 2275, 0, 0, 0, 0, 223, 4702, 5550, 0, 0,
+    2822, 2959, 0, 4922, 3920, 3299, 0, 0, 0, 1758, 0, 253, 0, 0, 2607, 5607,
+    0, 317, 0, 0, 6282, 0, 1813, 0, 3769, 0, 6395, 6697, 0, 2834, 0, 0,
+    6021, 0, 0, 0, 0, 1802, 0, 120, 0, 0, 5616, 0, 5723, 2956, 0, 2779,
+    2603, 0, 2658, 169, 3227, 0, 1603, 0, 0, 3997, 0, 0, 0, 0, 6386, 4361,
+    4174, 222, 3651, 2628, 0, 2102, 3548, 3887, 3267, 2526, 6378, 5847, 26, 6700, 1624, 2413,
+    3332, 2537, 3841, 0, 0, 86, 5773, 3069, 0, 2485, 3445, 2649, 101, 0, 2402, 4816,
+    0, 0, 0, 2923, 0, 1962, 0, 2975, 5626, 6687, 283, 2429, 0, 0, 4532, 0,
+    0, 0, 6365, 211, 6238, 2249, 2871, 5868, 0, 0, 2591, 0, 4769, 0, 2743, 0,
+    0, 0, 3328, 2435, 3139, 0, 0, 0, 0, 6802, 2736, 7042, 127, 5145, 6083, 150,
+    0, 0, 4236, 1613, 3448, 0, 40, 51, 7149, 311, 0, 0, 0, 0, 6000, 6315,
+    0, 4725, 1739, 0, 19, 1940, 2868, 0, 0, 2029, 6931, 0, 3401, 7203, 0, 2090,
+    5599, 0, 3304, 0, 0, 1865, 0, 0, 0, 2878, 6650, 4988, 316, 0, 218, 3435,
+    0, 5928, 0, 0, 2617, 0, 3164, 4505, 0, 0, 0, 3294, 64, 0, 0, 0,
+    5202, 3767, 216, 0, 0, 15, 0, 0, 0, 2887, 0, 6001, 4945, 0, 2551, 0,
+    0, 1942, 6610, 0, 0, 0, 0, 0, 0, 2206, 5628, 0, 0, 0, 6856, 5912,
+    2703, 5555, 0, 0, 0, 187, 0, 5379, 0, 171, 0, 0, 0, 2688, 3172, 3128,
+    4466, 6352, 110, 0, 3296, 2725, 0, 0, 2795, 264, 0, 0, 4016, 0, 1896, 1985,
+    2243, 1874, 0, 6827, 182, 3066, 0, 0, 0, 2576, 0, 3785, 0, 4901, 0, 0,
+    3216, 0, 0, 0, 77, 248, 0, 1622, 2997, 0, 0, 2242, 0, 0, 6544, 5154,
+    5173, 1881, 7281, 0, 5363, 219, 0, 196, 2677, 0, 50, 0, 0, 0, 7115, 0,
+    233, 3274, 3133, 2835, 0, 320, 0, 0, 2613, 3134, 123, 0, 1764, 0, 0, 294,
+    0, 3055, 5106, 4584, 2204, 0, 1608, 6074, 0, 0, 2640, 2300, 0, 0, 0, 0,
+    0, 2976, 0, 0, 0, 0, 2755, 6160, 4977, 0, 0, 0, 4293, 5450, 108, 1798,
+    301, 2766, 2146, 5273, 0, 0, 0, 0, 6218, 1973, 317, 0, 0, 2942, 0, 3802,
+    0, 3987, 0, 0, 4086, 2560, 0, 0, 295, 303, 0, 0, 0, 273, 181, 300,
+    0, 0, 0, 0, 4974, 288, 0, 0, 3048, 2656, 0, 5516, 198, 281, 213, 4747,
+    24, 0, 2965, 0, 4893, 2843, 6030, 7026, 2093, 4009, 3607, 6806, 61, 4241, 2288, 3613,
+    0, 3793, 4891, 1699, 2524, 4378, 6480, 0, 318, 0, 5276, 52, 0, 0, 5758, 4767,
+    0, 0, 2800, 0, 0, 229, 2535, 0, 3566, 0, 0, 1664, 0, 6800, 5362, 2011,
+    4828, 2084, 0, 1698, 0, 0, 2934, 0, 3200, 211, 0, 0, 0, 131, 0, 0,
+    0, 0, 0, 0, 0, 4073, 0, 3250, 6811, 1700, 5883, 2534, 7232, 0, 6690, 0,
+    2854, 0, 5105, 190, 1773, 2088, 6389, 3210, 6130, 0, 0, 0, 3560, 3342, 0, 0,
+    0, 0, 0, 3348, 302, 2438, 0, 0, 0, 5444, 0, 0, 0, 6145, 0, 179,
+    6791, 5584, 2133, 4564, 0, 5747, 7380, 3242, 2635, 0, 2704, 3304, 0, 2718, 2833, 2559,
+    0, 6327, 2877, 0, 4428, 0, 0, 247, 0, 4158, 0, 0, 3723, 0, 0, 5879,
+    0, 2151, 1897, 4021, 5254, 0, 0, 186, 2118, 2623, 3107, 2351, 0, 0, 1604, 1742,
+    5969, 3438, 3710, 220, 2037, 225, 3238, 0, 0, 0, 7330, 0, 0, 0, 0, 0,
+    5261, 5364, 2846, 2205, 5863, 5828, 0, 3285, 0, 1676, 4800, 5540, 6334, 0, 0, 3186,
+    0, 0, 3539, 0, 0, 0, 5780, 2063, 0, 2572, 0, 3117, 109, 0, 0, 0,
+    3007, 2273, 3272, 0, 4271, 3746, 3779, 7277, 2228, 2343, 3064, 2140, 4206, 2735, 3074, 0,
+    5801, 0, 0, 6300, 0, 0, 1745, 4478, 168, 0, 67, 0, 0, 0, 3043, 2501,
+    2227, 0, 0, 5455, 304, 0, 4221, 49, 3255, 0, 3954, 3216, 3012, 2931, 0, 0,
+    0, 0, 0, 0, 6629, 0, 1955, 0, 0, 2291, 2561, 4087, 269, 0, 2612, 0,
+    3556, 4227, 121, 2217, 0, 0, 0, 0, 0, 0, 2853, 2183, 315, 2824, 3053, 0,
+    0, 0, 0, 0, 0, 2911, 293, 0, 0, 0, 2789, 3051, 170, 0, 167, 0,
+    2772, 5591, 0, 6729, 0, 3013, 0, 2933, 4391, 0, 2189, 5968, 2580, 3689, 0, 0,
+    4702, 0, 0, 0, 2036, 214, 0, 0, 2724, 1822, 0, 2504, 0, 0, 0, 0,
+    3986, 295, 300, 2358, 0, 5620, 4376, 0, 0, 0, 99, 0, 3683, 2769, 4782, 0,
+    0, 3893, 5006, 2275, 0, 2339, 0, 2838, 2490, 0, 0, 2924, 217, 4878, 6021, 0,
+    0, 2843, 3269, 2958, 4001, 0, 2658, 2779, 3228, 7099, 4783, 0, 6694, 6279, 2606, 6368,
+    0, 3549, 3154, 257, 1681, 2654, 3477, 6394, 0, 0, 4647, 0, 314, 292, 2348, 0,
+    5848, 0, 0, 2526, 0, 5773, 2788, 6688, 5775, 0, 0, 1813, 0, 0, 5720, 0,
+    0, 4499, 169, 4779, 0, 0, 4534, 299, 158, 0, 2925, 125, 207, 6238, 3649, 2966,
+    249, 4171, 0, 6699, 25, 0, 7051, 5096, 0, 3250, 0, 154, 0, 40, 0, 2591,
+    2493, 0, 2649, 3796, 5970, 0, 3442, 2974, 86, 3331, 4729, 6820, 3110, 4156, 0, 5409,
+    0, 6245, 0, 0, 0, 0, 0, 6096, 55, 3240, 4529, 4963, 7186, 5599, 6081, 1614,
+    0, 4446, 0, 0, 2557, 247, 4732, 3436, 2602, 3085, 2870, 0, 4426, 6008, 2723, 0,
+    3252, 0, 3139, 150, 0, 0, 0, 0, 2736, 2149, 0, 5205, 0, 221, 5545, 0,
+    3447, 6939, 5090, 0, 6617, 2406, 0, 2555, 0, 0, 1942, 2941, 0, 0, 7147, 0,
+    3027, 0, 0, 2998, 0, 0, 5162, 5212, 4680, 0, 0, 18, 1733, 5556, 3282, 3199,
+    3173, 5690, 260, 210, 6645, 4447, 0, 2688, 0, 3084, 4505, 0, 0, 0, 3296, 1989,
+    0, 5925, 135, 270, 0, 0, 1772, 0, 2707, 6679, 0, 0, 2271, 171, 0, 0,
+    0, 5976, 3066, 3767, 0, 2952, 180, 0, 0, 0, 4612, 0, 263, 0, 82, 6625,
+    3327, 2886, 0, 0, 0, 0, 0, 2810, 6852, 0, 1900, 5691, 0, 0, 6075, 3789,
+    123, 0, 0, 2744, 0, 3172, 0, 5529, 0, 0, 1992, 0, 0, 0, 0, 3040,
+    0, 0, 2725, 2867, 0, 0, 298, 5457, 0, 0, 2424, 1887, 6352, 0, 2215, 3546,
+    0, 0, 2853, 0, 0, 0, 3136, 3036, 0, 0, 2910, 3427, 0, 0, 0, 0,
+    7112, 199, 5452, 77, 3008, 1622, 167, 6076, 5109, 0, 0, 3853, 4230, 4526, 0, 2242,
+    14, 0, 2153, 276, 2579, 0, 3625, 0, 306, 134, 0, 2755, 275, 5966, 3133, 0,
+    3001, 4674, 294, 301, 0, 2237, 0, 0, 4580, 2864, 0, 2513, 5290, 7097, 2027, 3290,
+    6554, 0, 0, 3619, 0, 1611, 97, 4747, 4090, 2337, 0, 0, 0, 0, 0, 0,
+    198, 4971, 0, 4388, 0, 0, 194, 2656, 1708, 4291, 0, 4932, 5988, 156, 5280, 4976,
+    3938, 4710, 107, 0, 4894, 5758, 6215, 0, 3152, 3801, 4748, 0, 0, 0, 3413, 0,
+    3360, 0, 4050, 0, 178, 0, 0, 4410, 0, 250, 2524, 3223, 4931, 84, 0, 0,
+    0, 3321, 5748, 268, 0, 0, 0, 5760, 0, 0, 0, 0, 1816, 4484, 2747, 2920,
+    6816, 5186, 0, 0, 3354, 3605, 0, 0, 0, 0, 0, 2084, 3206, 1702, 4888, 0,
+    2448, 0, 6478, 131, 0, 0, 0, 3558, 0, 0, 0, 3108, 0, 0, 0, 2978,
+    2534, 0, 0, 0, 1661, 6708, 2913, 5447, 5150, 0, 0, 2011, 6138, 3213, 1698, 0,
+    0, 5317, 3032, 59, 3200, 4822, 5584, 4562, 0, 0, 0, 0, 2652, 0, 0, 193,
+    4071, 0, 0, 4168, 0, 0, 244, 0, 2151, 0, 2517, 7227, 3657, 0, 0, 0,
+    5058, 1773, 258, 5536, 4190, 3713, 0, 2954, 186, 0, 5308, 192, 3340, 2117, 7347, 0,
+    0, 5266, 0, 2754, 6125, 0, 0, 0, 3757, 2812, 0, 5147, 5675, 0, 225, 2128,
+    3456, 0, 1606, 0, 5541, 5973, 3732, 6321, 4427, 5641, 0, 2040, 0, 0, 0, 0,
+    0, 2572, 0, 0, 0, 0, 133, 0, 3272, 0, 0, 4271, 2890, 0, 2820, 5876,
+    3823, 2670, 0, 39, 1742, 0, 3064, 0, 6306, 0, 0, 4866, 0, 5788, 2176, 0,
+    4508, 0, 0, 0, 2479, 0, 0, 0, 0, 5241, 0, 2831, 2739, 5456, 0, 0,
+    5642, 0, 2283, 5827, 0, 1749, 0, 2825, 0, 0, 0, 1609, 6330, 0, 195, 2553,
+    0, 0, 0, 246, 1958, 0, 0, 0, 0, 0, 121, 0, 4228, 2866, 0, 0,
+    0, 3779, 308, 0, 313, 5229, 0, 5352, 3556, 2074, 0, 2911, 4262, 0, 0, 4512,
+    6022, 0, 4472, 224, 0, 4342, 0, 3383, 168, 0, 6355, 173, 2933, 315, 0, 2826,
+    4398, 2190, 0, 2227, 0, 2745, 3951, 2111, 2946, 0, 0, 0, 0, 0, 0, 3693,
+    0, 2208, 1822, 4659, 0, 80, 0, 0, 3261, 2482, 0, 4343, 12, 0, 0, 0,
+    2713, 5855, 0, 6104, 306, 0, 6230, 3011, 0, 112, 0, 0, 3936, 0, 2110, 0,
+    47, 0, 0, 2504, 0, 6414, 2728, 138, 38, 0, 0, 0, 4406, 0, 0, 0,
+    4701, 3696, 6727, 7109, 0, 6286, 99, 0, 0, 2771, 0, 2592, 1685, 4785, 2072, 5818,
+    6273, 4879, 0, 3105, 1691, 0, 1814, 0, 1846, 2986, 4042, 2348, 0, 0, 7131, 0,
+    0, 3228, 0, 2967, 4782, 5777, 6889, 0, 5746, 3683, 0, 4503, 27, 2315, 0, 0,
+    0, 2646, 314, 0, 0, 0, 0, 207, 5004, 4178, 2778, 6704, 3268, 0, 2657, 0,
+    0, 212, 0, 2858, 0, 6247, 0, 0, 3475, 6366, 0, 3110, 0, 5773, 5414, 0,
+    2699, 146, 2650, 1847, 2473, 0, 0, 0, 2923, 5412, 0, 0, 0, 257, 0, 2525,
+    4454, 5141, 6058, 0, 0, 2493, 0, 6089, 4773, 2787, 0, 1875, 0, 0, 0, 4527,
+    4741, 6238, 0, 237, 0, 4186, 0, 0, 177, 0, 319, 5768, 151, 0, 0, 2014,
+    0, 2387, 2149, 2768, 1919, 0, 0, 0, 7046, 40, 3452, 196, 0, 0, 6045, 7153,
+    0, 5090, 1952, 2998, 0, 2898, 0, 4726, 0, 5306, 0, 0, 6500, 0, 4683, 2879,
+    0, 5217, 0, 0, 5938, 188, 201, 4957, 5599, 3183, 1606, 320, 5545, 5391, 0, 4449,
+    0, 0, 0, 0, 0, 4506, 2547, 3144, 0, 0, 4687, 0, 0, 0, 2171, 6656,
+    3202, 2161, 133, 0, 0, 0, 0, 5698, 0, 0, 4210, 5326, 0, 6679, 0, 2765,
+    0, 1605, 0, 0, 0, 263, 1942, 4621, 0, 0, 0, 6002, 5120, 0, 0, 0,
+    1776, 0, 0, 2281, 5351, 5693, 0, 175, 0, 0, 3227, 0, 2688, 0, 0, 0,
+    0, 0, 3996, 238, 5491, 0, 0, 3040, 0, 0, 1986, 3296, 4129, 0, 0, 0,
+    3264, 298, 0, 6353, 0, 0, 0, 0, 2073, 3546, 1602, 3057, 5533, 3066, 3830, 0,
+    4234, 0, 0, 5121, 3427, 2910, 2641, 0, 0, 0, 0, 0, 2987, 78, 0, 0,
+    173, 223, 3782, 2424, 2821, 0, 4526, 2301, 282, 7119, 0, 0, 0, 0, 2096, 0,
+    0, 0, 4755, 1991, 0, 0, 0, 3629, 4678, 2239, 0, 287, 0, 0, 0, 0,
+    123, 7008, 2376, 0, 0, 2326, 0, 4270, 2814, 6074, 3990, 0, 0, 2095, 0, 6186,
+    0, 3390, 3135, 0, 0, 0, 0, 6069, 4718, 5993, 120, 0, 1611, 0, 0, 2711,
+    0, 6850, 5451, 4297, 1711, 7127, 2404, 3851, 97, 3632, 2085, 0, 0, 6222, 3948, 4750,
+    0, 0, 5803, 0, 0, 2590, 0, 6576, 6209, 0, 0, 62, 3364, 0, 0, 0,
+    0, 4422, 6031, 84, 4014, 3970, 5582, 3224, 5194, 0, 322, 0, 5762, 0, 3619, 0,
+    0, 0, 4488, 4747, 0, 0, 0, 2887, 0, 212, 1604, 0, 1632, 0, 2589, 0,
+    3573, 4969, 4934, 0, 0, 0, 0, 5889, 160, 0, 2008, 2185, 3686, 6536, 2418, 4382,
+    0, 6749, 3367, 0, 3108, 0, 4887, 5758, 3411, 0, 0, 1821, 5664, 0, 2791, 1978,
+    1668, 2012, 2459, 279, 2582, 0, 0, 0, 88, 4931, 2570, 0, 5946, 4578, 0, 1655,
+    3103, 5150, 0, 2732, 0, 0, 0, 0, 0, 4439, 1886, 0, 4077, 0, 248, 237,
+    6156, 0, 0, 2521, 1701, 3162, 0, 0, 5011, 59, 50, 7218, 0, 0, 0, 3354,
+    0, 0, 197, 0, 0, 0, 5053, 0, 0, 0, 0, 4202, 3497, 4321, 5445, 244,
+    3307, 2679, 2204, 0, 0, 1940, 2051, 0, 5536, 5077, 0, 0, 7386, 0, 5584, 0,
+    0, 3740, 2124, 0, 2812, 0, 0, 0, 0, 0, 0, 0, 0, 4162, 0, 0,
+    0, 3128, 0, 0, 108, 0, 5649, 0, 3294, 0, 3823, 0, 0, 0, 186, 0,
+    0, 6241, 0, 3166, 6196, 5250, 0, 0, 0, 0, 3711, 0, 0, 0, 0, 0,
+    225, 5644, 5247, 278, 0, 2673, 2179, 0, 43, 5675, 2721, 0, 0, 2631, 0, 0,
+    1820, 3227, 6340, 0, 0, 0, 6947, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2572, 0, 4520, 4101, 0, 0, 2831, 2283, 4885, 3262, 4271, 3780, 1697, 0, 3272, 1913,
+    1609, 1755, 0, 0, 3064, 0, 0, 6387, 5089, 0, 0, 3383, 0, 0, 0, 3874,
+    0, 1642, 2800, 0, 3062, 4351, 2975, 285, 0, 313, 0, 3219, 0, 0, 2745, 0,
+    5039, 0, 3958, 0, 0, 0, 0, 6635, 5386, 0, 2759, 0, 0, 1956, 2949, 0,
+    4663, 4345, 0, 2361, 0, 2482, 0, 0, 1601, 121, 0, 2963, 0, 2824, 3875, 3556,
+    3209, 0, 23, 0, 0, 0, 0, 0, 0, 119, 2000, 2911, 0, 0, 5978, 2620,
+    0, 2977, 4703, 141, 2432, 0, 3014, 0, 3966, 2968, 6733, 2713, 2933, 6234, 1694, 2083,
+    113, 2113, 3690, 0, 2508, 4874, 2635, 28, 6436, 47, 6276, 0, 317, 0, 218, 1822,
+    0, 2780, 4123, 0, 0, 0, 0, 0, 7143, 0, 2799, 0, 0, 0, 2967, 0,
+    0, 3684, 1855, 2110, 0, 5819, 27, 252, 3426, 0, 0, 0, 0, 0, 2887, 3098,
+    6898, 0, 0, 7253, 0, 0, 3669, 0, 98, 2969, 0, 2861, 6414, 7103, 3695, 65,
+    3622, 29, 0, 1682, 296, 0, 5088, 2646, 3481, 3194, 0, 2527, 3101, 1849, 6557, 4784,
+    2476, 0, 5629, 0, 251, 0, 1963, 2348, 2421, 0, 0, 0, 5380, 5771, 0, 0,
+    5776, 291, 4500, 183, 0, 2226, 4457, 2699, 211, 1744, 0, 210, 2926, 2568, 0, 0,
+    0, 248, 3909, 5141, 207, 0, 2880, 146, 0, 0, 4261, 0, 0, 6834, 226, 0,
+    269, 1875, 2390, 7037, 0, 3077, 0, 6246, 6561, 0, 2497, 0, 0, 0, 49, 2650,
+    2879, 0, 0, 0, 5410, 3357, 0, 0, 0, 0, 2020, 201, 2836, 4736, 6996, 0,
+    0, 3320, 3304, 7192, 5327, 0, 0, 3184, 0, 0, 0, 4491, 0, 0, 0, 2204,
+    0, 0, 3283, 2881, 4695, 274, 0, 3007, 0, 0, 0, 0, 0, 5959, 151, 108,
+    0, 6943, 0, 0, 2626, 5326, 2503, 0, 243, 2547, 3126, 1919, 5201, 2138, 0, 3770,
+    0, 0, 0, 0, 0, 5936, 0, 0, 290, 0, 1819, 2700, 0, 2164, 4681, 2998,
+    0, 0, 2996, 0, 0, 0, 3282, 5391, 5494, 0, 3183, 0, 4448, 0, 2206, 5127,
+    3061, 0, 3996, 3041, 0, 1687, 2922, 0, 110, 3264, 175, 2302, 232, 6679, 0, 2281,
+    4238, 0, 4315, 2255, 0, 0, 4876, 4210, 61, 1678, 3037, 0, 4647, 5122, 3794, 74,
+    0, 2250, 107, 4616, 0, 0, 200, 0, 5810, 1625, 0, 0, 7016, 0, 0, 2788,
+    2301, 4247, 0, 0, 0, 0, 5692, 2692, 4990, 3216, 2931, 0, 0, 53, 0, 4758,
+    1996, 2578, 0, 298, 2019, 7010, 0, 268, 2303, 0, 2919, 203, 4129, 0, 2615, 310,
+    0, 126, 5096, 208, 3057, 3546, 0, 3207, 0, 0, 3822, 0, 0, 0, 0, 0,
+    3427, 4718, 2469, 2910, 287, 0, 4274, 78, 5406, 6077, 2423, 0, 4027, 0, 0, 3626,
+    2711, 4942, 4526, 2908, 6190, 5195, 2098, 6032, 0, 0, 3857, 2634, 0, 0, 5994, 4719,
+    2557, 6212, 2723, 2238, 4445, 4675, 0, 4095, 0, 0, 2644, 0, 0, 3990, 2376, 3982,
+    295, 4018, 2414, 0, 5194, 300, 0, 305, 0, 5804, 2095, 0, 0, 0, 3620, 0,
+    6555, 3631, 0, 3382, 6033, 0, 1611, 3022, 3573, 0, 2076, 7072, 2964, 1898, 6521, 0,
+    156, 84, 5989, 1709, 6847, 1658, 5889, 6758, 2989, 5033, 5196, 5086, 3087, 3942, 2843, 4749,
+    5667, 3580, 3417, 6417, 2589, 1636, 6575, 164, 0, 2008, 2512, 1978, 3361, 0, 0, 4416,
+    0, 271, 3704, 5365, 3321, 6832, 0, 0, 2271, 0, 5895, 5761, 1825, 0, 277, 4485,
+    0, 4853, 3821, 0, 4590, 4442, 3009, 4429, 0, 0, 2583, 3355, 0, 0, 91, 4933,
+    7292, 0, 0, 0, 3250, 5108, 2449, 2732, 35, 0, 1787, 49, 0, 3075, 6151, 0,
+    5528, 6421, 2053, 269, 0, 0, 3366, 0, 0, 0, 3506, 1940, 0, 174, 0, 3175,
+    5443, 246, 0, 0, 6176, 0, 0, 0, 3244, 4575, 0, 5070, 0, 0, 0, 0,
+    0, 4088, 0, 0, 0, 2562, 0, 0, 247, 0, 4430, 2876, 0, 0, 0, 0,
+    2901, 0, 2518, 3294, 0, 0, 270, 0, 244, 0, 3611, 5278, 3381, 5966, 1876, 4321,
+    5051, 2027, 2961, 0, 0, 4196, 0, 0, 0, 2941, 0, 0, 0, 0, 0, 0,
+    2812, 0, 0, 5676, 5307, 3168, 2609, 71, 5257, 0, 0, 0, 3736, 0, 1922, 0,
+    0, 5757, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2721, 2921, 0, 194,
+    309, 5393, 3262, 0, 0, 4930, 1916, 3823, 0, 3903, 0, 2276, 0, 5985, 6196, 0,
+    0, 0, 1926, 6391, 0, 0, 0, 4646, 1676, 0, 0, 0, 2173, 178, 3346, 0,
+    5801, 0, 4213, 3883, 0, 199, 0, 0, 0, 5388, 6136, 0, 5643, 6400, 5092, 0,
+    0, 4482, 310, 2762, 0, 0, 2017, 2578, 1810, 0, 5560, 0, 0, 0, 0, 132,
+    0, 4101, 2776, 3877, 0, 0, 2220, 0, 2440, 0, 4885, 0, 0, 5355, 0, 2655,
+    0, 0, 4516, 0, 0, 0, 0, 2873, 3383, 4703, 2977, 0, 2745, 4132, 2853, 2789,
+    167, 0, 2827, 0, 6682, 1642, 0, 3209, 172, 3032, 0, 4927, 0, 5036, 0, 2781,
+    5971, 2947, 2660, 4660, 0, 2647, 2486, 193, 5979, 0, 4436, 3059, 4126, 2038, 2580, 0,
+    0, 0, 0, 2361, 0, 0, 4704, 3646, 2780, 21, 4344, 2515, 0, 239, 5031, 0,
+    2659, 0, 0, 0, 3700, 2341, 3993, 4789, 0, 4136, 0, 2107, 0, 6105, 69, 6415,
+    147, 2970, 252, 0, 139, 31, 5142, 2737, 2112, 2782, 2712, 1692, 3020, 4984, 161, 2527,
+    5634, 0, 3430, 4871, 0, 6274, 5781, 3156, 1680, 0, 6435, 5632, 0, 0, 2542, 1963,
+    5383, 5812, 0, 3098, 7137, 0, 0, 0, 0, 2528, 2669, 3640, 0, 289, 0, 267,
+    27, 0, 211, 0, 3030, 6584, 0, 0, 3194, 0, 4541, 0, 4498, 0, 0, 0,
+    3667, 1753, 0, 2859, 0, 5224, 0, 6844, 0, 2823, 0, 0, 1744, 6893, 0, 0,
+    0, 0, 0, 0, 6569, 0, 2548, 1717, 0, 1848, 0, 3101, 5526, 0, 0, 0,
+    0, 6866, 0, 1904, 0, 0, 0, 0, 0, 3275, 5408, 5769, 6061, 321, 2474, 0,
+    0, 5335, 0, 5611, 0, 2840, 2726, 0, 4455, 2388, 0, 3375, 0, 2882, 2023, 0,
+    2633, 0, 2626, 3909, 0, 4216, 3324, 0, 0, 1920, 0, 0, 0, 3076, 0, 0,
+    2604, 5371, 5546, 2820, 255, 2480, 0, 0, 241, 0, 0, 0, 0, 0, 75, 0,
+    4657, 0, 0, 266, 4324, 0, 38, 0, 201, 176, 2206, 5177, 3196, 0, 5941, 4207,
+    5208, 0, 0, 0, 0, 0, 0, 5571, 2809, 0, 5392, 0, 5976, 0, 0, 5711,
+    4691, 0, 0, 0, 0, 0, 110, 0, 0, 135, 4318, 2258, 1607, 0, 4921, 0,
+    5326, 3068, 4278, 0, 1781, 3770, 4211, 2072, 3798, 0, 0, 0, 57, 5165, 0, 0,
+    3025, 1838, 178, 5810, 3329, 224, 286, 4328, 0, 1678, 0, 0, 0, 0, 0, 4256,
+    2931, 3216, 0, 2744, 235, 0, 6087, 0, 3807, 0, 6199, 0, 5492, 0, 0, 1809,
+    0, 0, 4130, 2305, 126, 0, 2615, 3188, 0, 0, 3264, 0, 2685, 0, 254, 4876,
+    2425, 4279, 0, 0, 3058, 0, 0, 0, 0, 2142, 6485, 0, 4235, 3565, 0, 0,
+    0, 1808, 3207, 0, 5406, 4104, 1625, 2366, 2536, 2301, 0, 0, 6040, 0, 3826, 0,
+    0, 0, 16, 3031, 2250, 0, 4987, 0, 0, 4756, 231, 300, 37, 234, 4721, 2645,
+    0, 3095, 0, 295, 0, 0, 4098, 3602, 3991, 2009, 2513, 7009, 261, 1645, 2377, 4058,
+    0, 0, 4982, 0, 2898, 0, 0, 5916, 0, 0, 6470, 0, 145, 0, 0, 4108,
+    4718, 5197, 0, 1902, 6070, 184, 6854, 4036, 2843, 1774, 2777, 3636, 2097, 4900, 4940, 2414,
+    0, 6580, 185, 0, 5987, 4712, 3386, 0, 0, 2802, 0, 0, 0, 3582, 6210, 4812,
+    2077, 5368, 7363, 0, 5045, 0, 0, 4059, 3976, 0, 2523, 0, 6031, 0, 4015, 5897,
+    2990, 0, 0, 144, 0, 2667, 4592, 5751, 6444, 2160, 0, 0, 0, 0, 3337, 3159,
+    0, 0, 319, 4483, 3573, 5113, 5189, 6112, 0, 0, 0, 6862, 0, 0, 5111, 0,
+    2447, 230, 5889, 0, 202, 35, 6296, 0, 2546, 6519, 0, 6429, 6753, 5470, 0, 0,
+    5665, 0, 0, 0, 1978, 3371, 0, 5462, 0, 2690, 228, 0, 2462, 0, 5151, 1656,
+    3244, 5528, 3273, 1602, 0, 4569, 6167, 5320, 1877, 0, 4582, 0, 0, 247, 4092, 2565,
+    4440, 0, 4432, 3776, 0, 0, 0, 2545, 0, 0, 0, 0, 7287, 0, 0, 4847,
+    2154, 0, 2516, 0, 4322, 3611, 2094, 1787, 3254, 0, 0, 0, 0, 5309, 7411, 0,
+    0, 3501, 2902, 2941, 0, 73, 5297, 2754, 0, 0, 3002, 2052, 0, 1940, 0, 0,
+    2774, 0, 0, 0, 3912, 0, 0, 1600, 0, 0, 1606, 0, 0, 0, 0, 0,
+    0, 0, 0, 3294, 0, 133, 0, 0, 1947, 0, 0, 0, 0, 0, 2404, 0,
+    6805, 6197, 0, 0, 2184, 2279, 0, 0, 0, 0, 0, 3906, 2072, 1676, 6714, 0,
+    0, 0, 1934, 0, 0, 2986, 0, 0, 3346, 1830, 5801, 0, 3916, 0, 309, 3230,
+    0, 4005, 0, 0, 2441, 0, 6409, 2284, 3773, 0, 4482, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1631, 4102, 0, 0, 0, 3262, 0,
+    2222, 3559, 2853, 159, 0, 2625, 1603, 6483, 0, 0, 95, 6715, 1914, 0, 6388, 3260,
+    3548, 0, 0, 2914, 0, 0, 0, 2988, 1643, 2789, 0, 167, 2357, 173, 3462, 2442,
+    0, 0, 6373, 5387, 2760, 0, 87, 4563, 0, 0, 2580, 2042, 101, 3734, 2402, 2509,
+    1962, 0, 0, 4706, 7378, 3099, 60, 0, 0, 1628, 0, 6025, 0, 2515, 0, 0,
+    2007, 5002, 3876, 2362, 3463, 2252, 0, 0, 0, 5867, 0, 100, 0, 3153, 6131, 6239,
+    2341, 0, 0, 2977, 0, 4144, 0, 4703, 0, 6358, 0, 2714, 3208, 2898, 2741, 2679,
+    0, 2783, 4796, 0, 2006, 2662, 4925, 41, 7169, 0, 1613, 317, 6332, 0, 5041, 3315,
+    0, 6440, 2595, 0, 4870, 0, 4763, 0, 4124, 0, 0, 5825, 0, 2614, 0, 0,
+    0, 0, 0, 5792, 4996, 0, 2530, 5635, 0, 3165, 0, 265, 0, 2659, 0, 212,
+    0, 5600, 0, 0, 0, 4543, 0, 0, 5098, 5226, 4514, 2105, 4789, 66, 3673, 267,
+    5421, 6884, 0, 2669, 0, 2498, 0, 2527, 4947, 30, 0, 216, 0, 6878, 206, 0,
+    3112, 0, 5781, 0, 0, 0, 2540, 0, 0, 0, 0, 5630, 1963, 0, 0, 0,
+    0, 0, 232, 5381, 0, 0, 0, 187, 1602, 5337, 3305, 5526, 5547, 0, 0, 211,
+    4217, 0, 0, 0, 2730, 0, 237, 0, 0, 0, 0, 3029, 0, 0, 0, 1905,
+    0, 285, 0, 0, 6838, 0, 0, 0, 1743, 0, 2957, 5546, 3910, 2604, 0, 253,
+    0, 0, 0, 0, 0, 3576, 6565, 0, 0, 3137, 4657, 0, 0, 0, 0, 0,
+    0, 0, 0, 5856, 5548, 2216, 0, 0, 5892, 0, 5611, 1790, 3304, 0, 3766, 0,
+    5714, 2837, 0, 0, 1981, 5183, 266, 0, 2613, 0, 0, 0, 0, 176, 0, 0,
+    135, 0, 3072, 222, 2403, 1608, 0, 4207, 0, 3771, 6693, 1784, 5727, 2626, 0, 0,
+    4868, 0, 3838, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3329, 0,
+    4336, 2799, 0, 4287, 1794, 0, 0, 2206, 0, 3997, 2426, 5717, 3227, 3217, 3816, 3243,
+    0, 0, 2744, 0, 0, 0, 0, 1839, 0, 3122, 0, 0, 0, 0, 0, 0,
+    1621, 157, 2415, 3180, 4316, 7035, 130, 2869, 6371, 280, 0, 4281, 2256, 2963, 3839, 3610,
+    0, 3441, 1678, 3068, 3795, 4893, 0, 5810, 0, 0, 4233, 0, 0, 0, 0, 0,
+    0, 1626, 189, 85, 2427, 2975, 6495, 3398, 271, 0, 2251, 54, 7184, 0, 4251, 4528,
+    229, 3569, 3097, 16, 183, 1808, 2568, 0, 2931, 2366, 4689, 0, 1885, 5626, 2878, 2304,
+    0, 0, 0, 126, 6799, 2513, 2615, 0, 4967, 0, 5919, 0, 0, 306, 6082, 2937,
+    3047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4116, 3096, 6000, 5406, 3345, 0,
+    0, 4067, 0, 3399, 1778, 0, 0, 0, 2678, 6919, 0, 6134, 1729, 0, 5325, 96,
+    0, 4715, 0, 184, 0, 218, 4720, 0, 0, 4907, 0, 4992, 0, 0, 0, 0,
+    4096, 0, 4061, 7402, 0, 2875, 307, 272, 0, 215, 0, 0, 5585, 0, 2803, 0,
+    4013, 5754, 0, 0, 0, 3163, 0, 0, 0, 3121, 300, 0, 2887, 0, 0, 0,
+    0, 5191, 4031, 1899, 2160, 0, 1819, 2843, 2623, 144, 5152, 0, 7357, 4792, 6034, 2667,
+    3718, 6525, 1878, 6744, 0, 2556, 5470, 5114, 0, 0, 0, 3581, 0, 0, 4900, 0,
+    0, 0, 1877, 0, 2300, 5896, 0, 2849, 2243, 5366, 0, 0, 2455, 0, 1764, 5151,
+    248, 0, 0, 3785, 5322, 2340, 0, 233, 2573, 3186, 5310, 4859, 4591, 4572, 3285, 2637,
+    4272, 0, 0, 2140, 5153, 0, 4307, 7298, 274, 0, 285, 0, 0, 1879, 0, 50,
+    0, 7273, 0, 4975, 6152, 1788, 0, 0, 0, 2501, 6425, 5309, 243, 2545, 0, 0,
+    0, 5460, 3006, 2754, 0, 2815, 203, 0, 3257, 0, 0, 0, 0, 3492, 2270, 3043,
+    273, 1606, 0, 0, 0, 0, 0, 0, 0, 0, 2563, 4089, 1966, 247, 2204, 2612,
+    0, 4431, 1600, 133, 0, 0, 0, 0, 0, 0, 4006, 0, 2965, 0, 6030, 108,
+    0, 0, 2285, 5271, 0, 3611, 0, 4866, 0, 2187, 24, 0, 0, 3051, 0, 2941,
+    0, 0, 0, 72, 0, 0, 2644, 0, 0, 2194, 4005, 0, 3002, 200, 0, 2702,
+    3142, 6723, 0, 0, 0, 0, 1831, 2284, 1823, 0, 3924, 0, 0, 0, 0, 0,
+    3904, 0, 0, 2934, 2710, 0, 61, 4007, 0, 0, 0, 5985, 6805, 2286, 0, 7220,
+    1631, 143, 1699, 2074, 2490, 242, 2277, 6717, 1676, 0, 5086, 0, 4878, 2918, 2603, 2956,
+    2800, 2629, 6386, 7238, 292, 3346, 0, 1930, 2988, 179, 6383, 159, 2413, 5362, 5801, 3087,
+    0, 0, 6404, 4482, 5747, 6137, 2126, 0, 173, 2487, 0, 2715, 4818, 0, 183, 3552,
+    0, 0, 0, 4428, 5105, 2733, 87, 2877, 0, 3471, 2221, 0, 7223, 2440, 0, 6687,
+    3559, 312, 0, 0, 0, 6243, 262, 2853, 4537, 5870, 4790, 305, 0, 2357, 0, 0,
+    6085, 3328, 3465, 3175, 2789, 6141, 174, 2435, 167, 45, 3731, 128, 2914, 6779, 6317, 5316,
+    2716, 0, 2635, 3153, 4563, 0, 2580, 2833, 4705, 6252, 5256, 103, 5972, 5825, 2559, 311,
+    2006, 0, 0, 0, 0, 307, 3716, 0, 5603, 1617, 2515, 2868, 2341, 7208, 2039, 0,
+    2502, 0, 5831, 5251, 3315, 2846, 2471, 0, 3073, 100, 0, 4140, 3119, 3435, 212, 3085,
+    2618, 205, 5021, 221, 0, 0, 0, 0, 2602, 0, 2738, 64, 3165, 71, 0, 265,
+    7163, 5421, 0, 4218, 3116, 2661, 4795, 15, 0, 5782, 0, 5091, 0, 6958, 5099, 0,
+    0, 3527, 0, 0, 0, 6612, 304, 0, 0, 0, 0, 0, 0, 2529, 2291, 0,
+    3297, 3173, 0, 5791, 4511, 0, 2228, 2273, 0, 0, 237, 4217, 0, 0, 5379, 1745,
+    6680, 4542, 0, 0, 0, 0, 0, 2168, 0, 0, 0, 2668, 0, 3867, 0, 0,
+    0, 0, 269, 5591, 1874, 4468, 0, 3012, 2770, 0, 3018, 0, 3079, 49, 4219, 0,
+    4902, 0, 0, 3327, 2017, 0, 0, 0, 203, 6872, 0, 0, 0, 0, 3317, 0,
+    0, 0, 5550, 0, 5612, 5336, 0, 0, 0, 0, 2677, 0, 0, 0, 0, 0,
+    2727, 0, 0, 2867, 3274, 0, 2835, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5733, 3766, 6021, 2957, 3055, 2779, 5546, 3998, 5968, 2036, 2604, 0, 0, 2658, 3428,
+    0, 0, 0, 0, 0, 0, 0, 4657, 0, 0, 0, 2644, 0, 5856, 0, 1802,
+    2156, 3997, 239, 0, 2700, 3309, 236, 0, 3141, 3227, 14, 3847, 0, 5712, 0, 0,
+    303, 0, 135, 0, 5774, 0, 3246, 7039, 0, 3020, 2924, 0, 3987, 3999, 0, 217,
+    6693, 132, 4974, 2776, 281, 3267, 5976, 1782, 0, 143, 0, 3841, 4868, 3069, 0, 6563,
+    0, 0, 2591, 3811, 0, 4647, 4332, 3793, 5626, 1621, 3195, 185, 122, 3329, 0, 2975,
+    172, 6808, 3614, 0, 2788, 0, 157, 5716, 2744, 6088, 52, 4896, 3086, 7057, 3030, 4242,
+    4769, 0, 0, 0, 0, 1753, 2578, 4426, 2021, 0, 3407, 0, 3150, 0, 2869, 0,
+    0, 7042, 6802, 0, 0, 5096, 2425, 0, 85, 127, 310, 1706, 0, 2750, 0, 4280,
+    0, 4725, 0, 0, 0, 0, 0, 2406, 3401, 0, 0, 3441, 3174, 174, 6812, 0,
+    0, 6092, 283, 190, 6489, 2978, 2090, 3562, 4528, 5207, 0, 0, 0, 6041, 0, 16,
+    6006, 0, 302, 0, 3096, 3349, 2723, 2557, 0, 4446, 0, 4686, 0, 218, 0, 0,
+    6148, 0, 5588, 0, 2513, 4566, 0, 306, 5917, 0, 0, 5202, 2704, 2480, 0, 0,
+    0, 0, 171, 0, 2887, 4112, 0, 7369, 0, 6610, 0, 0, 4713, 0, 3023, 0,
+    5160, 1775, 2954, 0, 3163, 192, 1897, 4022, 71, 0, 3728, 1727, 2120, 0, 0, 0,
+    0, 3786, 0, 5690, 0, 0, 0, 0, 0, 0, 0, 0, 1985, 4060, 0, 5682,
+    0, 2243, 0, 1607, 3295, 4906, 0, 3750, 5752, 0, 0, 4804, 2271, 0, 1887, 0,
+    0, 248, 3785, 0, 0, 2576, 50, 2159, 3034, 2890, 0, 4276, 0, 0, 5154, 0,
+    0, 3824, 0, 0, 3787, 0, 0, 1765, 1881, 7281, 5470, 5364, 6075, 2344, 5107, 4206,
+    0, 5529, 0, 0, 2681, 0, 0, 0, 2479, 3074, 241, 0, 0, 5465, 1877, 0,
+    0, 0, 0, 2819, 0, 2150, 5455, 0, 0, 6170, 0, 0, 5321, 0, 0, 2204,
+    0, 4570, 2866, 3114, 0, 0, 0, 2622, 0, 0, 4087, 0, 0, 0, 0, 2561,
+    0, 2999, 0, 4227, 5231, 108, 0, 0, 0, 0, 0, 0, 4975, 0, 0, 198,
+    3053, 5966, 2656, 0, 3384, 5309, 2027, 219, 0, 0, 0, 235, 2754, 5273, 3095, 0,
+    0, 0, 0, 2702, 2815, 0, 4050, 261, 12, 4393, 0, 0, 170, 239, 1606, 3003,
+    0, 0, 0, 1827, 5759, 2208, 0, 0, 0, 0, 61, 0, 0, 0, 0, 0,
+    3205, 2769, 4378, 3986, 194, 133, 2288, 112, 4009, 2747, 0, 2358, 2199, 6806, 2084, 1699,
+    0, 0, 131, 4866, 0, 0, 6423, 0, 0, 0, 2945, 0, 0, 0, 5362, 2800,
+    0, 0, 0, 178, 7247, 3920, 2349, 2959, 0, 2607, 2611, 6696, 2284, 2534, 0, 4005,
+    6281, 0, 3211, 3154, 6395, 0, 0, 0, 0, 0, 4881, 0, 1813, 0, 3030, 213,
+    0, 0, 36, 6102, 6716, 6690, 2318, 5105, 0, 7217, 0, 230, 3560, 2074, 318, 0,
+    169, 0, 0, 3654, 0, 5414, 1689, 0, 0, 2915, 2988, 158, 0, 0, 6266, 0,
+    5444, 2443, 2690, 4173, 6700, 173, 4564, 262, 0, 312, 6377, 0, 5259, 0, 0, 6026,
+    0, 2123, 256, 2833, 2635, 2649, 4816, 6099, 5970, 0, 3444, 0, 193, 2559, 86, 0,
+    5868, 0, 0, 7222, 4158, 0, 0, 3738, 2517, 6261, 4531, 3332, 3253, 2857, 0, 3655,
+    191, 5833, 6240, 2118, 0, 2714, 0, 0, 0, 3438, 0, 0, 2871, 3464, 0, 3139,
+    2471, 0, 0, 6048, 1928, 0, 7175, 6120, 150, 42, 5261, 102, 5145, 2736, 3746, 2768,
+    0, 5094, 5766, 0, 1952, 5641, 3448, 5825, 1746, 2596, 5601, 0, 0, 6622, 0, 6315,
+    0, 0, 0, 1943, 0, 188, 0, 0, 0, 0, 1607, 0, 19, 4800, 5398, 2176,
+    2273, 212, 2670, 3084, 2381, 4262, 4518, 3109, 0, 1745, 6649, 0, 5795, 4505, 0, 2228,
+    315, 0, 3297, 0, 6684, 3164, 0, 0, 0, 0, 49, 0, 0, 0, 0, 4221,
+    0, 6953, 3767, 0, 2825, 3081, 0, 5421, 0, 6629, 0, 0, 0, 0, 269, 2551,
+    0, 1747, 0, 0, 0, 0, 0, 3117, 0, 0, 3238, 0, 0, 0, 5592, 1603,
+    0, 0, 3276, 0, 0, 0, 4138, 0, 237, 0, 0, 3547, 0, 3172, 0, 0,
+    4217, 0, 0, 2504, 0, 0, 0, 0, 5846, 0, 4466, 0, 6352, 2725, 0, 0,
+    3689, 0, 0, 2402, 2770, 3432, 99, 4391, 231, 0, 0, 0, 2036, 0, 0, 0,
+    0, 0, 0, 77, 1622, 3095, 2242, 0, 0, 4042, 0, 0, 261, 5549, 2700, 5857,
+    0, 0, 7114, 0, 3228, 0, 6230, 0, 0, 5774, 0, 0, 0, 0, 0, 293,
+    217, 0, 0, 6694, 0, 0, 4001, 314, 38, 0, 3270, 0, 1612, 0, 138, 301,
+    5993, 0, 5730, 0, 0, 0, 6279, 7099, 6882, 1681, 0, 4647, 4754, 0, 0, 95,
+    0, 0, 3065, 1798, 0, 0, 5813, 1846, 0, 0, 4977, 2986, 7066, 2788, 3997, 0,
+    0, 0, 0, 0, 6595, 0, 0, 272, 6217, 3802, 4499, 3152, 0, 2578, 2493, 0,
+    2347, 0, 0, 6067, 0, 2025, 0, 0, 4171, 0, 310, 60, 5096, 0, 3267, 5720,
+    0, 0, 0, 0, 3840, 3442, 0, 0, 6560, 2428, 0, 7036, 3048, 4938, 0, 0,
+    6820, 3574, 0, 3151, 5626, 4666, 230, 5409, 2689, 0, 0, 2975, 2367, 6202, 0, 0,
+    3206, 187, 4446, 4890, 5210, 5545, 2791, 0, 0, 4767, 4529, 0, 1979, 0, 4732, 2723,
+    0, 0, 4693, 279, 0, 299, 0, 2392, 1663, 127, 0, 2557, 6800, 249, 2011, 7041,
+    0, 0, 6498, 3251, 0, 2407, 0, 3200, 0, 1698, 0, 3132, 0, 0, 0, 4330,
+    0, 0, 0, 2898, 4725, 6000, 3400, 0, 0, 7231, 3027, 0, 0, 5212, 5162, 0,
+    1733, 0, 2088, 0, 1773, 0, 5063, 197, 0, 0, 0, 5690, 0, 218, 2567, 1648,
+    1941, 6645, 0, 238, 4832, 0, 0, 3307, 1608, 2613, 0, 0, 0, 0, 0, 0,
+    0, 3762, 2132, 0, 2271, 0, 5696, 2161, 5586, 0, 0, 0, 3830, 0, 0, 0,
+    0, 2887, 5530, 4612, 0, 5120, 0, 0, 0, 3828, 0, 0, 0, 0, 3295, 0,
+    2424, 0, 0, 1888, 0, 0, 3789, 0, 3177, 5253, 1742, 0, 3722, 0, 0, 5529,
+    278, 0, 0, 0, 5680, 0, 0, 0, 0, 0, 0, 1985, 0, 0, 0, 5457,
+    0, 0, 0, 0, 2243, 0, 1602, 5828, 0, 0, 0, 5531, 276, 0, 2952, 3785,
+    2150, 2574, 4110, 2600, 0, 0, 248, 0, 0, 4273, 4230, 0, 2811, 1697, 3390, 0,
+    0, 0, 3388, 2622, 7112, 7277, 50, 1880, 0, 97, 0, 2402, 0, 0, 3779, 3625,
+    0, 48, 2999, 0, 3062, 2027, 229, 0, 4674, 4051, 3219, 0, 0, 168, 0, 0,
+    3198, 2816, 0, 2227, 6186, 4403, 0, 5290, 219, 3953, 0, 0, 0, 2204, 0, 0,
+    194, 0, 0, 0, 5759, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2183, 0, 0, 3011, 0, 5582, 4932, 1610, 3938, 280, 119, 0, 0, 6215, 0, 0,
+    6742, 2404, 2758, 0, 0, 0, 5978, 0, 2972, 0, 0, 0, 178, 0, 3360, 4410,
+    0, 2772, 115, 0, 33, 2702, 2864, 0, 0, 2453, 6291, 6455, 2948, 0, 1824, 0,
+    0, 0, 4484, 0, 0, 0, 0, 1816, 0, 0, 4008, 1632, 61, 0, 0, 0,
+    0, 5150, 2611, 2287, 0, 0, 4376, 4888, 59, 3683, 5009, 2349, 4782, 4923, 213, 1699,
+    160, 0, 6420, 0, 2800, 0, 0, 0, 2845, 0, 1661, 3285, 4183, 6708, 3186, 0,
+    216, 3490, 3663, 0, 318, 0, 5773, 0, 3032, 0, 0, 5362, 7242, 5068, 5536, 88,
+    296, 2923, 0, 1964, 2570, 1886, 2652, 193, 5308, 0, 0, 257, 4822, 187, 0, 0,
+    0, 7227, 2517, 2140, 6688, 2103, 3657, 0, 0, 0, 3210, 0, 0, 0, 0, 2666,
+    215, 0, 3130, 0, 6238, 2884, 0, 4190, 5444, 0, 2436, 0, 226, 0, 2538, 0,
+    2679, 3253, 0, 0, 7050, 3918, 3043, 2717, 2177, 5147, 2860, 40, 6256, 3456, 2671, 153,
+    0, 2559, 5641, 2226, 2128, 6321, 4156, 0, 2475, 2612, 2635, 0, 4728, 0, 2833, 0,
+    2176, 1608, 3271, 2283, 3283, 2831, 0, 0, 3184, 4494, 0, 0, 5647, 0, 2670, 258,
+    1755, 0, 0, 0, 1609, 0, 3436, 4508, 0, 0, 0, 0, 5832, 5241, 3051, 0,
+    0, 1925, 2178, 2672, 3109, 2627, 2553, 5204, 308, 2138, 2944, 0, 6964, 4263, 313, 1749,
+    0, 6003, 0, 0, 0, 6939, 0, 0, 0, 1942, 0, 6616, 0, 1820, 0, 0,
+    2490, 4342, 0, 5396, 0, 0, 0, 3874, 3238, 0, 303, 3276, 2228, 0, 2273, 5352,
+    0, 288, 3041, 0, 4877, 1745, 6681, 0, 0, 4472, 0, 1988, 0, 281, 2922, 297,
+    285, 3547, 0, 0, 4349, 3951, 2482, 6355, 0, 2713, 3012, 2111, 292, 6231, 4220, 49,
+    3080, 0, 0, 0, 0, 113, 0, 1687, 0, 5846, 195, 6625, 47, 80, 2505, 4659,
+    0, 0, 0, 0, 0, 0, 0, 0, 3196, 0, 0, 2932, 0, 7124, 0, 6230,
+    0, 4135, 0, 0, 3140, 0, 0, 0, 1992, 0, 0, 0, 0, 0, 2616, 0,
+    123, 208, 6074, 138, 0, 4043, 6232, 0, 0, 0, 0, 0, 5968, 38, 0, 2968,
+    0, 6886, 2036, 3689, 3429, 2469, 293, 2072, 0, 0, 240, 0, 0, 0, 28, 190,
+    1846, 7131, 3316, 302, 2986, 1612, 3263, 0, 2700, 0, 0, 2799, 0, 0, 0, 5997,
+    0, 6227, 6904, 2494, 4445, 3240, 3085, 3119, 0, 0, 0, 2699, 0, 0, 5774, 1853,
+    0, 2924, 4000, 217, 65, 0, 3268, 146, 2347, 0, 0, 5141, 2602, 0, 6889, 7097,
+    6567, 4747, 3619, 5088, 0, 1681, 0, 1875, 0, 4647, 3578, 2076, 0, 0, 6554, 3077,
+    0, 0, 2367, 3587, 5813, 2844, 3284, 3185, 5306, 7061, 6541, 2989, 3173, 3232, 2788, 2418,
+    0, 6590, 4499, 0, 0, 1983, 5758, 4773, 3151, 4669, 183, 2568, 3019, 2578, 0, 0,
+    310, 1673, 4261, 2022, 4931, 2369, 0, 2014, 7046, 277, 2880, 2139, 0, 0, 0, 0,
+    0, 2898, 5948, 0, 0, 2547, 4597, 4726, 6500, 0, 299, 2501, 249, 3073, 0, 0,
+    3354, 3009, 6816, 0, 5409, 0, 0, 1702, 3251, 0, 0, 1796, 0, 3042, 6158, 4957,
+    4731, 2162, 0, 0, 5327, 0, 4446, 0, 2557, 0, 6007, 2723, 4841, 2836, 0, 0,
+    0, 3106, 2601, 5446, 0, 3996, 0, 0, 0, 0, 307, 5082, 175, 5698, 0, 0,
+    0, 0, 2281, 0, 2161, 3123, 0, 0, 0, 0, 0, 0, 3089, 3051, 2503, 0,
+    5120, 0, 2901, 0, 0, 0, 14, 0, 2163, 0, 2151, 0, 74, 0, 4327, 0,
+    3831, 3612, 0, 5057, 4746, 0, 5690, 186, 5491, 4240, 0, 0, 5126, 0, 2692, 1819,
+    0, 0, 0, 5685, 225, 3024, 0, 0, 0, 1986, 0, 2302, 3756, 0, 0, 5265,
+    282, 0, 2337, 2271, 2921, 5533, 1602, 0, 4234, 0, 2765, 0, 2490, 0, 1605, 0,
+    3825, 0, 0, 0, 287, 0, 53, 0, 0, 3782, 4271, 0, 7014, 3272, 0, 4930,
+    0, 0, 3788, 2096, 2952, 6075, 0, 6187, 2711, 0, 0, 3347, 5529, 2600, 0, 292,
+    3391, 0, 2019, 0, 0, 0, 2811, 0, 0, 0, 203, 0, 5456, 0, 0, 3150,
+    0, 0, 3963, 0, 0, 2746, 6186, 0, 0, 3319, 5563, 0, 0, 0, 236, 3140,
+    4107, 13, 0, 4228, 223, 6032, 0, 4020, 6746, 0, 0, 0, 0, 155, 0, 121,
+    3556, 0, 0, 2824, 5195, 0, 0, 0, 3385, 0, 6188, 5966, 0, 2911, 3625, 2027,
+    3015, 0, 0, 0, 120, 4674, 2589, 0, 1633, 2644, 1610, 2933, 5582, 3198, 3970, 83,
+    4397, 4014, 0, 4436, 2190, 6764, 3692, 3142, 2664, 3085, 0, 161, 5759, 2761, 5982, 2785,
+    1822, 4382, 0, 0, 192, 1632, 3022, 0, 0, 194, 2732, 221, 6414, 2532, 0, 0,
+    5988, 0, 4932, 7275, 2110, 3686, 143, 3936, 0, 2864, 0, 5086, 0, 6427, 6749, 0,
+    3075, 0, 3360, 1634, 5664, 0, 0, 0, 178, 0, 3103, 4484, 3494, 162, 0, 4406,
+    6285, 3696, 3173, 0, 4785, 5634, 6166, 88, 1684, 5016, 0, 3087, 1968, 6450, 2570, 0,
+    0, 0, 1814, 0, 0, 1886, 0, 2889, 2348, 3512, 4429, 3821, 2522, 89, 2927, 0,
+    0, 5777, 5011, 0, 0, 0, 3161, 0, 4502, 0, 4548, 0, 2448, 0, 0, 0,
+    0, 0, 2479, 3497, 0, 2823, 207, 5445, 4177, 174, 6704, 0, 0, 259, 2679, 0,
+    0, 0, 0, 3167, 0, 0, 0, 3032, 0, 3212, 6247, 0, 0, 3110, 0, 0,
+    2650, 0, 193, 0, 0, 0, 2866, 4162, 0, 5411, 2541, 1904, 2517, 0, 5222, 0,
+    3656, 0, 5618, 0, 0, 2721, 5649, 0, 3166, 0, 0, 3381, 0, 4740, 0, 0,
+    0, 3452, 0, 0, 0, 0, 4186, 2631, 151, 5641, 3252, 1932, 5371, 0, 0, 2179,
+    255, 2149, 12, 2673, 258, 2605, 0, 1919, 2207, 3915, 71, 1756, 2756, 1820, 0, 6947,
+    6393, 0, 5090, 0, 0, 0, 0, 0, 0, 0, 0, 3128, 0, 2998, 0, 0,
+    5216, 264, 0, 5401, 3282, 3874, 111, 3298, 0, 5391, 294, 0, 0, 301, 4449, 6387,
+    0, 0, 6655, 0, 4506, 0, 0, 0, 0, 4921, 0, 0, 0, 0, 285, 4351,
+    2825, 0, 6679, 3881, 3209, 2997, 0, 0, 1748, 4877, 4210, 0, 0, 2171, 5167, 6635,
+    0, 1838, 0, 3330, 0, 263, 4620, 0, 0, 3150, 0, 0, 2017, 0, 0, 2483,
+    4342, 0, 0, 0, 2308, 0, 3317, 3276, 0, 0, 3646, 5351, 0, 0, 0, 195,
+    0, 142, 4142, 2000, 0, 0, 0, 3040, 254, 0, 4129, 0, 2620, 0, 3057, 0,
+    2968, 0, 6353, 0, 6234, 0, 0, 3546, 0, 3690, 2781, 2976, 0, 3205, 2111, 0,
+    2536, 3427, 0, 0, 0, 252, 2910, 245, 0, 0, 78, 4659, 28, 0, 0, 0,
+    0, 3628, 0, 0, 3196, 0, 2799, 0, 6913, 239, 6230, 17, 4526, 7118, 6078, 0,
+    1677, 0, 36, 0, 0, 3194, 1855, 284, 0, 0, 65, 0, 3020, 4677, 0, 2909,
+    3990, 38, 2737, 0, 6473, 2376, 138, 7103, 6038, 0, 1952, 0, 3622, 2095, 5088, 0,
+    1682, 6883, 2072, 188, 4904, 6557, 1744, 0, 5814, 1611, 0, 2802, 156, 1846, 0, 0,
+    6601, 0, 1714, 6849, 5380, 5991, 7127, 3596, 0, 4750, 0, 3632, 4500, 6221, 2986, 5910,
+    2079, 0, 2568, 6576, 183, 256, 4261, 0, 0, 0, 0, 0, 2888, 2371, 2880, 5629,
+    1753, 2993, 3224, 84, 0, 6834, 3321, 0, 0, 6888, 0, 3363, 0, 0, 4606, 5762,
+    1715, 5113, 0, 4487, 0, 0, 4711, 3575, 191, 0, 0, 0, 0, 5410, 0, 3357,
+    0, 4934, 2451, 6056, 2367, 202, 0, 0, 0, 0, 0, 5327, 5471, 0, 6535, 0,
+    1980, 0, 5749, 3108, 0, 2836, 4736, 0, 0, 228, 3367, 2726, 0, 0, 1667, 0,
+    4306, 0, 4577, 5946, 307, 2012, 6179, 5187, 0, 2503, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2480, 3126, 0, 6499, 0, 0, 0, 0, 0, 3107, 0, 2898, 0,
+    12, 1793, 0, 2520, 4334, 3616, 0, 244, 2094, 0, 3162, 4321, 2164, 7433, 0, 0,
+    0, 3188, 3287, 0, 4244, 2205, 3800, 1819, 1971, 2905, 0, 0, 0, 0, 4836, 0,
+    0, 5127, 2302, 0, 0, 2812, 0, 0, 5697, 0, 0, 1607, 109, 0, 0, 2255,
+    0, 0, 0, 4278, 0, 0, 3794, 2693, 0, 4616, 0, 0, 2142, 53, 0, 0,
+    0, 6814, 0, 0, 0, 0, 0, 0, 0, 3823, 0, 3007, 0, 4247, 7016, 5802,
+    3207, 2765, 0, 6196, 0, 3351, 0, 1605, 1830, 0, 0, 0, 0, 2019, 0, 0,
+    0, 0, 0, 3230, 0, 322, 203, 0, 0, 0, 0, 234, 2293, 1602, 0, 0,
+    0, 0, 0, 5532, 3602, 4234, 0, 0, 0, 0, 4114, 0, 4665, 0, 3565, 2414,
+    6190, 4101, 0, 0, 0, 2790, 5882, 0, 4885, 0, 4024, 3780, 0, 5195, 0, 3260,
+    2096, 0, 0, 3626, 3063, 1642, 0, 0, 231, 3383, 4675, 0, 0, 0, 2581, 0,
+    2745, 2044, 2644, 223, 2828, 3957, 4058, 0, 5921, 2919, 2705, 0, 257, 105, 0, 3142,
+    5038, 0, 6186, 2949, 6773, 0, 4345, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4662, 3022, 3337, 35, 4027, 1898, 0, 0, 5033, 2361, 2404, 0, 3942, 6023, 6847, 197,
+    143, 0, 4416, 0, 0, 3307, 1951, 6743, 6109, 6361, 0, 6417, 2454, 4810, 0, 1636,
+    0, 0, 0, 5365, 4014, 0, 5086, 188, 7312, 5582, 3966, 3704, 316, 4649, 3361, 2113,
+    6461, 0, 0, 0, 0, 4485, 5861, 4873, 2350, 5528, 0, 6436, 3156, 0, 0, 0,
+    0, 0, 0, 3521, 1632, 0, 91, 5638, 2967, 6110, 3821, 4429, 5108, 0, 160, 230,
+    6748, 7272, 0, 0, 27, 0, 0, 3684, 278, 5098, 0, 0, 0, 0, 0, 0,
+    2690, 3175, 4557, 5664, 2593, 174, 0, 227, 2458, 0, 2861, 6294, 6897, 88, 0, 3491,
+    0, 0, 4575, 5422, 0, 0, 5288, 0, 1849, 0, 2570, 0, 4088, 2562, 2476, 1965,
+    0, 0, 182, 0, 0, 1886, 0, 0, 3305, 3866, 3101, 2518, 3293, 1944, 0, 5010,
+    0, 0, 0, 0, 3381, 0, 0, 3254, 0, 1922, 0, 0, 0, 4196, 1908, 3062,
+    0, 0, 3219, 0, 3496, 0, 0, 2679, 3922, 0, 2961, 71, 2609, 3168, 0, 253,
+    0, 0, 3909, 309, 0, 0, 0, 0, 6397, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2216, 0, 2879, 0, 0, 1945, 0, 0, 0, 201, 5616, 0, 0, 0,
+    0, 0, 119, 0, 270, 5393, 2276, 5648, 0, 0, 3298, 6714, 6702, 0, 5977, 0,
+    0, 3128, 0, 222, 2173, 0, 0, 0, 111, 0, 0, 2628, 0, 3883, 3300, 264,
+    2810, 4213, 26, 2441, 5326, 6400, 0, 0, 0, 0, 3770, 0, 0, 181, 0, 6943,
+    3334, 0, 0, 0, 0, 0, 0, 2017, 3217, 1820, 322, 2997, 0, 0, 0, 0,
+    3874, 2873, 1842, 0, 1603, 0, 0, 5355, 5493, 0, 0, 0, 6387, 0, 0, 0,
+    3548, 4350, 0, 0, 4656, 4132, 0, 3647, 0, 0, 296, 0, 3462, 5847, 285, 0,
+    2402, 0, 5036, 4876, 0, 2781, 0, 199, 4237, 3450, 2660, 2029, 3059, 0, 5122, 1962,
+    0, 0, 0, 0, 5872, 4660, 0, 2579, 134, 0, 2038, 1625, 0, 279, 0, 0,
+    0, 21, 0, 0, 0, 2250, 239, 0, 0, 2737, 4867, 3130, 5786, 2878, 0, 1996,
+    0, 0, 0, 0, 139, 2617, 4989, 70, 3020, 7010, 2379, 3993, 0, 0, 0, 0,
+    1613, 41, 0, 267, 4945, 1677, 4984, 2669, 6233, 28, 0, 4871, 7137, 0, 0, 6001,
+    0, 0, 3306, 4718, 2909, 0, 4761, 0, 0, 0, 0, 0, 5325, 0, 0, 3283,
+    3184, 3640, 2098, 2799, 0, 0, 6908, 0, 1723, 0, 4916, 0, 6859, 4490, 3030, 6584,
+    65, 5526, 0, 1854, 0, 0, 0, 0, 0, 0, 0, 1753, 2806, 6031, 216, 0,
+    186, 0, 4017, 5194, 6893, 220, 3275, 6555, 3620, 2086, 2138, 0, 1717, 0, 0, 0,
+    0, 4901, 0, 3573, 278, 0, 0, 0, 2244, 6866, 5629, 3239, 5380, 0, 0, 0,
+    5474, 6547, 225, 0, 187, 0, 6757, 5116, 5547, 0, 3591, 5889, 3041, 2419, 0, 2841,
+    183, 233, 2568, 3375, 2726, 1978, 4261, 2300, 2370, 0, 266, 0, 3118, 1687, 2465, 1764,
+    0, 0, 5951, 6832, 4207, 2480, 176, 4587, 3271, 0, 4601, 2640, 0, 0, 0, 0,
+    3134, 0, 0, 0, 3062, 0, 4310, 0, 3218, 0, 3355, 0, 0, 0, 0, 0,
+    7291, 4979, 2613, 1800, 5177, 0, 0, 5711, 0, 1787, 0, 5327, 0, 0, 6161, 2942,
+    3107, 3804, 0, 0, 4324, 0, 2836, 0, 3505, 0, 208, 0, 1940, 2053, 0, 0,
+    1607, 273, 0, 0, 0, 0, 3124, 0, 4278, 0, 119, 0, 2469, 2503, 3054, 286,
+    2820, 0, 0, 3838, 0, 0, 0, 3189, 2908, 0, 0, 0, 2965, 0, 6030, 0,
+    58, 24, 109, 3613, 5492, 0, 4241, 3007, 297, 5277, 4285, 6199, 2930, 3807, 0, 0,
+    1819, 0, 2143, 0, 3566, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2426, 0,
+    1808, 2366, 0, 0, 0, 0, 1834, 0, 5802, 0, 0, 0, 4967, 296, 2302, 2255,
+    2934, 3565, 2075, 0, 0, 3045, 3794, 0, 4104, 0, 0, 0, 4235, 0, 0, 6811,
+    7015, 2854, 1700, 3398, 6485, 3603, 5882, 3567, 0, 224, 4246, 0, 4987, 0, 53, 0,
+    6390, 0, 3348, 4665, 231, 3095, 0, 0, 5884, 2019, 179, 229, 1645, 0, 184, 0,
+    203, 3319, 277, 0, 0, 0, 261, 4058, 2709, 0, 3261, 0, 0, 2935, 2336, 7383,
+    2762, 0, 2581, 0, 0, 0, 0, 2877, 2047, 226, 4428, 2919, 0, 0, 0, 0,
+    4065, 1774, 3877, 2364, 207, 0, 0, 6032, 0, 6189, 144, 2160, 2667, 0, 4021, 6131,
+    0, 0, 0, 0, 0, 0, 4812, 2644, 2977, 3338, 3106, 0, 0, 0, 0, 4703,
+    0, 0, 5316, 6117, 2705, 0, 4015, 3976, 3184, 3242, 6337, 2846, 3142, 2350, 4481, 5045,
+    3022, 0, 3121, 317, 0, 0, 6444, 3283, 1635, 0, 0, 2900, 0, 4652, 6768, 0,
+    7279, 1898, 4026, 2637, 2623, 0, 2780, 3249, 2943, 230, 2433, 3273, 143, 2352, 5152, 5031,
+    2659, 0, 1878, 0, 2138, 0, 0, 6296, 0, 6753, 6415, 0, 5665, 68, 4789, 3285,
+    7307, 2690, 260, 2545, 2847, 3700, 4847, 2970, 5365, 2291, 3087, 31, 2527, 5425, 5101, 2996,
+    0, 3255, 148, 5781, 3041, 0, 2566, 163, 2542, 5310, 1963, 0, 3516, 2514, 2921, 3821,
+    4429, 0, 2953, 0, 0, 0, 90, 2229, 0, 319, 2140, 0, 7287, 0, 0, 5382,
+    1600, 180, 0, 4552, 211, 0, 0, 0, 0, 3501, 0, 0, 3870, 0, 0, 2501,
+    3256, 3175, 3013, 4462, 0, 72, 5591, 2189, 2774, 4702, 0, 174, 3912, 0, 0, 0,
+    0, 0, 0, 5553, 0, 0, 3043, 0, 4088, 0, 2562, 0, 0, 0, 2612, 0,
+    0, 1947, 208, 0, 2518, 0, 0, 0, 0, 0, 4006, 0, 298, 0, 2184, 5621,
+    2285, 3381, 0, 0, 2468, 2839, 0, 0, 0, 2882, 0, 0, 0, 0, 6714, 3051,
+    2958, 1631, 2908, 2658, 2626, 3302, 0, 6021, 0, 2606, 270, 1920, 4783, 71, 5977, 0,
+    0, 0, 3773, 6721, 4436, 6394, 0, 0, 209, 0, 0, 3549, 2779, 0, 159, 0,
+    0, 2339, 0, 0, 0, 0, 0, 0, 2357, 2810, 0, 0, 2526, 2206, 3298, 1603,
+    5392, 2490, 0, 0, 0, 6388, 0, 2276, 0, 2925, 0, 2073, 4534, 0, 3548, 0,
+    11, 5849, 155, 110, 6699, 6136, 3462, 3882, 6373, 0, 5003, 5847, 0, 2257, 0, 2987,
+    1962, 6245, 3550, 2591, 292, 101, 2715, 3797, 0, 0, 4656, 250, 1678, 3331, 4211, 0,
+    2017, 83, 3469, 1628, 5810, 1614, 4255, 0, 3317, 199, 3315, 56, 0, 0, 0, 2252,
+    7189, 6399, 2931, 3216, 6239, 4535, 0, 0, 0, 2579, 3140, 0, 0, 4426, 2870, 2032,
+    0, 126, 4130, 0, 134, 0, 2615, 2742, 0, 41, 0, 0, 1613, 0, 0, 0,
+    4867, 6082, 3165, 265, 3058, 0, 5971, 2660, 0, 0, 2406, 2038, 6941, 0, 3447, 4763,
+    0, 5406, 3106, 62, 18, 1615, 0, 0, 0, 3240, 5600, 0, 0, 4996, 0, 0,
+    0, 3085, 6012, 239, 0, 4952, 0, 3119, 4721, 0, 5786, 4447, 0, 0, 0, 0,
+    66, 216, 2899, 0, 3020, 0, 0, 3991, 5370, 2737, 300, 139, 2377, 0, 0, 2602,
+    171, 2756, 4218, 4982, 4947, 0, 0, 244, 3161, 6627, 0, 221, 0, 0, 3078, 0,
+    4035, 5630, 4900, 1901, 0, 6035, 3636, 187, 2843, 0, 5381, 0, 6853, 0, 0, 0,
+    259, 5691, 0, 0, 4911, 2809, 5547, 0, 0, 3030, 5197, 6580, 0, 3582, 2731, 1994,
+    0, 0, 0, 0, 0, 1753, 0, 4921, 5897, 0, 0, 2247, 5367, 0, 1887, 6838,
+    206, 5158, 0, 0, 0, 0, 0, 3766, 0, 0, 3137, 0, 3036, 4592, 3327, 1716,
+    0, 0, 0, 0, 2681, 1768, 6862, 0, 0, 0, 7303, 6076, 0, 3250, 0, 5110,
+    0, 0, 0, 1790, 0, 5472, 0, 0, 5538, 0, 3309, 0, 2837, 0, 2755, 3371,
+    2613, 0, 0, 2726, 0, 0, 5461, 254, 2536, 0, 0, 0, 1608, 0, 2564, 0,
+    3244, 0, 0, 5727, 0, 4581, 3838, 0, 0, 2480, 0, 0, 4091, 0, 3998, 0,
+    0, 0, 247, 4432, 0, 198, 0, 0, 2154, 1621, 2743, 0, 0, 0, 4976, 0,
+    2656, 0, 2235, 4748, 3611, 2820, 3845, 157, 5283, 4287, 5711, 4322, 3801, 4894, 14, 0,
+    0, 0, 2941, 3002, 0, 4050, 0, 0, 0, 0, 0, 0, 2524, 0, 1607, 0,
+    0, 0, 4225, 0, 0, 2337, 2256, 0, 0, 7035, 0, 4278, 3795, 4893, 1706, 0,
+    0, 0, 0, 0, 6818, 6087, 0, 3806, 0, 2747, 0, 3398, 0, 1704, 5985, 2084,
+    0, 54, 2801, 4251, 3569, 6805, 131, 6197, 3221, 2075, 4372, 0, 0, 4968, 1676, 0,
+    229, 0, 3150, 3346, 2534, 0, 5886, 0, 4482, 3405, 0, 224, 5801, 245, 0, 0,
+    0, 2748, 0, 3204, 6139, 6408, 0, 0, 2963, 0, 0, 0, 0, 3565, 2937, 0,
+    0, 0, 0, 0, 284, 202, 23, 0, 0, 0, 0, 4067, 0, 5882, 4102, 0,
+    6483, 2701, 2440, 2978, 0, 0, 3559, 0, 3163, 2853, 0, 0, 231, 0, 6269, 0,
+    0, 2914, 228, 0, 3242, 0, 6142, 0, 1895, 4058, 2789, 1643, 1811, 167, 3095, 0,
+    5974, 261, 5585, 7377, 0, 0, 0, 2706, 0, 0, 0, 3733, 2580, 3121, 0, 2041,
+    0, 0, 1899, 4706, 2362, 0, 7357, 5152, 0, 4031, 0, 0, 0, 3023, 2515, 4152,
+    1774, 5361, 2354, 255, 192, 2623, 0, 0, 0, 4792, 3718, 0, 196, 100, 1878, 2341,
+    0, 5366, 4811, 0, 0, 0, 3786, 2900, 2648, 0, 3186, 0, 2740, 0, 320, 3157,
+    2875, 0, 2783, 7318, 5041, 5784, 2662, 5642, 4563, 0, 0, 4796, 2350, 6331, 2849, 201,
+    0, 6440, 5310, 2573, 0, 0, 0, 0, 0, 0, 4272, 2890, 0, 2766, 6111, 0,
+    230, 2530, 0, 2140, 0, 4262, 148, 5229, 5143, 0, 0, 5792, 2232, 0, 4513, 0,
+    0, 4543, 2558, 1829, 0, 2501, 0, 2479, 6295, 3230, 0, 0, 2690, 315, 0, 5460,
+    319, 0, 0, 2826, 3043, 0, 0, 5423, 2192, 0, 0, 0, 0, 0, 0, 0,
+    0, 2563, 4089, 1954, 0, 5340, 0, 3112, 0, 2612, 5595, 0, 0, 0, 254, 4343,
+    0, 3260, 0, 4006, 0, 0, 274, 5230, 0, 0, 2285, 0, 0, 0, 0, 0,
+    2729, 0, 2957, 0, 0, 0, 0, 0, 2535, 0, 2549, 4787, 3051, 243, 12, 2504,
+    4408, 2604, 0, 2194, 0, 2771, 99, 0, 3910, 6723, 2272, 0, 0, 0, 0, 3698,
+    0, 0, 1823, 0, 0, 4879, 4042, 2208, 0, 4657, 0, 0, 1946, 0, 0, 0,
+    3228, 6350, 5856, 2490, 0, 6102, 0, 0, 0, 2315, 2277, 0, 2339, 0, 0, 112,
+    314, 6714, 4648, 0, 0, 1689, 4878, 0, 0, 0, 0, 6404, 0, 0, 6706, 0,
+    0, 6249, 7238, 292, 0, 5976, 3301, 6693, 312, 2441, 3771, 5818, 262, 200, 3552, 4868,
+    2073, 0, 0, 0, 3329, 0, 1847, 0, 0, 0, 0, 0, 0, 5851, 4537, 3471,
+    2987, 6090, 0, 0, 0, 5967, 0, 3654, 0, 1603, 2316, 0, 0, 3815, 7093, 2493,
+    2744, 0, 0, 242, 3140, 0, 0, 5097, 0, 3548, 0, 4188, 6252, 0, 0, 0,
+    128, 5545, 2869, 5847, 3462, 2402, 2471, 4281, 6371, 0, 5414, 2425, 46, 0, 5256, 0,
+    3731, 3454, 6205, 6045, 5766, 2039, 101, 3305, 0, 3441, 0, 228, 0, 0, 1962, 0,
+    1626, 4528, 0, 2734, 3240, 6093, 6978, 1617, 0, 0, 0, 2251, 2410, 7183, 0, 1943,
+    0, 4451, 3119, 316, 6239, 0, 16, 5787, 305, 62, 0, 0, 7163, 4688, 0, 0,
+    0, 0, 2513, 221, 6505, 0, 2602, 2738, 253, 0, 3297, 6046, 0, 0, 1613, 306,
+    1746, 0, 4218, 0, 6002, 6938, 6612, 1952, 0, 5091, 4762, 188, 0, 0, 2899, 5694,
+    0, 0, 0, 0, 0, 5600, 1777, 1651, 227, 3173, 4992, 2216, 3078, 2010, 41, 3129,
+    0, 6666, 4061, 4511, 5931, 0, 0, 0, 0, 4907, 0, 0, 0, 0, 0, 238,
+    0, 6680, 0, 66, 0, 5702, 0, 0, 0, 0, 26, 0, 3830, 0, 0, 216,
+    4631, 3293, 0, 4946, 0, 5121, 0, 0, 0, 205, 3327, 0, 0, 0, 3217, 0,
+    2424, 0, 0, 1891, 0, 3229, 0, 0, 6872, 3177, 187, 0, 0, 0, 0, 0,
+    5547, 0, 0, 0, 5470, 206, 0, 0, 0, 0, 2727, 1991, 0, 0, 0, 2867,
+    0, 0, 0, 0, 5467, 2245, 0, 7008, 0, 3310, 5151, 276, 0, 0, 3998, 0,
+    3260, 3428, 1877, 0, 3065, 0, 3135, 0, 0, 0, 3390, 0, 0, 0, 0, 0,
+    7297, 2028, 0, 0, 7129, 0, 0, 3634, 0, 2156, 14, 0, 0, 0, 0, 97,
+    4975, 3847, 0, 0, 5712, 0, 4752, 0, 6578, 5309, 0, 0, 2837, 0, 0, 2613,
+    1788, 0, 25, 0, 2754, 3005, 0, 0, 1608, 2815, 6067, 0, 122, 0, 0, 0,
+    1606, 2337, 3777, 0, 0, 0, 5993, 0, 4054, 3838, 0, 0, 0, 0, 0, 4938,
+    6808, 7057, 0, 0, 0, 4936, 4286, 0, 2974, 4646, 0, 0, 0, 0, 0, 2186,
+    2426, 5803, 3811, 0, 1707, 0, 4866, 0, 0, 0, 0, 0, 3369, 0, 3932, 0,
+    0, 3407, 0, 2021, 0, 0, 2801, 0, 0, 322, 5150, 0, 4005, 317, 2979, 0,
+    0, 283, 7035, 0, 0, 0, 132, 2750, 2776, 0, 4893, 0, 4896, 0, 2655, 0,
+    0, 3398, 4666, 2978, 7219, 0, 0, 59, 1701, 0, 6489, 3197, 0, 0, 0, 3562,
+    54, 2963, 6717, 2074, 0, 2791, 2917, 5885, 3201, 0, 173, 0, 0, 23, 229, 5207,
+    2701, 291, 3568, 4686, 5536, 172, 7389, 2582, 2051, 1763, 233, 1941, 2444, 279, 4566, 3305,
+    0, 2936, 0, 5308, 3743, 2125, 6132, 192, 2636, 3132, 0, 0, 0, 0, 0, 0,
+    0, 0, 1895, 211, 4066, 0, 3023, 7223, 0, 0, 2954, 1775, 0, 0, 0, 197,
+    0, 3786, 0, 0, 6242, 0, 220, 2120, 0, 0, 0, 0, 0, 0, 2714, 3295,
+    0, 3465, 0, 0, 0, 3307, 2891, 2215, 2675, 3100, 7396, 44, 273, 5585, 0, 3750,
+    6343, 0, 4804, 103, 0, 0, 0, 0, 5645, 0, 5825, 0, 3121, 2577, 2651, 5530,
+    2890, 0, 2353, 0, 2623, 0, 0, 3008, 2875, 2283, 222, 0, 5653, 2831, 3824, 2150,
+    24, 212, 5251, 0, 1609, 0, 0, 3716, 1878, 4523, 0, 0, 2622, 0, 1755, 4790,
+    0, 2848, 278, 3186, 0, 3285, 2479, 0, 0, 313, 0, 152, 5236, 4266, 3217, 2999,
+    0, 2866, 0, 5782, 0, 6957, 0, 0, 0, 5421, 219, 0, 5310, 0, 275, 0,
+    2854, 0, 0, 2573, 0, 0, 1829, 4272, 2230, 4347, 0, 1697, 5231, 0, 3875, 3114,
+    107, 0, 0, 0, 0, 0, 0, 2770, 3384, 4217, 0, 2209, 2501, 0, 237, 0,
+    179, 2713, 0, 3968, 3052, 4356, 3062, 2482, 0, 3219, 241, 3014, 274, 0, 0, 2115,
+    4393, 214, 12, 5747, 47, 113, 0, 268, 2208, 0, 0, 0, 2877, 0, 6438, 2508,
+    0, 2930, 243, 0, 2612, 2552, 0, 0, 0, 0, 0, 0, 5859, 0, 0, 0,
+    0, 4006, 213, 2349, 2285, 2611, 0, 2272, 119, 0, 0, 0, 5978, 0, 0, 112,
+    4923, 0, 0, 0, 3051, 0, 0, 4046, 0, 0, 2969, 0, 6103, 0, 0, 5316,
+    318, 2845, 6722, 3695, 2323, 114, 5818, 4784, 6281, 2646, 1823, 29, 4881, 4648, 0, 0,
+    0, 0, 1851, 0, 6696, 0, 0, 79, 0, 0, 1690, 0, 0, 0, 200, 0,
+    1860, 7038, 2339, 3997, 7217, 2318, 2490, 0, 3654, 300, 2103, 5415, 5820, 0, 0, 0,
+    2926, 0, 0, 4878, 295, 0, 0, 0, 5141, 0, 0, 4173, 0, 0, 0, 0,
+    296, 7237, 6377, 2538, 5967, 6562, 3661, 5097, 242, 6246, 3551, 2842, 3841, 304, 2123, 1875,
+    3253, 2429, 233, 2497, 0, 5414, 2291, 3444, 2975, 2472, 2715, 0, 3470, 5850, 2226, 292,
+    37, 2634, 0, 6053, 0, 0, 0, 0, 5306, 0, 6240, 4536, 5767, 7195, 4491, 226,
+    3130, 0, 0, 0, 4531, 2881, 0, 2734, 0, 4453, 0, 0, 3140, 4698, 5590, 0,
+    2394, 7042, 6083, 42, 2416, 2547, 2177, 0, 6251, 6514, 127, 6945, 305, 1952, 3249, 2942,
+    246, 1746, 0, 0, 0, 0, 0, 2768, 3401, 4725, 0, 6000, 2671, 0, 0, 1616
+};
+
+/*
+** Perfect hash for 7-card non-flush hands (49205 rank
+** multisets), keyed on the sum of quinary[] over the cards.
+** See find_fast7() in pokereval.h.
+*/
+const unsigned short hash7_adjust[] =
+{
+    14, 0, 1, 13, 13, 0, 105, 49, 24, 27, 13, 0, 123, 26, 1, 5,
+    10, 217, 40, 1, 1, 2, 5, 7, 10, 17, 1, 3, 6, 6, 50, 8,
+    5, 1, 3, 21, 1, 14, 24, 67, 0, 6, 12, 30, 2, 5, 1, 0,
+    0, 3, 6, 0, 0, 14, 52, 26, 39, 34, 0, 21, 11, 122, 0, 2,
+    10, 22, 1, 1, 0, 64, 0, 4, 10, 1, 3, 106, 2, 14, 33, 12,
+    63, 383, 0, 0, 11, 29, 98, 3, 82, 2, 100, 50, 0, 9, 1, 18,
+    3, 46, 19, 1, 1, 31, 11, 1, 9, 158, 17, 46, 33, 50, 6, 60,
+    2, 6, 10, 4, 3, 60, 19, 16, 11, 0, 1, 14, 3, 1, 78, 17,
+    0, 19, 1, 57, 2, 2, 0, 6, 9, 0, 0, 150, 62, 0, 8, 14,
+    0, 32, 116, 93, 18, 2, 4, 54, 2, 19, 17, 1, 4, 51, 0, 14,
+    0, 50, 0, 2, 13, 17, 0, 5, 3, 10, 20, 34, 0, 42, 3, 6,
+    27, 16, 36, 0, 0, 0, 31, 0, 0, 3, 2, 6, 42, 7, 0, 0,
+    27, 8, 13, 15, 36, 9, 2, 34, 1, 60, 65, 2, 84, 7, 32, 2,
+    1, 0, 55, 2, 29, 2, 11, 43, 24, 94, 5, 1, 115, 48, 1, 1,
+    45, 10, 76, 0, 18, 131, 9, 1, 27, 9, 2, 7, 0, 21, 6, 0,
+    0, 3, 0, 85, 6, 5, 376, 2, 3, 63, 132, 10, 11, 35, 5, 14,
+    2, 3, 25, 4, 23, 0, 13, 1, 1, 17, 27, 14, 22, 0, 12, 20,
+    2, 95, 2, 11, 18, 9, 101, 24, 7, 2, 1, 2, 4, 0, 16, 74,
+    85, 9, 38, 0, 0, 2, 75, 55, 9, 1, 18, 78, 0, 146, 19, 2,
+    12, 9, 0, 3, 6, 20, 2, 1, 113, 0, 8, 13, 1, 118, 39, 8,
+    1, 50, 5, 1, 29, 8, 117, 66, 2, 17, 8, 0, 20, 9, 18, 0,
+    10, 0, 28, 43, 253, 1, 7, 1, 6, 3, 3, 17, 0, 8, 9, 4,
+    3, 1, 6, 4, 0, 8, 0, 134, 3, 1, 9, 74, 2, 221, 7, 0,
+    11, 0, 0, 18, 32, 19, 10, 24, 0, 14, 0, 0, 18, 113, 46, 65,
+    0, 16, 8, 159, 1, 65, 9, 85, 0, 5, 0, 12, 12, 0, 0, 92,
+    0, 0, 6, 11, 15, 28, 42, 204, 0, 0, 10, 12, 0, 28, 124, 14,
+    14, 6, 48, 0, 1, 11, 12, 9, 82, 15, 4, 39, 95, 27, 6, 3,
+    99, 50, 24, 26, 11, 7, 2, 7, 44, 71, 69, 93, 10, 1, 0, 19,
+    46, 13, 1, 4, 0, 3, 8, 6, 26, 6, 1, 0, 0, 4, 2, 34,
+    57, 26, 10, 60, 6, 11, 19, 0, 11, 81, 132, 3, 9, 0, 22, 10,
+    3, 28, 8, 2, 53, 4, 17, 183, 22, 0, 6, 13, 2, 32, 20, 37,
+    6, 2, 109, 51, 33, 1, 97, 5, 108, 24, 8, 37, 10, 44, 1, 46,
+    1, 0, 10, 10, 0, 15, 0, 180, 4, 0, 1, 64, 3, 10, 16, 21,
+    52, 4, 13, 6, 16, 1, 0, 107, 46, 7, 1, 0, 0, 22, 61, 50,
+    1, 124, 2, 2, 0, 230, 56, 15, 10, 1, 9, 52, 222, 5, 13, 0,
+    9, 28, 93, 6, 26, 26, 3, 3, 3, 6, 10, 2, 68, 61, 50, 18,
+    93, 0, 0, 6, 7, 0, 2, 63, 37, 40, 102, 10, 1, 1, 107, 88,
+    3, 8, 33, 8, 81, 1, 10, 28, 7, 1, 2, 0, 2, 1, 0, 0,
+    9, 4, 12, 27, 49, 72, 155, 15, 57, 0, 108, 0, 1, 1, 157, 23,
+    6, 60, 32, 32, 5, 22, 2, 0, 1, 0, 105, 18, 2, 4, 42, 41,
+    25, 13, 0, 17, 60, 4, 0, 28, 0, 0, 3, 1, 22, 11, 34, 2,
+    1, 59, 173, 30, 2, 1, 1, 97, 16, 1, 1, 13, 17, 8, 121, 0,
+    50, 0, 14, 7, 12, 2, 0, 0, 163, 0, 1, 111, 101, 2, 11, 19,
+    18, 6, 8, 0, 109, 3, 12, 22, 2, 14, 1, 10, 37, 5, 73, 86,
+    4, 75, 80, 0, 15, 14, 5, 2, 0, 41, 1, 60, 0, 1, 2, 2,
+    4, 7, 31, 17, 10, 9, 10, 7, 4, 12, 6, 2, 2, 31, 17, 1,
+    130, 1, 12, 0, 20, 14, 6, 30, 0, 2, 0, 0, 0, 18, 61, 10,
+    56, 27, 4, 10, 27, 40, 3, 14, 9, 45, 0, 6, 3, 0, 0, 0,
+    2, 7, 0, 142, 144, 8, 74, 34, 0, 87, 3, 0, 0, 0, 2, 19,
+    6, 2, 49, 56, 1, 5, 0, 3, 7, 0, 19, 37, 2, 1, 0, 9,
+    0, 1, 7, 120, 4, 158, 19, 4, 3, 98, 9, 17, 29, 8, 3, 1,
+    41, 76, 0, 3, 2, 0, 6, 52, 12, 7, 7, 151, 16, 14, 0, 271,
+    44, 6, 5, 0, 19, 15, 75, 52, 21, 94, 11, 5, 3, 12, 0, 9,
+    0, 103, 73, 18, 83, 17, 2, 12, 1, 16, 5, 16, 2, 43, 49, 1,
+    7, 1, 47, 0, 6, 115, 11, 1, 23, 11, 1, 94, 15, 0, 0, 38,
+    0, 7, 16, 8, 21, 0, 1, 45, 1, 7, 1, 0, 75, 0, 14, 23,
+    23, 30, 27, 0, 33, 82, 0, 33, 29, 45, 7, 0, 0, 53, 22, 0,
+    43, 4, 0, 0, 0, 38, 0, 0, 140, 2, 141, 23, 29, 16, 5, 0,
+    280, 20, 122, 44, 30, 34, 1, 38, 0, 0, 4, 6, 81, 4, 33, 0,
+    70, 0, 5, 3, 4, 2, 52, 37, 35, 3, 16, 3, 20, 4, 0, 0,
+    0, 62, 10, 32, 0, 3, 3, 3, 42, 1, 13, 79, 4, 37, 54, 35,
+    0, 27, 14, 12, 70, 2, 12, 2, 0, 4, 12, 3, 0, 48, 1, 3,
+    0, 2, 47, 5, 0, 57, 12, 12, 1, 23, 94, 13, 0, 276, 94, 3,
+    12, 55, 1, 41, 41, 7, 48, 0, 2, 0, 0, 23, 289, 57, 5, 17,
+    6, 38, 5, 7, 1, 8, 11, 84, 329, 99, 8, 15, 254, 7, 0, 12,
+    69, 4, 1, 24, 0, 0, 1, 4, 95, 3, 3, 67, 8, 174, 11, 22,
+    45, 33, 315, 13, 0, 79, 0, 37, 54, 0, 16, 40, 13, 29, 71, 178,
+    10, 6, 12, 0, 1, 44, 2, 88, 28, 8, 5, 44, 4, 9, 31, 41,
+    27, 34, 42, 73, 0, 21, 2, 108, 6, 3, 62, 34, 1, 2, 3, 3,
+    4, 2, 0, 1, 5, 249, 3, 9, 9, 3, 20, 131, 0, 54, 4, 3,
+    2, 19, 5, 4, 44, 31, 0, 41, 6, 5, 2, 5, 39, 10, 15, 3,
+    2, 0, 0, 28, 29, 71, 1, 3, 29, 4, 2, 17, 2, 8, 20, 160,
+    2, 2, 144, 1, 0, 303, 27, 14, 26, 3, 1, 122, 39, 18, 30, 40,
+    40, 2, 30, 8, 46, 81, 305, 24, 39, 145, 8, 62, 4, 0, 123, 0,
+    209, 0, 0, 22, 2, 79, 0, 118, 1, 94, 32, 5, 34, 1, 2, 9,
+    8, 17, 7, 74, 0, 3, 7, 55, 6, 28, 105, 7, 52, 5, 1, 17,
+    2, 26, 267, 1, 55, 0, 12, 14, 19, 34, 56, 1, 6, 18, 24, 0,
+    8, 0, 133, 36, 1, 27, 30, 0, 4, 36, 3, 8, 0, 0, 54, 3,
+    52, 27, 85, 33, 8, 2, 16, 65, 2, 51, 112, 138, 41, 25, 3, 8,
+    0, 23, 7, 0, 116, 45, 64, 5, 1, 1, 4, 3, 2, 55, 6, 63,
+    78, 4, 27, 0, 24, 26, 0, 2, 7, 0, 137, 50, 4, 40, 8, 1,
+    0, 2, 20, 30, 0, 0, 8, 13, 51, 1, 1, 103, 4, 12, 130, 124,
+    4, 53, 2, 86, 153, 1, 48, 19, 40, 163, 2, 18, 51, 0, 77, 38,
+    0, 5, 46, 30, 0, 22, 2, 3, 35, 13, 296, 3, 34, 0, 40, 8,
+    0, 0, 136, 26, 24, 115, 28, 3, 16, 0, 36, 0, 1, 35, 63, 14,
+    18, 29, 89, 6, 2, 31, 1, 2, 53, 51, 6, 8, 1, 0, 0, 0,
+    23, 86, 0, 23, 0, 4, 96, 3, 0, 10, 93, 116, 1, 4, 4, 55,
+    19, 5, 151, 0, 6, 84, 22, 38, 2, 48, 32, 7, 2, 15, 0, 154,
+    34, 5, 32, 3, 24, 72, 0, 1, 231, 0, 63, 75, 17, 91, 5, 46,
+    14, 32, 16, 35, 24, 24, 73, 15, 64, 18, 0, 1, 16, 0, 8, 88,
+    3, 2, 6, 6, 8, 25, 131, 152, 3, 4, 9, 189, 26, 198, 3, 0,
+    0, 0, 1, 33, 4, 79, 14, 95, 65, 0, 0, 59, 21, 68, 8, 35,
+    14, 1, 3, 22, 1, 32, 1, 0, 28, 172, 46, 3, 12, 0, 1, 81,
+    18, 85, 3, 3, 2, 48, 1, 36, 224, 0, 22, 6, 2, 1, 17, 4,
+    0, 67, 136, 27, 32, 20, 83, 40, 39, 21, 0, 1, 45, 4, 67, 22,
+    0, 4, 2, 3, 22, 1, 31, 33, 108, 20, 2, 8, 15, 100, 8, 53,
+    3, 17, 0, 23, 13, 0, 0, 43, 0, 2, 53, 37, 55, 3, 63, 1,
+    17, 0, 0, 7, 1, 0, 87, 31, 6, 8, 41, 25, 7, 0, 2, 0,
+    39, 4, 12, 9, 2, 74, 0, 0, 0, 4, 2, 14, 0, 0, 0, 5,
+    27, 100, 3, 0, 1, 22, 91, 6, 3, 7, 18, 7, 31, 34, 13, 54,
+    54, 12, 9, 4, 7, 61, 45, 94, 12, 2, 36, 2, 9, 22, 0, 103,
+    7, 62, 6, 37, 51, 29, 17, 1, 31, 0, 37, 33, 30, 67, 4, 7,
+    8, 4, 0, 19, 7, 2, 11, 5, 39, 19, 66, 5, 73, 9, 147, 74,
+    113, 3, 10, 4, 54, 0, 71, 1, 1, 26, 36, 23, 39, 20, 104, 50,
+    16, 6, 10, 12, 0, 165, 7, 4, 12, 61, 30, 42, 43, 6, 47, 20,
+    116, 14, 126, 4, 2, 51, 54, 67, 49, 35, 2, 18, 9, 7, 7, 5,
+    17, 3, 81, 4, 25, 42, 0, 12, 20, 18, 61, 54, 38, 16, 23, 0,
+    1, 0, 18, 0, 55, 11, 79, 1, 3, 16, 6, 0, 4, 27, 1, 3,
+    19, 3, 29, 33, 19, 2, 1, 0, 15, 24, 31, 5, 4, 2, 33, 0,
+    0, 20, 0, 1, 9, 22, 0, 49, 5, 5, 0, 2, 90, 24, 46, 62,
+    129, 20, 13, 9, 0, 24, 29, 2, 0, 0, 91, 0, 1, 3, 7, 2,
+    11, 20, 8, 1, 17, 13, 0, 19, 23, 23, 16, 13, 1, 0, 1, 8,
+    43, 0, 1, 82, 0, 36, 10, 2, 11, 1, 53, 20, 0, 244, 6, 20,
+    18, 246, 26, 8, 4, 73, 20, 16, 8, 88, 38, 15, 28, 160, 3, 6,
+    1, 73, 38, 35, 0, 2, 29, 0, 0, 4, 15, 4, 25, 153, 5, 89,
+    94, 12, 226, 21, 34, 34, 26, 3, 16, 46, 5, 32, 3, 5, 15, 82,
+    19, 51, 80, 2, 16, 35, 34, 1, 8, 2, 10, 110, 103, 94, 21, 38,
+    17, 3, 40, 59, 6, 6, 35, 1, 27, 4, 0, 9, 0, 2, 77, 0,
+    124, 0, 8, 3, 20, 0, 2, 21, 11, 40, 30, 5, 23, 4, 10, 25,
+    0, 12, 204, 110, 2, 18, 29, 81, 2, 0, 53, 18, 60, 3, 2, 62,
+    40, 2, 14, 29, 4, 41, 19, 21, 13, 1, 2, 28, 10, 121, 172, 1,
+    10, 114, 28, 3, 77, 0, 49, 11, 2, 30, 17, 49, 9, 41, 5, 0,
+    27, 28, 18, 68, 19, 100, 14, 20, 34, 2, 148, 0, 0, 39, 125, 0,
+    90, 1, 52, 21, 9, 26, 52, 1, 243, 0, 26, 50, 115, 9, 100, 16,
+    87, 15, 2, 3, 18, 72, 0, 21, 5, 12, 36, 19, 10, 3, 27, 4,
+    12, 12, 151, 101, 44, 134, 6, 32, 24, 0, 44, 9, 0, 49, 28, 144,
+    13, 170, 7, 5, 298, 1, 1, 0, 4, 0, 0, 2, 3, 64, 5, 46,
+    10, 262, 12, 97, 35, 22, 49, 0, 19, 176, 0, 60, 11, 82, 100, 99,
+    0, 0, 75, 0, 0, 0, 46, 45, 43, 46, 8, 41, 3, 2, 133, 0,
+    0, 47, 22, 17, 0, 15, 44, 2, 1, 6, 0, 49, 6, 64, 120, 10,
+    138, 5, 0, 12, 53, 34, 23, 144, 1, 44, 21, 4, 11, 3, 100, 19,
+    19, 2, 100, 81, 4, 126, 12, 1, 177, 23, 4, 47, 0, 120, 0, 28,
+    25, 2, 0, 53, 0, 10, 195, 64, 4, 1, 31, 29, 99, 1, 34, 2,
+    8, 10, 3, 39, 0, 11, 13, 0, 69, 44, 137, 17, 314, 29, 2, 42,
+    354, 21, 0, 80, 37, 27, 1, 21, 20, 5, 33, 32, 0, 2, 0, 9,
+    3, 6, 2, 27, 28, 23, 0, 0, 129, 49, 0, 54, 6, 7, 31, 42,
+    54, 12, 3, 32, 82, 39, 1, 1, 46, 31, 13, 15, 3, 9, 0, 0,
+    0, 104, 1, 7, 12, 1, 30, 1, 36, 53, 28, 3, 169, 4, 65, 314,
+    17, 2, 70, 11, 1, 1, 84, 31, 0, 8, 0, 3, 0, 3, 12, 23,
+    98, 128, 4, 35, 68, 199, 1, 271, 0, 32, 53, 3, 0, 16, 34, 22,
+    59, 0, 1, 55, 17, 8, 73, 0, 0, 0, 0, 0, 3, 2, 147, 13,
+    24, 19, 84, 34, 1, 0, 1, 15, 2, 66, 2, 7, 15, 50, 119, 0,
+    0, 1, 24, 78, 7, 40, 0, 57, 4, 44, 12, 2, 0, 1, 5, 2,
+    2, 0, 91, 9, 8, 1, 0, 47, 6, 1, 10, 94, 16, 4, 6, 0,
+    7, 39, 43, 45, 122, 8, 20, 19, 7, 11, 10, 59, 0, 5, 0, 0,
+    36, 4, 61, 27, 45, 13, 121, 0, 0, 1, 2, 11, 249, 61, 6, 15,
+    3, 68, 2, 0, 68, 136, 55, 22, 7, 3, 18, 1, 111, 7, 1, 0,
+    8, 13, 1, 22, 93, 1, 127, 5, 0, 13, 2, 5, 17, 22, 143, 212,
+    19, 3, 6, 45, 27, 0, 38, 1, 1, 1, 23, 2, 7, 1, 10, 14,
+    23, 67, 1, 0, 123, 0, 2, 1, 0, 3, 23, 17, 14, 3, 6, 9,
+    9, 2, 5, 105, 142, 23, 2, 4, 40, 68, 46, 15, 2, 2, 4, 8,
+    99, 8, 12, 0, 2, 66, 172, 176, 163, 102, 13, 81, 90, 9, 3, 0,
+    9, 5, 155, 37, 0, 1, 2, 119, 25, 13, 1, 9, 88, 84, 84, 25,
+    227, 0, 3, 3, 109, 8, 1, 0, 15, 233, 20, 12, 6, 79, 46, 1,
+    5, 43, 22, 0, 9, 47, 15, 110, 27, 1, 17, 1, 4, 18, 4, 1,
+    2, 54, 1, 41, 82, 7, 0, 2, 1, 223, 4, 15, 32, 17, 10, 64,
+    2, 3, 0, 97, 1, 3, 17, 46, 145, 6, 7, 22, 1, 54, 37, 80,
+    21, 0, 24, 57, 3, 13, 0, 0, 5, 0, 134, 29, 71, 110, 54, 20,
+    34, 1, 1, 0, 1, 12, 11, 57, 13, 3, 103, 41, 14, 77, 185, 25,
+    1, 20, 5, 12, 3, 0, 4, 17, 16, 29, 22, 106, 0, 23, 4, 0,
+    45, 0, 35, 19, 17, 4, 0, 30, 1, 5, 5, 5, 7, 76, 37, 25,
+    47, 4, 43, 6, 6, 5, 5, 3, 104, 16, 44, 92, 4, 0, 3, 166,
+    38, 54, 27, 10, 32, 0, 45, 52, 3, 1, 6, 0, 61, 38, 12, 35,
+    4, 18, 1, 1, 83, 87, 14, 7, 31, 6, 47, 13, 8, 17, 159, 19,
+    102, 9, 43, 14, 7, 20, 11, 0, 112, 36, 12, 39, 3, 209, 1, 73,
+    1, 5, 41, 14, 11, 4, 43, 13, 13, 36, 13, 178, 17, 19, 190, 1,
+    9, 20, 15, 82, 120, 86, 63, 42, 85, 2, 0, 17, 60, 15, 40, 1,
+    30, 1, 35, 21, 23, 17, 2, 48, 1, 3, 37, 17, 72, 37, 30, 27,
+    22, 0, 6, 125, 24, 7, 12, 34, 14, 10, 6, 333, 45, 25, 84, 20,
+    14, 28, 44, 12, 175, 30, 17, 41, 173, 24, 3, 39, 1, 2, 13, 0,
+    11, 93, 11, 64, 11, 2, 249, 4, 16, 21, 100, 10, 28, 45, 81, 75,
+    0, 6, 1, 105, 11, 28, 0, 27, 3, 4, 3, 108, 0, 21, 50, 15,
+    1, 26, 4, 89, 11, 24, 42, 142, 88, 30, 39, 65, 6, 151, 15, 0,
+    58, 31, 31, 13, 0, 288, 27, 3, 136, 126, 15, 10, 7, 22, 4, 60,
+    5, 5, 0, 2, 10, 20, 6, 42, 130, 72, 15, 30, 5, 14, 4, 31,
+    6, 0, 40, 4, 2, 7, 64, 80, 0, 43, 0, 27, 6, 6, 179, 39,
+    7, 338, 4, 7, 14, 1, 203, 16, 7, 34, 0, 10, 19, 58, 125, 8,
+    0, 56, 0, 34, 32, 58, 2, 121, 258, 126, 13, 0, 0, 11, 2, 25,
+    95, 38, 1, 2, 2, 9, 118, 6, 1, 2, 4, 22, 38, 73, 73, 20,
+    21, 18, 0, 0, 2, 151, 10, 39, 18, 50, 44, 3, 0, 1, 7, 1,
+    31, 11, 8, 44, 398, 0, 1, 1, 0, 1, 17, 180, 0, 1, 6, 5,
+    45, 56, 96, 0, 0, 83, 0, 66, 11, 154, 4, 0, 2, 25, 18, 0,
+    13, 18, 3, 60, 30, 93, 30, 40, 32, 116, 10, 5, 9, 27, 66, 106,
+    15, 76, 6, 1, 0, 53, 8, 6, 7, 53, 7, 17, 31, 67, 12, 16,
+    1, 0, 2, 1, 26, 3, 18, 27, 26, 2, 0, 115, 8, 1, 3, 95,
+    7, 3, 45, 41, 41, 72, 52, 19, 18, 0, 27, 13, 11, 85, 2, 118,
+    159, 92, 10, 5, 8, 33, 34, 2, 4, 4, 79, 18, 3, 436, 25, 7,
+    44, 1, 1, 0, 10, 8, 155, 12, 4, 0, 63, 0, 31, 71, 2, 0,
+    9, 2, 22, 38, 1, 9, 1, 1, 3, 30, 9, 18, 6, 73, 23, 4,
+    0, 0, 0, 0, 0, 109, 192, 32, 10, 92, 1, 3, 3, 11, 3, 1,
+    25, 106, 12, 37, 13, 0, 1, 6, 7, 41, 1, 72, 8, 0, 13, 4,
+    4, 0, 5, 55, 5, 20, 5, 78, 9, 6, 1, 0, 39, 3, 3, 1,
+    0, 1, 1, 2, 36, 15, 21, 2, 29, 1, 9, 63, 15, 1, 28, 3,
+    3, 18, 18, 15, 105, 34, 30, 17, 10, 16, 18, 21, 1, 0, 3, 16,
+    9, 15, 127, 48, 3, 2, 7, 16, 6, 1, 38, 0, 0, 68, 27, 13,
+    60, 12, 0, 5, 9, 152, 1, 0, 0, 1, 180, 8, 1, 60, 4, 72,
+    0, 59, 0, 64, 2, 82, 19, 2, 17, 63, 64, 10, 2, 83, 140, 6,
+    6, 58, 11, 31, 1, 64, 12, 14, 14, 3, 156, 0, 2, 8, 127, 5,
+    301, 68, 23, 43, 22, 3, 1, 16, 31, 80, 130, 136, 8, 1, 2, 102,
+    18, 1, 2, 1, 169, 46, 15, 85, 130, 33, 0, 144, 0, 23, 2, 3,
+    33, 23, 3, 44, 8, 23, 2, 23, 137, 1, 5, 125, 2, 19, 0, 3,
+    17, 1, 138, 69, 8, 0, 73, 64, 0, 10, 0, 27, 8, 4, 2, 10,
+    47, 6, 81, 35, 12, 185, 13, 0, 40, 8, 2, 1, 57, 35, 46, 34,
+    105, 4, 1, 21, 4, 19, 185, 0, 68, 19, 161, 19, 0, 0, 17, 32,
+    115, 4, 23, 111, 16, 14, 47, 19, 44, 3, 20, 26, 34, 8, 133, 0,
+    22, 10, 5, 20, 12, 41, 3, 6, 11, 237, 13, 2, 162, 8, 20, 2,
+    18, 9, 3, 27, 52, 40, 36, 1, 251, 57, 14, 40, 51, 6, 25, 0,
+    9, 15, 53, 18, 41, 2, 18, 7, 11, 9, 4, 2, 23, 200, 8, 6,
+    9, 115, 9, 10, 4, 0, 34, 15, 1, 5, 18, 21, 3, 114, 13, 1,
+    63, 20, 72, 103, 38, 58, 5, 32, 15, 0, 57, 14, 0, 89, 212, 5,
+    27, 182, 13, 23, 0, 0, 81, 1, 14, 15, 64, 22, 75, 0, 14, 21,
+    5, 10, 51, 3, 7, 13, 3, 2, 0, 63, 11, 12, 6, 9, 147, 20,
+    1, 8, 1, 11, 47, 3, 35, 487, 2, 9, 24, 25, 5, 90, 19, 17,
+    47, 1, 1, 64, 2, 9, 31, 191, 44, 5, 0, 68, 15, 9, 115, 3,
+    52, 11, 29, 164, 13, 9, 318, 2, 3, 21, 0, 9, 63, 67, 30, 2,
+    25, 10, 20, 11, 0, 18, 2, 2, 1, 2, 0, 3, 0, 4, 208, 148,
+    9, 379, 8, 0, 5, 36, 74, 8, 0, 4, 43, 42, 3, 110, 4, 1,
+    26, 69, 247, 21, 22, 6, 23, 8, 0, 2, 39, 60, 0, 48, 1, 11,
+    13, 0, 0, 25, 3, 0, 3, 0, 17, 60, 73, 10, 8, 1, 0, 68,
+    262, 7, 3, 63, 7, 5, 79, 76, 3, 27, 16, 1, 7, 25, 11, 31,
+    0, 44, 22, 0, 0, 327, 142, 6, 2, 14, 2, 35, 14, 16, 16, 7,
+    33, 68, 36, 7, 196, 44, 89, 8, 3, 60, 72, 5, 76, 3, 105, 13,
+    5, 1, 13, 3, 4, 0, 12, 54, 129, 0, 0, 6, 20, 47, 431, 51,
+    17, 44, 81, 227, 19, 51, 1, 268, 102, 9, 30, 0, 5, 9, 3, 13,
+    7, 0, 75, 17, 25, 40, 164, 40, 64, 25, 53, 19, 33, 6, 15, 32,
+    49, 41, 63, 9, 15, 166, 10, 57, 7, 14, 98, 48, 9, 6, 116, 50,
+    9, 16, 3, 1, 3, 3, 123, 12, 69, 8, 357, 22, 25, 0, 108, 14,
+    12, 75, 64, 0, 126, 3, 6, 6, 6, 0, 1, 26, 48, 0, 12, 38,
+    9, 2, 0, 9, 62, 3, 10, 25, 21, 12, 5, 0, 0, 2, 0, 6,
+    7, 0, 3, 61, 19, 6, 7, 2, 77, 7, 1, 202, 5, 0, 1, 25,
+    17, 5, 11, 44, 31, 10, 81, 2, 10, 0, 0, 0, 9, 8, 7, 18,
+    337, 93, 16, 0, 114, 1, 34, 34, 72, 54, 0, 37, 94, 65, 14, 66,
+    0, 31, 2, 7, 126, 93, 90, 4, 0, 1, 1, 7, 0, 448, 6, 0,
+    9, 51, 30, 0, 3, 72, 0, 6, 51, 12, 47, 43, 10, 12, 4, 0,
+    12, 11, 1, 73, 4, 5, 46, 2, 23, 5, 0, 12, 3, 49, 43, 31,
+    2, 22, 0, 61, 24, 20, 16, 11, 0, 9, 79, 3, 265, 4, 20, 132,
+    0, 24, 8, 200, 6, 37, 0, 62, 13, 70, 9, 17, 0, 8, 2, 7,
+    50, 9, 11, 16, 42, 150, 1, 35, 3, 0, 6, 35, 2, 7, 26, 54,
+    1, 11, 3, 1, 54, 1, 3, 13, 125, 75, 3, 60, 32, 345, 12, 11,
+    17, 66, 17, 125, 2, 7, 30, 5, 4, 8, 20, 26, 38, 1, 6, 289,
+    8, 25, 1, 7, 17, 83, 3, 52, 1, 3, 55, 174, 23, 11, 16, 62,
+    187, 29, 0, 44, 3, 65, 107, 1, 25, 225, 0, 1, 5, 7, 4, 13,
+    40, 35, 59, 69, 17, 23, 5, 22, 6, 42, 6, 2, 91, 183, 26, 13,
+    0, 31, 0, 0, 18, 15, 10, 2, 31, 0, 111, 19, 0, 34, 0, 0,
+    17, 1, 2, 2, 28, 9, 6, 16, 24, 17, 1, 21, 4, 20, 7, 1,
+    1, 5, 3, 133, 15, 3, 31, 21, 20, 38, 3, 54, 52, 18, 40, 2,
+    35, 32, 1, 11, 2, 0, 183, 49, 17, 121, 1, 8, 2, 3, 1, 106,
+    38, 14, 39, 83, 10, 14, 4, 2, 5, 353, 63, 97, 62, 34, 14, 40,
+    36, 10, 90, 0, 1, 47, 16, 0, 64, 0, 10, 13, 0, 175, 66, 69,
+    11, 24, 45, 1, 12, 19, 36, 3, 0, 87, 2, 13, 10, 4, 7, 20,
+    1, 5, 2, 92, 12, 16, 54, 25, 58, 0, 0, 0, 58, 72, 155, 5,
+    0, 23, 12, 58, 3, 46, 49, 0, 51, 2, 127, 1, 1, 14, 1, 28,
+    69, 3, 8, 23, 13, 6, 275, 1, 6, 1, 13, 115, 36, 47, 23, 4,
+    60, 63, 123, 137, 71, 159, 2, 51, 54, 8, 4, 4, 2, 0, 103, 18,
+    11, 2, 3, 11, 85, 1, 37, 5, 41, 5, 0, 26, 3, 0, 121, 0,
+    9, 44, 238, 70, 39, 13, 2, 4, 73, 32, 48, 16, 14, 55, 36, 3,
+    36, 8, 6, 79, 1, 535, 0, 93, 183, 271, 4, 68, 14, 18, 1, 7,
+    120, 26, 75, 10, 3, 21, 10, 0, 21, 36, 70, 14, 3, 10, 59, 75,
+    2, 9, 16, 21, 140, 25, 4, 145, 0, 26, 183, 2, 13, 32, 0, 42,
+    8, 38, 73, 18, 4, 56, 12, 19, 69, 0, 8, 1, 36, 23, 25, 0,
+    9, 31, 0, 33, 14, 22, 7, 68, 0, 17, 0, 23, 7, 0, 26, 5,
+    6, 12, 25, 151, 44, 7, 14, 1, 256, 0, 64, 10, 0, 8, 30, 4,
+    62, 35, 25, 11, 5, 113, 29, 110, 10, 15, 1, 67, 303, 10, 4, 3,
+    19, 22, 18, 23, 1, 3, 0, 68, 3, 72, 23, 2, 3, 12, 23, 3,
+    1, 15, 91, 0, 52, 28, 73, 6, 18, 15, 12, 20, 76, 5, 190, 39,
+    2, 208, 6, 0, 0, 17, 0, 5, 7, 33, 12, 22, 126, 63, 86, 0,
+    5, 0, 2, 15, 84, 14, 139, 68, 8, 0, 148, 3, 49, 1, 1, 136,
+    88, 59, 244, 5, 0, 67, 8, 5, 0, 129, 4, 11, 140, 77, 11, 2,
+    3, 76, 86, 122, 30, 93, 25, 1, 18, 56, 116, 172, 47, 5, 254, 14,
+    72, 15, 81, 75, 51, 0, 60, 4, 14, 64, 2, 21, 146, 6, 270, 5,
+    42, 5, 22, 0, 32, 0, 242, 0, 1, 63, 15, 228, 113, 33, 36, 2,
+    10, 81, 1, 2, 54, 81, 43, 8, 98, 25, 139, 28, 47, 92, 1, 17,
+    20, 15, 22, 10, 6, 6, 22, 0, 5, 0, 0, 13, 211, 5, 16, 0,
+    64, 22, 4, 7, 1, 15, 88, 14, 28, 2, 5, 44, 83, 109, 4, 3,
+    30, 24, 8, 9, 24, 1, 44, 92, 20, 1, 20, 0, 135, 0, 21, 307,
+    70, 50, 75, 44, 2, 46, 0, 5, 17, 69, 22, 36, 0, 6, 2, 0,
+    6, 2, 16, 9, 7, 109, 9, 1, 0, 11, 11, 32, 0, 8, 124, 15,
+    14, 6, 33, 43, 67, 149, 65, 0, 0, 24, 4, 13, 61, 1, 59, 84,
+    0, 3, 132, 6, 6, 0, 155, 56, 0, 11, 54, 2, 37, 15, 31, 24,
+    58, 53, 2, 189, 5, 15, 19, 263, 10, 1, 19, 16, 80, 7, 1, 4,
+    62, 91, 4, 97, 1, 4, 198, 32, 24, 72, 39, 18, 3, 4, 8, 2,
+    0, 0, 0, 1, 61, 1, 3, 277, 8, 45, 10, 0, 0, 54, 8, 29,
+    30, 48, 2, 23, 1, 20, 11, 20, 9, 0, 134, 2, 1, 5, 14, 164,
+    1, 16, 0, 7, 25, 107, 82, 131, 1, 16, 4, 9, 20, 4, 7, 0,
+    8, 11, 14, 16, 18, 91, 68, 26, 52, 130, 0, 1, 1, 195, 10, 19,
+    86, 2, 65, 65, 0, 120, 2, 134, 4, 0, 134, 394, 7, 93, 14, 56,
+    25, 19, 24, 29, 1, 0, 5, 18, 0, 0, 0, 14, 137, 2, 40, 9,
+    4, 3, 15, 48, 1, 1, 3, 46, 94, 11, 53, 36, 83, 3, 155, 18,
+    41, 60, 6, 48, 35, 22, 11, 180, 1, 1, 13, 117, 6, 46, 96, 6,
+    21, 25, 1, 8, 7, 60, 2, 0, 3, 30, 213, 1, 28, 0, 14, 6,
+    25, 98, 5, 34, 16, 46, 6, 8, 32, 84, 7, 14, 32, 112, 43, 22,
+    23, 90, 240, 47, 31, 28, 66, 2, 8, 9, 4, 15, 4, 103, 192, 18,
+    100, 8, 148, 14, 108, 8, 60, 86, 21, 34, 2, 0, 219, 4, 403, 12,
+    7, 1, 24, 0, 28, 0, 0, 0, 159, 1, 12, 0, 17, 2, 20, 22,
+    44, 7, 0, 166, 5, 22, 24, 207, 17, 4, 6, 53, 22, 64, 11, 48,
+    39, 14, 17, 0, 2, 22, 0, 102, 118, 21, 6, 3, 3, 32, 1, 3,
+    29, 0, 98, 45, 65, 289, 27, 20, 5, 100, 14, 4, 42, 3, 37, 0,
+    109, 1, 0, 90, 0, 1, 18, 140, 351, 23, 1, 84, 16, 3, 13, 1,
+    5, 85, 22, 124, 58, 36, 5, 46, 0, 7, 28, 2, 12, 36, 167, 1,
+    2, 14, 4, 118, 52, 1, 23, 17, 129, 117, 12, 2, 115, 13, 167, 16,
+    6, 6, 2, 125, 1, 1, 76, 22, 18, 42, 97, 8, 25, 4, 249, 27,
+    53, 30, 68, 24, 29, 288, 15, 47, 37, 12, 20, 0, 246, 65, 25, 56,
+    6, 122, 0, 0, 5, 1, 277, 70, 162, 16, 18, 6, 50, 47, 5, 31,
+    2, 50, 1, 2, 1, 1, 153, 5, 50, 367, 7, 17, 2, 6, 2, 27,
+    2, 30, 10, 183, 0, 0, 2, 193, 24, 15, 6, 235, 94, 22, 209, 58,
+    161, 46, 3, 107, 1, 3, 14, 5, 19, 5, 13, 66, 38, 1, 23, 3,
+    0, 4, 58, 15, 4, 94, 9, 4, 5, 89, 31, 10, 51, 61, 72, 74,
+    9, 107, 4, 87, 36, 22, 62, 21, 0, 0, 0, 19, 4, 0, 206, 4,
+    7, 248, 31, 58, 310, 182, 4, 1, 73, 98, 2, 30, 8, 6, 106, 0,
+    176, 186, 1, 119, 1, 81, 195, 15, 3, 13, 0, 0, 91, 29, 65, 171,
+    11, 41, 143, 0, 4, 14, 2, 33, 354, 17, 12, 69, 68, 21, 5, 76,
+    0, 2, 12, 648, 125, 0, 104, 0, 113, 1, 111, 241, 106, 18, 73, 15,
+    0, 5, 0, 37, 53, 24, 10, 1, 135, 11, 10, 13, 8, 0, 81, 66,
+    1, 102, 83, 135, 6, 14, 2, 50, 121, 45, 35, 86, 20, 0, 222, 1,
+    15, 15, 115, 48, 4, 202, 9, 0, 6, 0, 73, 0, 158, 12, 3, 6,
+    40, 45, 49, 149, 295, 13, 4, 15, 0, 21, 2, 24, 0, 0, 45, 3,
+    0, 0, 179, 49, 4, 0, 30, 14, 23, 136, 8, 32, 16, 146, 128, 40,
+    367, 12, 9, 1, 44, 49, 61, 0, 99, 16, 27, 12, 240, 106, 85, 60,
+    5, 8, 3, 0, 15, 122, 17, 101, 61, 69, 184, 30, 64, 84, 23, 2,
+    1, 1, 112, 58, 2, 115, 250, 53, 0, 0, 40, 19, 40, 44, 44, 18,
+    0, 35, 61, 31, 13, 4, 0, 119, 24, 316, 82, 26, 35, 0, 33, 1,
+    12, 66, 0, 69, 72, 17, 7, 5, 3, 0, 79, 26, 85, 38, 7, 202,
+    53, 54, 13, 25, 2, 141, 18, 1, 134, 22, 8, 0, 0, 96, 1, 1,
+    11, 0, 64, 28, 3, 85, 3, 64, 21, 7, 29, 16, 0, 62, 36, 86,
+    6, 10, 50, 21, 122, 0, 7, 47, 0, 0, 4, 18, 1, 12, 0, 61,
+    33, 29, 1, 5, 12, 3, 9, 62, 33, 101, 11, 250, 9, 25, 1, 311,
+    6, 129, 10, 248, 17, 4, 17, 34, 21, 40, 0, 11, 1, 156, 16, 0,
+    49, 84, 489, 31, 22, 3, 50, 10, 10, 53, 6, 72, 1, 119, 17, 66,
+    86, 14, 59, 16, 0, 41, 22, 22, 27, 15, 10, 46, 0, 0, 284, 0,
+    80, 42, 22, 107, 19, 25, 24, 63, 0, 4, 0, 20, 19, 17, 229, 7,
+    68, 11, 6, 0, 10, 43, 46, 109, 0, 41, 3, 0, 7, 3, 6, 173,
+    19, 12, 107, 35, 22, 51, 0, 3, 55, 11, 47, 26, 6, 0, 3, 100,
+    0, 7, 9, 9, 39, 11, 11, 199, 7, 101, 21, 19, 150, 15, 0, 337,
+    95, 206, 70, 11, 2, 0, 10, 34, 30, 1, 50, 0, 10, 0, 36, 100,
+    23, 179, 11, 17, 93, 186, 18, 4, 70, 10, 35, 22, 111, 11, 37, 10,
+    213, 1, 0, 61, 94, 111, 5, 0, 61, 2, 56, 7, 103, 2, 4, 3,
+    3, 43, 1, 9, 35, 385, 294, 6, 27, 1, 192, 276, 66, 355, 41, 0,
+    86, 1, 21, 142, 94, 121, 33, 4, 10, 6, 12, 14, 46, 73, 10, 58,
+    45, 23, 2, 173, 14, 2, 21, 7, 230, 10, 3, 4, 11, 2, 3, 36,
+    2, 244, 122, 1, 45, 1, 0, 17, 24, 2, 5, 159, 1, 6, 2, 79,
+    33, 82, 7, 4, 1, 41, 13, 64, 194, 28, 8, 4, 24, 2, 17, 120,
+    6, 7, 11, 319, 121, 4, 23, 1, 1, 105, 59, 15, 22, 42, 28, 37,
+    0, 6, 38, 133, 7, 21, 15, 10, 6, 10, 14, 56, 37, 10, 197, 31,
+    193, 17, 94, 40, 3, 67, 17, 132, 88, 32, 7, 10, 47, 0, 325, 25,
+    251, 3, 28, 16, 4, 6, 19, 45, 8, 90, 71, 147, 69, 267, 0, 12,
+    33, 40, 184, 50, 124, 38, 20, 87, 34, 99, 14, 1, 130, 6, 76, 17,
+    1, 0, 5, 10, 0, 71, 1, 27, 3, 25, 14, 9, 24, 43, 31, 9,
+    10, 10, 56, 8, 37, 46, 1, 0, 0, 11, 31, 67, 118, 30, 111, 46,
+    93, 5, 0, 19, 8, 119, 91, 102, 219, 117, 35, 2, 11, 6, 66, 31,
+    11, 163, 29, 497, 47, 4, 1, 60, 2, 5, 1, 8, 70, 17, 12, 16,
+    80, 5, 16, 129, 33, 47, 13, 40, 34, 0, 24, 0, 2, 1, 156, 288,
+    48, 20, 19, 0, 9, 82, 341, 104, 68, 5, 54, 126, 407, 22, 415, 24,
+    3, 0, 134, 5, 122, 25, 2, 7, 13, 120, 276, 1, 0, 17, 3, 7,
+    201, 165, 2, 5, 444, 2, 26, 2, 21, 5, 168, 3, 67, 142, 0, 35,
+    299, 1, 82, 77, 41, 1, 5, 0, 1, 2, 3, 86, 154, 17, 13, 23,
+    98, 13, 33, 22, 125, 24, 64, 0, 2, 37, 9, 334, 6, 2, 37, 2,
+    2, 94, 33, 1, 32, 38, 6, 22, 2, 56, 67, 263, 72, 34, 8, 49,
+    4, 73, 117, 130, 2, 2, 0, 5, 55, 5, 63, 0, 3, 28, 374, 16,
+    9, 0, 1, 0, 117, 97, 119, 19, 14, 131, 16, 14, 100, 1, 42, 22,
+    101, 2, 12, 0, 30, 6, 97, 0, 1, 126, 64, 116, 31, 1, 16, 0,
+    13, 31, 3, 37, 138, 11, 133, 117, 151, 6, 3, 42, 16, 8, 31, 118,
+    23, 1, 12, 1, 3, 18, 68, 38, 6, 113, 80, 10, 87, 7, 1, 13,
+    15, 25, 0, 69, 2, 69, 25, 17, 9, 69, 5, 0, 2, 103, 63, 109,
+    23, 0, 1, 30, 86, 8, 16, 5, 12, 55, 12, 0, 95, 89, 7, 0,
+    136, 58, 34, 8, 11, 2, 109, 0, 25, 21, 39, 47, 99, 65, 31, 59,
+    3, 88, 7, 13, 10, 23, 48, 64, 8, 15, 82, 26, 44, 0, 1, 56,
+    69, 53, 7, 8, 1, 172, 33, 0, 4, 0, 0, 21, 0, 1, 81, 8,
+    5, 221, 47, 62, 26, 74, 104, 4, 6, 105, 61, 87, 311, 11, 135, 6,
+    2, 9, 31, 0, 321, 22, 13, 66, 8, 161, 2, 0, 7, 47, 8, 8,
+    9, 33, 57, 17, 132, 8, 0, 0, 92, 19, 344, 74, 0, 14, 15, 3,
+    73, 11, 2, 2, 4, 19, 15, 6, 1, 0, 3, 0, 17, 1, 36, 54,
+    37, 26, 4, 8, 0, 12, 10, 101, 38, 34, 188, 5, 91, 0, 25, 12,
+    9, 20, 7, 16, 15, 47, 37, 51, 2, 60, 78, 7, 8, 28, 2, 46,
+    4, 6, 2, 19, 50, 1, 2, 3, 135, 91, 1, 53, 17, 11, 21, 20,
+    6, 305, 12, 146, 1, 25, 6, 49, 2, 55, 56, 68, 15, 1, 0, 4,
+    1, 16, 128, 550, 144, 21, 42, 7, 0, 25, 22, 11, 147, 15, 2, 80,
+    33, 1, 57, 136, 139, 8, 55, 269, 20, 83, 17, 11, 1, 2, 3, 180,
+    36, 84, 41, 0, 24, 1, 4, 52, 5, 56, 20, 157, 41, 0, 3, 14,
+    31, 65, 53, 4, 226, 84, 37, 0, 8, 124, 3, 125, 5, 20, 1, 46,
+    127, 2, 131, 0, 0, 0, 1, 3, 53, 55, 134, 11, 27, 160, 0, 10,
+    133, 0, 5, 48, 85, 25, 2, 6, 0, 3, 2, 496, 24, 42, 30, 2,
+    0, 1, 3, 11, 0, 7, 22, 10, 10, 32, 118, 3, 0, 0, 90, 1,
+    1, 4, 4, 50, 32, 30, 9, 9, 0, 44, 16, 89, 51, 29, 25, 41,
+    39, 538, 24, 31, 23, 5, 16, 14, 4, 229, 53, 0, 52, 4, 298, 28,
+    184, 19, 20, 54, 5, 24, 7, 25, 1, 44, 5, 50, 3, 21, 80, 56,
+    16, 68, 25, 260, 4, 108, 4, 3, 1, 1, 37, 156, 12, 87, 46, 259,
+    76, 16, 46, 9, 116, 1, 193, 87, 71, 27, 3, 114, 30, 105, 43, 210,
+    7, 60, 0, 2, 14, 0, 21, 0, 98, 0, 27, 6, 1, 10, 1, 10,
+    4, 66, 140, 3, 7, 39, 0, 35, 7, 83, 104, 31, 0, 114, 1, 13,
+    17, 17, 0, 30, 0, 89, 11, 67, 16, 7, 291, 9, 5, 1, 0, 73,
+    1, 439, 91, 27, 15, 150, 29, 36, 2, 6, 112, 1, 68, 160, 0, 1,
+    7, 43, 26, 25, 11, 92, 135, 23, 2, 35, 0, 24, 20, 4, 1, 52,
+    65, 18, 132, 69, 9, 4, 2, 68, 24, 16, 12, 1, 10, 38, 67, 22,
+    3, 24, 15, 16, 8, 16, 482, 26, 72, 48, 0, 53, 3, 84, 69, 159,
+    7, 8, 7, 155, 0, 8, 26, 21, 2, 46, 32, 56, 35, 7, 152, 77,
+    17, 23, 39, 3, 93, 0, 68, 0, 18, 12, 22, 12, 147, 12, 167, 12,
+    7, 56, 5, 22, 2, 10, 137, 0, 353, 43, 526, 2, 59, 10, 176, 492,
+    519, 0, 175, 10, 111, 4, 71, 80, 6, 4, 198, 240, 2, 56, 33, 0,
+    8, 35, 29, 1, 9, 4, 130, 15, 5, 6, 6, 34, 11, 293, 131, 78,
+    0, 305, 24, 190, 95, 61, 43, 11, 4, 243, 64, 0, 85, 21, 0, 6,
+    1, 132, 61, 36, 8, 6, 3, 241, 4, 9, 24, 10, 57, 19, 26, 86,
+    19, 67, 12, 86, 60, 44, 20, 1, 7, 1, 0, 25, 29, 273, 2, 18,
+    142, 1, 9, 32, 9, 0, 0, 7, 5, 29, 301, 340, 169, 10, 105, 3,
+    0, 0, 88, 108, 0, 27, 43, 14, 2, 6, 8, 4, 361, 59, 7, 365,
+    22, 85, 5, 330, 58, 103, 2, 11, 204, 1, 36, 474, 12, 52, 22, 118,
+    79, 115, 0, 15, 20, 9, 62, 19, 56, 84, 6, 0, 32, 24, 306, 66,
+    34, 2, 3, 45, 26, 160, 54, 9, 7, 16, 0, 36, 45, 49, 1, 289,
+    14, 75, 508, 61, 14, 203, 27, 18, 116, 12, 99, 6, 46, 12, 10, 27,
+    20, 114, 9, 3, 19, 1, 1, 3, 1, 5, 62, 50, 2, 51, 10, 161,
+    15, 12, 0, 12, 32, 101, 198, 175, 88, 0, 48, 46, 66, 128, 53, 261,
+    21, 150, 2, 11, 187, 0, 11, 294, 10, 0, 89, 94, 33, 64, 65, 13,
+    89, 0, 13, 21, 202, 53, 22, 16, 0, 46, 3, 49, 128, 2, 3, 113,
+    14, 114, 55, 1, 1, 38, 200, 61, 238, 30, 1, 7, 26, 23, 4, 1,
+    1, 2, 4, 4, 12, 155, 6, 158, 0, 69, 0, 63, 3, 15, 60, 62,
+    16, 10, 100, 6, 101, 1, 4, 51, 13, 18, 6, 39, 128, 135, 220, 13,
+    1, 85, 5, 2, 2, 123, 70, 26, 135, 393, 3, 148, 1, 18, 5, 140,
+    14, 6, 331, 63, 691, 0, 36, 279, 5, 9, 386, 43, 19, 0, 3, 0,
+    14, 0, 11, 5, 11, 17, 20, 25, 151, 42, 159, 135, 16, 1, 313, 49,
+    14, 33, 5, 3, 103, 131, 47, 47, 14, 46, 255, 182, 318, 40, 3, 1,
+    6, 12, 2, 0, 218, 0, 7, 4, 2, 35, 2, 79, 12, 22, 35, 67,
+    6, 16, 93, 1, 23, 0, 36, 134, 5, 44, 1, 117, 24, 149, 3, 0,
+    193, 113, 16, 52, 36, 32, 35, 9, 10, 20, 31, 4, 2, 20, 55, 16,
+    3, 4, 6, 11, 34, 16, 0, 2, 11, 0, 7, 1, 2, 3, 4, 1,
+    119, 18, 11, 1, 5, 1, 119, 65, 0, 0, 24, 0, 0, 209, 25, 2,
+    21, 0, 10, 2, 0, 196, 16, 13, 5, 5, 47, 5, 36, 146, 33, 42,
+    1, 136, 118, 243, 32, 23, 37, 66, 65, 10, 5, 4, 0, 0, 0, 34,
+    189, 14, 3, 55, 42, 0, 44, 106, 24, 26, 191, 15, 246, 262, 20, 14,
+    1, 237, 24, 45, 49, 58, 205, 188, 8, 14, 1, 4, 61, 24, 123, 31,
+    59, 12, 5, 36, 16, 122, 32, 63, 120, 2, 0, 1, 30, 14, 0, 49,
+    0, 3, 34, 10, 0, 140, 117, 7, 25, 12, 0, 74, 8, 0, 185, 62,
+    26, 161, 0, 16, 86, 28, 37, 35, 8, 33, 46, 98, 37, 1, 10, 38,
+    3, 13, 89, 228, 20, 56, 8, 210, 0, 16, 7, 3, 5, 66, 29, 5,
+    4, 194, 4, 99, 0, 17, 1, 123, 3, 7, 26, 73, 1, 65, 19, 255,
+    0, 32, 1, 298, 14, 12, 0, 60, 12, 195, 127, 7, 0, 388, 28, 93,
+    1, 44, 1, 2, 1, 45, 79, 5, 18, 56, 2, 81, 0, 7, 242, 223,
+    56, 114, 34, 119, 6, 57, 43, 4, 266, 5, 71, 1, 33, 37, 31, 14,
+    55, 35, 8, 4, 0, 7, 252, 42, 11, 6, 292, 454, 53, 14, 3, 4,
+    106, 28, 49, 17, 38, 16, 68, 184, 188, 36, 73, 3, 14, 9, 78, 43,
+    369, 83, 8, 27, 122, 1, 24, 8, 35, 279, 5, 109, 89, 2, 20, 194,
+    13, 119, 47, 74, 10, 2, 49, 4, 4, 38, 18, 65, 4, 131, 97, 49,
+    2, 0, 1, 15, 8, 213, 2, 13, 99, 18, 32, 9, 1, 50, 85, 13,
+    2, 0, 171, 6, 37, 8, 1, 1, 22, 20, 12, 82, 5, 10, 281, 89,
+    5, 45, 0, 0, 12, 110, 1, 65, 163, 3, 41, 4, 25, 71, 1, 4,
+    22, 37, 243, 0, 25, 5, 4, 161, 80, 0, 89, 13, 48, 118, 127, 10,
+    413, 17, 103, 69, 106, 13, 261, 139, 127, 85, 180, 5, 90, 3, 1, 124,
+    90, 5, 68, 50, 26, 0, 30, 127, 87, 8, 61, 13, 65, 42, 121, 13,
+    8, 28, 215, 11, 17, 17, 1, 21, 0, 1, 17, 3, 222, 22, 3, 217,
+    5, 3, 4, 61, 161, 429, 112, 35, 10, 56, 18, 40, 8, 32, 8, 5,
+    51, 316, 29, 41, 462, 1, 6, 70, 45, 139, 95, 0, 1, 125, 7, 80,
+    28, 36, 35, 50, 27, 490, 16, 112, 2, 6, 89, 5, 57, 34, 2, 85,
+    0, 23, 0, 106, 106, 101, 97, 81, 3, 4, 10, 167, 49, 1, 130, 12,
+    37, 1, 1, 9, 10, 17, 23, 34, 10, 104, 26, 45, 10, 35, 5, 98,
+    2, 1, 203, 1, 14, 54, 33, 108, 85, 9, 11, 165, 34, 96, 57, 185,
+    6, 2, 236, 5, 80, 125, 28, 1, 93, 38, 7, 34, 4, 2, 60, 42,
+    1, 131, 121, 5, 193, 4, 302, 310, 39, 53, 0, 79, 161, 0, 71, 1,
+    6, 2, 30, 50, 5, 22, 2, 234, 5, 165, 1, 86, 46, 159, 61, 18,
+    56, 5, 1, 5, 0, 89, 0, 17, 60, 113, 52, 3, 80, 48, 15, 83,
+    10, 31, 19, 142, 83, 72, 5, 2, 69, 16, 231, 7, 293, 1, 6, 188,
+    2, 4, 48, 46, 172, 49, 44, 16, 21, 1, 12, 96, 32, 187, 34, 26,
+    127, 1, 5, 14, 1, 143, 36, 74, 21, 1, 10, 39, 39, 96, 5, 32,
+    86, 304, 8, 31, 19, 79, 2, 62, 34, 0, 1, 4, 2, 80, 170, 0,
+    5, 10, 4, 48, 17, 2, 0, 11, 0, 141, 2, 1, 57, 62, 23, 34,
+    90, 75, 65, 0, 0, 112, 20, 0, 1, 0, 0, 0, 31, 10, 91, 85,
+    17, 2, 41, 18, 97, 8, 34, 128, 0, 45, 233, 70, 3, 272, 50, 19,
+    3, 0, 121, 64, 114, 10, 64, 0, 160, 23, 67, 10, 162, 12, 239, 0,
+    40, 7, 4, 137, 93, 8, 231, 13, 36, 47, 17, 91, 208, 1, 12, 11,
+    1, 14, 25, 6, 23, 67, 14, 3, 0, 77, 81, 28, 12, 4, 68, 196,
+    3, 34, 5, 100, 2, 27, 0, 0, 213, 38, 30, 82, 247, 47, 95, 4,
+    1, 24, 36, 311, 72, 1, 7, 33, 149, 0, 0, 2, 20, 93, 26, 20,
+    3, 1, 10, 6, 93, 0, 48, 2, 4, 94, 108, 203, 2, 36, 1, 16,
+    11, 28, 72, 0, 46, 118, 3, 87, 25, 5, 23, 12, 11, 84, 36, 102,
+    1, 0, 282, 0, 14, 6, 5, 292, 0, 62, 53, 82, 122, 25, 10, 0,
+    62, 89, 78, 32, 6, 9, 33, 27, 284, 417, 104, 112, 2, 7, 0, 143,
+    106, 4, 76, 28, 5, 6, 287, 8, 155, 36, 40, 10, 265, 270, 48, 473,
+    46, 3, 74, 249, 203, 13, 3, 9, 56, 3, 48, 2, 27, 91, 48, 3,
+    0, 0, 55, 37, 59, 32, 387, 198, 0, 1, 62, 5, 266, 60, 54, 8,
+    6, 173, 6, 30, 28, 72, 22, 28, 0, 0, 17, 56, 71, 10, 104, 81,
+    184, 38, 68, 61, 1, 7, 99, 252, 9, 210, 95, 166, 9, 5, 9, 12,
+    0, 145, 226, 101, 200, 36, 8, 203, 1, 1, 32, 385, 9, 119, 69, 0,
+    293, 0, 67, 52, 7, 46, 1, 81, 4, 5, 94, 7, 12, 268, 5, 6,
+    2, 2, 75, 191, 6, 43, 54, 3, 105, 15, 30, 101, 62, 338, 5, 23,
+    0, 0, 41, 1, 247, 68, 43, 1, 43, 14, 69, 3, 203, 12, 84, 26,
+    1, 15, 44, 174, 97, 19, 1, 7, 12, 1, 58, 1, 62, 0, 13, 68,
+    9, 84, 46, 4, 40, 0, 0, 26, 217, 0, 7, 0, 195, 47, 426, 10,
+    332, 53, 120, 10, 100, 97, 20, 25, 7, 42, 22, 3, 7, 7, 14, 3,
+    152, 5, 164, 57, 484, 107, 629, 41, 11, 74, 14, 7, 61, 4, 205, 131,
+    393, 7, 26, 40, 71, 4, 29, 27, 0, 496, 2, 1, 6, 9, 10, 49,
+    7, 0, 24, 3, 13, 7, 77, 118, 28, 86, 295, 352, 39, 164, 0, 22,
+    45, 8, 1, 131, 1, 226, 4, 2, 85, 5, 3, 56, 109, 61, 6, 75,
+    23, 9, 2, 18, 19, 32, 93, 2, 30, 9, 58, 18, 14, 0, 13, 334,
+    0, 27, 62, 41, 45, 293, 8, 0, 16, 182, 85, 121, 21, 49, 159, 10,
+    3, 14, 31, 54, 33, 11, 86, 33, 34, 31, 46, 25, 309, 55, 23, 23,
+    39, 6, 210, 68, 0, 566, 25, 6, 199, 133, 0, 151, 1, 19, 26, 4,
+    283, 145, 120, 8, 20, 189, 0, 259, 7, 23, 35, 82, 39, 141, 192, 61,
+    36, 7, 16, 1, 18, 0, 2, 67, 0, 12, 80, 6, 77, 56, 64, 86,
+    31, 159, 90, 22, 32, 48, 13, 22, 17, 45, 87, 63, 0, 168, 260, 6,
+    250, 10, 2, 3, 8, 10, 0, 21, 90, 94, 14, 71, 24, 154, 98, 1,
+    28, 5, 0, 145, 210, 28, 75, 13, 14, 138, 103, 22, 144, 72, 3, 4,
+    282, 36, 11, 289, 14, 0, 0, 124, 78, 16, 0, 139, 32, 5, 200, 1,
+    20, 1, 4, 188, 48, 170, 29, 7, 19, 63, 40, 9, 78, 1, 210, 67,
+    343, 30, 112, 14, 32, 20, 68, 122, 456, 23, 0, 8, 0, 31, 15, 92,
+    9, 0, 78, 137, 172, 50, 6, 85, 68, 104, 7, 13, 39, 12, 177, 2,
+    0, 0, 49, 55, 12, 267, 11, 74, 64, 83, 17, 84, 11, 15, 0, 211,
+    200, 2, 36, 108, 356, 112, 10, 0, 680, 38, 200, 35, 30, 12, 71, 132,
+    13, 18, 12, 1, 16, 21, 109, 6, 45, 8, 39, 208, 38, 194, 17, 18,
+    104, 248, 411, 43, 85, 1, 105, 17, 4, 194, 126, 15, 44, 30, 135, 0,
+    8, 86, 105, 16, 8, 22, 2, 128, 0, 1, 324, 13, 17, 14, 103, 4,
+    104, 52, 2, 0, 81, 17, 0, 568, 562, 54, 5, 0, 119, 115, 20, 203,
+    91, 44, 36, 7, 96, 260, 17, 5, 66, 18, 61, 2, 21, 147, 10, 0,
+    0, 97, 12, 113, 260, 110, 84, 169, 0, 1, 8, 3, 0, 0, 34, 26,
+    19, 23, 0, 22, 145, 148, 47, 24, 19, 4, 192, 113, 42, 5, 6, 181,
+    158, 20, 7, 19, 30, 51, 113, 105, 6, 1, 75, 134, 79, 107, 285, 45
+};
+
+const unsigned short hash7_values[] =
+{
+    6826, 3065, 2639, 0, 270, 2726, 60, 244, 47, 131, 0, 257, 6251, 239, 2966, 2506,
+    1610, 4233, 3173, 2226, 0, 131, 2600, 0, 0, 3217, 186, 0, 299, 0, 52, 1633,
+    2655, 1742, 3548, 4460, 2141, 0, 2592, 1885, 295, 226, 225, 4701, 3097, 2783, 231, 2546,
+    225, 0, 6386, 1679, 2679, 211, 0, 0, 2756, 1600, 313, 133, 280, 3051, 136, 0,
+    3390, 5627, 2545, 175, 144, 200, 5818, 223, 2961, 5966, 0, 1687, 2604, 3123, 2724, 199,
+    2481, 242, 123, 83, 249, 2815, 2788, 2625, 4271, 0, 2150, 0, 4044, 0, 0, 2622,
+    159, 222, 59, 3441, 176, 1985, 5455, 3916, 4307, 3328, 2785, 2493, 0, 0, 0, 0,
+    5854, 288, 4940, 5328, 4264, 2634, 3106, 275, 121, 0, 0, 4455, 5662, 0, 3044, 6076,
+    0, 23, 1875, 4894, 215, 233, 1831, 3186, 3176, 1756, 0, 0, 213, 0, 84, 3411,
+    2824, 5985, 2975, 1839, 2471, 0, 0, 0, 3219, 3134, 2560, 2416, 1798, 96, 312, 5152,
+    3173, 6103, 0, 0, 0, 3208, 6749, 0, 5768, 3085, 2661, 39, 5895, 3020, 0, 305,
+    202, 261, 5803, 0, 2007, 268, 3019, 1627, 3040, 210, 143, 0, 0, 5406, 2866, 2367,
+    0, 0, 0, 1688, 3547, 5416, 0, 1808, 3845, 0, 5432, 1822, 301, 2537, 2492, 1615,
+    236, 0, 0, 2656, 0, 320, 1601, 0, 4426, 3019, 107, 2856, 1743, 244, 0, 0,
+    2507, 0, 309, 285, 60, 2740, 5152, 0, 4878, 218, 0, 1809, 6554, 2142, 2309, 6256,
+    2680, 3045, 0, 0, 2659, 2491, 5145, 0, 0, 3776, 0, 0, 5099, 2402, 145, 3008,
+    5226, 3020, 3296, 5526, 2593, 2997, 0, 3172, 216, 293, 2627, 1961, 1878, 0, 3401, 0,
+    1604, 3020, 2976, 303, 2681, 120, 1679, 262, 0, 3833, 2424, 0, 3007, 0, 2546, 4701,
+    2236, 2206, 0, 2754, 2699, 131, 16, 315, 3161, 2875, 72, 0, 126, 2483, 2534, 3136,
+    7017, 6729, 112, 212, 0, 267, 3183, 0, 318, 2921, 0, 2150, 0, 160, 3084, 5591,
+    0, 171, 5201, 2790, 0, 3327, 2943, 5408, 4472, 2545, 3032, 3198, 2727, 2606, 6031, 2541,
+    2865, 2347, 1987, 193, 2758, 0, 4235, 3195, 223, 3684, 2967, 3612, 0, 2359, 6040, 3095,
+    25, 2616, 0, 178, 182, 192, 183, 2502, 167, 2861, 3857, 0, 2350, 4528, 5333, 213,
+    1853, 0, 4218, 4042, 6415, 0, 3219, 224, 0, 5362, 3317, 5378, 284, 5662, 0, 296,
+    157, 0, 3345, 2986, 2788, 0, 2140, 0, 0, 3777, 3250, 2073, 2823, 0, 6116, 221,
+    64, 6266, 3997, 2672, 121, 59, 155, 3181, 110, 2220, 286, 4665, 0, 0, 2036, 2547,
+    0, 2888, 303, 2865, 0, 2568, 1609, 312, 2542, 175, 0, 2821, 2646, 0, 0, 0,
+    4498, 303, 0, 3625, 0, 0, 286, 61, 0, 4906, 3100, 246, 1689, 186, 182, 3045,
+    299, 2471, 4306, 0, 2666, 2977, 2644, 2493, 5780, 131, 3480, 3062, 0, 185, 2322, 1841,
+    2492, 2613, 6805, 0, 1891, 0, 2832, 3241, 3316, 3307, 187, 5538, 0, 225, 2291, 6694,
+    244, 236, 257, 0, 2581, 2778, 237, 146, 0, 191, 2658, 23, 6679, 2413, 4656, 2491,
+    2934, 0, 0, 0, 120, 0, 3019, 2628, 5672, 197, 210, 0, 0, 85, 2545, 1952,
+    306, 2714, 1941, 3183, 2442, 3296, 1602, 2831, 275, 2921, 2703, 0, 0, 4754, 5115, 0,
+    2177, 2946, 0, 41, 2139, 308, 2846, 6565, 273, 0, 6807, 0, 5051, 2865, 1819, 2996,
+    0, 0, 3329, 1878, 0, 5812, 3055, 3032, 0, 5250, 27, 230, 208, 0, 132, 0,
+    5634, 279, 6393, 0, 211, 5993, 2428, 229, 0, 4755, 6056, 2988, 0, 2795, 196, 2579,
+    0, 119, 0, 2138, 287, 0, 0, 108, 3272, 3096, 5365, 3662, 2688, 18, 0, 0,
+    214, 2614, 0, 4209, 4868, 2501, 3801, 2760, 2487, 2514, 2855, 2864, 5757, 2567, 286, 2556,
+    222, 2663, 1912, 1678, 0, 2103, 6209, 23, 5590, 3107, 3631, 178, 3357, 0, 0, 6295,
+    2831, 1605, 1880, 16, 0, 4667, 0, 2038, 2955, 174, 3231, 0, 0, 6186, 3019, 3777,
+    5309, 173, 2495, 6856, 172, 3099, 290, 279, 0, 6006, 2492, 0, 4593, 0, 2602, 1727,
+    0, 272, 2482, 2595, 3087, 310, 0, 2920, 0, 144, 2997, 271, 220, 3696, 2818, 0,
+    0, 3119, 4005, 289, 2470, 5319, 241, 2585, 0, 5805, 2339, 1706, 71, 1865, 156, 3216,
+    187, 312, 1754, 256, 6022, 2842, 1648, 3086, 2702, 0, 5340, 2778, 2722, 47, 2613, 144,
+    2745, 77, 2909, 4506, 2102, 3062, 2490, 0, 109, 5545, 4492, 2612, 2732, 2216, 0, 2868,
+    4122, 1600, 0, 1952, 167, 3109, 0, 89, 197, 26, 2875, 0, 179, 1621, 273, 0,
+    36, 322, 2942, 0, 0, 2027, 2189, 0, 5132, 0, 3636, 314, 5561, 2527, 3099, 0,
+    1600, 3565, 0, 2614, 7008, 0, 159, 1941, 3243, 145, 2647, 5782, 4242, 0, 3163, 275,
+    3018, 317, 0, 0, 3996, 3315, 145, 3054, 0, 218, 285, 248, 0, 3096, 6437, 0,
+    4767, 3056, 2787, 39, 0, 2734, 0, 7009, 3205, 2472, 2776, 299, 0, 3118, 181, 320,
+    2516, 189, 244, 0, 2215, 0, 2767, 0, 0, 3263, 231, 3988, 0, 0, 212, 4870,
+    2514, 3349, 0, 6274, 5141, 132, 218, 276, 0, 0, 3260, 0, 1942, 0, 298, 2072,
+    2985, 111, 4391, 292, 5641, 3294, 1941, 0, 5848, 3078, 2854, 234, 2996, 85, 285, 0,
+    130, 2968, 2282, 3232, 5159, 4372, 0, 2039, 0, 0, 0, 2608, 0, 0, 2337, 2479,
+    219, 4669, 3102, 5537, 3141, 5195, 2497, 38, 1611, 2207, 4967, 4343, 229, 0, 3197, 0,
+    3087, 0, 23, 0, 39, 0, 5528, 2943, 189, 0, 1829, 0, 2349, 5847, 2472, 302,
+    205, 2757, 2843, 2802, 5547, 255, 2526, 312, 0, 0, 245, 2149, 2930, 0, 1600, 3249,
+    291, 0, 173, 2105, 6027, 1641, 2613, 0, 2528, 3227, 156, 6799, 4702, 2931, 2648, 3263,
+    47, 131, 3750, 0, 1755, 260, 220, 64, 3109, 1940, 4026, 300, 2225, 0, 4877, 4718,
+    0, 1606, 0, 0, 38, 0, 2880, 26, 0, 2292, 62, 2875, 197, 2798, 2755, 0,
+    0, 190, 0, 274, 5966, 164, 4151, 0, 2027, 0, 0, 3104, 253, 0, 4016, 3154,
+    1895, 2234, 3557, 3260, 3131, 3822, 3573, 143, 5774, 0, 0, 3766, 2908, 0, 3218, 0,
+    0, 2646, 155, 287, 172, 155, 0, 0, 1745, 2084, 0, 0, 309, 1886, 0, 5979,
+    0, 3152, 0, 0, 0, 0, 2944, 203, 3866, 3776, 1764, 35, 2547, 2761, 115, 3987,
+    3074, 2901, 6316, 0, 4731, 2964, 285, 3118, 0, 1611, 168, 3381, 263, 17, 2293, 5750,
+    0, 0, 0, 2835, 0, 2787, 2831, 4481, 1830, 5555, 116, 312, 226, 78, 2578, 7377,
+    0, 223, 0, 7046, 3251, 0, 0, 2006, 2618, 3232, 2930, 184, 0, 307, 73, 3208,
+    2480, 5910, 1979, 0, 306, 212, 0, 7223, 3051, 2308, 321, 2447, 5641, 0, 0, 0,
+    171, 38, 281, 2976, 0, 144, 156, 2160, 0, 3035, 244, 0, 247, 2339, 2523, 229,
+    316, 0, 190, 5531, 2809, 0, 4878, 3887, 3162, 0, 2009, 0, 4445, 188, 0, 4426,
+    0, 0, 184, 2075, 2762, 0, 212, 1657, 0, 234, 4966, 208, 2930, 6832, 2529, 0,
+    1755, 192, 0, 0, 2971, 1634, 231, 2942, 3029, 4704, 2635, 209, 3140, 47, 0, 5209,
+    292, 225, 2987, 2685, 3131, 1606, 3031, 230, 0, 0, 5746, 51, 0, 0, 0, 28,
+    0, 0, 205, 1601, 2534, 0, 1600, 2603, 0, 3175, 1906, 0, 176, 0, 0, 0,
+    3556, 0, 0, 0, 2481, 2986, 0, 315, 0, 3156, 4921, 2614, 4309, 2235, 13, 272,
+    0, 0, 0, 0, 0, 0, 2936, 0, 0, 3106, 87, 0, 2956, 0, 5946, 0,
+    2547, 1604, 194, 2954, 3546, 1605, 3260, 5605, 0, 2270, 2007, 2602, 0, 5582, 2811, 0,
+    2479, 0, 0, 2341, 95, 50, 233, 294, 0, 3989, 85, 2733, 6030, 0, 2010, 3428,
+    2572, 2018, 5141, 237, 3220, 1980, 2908, 4129, 0, 4272, 2822, 3383, 2977, 0, 3435, 2911,
+    3293, 109, 3189, 230, 191, 246, 3304, 312, 266, 0, 3785, 252, 5541, 0, 304, 0,
+    3285, 4226, 2204, 3208, 2668, 6137, 0, 0, 2766, 2484, 4102, 1830, 3821, 287, 2381, 4970,
+    4437, 5406, 0, 5890, 2897, 3073, 4065, 5172, 199, 0, 2484, 43, 107, 0, 4426, 219,
+    0, 0, 198, 238, 0, 1745, 149, 0, 0, 1821, 0, 0, 0, 252, 3021, 234,
+    159, 2503, 100, 3602, 4428, 12, 5532, 84, 3559, 0, 0, 1951, 1885, 244, 0, 3381,
+    5096, 3073, 1698, 0, 3140, 0, 39, 11, 290, 2864, 2402, 0, 0, 2045, 0, 3262,
+    3231, 305, 2897, 235, 0, 0, 0, 2308, 4706, 239, 2891, 5371, 0, 317, 5171, 0,
+    303, 2754, 6420, 261, 0, 145, 2999, 143, 2649, 279, 2494, 0, 0, 2931, 2468, 4869,
+    6066, 0, 263, 6190, 297, 2515, 5635, 284, 206, 1962, 2256, 96, 0, 3051, 0, 202,
+    0, 2822, 2432, 317, 203, 72, 0, 221, 3239, 3033, 2284, 4930, 4974, 5599, 3128, 206,
+    2931, 4219, 0, 3165, 171, 221, 243, 1754, 173, 2513, 272, 5846, 122, 2603, 0, 0,
+    0, 4273, 2009, 230, 5584, 6699, 2547, 224, 0, 2710, 200, 50, 89, 0, 0, 32,
+    2270, 2602, 0, 4547, 6031, 2534, 282, 1819, 3131, 5810, 3046, 2161, 0, 4893, 4173, 178,
+    3224, 0, 0, 0, 284, 0, 1996, 1875, 211, 2657, 4217, 3383, 3273, 1689, 6689, 2952,
+    3601, 3338, 27, 2668, 3305, 3930, 4428, 1609, 192, 0, 2776, 3086, 291, 3274, 1608, 0,
+    113, 2810, 161, 3030, 272, 3262, 302, 2435, 302, 173, 0, 99, 5106, 5086, 5409, 0,
+    0, 0, 3794, 0, 258, 3285, 3073, 0, 1744, 2169, 2842, 209, 107, 0, 63, 6477,
+    3173, 4261, 0, 6399, 0, 12, 199, 0, 0, 246, 3385, 4216, 3294, 0, 4315, 0,
+    2591, 5986, 2900, 0, 0, 265, 220, 2898, 0, 287, 2216, 5096, 0, 59, 2096, 4902,
+    0, 305, 0, 2537, 0, 1677, 6358, 0, 0, 0, 2073, 2403, 262, 0, 3236, 85,
+    3018, 2318, 237, 2779, 1742, 1640, 267, 133, 147, 2952, 191, 214, 291, 0, 1603, 4570,
+    3767, 175, 6069, 2754, 3295, 2366, 0, 0, 2963, 0, 0, 84, 0, 2936, 4935, 2622,
+    2834, 2516, 267, 1829, 1953, 2776, 0, 0, 0, 2867, 0, 1772, 0, 2468, 1820, 2677,
+    3646, 0, 2357, 2118, 0, 3062, 3166, 3010, 280, 5599, 0, 0, 5251, 4482, 2348, 0,
+    199, 2877, 2952, 0, 0, 89, 2943, 3330, 0, 3036, 2633, 298, 6816, 201, 1698, 2876,
+    52, 2893, 2405, 0, 0, 174, 0, 0, 2605, 0, 2904, 0, 2473, 2693, 249, 3196,
+    211, 1819, 0, 2602, 291, 3055, 97, 2776, 228, 288, 3603, 2161, 0, 322, 2724, 248,
+    0, 0, 1688, 1810, 219, 2515, 192, 5757, 3040, 0, 2152, 6203, 233, 0, 2974, 1610,
+    210, 3172, 0, 2668, 2283, 2679, 134, 0, 0, 6478, 4938, 230, 3796, 0, 2652, 3931,
+    236, 2057, 0, 3128, 1809, 2486, 4887, 1914, 4432, 2710, 222, 2956, 3098, 1605, 3041, 180,
+    0, 0, 0, 7097, 0, 101, 1874, 225, 0, 3430, 5086, 1746, 5969, 2580, 203, 4789,
+    267, 12, 5801, 0, 3088, 0, 0, 1897, 0, 0, 4868, 0, 283, 284, 3769, 2924,
+    0, 296, 2234, 6721, 0, 5767, 3077, 308, 2216, 0, 0, 0, 0, 0, 0, 3282,
+    3086, 2969, 276, 0, 2780, 4321, 5320, 107, 2273, 59, 2736, 2864, 5317, 146, 213, 2624,
+    0, 2750, 3996, 2868, 170, 2589, 2112, 2976, 2689, 5087, 3110, 4511, 0, 3128, 0, 3658,
+    3186, 1780, 108, 3318, 3120, 1957, 4263, 2423, 2799, 0, 0, 1625, 1697, 5105, 4208, 2168,
+    5545, 3041, 2636, 2227, 4646, 7217, 0, 1650, 0, 2843, 216, 213, 0, 2546, 179, 1820,
+    232, 5613, 3153, 3767, 2777, 262, 71, 224, 2087, 2845, 2206, 275, 0, 3163, 270, 2483,
+    5276, 0, 6033, 271, 3057, 0, 4746, 11, 5814, 0, 187, 0, 0, 2732, 0, 0,
+    2930, 3058, 2406, 3205, 234, 3074, 2766, 2205, 1764, 2735, 2721, 196, 0, 3207, 297, 2607,
+    0, 133, 204, 5760, 2931, 5977, 7148, 2072, 290, 0, 3565, 2770, 6351, 0, 0, 0,
+    2337, 3194, 218, 297, 11, 1905, 2787, 3040, 3986, 242, 4945, 0, 25, 132, 1944, 4086,
+    4711, 0, 285, 6279, 173, 3340, 23, 3185, 0, 56, 1812, 0, 3790, 2845, 3198, 5548,
+    1609, 2969, 3128, 2518, 2062, 0, 0, 0, 260, 3172, 3910, 5308, 311, 65, 2790, 4377,
+    51, 94, 2666, 211, 3000, 0, 1874, 259, 6524, 1612, 3345, 3090, 5086, 221, 2944, 4206,
+    179, 2473, 3194, 5862, 131, 0, 190, 6888, 2207, 2601, 2886, 7102, 0, 2160, 3769, 4747,
+    2724, 3007, 2347, 2504, 2516, 304, 131, 303, 169, 319, 6238, 0, 2151, 3063, 0, 11,
+    173, 3650, 6196, 1810, 3549, 2424, 2539, 2204, 2843, 3018, 3095, 0, 0, 0, 1691, 0,
+    6038, 210, 5235, 1643, 274, 7091, 2275, 3114, 296, 2559, 293, 2934, 108, 97, 1763, 2953,
+    167, 5143, 0, 3220, 4156, 1961, 1607, 2242, 1608, 66, 3251, 5748, 0, 2611, 5546, 273,
+    2944, 3096, 1825, 107, 0, 0, 5966, 310, 0, 3142, 0, 3462, 0, 262, 1899, 6023,
+    3567, 3574, 0, 0, 0, 3838, 2227, 24, 306, 4748, 0, 37, 3710, 5756, 271, 5995,
+    11, 3771, 3999, 3221, 0, 2777, 1699, 2637, 2141, 208, 0, 0, 297, 5415, 0, 248,
+    215, 0, 2493, 0, 29, 2834, 196, 4710, 2792, 2074, 155, 0, 3141, 2842, 7277, 0,
+    2836, 3074, 291, 2301, 2964, 0, 5385, 0, 263, 2864, 1812, 290, 2787, 3084, 0, 2985,
+    4350, 0, 3153, 187, 6330, 2801, 4657, 252, 2210, 2483, 0, 0, 179, 3063, 3391, 6231,
+    0, 168, 0, 3271, 0, 2560, 3209, 0, 2941, 3284, 0, 2699, 1814, 0, 2733, 0,
+    2754, 0, 3242, 48, 2970, 0, 3238, 3185, 223, 2644, 4095, 2877, 7360, 2638, 1889, 2701,
+    156, 2976, 2480, 2480, 2996, 2851, 26, 3195, 3353, 5981, 290, 2859, 0, 0, 2876, 229,
+    316, 3002, 5855, 2804, 3689, 0, 233, 4445, 35, 3018, 1607, 2723, 3162, 143, 0, 273,
+    273, 2374, 281, 0, 155, 3009, 0, 196, 2151, 3022, 0, 4041, 2814, 2548, 4285, 169,
+    0, 266, 2721, 0, 2809, 0, 2722, 0, 3511, 1662, 2425, 254, 190, 210, 0, 177,
+    208, 4924, 62, 15, 0, 5746, 6198, 2611, 1927, 2625, 1766, 2402, 2336, 6722, 0, 5804,
+    0, 319, 2941, 0, 225, 0, 3179, 2849, 315, 2494, 1846, 2646, 4436, 305, 172, 4785,
+    29, 3223, 6045, 1613, 4427, 0, 0, 4453, 2825, 108, 2250, 4333, 283, 0, 2877, 306,
+    2666, 0, 4291, 5582, 0, 0, 3273, 5417, 0, 3315, 1605, 2919, 1605, 320, 0, 248,
+    6247, 2217, 2571, 0, 0, 2667, 2143, 2551, 0, 3095, 3551, 0, 0, 2802, 0, 318,
+    0, 0, 2525, 0, 1603, 0, 3990, 201, 272, 6038, 2535, 0, 0, 3293, 0, 155,
+    5142, 3051, 2505, 0, 206, 5663, 304, 1961, 4659, 2604, 2582, 0, 0, 3405, 1680, 3150,
+    281, 3212, 2029, 4097, 4135, 0, 0, 3286, 0, 2980, 0, 2746, 5592, 2490, 179, 0,
+    0, 0, 251, 2204, 2710, 2911, 3831, 2670, 5628, 2271, 0, 3185, 2875, 0, 307, 314,
+    148, 2215, 5937, 1970, 2270, 3282, 2877, 0, 0, 3253, 4240, 107, 0, 3821, 2946, 0,
+    202, 72, 4059, 2702, 0, 2506, 293, 0, 4713, 0, 2876, 270, 0, 2845, 0, 0,
+    2008, 2725, 2360, 4447, 0, 3618, 3024, 224, 3023, 0, 3095, 0, 2568, 2402, 6075, 5097,
+    0, 169, 2601, 243, 306, 1714, 0, 4967, 2155, 6904, 5387, 4043, 0, 2725, 4876, 5883,
+    271, 0, 1609, 3263, 2892, 0, 218, 133, 6350, 4225, 0, 0, 119, 35, 0, 0,
+    217, 2336, 167, 0, 241, 2754, 3073, 0, 0, 226, 2416, 199, 2226, 0, 6768, 197,
+    0, 0, 2143, 194, 2440, 0, 2480, 2889, 0, 1753, 31, 3326, 4648, 0, 2788, 3731,
+    0, 3142, 0, 283, 269, 0, 0, 0, 0, 320, 3184, 2495, 195, 59, 184, 5820,
+    2228, 2832, 0, 147, 0, 2833, 2853, 3587, 0, 5585, 3306, 2805, 2552, 208, 4296, 245,
+    0, 227, 3043, 4041, 0, 0, 5857, 86, 200, 4674, 0, 2656, 0, 1972, 0, 1875,
+    1603, 0, 0, 2368, 2581, 293, 2095, 50, 311, 2219, 49, 0, 107, 6047, 178, 2094,
+    2888, 5583, 3306, 0, 0, 2469, 1602, 0, 0, 3407, 2661, 5538, 0, 4660, 0, 295,
+    40, 2922, 2710, 96, 2914, 2458, 268, 202, 3275, 11, 0, 2669, 0, 48, 4650, 5675,
+    2810, 302, 0, 2769, 2966, 239, 0, 3824, 2713, 2183, 315, 0, 0, 3262, 2872, 3246,
+    3227, 0, 2300, 0, 0, 0, 3239, 0, 3611, 6575, 5090, 3110, 281, 0, 2502, 4481,
+    4885, 3173, 0, 2103, 0, 155, 2748, 2570, 0, 300, 0, 3287, 2568, 0, 71, 2846,
+    269, 4810, 3317, 0, 2571, 2656, 0, 6471, 314, 3273, 2028, 3043, 1602, 5099, 6000, 3360,
+    0, 2986, 53, 0, 186, 5096, 5831, 0, 1682, 279, 3111, 3283, 1839, 0, 0, 4043,
+    0, 6360, 3161, 1707, 2735, 143, 3067, 0, 2691, 302, 0, 250, 0, 259, 0, 0,
+    2754, 2615, 0, 2963, 0, 0, 241, 184, 278, 2376, 1742, 233, 292, 13, 0, 0,
+    0, 267, 28, 3139, 5002, 0, 2517, 220, 2746, 4866, 3053, 0, 2677, 4052, 2682, 322,
+    194, 0, 86, 0, 1600, 0, 2362, 1772, 1876, 2876, 2985, 3184, 2086, 1601, 0, 0,
+    5187, 2943, 4482, 3007, 0, 0, 4426, 4045, 2920, 2352, 188, 1608, 0, 2083, 0, 3043,
+    4762, 2636, 1781, 4216, 4687, 0, 0, 296, 0, 0, 0, 309, 1974, 213, 0, 3172,
+    2415, 0, 4091, 168, 97, 53, 0, 0, 0, 3778, 3874, 0, 0, 299, 2744, 192,
+    3015, 0, 4527, 0, 120, 2480, 1687, 168, 0, 2217, 2768, 3307, 2281, 233, 96, 2634,
+    110, 2933, 308, 5786, 2673, 6230, 0, 0, 2681, 0, 61, 62, 0, 2888, 2246, 0,
+    0, 1943, 3546, 0, 2710, 2028, 206, 2855, 0, 0, 3101, 2715, 2821, 3183, 2019, 289,
+    0, 3604, 0, 2750, 0, 0, 0, 6580, 3112, 2570, 3998, 0, 4888, 0, 2513, 2666,
+    0, 3052, 5009, 0, 0, 2812, 202, 3627, 185, 3110, 266, 0, 2491, 0, 5766, 2304,
+    2273, 2778, 0, 0, 219, 5307, 95, 1809, 3294, 4491, 0, 2567, 0, 2856, 0, 5325,
+    198, 0, 2221, 3054, 241, 2629, 252, 3283, 0, 0, 4491, 249, 317, 0, 227, 4490,
+    2946, 2537, 0, 269, 0, 3018, 0, 2765, 0, 0, 294, 193, 0, 174, 150, 2692,
+    0, 136, 0, 2735, 2910, 0, 2589, 0, 0, 3319, 3227, 3150, 75, 146, 2177, 0,
+    322, 207, 86, 2168, 2996, 2017, 5756, 321, 4646, 2909, 5690, 3399, 2926, 183, 281, 0,
+    48, 1876, 0, 5222, 4006, 2955, 61, 5010, 3117, 3326, 4867, 108, 2209, 3305, 71, 4484,
+    4262, 0, 0, 7014, 1608, 4930, 109, 4756, 3830, 239, 0, 5985, 168, 0, 0, 0,
+    4054, 2094, 1602, 5537, 119, 0, 0, 0, 215, 4832, 0, 2766, 2752, 6352, 72, 0,
+    4726, 247, 222, 2771, 277, 1742, 0, 2617, 3207, 1946, 4207, 0, 3040, 132, 0, 2600,
+    224, 2615, 0, 6188, 0, 0, 224, 55, 23, 2573, 255, 5141, 5529, 248, 2638, 60,
+    6240, 124, 0, 0, 2502, 5626, 0, 0, 4020, 76, 2858, 1904, 3175, 13, 3154, 209,
+    288, 196, 0, 275, 3780, 1621, 285, 271, 25, 2020, 217, 0, 0, 0, 4438, 28,
+    2755, 1676, 317, 1609, 0, 5988, 2603, 279, 2513, 2930, 0, 3122, 0, 2481, 2021, 1608,
+    1756, 255, 0, 209, 3029, 4270, 0, 2800, 0, 5316, 5326, 5408, 1895, 278, 187, 309,
+    292, 0, 0, 2512, 212, 0, 7287, 0, 191, 2032, 0, 0, 0, 0, 2855, 6715,
+    234, 4493, 0, 1632, 2482, 193, 6679, 0, 217, 251, 2691, 0, 2878, 2897, 3434, 2954,
+    2469, 0, 301, 0, 1774, 4922, 25, 0, 0, 2538, 0, 179, 3233, 0, 3227, 310,
+    3905, 0, 0, 3646, 1963, 1838, 231, 2823, 0, 2948, 76, 3143, 4080, 5712, 2276, 0,
+    0, 2777, 252, 3054, 183, 3141, 0, 2171, 2274, 5003, 0, 0, 0, 0, 42, 0,
+    3130, 4229, 312, 0, 215, 106, 0, 14, 3293, 273, 2433, 3241, 2338, 1809, 198, 3085,
+    0, 6373, 0, 201, 4720, 3840, 7056, 3096, 0, 1724, 2656, 2506, 2469, 2076, 2604, 168,
+    258, 0, 2638, 0, 5847, 5528, 4446, 4932, 40, 0, 0, 2997, 2726, 3021, 170, 83,
+    6233, 1610, 52, 5113, 259, 0, 132, 291, 0, 3315, 206, 4867, 5370, 250, 0, 0,
+    261, 0, 0, 190, 1885, 2990, 63, 2592, 3392, 2600, 136, 244, 230, 2793, 0, 4355,
+    6386, 2139, 0, 0, 277, 228, 156, 4345, 0, 281, 0, 0, 0, 2966, 257, 0,
+    3556, 0, 3008, 2625, 0, 0, 4022, 3175, 5186, 2590, 5627, 2337, 3076, 3174, 2733, 0,
+    1808, 2485, 3155, 240, 2998, 0, 2206, 3793, 2644, 229, 1886, 0, 0, 5150, 3113, 3354,
+    2514, 0, 3173, 2859, 0, 2536, 3095, 0, 2512, 207, 2469, 0, 3867, 0, 3207, 222,
+    131, 0, 1631, 0, 2826, 191, 4454, 0, 2149, 112, 2535, 2897, 0, 1604, 2085, 270,
+    0, 6798, 0, 2789, 157, 121, 260, 267, 0, 1875, 3610, 2880, 2901, 2963, 3197, 5765,
+    247, 2798, 3073, 3823, 25, 1794, 0, 1706, 2831, 1978, 5444, 0, 318, 4440, 2813, 210,
+    5803, 186, 2648, 0, 0, 4825, 1848, 3427, 62, 293, 2481, 5153, 2285, 305, 0, 2732,
+    2855, 0, 0, 6103, 3041, 252, 0, 15, 4566, 2696, 2722, 4430, 1831, 3218, 6068, 0,
+    213, 2747, 5362, 2739, 236, 3654, 1611, 155, 0, 3557, 1743, 209, 171, 2680, 2501, 0,
+    0, 5121, 0, 2075, 6252, 0, 0, 0, 3019, 1808, 3042, 251, 5976, 0, 6022, 3174,
+    0, 0, 2835, 4736, 4665, 2506, 180, 6847, 2537, 219, 0, 5530, 272, 2678, 143, 2309,
+    178, 2741, 120, 3051, 4879, 206, 5747, 2110, 2656, 250, 2790, 274, 0, 2579, 3297, 236,
+    0, 1677, 2480, 7253, 2593, 3117, 0, 5191, 202, 5371, 1758, 0, 2600, 3393, 131, 0,
+    307, 3183, 4218, 2072, 3337, 83, 6414, 5882, 0, 3832, 297, 281, 0, 2433, 0, 261,
+    217, 1605, 131, 2294, 2810, 216, 1604, 2236, 0, 5627, 0, 4647, 229, 0, 2530, 0,
+    1636, 285, 3683, 0, 2842, 259, 3021, 0, 2865, 47, 0, 2605, 4271, 1885, 2623, 5591,
+    2012, 111, 90, 3196, 2545, 4234, 2357, 2491, 312, 2424, 0, 5811, 52, 0, 304, 5194,
+    0, 0, 3442, 275, 6693, 4981, 3620, 2726, 1715, 4611, 0, 3249, 259, 225, 0, 270,
+    2139, 4468, 6388, 4925, 2722, 296, 237, 3206, 2479, 3884, 167, 313, 0, 3031, 25, 3347,
+    252, 0, 199, 2117, 0, 0, 1607, 0, 0, 204, 1676, 282, 2138, 222, 0, 0,
+    0, 13, 2757, 6025, 2941, 2481, 3786, 275, 0, 0, 5977, 5107, 6115, 2788, 2986, 3147,
+    5363, 23, 202, 2569, 111, 2661, 0, 64, 0, 269, 1833, 3044, 0, 0, 279, 0,
+    309, 2854, 0, 245, 76, 0, 6266, 0, 2681, 0, 0, 0, 2338, 0, 0, 0,
+    275, 236, 3186, 4656, 1808, 4266, 286, 0, 5581, 2077, 2321, 0, 2027, 1875, 2987, 2900,
+    0, 2471, 0, 4666, 0, 2491, 0, 299, 6202, 1677, 2414, 0, 301, 3573, 3476, 3216,
+    2656, 3866, 213, 0, 6105, 0, 2954, 5900, 23, 0, 0, 0, 0, 1840, 217, 297,
+    181, 2347, 268, 311, 0, 1688, 2722, 4498, 2934, 3416, 146, 3328, 0, 3262, 59, 0,
+    2367, 3062, 0, 0, 5309, 3853, 2578, 0, 3316, 257, 0, 98, 158, 187, 3366, 3800,
+    0, 301, 203, 5100, 2963, 0, 0, 198, 2831, 0, 2469, 135, 0, 37, 4895, 0,
+    0, 88, 0, 2612, 3613, 1604, 0, 3021, 3238, 0, 0, 41, 112, 5154, 2713, 2846,
+    0, 5810, 2842, 2627, 2875, 285, 3165, 3047, 0, 2427, 4483, 1951, 3161, 145, 1823, 2402,
+    3206, 1716, 0, 5757, 2703, 5318, 5626, 3053, 1676, 229, 3097, 0, 3089, 4014, 1640, 211,
+    184, 301, 2162, 3084, 2721, 303, 0, 270, 5201, 0, 0, 6695, 311, 3661, 4218, 2018,
+    0, 2238, 0, 2138, 1655, 2514, 4209, 2759, 2215, 0, 17, 0, 5978, 132, 3187, 0,
+    2487, 0, 2809, 3249, 0, 320, 216, 3632, 2589, 4866, 2758, 5590, 6561, 6294, 0, 3096,
+    4544, 0, 4702, 257, 3048, 87, 1919, 0, 6195, 298, 177, 0, 2513, 1601, 3327, 23,
+    4314, 3172, 2967, 4665, 276, 218, 192, 3305, 0, 299, 2559, 2560, 0, 5158, 3007, 5581,
+    236, 111, 0, 3205, 139, 0, 4220, 1689, 182, 283, 273, 2902, 0, 4966, 3011, 132,
+    0, 0, 1763, 2474, 2584, 0, 3167, 2802, 3229, 2965, 213, 1861, 156, 0, 3097, 145,
+    245, 26, 0, 3086, 4534, 3108, 312, 4505, 4783, 5545, 3118, 2736, 5333, 3875, 0, 2205,
+    3030, 5802, 0, 0, 144, 2490, 2722, 2833, 6268, 66, 0, 2468, 2527, 0, 3262, 272,
+    0, 77, 0, 1743, 287, 2612, 229, 2821, 2629, 156, 2702, 0, 5536, 173, 2556, 4007,
+    36, 266, 2938, 179, 98, 1879, 1603, 0, 158, 2491, 0, 0, 61, 3167, 2666, 2714,
+    264, 0, 5781, 2647, 3997, 24, 0, 2700, 187, 2919, 0, 0, 5116, 307, 2093, 2831,
+    231, 2875, 0, 5052, 0, 1600, 1605, 0, 5470, 0, 2957, 0, 0, 2631, 139, 2848,
+    0, 2645, 4912, 311, 304, 3097, 0, 241, 320, 0, 0, 0, 0, 0, 0, 2337,
+    0, 157, 6395, 185, 0, 244, 0, 119, 3018, 2018, 4094, 0, 2721, 2996, 0, 0,
+    0, 1742, 2138, 110, 3217, 266, 0, 5309, 0, 2514, 3548, 3295, 6273, 0, 0, 0,
+    111, 0, 2178, 0, 0, 3294, 0, 2348, 0, 1962, 120, 0, 6425, 3188, 2589, 5590,
+    5252, 1601, 23, 1881, 199, 1920, 6210, 146, 3332, 2038, 91, 5969, 212, 0, 0, 3063,
+    3139, 3001, 7112, 109, 0, 0, 1608, 5537, 3055, 5993, 0, 0, 0, 6130, 0, 283,
+    3240, 7008, 2712, 7093, 124, 72, 3183, 6011, 0, 5757, 0, 224, 119, 2964, 228, 2565,
+    108, 2690, 2677, 2798, 148, 30, 205, 263, 0, 4211, 245, 4930, 83, 0, 156, 3040,
+    178, 195, 0, 2526, 0, 214, 6680, 2757, 5144, 0, 248, 2942, 5526, 3007, 2347, 0,
+    3876, 221, 0, 47, 222, 5165, 5547, 20, 4795, 2864, 6306, 0, 0, 196, 0, 2869,
+    1743, 1897, 1624, 2908, 0, 2680, 2073, 3566, 271, 2292, 2755, 134, 300, 5492, 4008, 284,
+    0, 4703, 0, 3196, 0, 2524, 0, 4507, 3255, 0, 6687, 2781, 279, 98, 1602, 3766,
+    0, 2612, 0, 1895, 2648, 24, 1606, 3260, 3238, 0, 311, 0, 1609, 2470, 0, 0,
+    0, 4939, 27, 47, 2635, 155, 71, 289, 2536, 0, 3066, 187, 0, 0, 0, 4150,
+    4278, 2225, 3152, 2835, 0, 2875, 2688, 0, 0, 2490, 0, 3063, 2195, 2272, 3230, 0,
+    7183, 26, 0, 0, 3096, 4261, 3320, 2007, 0, 0, 186, 3106, 3491, 2503, 2546, 2868,
+    1764, 266, 4124, 2514, 5308, 2702, 5750, 5716, 3986, 0, 3243, 0, 174, 176, 2734, 77,
+    2339, 117, 3130, 0, 3682, 1964, 5540, 0, 2777, 5595, 3074, 179, 1609, 120, 262, 2922,
+    3315, 4396, 278, 256, 3183, 2006, 3059, 5378, 2447, 2375, 181, 4087, 0, 2743, 2480, 3176,
+    171, 0, 0, 2976, 312, 5759, 2475, 190, 0, 2337, 2205, 184, 0, 0, 233, 1753,
+    4058, 307, 0, 5861, 3062, 3988, 287, 0, 4426, 3996, 7042, 2743, 4931, 2084, 3024, 5038,
+    208, 3207, 6284, 4951, 5159, 1971, 189, 2789, 291, 218, 0, 2528, 0, 0, 25, 0,
+    233, 2991, 0, 0, 0, 47, 301, 0, 0, 0, 244, 3766, 0, 317, 3230, 0,
+    4436, 0, 3106, 0, 119, 0, 0, 2971, 0, 0, 2989, 4702, 0, 0, 0, 0,
+    0, 2686, 3071, 3178, 2243, 3229, 4031, 216, 259, 1780, 0, 0, 0, 0, 36, 0,
+    2558, 2890, 250, 0, 2998, 2073, 0, 0, 3228, 72, 0, 5968, 6885, 181, 0, 2293,
+    0, 2476, 0, 3581, 2743, 2648, 0, 0, 191, 245, 2272, 2479, 2930, 2801, 5582, 2843,
+    137, 2539, 176, 1709, 0, 3470, 2536, 2881, 272, 2953, 0, 0, 2526, 3546, 4886, 2765,
+    260, 0, 1979, 0, 50, 0, 3163, 2207, 68, 2301, 2767, 6030, 255, 3336, 0, 1888,
+    4800, 26, 4308, 0, 0, 3264, 3095, 289, 0, 230, 85, 2007, 36, 0, 5547, 266,
+    5310, 2911, 0, 215, 2777, 3130, 0, 155, 4051, 2423, 300, 0, 2923, 0, 4161, 6021,
+    207, 262, 143, 6136, 0, 0, 1609, 1965, 3315, 3822, 2626, 0, 2732, 219, 5917, 3218,
+    2908, 171, 2910, 1614, 229, 2743, 181, 0, 2865, 2523, 3711, 2768, 1955, 4673, 2140, 0,
+    5406, 3304, 6088, 2688, 0, 4878, 2635, 2799, 2952, 0, 2792, 3655, 161, 4101, 265, 49,
+    184, 5531, 0, 2044, 3040, 279, 3381, 1606, 274, 2835, 4649, 0, 4426, 36, 149, 0,
+    2837, 2789, 235, 0, 157, 3426, 3239, 5752, 1942, 3200, 107, 1610, 5385, 0, 2530, 0,
+    2932, 5701, 59, 0, 307, 0, 3284, 47, 192, 278, 1678, 0, 2933, 246, 1753, 0,
+    6351, 3297, 3987, 0, 2776, 2567, 2733, 1745, 2480, 3869, 3140, 321, 71, 2931, 0, 5371,
+    0, 3076, 0, 229, 2517, 2611, 285, 0, 0, 2255, 3337, 212, 0, 2803, 3229, 0,
+    205, 2952, 5846, 2358, 2293, 3228, 0, 252, 196, 285, 291, 6031, 203, 2710, 2935, 4272,
+    0, 3195, 3009, 3117, 2110, 2624, 4445, 3030, 2513, 198, 2614, 4287, 212, 0, 176, 3041,
+    2647, 247, 3106, 2423, 205, 1819, 0, 3447, 3516, 2822, 4562, 0, 2284, 0, 0, 2811,
+    4921, 54, 3035, 3053, 36, 2468, 217, 2744, 2532, 302, 32, 0, 51, 3031, 2769, 192,
+    1607, 0, 224, 1992, 0, 205, 0, 6681, 0, 3787, 3163, 3022, 2558, 5801, 255, 49,
+    5825, 4427, 245, 4207, 2494, 173, 0, 13, 287, 6167, 0, 0, 291, 3785, 269, 0,
+    0, 0, 167, 0, 0, 1609, 3227, 2388, 2647, 4131, 4866, 72, 0, 0, 3648, 2007,
+    0, 0, 3129, 2776, 0, 3057, 71, 184, 2667, 0, 2941, 0, 3273, 0, 63, 2140,
+    2030, 2281, 6504, 3821, 2935, 4066, 95, 2225, 102, 0, 3992, 2503, 4683, 2300, 97, 3128,
+    2601, 2216, 0, 1896, 2900, 3073, 294, 0, 4426, 2651, 2954, 2052, 3384, 2787, 6365, 3300,
+    84, 203, 0, 0, 2580, 0, 2911, 35, 12, 1680, 0, 1605, 2633, 238, 4747, 0,
+    0, 2899, 0, 3308, 2072, 1742, 5584, 0, 6066, 4227, 4885, 151, 0, 309, 0, 296,
+    2215, 4206, 0, 4536, 4499, 0, 50, 0, 159, 2898, 0, 0, 2006, 0, 0, 3172,
+    198, 3228, 2701, 278, 1744, 100, 0, 2853, 0, 0, 4569, 0, 0, 1640, 0, 145,
+    2966, 3041, 3026, 0, 238, 3602, 0, 2357, 254, 0, 207, 0, 0, 0, 205, 5986,
+    5306, 2756, 1623, 5096, 2159, 2693, 5819, 2943, 3205, 240, 2019, 5031, 6812, 3053, 321, 0,
+    2866, 1819, 0, 175, 1613, 1951, 2892, 3055, 0, 2472, 0, 3776, 5584, 306, 0, 167,
+    4877, 2744, 318, 0, 0, 0, 2513, 303, 0, 5202, 0, 6704, 0, 1677, 2414, 5813,
+    2417, 2937, 261, 3162, 284, 0, 3547, 0, 1604, 2072, 0, 251, 2403, 6230, 2515, 107,
+    2283, 3667, 0, 3903, 4974, 2965, 192, 0, 0, 210, 1913, 282, 247, 3930, 3806, 320,
+    180, 0, 0, 245, 0, 2653, 2931, 0, 2809, 3040, 221, 50, 257, 0, 0, 0,
+    4923, 0, 181, 2292, 298, 242, 2046, 4676, 3194, 2140, 2622, 2225, 48, 1632, 11, 0,
+    1809, 4866, 0, 0, 2580, 0, 2281, 2913, 2743, 0, 6477, 1698, 0, 235, 39, 315,
+    0, 3077, 2903, 0, 2216, 2953, 0, 2273, 302, 1742, 272, 0, 0, 4316, 2525, 3936,
+    0, 238, 1608, 254, 2843, 263, 0, 3086, 2712, 1603, 1649, 0, 3339, 0, 265, 2844,
+    2736, 0, 3075, 297, 2953, 2810, 2732, 170, 6245, 3172, 296, 3132, 300, 0, 0, 243,
+    173, 113, 5223, 6194, 0, 0, 3074, 161, 2844, 3601, 6483, 4500, 2006, 0, 2843, 99,
+    2149, 2169, 311, 0, 0, 1874, 0, 108, 1622, 1773, 6366, 0, 207, 5536, 2958, 3108,
+    0, 0, 258, 3831, 2206, 5986, 3317, 0, 63, 3252, 131, 3767, 0, 2097, 0, 0,
+    61, 3386, 280, 4746, 186, 3218, 2159, 3565, 0, 7036, 0, 0, 0, 2535, 3283, 0,
+    0, 241, 1819, 0, 2639, 5096, 0, 2351, 198, 0, 147, 0, 5056, 3152, 2271, 262,
+    2790, 1687, 2414, 3778, 5977, 204, 3194, 2756, 2525, 0, 6215, 265, 3282, 96, 1905, 3548,
+    3770, 2634, 297, 4711, 11, 4460, 261, 267, 0, 2548, 25, 0, 36, 178, 5747, 2517,
+    0, 297, 1750, 2679, 4482, 180, 4938, 1887, 242, 319, 2283, 3065, 0, 280, 1610, 0,
+    0, 5768, 199, 2985, 2958, 4868, 2058, 2844, 4307, 2820, 0, 0, 2905, 143, 3162, 0,
+    2625, 3020, 200, 84, 249, 263, 3040, 11, 7098, 2693, 3345, 0, 2655, 0, 6520, 2633,
+    2440, 2843, 0, 223, 3196, 0, 179, 5196, 56, 0, 5449, 5306, 228, 304, 0, 0,
+    2724, 83, 120, 0, 290, 3088, 268, 2833, 0, 2623, 5854, 233, 0, 3909, 0, 83,
+    251, 4461, 0, 299, 0, 0, 123, 288, 0, 0, 265, 2934, 3328, 1810, 3941, 0,
+    1642, 110, 1839, 103, 2275, 7273, 3134, 282, 2721, 6748, 0, 3606, 1809, 2227, 5015, 4922,
+    0, 0, 2507, 6488, 4516, 2549, 313, 3241, 4206, 0, 2975, 2712, 284, 1788, 5223, 3390,
+    0, 65, 2868, 199, 3845, 1626, 226, 61, 3176, 0, 0, 0, 0, 6023, 1898, 0,
+    2557, 37, 0, 0, 2404, 0, 24, 0, 4872, 0, 232, 3565, 5746, 2537, 3141, 225,
+    2611, 4746, 205, 3287, 3250, 221, 2149, 2836, 131, 3283, 2589, 95, 3218, 4437, 0, 3161,
+    2205, 2699, 301, 60, 4710, 2150, 0, 6187, 2842, 0, 0, 4280, 5087, 295, 3183, 5980,
+    4264, 0, 294, 210, 5662, 0, 0, 3095, 0, 2738, 5967, 0, 2519, 2792, 0, 2549,
+    2168, 74, 3139, 280, 0, 200, 2659, 2670, 0, 4701, 4349, 2546, 5818, 170, 2502, 2139,
+    4947, 5536, 155, 169, 231, 3013, 2777, 2288, 1679, 1986, 0, 2483, 3074, 0, 6102, 322,
+    281, 2754, 2206, 3207, 0, 3398, 84, 0, 216, 0, 283, 67, 1697, 0, 2669, 2020,
+    2976, 0, 0, 72, 3135, 3353, 1612, 2374, 262, 2790, 1754, 283, 5746, 7015, 4086, 2448,
+    2088, 5378, 293, 4088, 0, 3240, 0, 2978, 4436, 7166, 2402, 4438, 0, 2493, 3081, 0,
+    5527, 3162, 264, 0, 193, 2359, 224, 6827, 0, 204, 3022, 2858, 242, 268, 25, 167,
+    4233, 2876, 0, 0, 0, 3198, 2539, 276, 2727, 2814, 0, 177, 1813, 182, 1853, 5160,
+    0, 2867, 225, 175, 320, 0, 3040, 2149, 3345, 0, 3020, 0, 1829, 167, 3195, 2215,
+    0, 2823, 2865, 232, 5088, 74, 216, 6721, 67, 1608, 5236, 2772, 2722, 183, 218, 259,
+    250, 2930, 2864, 3179, 0, 6727, 4329, 4900, 0, 0, 5333, 2244, 3029, 2402, 2888, 131,
+    3846, 0, 2404, 2622, 3000, 2934, 0, 292, 303, 4750, 2710, 277, 191, 0, 2953, 0,
+    172, 187, 136, 3921, 6038, 3625, 2424, 3161, 3576, 2832, 0, 0, 283, 1605, 2658, 3772,
+    2559, 3251, 0, 210, 2548, 1890, 175, 0, 2636, 4712, 5848, 3550, 0, 295, 123, 3230,
+    2613, 0, 0, 2952, 0, 2946, 0, 293, 5671, 1961, 2504, 0, 2867, 273, 0, 3095,
+    314, 6023, 5628, 0, 3282, 0, 0, 2777, 4351, 236, 3391, 0, 2843, 0, 179, 119,
+    4107, 262, 178, 223, 37, 0, 111, 4646, 3293, 3610, 5883, 6109, 74, 5416, 306, 2799,
+    2640, 0, 2141, 0, 0, 1703, 3184, 0, 2275, 3716, 2540, 0, 6141, 0, 2622, 0,
+    148, 0, 1616, 258, 1706, 1815, 0, 1756, 62, 2865, 3275, 23, 2910, 160, 2568, 2842,
+    4050, 0, 0, 3022, 0, 3151, 0, 3251, 6555, 0, 3009, 0, 2008, 4646, 107, 5386,
+    3466, 2601, 3108, 0, 2492, 0, 2844, 215, 5176, 2988, 3023, 2402, 155, 0, 5527, 6393,
+    2700, 16, 0, 2794, 0, 3284, 2833, 0, 2887, 0, 6806, 2825, 195, 3272, 2733, 0,
+    6350, 3184, 318, 2804, 265, 0, 3353, 241, 2776, 3355, 2495, 2336, 2871, 6764, 2710, 175,
+    147, 320, 0, 191, 0, 0, 2625, 2646, 3777, 3558, 2846, 2234, 225, 3000, 2501, 311,
+    0, 3019, 124, 2093, 2527, 0, 196, 1878, 196, 2864, 2660, 2009, 194, 3195, 218, 2677,
+    0, 4292, 2945, 5856, 0, 2260, 1678, 0, 4429, 290, 3062, 145, 131, 0, 5089, 220,
+    74, 2816, 2425, 7246, 3695, 0, 4563, 4041, 1753, 0, 0, 38, 2997, 1875, 210, 2690,
+    3118, 0, 252, 2552, 1970, 3526, 0, 0, 0, 5340, 6046, 280, 1648, 2368, 319, 0,
+    3095, 6732, 5527, 2350, 0, 135, 2873, 2722, 0, 3042, 4659, 159, 177, 5805, 0, 206,
+    15, 2942, 1831, 2699, 4208, 2922, 2144, 2579, 3041, 1854, 2413, 2732, 49, 228, 2614, 5126,
+    2921, 48, 0, 264, 169, 167, 181, 2713, 0, 4894, 0, 279, 171, 2745, 3322, 0,
+    4481, 4591, 310, 0, 0, 0, 96, 2667, 71, 2226, 113, 2556, 5561, 3273, 0, 1605,
+    2508, 253, 2728, 3054, 308, 180, 2074, 3155, 4071, 2711, 2217, 4241, 239, 2485, 2470, 0,
+    2300, 219, 2723, 2568, 0, 6000, 0, 2604, 3151, 2887, 3099, 4005, 6435, 182, 3108, 6852,
+    1681, 4876, 1721, 1772, 3025, 0, 3296, 0, 3217, 5186, 2582, 0, 306, 0, 1714, 302,
+    0, 303, 189, 2072, 2985, 6359, 3062, 0, 2481, 3988, 0, 2490, 2560, 155, 6078, 0,
+    2102, 4668, 241, 2282, 0, 48, 0, 0, 2702, 0, 2236, 0, 0, 0, 278, 0,
+    0, 2968, 148, 0, 3283, 317, 0, 2291, 135, 259, 0, 2845, 2832, 0, 3346, 159,
+    2682, 64, 170, 0, 2689, 2361, 0, 127, 0, 0, 0, 4343, 3067, 2729, 4967, 3078,
+    0, 188, 0, 2160, 2943, 3227, 2496, 2569, 2945, 85, 6922, 4575, 250, 0, 0, 246,
+    4044, 0, 0, 0, 296, 4216, 0, 167, 195, 2479, 2799, 0, 2472, 0, 2349, 39,
+    237, 2798, 0, 1608, 2886, 2744, 319, 2757, 182, 2677, 2416, 0, 0, 3194, 0, 2909,
+    172, 2634, 5976, 2413, 5780, 0, 2933, 0, 62, 4816, 3557, 2037, 1602, 6266, 2875, 233,
+    4718, 0, 0, 0, 2925, 168, 0, 253, 1607, 0, 0, 2856, 0, 266, 0, 0,
+    0, 1822, 35, 285, 113, 0, 0, 0, 2831, 2556, 5897, 257, 2526, 2215, 6230, 0,
+    320, 0, 3998, 0, 212, 0, 300, 6186, 6576, 0, 2231, 184, 1606, 2074, 222, 0,
+    2855, 2622, 0, 315, 4013, 2220, 2581, 311, 5774, 0, 0, 0, 3121, 212, 2303, 4526,
+    2145, 2568, 172, 6440, 11, 181, 0, 319, 0, 4761, 293, 0, 0, 309, 1941, 2482,
+    158, 0, 0, 3101, 0, 0, 217, 0, 2567, 4490, 197, 137, 0, 0, 2715, 0,
+    1943, 0, 3108, 0, 2644, 219, 0, 0, 3107, 5316, 3776, 2799, 0, 1631, 2713, 0,
+    5749, 205, 0, 201, 5256, 5555, 241, 0, 3150, 3143, 272, 172, 300, 4481, 2689, 2084,
+    2469, 0, 2017, 2103, 2578, 2930, 0, 3164, 0, 5641, 3140, 3087, 0, 0, 0, 2535,
+    220, 207, 0, 292, 3304, 3317, 0, 5690, 5756, 3227, 0, 0, 145, 37, 7222, 0,
+    3830, 4755, 4966, 0, 3283, 73, 2209, 0, 5837, 1772, 0, 186, 2271, 314, 2159, 0,
+    4216, 1838, 2854, 4046, 1600, 0, 72, 0, 314, 0, 3053, 270, 0, 0, 4725, 2162,
+    2798, 0, 2846, 2616, 4207, 2760, 144, 6239, 1690, 189, 253, 3029, 3881, 132, 1755, 0,
+    0, 267, 0, 2205, 224, 1634, 2809, 47, 0, 28, 3874, 4866, 1945, 4921, 0, 0,
+    0, 2684, 172, 0, 5976, 3254, 2858, 35, 147, 281, 3152, 0, 0, 2502, 2036, 2909,
+    294, 304, 264, 291, 0, 4006, 2987, 3164, 78, 0, 0, 2010, 0, 191, 0, 312,
+    5307, 0, 3010, 0, 0, 3122, 163, 1609, 2965, 4846, 2527, 199, 0, 0, 4306, 212,
+    209, 120, 5011, 0, 4531, 179, 2481, 2341, 0, 0, 152, 3174, 0, 222, 0, 2800,
+    194, 2689, 0, 1906, 2734, 0, 0, 0, 298, 299, 2415, 0, 3205, 1603, 0, 0,
+    0, 0, 2083, 4437, 110, 0, 0, 2717, 194, 2930, 5150, 95, 0, 0, 2897, 0,
+    0, 3434, 0, 2512, 4492, 158, 4129, 0, 0, 233, 177, 2468, 35, 0, 3189, 234,
+    2811, 5187, 3293, 0, 84, 0, 3244, 217, 5556, 238, 0, 0, 1601, 0, 194, 5257,
+    0, 2897, 3164, 2768, 88, 41, 96, 1962, 24, 202, 2877, 3779, 5711, 2948, 61, 0,
+    2766, 5890, 302, 2153, 0, 0, 4446, 0, 1830, 0, 14, 0, 0, 2405, 3141, 0,
+    317, 0, 0, 0, 189, 0, 1783, 2725, 3283, 0, 0, 252, 1940, 5442, 0, 0,
+    100, 3602, 6232, 2337, 4719, 95, 0, 283, 3021, 205, 3227, 0, 6354, 4893, 12, 305,
+    3839, 0, 0, 136, 0, 87, 3217, 183, 206, 0, 5970, 0, 0, 272, 0, 75,
+    2990, 2534, 206, 2999, 2955, 5526, 6189, 199, 2733, 2308, 219, 5361, 0, 0, 0, 4705,
+    2858, 0, 0, 4968, 0, 2040, 0, 259, 1907, 3308, 284, 0, 235, 2535, 0, 194,
+    0, 250, 219, 2501, 5967, 6102, 192, 2908, 2271, 7020, 2772, 2590, 122, 5635, 2854, 239,
+    240, 2484, 0, 2644, 3240, 72, 188, 146, 3124, 7010, 0, 4930, 2567, 5098, 3793, 0,
+    0, 5605, 322, 0, 3007, 281, 2778, 0, 2084, 221, 0, 242, 257, 1689, 2964, 2963,
+    5141, 1963, 2205, 293, 224, 3610, 3427, 268, 3033, 0, 279, 3546, 2619, 0, 30, 0,
+    0, 4428, 0, 185, 0, 5151, 4757, 0, 287, 4494, 178, 3107, 4171, 0, 2774, 2930,
+    0, 2842, 4261, 79, 1765, 195, 0, 2603, 3383, 0, 3175, 0, 0, 2897, 0, 0,
+    4541, 2821, 2083, 3823, 1608, 2270, 2732, 0, 265, 239, 0, 3029, 1895, 6686, 3265, 3073,
+    24, 0, 1608, 0, 96, 3030, 0, 4270, 238, 305, 187, 3556, 5409, 0, 1754, 3252,
+    15, 2407, 0, 132, 0, 1621, 234, 0, 0, 1744, 5451, 0, 155, 1847, 4776, 0,
+    6068, 0, 0, 0, 0, 3282, 3654, 258, 191, 2788, 263, 0, 3073, 0, 317, 4439,
+    2932, 2878, 4656, 5106, 0, 59, 5756, 4732, 4932, 230, 2936, 295, 186, 5307, 3436, 3327,
+    297, 5599, 0, 0, 0, 0, 0, 272, 83, 5747, 214, 0, 1808, 4901, 236, 0,
+    2073, 80, 2317, 3392, 2990, 0, 2480, 1622, 214, 87, 0, 2535, 1874, 3295, 0, 3309,
+    1676, 2366, 2623, 280, 201, 2471, 206, 2433, 2294, 1829, 3646, 4647, 95, 174, 231, 4360,
+    0, 3062, 188, 2810, 258, 44, 4431, 1757, 0, 3318, 2534, 0, 2677, 0, 26, 0,
+    1953, 2011, 2270, 3043, 2485, 0, 193, 5847, 63, 0, 7072, 4933, 0, 2733, 0, 2899,
+    0, 0, 89, 2952, 294, 3330, 301, 3151, 206, 5341, 5150, 3297, 201, 1821, 0, 52,
+    0, 0, 2956, 3441, 0, 0, 0, 2095, 0, 1886, 5993, 291, 2558, 3034, 3020, 0,
+    185, 2602, 307, 0, 4176, 1604, 5967, 4456, 134, 0, 119, 228, 3249, 6679, 180, 0,
+    2842, 252, 88, 6387, 304, 0, 3175, 3786, 228, 284, 2536, 2897, 0, 0, 3034, 0,
+    5006, 3206, 0, 2688, 2650, 199, 0, 1875, 0, 265, 2780, 314, 3795, 2842, 5089, 0,
+    275, 0, 0, 4887, 3654, 2644, 0, 3560, 277, 0, 3098, 0, 64, 2800, 313, 149,
+    309, 2821, 2834, 5581, 3429, 2470, 0, 2864, 2820, 1746, 0, 15, 1877, 0, 196, 3044,
+    0, 4596, 191, 0, 5307, 223, 0, 2998, 0, 0, 109, 1897, 0, 245, 2655, 2578,
+    1981, 23, 2591, 0, 0, 5105, 3118, 0, 2605, 0, 5370, 288, 0, 290, 4656, 109,
+    0, 3042, 235, 6202, 0, 280, 2234, 213, 2736, 2799, 5698, 0, 2767, 0, 1677, 2732,
+    2899, 3197, 0, 2184, 0, 211, 3041, 2111, 3656, 1832, 65, 2624, 3412, 0, 2767, 71,
+    171, 158, 3338, 5885, 213, 2176, 201, 0, 4208, 3612, 0, 174, 0, 14, 209, 2534,
+    1820, 194, 2883, 183, 301, 0, 4483, 2516, 3834, 0, 1764, 173, 290, 146, 2075, 5612,
+    2270, 1954, 0, 219, 1623, 2789, 114, 5371, 0, 169, 1611, 6470, 6862, 3194, 2845, 157,
+    135, 3073, 5088, 2898, 3996, 3089, 5030, 6267, 215, 3238, 3151, 0, 5801, 0, 3239, 2931,
+    277, 4880, 297, 3075, 3163, 2711, 4498, 2974, 0, 0, 2606, 11, 60, 27, 6104, 0,
+    133, 5097, 0, 2831, 3107, 2072, 4226, 0, 284, 3619, 2721, 1715, 6238, 4246, 2678, 0,
+    0, 170, 6070, 2504, 132, 2759, 2237, 180, 193, 204, 311, 4782, 211, 258, 1697, 6421,
+    2809, 304, 0, 2357, 3786, 2589, 259, 285, 260, 257, 0, 193, 14, 0, 2589, 2623,
+    0, 1688, 3185, 0, 0, 0, 4376, 267, 3065, 6195, 2747, 2138, 0, 4274, 2513, 277,
+    4627, 4219, 0, 5097, 59, 5107, 259, 4321, 3452, 54, 250, 5326, 3315, 0, 274, 5581,
+    3120, 3011, 138, 0, 1601, 109, 5811, 2479, 0, 2996, 237, 182, 3769, 6121, 2800, 0,
+    5748, 2779, 2473, 6074, 1842, 0, 232, 14, 0, 0, 0, 0, 0, 3902, 3299, 0,
+    213, 5977, 246, 0, 2679, 0, 2471, 283, 221, 71, 2207, 304, 6802, 2831, 3788, 204,
+    0, 2017, 0, 1605, 3128, 76, 2414, 3098, 1604, 3227, 2170, 156, 2370, 3647, 26, 2557,
+    4656, 108, 85, 2556, 2591, 0, 2944, 2864, 0, 90, 6001, 5194, 2567, 3057, 196, 312,
+    1824, 2470, 0, 0, 2810, 0, 0, 5470, 2123, 248, 184, 2080, 5536, 222, 5101, 4748,
+    138, 0, 24, 6501, 4790, 290, 0, 2919, 5143, 2678, 1677, 2670, 2414, 1613, 3574, 306,
+    3999, 260, 124, 0, 35, 2601, 3064, 5363, 0, 2721, 2755, 0, 11, 297, 3271, 4094,
+    217, 0, 271, 6204, 0, 0, 0, 187, 2406, 6590, 97, 0, 2645, 3063, 2938, 0,
+    3165, 244, 5318, 0, 0, 2744, 3462, 211, 0, 0, 0, 0, 0, 3566, 3282, 158,
+    3063, 187, 50, 5091, 2879, 1607, 311, 2836, 3065, 0, 0, 5810, 4007, 0, 0, 1640,
+    233, 0, 1605, 37, 3802, 0, 1699, 2589, 1887, 145, 304, 19, 2469, 3018, 1919, 5309,
+    273, 2679, 6209, 2847, 2957, 203, 2848, 6302, 0, 0, 267, 1742, 266, 0, 2833, 0,
+    2711, 2700, 0, 2550, 2210, 5581, 2163, 2644, 3091, 2781, 274, 2085, 120, 229, 4322, 225,
+    0, 0, 2339, 1708, 3951, 4445, 170, 1661, 213, 3053, 5203, 5855, 3117, 270, 29, 0,
+    2690, 3199, 0, 0, 4285, 0, 160, 5978, 220, 4710, 0, 0, 3183, 108, 0, 4210,
+    0, 0, 4975, 3932, 4221, 2809, 2798, 0, 315, 1692, 190, 2743, 6130, 3987, 0, 320,
+    3875, 0, 3211, 3040, 0, 6938, 0, 178, 6197, 24, 3098, 5966, 2336, 3249, 2701, 5142,
+    4921, 0, 2864, 21, 254, 2524, 109, 3168, 1925, 195, 4784, 290, 6479, 0, 0, 3205,
+    0, 289, 5491, 4924, 47, 264, 0, 248, 2965, 5421, 0, 181, 0, 11, 1812, 5757,
+    0, 2755, 271, 2987, 279, 3011, 0, 0, 5791, 3174, 2678, 196, 140, 253, 232, 6081,
+    251, 187, 3064, 71, 0, 0, 3821, 0, 0, 179, 308, 0, 0, 2226, 72, 0,
+    0, 6280, 4989, 0, 84, 5663, 0, 181, 0, 3549, 0, 5158, 0, 2272, 110, 3490,
+    4680, 1609, 124, 2736, 0, 4647, 2953, 3216, 0, 0, 158, 3169, 1680, 2535, 0, 2582,
+    177, 2360, 2492, 2271, 2734, 2468, 3018, 4000, 2878, 6714, 4123, 0, 2725, 2677, 61, 3990,
+    51, 3063, 0, 3229, 143, 2756, 24, 0, 1612, 311, 2879, 273, 0, 3682, 1763, 306,
+    4087, 3184, 4392, 278, 2179, 5472, 2348, 0, 5306, 264, 4096, 1607, 0, 303, 0, 266,
+    3618, 119, 2440, 2690, 198, 189, 2997, 2700, 262, 2688, 0, 2205, 2337, 2087, 0, 233,
+    0, 0, 2921, 4711, 2470, 3062, 0, 3320, 190, 96, 4647, 0, 0, 2721, 0, 3023,
+    208, 3217, 6903, 3336, 2789, 0, 108, 100, 2908, 2743, 218, 2941, 2094, 0, 2634, 4058,
+    0, 25, 0, 0, 2960, 0, 4447, 3142, 0, 239, 1971, 6132, 0, 2205, 3249, 0,
+    0, 0, 0, 248, 36, 0, 3002, 1930, 208, 199, 5144, 4796, 2493, 2723, 30, 148,
+    6045, 5767, 0, 0, 5969, 240, 226, 195, 5636, 0, 0, 137, 4027, 0, 0, 3381,
+    0, 72, 0, 0, 14, 5966, 0, 271, 3326, 0, 0, 3188, 5634, 3240, 2755, 2833,
+    3282, 0, 99, 3580, 257, 299, 3228, 1601, 0, 2243, 2784, 107, 2008, 286, 2964, 245,
+    268, 1603, 263, 2405, 251, 3007, 86, 0, 6220, 187, 3469, 2812, 2228, 2272, 7117, 0,
+    5675, 3063, 3008, 5168, 50, 3868, 0, 4674, 0, 2550, 0, 178, 0, 0, 200, 3074,
+    143, 3176, 24, 1602, 1767, 3256, 176, 2349, 4921, 4263, 2881, 0, 285, 3406, 0, 2291,
+    0, 0, 2979, 4157, 0, 6021, 0, 49, 2799, 0, 0, 269, 224, 6745, 0, 2870,
+    241, 0, 2669, 0, 3106, 2878, 3824, 4436, 3568, 1964, 3161, 3262, 36, 273, 5916, 0,
+    2523, 71, 0, 0, 1608, 2910, 4087, 155, 0, 177, 149, 3710, 2769, 3187, 4658, 6087,
+    197, 0, 0, 0, 1609, 144, 5868, 2645, 71, 0, 0, 207, 0, 2524, 266, 2447,
+    2044, 2919, 0, 0, 4051, 190, 4952, 2986, 2571, 0, 5120, 1744, 295, 0, 289, 0,
+    95, 2789, 5308, 2836, 5831, 322, 186, 0, 0, 5379, 3986, 184, 2765, 2932, 2691, 4043,
+    2139, 2020, 5751, 0, 2502, 0, 0, 313, 2029, 208, 2376, 2557, 3139, 0, 49, 0,
+    0, 0, 205, 1608, 3778, 184, 278, 0, 0, 3382, 1753, 2677, 321, 4089, 1676, 2922,
+    0, 6039, 0, 3337, 2517, 0, 0, 2744, 2886, 0, 3320, 5652, 2671, 0, 0, 1623,
+    2480, 212, 0, 3261, 123, 3295, 3184, 0, 3045, 194, 278, 0, 292, 4649, 238, 2710,
+    4482, 99, 0, 307, 4060, 0, 254, 0, 0, 5161, 161, 268, 1601, 1603, 4225, 315,
+    3512, 2536, 2645, 186, 0, 1973, 83, 301, 195, 0, 2811, 5968, 2746, 247, 3195, 3020,
+    0, 256, 0, 0, 0, 193, 4686, 5676, 4876, 2095, 2822, 0, 16, 6723, 0, 119,
+    0, 183, 2931, 6680, 0, 3180, 2245, 240, 3053, 0, 0, 0, 0, 72, 317, 5087,
+    0, 2890, 0, 53, 4527, 4448, 2657, 0, 0, 0, 167, 2987, 0, 2882, 1632, 120,
+    0, 3053, 2671, 0, 0, 2570, 3825, 194, 0, 3101, 0, 2387, 49, 0, 3286, 2072,
+    1747, 2051, 3183, 184, 1600, 0, 2749, 4103, 289, 3604, 227, 243, 314, 2657, 2933, 3381,
+    1605, 3712, 287, 3150, 0, 269, 4065, 2281, 0, 279, 0, 2645, 134, 5598, 0, 2592,
+    5114, 2776, 134, 0, 305, 4657, 0, 4053, 1745, 245, 2028, 3161, 5325, 0, 4876, 0,
+    277, 289, 2911, 2765, 5392, 71, 2952, 228, 3030, 4886, 0, 1781, 314, 3192, 0, 0,
+    2291, 2923, 3308, 0, 2215, 2626, 0, 4535, 2272, 1609, 2768, 2692, 0, 0, 233, 0,
+    2735, 238, 176, 75, 3361, 1608, 2865, 2910, 163, 3592, 3337, 0, 3306, 3106, 0, 227,
+    0, 110, 0, 207, 2955, 292, 0, 0, 0, 2765, 2749, 0, 322, 150, 0, 0,
+    289, 2700, 207, 1876, 5553, 238, 224, 0, 5616, 0, 4484, 2006, 157, 240, 4562, 0,
+    125, 0, 2920, 6352, 100, 3239, 188, 3261, 3260, 6472, 0, 4811, 2501, 5186, 227, 4982,
+    0, 4564, 5804, 3117, 0, 0, 3107, 1697, 3316, 0, 0, 3315, 2853, 3767, 54, 2822,
+    2756, 0, 265, 2017, 278, 173, 0, 2417, 2561, 295, 5529, 287, 2838, 3076, 2110, 0,
+    6700, 0, 0, 4427, 0, 0, 0, 2611, 2615, 5108, 3029, 268, 0, 3277, 2086, 285,
+    2680, 1896, 0, 0, 4491, 13, 2765, 3547, 2899, 2504, 1743, 5087, 209, 196, 1707, 2657,
+    0, 0, 0, 0, 0, 2600, 0, 2513, 2072, 0, 221, 61, 4438, 212, 227, 2986,
+    1904, 269, 2574, 6186, 284, 2281, 0, 0, 3122, 1753, 5127, 4436, 2045, 182, 309, 0,
+    0, 2724, 3294, 2614, 6365, 4144, 1632, 2887, 0, 2594, 295, 0, 201, 2954, 2744, 5326,
+    2469, 251, 311, 310, 0, 228, 250, 2271, 0, 49, 2031, 4661, 6371, 280, 302, 184,
+    3162, 0, 2779, 259, 0, 4207, 0, 0, 4571, 2769, 2787, 255, 2579, 2547, 0, 3311,
+    0, 4270, 0, 0, 3075, 0, 0, 0, 59, 0, 0, 0, 272, 2732, 0, 1631,
+    3904, 0, 2282, 2556, 255, 3099, 5003, 1773, 0, 4499, 2843, 0, 265, 0, 110, 4885,
+    5230, 198, 3130, 0, 1622, 134, 2977, 1985, 167, 0, 4076, 2601, 0, 2985, 7035, 4228,
+    5560, 188, 4837, 102, 2524, 4665, 243, 0, 5986, 0, 1940, 6109, 1700, 4485, 2711, 3692,
+    35, 61, 2119, 0, 2766, 5766, 4867, 5188, 2920, 40, 97, 1608, 251, 1722, 168, 3174,
+    2638, 0, 0, 1808, 0, 2236, 4648, 2976, 1756, 0, 321, 0, 278, 1742, 1887, 0,
+    217, 2866, 0, 0, 1698, 2859, 2756, 2019, 3768, 0, 226, 3548, 3294, 4315, 159, 0,
+    0, 3283, 3029, 2916, 3463, 2966, 0, 0, 4262, 0, 2782, 0, 2682, 280, 3557, 0,
+    0, 3086, 207, 2679, 3065, 2515, 0, 62, 2497, 0, 145, 4021, 280, 0, 3336, 292,
+    4307, 0, 0, 39, 0, 211, 199, 2159, 0, 4976, 3076, 255, 0, 2472, 4342, 288,
+    0, 3030, 4866, 0, 2625, 0, 242, 249, 247, 240, 0, 2545, 179, 0, 1810, 3150,
+    84, 2798, 0, 2546, 2469, 2667, 0, 318, 76, 0, 2482, 0, 0, 3129, 2820, 2853,
+    0, 2281, 228, 2744, 0, 252, 182, 0, 4454, 3328, 0, 71, 5854, 2085, 0, 1604,
+    233, 2425, 2723, 2622, 217, 0, 0, 0, 2782, 3937, 0, 74, 215, 3196, 1811, 247,
+    2560, 210, 0, 0, 3086, 0, 2602, 3040, 320, 3103, 5362, 2556, 2813, 5152, 2104, 0,
+    0, 3020, 259, 0, 0, 4512, 2704, 5554, 2747, 4821, 3197, 175, 2506, 0, 2413, 0,
+    0, 4923, 1809, 7237, 0, 1831, 1625, 181, 0, 2622, 201, 0, 134, 11, 1611, 6484,
+    225, 1787, 2766, 0, 2743, 319, 3206, 3177, 5442, 0, 1810, 3009, 6251, 0, 250, 121,
+    251, 209, 0, 107, 2857, 0, 0, 0, 2947, 125, 61, 1940, 0, 5188, 6376, 0,
+    0, 2756, 0, 3117, 0, 2309, 3162, 268, 0, 2403, 206, 131, 116, 2975, 3426, 2738,
+    3161, 2953, 6230, 48, 5765, 4653, 60, 2022, 0, 165, 2712, 3767, 2535, 3174, 0, 3548,
+    5224, 1775, 0, 3252, 1885, 3194, 5662, 2578, 4701, 4460, 0, 4279, 2413, 0, 6798, 2159,
+    6716, 2075, 1905, 0, 2546, 0, 131, 4466, 289, 318, 295, 0, 207, 3832, 0, 316,
+    203, 2754, 73, 5627, 2206, 0, 2959, 309, 1820, 5967, 5882, 261, 2644, 178, 1612, 0,
+    0, 2856, 262, 254, 2783, 247, 189, 0, 227, 2481, 3683, 198, 6067, 6076, 72, 2519,
+    0, 199, 4940, 2726, 0, 223, 3129, 83, 6826, 2667, 2639, 36, 1679, 2798, 96, 1687,
+    1610, 0, 261, 0, 182, 239, 2634, 110, 0, 3045, 4233, 224, 5747, 25, 1633, 2724,
+    2359, 0, 3496, 0, 2504, 5378, 2737, 3882, 3867, 0, 5414, 2712, 167, 0, 209, 5811,
+    7014, 2141, 0, 5145, 0, 2790, 2603, 0, 3134, 3390, 2987, 2865, 312, 3020, 0, 6386,
+    0, 0, 0, 155, 3146, 1676, 175, 0, 200, 2229, 0, 3052, 7307, 1604, 1609, 107,
+    2402, 0, 202, 5363, 2661, 3556, 282, 0, 3274, 0, 0, 0, 259, 3293, 2866, 249,
+    240, 0, 0, 3845, 0, 4534, 248, 3328, 2655, 2559, 268, 0, 175, 288, 88, 2809,
+    5086, 270, 2723, 0, 0, 251, 2656, 3345, 0, 2934, 0, 0, 257, 3434, 2077, 0,
+    0, 1840, 35, 3917, 244, 0, 1961, 4877, 2623, 3475, 301, 0, 131, 271, 5333, 3008,
+    2557, 0, 3062, 0, 2677, 0, 3186, 121, 2404, 1601, 313, 0, 282, 1799, 0, 2754,
+    2593, 5225, 4265, 5670, 261, 6023, 210, 0, 3241, 2546, 0, 303, 2321, 0, 2613, 2151,
+    2432, 5318, 1889, 316, 2523, 2999, 3851, 5818, 4922, 0, 4666, 1900, 2659, 0, 2866, 2338,
+    0, 178, 205, 3209, 0, 0, 243, 6805, 7016, 2367, 98, 135, 0, 2483, 3161, 1676,
+    189, 255, 3684, 3272, 2932, 0, 0, 1615, 254, 0, 2842, 3151, 2142, 219, 267, 2846,
+    299, 1821, 2507, 3282, 0, 6092, 279, 0, 0, 60, 4471, 283, 0, 5967, 2502, 2139,
+    109, 5848, 160, 4956, 2793, 3273, 6554, 6694, 5803, 2703, 3045, 0, 0, 3097, 2988, 0,
+    2887, 0, 4218, 3800, 0, 0, 1678, 2612, 3547, 240, 0, 3020, 2150, 0, 3307, 2217,
+    316, 6415, 1878, 190, 3402, 2759, 5626, 133, 0, 2225, 213, 5088, 0, 0, 0, 2860,
+    0, 0, 0, 216, 0, 3285, 2545, 282, 0, 242, 3777, 6294, 0, 0, 0, 1689,
+    159, 189, 3019, 2699, 16, 2484, 5526, 0, 0, 254, 0, 3354, 0, 196, 2646, 1853,
+    0, 4906, 0, 2832, 5591, 208, 183, 0, 276, 2492, 145, 268, 4590, 0, 0, 3610,
+    236, 3062, 7065, 3032, 290, 0, 4235, 157, 182, 2723, 182, 0, 38, 263, 2967, 0,
+    1859, 2470, 223, 193, 0, 0, 0, 238, 2677, 0, 2943, 2584, 3195, 3856, 131, 145,
+    0, 6728, 2722, 0, 3263, 4528, 2415, 6038, 0, 0, 83, 0, 1608, 2350, 3327, 5340,
+    2815, 0, 2541, 2468, 5802, 0, 0, 2036, 3030, 319, 2527, 178, 0, 1648, 1961, 2942,
+    1743, 0, 2823, 0, 2404, 310, 2628, 2523, 0, 3317, 2434, 0, 2366, 2322, 2672, 3250,
+    3202, 2936, 320, 3721, 0, 2614, 2658, 0, 139, 2921, 3161, 270, 257, 313, 1605, 4702,
+    0, 0, 2545, 0, 2875, 285, 6194, 2997, 6848, 3631, 2141, 2865, 4240, 3183, 167, 317,
+    2556, 3097, 3220, 5993, 3032, 0, 320, 226, 3296, 0, 0, 119, 0, 4879, 2711, 4592,
+    185, 120, 5780, 2073, 3100, 4042, 2592, 3997, 2038, 3394, 133, 277, 0, 3283, 2988, 6394,
+    1678, 0, 186, 181, 2215, 0, 95, 0, 191, 2957, 3307, 0, 0, 4542, 2218, 3119,
+    0, 172, 2291, 2493, 0, 212, 0, 2952, 3988, 2491, 3295, 2998, 0, 1706, 2699, 0,
+    2545, 2628, 2844, 0, 143, 1621, 0, 1952, 0, 2848, 186, 111, 159, 6295, 5590, 1880,
+    0, 23, 0, 0, 0, 222, 301, 157, 126, 0, 39, 0, 4667, 0, 2955, 0,
+    5250, 0, 2700, 5537, 6030, 6566, 2358, 2495, 5333, 2093, 3329, 0, 2732, 226, 5195, 3032,
+    294, 2349, 3078, 0, 0, 0, 220, 0, 3356, 7008, 2472, 2828, 0, 2975, 228, 200,
+    5089, 2492, 4041, 0, 2563, 0, 0, 284, 2418, 0, 1864, 0, 2757, 2713, 3996, 0,
+    3316, 4754, 2688, 6782, 265, 0, 5342, 214, 2735, 3662, 285, 3075, 2347, 4209, 0, 2778,
+    212, 3062, 18, 75, 0, 4718, 200, 174, 196, 2776, 62, 0, 3019, 2869, 2864, 2820,
+    0, 146, 2614, 2680, 4506, 0, 235, 3066, 2152, 172, 2662, 0, 2875, 134, 2655, 0,
+    4703, 2189, 182, 1764, 3221, 3099, 320, 2501, 6186, 2855, 1912, 257, 0, 172, 1895, 27,
+    0, 2644, 5131, 2208, 187, 2470, 288, 273, 5774, 0, 1941, 6202, 2997, 2974, 157, 0,
+    311, 280, 0, 2585, 0, 249, 0, 2529, 120, 0, 4767, 0, 6436, 309, 1743, 1688,
+    120, 2985, 2407, 2734, 176, 5759, 2666, 2579, 2009, 2549, 6000, 5666, 269, 3776, 2413, 1683,
+    1727, 3232, 2876, 4278, 0, 0, 0, 0, 0, 0, 4620, 4870, 2607, 0, 0, 0,
+    3119, 3183, 0, 0, 2931, 1717, 4005, 2514, 132, 3141, 2490, 5308, 114, 77, 5036, 2702,
+    2745, 156, 0, 1952, 2102, 3350, 5594, 0, 0, 0, 3096, 4481, 4122, 4251, 162, 2968,
+    5372, 2978, 1621, 0, 0, 2007, 0, 181, 6151, 197, 2711, 6032, 0, 0, 5540, 3304,
+    3007, 2556, 0, 2809, 119, 3163, 2497, 3243, 145, 281, 0, 0, 0, 5207, 314, 0,
+    2743, 3087, 0, 2943, 144, 39, 7041, 272, 3272, 0, 186, 0, 0, 3988, 2472, 258,
+    60, 0, 256, 5641, 2759, 2767, 5782, 3283, 0, 0, 0, 0, 0, 2930, 1755, 284,
+    2613, 0, 0, 194, 2613, 0, 3140, 2503, 2969, 3776, 5002, 173, 189, 2083, 6274, 193,
+    5208, 2474, 38, 2683, 3573, 0, 1942, 64, 221, 4373, 0, 1614, 2942, 183, 2684, 1600,
+    182, 0, 2987, 3183, 259, 272, 0, 0, 2890, 4718, 3069, 0, 3150, 0, 2875, 287,
+    2481, 292, 300, 0, 0, 164, 0, 0, 0, 3102, 4308, 250, 0, 2886, 284, 2499,
+    3766, 171, 2648, 2666, 2341, 3010, 191, 188, 3998, 5334, 289, 0, 2027, 5528, 2801, 2831,
+    281, 0, 233, 2075, 0, 75, 0, 2854, 266, 2845, 1979, 0, 2613, 1641, 2778, 1763,
+    6883, 3866, 2644, 194, 6066, 0, 0, 0, 2413, 6799, 3296, 2526, 3315, 74, 0, 2010,
+    2716, 310, 1606, 4490, 0, 0, 2867, 0, 5635, 277, 36, 0, 2556, 260, 5310, 26,
+    0, 0, 5547, 2835, 0, 220, 0, 0, 4966, 0, 5141, 3200, 115, 0, 5555, 304,
+    2105, 234, 4101, 24, 0, 2897, 4017, 1830, 5531, 11, 2523, 4151, 3242, 0, 0, 2626,
+    3197, 0, 3141, 246, 181, 274, 197, 3987, 319, 3232, 5470, 1886, 0, 5407, 3822, 206,
+    0, 3109, 0, 96, 217, 0, 2622, 0, 4437, 119, 0, 2524, 0, 229, 5776, 1940,
+    2293, 238, 1611, 5442, 219, 2570, 308, 38, 3021, 317, 3602, 253, 2743, 12, 0, 2403,
+    0, 0, 2578, 317, 2761, 2668, 3231, 3131, 2479, 0, 5970, 175, 1606, 0, 0, 3151,
+    0, 2308, 2850, 0, 170, 85, 0, 3781, 2932, 4704, 0, 3426, 5910, 4727, 75, 5750,
+    1906, 2955, 0, 4878, 47, 1921, 4445, 0, 28, 2469, 6188, 0, 0, 0, 0, 5371,
+    2611, 73, 0, 0, 2618, 239, 5541, 212, 0, 0, 0, 1606, 0, 4673, 0, 6102,
+    0, 122, 0, 38, 5846, 72, 0, 0, 5605, 0, 3123, 0, 2084, 0, 2484, 0,
+    289, 0, 0, 0, 4309, 221, 0, 3887, 171, 4050, 158, 0, 2010, 198, 2620, 2803,
+    2547, 6067, 3035, 0, 0, 0, 224, 0, 3556, 1754, 178, 2778, 3877, 3293, 29, 0,
+    2942, 0, 3131, 85, 3821, 1658, 6832, 2529, 5825, 202, 0, 144, 1991, 2869, 2225, 0,
+    3306, 5141, 209, 1606, 0, 307, 0, 280, 1744, 3383, 291, 201, 4272, 2603, 4130, 51,
+    185, 36, 3031, 0, 0, 0, 2909, 279, 1876, 1609, 48, 184, 1600, 4009, 0, 3073,
+    0, 0, 3566, 0, 4428, 256, 2343, 3074, 3276, 0, 232, 4921, 3174, 3208, 312, 2721,
+    205, 0, 0, 0, 0, 5450, 0, 0, 0, 3172, 0, 43, 4437, 310, 2647, 317,
+    2734, 244, 2523, 0, 243, 2006, 0, 0, 95, 0, 0, 0, 4681, 3546, 246, 0,
+    4058, 2076, 2900, 2935, 3435, 0, 35, 4426, 2725, 0, 3989, 294, 6498, 3234, 2580, 2534,
+    0, 189, 0, 321, 4446, 3118, 2997, 3062, 0, 238, 0, 203, 2571, 1601, 2479, 0,
+    0, 1962, 3318, 0, 1677, 1875, 2877, 3042, 3231, 3001, 81, 0, 0, 2886, 188, 2357,
+    306, 0, 0, 214, 100, 1874, 2441, 0, 4356, 5635, 5306, 0, 0, 5599, 3646, 1640,
+    4206, 2018, 2776, 2677, 243, 0, 2316, 0, 0, 1829, 0, 1611, 3295, 4971, 3250, 3165,
+    189, 2484, 2381, 234, 2084, 2432, 4569, 35, 305, 174, 0, 0, 7025, 45, 205, 0,
+    2494, 255, 1754, 89, 272, 3602, 1821, 0, 4225, 0, 2746, 201, 3304, 6811, 0, 3271,
+    2270, 36, 0, 0, 0, 0, 2161, 1951, 0, 5584, 3205, 219, 0, 3042, 3131, 6477,
+    230, 0, 0, 0, 3077, 6031, 0, 2776, 168, 0, 24, 2225, 228, 5141, 3655, 298,
+    3151, 2799, 5978, 291, 5361, 5966, 283, 2292, 2747, 0, 203, 0, 0, 0, 3140, 0,
+    13, 5096, 2613, 0, 235, 0, 2913, 4441, 2234, 226, 3794, 1605, 2649, 0, 192, 3260,
+    2650, 2699, 2908, 0, 284, 2284, 247, 3823, 0, 0, 257, 0, 0, 0, 3385, 0,
+    2853, 161, 5611, 200, 0, 2602, 286, 0, 2074, 1746, 4869, 4430, 0, 221, 0, 0,
+    4261, 0, 3033, 2009, 2903, 2811, 134, 0, 3008, 0, 0, 2974, 267, 0, 2547, 221,
+    0, 0, 2952, 2834, 0, 2936, 2348, 199, 0, 3559, 0, 3288, 3428, 2844, 0, 59,
+    3118, 0, 0, 213, 1966, 0, 1608, 0, 1744, 3030, 0, 2732, 109, 238, 0, 258,
+    4877, 2952, 296, 3338, 2523, 6069, 5813, 2864, 0, 4172, 2468, 2375, 290, 4217, 2668, 6690,
+    2006, 242, 5884, 0, 84, 2454, 2605, 2590, 321, 1829, 2044, 1649, 2977, 2736, 2754, 0,
+    197, 2516, 50, 5649, 0, 4974, 198, 6399, 177, 0, 158, 146, 3084, 172, 2433, 1820,
+    107, 99, 5106, 0, 4981, 5850, 1603, 12, 3166, 4934, 0, 0, 4482, 0, 0, 261,
+    1697, 291, 0, 186, 6194, 3036, 297, 3601, 2169, 63, 71, 1759, 2932, 247, 52, 5370,
+    11, 2096, 2073, 6358, 3205, 280, 222, 4208, 6238, 96, 2468, 0, 38, 3041, 1819, 3194,
+    0, 1676, 133, 1687, 2633, 95, 5765, 4747, 2721, 0, 305, 298, 0, 4547, 4711, 84,
+    0, 2504, 2283, 11, 2615, 0, 132, 0, 297, 0, 0, 0, 4208, 122, 315, 183,
+    2668, 6682, 0, 285, 3064, 1953, 2624, 0, 101, 314, 211, 1885, 0, 0, 2776, 0,
+    0, 0, 1622, 3037, 0, 0, 2956, 2710, 0, 53, 2589, 3448, 311, 0, 4868, 263,
+    2678, 2845, 228, 83, 0, 1606, 3051, 6519, 0, 223, 1746, 301, 89, 3120, 3253, 3305,
+    284, 0, 3390, 2844, 282, 249, 6030, 0, 0, 2602, 12, 304, 3787, 3769, 230, 0,
+    5471, 120, 0, 2473, 0, 13, 5086, 1875, 0, 2904, 0, 144, 4938, 4601, 7097, 0,
+    0, 274, 6074, 2954, 3128, 0, 3909, 1688, 2693, 0, 242, 195, 2780, 288, 0, 169,
+    2160, 0, 2518, 2152, 260, 0, 109, 0, 2668, 3183, 65, 0, 3164, 3657, 2369, 5757,
+    3041, 2820, 11, 3239, 4483, 2824, 2944, 1834, 2168, 26, 0, 180, 2864, 1898, 0, 1600,
+    1914, 2312, 4746, 198, 0, 2868, 187, 290, 132, 0, 1823, 3084, 194, 2958, 3603, 101,
+    3261, 5985, 2591, 2659, 5746, 4789, 0, 3221, 12, 3097, 2738, 261, 6351, 0, 0, 4896,
+    2338, 1699, 0, 24, 0, 4871, 0, 5748, 5105, 1748, 5374, 149, 40, 297, 2655, 3565,
+    2931, 3271, 0, 280, 2204, 4646, 3075, 0, 0, 0, 2406, 0, 5317, 1780, 2607, 4945,
+    6450, 3340, 2964, 2112, 0, 0, 84, 0, 2751, 59, 5087, 0, 6203, 3063, 5421, 74,
+    3462, 0, 0, 3040, 170, 2836, 0, 122, 0, 2468, 0, 322, 7217, 263, 0, 2864,
+    3043, 2287, 0, 1958, 2516, 1650, 0, 0, 5545, 1812, 249, 6742, 0, 4262, 3173, 0,
+    157, 1623, 3789, 0, 3274, 0, 174, 2539, 3196, 2877, 193, 3254, 5449, 2969, 214, 3398,
+    0, 315, 1607, 2337, 179, 2978, 3090, 2558, 49, 4321, 0, 2414, 3910, 2644, 229, 5327,
+    2403, 3316, 282, 2609, 0, 2160, 2845, 235, 265, 273, 5801, 1610, 2591, 3080, 5527, 0,
+    0, 173, 3260, 2996, 2205, 2504, 284, 0, 2723, 2953, 5032, 2963, 60, 204, 0, 3029,
+    2275, 6269, 223, 2809, 3165, 2679, 3771, 131, 3305, 292, 2941, 2204, 2083, 193, 72, 3000,
+    6721, 1691, 3018, 5968, 4701, 0, 175, 221, 1944, 0, 2336, 3113, 2843, 0, 108, 4436,
+    2770, 1697, 3128, 2151, 3249, 259, 232, 250, 0, 0, 66, 4783, 2637, 5151, 2170, 5109,
+    248, 0, 0, 6196, 283, 0, 0, 218, 2636, 4327, 3163, 262, 3011, 0, 3986, 0,
+    2777, 5987, 0, 0, 278, 2491, 2226, 0, 0, 0, 2666, 0, 0, 185, 6367, 3194,
+    0, 0, 3999, 1699, 3575, 306, 2820, 216, 3153, 0, 2468, 297, 29, 11, 271, 2801,
+    4749, 0, 1643, 277, 196, 76, 0, 6888, 3651, 0, 0, 6081, 0, 272, 3549, 0,
+    3282, 304, 0, 2779, 290, 84, 37, 2493, 2405, 5802, 0, 3186, 251, 2582, 277, 2985,
+    0, 3282, 0, 0, 3199, 3462, 2271, 5311, 0, 2814, 2867, 2129, 2834, 179, 183, 4350,
+    2766, 1773, 293, 310, 1763, 0, 5546, 6074, 2944, 5143, 0, 0, 0, 2923, 7278, 5628,
+    188, 0, 1701, 0, 214, 2625, 1753, 2877, 4501, 258, 4095, 2622, 0, 74, 0, 3838,
+    3275, 174, 3353, 217, 1613, 1940, 0, 5261, 211, 3095, 319, 1874, 2849, 0, 2832, 24,
+    2637, 0, 306, 0, 0, 3120, 3023, 0, 5856, 2725, 292, 5386, 7113, 4710, 0, 0,
+    0, 0, 3618, 215, 1610, 0, 2154, 0, 4939, 3029, 0, 6231, 2425, 143, 2337, 5113,
+    2646, 0, 62, 0, 1814, 2679, 0, 2974, 201, 190, 0, 3212, 5971, 210, 175, 2699,
+    6045, 2960, 6763, 0, 1846, 0, 2804, 1926, 2164, 199, 2336, 0, 5749, 0, 4657, 4453,
+    3284, 283, 3558, 119, 2469, 225, 3185, 2403, 3142, 2374, 60, 315, 2834, 0, 0, 214,
+    4332, 208, 2143, 0, 3095, 124, 86, 6131, 0, 0, 260, 1609, 4050, 2501, 2723, 0,
+    0, 170, 2551, 3326, 16, 0, 220, 0, 160, 2611, 2228, 3018, 275, 3282, 240, 4291,
+    3043, 6083, 0, 23, 3956, 74, 12, 101, 29, 2784, 315, 169, 2802, 3184, 1877, 2480,
+    274, 314, 3567, 0, 0, 155, 5142, 3008, 122, 2594, 2701, 293, 97, 178, 2846, 3186,
+    307, 3118, 2996, 0, 0, 3293, 5966, 3405, 3074, 268, 177, 50, 7242, 3492, 0, 2870,
+    2611, 6954, 0, 0, 181, 3682, 5545, 0, 49, 2505, 179, 232, 2766, 5307, 253, 6022,
+    3285, 1601, 254, 2571, 2745, 3153, 3831, 169, 1766, 108, 0, 3174, 3689, 3245, 2889, 2582,
+    0, 3220, 228, 2074, 2743, 1602, 2877, 71, 0, 2876, 161, 6216, 4135, 2740, 2226, 279,
+    2492, 5582, 3464, 169, 322, 3551, 248, 4005, 4462, 1940, 0, 2667, 308, 4659, 1681, 0,
+    6248, 5867, 0, 2997, 2300, 0, 0, 186, 3111, 0, 0, 2725, 4713, 2919, 3022, 2347,
+    2505, 3238, 5590, 3195, 0, 3024, 6610, 0, 5379, 271, 4447, 2833, 4043, 3161, 0, 5497,
+    220, 2604, 2402, 218, 2677, 3030, 3271, 0, 0, 2493, 245, 2029, 0, 35, 2691, 14,
+    0, 2765, 2911, 184, 169, 0, 278, 5423, 5099, 5306, 1887, 5364, 295, 4088, 35, 167,
+    303, 3320, 2746, 120, 3346, 5591, 4648, 3120, 2480, 2727, 289, 2689, 2440, 0, 2682, 260,
+    292, 306, 0, 0, 48, 2921, 0, 127, 227, 3067, 1612, 1608, 269, 148, 0, 3185,
+    0, 3095, 0, 0, 0, 0, 286, 4059, 4225, 1607, 0, 5316, 2525, 3043, 2008, 251,
+    0, 0, 5896, 0, 0, 1972, 4233, 0, 216, 2909, 0, 36, 0, 0, 0, 1839,
+    274, 4410, 0, 2559, 0, 3261, 6047, 195, 0, 2744, 2601, 53, 5146, 2945, 97, 2361,
+    0, 0, 0, 121, 289, 2646, 2424, 4527, 0, 0, 293, 78, 0, 6350, 6039, 156,
+    226, 274, 5966, 202, 0, 4186, 2847, 0, 257, 2801, 6024, 0, 3225, 2611, 2028, 0,
+    0, 2244, 2890, 3731, 3824, 0, 0, 260, 34, 3008, 1606, 3588, 3128, 0, 3847, 0,
+    2037, 286, 300, 155, 0, 0, 2230, 2748, 308, 4090, 2074, 3110, 6230, 208, 0, 0,
+    2570, 0, 4013, 2303, 0, 319, 197, 2933, 107, 2490, 2103, 0, 0, 2553, 2703, 0,
+    253, 2986, 3150, 0, 2349, 0, 0, 0, 5325, 3766, 227, 0, 162, 3284, 0, 314,
+    0, 200, 0, 0, 0, 5391, 0, 2838, 172, 5583, 3139, 2670, 0, 0, 0, 0,
+    0, 2735, 0, 2590, 3150, 0, 0, 2626, 4526, 302, 227, 2754, 2669, 2568, 2692, 2656,
+    241, 5086, 150, 2581, 147, 2910, 4650, 2982, 3142, 5675, 0, 3360, 75, 240, 5922, 49,
+    270, 207, 5529, 2578, 1607, 3306, 255, 319, 5773, 2183, 2748, 2450, 4045, 4052, 0, 2834,
+    133, 0, 0, 4649, 1772, 73, 48, 3227, 0, 3184, 4810, 4762, 0, 71, 13, 4876,
+    0, 4966, 1855, 2561, 109, 3143, 322, 3029, 212, 6471, 5381, 1608, 2480, 186, 177, 0,
+    0, 0, 0, 0, 3117, 4216, 0, 0, 0, 3316, 0, 0, 5538, 0, 35, 0,
+    2600, 2415, 143, 0, 6360, 61, 300, 316, 3779, 1742, 4725, 6239, 3611, 96, 2778, 278,
+    16, 53, 0, 2646, 47, 3030, 0, 0, 2920, 315, 2615, 2941, 0, 0, 2095, 2673,
+    0, 4491, 2893, 2304, 0, 2611, 239, 172, 1690, 123, 0, 292, 196, 209, 0, 0,
+    285, 197, 188, 0, 2644, 0, 2710, 86, 2715, 1876, 0, 1687, 3029, 0, 3043, 0,
+    1600, 2573, 0, 2678, 0, 0, 3112, 1606, 301, 0, 0, 0, 2876, 120, 4888, 1632,
+    0, 2946, 0, 6041, 0, 0, 238, 2150, 2966, 3122, 1707, 2768, 255, 3150, 0, 5326,
+    0, 0, 4116, 0, 1602, 4529, 0, 239, 0, 0, 299, 0, 2030, 0, 2513, 0,
+    321, 84, 96, 182, 0, 0, 292, 2468, 195, 0, 0, 0, 144, 5582, 286, 3434,
+    0, 4563, 1601, 3903, 3110, 0, 2490, 0, 3167, 2393, 314, 1600, 215, 294, 2692, 0,
+    228, 3227, 86, 1782, 0, 2674, 0, 2083, 2177, 0, 2006, 95, 0, 302, 1943, 270,
+    313, 5537, 0, 2711, 3219, 2102, 2856, 5010, 4072, 198, 2766, 2750, 0, 2340, 3097, 4227,
+    0, 0, 5994, 2570, 2556, 76, 4833, 1603, 194, 3628, 0, 4527, 3208, 0, 4484, 0,
+    0, 0, 305, 0, 269, 0, 4968, 4756, 5766, 0, 168, 2417, 40, 1809, 4876, 185,
+    0, 35, 0, 0, 259, 197, 1608, 133, 250, 1602, 3326, 1742, 2630, 0, 0, 1721,
+    1808, 2567, 2404, 0, 217, 207, 4020, 3867, 2190, 169, 2019, 5090, 2537, 0, 0, 234,
+    0, 1940, 5985, 322, 2771, 2955, 2564, 0, 2469, 0, 0, 0, 0, 2735, 6240, 0,
+    2206, 0, 128, 0, 222, 0, 194, 0, 0, 0, 5690, 2273, 4646, 0, 2017, 235,
+    0, 75, 240, 1895, 2920, 4262, 0, 5186, 3286, 2858, 226, 3076, 86, 5222, 0, 0,
+    0, 4565, 2625, 0, 0, 3399, 2638, 3113, 0, 2513, 2534, 258, 0, 3294, 318, 3316,
+    0, 0, 188, 321, 0, 5347, 0, 0, 3830, 2094, 0, 3228, 157, 265, 2270, 317,
+    6186, 1602, 0, 1604, 3610, 3129, 2771, 0, 1603, 0, 0, 2617, 96, 0, 112, 1611,
+    2150, 0, 2680, 0, 4207, 4493, 4439, 200, 25, 58, 296, 146, 3155, 2930, 174, 135,
+    209, 247, 0, 2469, 3029, 0, 1765, 0, 2083, 2603, 239, 2538, 2171, 2813, 6353, 3085,
+    3042, 0, 1946, 1904, 193, 0, 3227, 6686, 3280, 2790, 4817, 2502, 1621, 3265, 261, 262,
+    2857, 4867, 5765, 2547, 3139, 209, 2506, 2576, 5003, 0, 0, 2666, 2140, 2887, 144, 6007,
+    1687, 0, 280, 3219, 2747, 192, 0, 1603, 0, 250, 0, 0, 4772, 2974, 0, 3115,
+    0, 6372, 1600, 7056, 0, 2512, 2788, 5986, 183, 1809, 0, 0, 95, 5539, 259, 5756,
+    76, 247, 5362, 0, 0, 2691, 4932, 59, 0, 0, 294, 4270, 272, 0, 5407, 1723,
+    2920, 132, 2823, 5811, 2990, 5712, 0, 1885, 2021, 291, 0, 0, 251, 0, 231, 136,
+    1774, 310, 1610, 2737, 2538, 2073, 0, 0, 3382, 282, 5004, 4656, 2471, 1940, 1742, 1838,
+    2274, 3619, 2977, 0, 0, 0, 0, 2949, 5189, 5307, 2966, 121, 6715, 4584, 0, 201,
+    0, 1819, 0, 0, 3007, 5627, 0, 83, 3241, 2733, 188, 175, 305, 2743, 3392, 182,
+    1953, 2658, 1757, 0, 0, 0, 78, 0, 316, 0, 201, 0, 3881, 0, 2726, 2085,
+    0, 2469, 261, 0, 277, 230, 2880, 0, 4307, 2638, 5528, 6110, 193, 210, 5847, 4720,
+    2512, 135, 3034, 0, 191, 0, 2138, 0, 96, 0, 189, 235, 5113, 6233, 0, 2685,
+    62, 318, 239, 119, 0, 2826, 0, 0, 254, 2897, 0, 0, 167, 42, 6798, 3207,
+    0, 193, 3121, 0, 6386, 2650, 0, 2600, 2919, 2987, 2139, 3557, 2855, 2791, 287, 2859,
+    0, 0, 180, 1848, 0, 0, 3145, 219, 1676, 4346, 2579, 3029, 0, 5016, 4868, 2688,
+    0, 3654, 25, 0, 15, 0, 2666, 0, 2273, 3793, 2800, 0, 0, 88, 3328, 199,
+    1809, 183, 5363, 2622, 0, 211, 3044, 0, 0, 2338, 1795, 0, 2482, 240, 2501, 181,
+    0, 3546, 6202, 0, 6800, 217, 1886, 74, 95, 0, 2697, 260, 1631, 282, 3427, 4666,
+    3118, 2602, 0, 3840, 209, 3411, 2537, 2485, 0, 2216, 3216, 0, 301, 0, 0, 1877,
+    0, 2739, 0, 5307, 2283, 0, 4534, 0, 2512, 1978, 250, 3260, 5325, 5697, 3197, 4264,
+    2593, 268, 7252, 252, 294, 2294, 1832, 2813, 0, 2901, 2600, 5318, 206, 3241, 2624, 259,
+    274, 2747, 2545, 5442, 1604, 2506, 131, 2612, 125, 0, 59, 1602, 0, 2432, 2237, 6022,
+    2075, 0, 3154, 0, 5190, 277, 1954, 2722, 0, 2403, 0, 6470, 2659, 119, 1940, 229,
+    3683, 0, 167, 0, 171, 0, 0, 2569, 0, 2934, 0, 2766, 2423, 2846, 0, 0,
+    1808, 3315, 0, 3161, 2963, 3833, 3207, 5530, 2842, 2766, 5846, 2975, 0, 4737, 0, 5967,
+    5121, 270, 257, 3620, 0, 0, 2089, 2759, 4467, 6032, 1605, 5747, 299, 2569, 3883, 0,
+    6828, 133, 4218, 1908, 6693, 0, 5153, 258, 0, 14, 2633, 235, 2590, 3274, 307, 25,
+    5882, 0, 2523, 90, 0, 227, 0, 204, 216, 2765, 6414, 3073, 2558, 4925, 5626, 232,
+    2481, 2139, 4869, 3125, 133, 226, 3786, 1676, 3285, 2734, 4455, 3347, 0, 0, 2600, 3109,
+    0, 2215, 0, 1604, 0, 218, 3306, 157, 1715, 1820, 0, 193, 276, 0, 2321, 0,
+    0, 258, 0, 0, 2531, 236, 2623, 2545, 2284, 2012, 5803, 3046, 157, 111, 182, 256,
+    2541, 0, 5811, 0, 1677, 4271, 0, 4666, 0, 0, 3442, 1637, 2800, 2900, 3299, 0,
+    209, 4541, 2996, 2473, 0, 0, 5591, 6267, 2603, 145, 2559, 4234, 2491, 211, 6388, 2812,
+    180, 2527, 2413, 2479, 3031, 2078, 2149, 0, 0, 1607, 2557, 2647, 3345, 237, 1841, 3852,
+    5086, 1611, 202, 215, 2975, 183, 0, 3556, 2854, 2722, 0, 3647, 0, 3271, 186, 0,
+    2627, 1640, 0, 2556, 2077, 14, 230, 0, 2810, 297, 6023, 2468, 248, 293, 2661, 5194,
+    2757, 2935, 1743, 5802, 36, 0, 3717, 4702, 2656, 3148, 0, 0, 168, 310, 2434, 2117,
+    2678, 0, 112, 35, 2941, 1860, 0, 4014, 0, 2842, 5333, 0, 1808, 63, 0, 3021,
+    3064, 2357, 3250, 2745, 2755, 1879, 3768, 3109, 0, 1604, 0, 0, 0, 6499, 5370, 0,
+    2745, 0, 2592, 0, 2027, 3218, 3336, 0, 203, 0, 0, 0, 0, 2139, 5318, 6393,
+    277, 4647, 1604, 0, 0, 2633, 170, 3008, 0, 2831, 138, 3173, 155, 0, 0, 0,
+    0, 2627, 2999, 275, 0, 0, 0, 120, 0, 0, 5590, 5626, 0, 245, 0, 37,
+    2486, 3295, 3801, 255, 3566, 2590, 2758, 1919, 3249, 2944, 1676, 0, 0, 6294, 3366, 0,
+    111, 5978, 0, 0, 4975, 1821, 5341, 5115, 119, 205, 23, 2578, 312, 0, 320, 0,
+    2722, 3117, 109, 5581, 270, 3183, 0, 3613, 2963, 3047, 2367, 1951, 2847, 112, 0, 3216,
+    157, 2347, 5810, 204, 4220, 2965, 0, 0, 2798, 3077, 3285, 0, 2512, 4966, 0, 2902,
+    5201, 316, 2562, 6300, 0, 0, 316, 2781, 0, 6426, 13, 301, 5165, 0, 0, 0,
+    0, 0, 4543, 232, 168, 0, 1655, 0, 1689, 186, 2736, 228, 2138, 190, 3875, 4209,
+    5362, 0, 0, 4505, 2701, 2699, 3007, 17, 284, 2652, 0, 196, 2432, 254, 254, 318,
+    0, 18, 158, 221, 208, 4314, 257, 6021, 0, 0, 0, 6195, 0, 87, 134, 0,
+    2501, 1743, 4703, 3272, 0, 73, 1648, 3327, 2681, 2680, 4007, 4911, 213, 0, 0, 0,
+    2967, 3064, 107, 180, 0, 3238, 2758, 2678, 1605, 1811, 3661, 139, 3066, 236, 225, 2470,
+    2875, 0, 1708, 0, 3167, 0, 0, 0, 182, 4665, 0, 0, 2584, 0, 318, 0,
+    4278, 2734, 13, 248, 5759, 3490, 2666, 0, 2151, 4094, 2366, 298, 5317, 0, 3106, 0,
+    2491, 2589, 84, 3338, 0, 270, 2503, 4647, 2436, 3316, 170, 0, 2490, 73, 2111, 2018,
+    4247, 198, 0, 120, 2514, 91, 0, 0, 5631, 5308, 4782, 2600, 111, 77, 2702, 313,
+    3188, 98, 5593, 311, 0, 0, 5526, 2612, 0, 0, 0, 0, 1603, 257, 2629, 266,
+    5195, 4391, 1601, 2556, 304, 5306, 2711, 0, 5993, 2348, 0, 3220, 3210, 312, 0, 2700,
+    5781, 3063, 0, 5977, 185, 2093, 5931, 3249, 0, 0, 6130, 0, 0, 119, 0, 3997,
+    3117, 143, 0, 4967, 156, 189, 3183, 1709, 96, 4058, 243, 2743, 195, 200, 0, 2007,
+    6404, 0, 0, 3988, 0, 2683, 239, 5414, 204, 0, 176, 181, 0, 0, 172, 4987,
+    6273, 2958, 3066, 0, 271, 214, 2757, 0, 3381, 0, 0, 3085, 0, 3272, 92, 0,
+    2801, 0, 5165, 299, 0, 2473, 222, 0, 0, 2138, 5547, 2468, 3139, 1606, 0, 30,
+    226, 0, 0, 6210, 276, 98, 1743, 3229, 4026, 226, 2954, 2612, 2890, 0, 23, 2870,
+    5253, 250, 0, 0, 4703, 2844, 2721, 3305, 1601, 232, 1897, 303, 0, 3068, 0, 181,
+    2249, 3580, 0, 24, 0, 233, 0, 3216, 265, 2690, 0, 0, 7094, 0, 2648, 3766,
+    171, 6066, 119, 1688, 311, 0, 208, 0, 0, 36, 3868, 191, 0, 0, 0, 187,
+    0, 2152, 6305, 3097, 4211, 174, 5310, 0, 263, 2526, 0, 6714, 0, 2402, 0, 2208,
+    2908, 0, 4930, 2964, 5319, 310, 0, 200, 2822, 177, 0, 3333, 6882, 146, 0, 0,
+    261, 3142, 266, 224, 0, 37, 6687, 2942, 300, 0, 2524, 1624, 2194, 2713, 264, 2986,
+    2974, 98, 5775, 0, 3261, 2919, 1964, 0, 4150, 2549, 2626, 3221, 5916, 2612, 115, 0,
+    5761, 2073, 280, 3547, 302, 181, 1764, 2523, 2835, 319, 3996, 2408, 4087, 0, 0, 2743,
+    2666, 0, 6152, 0, 2979, 277, 0, 0, 0, 0, 3238, 1609, 5540, 2645, 3240, 3986,
+    1732, 2514, 0, 112, 2142, 0, 1606, 27, 2018, 0, 4658, 3315, 317, 2875, 194, 5407,
+    3173, 2866, 5526, 2978, 6743, 5308, 219, 4436, 246, 0, 119, 3217, 2657, 1606, 3096, 5037,
+    0, 3382, 6562, 0, 2568, 3040, 2761, 3153, 0, 2932, 1601, 5750, 0, 5968, 0, 4124,
+    0, 2970, 3187, 6884, 0, 143, 0, 5421, 3426, 3309, 3118, 0, 0, 0, 4042, 0,
+    276, 1600, 1614, 3007, 191, 123, 2293, 2876, 3012, 2746, 3229, 2339, 0, 282, 0, 0,
+    0, 3305, 0, 4308, 4931, 0, 85, 147, 73, 5070, 0, 3196, 2635, 0, 4481, 3070,
+    2475, 2953, 205, 3581, 2688, 2803, 0, 83, 189, 2767, 3243, 2611, 0, 5861, 0, 0,
+    0, 0, 0, 5159, 2536, 72, 5477, 0, 6067, 0, 2811, 0, 5825, 6285, 195, 0,
+    4001, 2083, 233, 1942, 0, 2886, 1971, 2528, 67, 2272, 0, 255, 3304, 0, 0, 26,
+    6680, 0, 0, 193, 5598, 4323, 2989, 183, 2765, 291, 36, 0, 4702, 0, 266, 2204,
+    0, 1604, 2342, 0, 2666, 2890, 0, 1602, 3230, 0, 2707, 0, 3130, 0, 2963, 3869,
+    219, 0, 315, 262, 2923, 2777, 2647, 264, 177, 3711, 1609, 4129, 2387, 47, 2919, 289,
+    185, 3546, 2886, 4680, 181, 3183, 3426, 0, 3319, 0, 0, 2867, 4102, 2006, 3217, 2225,
+    0, 2743, 0, 176, 0, 2648, 1888, 198, 2645, 74, 2820, 2218, 3470, 260, 3106, 269,
+    0, 4886, 227, 0, 0, 0, 2528, 2635, 83, 0, 4426, 0, 2051, 0, 0, 321,
+    0, 203, 2837, 0, 35, 1753, 2580, 4206, 0, 3549, 3602, 2301, 238, 3190, 249, 2935,
+    188, 198, 2835, 0, 2749, 0, 3315, 0, 2622, 4162, 3118, 2007, 3242, 0, 5970, 176,
+    2545, 0, 5312, 274, 0, 0, 2899, 173, 0, 2441, 287, 1601, 0, 256, 3110, 231,
+    238, 3337, 5855, 2732, 3032, 3229, 4535, 3822, 0, 0, 0, 0, 119, 3767, 2624, 229,
+    5701, 125, 205, 1955, 0, 306, 0, 4673, 7021, 2523, 4427, 5553, 2426, 3228, 2006, 0,
+    0, 1602, 4051, 2561, 2110, 2898, 6051, 0, 0, 195, 1610, 0, 4445, 3304, 6031, 2735,
+    1623, 215, 3106, 247, 0, 5105, 2028, 6947, 5584, 2975, 2889, 3892, 175, 5752, 4288, 2423,
+    224, 0, 72, 2073, 54, 275, 0, 0, 0, 2292, 227, 36, 3008, 6699, 4885, 2530,
+    235, 3239, 284, 47, 2611, 2615, 0, 4562, 3205, 1763, 3297, 2913, 2635, 60, 3163, 2501,
+    13, 0, 1904, 3140, 221, 4930, 0, 242, 2787, 0, 289, 2769, 192, 71, 3288, 2284,
+    298, 31, 1609, 49, 0, 3277, 2626, 2647, 0, 2612, 0, 98, 3033, 1876, 2503, 2649,
+    0, 3294, 0, 0, 23, 2765, 2803, 12, 0, 3264, 0, 2225, 2954, 0, 0, 2872,
+    0, 2140, 0, 3987, 2887, 0, 0, 176, 2072, 3517, 0, 3106, 0, 2591, 2300, 4682,
+    0, 0, 263, 2935, 0, 2052, 0, 3646, 3993, 2844, 0, 3384, 6365, 51, 0, 3648,
+    3437, 231, 171, 2360, 4140, 0, 201, 0, 217, 2007, 238, 0, 1607, 265, 184, 0,
+    2118, 2844, 1952, 0, 0, 1680, 2724, 256, 2922, 310, 307, 0, 173, 0, 3265, 1744,
+    4499, 2601, 0, 2006, 0, 2453, 2688, 158, 3075, 109, 122, 4536, 6021, 309, 3031, 0,
+    0, 0, 0, 3284, 3785, 40, 3195, 3129, 6194, 1810, 287, 0, 0, 0, 5560, 3111,
+    2667, 2941, 102, 3768, 205, 5849, 1773, 5229, 243, 276, 0, 310, 0, 6504, 3041, 2891,
+    3690, 3238, 0, 2503, 0, 5379, 0, 4570, 2768, 35, 3025, 0, 2736, 3821, 0, 5370,
+    0, 1819, 0, 4449, 2029, 63, 280, 0, 4747, 3084, 4066, 0, 0, 97, 2744, 0,
+    5361, 11, 0, 2993, 2567, 0, 0, 3096, 3336, 2746, 2633, 12, 246, 321, 5756, 280,
+    1887, 84, 297, 83, 2721, 2283, 0, 2548, 289, 265, 3316, 0, 0, 0, 2482, 0,
+    0, 2679, 3065, 227, 2964, 3390, 0, 261, 2945, 4342, 0, 2853, 4225, 3806, 4648, 2347,
+    4877, 216, 237, 2651, 2494, 255, 0, 2787, 0, 0, 0, 3251, 0, 0, 0, 6230,
+    2423, 1687, 0, 121, 3117, 120, 2072, 4279, 1631, 309, 0, 223, 4887, 238, 3228, 3209,
+    50, 2558, 2733, 0, 5819, 1896, 168, 3163, 2302, 0, 0, 0, 0, 13, 243, 228,
+    4597, 247, 2915, 2613, 186, 1874, 2292, 0, 6030, 2976, 1951, 4974, 282, 0, 3305, 171,
+    6021, 304, 3052, 2903, 4866, 0, 245, 2693, 156, 0, 2468, 2898, 167, 3936, 0, 3268,
+    2732, 3162, 0, 0, 0, 2913, 3826, 1811, 2704, 284, 3667, 2688, 3177, 2104, 192, 2635,
+    5223, 2281, 0, 5985, 4511, 2159, 0, 0, 260, 96, 2006, 1787, 1649, 6483, 2857, 5765,
+    3162, 0, 2046, 48, 180, 2809, 0, 0, 252, 2020, 207, 1913, 0, 4923, 4677, 0,
+    0, 2824, 2701, 0, 254, 3284, 5746, 24, 6194, 61, 0, 274, 0, 2721, 5096, 0,
+    3272, 0, 4746, 161, 0, 315, 4881, 2580, 5373, 0, 0, 15, 0, 2897, 203, 3548,
+    0, 4316, 0, 280, 5976, 0, 0, 0, 6238, 5142, 1943, 1747, 4552, 2590, 0, 0,
+    0, 198, 4651, 2297, 2756, 2567, 246, 321, 221, 3565, 6245, 0, 206, 74, 0, 2549,
+    1749, 0, 2517, 0, 1605, 2578, 254, 2751, 0, 0, 0, 0, 2624, 3339, 0, 170,
+    2286, 0, 3132, 99, 2978, 1874, 73, 5327, 0, 84, 1603, 0, 4482, 0, 0, 55,
+    0, 261, 38, 3398, 2169, 2958, 2414, 5882, 0, 1687, 172, 1606, 0, 2468, 3117, 216,
+    0, 0, 237, 0, 193, 1612, 3210, 2351, 5536, 2097, 2204, 0, 0, 3830, 5196, 3205,
+    4983, 1607, 214, 5527, 0, 3390, 0, 247, 2866, 2639, 2558, 3163, 3079, 2726, 0, 0,
+    298, 6826, 3778, 2622, 2504, 239, 1604, 2615, 174, 7036, 4207, 251, 2403, 204, 65, 2072,
+    3055, 2737, 3085, 2525, 1633, 242, 2844, 5414, 13, 1622, 0, 2843, 0, 0, 265, 2770,
+    0, 0, 83, 232, 3601, 3909, 2809, 0, 5097, 2712, 237, 168, 183, 1885, 5449, 4922,
+    313, 2634, 1697, 1788, 0, 2149, 2678, 2275, 322, 175, 5235, 107, 103, 250, 2974, 3029,
+    5966, 249, 3574, 226, 5987, 0, 0, 6074, 282, 0, 3139, 299, 0, 0, 2659, 2954,
+    2833, 0, 2655, 2754, 0, 0, 0, 6205, 0, 0, 0, 1899, 0, 0, 4748, 3915,
+    314, 242, 198, 5536, 0, 0, 0, 4948, 152, 3000, 0, 2832, 2503, 2150, 175, 283,
+    2493, 124, 84, 0, 0, 288, 0, 292, 203, 0, 316, 40, 4938, 3164, 3845, 2549,
+    0, 3282, 277, 1642, 4280, 7274, 2824, 3239, 6748, 0, 0, 1601, 0, 0, 0, 0,
+    0, 0, 0, 0, 3770, 0, 0, 0, 3172, 254, 0, 1838, 3133, 2853, 0, 3085,
+    0, 104, 3185, 1700, 296, 1600, 178, 242, 3252, 3607, 2868, 4486, 5985, 2622, 0, 0,
+    2338, 2367, 300, 7015, 5041, 0, 3398, 2866, 179, 37, 1626, 2669, 286, 4206, 4349, 0,
+    0, 4438, 3275, 1615, 3463, 0, 5422, 5329, 5854, 197, 2888, 3952, 0, 3152, 0, 2723,
+    0, 3353, 2414, 1604, 0, 1813, 169, 0, 2710, 279, 0, 5087, 2448, 0, 282, 4710,
+    194, 2636, 0, 301, 268, 3162, 1940, 3040, 0, 3022, 2403, 0, 2217, 3273, 3558, 5747,
+    2520, 0, 2507, 2810, 3547, 5212, 3060, 0, 0, 1853, 5662, 3084, 6187, 3205, 4262, 175,
+    0, 4701, 3196, 5818, 0, 3219, 3020, 216, 0, 298, 107, 4328, 2019, 2168, 74, 2502,
+    60, 225, 2646, 3119, 1610, 2404, 0, 0, 242, 2501, 67, 263, 3228, 5306, 315, 4924,
+    0, 0, 0, 16, 0, 3610, 5098, 3400, 2754, 2374, 261, 3173, 200, 277, 1679, 6046,
+    3011, 4086, 218, 2998, 0, 0, 0, 83, 216, 267, 2773, 0, 3327, 2953, 220, 0,
+    3032, 316, 0, 6727, 2540, 74, 2359, 0, 2677, 6082, 2792, 131, 3095, 6555, 223, 2815,
+    0, 236, 123, 313, 3250, 4217, 144, 193, 4050, 2582, 3920, 0, 2525, 0, 2943, 0,
+    2350, 7238, 3042, 4042, 183, 6893, 0, 3263, 293, 298, 1986, 2843, 5780, 0, 2172, 178,
+    319, 2557, 3286, 213, 0, 2548, 254, 274, 49, 2867, 177, 6022, 3118, 0, 3161, 2660,
+    5989, 2242, 2777, 0, 0, 69, 7061, 169, 0, 5746, 2821, 2658, 249, 0, 3550, 3201,
+    295, 6109, 97, 0, 4107, 71, 1702, 2888, 0, 2820, 2622, 0, 2640, 192, 1890, 308,
+    1616, 169, 0, 185, 95, 294, 1603, 3625, 264, 80, 2745, 3252, 260, 2699, 0, 3100,
+    2710, 0, 3218, 2226, 0, 0, 2865, 4900, 2670, 1756, 2699, 4712, 3618, 231, 2548, 262,
+    0, 0, 2988, 3271, 3465, 2073, 5671, 0, 0, 2833, 319, 185, 3997, 3391, 2291, 2358,
+    4050, 132, 0, 0, 0, 136, 175, 0, 155, 0, 3023, 3010, 2336, 3062, 5802, 276,
+    3355, 3135, 200, 0, 5581, 278, 0, 3217, 2525, 0, 2628, 0, 0, 5364, 2491, 2799,
+    0, 5089, 1678, 2625, 263, 1952, 3346, 0, 223, 2623, 2442, 303, 0, 0, 4754, 275,
+    2402, 2910, 2726, 0, 126, 83, 5536, 0, 148, 23, 4941, 3034, 3319, 2641, 5527, 4646,
+    0, 6806, 1610, 306, 1706, 215, 2909, 191, 3329, 2945, 2008, 1878, 4591, 2689, 3032, 0,
+    0, 266, 0, 2425, 0, 2539, 48, 2589, 0, 235, 2975, 0, 3152, 0, 210, 0,
+    3022, 2552, 2208, 5113, 2176, 0, 6386, 3250, 1607, 1608, 7131, 195, 2744, 2963, 0, 2218,
+    0, 313, 2614, 5827, 0, 60, 3284, 0, 3260, 4867, 2920, 2149, 2688, 6350, 2501, 2963,
+    2871, 6186, 172, 18, 3008, 214, 2557, 6024, 5895, 5443, 3249, 200, 4526, 2490, 156, 285,
+    172, 0, 2037, 315, 214, 178, 2660, 3289, 123, 3019, 2645, 0, 2144, 0, 224, 3025,
+    3151, 2941, 3569, 0, 12, 95, 218, 23, 0, 113, 3099, 2229, 2611, 4894, 3777, 0,
+    0, 2492, 2472, 1831, 27, 4867, 0, 2799, 135, 0, 278, 0, 0, 0, 4013, 2997,
+    0, 5372, 0, 219, 1606, 0, 0, 3108, 212, 2568, 1682, 2554, 1970, 0, 0, 1609,
+    2613, 6615, 101, 0, 0, 2974, 0, 0, 2745, 2336, 2595, 227, 2282, 294, 6022, 0,
+    0, 0, 187, 5316, 3150, 2490, 6103, 2347, 174, 0, 314, 3695, 0, 236, 5665, 2579,
+    3095, 0, 5561, 0, 3062, 0, 3348, 4429, 228, 162, 5527, 147, 0, 2669, 77, 5380,
+    293, 258, 2910, 0, 2604, 1952, 3346, 270, 4005, 2578, 2878, 322, 0, 241, 4616, 2667,
+    5873, 207, 3685, 2832, 256, 0, 0, 1772, 0, 0, 2700, 276, 0, 0, 73, 310,
+    4575, 145, 4241, 3238, 2496, 0, 2093, 1602, 2945, 0, 0, 171, 2509, 4044, 3195, 0,
+    0, 39, 0, 273, 2633, 0, 4061, 4216, 4761, 5271, 159, 167, 182, 3272, 0, 235,
+    2767, 2983, 186, 3027, 0, 5758, 2508, 0, 3141, 0, 1714, 194, 2892, 6359, 3096, 319,
+    0, 0, 0, 2728, 3143, 314, 0, 216, 5088, 133, 0, 122, 0, 4718, 0, 303,
+    2683, 0, 0, 3776, 0, 2765, 5457, 0, 6266, 0, 172, 1942, 1690, 0, 300, 2413,
+    2855, 4907, 4646, 2496, 0, 2282, 0, 308, 2668, 2715, 123, 0, 0, 4668, 64, 2569,
+    260, 2985, 3296, 3076, 0, 2699, 2424, 4371, 2074, 0, 0, 225, 0, 0, 275, 4013,
+    0, 292, 2567, 2690, 0, 2559, 137, 5334, 2349, 2482, 2832, 0, 281, 0, 2644, 181,
+    246, 0, 5186, 121, 0, 2479, 4528, 0, 237, 3101, 6040, 0, 2933, 2303, 0, 5979,
+    286, 1601, 1641, 0, 239, 14, 85, 1874, 0, 4015, 300, 2613, 0, 84, 2536, 5150,
+    0, 6026, 2468, 2799, 0, 2689, 3318, 1602, 260, 314, 3747, 120, 253, 207, 1707, 0,
+    220, 1822, 1606, 0, 2490, 2831, 96, 1943, 180, 0, 3131, 0, 0, 258, 2703, 0,
+    0, 302, 0, 3362, 2526, 2879, 220, 0, 2846, 2103, 163, 0, 5555, 2272, 62, 1631,
+    3766, 0, 0, 5994, 3284, 274, 147, 0, 3154, 1781, 300, 2481, 253, 0, 2581, 2887,
+    113, 0, 305, 1941, 0, 2637, 5397, 0, 172, 0, 3822, 6853, 272, 2093, 0, 4755,
+    2633, 5442, 3218, 0, 38, 308, 0, 6352, 0, 3227, 3108, 0, 0, 2162, 4343, 3987,
+    0, 0, 0, 0, 0, 1912, 5910, 0, 2798, 2630, 3107, 2760, 75, 6315, 212, 1940,
+    0, 3139, 170, 1906, 255, 241, 3238, 2789, 5690, 6296, 253, 4812, 0, 3780, 4726, 2834,
+    0, 6239, 0, 73, 0, 5976, 240, 0, 202, 0, 0, 235, 0, 35, 2017, 5774,
+    2858, 212, 47, 3293, 2578, 5641, 0, 0, 2535, 322, 5346, 194, 220, 7222, 4966, 2886,
+    2568, 0, 0, 0, 129, 188, 197, 0, 3123, 38, 2965, 0, 2909, 251, 5366, 2271,
+    302, 3007, 37, 2564, 268, 144, 316, 0, 4207, 0, 2778, 2920, 188, 0, 0, 2270,
+    4530, 2690, 3265, 5187, 5106, 2616, 3874, 6799, 48, 2656, 281, 2036, 2942, 2734, 5151, 256,
+    2529, 20, 0, 3316, 0, 232, 0, 4492, 2644, 47, 158, 189, 2010, 2930, 294, 2717,
+    5605, 209, 4209, 3830, 0, 0, 2603, 1656, 3271, 1634, 51, 2617, 1632, 88, 96, 0,
+    0, 6686, 1755, 0, 156, 2678, 1607, 1945, 152, 1606, 0, 239, 0, 253, 3164, 95,
+    0, 299, 0, 3556, 1600, 2590, 0, 4006, 0, 0, 2788, 0, 2948, 0, 0, 6006,
+    199, 5450, 0, 0, 0, 3029, 0, 243, 2341, 0, 0, 2887, 4306, 4768, 3156, 3031,
+    2018, 2512, 4968, 0, 286, 2481, 0, 3128, 318, 1765, 298, 2666, 4270, 3144, 5756, 225,
+    5316, 3435, 0, 1951, 0, 0, 2490, 2527, 59, 3989, 1601, 0, 294, 170, 0, 205,
+    0, 5307, 300, 0, 2689, 1953, 0, 41, 0, 234, 77, 0, 2512, 2600, 272, 0,
+    0, 5711, 0, 1875, 2535, 2990, 0, 0, 2471, 2153, 4122, 2102, 194, 0, 2494, 184,
+    1838, 0, 4355, 4656, 3304, 0, 3253, 2656, 5306, 0, 0, 0, 0, 2886, 0, 201,
+    5635, 2084, 2950, 4893, 6102, 2733, 2484, 4969, 2381, 0, 5890, 197, 183, 202, 2271, 4437,
+    234, 180, 0, 42, 133, 0, 309, 0, 3152, 304, 5186, 2854, 0, 0, 0, 0,
+    1754, 2420, 2832, 1830, 169, 48, 5406, 0, 0, 0, 3227, 247, 6232, 4719, 256, 3140,
+    0, 1821, 119, 1940, 188, 2644, 0, 0, 3839, 95, 0, 2415, 3867, 1962, 2505, 5748,
+    3121, 0, 2041, 0, 5151, 232, 0, 0, 0, 0, 0, 1606, 0, 4454, 5526, 0,
+    4705, 0, 0, 3327, 5098, 0, 234, 2402, 0, 0, 24, 239, 0, 3559, 0, 0,
+    199, 226, 0, 2083, 238, 2908, 0, 6686, 0, 3654, 303, 144, 1895, 2858, 1621, 0,
+    2649, 6189, 63, 0, 96, 235, 3119, 3260, 3222, 2977, 234, 3793, 4440, 3208, 0, 3085,
+    0, 2407, 200, 0, 295, 4866, 15, 0, 2772, 180, 5316, 0, 2308, 87, 7011, 47,
+    2235, 192, 0, 0, 0, 0, 2964, 0, 2526, 263, 2482, 2009, 3427, 0, 0, 1877,
+    3118, 0, 261, 2281, 3161, 0, 206, 2936, 3172, 0, 0, 3051, 3033, 5696, 317, 0,
+    0, 177, 3042, 0, 0, 5307, 0, 2930, 6688, 0, 4261, 79, 272, 296, 2688, 4217,
+    0, 3383, 5407, 0, 3152, 2932, 2912, 37, 0, 2747, 183, 192, 12, 1847, 209, 201,
+    0, 5884, 1963, 1776, 3304, 14, 305, 0, 2535, 2624, 0, 3309, 0, 3338, 5648, 3255,
+    0, 3601, 264, 188, 0, 1603, 1600, 95, 0, 6111, 0, 2423, 2140, 1954, 99, 2897,
+    7071, 0, 215, 3240, 0, 2952, 4428, 5097, 110, 4933, 2800, 2558, 305, 2854, 135, 1603,
+    2336, 2821, 4901, 0, 3315, 211, 0, 1758, 5005, 0, 4733, 0, 133, 291, 2811, 1829,
+    3619, 5747, 3073, 2073, 3206, 0, 253, 2568, 3217, 319, 2271, 0, 0, 3034, 114, 3108,
+    5976, 0, 61, 2633, 258, 3832, 1808, 0, 0, 2990, 5361, 241, 2317, 2842, 231, 185,
+    1611, 0, 87, 6358, 0, 0, 0, 5967, 204, 0, 0, 0, 0, 3010, 0, 282,
+    0, 0, 149, 3051, 0, 3786, 2633, 199, 195, 0, 0, 235, 0, 0, 2671, 146,
+    0, 0, 1953, 2937, 3560, 2733, 3051, 0, 5847, 2485, 305, 5599, 232, 122, 2270, 2534,
+    3044, 2800, 2882, 230, 3330, 0, 5757, 174, 3035, 182, 265, 89, 2176, 2011, 1746, 4626,
+    3264, 191, 5150, 2432, 2956, 249, 5811, 2623, 2531, 88, 3328, 3441, 0, 1877, 0, 1819,
+    177, 0, 0, 3647, 279, 0, 288, 2473, 0, 2602, 2534, 0, 0, 0, 3299, 109,
+    6679, 1840, 0, 2204, 1833, 0, 3084, 0, 0, 1604, 0, 2924, 0, 1688, 157, 5024,
+    2831, 2899, 3656, 108, 0, 1604, 2369, 2701, 4534, 264, 214, 119, 214, 248, 2557, 0,
+    201, 3795, 2780, 4208, 2897, 14, 0, 5445, 0, 6801, 4868, 2996, 2645, 252, 0, 180,
+    6498, 4431, 1954, 170, 101, 2712, 5143, 1623, 0, 3546, 4789, 1886, 3603, 0, 87, 4310,
+    3429, 0, 2311, 5105, 296, 0, 219, 3064, 138, 2864, 12, 2854, 95, 27, 2678, 2590,
+    3217, 4656, 3176, 3151, 242, 0, 0, 1896, 2788, 290, 2755, 0, 0, 2270, 0, 0,
+    5967, 0, 180, 2216, 0, 222, 15, 5100, 2501, 3318, 125, 271, 193, 6001, 1982, 2606,
+    2821, 2545, 2470, 5361, 59, 3308, 1605, 2138, 206, 0, 35, 0, 0, 2810, 6387, 4647,
+    0, 2749, 0, 0, 196, 0, 0, 0, 0, 5318, 132, 3261, 221, 26, 213, 5612,
+    2534, 0, 2931, 3326, 5222, 0, 171, 5545, 2423, 122, 0, 4646, 2847, 1956, 195, 318,
+    170, 6203, 267, 5846, 2470, 1820, 179, 120, 2800, 242, 2516, 3800, 4895, 0, 2975, 258,
+    5030, 2591, 232, 3612, 4945, 2094, 2636, 0, 59, 235, 0, 211, 5581, 7147, 2633, 173,
+    0, 0, 6841, 3007, 3117, 6033, 185, 2339, 0, 312, 4236, 3266, 3996, 109, 3216, 3075,
+    2558, 0, 270, 3453, 5801, 6268, 0, 2770, 204, 227, 4656, 3249, 4219, 6422, 2123, 316,
+    2471, 264, 0, 0, 2779, 2468, 4869, 190, 3239, 3073, 1944, 2767, 3285, 2337, 5088, 1602,
+    5229, 2138, 218, 0, 2842, 98, 3647, 0, 0, 4376, 2184, 87, 2864, 5107, 2357, 204,
+    0, 132, 0, 12, 17, 71, 14, 196, 287, 0, 3128, 0, 4275, 3052, 2845, 3788,
+    0, 2578, 2601, 2788, 246, 2967, 232, 2678, 2820, 4321, 6195, 3274, 2567, 59, 208, 2898,
+    0, 2079, 0, 2655, 5335, 1677, 3047, 0, 211, 3194, 290, 6500, 138, 0, 0, 0,
+    3064, 3999, 2734, 2798, 2765, 5194, 2957, 4790, 11, 310, 85, 258, 0, 1640, 122, 0,
+    3095, 3769, 84, 5158, 5370, 0, 2998, 1699, 73, 0, 3549, 3649, 297, 0, 2471, 6714,
+    0, 3462, 2848, 237, 3902, 109, 2606, 288, 174, 2435, 2479, 231, 4647, 1887, 131, 0,
+    1874, 293, 3216, 230, 1763, 311, 2624, 2149, 4498, 0, 0, 276, 1691, 3177, 0, 3299,
+    5471, 19, 5995, 4226, 2944, 0, 2810, 0, 1622, 0, 3216, 63, 26, 0, 2879, 2178,
+    7112, 37, 1824, 0, 5306, 0, 0, 0, 2589, 3065, 2096, 2207, 2538, 185, 0, 0,
+    2700, 180, 2637, 6130, 260, 119, 0, 3199, 97, 223, 6231, 0, 0, 6400, 4094, 2908,
+    2787, 181, 2744, 143, 3218, 2711, 5773, 1708, 3838, 1613, 3107, 274, 170, 5546, 2633, 4747,
+    2865, 0, 0, 2781, 2919, 2834, 142, 5325, 3007, 6081, 155, 3491, 0, 195, 0, 0,
+    3811, 1766, 0, 215, 255, 0, 6301, 0, 5091, 1692, 211, 2988, 3987, 0, 0, 23,
+    0, 2864, 1601, 0, 318, 3663, 0, 1605, 0, 0, 0, 7357, 5749, 6209, 0, 0,
+    3098, 3305, 19, 3052, 196, 2017, 3064, 3185, 2820, 0, 0, 5978, 267, 226, 3018, 0,
+    5166, 0, 170, 4210, 290, 307, 0, 1812, 187, 2965, 1678, 200, 218, 225, 93, 299,
+    5810, 0, 0, 316, 2736, 276, 2480, 0, 2782, 5204, 2690, 5351, 0, 0, 2791, 204,
+    3018, 3381, 169, 232, 73, 0, 1925, 288, 0, 0, 0, 3077, 0, 2470, 2767, 0,
+    2358, 0, 0, 108, 2249, 3063, 1661, 3009, 2550, 3249, 2701, 0, 213, 0, 2996, 4285,
+    0, 0, 0, 3074, 174, 108, 1846, 4278, 1651, 158, 5415, 233, 254, 248, 2822, 271,
+    2878, 3933, 3018, 4658, 2755, 6197, 0, 5142, 0, 2512, 4921, 203, 1942, 3168, 2524, 0,
+    0, 212, 239, 4784, 6480, 2669, 225, 4647, 273, 177, 3107, 27, 3272, 3198, 3567, 0,
+    0, 0, 2614, 2017, 318, 2979, 0, 0, 2987, 4087, 2523, 0, 0, 2974, 252, 266,
+    2711, 13, 5662, 269, 4988, 6151, 2405, 248, 2571, 1612, 4711, 264, 2666, 2645, 5120, 5867,
+    2087, 3315, 293, 2725, 3120, 0, 60, 5317, 245, 2919, 1728, 2986, 2721, 3990, 6246, 2505,
+    0, 0, 51, 3249, 2029, 0, 3988, 2941, 4447, 2600, 5308, 2340, 5379, 180, 0, 2604,
+    3018, 260, 6742, 2567, 0, 0, 2932, 0, 5582, 0, 1607, 5760, 0, 50, 4123, 285,
+    5306, 5327, 1607, 3382, 6075, 0, 2475, 0, 2890, 176, 3217, 6221, 2810, 0, 0, 121,
+    2746, 0, 168, 3185, 2348, 3188, 0, 37, 6132, 2886, 148, 3012, 108, 159, 5936, 274,
+    0, 0, 59, 1601, 6281, 5197, 303, 0, 0, 0, 3262, 0, 4059, 2755, 304, 2942,
+    2525, 227, 5966, 286, 0, 127, 72, 0, 3120, 0, 204, 4225, 2493, 0, 246, 3580,
+    119, 3911, 2655, 5167, 0, 1606, 0, 0, 260, 169, 183, 2767, 100, 0, 145, 0,
+    232, 2831, 0, 123, 2272, 251, 0, 1971, 37, 83, 2336, 195, 0, 225, 3868, 0,
+    5818, 0, 4921, 2471, 0, 39, 0, 2634, 2402, 155, 253, 0, 2881, 0, 2416, 5767,
+    3153, 208, 5144, 1767, 6903, 0, 6744, 4096, 0, 237, 248, 226, 303, 0, 30, 224,
+    3586, 0, 2671, 0, 3824, 1679, 197, 244, 3710, 5476, 5977, 306, 289, 29, 2251, 1602,
+    4101, 0, 2919, 0, 5634, 3031, 2755, 0, 308, 0, 208, 1808, 1614, 2911, 247, 3611,
+    0, 5652, 2645, 0, 2492, 231, 1609, 190, 320, 0, 4674, 263, 200, 3469, 0, 0,
+    0, 0, 5428, 271, 187, 2409, 245, 0, 0, 0, 0, 177, 0, 3063, 0, 2964,
+    277, 4673, 0, 3296, 3360, 2836, 5583, 4263, 176, 5598, 0, 176, 0, 0, 3406, 50,
+    3142, 3106, 2981, 0, 24, 5391, 1607, 5311, 2878, 193, 3187, 5096, 0, 4158, 264, 208,
+    227, 2921, 0, 0, 0, 2866, 3106, 4089, 319, 107, 3382, 2688, 2626, 0, 0, 240,
+    238, 302, 2581, 0, 315, 241, 2748, 273, 0, 1608, 16, 0, 3319, 0, 0, 3337,
+    3262, 3240, 272, 2006, 3184, 0, 1601, 233, 99, 47, 287, 112, 2426, 3767, 4710, 1604,
+    0, 147, 220, 0, 4436, 3117, 4051, 3315, 1744, 5538, 1603, 268, 2908, 4527, 3217, 266,
+    5553, 2350, 5751, 0, 2814, 0, 2095, 143, 4043, 2859, 0, 3888, 0, 3161, 5968, 2008,
+    3777, 0, 160, 3986, 2714, 295, 5096, 4921, 0, 143, 5831, 2502, 5362, 6039, 0, 190,
+    0, 2561, 1742, 314, 0, 0, 2611, 282, 0, 2615, 6021, 0, 0, 0, 0, 241,
+    208, 13, 0, 123, 0, 312, 253, 2987, 185, 0, 3206, 173, 1753, 0, 1603, 2501,
+    2492, 0, 195, 216, 3591, 244, 1600, 2671, 0, 286, 227, 289, 3277, 86, 0, 3295,
+    0, 0, 0, 3317, 0, 0, 0, 83, 3014, 99, 0, 2888, 0, 0, 3108, 0,
+    255, 194, 0, 267, 2887, 2898, 1951, 5598, 0, 3513, 2645, 4686, 2724, 0, 199, 2692,
+    4876, 303, 2536, 2051, 0, 0, 0, 125, 0, 4535, 184, 6471, 0, 177, 264, 5162,
+    0, 2204, 4136, 2768, 0, 6724, 2557, 0, 298, 4886, 1941, 0, 0, 3191, 51, 2291,
+    3689, 0, 313, 1607, 3307, 0, 72, 0, 2219, 3139, 0, 2923, 4216, 0, 1608, 2657,
+    0, 0, 0, 4831, 0, 0, 1602, 171, 3294, 0, 0, 53, 0, 3030, 0, 2821,
+    0, 197, 2921, 310, 100, 234, 4112, 2441, 1810, 2749, 1973, 5560, 224, 299, 2570, 6472,
+    5114, 0, 4065, 2882, 243, 2688, 35, 0, 5009, 3604, 3140, 1745, 284, 269, 2941, 4484,
+    4569, 143, 0, 3602, 40, 3217, 5766, 2884, 134, 302, 1809, 3626, 3031, 0, 0, 0,
+    2028, 2206, 0, 0, 4657, 6052, 321, 0, 2735, 1609, 4564, 0, 0, 2628, 2019, 191,
+    321, 3336, 0, 0, 2138, 221, 3381, 2853, 3084, 3768, 5364, 0, 4648, 108, 0, 5361,
+    313, 2537, 2765, 2839, 280, 4867, 0, 3295, 0, 3319, 0, 5087, 1896, 0, 4646, 0,
+    2273, 0, 2887, 0, 2657, 286, 3231, 127, 2567, 246, 4262, 0, 3032, 0, 3216, 0,
+    4053, 2589, 0, 99, 2008, 2546, 0, 2623, 0, 2168, 2975, 1876, 227, 0, 195, 2789,
+    0, 2545, 144, 3130, 0, 0, 0, 6186, 1603, 2072, 237, 3326, 2976, 262, 2494, 3305,
+    0, 2777, 84, 5608, 1697, 3117, 2094, 6350, 289, 3150, 2594, 3087, 0, 2482, 0, 54,
+    0, 1602, 2953, 0, 228, 2281, 0, 269, 0, 0, 247, 2617, 0, 86, 2914, 0,
+    217, 2771, 0, 2963, 2557, 2889, 2704, 0, 1631, 0, 0, 0, 2769, 2691, 1608, 3267,
+    4427, 0, 0, 4548, 0, 98, 49, 4491, 3691, 3548, 1904, 2657, 2790, 2612, 1754, 2574,
+    12, 0, 110, 4885, 1600, 71, 0, 234, 2563, 25, 6021, 1621, 3054, 269, 5003, 2086,
+    3207, 2986, 2504, 0, 1811, 0, 322, 3030, 5804, 61, 2857, 0, 2974, 5128, 134, 0,
+    2045, 2920, 0, 4662, 247, 1941, 1722, 0, 0, 0, 0, 2512, 187, 0, 5976, 6371,
+    5188, 0, 2021, 2579, 259, 5560, 174, 0, 3239, 231, 4836, 197, 6509, 0, 188, 0,
+    0, 3249, 0, 2031, 0, 2737, 0, 184, 4315, 2538, 0, 3768, 198, 2922, 0, 250,
+    236, 0, 122, 0, 0, 2756, 321, 4650, 231, 305, 0, 0, 76, 0, 1744, 216,
+    276, 0, 3085, 2700, 3029, 1774, 310, 3232, 292, 3683, 3336, 4931, 210, 0, 203, 4580,
+    287, 298, 2282, 2274, 2985, 0, 2947, 0, 0, 1603, 168, 0, 5414, 173, 0, 0,
+    255, 99, 42, 73, 0, 273, 4228, 0, 262, 1622, 254, 0, 4342, 3261, 182, 215,
+    4077, 0, 0, 2622, 3085, 97, 0, 2469, 0, 0, 2777, 0, 0, 309, 247, 2732,
+    3740, 2744, 86, 0, 2726, 175, 4976, 1687, 3107, 2638, 5756, 5847, 83, 3904, 0, 5528,
+    316, 107, 0, 0, 261, 1602, 2712, 1610, 2952, 2515, 2085, 228, 5230, 5087, 0, 239,
+    1604, 0, 2141, 2413, 3087, 2782, 0, 6230, 291, 3294, 2601, 230, 2498, 3390, 0, 2017,
+    0, 1633, 2600, 1755, 0, 3130, 4344, 0, 2515, 3162, 6715, 2791, 3053, 275, 2894, 4021,
+    0, 313, 0, 1787, 3052, 0, 62, 1631, 5015, 3121, 0, 0, 143, 2578, 0, 0,
+    3260, 0, 0, 0, 134, 3205, 2776, 259, 5325, 0, 1600, 201, 1811, 249, 0, 0,
+    4889, 250, 1943, 0, 209, 288, 252, 1874, 2625, 2738, 1940, 2234, 242, 3009, 1898, 316,
+    242, 0, 0, 2766, 0, 2787, 1886, 168, 0, 3557, 0, 2512, 2733, 2547, 2613, 2768,
+    4279, 196, 5854, 2493, 2917, 0, 0, 290, 2482, 1601, 0, 0, 6798, 2723, 0, 48,
+    0, 0, 4652, 0, 2901, 3195, 2022, 2824, 164, 7035, 0, 260, 1978, 0, 0, 223,
+    5224, 3496, 0, 1698, 2813, 2695, 2524, 5803, 206, 207, 0, 210, 167, 282, 2519, 110,
+    3085, 0, 0, 1793, 3341, 4923, 5554, 4822, 0, 3102, 6103, 5985, 105, 1625, 300, 6716,
+    173, 2722, 2113, 0, 5765, 7014, 254, 16, 7218, 0, 0, 2159, 2367, 0, 2930, 3882,
+    0, 61, 171, 1697, 15, 4893, 4042, 247, 2634, 318, 2226, 6414, 3767, 5976, 2635, 1808,
+    4992, 2998, 2506, 5152, 0, 0, 0, 0, 3261, 0, 6251, 5530, 0, 3547, 6241, 0,
+    0, 4466, 2667, 3251, 287, 60, 2088, 90, 3129, 3238, 0, 1605, 6827, 1633, 2724, 2503,
+    178, 1830, 2521, 2308, 0, 0, 2723, 2017, 206, 1885, 3716, 0, 0, 2217, 83, 5662,
+    0, 2603, 4701, 2481, 0, 3399, 2546, 0, 2215, 0, 0, 5746, 3020, 0, 1905, 0,
+    2545, 0, 3084, 3556, 2646, 309, 2504, 3124, 0, 5328, 5627, 5455, 259, 0, 211, 38,
+    0, 2942, 0, 1604, 2798, 3271, 2490, 0, 2235, 5882, 0, 216, 2600, 250, 3273, 315,
+    5591, 2602, 230, 246, 2623, 2619, 0, 3916, 4234, 2529, 2636, 6074, 3327, 263, 2359, 2160,
+    4271, 256, 3176, 316, 59, 2077, 2424, 251, 0, 223, 6889, 2547, 3434, 0, 4666, 0,
+    2821, 2559, 0, 0, 0, 1985, 176, 0, 1607, 1606, 0, 0, 2142, 2479, 0, 2943,
+    4207, 252, 306, 237, 3031, 0, 2773, 2856, 237, 5097, 0, 2787, 1798, 2524, 131, 2756,
+    3260, 3134, 3146, 2975, 1810, 167, 0, 156, 2897, 0, 4922, 1635, 3293, 2866, 2977, 3250,
+    313, 3263, 6115, 5988, 226, 7057, 0, 3851, 202, 6753, 2661, 0, 261, 2710, 1679, 2546,
+    4428, 223, 2338, 3830, 0, 3785, 5889, 183, 2724, 2854, 0, 0, 3206, 0, 0, 3107,
+    2941, 0, 189, 2809, 0, 2875, 0, 2812, 1615, 2656, 2483, 121, 1808, 2757, 254, 193,
+    1821, 3610, 0, 0, 3475, 244, 0, 0, 2699, 2218, 3194, 0, 3129, 0, 3997, 2161,
+    0, 44, 0, 95, 2988, 3173, 2227, 6554, 3547, 1604, 184, 0, 257, 1838, 0, 0,
+    240, 1889, 2998, 2860, 0, 0, 3777, 2581, 5670, 3252, 311, 4265, 0, 2495, 0, 4542,
+    0, 2546, 1961, 277, 0, 2614, 11, 2367, 294, 2999, 0, 6415, 2627, 0, 5626, 2975,
+    2515, 0, 211, 4866, 2545, 0, 3354, 0, 3558, 2150, 6066, 0, 318, 2810, 0, 271,
+    169, 5408, 2483, 0, 206, 1952, 185, 126, 3284, 2713, 215, 0, 0, 1676, 2723, 203,
+    268, 300, 6805, 0, 2358, 2667, 267, 256, 2976, 1878, 1951, 4590, 2523, 6560, 2427, 3329,
+    0, 297, 0, 1678, 230, 0, 0, 0, 3317, 5747, 3970, 1859, 1605, 5810, 0, 0,
+    4218, 3161, 0, 6022, 5098, 301, 0, 4926, 2502, 3219, 2602, 3661, 3062, 0, 4754, 2688,
+    213, 235, 3084, 3206, 3073, 3327, 5826, 214, 3097, 2142, 2861, 267, 107, 4042, 4209, 17,
+    3205, 248, 3045, 0, 0, 0, 0, 174, 5362, 0, 6849, 0, 2832, 2562, 0, 133,
+    276, 216, 3427, 0, 0, 2758, 3274, 1689, 3283, 3019, 87, 3181, 3793, 213, 286, 2997,
+    5526, 5086, 4314, 0, 0, 0, 2932, 172, 2681, 298, 257, 0, 6694, 2208, 27, 0,
+    0, 0, 2501, 2600, 5372, 2974, 2492, 2036, 1912, 2491, 4665, 236, 2542, 121, 131, 0,
+    0, 2754, 0, 0, 270, 3020, 313, 0, 5664, 5317, 2584, 0, 0, 2281, 1681, 4879,
+    6611, 2592, 2557, 0, 3552, 0, 0, 0, 315, 226, 2434, 5141, 0, 3401, 139, 299,
+    0, 0, 110, 2415, 0, 2728, 2613, 2490, 5802, 3307, 5250, 3183, 0, 1961, 0, 2658,
+    0, 3347, 0, 0, 2366, 2667, 0, 0, 77, 0, 0, 3252, 0, 5630, 2821, 2628,
+    2545, 318, 4703, 1952, 2516, 7092, 1603, 120, 98, 0, 0, 0, 6068, 4005, 0, 220,
+    314, 1820, 0, 0, 3631, 2714, 6273, 0, 3129, 4930, 2152, 214, 178, 6394, 0, 0,
+    3243, 3621, 5781, 159, 5089, 258, 6565, 2495, 3997, 3329, 4612, 2472, 4754, 4240, 3032, 0,
+    3273, 2865, 0, 299, 2795, 186, 2877, 0, 0, 279, 39, 2988, 2348, 0, 0, 3141,
+    200, 2887, 3395, 220, 2604, 0, 2336, 275, 190, 2418, 95, 281, 5365, 4206, 253, 3776,
+    2724, 0, 0, 61, 1688, 3283, 145, 157, 3272, 0, 2633, 2141, 107, 4718, 0, 3272,
+    2662, 0, 0, 3008, 3331, 0, 0, 1942, 0, 0, 2526, 5590, 186, 0, 308, 2745,
+    208, 2613, 1743, 276, 2985, 248, 2668, 2623, 257, 222, 3066, 1880, 4667, 5086, 2176, 2038,
+    23, 6202, 292, 3139, 38, 4370, 220, 2702, 2580, 1641, 2557, 322, 0, 0, 0, 2037,
+    0, 2612, 2589, 271, 0, 2208, 3088, 5334, 5537, 3062, 310, 0, 2347, 0, 283, 0,
+    2754, 0, 4506, 0, 7008, 3263, 107, 1706, 3296, 90, 2689, 0, 2596, 313, 0, 2963,
+    267, 0, 3282, 2349, 2405, 5051, 3183, 5319, 4041, 0, 0, 224, 212, 6025, 187, 1606,
+    0, 3131, 27, 2614, 0, 0, 0, 2778, 2663, 2955, 0, 0, 101, 0, 0, 185,
+    174, 121, 146, 2524, 2942, 0, 98, 12, 0, 114, 3700, 1624, 0, 5969, 300, 4526,
+    243, 2875, 1952, 3007, 3249, 0, 0, 3096, 162, 1764, 1606, 0, 2974, 213, 6032, 0,
+    0, 0, 0, 0, 5002, 3099, 273, 4372, 3822, 5540, 1941, 274, 0, 197, 2998, 239,
+    308, 1608, 308, 5774, 0, 0, 0, 5272, 0, 0, 0, 3056, 96, 2820, 4150, 3175,
+    180, 186, 2943, 5407, 3996, 187, 0, 0, 2217, 0, 266, 3152, 0, 236, 2887, 5979,
+    0, 5759, 4014, 122, 4763, 86, 191, 0, 0, 4870, 233, 3779, 5594, 0, 2608, 2579,
+    0, 0, 0, 3293, 0, 2514, 0, 2578, 3349, 0, 2700, 6274, 3069, 3261, 3986, 132,
+    0, 0, 0, 2612, 0, 0, 208, 4725, 276, 0, 3307, 2968, 2875, 1690, 0, 1621,
+    5910, 73, 5750, 2759, 273, 1895, 4252, 221, 0, 0, 2093, 75, 6883, 190, 3987, 2490,
+    3089, 2404, 2931, 0, 0, 0, 1755, 182, 38, 0, 4308, 0, 2635, 1718, 2474, 2603,
+    39, 2943, 316, 3271, 3573, 2886, 5641, 1602, 2207, 4702, 5861, 145, 2616, 3184, 144, 2767,
+    7041, 3102, 3316, 5528, 5088, 63, 3220, 2472, 0, 256, 2909, 2968, 2778, 0, 288, 2942,
+    173, 2151, 1942, 1655, 2528, 2644, 2413, 143, 0, 2010, 36, 3075, 3263, 275, 234, 2613,
+    2666, 48, 98, 256, 0, 0, 0, 0, 0, 3183, 2989, 64, 6195, 2497, 2204, 5547,
+    0, 0, 0, 0, 3052, 1600, 1763, 1606, 3151, 2706, 3232, 188, 2648, 0, 4931, 249,
+    0, 4151, 2716, 0, 4437, 2341, 2875, 51, 2105, 5336, 0, 2655, 71, 26, 2242, 4016,
+    170, 287, 3104, 2027, 0, 0, 3766, 0, 232, 0, 0, 0, 181, 3175, 3109, 2406,
+    2743, 4490, 5994, 224, 2803, 0, 3822, 276, 2018, 243, 2548, 3546, 0, 3998, 0, 2301,
+    0, 2536, 4886, 1886, 0, 3989, 3119, 2308, 3296, 3866, 176, 0, 260, 0, 1875, 2849,
+    131, 2524, 1888, 2649, 3426, 0, 0, 226, 1979, 269, 1601, 0, 191, 0, 0, 3231,
+    3304, 285, 289, 2879, 0, 6320, 212, 1609, 2955, 28, 2835, 200, 2831, 1611, 75, 2732,
+    223, 0, 0, 0, 0, 300, 116, 6136, 3197, 5306, 0, 0, 0, 0, 5635, 234,
+    1621, 0, 3242, 5776, 0, 2637, 180, 2093, 0, 28, 2876, 0, 7350, 4094, 38, 0,
+    1710, 0, 234, 2635, 2787, 0, 41, 7020, 272, 0, 3304, 2484, 0, 5171, 3987, 3118,
+    229, 2494, 209, 2209, 0, 215, 6102, 3251, 1830, 3141, 5531, 171, 2878, 1754, 310, 2381,
+    3140, 1951, 273, 2834, 2618, 259, 5529, 3878, 6188, 2854, 2762, 4439, 2789, 0, 2942, 6832,
+    6067, 4445, 2734, 0, 1657, 0, 0, 2529, 0, 3238, 256, 0, 1606, 0, 0, 0,
+    4704, 2869, 0, 0, 5746, 2778, 47, 0, 4878, 235, 0, 1922, 2249, 0, 3260, 0,
+    3297, 2820, 0, 2886, 1970, 1765, 3151, 2655, 0, 0, 0, 2072, 0, 2293, 2007, 249,
+    2512, 0, 4427, 3119, 2647, 0, 0, 3271, 3566, 2357, 0, 170, 51, 0, 6943, 219,
+    0, 2284, 0, 0, 3009, 288, 0, 317, 3222, 0, 2985, 2547, 43, 2075, 0, 0,
+    4272, 0, 0, 2550, 3140, 176, 1677, 0, 2571, 269, 2009, 0, 4681, 0, 246, 3315,
+    2935, 2235, 2889, 0, 0, 0, 0, 4286, 0, 3989, 4270, 0, 0, 3052, 0, 3436,
+    2977, 6358, 3042, 296, 0, 184, 3031, 1757, 5141, 1991, 243, 1607, 0, 299, 0, 2524,
+    3383, 79, 3051, 250, 3120, 2479, 4130, 5406, 3131, 0, 6687, 0, 177, 4970, 2270, 4217,
+    3197, 0, 2505, 6166, 2600, 2343, 4010, 5647, 1829, 307, 0, 4428, 102, 3821, 3084, 3304,
+    318, 2316, 0, 3129, 5933, 0, 0, 305, 2746, 5370, 0, 264, 6110, 2941, 85, 1611,
+    281, 3074, 5849, 1603, 0, 231, 189, 60, 43, 4747, 0, 3991, 2876, 0, 63, 95,
+    3042, 2503, 2084, 4058, 156, 4446, 12, 133, 244, 2076, 0, 2007, 2668, 192, 5966, 4225,
+    184, 0, 291, 85, 3785, 0, 222, 0, 12, 4426, 205, 2169, 0, 2633, 4721, 97,
+    0, 0, 5106, 2534, 2601, 0, 4877, 2854, 3601, 1677, 3231, 217, 2979, 0, 3217, 1746,
+    3001, 3051, 6066, 1962, 309, 2292, 0, 169, 0, 0, 204, 321, 0, 0, 2891, 0,
+    0, 3306, 0, 0, 0, 122, 0, 3010, 0, 0, 0, 0, 2484, 3165, 2853, 3131,
+    2494, 0, 2832, 0, 2650, 3051, 5599, 158, 171, 59, 3559, 0, 272, 2788, 2886, 3870,
+    0, 145, 0, 4217, 1951, 235, 256, 0, 306, 0, 0, 89, 121, 0, 3293, 0,
+    2693, 249, 1971, 6811, 2903, 0, 0, 202, 2009, 2479, 203, 242, 230, 0, 0, 281,
+    37, 0, 0, 0, 2776, 251, 2469, 255, 5810, 50, 3909, 0, 3655, 2414, 2161, 0,
+    0, 238, 0, 5819, 2924, 3224, 288, 4974, 2085, 0, 2900, 305, 2908, 185, 6689, 0,
+    2602, 1953, 2270, 0, 2721, 5757, 5584, 2913, 4596, 0, 3275, 2668, 5141, 3019, 270, 2523,
+    4923, 1611, 5444, 1649, 4430, 0, 2006, 2809, 47, 3930, 2205, 0, 4866, 180, 48, 2580,
+    2748, 85, 3794, 3084, 5096, 203, 0, 0, 315, 246, 132, 1832, 4675, 3205, 320, 12,
+    3428, 107, 3261, 3317, 3098, 3166, 4208, 0, 28, 225, 3823, 99, 2075, 0, 6477, 0,
+    170, 0, 1819, 0, 4880, 2044, 5373, 52, 2570, 0, 199, 6470, 5410, 2479, 4261, 2423,
+    3236, 0, 2901, 0, 2624, 0, 59, 1603, 3140, 2965, 0, 3262, 0, 237, 2735, 2932,
+    3174, 232, 0, 3274, 0, 3339, 59, 0, 5087, 0, 2310, 0, 1967, 220, 3206, 110,
+    2615, 0, 2454, 2754, 2296, 0, 0, 0, 4646, 2747, 3306, 1913, 84, 5536, 13, 3318,
+    1955, 3041, 174, 3601, 0, 5545, 122, 2375, 1874, 2516, 4051, 2086, 0, 247, 2468, 298,
+    2958, 5813, 158, 5327, 2605, 0, 1820, 0, 0, 198, 6030, 0, 171, 24, 2811, 0,
+    2845, 258, 2558, 4482, 2534, 309, 3603, 1876, 202, 2721, 0, 5611, 3036, 6267, 3041, 0,
+    0, 168, 6194, 2844, 2636, 291, 264, 2013, 3084, 3079, 3139, 0, 0, 0, 5361, 3582,
+    2348, 0, 0, 2605, 52, 253, 223, 61, 2952, 2756, 5977, 214, 4981, 0, 204, 0,
+    0, 2351, 2634, 2337, 0, 0, 0, 0, 0, 0, 3787, 185, 3166, 4868, 1944, 6389,
+    109, 211, 0, 0, 0, 308, 2572, 218, 2668, 2633, 2853, 179, 3019, 5187, 0, 0,
+    286, 2283, 0, 0, 101, 211, 242, 0, 1748, 3000, 2954, 3128, 2057, 0, 2160, 3603,
+    203, 0, 312, 3449, 2956, 0, 2053, 0, 0, 5086, 246, 2936, 2776, 6519, 3055, 3385,
+    5766, 202, 0, 0, 0, 0, 6204, 40, 2904, 11, 12, 261, 2812, 1914, 303, 0,
+    2833, 290, 296, 3172, 85, 0, 3769, 3052, 0, 148, 4789, 7097, 0, 2864, 2216, 3172,
+    1875, 3240, 124, 2479, 0, 3216, 1699, 0, 0, 0, 0, 3648, 263, 288, 4537, 3040,
+    0, 0, 1874, 0, 2780, 2909, 0, 2964, 84, 2655, 244, 3398, 2468, 73, 1642, 3462,
+    2205, 310, 279, 0, 2868, 7272, 2712, 293, 24, 2432, 0, 0, 288, 0, 3605, 214,
+    243, 1957, 0, 3007, 3254, 4206, 2168, 2944, 3165, 1623, 178, 149, 174, 5105, 296, 1941,
+    3176, 3041, 1823, 2996, 0, 3305, 0, 6351, 180, 4483, 5320, 4746, 3838, 0, 2847, 197,
+    0, 0, 2655, 0, 0, 0, 3205, 6683, 1780, 4262, 2416, 5143, 2996, 3088, 119, 102,
+    0, 168, 6034, 4975, 0, 60, 6081, 2639, 0, 2138, 108, 3807, 4710, 5361, 155, 5980,
+    2974, 128, 2607, 215, 0, 3565, 5422, 263, 0, 0, 3951, 0, 0, 2591, 0, 0,
+    0, 4871, 3230, 0, 0, 0, 2287, 298, 286, 0, 86, 29, 3107, 60, 1691, 242,
+    0, 1602, 0, 4945, 169, 5758, 221, 0, 257, 0, 2853, 2502, 2637, 2636, 5749, 170,
+    1601, 2834, 5308, 1812, 3986, 2969, 37, 260, 0, 0, 3018, 5987, 66, 5801, 5033, 5546,
+    2374, 2480, 241, 3058, 0, 2845, 3120, 0, 4327, 190, 186, 6231, 1676, 0, 4381, 271,
+    4086, 144, 3018, 2677, 5316, 3172, 316, 0, 274, 2931, 195, 7163, 3353, 3119, 0, 203,
+    6187, 0, 3009, 0, 307, 1896, 0, 0, 2771, 296, 0, 0, 0, 3080, 2567, 2779,
+    2953, 3075, 5158, 0, 0, 5415, 2151, 2701, 108, 173, 0, 0, 301, 3650, 11, 2468,
+    2820, 204, 169, 0, 98, 2242, 1643, 3052, 1874, 4938, 2275, 236, 0, 2403, 1773, 3490,
+    2867, 0, 322, 2658, 197, 2655, 6245, 5113, 1600, 84, 0, 297, 5968, 6721, 4783, 2864,
+    6714, 2843, 5110, 2338, 5546, 7277, 3114, 177, 6196, 1941, 66, 2170, 0, 119, 108, 2128,
+    271, 3220, 214, 248, 3194, 2877, 0, 0, 231, 317, 2777, 2622, 262, 6368, 0, 132,
+    2405, 297, 248, 2998, 0, 4946, 3177, 0, 4453, 2919, 3575, 131, 2823, 2667, 0, 2538,
+    5746, 3196, 249, 3100, 3771, 1701, 52, 4900, 2637, 196, 4712, 3271, 2505, 276, 1887, 263,
+    0, 0, 3464, 1610, 136, 3173, 0, 0, 3029, 271, 2725, 0, 5582, 2801, 2849, 0,
+    2592, 0, 2985, 292, 0, 279, 2604, 0, 174, 4350, 2996, 3391, 2792, 5309, 179, 1622,
+    3120, 0, 2959, 4502, 1846, 4657, 0, 5306, 234, 0, 245, 4701, 2625, 0, 175, 2911,
+    3239, 260, 160, 1885, 0, 232, 223, 49, 3253, 2518, 5443, 6131, 2746, 0, 2834, 5627,
+    0, 4095, 1607, 148, 222, 2799, 5364, 2910, 0, 5912, 3230, 0, 5527, 2163, 5150, 0,
+    0, 1753, 2787, 215, 2525, 0, 222, 2337, 2539, 286, 3022, 2008, 274, 6083, 2952, 2154,
+    23, 5971, 0, 2560, 2336, 2865, 1678, 6075, 169, 210, 2791, 2870, 291, 2783, 4050, 3199,
+    1789, 121, 3186, 3052, 3260, 0, 1600, 4939, 4749, 220, 74, 0, 2820, 6953, 126, 3676,
+    4212, 157, 2825, 2851, 0, 3168, 1666, 290, 6350, 62, 1706, 1613, 190, 0, 3550, 1814,
+    29, 0, 2655, 226, 208, 6763, 0, 1766, 0, 179, 0, 0, 3009, 143, 197, 3084,
+    3142, 2766, 2512, 5545, 3153, 278, 5803, 225, 281, 0, 0, 2408, 3223, 2336, 0, 0,
+    2250, 285, 6217, 2611, 0, 3568, 2492, 3315, 208, 1940, 0, 2739, 0, 2358, 132, 0,
+    236, 2680, 2660, 2922, 1743, 4291, 2300, 0, 3106, 0, 4761, 244, 200, 2143, 249, 3095,
+    2802, 6247, 0, 212, 227, 2669, 0, 4281, 263, 2581, 1970, 3074, 5120, 293, 2505, 4713,
+    2551, 0, 0, 3051, 0, 3501, 0, 3024, 5142, 0, 0, 2964, 216, 2600, 2491, 0,
+    3405, 229, 3153, 0, 2997, 3095, 5427, 4659, 218, 318, 1617, 177, 7243, 0, 0, 3198,
+    179, 2614, 4658, 2579, 5583, 0, 4088, 0, 0, 3173, 0, 3831, 86, 4125, 2930, 218,
+    5417, 2981, 167, 3245, 0, 275, 171, 260, 264, 0, 0, 49, 131, 0, 319, 6157,
+    2383, 5538, 3024, 3227, 3185, 3019, 3099, 0, 2776, 5527, 3195, 60, 5591, 2788, 293, 5152,
+    1612, 2876, 2963, 2980, 0, 2507, 176, 0, 2204, 2877, 274, 5380, 2945, 2183, 3043, 2604,
+    0, 218, 4060, 3095, 2611, 3260, 0, 2725, 3317, 1679, 1742, 2727, 169, 4233, 4463, 4701,
+    53, 0, 0, 3217, 0, 6039, 2941, 35, 143, 2601, 3013, 0, 308, 0, 5748, 6359,
+    4885, 1607, 1714, 0, 2908, 155, 143, 2748, 5456, 13, 3346, 2615, 283, 4527, 0, 2892,
+    3682, 5966, 4648, 6024, 123, 303, 3611, 2966, 0, 2569, 0, 0, 97, 23, 3587, 293,
+    2480, 278, 0, 6077, 0, 2534, 3731, 159, 64, 2986, 2424, 0, 246, 59, 0, 0,
+    0, 2074, 0, 0, 0, 2832, 5896, 1602, 121, 202, 0, 2699, 0, 2496, 2007, 145,
+    236, 0, 0, 6919, 0, 2493, 39, 155, 2303, 3307, 0, 1600, 307, 3095, 1972, 0,
+    85, 1839, 0, 5818, 0, 285, 0, 237, 3471, 0, 2479, 2159, 225, 97, 207, 1772,
+    2219, 306, 0, 0, 2491, 229, 2801, 2941, 2601, 293, 2681, 253, 0, 5583, 0, 0,
+    0, 1604, 2593, 299, 2644, 3293, 4043, 5482, 3117, 86, 3019, 302, 0, 2692, 1602, 2838,
+    2925, 2912, 4108, 308, 0, 0, 3848, 2821, 4013, 2480, 197, 212, 0, 1822, 2672, 2416,
+    2480, 3361, 2492, 144, 0, 286, 2831, 319, 3625, 2748, 0, 2581, 320, 2626, 0, 2703,
+    6575, 2570, 1608, 3110, 4427, 2656, 0, 0, 234, 0, 2103, 3100, 48, 107, 3238, 0,
+    0, 2568, 40, 6556, 3194, 0, 1607, 2840, 2426, 2627, 297, 1602, 1809, 3319, 23, 0,
+    269, 0, 0, 2909, 2028, 275, 4811, 0, 211, 6051, 2953, 11, 4052, 229, 0, 0,
+    2735, 2336, 185, 2986, 5090, 0, 0, 5222, 0, 2846, 245, 269, 0, 6360, 2471, 2646,
+    6471, 5099, 0, 0, 1878, 3030, 2921, 2754, 6239, 241, 2514, 2567, 315, 16, 3139, 251,
+    2689, 0, 147, 35, 0, 3830, 0, 2535, 172, 1876, 4646, 3776, 5590, 2017, 48, 2271,
+    2601, 1943, 3043, 160, 0, 321, 220, 0, 2347, 0, 126, 4429, 3317, 3326, 4563, 0,
+    3229, 207, 2562, 259, 5836, 1606, 0, 0, 4649, 2273, 3184, 181, 3261, 47, 3112, 0,
+    6041, 4216, 112, 0, 2611, 0, 2806, 2206, 97, 0, 3150, 2159, 0, 4045, 5147, 2350,
+    0, 1856, 3086, 4529, 4207, 2616, 0, 3019, 2583, 312, 0, 2790, 156, 2490, 3278, 286,
+    247, 98, 0, 0, 0, 0, 0, 0, 253, 0, 0, 239, 0, 0, 0, 2889,
+    0, 3777, 3874, 0, 3128, 96, 0, 2036, 76, 53, 2673, 2691, 2702, 151, 179, 0,
+    25, 1600, 1904, 0, 2102, 36, 1945, 0, 314, 1782, 3073, 0, 2221, 270, 312, 4491,
+    4006, 0, 4832, 2573, 0, 4876, 198, 1600, 0, 2758, 2974, 0, 0, 6646, 3627, 3112,
+    2856, 2513, 199, 307, 3205, 0, 240, 0, 0, 4306, 262, 5780, 2888, 303, 1721, 3144,
+    228, 4968, 305, 2512, 0, 0, 298, 6505, 0, 1621, 1687, 5582, 0, 2887, 0, 0,
+    5316, 133, 174, 2030, 320, 0, 0, 299, 2492, 35, 0, 0, 0, 144, 0, 0,
+    156, 234, 2191, 1838, 217, 287, 5537, 2771, 2274, 302, 5711, 2512, 0, 244, 302, 302,
+    310, 2996, 197, 0, 2692, 0, 0, 2514, 2404, 2444, 218, 2623, 5528, 0, 0, 2921,
+    3294, 48, 3227, 2946, 2177, 4073, 0, 1962, 231, 0, 0, 251, 194, 1941, 4922, 0,
+    4227, 88, 0, 2947, 245, 313, 0, 0, 3241, 3326, 4576, 86, 5222, 173, 0, 0,
+    0, 3903, 5847, 3085, 168, 1608, 0, 0, 4756, 0, 0, 6353, 0, 0, 2513, 0,
+    2150, 0, 97, 2469, 0, 0, 0, 3261, 272, 0, 253, 108, 2601, 2638, 2689, 0,
+    0, 239, 0, 4719, 83, 1603, 0, 4648, 1687, 0, 1602, 96, 0, 3161, 5010, 0,
+    2094, 210, 41, 205, 1742, 230, 92, 0, 295, 0, 3107, 0, 5526, 1829, 6232, 0,
+    0, 0, 2857, 47, 0, 286, 2920, 2482, 5967, 2139, 0, 2039, 2791, 0, 0, 222,
+    1946, 0, 3793, 2498, 6686, 2908, 305, 0, 300, 0, 0, 2858, 3216, 2104, 271, 0,
+    2513, 4343, 1895, 0, 193, 0, 241, 283, 144, 0, 0, 5325, 0, 2575, 6186, 3260,
+    5086, 3121, 4877, 7009, 4020, 3766, 2083, 2930, 5530, 0, 2274, 3119, 3282, 0, 0, 3113,
+    2600, 0, 0, 1631, 1754, 0, 3087, 0, 267, 5316, 107, 0, 3427, 1886, 0, 78,
+    0, 3839, 136, 0, 2813, 2737, 0, 2823, 2225, 155, 2691, 240, 250, 2694, 2612, 2512,
+    1978, 0, 0, 2634, 234, 6007, 199, 2021, 4261, 3294, 0, 3139, 59, 1847, 2546, 0,
+    0, 5004, 2901, 0, 3392, 322, 2538, 2835, 197, 0, 1600, 0, 1621, 3227, 0, 4493,
+    6715, 76, 4818, 5765, 2404, 2502, 5712, 1941, 3195, 1963, 0, 0, 5231, 183, 3208, 2339,
+    48, 5189, 3040, 2480, 0, 274, 4731, 0, 0, 3007, 0, 2966, 0, 0, 3054, 1809,
+    0, 5756, 0, 171, 0, 4773, 2976, 190, 0, 5976, 0, 83, 0, 0, 0, 3840,
+    1808, 2600, 7037, 5539, 216, 3881, 0, 2098, 0, 4932, 1687, 1775, 0, 0, 0, 4426,
+    2292, 217, 0, 0, 0, 0, 6233, 3029, 3051, 96, 5747, 3128, 3161, 0, 0, 208,
+    0, 291, 6826, 1808, 1742, 188, 3619, 2990, 0, 317, 0, 239, 132, 2722, 1885, 0,
+    0, 4345, 6068, 276, 3123, 2506, 1605, 47, 295, 2658, 192, 0, 277, 5882, 2966, 4878,
+    167, 146, 4867, 0, 231, 0, 3390, 0, 0, 0, 0, 2215, 3175, 2534, 0, 2293,
+    2557, 5627, 2733, 2666, 2413, 0, 0, 2812, 2479, 3228, 4271, 2270, 0, 5847, 318, 0,
+    0, 0, 3087, 3129, 2623, 211, 0, 230, 3184, 111, 2545, 3271, 4307, 0, 1604, 89,
+    2150, 182, 192, 3264, 2512, 1755, 6800, 262, 4666, 2788, 1877, 0, 6387, 3441, 2469, 191,
+    0, 2696, 2602, 3381, 2011, 0, 3546, 0, 0, 294, 2952, 0, 135, 6030, 230, 2528,
+    256, 237, 183, 0, 193, 2897, 0, 2880, 3557, 2501, 2776, 215, 313, 1607, 2204, 0,
+    265, 0, 62, 1794, 2824, 1600, 1604, 2975, 2856, 0, 4869, 2659, 3219, 3206, 3145, 1940,
+    0, 2766, 4455, 3154, 6679, 1954, 15, 3208, 0, 6749, 252, 0, 2739, 2854, 143, 2234,
+    0, 3040, 2338, 0, 2757, 5985, 0, 0, 201, 0, 149, 3654, 6414, 296, 1809, 2547,
+    5406, 219, 196, 2206, 0, 0, 2864, 3174, 2941, 0, 0, 0, 1808, 2537, 0, 0,
+    2140, 112, 0, 4426, 3299, 2741, 5530, 0, 2206, 0, 290, 0, 250, 1676, 2635, 0,
+    1745, 2537, 223, 2634, 0, 5121, 2470, 6104, 4736, 4264, 6256, 203, 1848, 318, 206, 2812,
+    2273, 0, 121, 0, 5697, 0, 0, 3051, 311, 3833, 259, 235, 5371, 25, 2842, 0,
+    3411, 2800, 0, 0, 0, 0, 2367, 5626, 3241, 0, 0, 7231, 2600, 2627, 25, 0,
+    1830, 2931, 171, 2579, 0, 0, 2485, 5810, 2534, 0, 0, 1634, 281, 1980, 0, 2713,
+    0, 2855, 2516, 210, 229, 2413, 2270, 2930, 3228, 0, 2284, 1978, 5846, 2556, 297, 0,
+    4656, 1708, 3046, 3251, 2963, 318, 5153, 3612, 1951, 1886, 0, 273, 1613, 4893, 2513, 1604,
+    1636, 6837, 4271, 2603, 4314, 2139, 0, 1819, 2822, 3442, 2502, 4235, 5746, 2711, 209, 3315,
+    215, 3084, 4218, 3089, 2627, 3073, 2490, 262, 6031, 0, 6693, 5201, 2790, 0, 4665, 1909,
+    0, 211, 0, 25, 0, 193, 296, 2657, 2758, 2952, 0, 0, 5460, 3129, 2138, 302,
+    173, 2481, 1987, 2612, 6420, 301, 2235, 2541, 2842, 3158, 192, 2934, 3786, 3219, 1715, 298,
+    0, 4273, 6499, 107, 14, 95, 246, 287, 3106, 248, 3283, 0, 0, 87, 3273, 2602,
+    2479, 0, 0, 185, 291, 2967, 2569, 6195, 0, 2788, 230, 59, 2140, 2606, 135, 17,
+    63, 183, 236, 0, 2078, 77, 5362, 3383, 138, 85, 0, 2434, 4541, 1808, 0, 0,
+    3345, 2160, 2216, 2776, 2900, 262, 3327, 2547, 0, 131, 0, 237, 257, 2543, 2842, 2934,
+    121, 3150, 0, 3266, 1677, 2810, 3902, 6120, 0, 2027, 2471, 1841, 0, 271, 4498, 5317,
+    2977, 0, 2842, 202, 0, 0, 196, 0, 2633, 4656, 3008, 4428, 2898, 0, 2486, 5802,
+    2556, 307, 6393, 0, 5629, 2745, 1640, 2798, 2592, 5892, 2821, 2658, 0, 0, 0, 2590,
+    167, 2491, 2503, 3366, 0, 2944, 0, 4226, 266, 0, 290, 1603, 0, 0, 3556, 0,
+    210, 0, 2831, 112, 2656, 2117, 1819, 0, 6807, 2787, 217, 2891, 1604, 0, 3021, 3194,
+    3613, 157, 5115, 2601, 4094, 2681, 1821, 97, 0, 243, 0, 1698, 0, 2999, 3109, 0,
+    2622, 3216, 11, 3997, 0, 0, 6425, 319, 2348, 2139, 2357, 2714, 3199, 2700, 0, 0,
+    3647, 275, 2722, 0, 211, 6561, 0, 258, 2796, 0, 5773, 136, 0, 5201, 182, 3055,
+    2722, 276, 0, 299, 2501, 3306, 0, 186, 2578, 2515, 2138, 2215, 6209, 0, 0, 0,
+    230, 206, 174, 2216, 5581, 2027, 2403, 0, 0, 2487, 203, 2758, 59, 1879, 23, 210,
+    18, 1743, 3272, 0, 2964, 0, 3139, 5251, 3330, 111, 0, 245, 1919, 0, 89, 175,
+    180, 3048, 0, 225, 5810, 3662, 4703, 301, 0, 5969, 3561, 0, 0, 4665, 0, 3066,
+    3018, 0, 276, 0, 1605, 2651, 3216, 3077, 2208, 0, 3801, 0, 4220, 2469, 3174, 2524,
+    2690, 214, 0, 2902, 0, 189, 3218, 1912, 0, 2161, 2526, 3151, 2595, 0, 4210, 2084,
+    3338, 208, 4966, 3274, 7091, 0, 2736, 0, 218, 2798, 0, 0, 1605, 2843, 2965, 0,
+    213, 0, 0, 2602, 293, 4647, 3875, 2347, 6022, 4505, 170, 1689, 263, 3931, 248, 2722,
+    5086, 3073, 300, 0, 2084, 4005, 2149, 2942, 1624, 0, 2745, 2283, 2111, 3696, 270, 3249,
+    3109, 111, 3565, 2868, 3261, 0, 2612, 4007, 2569, 4782, 0, 6478, 2979, 2721, 3188, 167,
+    139, 1606, 0, 6300, 0, 190, 3767, 3205, 2987, 0, 0, 4921, 0, 3183, 3636, 1648,
+    2366, 0, 2755, 1609, 1605, 0, 3249, 224, 2875, 5812, 312, 0, 3074, 3238, 0, 5317,
+    3056, 2340, 5759, 1727, 0, 312, 0, 2138, 0, 0, 0, 2875, 0, 0, 155, 5319,
+    27, 204, 3064, 281, 2734, 2757, 3262, 0, 257, 0, 0, 11, 0, 0, 0, 0,
+    3167, 3018, 6273, 13, 0, 3097, 3086, 2018, 2514, 2974, 0, 143, 35, 2516, 2215, 3986,
+    297, 3306, 269, 2436, 5977, 1820, 0, 0, 220, 4123, 5593, 3194, 232, 25, 276, 2578,
+    111, 0, 4248, 5252, 304, 100, 0, 3068, 1601, 2886, 73, 4391, 3332, 6210, 91, 2348,
+    311, 5590, 3243, 2152, 2523, 4669, 0, 0, 0, 3000, 2473, 0, 4967, 0, 2877, 2635,
+    0, 2405, 6405, 283, 6882, 2608, 5801, 0, 5861, 0, 115, 0, 2440, 7093, 5195, 253,
+    189, 0, 3766, 2724, 0, 3580, 190, 0, 2634, 0, 5159, 5476, 303, 311, 0, 3868,
+    98, 0, 6279, 0, 1971, 0, 2569, 308, 0, 0, 2843, 0, 2989, 0, 2205, 4868,
+    0, 198, 5547, 2204, 208, 3316, 5969, 1641, 248, 0, 1810, 0, 293, 222, 2705, 5086,
+    4702, 2149, 4795, 0, 30, 219, 0, 0, 1688, 5767, 2124, 2528, 2680, 64, 3109, 2612,
+    4150, 0, 4026, 243, 0, 5916, 202, 283, 0, 5335, 3250, 2757, 6743, 3052, 1942, 5634,
+    1897, 2908, 3769, 0, 3063, 107, 0, 181, 0, 24, 2635, 3469, 108, 0, 176, 2648,
+    2985, 2743, 37, 267, 0, 249, 3287, 3218, 0, 3106, 2755, 0, 5321, 1888, 0, 3059,
+    0, 2954, 187, 0, 2811, 104, 155, 0, 2018, 288, 3426, 2074, 2842, 0, 2227, 0,
+    233, 5979, 4263, 2655, 2301, 2831, 3282, 0, 0, 146, 1601, 274, 176, 3187, 2699, 2546,
+    3066, 266, 4156, 2761, 2523, 3304, 0, 0, 0, 3987, 0, 2835, 6316, 2944, 1764, 213,
+    3822, 73, 5526, 299, 2970, 1608, 312, 0, 3996, 3305, 0, 3382, 120, 3209, 1964, 0,
+    4481, 2483, 4087, 241, 168, 233, 3229, 0, 0, 3007, 5775, 0, 168, 117, 0, 2732,
+    0, 3012, 2374, 2976, 0, 0, 4966, 0, 6087, 0, 2007, 143, 0, 2406, 2447, 4791,
+    0, 3239, 1693, 3986, 2803, 0, 0, 0, 3040, 7156, 0, 3297, 2989, 6067, 2293, 0,
+    1744, 6939, 60, 4951, 2971, 3130, 3240, 0, 2899, 3887, 244, 3183, 242, 6284, 0, 5159,
+    4051, 0, 2876, 0, 0, 4324, 2528, 0, 2502, 0, 2763, 233, 0, 0, 2888, 1812,
+    302, 2402, 190, 2073, 47, 0, 2997, 0, 0, 0, 0, 208, 266, 2889, 177, 0,
+    0, 4702, 231, 2722, 0, 5751, 4427, 0, 225, 2686, 1676, 3295, 95, 3178, 0, 0,
+    2886, 2072, 2243, 215, 264, 2647, 2666, 3271, 3009, 3277, 3140, 2207, 3071, 172, 5761, 0,
+    2710, 4680, 0, 0, 2919, 2871, 0, 294, 0, 0, 0, 0, 0, 2476, 0, 2151,
+    1753, 234, 4285, 0, 176, 0, 3511, 0, 2645, 3106, 2536, 2953, 171, 0, 72, 1605,
+    1609, 0, 0, 6680, 6722, 6038, 5526, 2935, 2018, 12, 2749, 1961, 0, 0, 0, 3435,
+    68, 256, 1763, 2688, 3230, 5415, 0, 2777, 233, 0, 3711, 1607, 36, 2007, 26, 266,
+    1610, 0, 312, 0, 0, 0, 4931, 4129, 72, 3282, 2822, 0, 0, 283, 3220, 2657,
+    288, 2272, 244, 3142, 3211, 301, 284, 51, 0, 1601, 2342, 0, 0, 262, 281, 0,
+    2548, 0, 205, 0, 2387, 6137, 0, 181, 3129, 314, 0, 2141, 2635, 4002, 2204, 2667,
+    243, 0, 148, 2568, 3164, 0, 1896, 5406, 224, 3990, 5385, 4102, 5105, 0, 2743, 4065,
+    0, 5598, 2503, 1885, 4436, 3196, 72, 134, 4657, 83, 195, 0, 3173, 0, 2837, 111,
+    4161, 2789, 2601, 4886, 0, 0, 2941, 1745, 4535, 246, 3097, 5172, 1608, 4426, 2591, 0,
+    0, 0, 2765, 0, 1602, 0, 0, 0, 3308, 237, 31, 0, 0, 5361, 0, 2073,
+    0, 4041, 0, 309, 2292, 0, 3242, 3033, 5693, 2735, 0, 85, 2402, 0, 0, 4706,
+    0, 0, 305, 191, 147, 0, 3381, 2624, 3229, 0, 0, 0, 194, 227, 0, 1680,
+    0, 2282, 2876, 2256, 0, 289, 3337, 2899, 222, 1609, 5855, 5560, 2853, 0, 229, 231,
+    5819, 6066, 273, 3549, 4562, 288, 0, 54, 0, 121, 2633, 0, 0, 4445, 72, 6699,
+    0, 4287, 4930, 1951, 1875, 223, 176, 157, 3516, 5607, 0, 0, 3106, 0, 5804, 171,
+    0, 2889, 3293, 0, 6194, 1768, 0, 32, 6045, 2803, 5584, 2657, 3163, 224, 0, 2660,
+    2558, 2649, 2494, 0, 2007, 2822, 0, 36, 6358, 0, 238, 3267, 2414, 0, 311, 3228,
+    2553, 258, 5801, 0, 2140, 183, 2913, 60, 2922, 4547, 0, 2504, 4427, 63, 2891, 0,
+    2688, 0, 2006, 2769, 0, 4315, 0, 259, 2647, 113, 3150, 2809, 2083, 173, 2679, 48,
+    3321, 180, 2986, 3785, 143, 0, 3224, 221, 0, 0, 71, 1697, 2453, 2143, 3019, 4674,
+    0, 278, 193, 0, 5409, 0, 3690, 4066, 2045, 4885, 0, 0, 192, 0, 3992, 236,
+    2073, 3173, 2217, 2503, 284, 2300, 3051, 203, 1609, 3821, 2935, 0, 3086, 2568, 3311, 0,
+    0, 184, 3054, 2029, 4660, 246, 3384, 216, 4141, 3768, 2591, 5106, 237, 49, 0, 6365,
+    2579, 2534, 250, 0, 2110, 0, 0, 217, 4867, 287, 287, 3336, 170, 0, 2982, 2580,
+    85, 0, 0, 0, 0, 3111, 3298, 2779, 131, 307, 2746, 191, 3273, 0, 3041, 2295,
+    2651, 2947, 0, 4499, 0, 0, 5536, 0, 2624, 1874, 1603, 3601, 2169, 3317, 0, 3646,
+    1953, 2963, 3036, 277, 2679, 255, 0, 2360, 0, 0, 0, 0, 2898, 4342, 2876, 0,
+    0, 0, 2118, 0, 97, 3172, 5009, 0, 188, 0, 3041, 0, 0, 3026, 4216, 6912,
+    1819, 168, 4570, 243, 242, 275, 205, 2638, 296, 1772, 4043, 3055, 1698, 2732, 3163, 2601,
+    2634, 298, 0, 0, 2985, 0, 6021, 171, 0, 0, 1787, 3205, 204, 1943, 0, 1622,
+    2994, 217, 2875, 4225, 24, 0, 168, 2844, 0, 2744, 265, 2768, 2893, 0, 0, 0,
+    3736, 3667, 0, 0, 167, 6230, 232, 2820, 2788, 2496, 245, 3785, 2515, 62, 246, 0,
+    2283, 219, 2732, 3052, 1747, 3294, 2688, 7035, 0, 2653, 3053, 6473, 0, 59, 0, 0,
+    3796, 0, 0, 3936, 0, 0, 2046, 2469, 2956, 3139, 249, 1913, 2085, 4676, 0, 4279,
+    2853, 296, 242, 0, 6030, 286, 0, 252, 50, 0, 2833, 6203, 2281, 3557, 2423, 3430,
+    4887, 170, 0, 203, 2302, 0, 2216, 3172, 0, 3088, 2351, 0, 1811, 261, 4866, 0,
+    2347, 4974, 124, 4490, 2915, 4316, 0, 0, 5854, 2723, 0, 0, 236, 3195, 178, 3264,
+    2701, 321, 4450, 160, 4651, 3086, 0, 0, 1700, 37, 0, 0, 3604, 2549, 259, 0,
+    48, 3238, 2780, 173, 3340, 0, 0, 2750, 219, 2832, 206, 250, 2924, 3827, 4511, 5554,
+    3110, 0, 84, 0, 4206, 6483, 0, 5223, 2219, 237, 254, 0, 1625, 3132, 2567, 2468,
+    2112, 5307, 2423, 207, 0, 23, 3398, 4923, 299, 0, 0, 7217, 201, 0, 5142, 2903,
+    0, 2086, 179, 2150, 5746, 3205, 60, 0, 2159, 5966, 5833, 5096, 55, 4746, 229, 3830,
+    247, 0, 7102, 2954, 0, 281, 0, 0, 0, 3057, 5087, 0, 275, 3096, 298, 0,
+    3163, 236, 0, 2020, 3174, 4207, 2615, 2226, 2506, 222, 3548, 2492, 296, 3778, 2756, 0,
+    220, 13, 0, 0, 6033, 1633, 2149, 28, 2636, 279, 2787, 287, 2517, 4460, 0, 2072,
+    0, 3229, 308, 263, 4701, 2502, 5328, 2898, 0, 1876, 1905, 226, 2770, 242, 23, 287,
+    0, 1609, 72, 0, 2286, 6238, 2732, 4482, 266, 61, 65, 3219, 0, 3565, 2518, 3767,
+    217, 1679, 306, 223, 1944, 168, 5987, 0, 2735, 181, 2481, 0, 0, 320, 4377, 3119,
+    5756, 1600, 0, 5306, 4086, 3210, 0, 0, 2580, 0, 253, 1612, 156, 2062, 2958, 4984,
+    309, 2800, 2634, 0, 2359, 3079, 0, 0, 2931, 264, 231, 1985, 2677, 0, 3293, 169,
+    0, 4491, 3162, 144, 3770, 2724, 103, 203, 0, 5662, 4922, 251, 0, 3915, 0, 2028,
+    2856, 65, 265, 56, 173, 198, 0, 6888, 2823, 2930, 2701, 1642, 2897, 74, 3134, 2809,
+    2844, 0, 254, 0, 1810, 3085, 312, 3114, 0, 316, 0, 1838, 2275, 0, 2843, 3251,
+    6535, 0, 6187, 0, 202, 0, 0, 5235, 2655, 2622, 3133, 0, 2337, 202, 0, 3547,
+    252, 2646, 0, 5766, 5889, 0, 4206, 2548, 0, 3176, 40, 3845, 7273, 1626, 2866, 14,
+    1615, 2656, 4748, 2809, 3096, 3052, 0, 0, 5966, 3218, 3838, 2019, 5143, 3606, 307, 249,
+    2242, 3574, 3018, 0, 1899, 2525, 0, 1889, 0, 36, 2076, 244, 132, 280, 309, 257,
+    0, 3209, 1604, 3463, 3008, 2227, 2812, 3020, 6805, 2493, 0, 4262, 242, 206, 3173, 107,
+    0, 2733, 2898, 2787, 2403, 120, 0, 160, 2549, 2168, 200, 0, 304, 2949, 3205, 4349,
+    0, 3391, 1961, 136, 0, 2996, 2799, 2999, 298, 0, 263, 0, 5098, 0, 2978, 0,
+    4876, 0, 23, 153, 223, 2590, 0, 2792, 0, 4487, 5670, 0, 7015, 215, 2204, 2964,
+    84, 0, 168, 126, 2483, 2669, 3353, 4977, 148, 2754, 107, 5911, 2658, 156, 108, 3610,
+    3162, 186, 4086, 2638, 0, 3239, 0, 2976, 2525, 49, 0, 245, 5141, 0, 1878, 3251,
+    3162, 0, 0, 67, 316, 4947, 0, 175, 0, 0, 248, 2910, 4050, 5863, 60, 1607,
+    268, 3022, 5378, 3040, 177, 0, 0, 2502, 3132, 2897, 2859, 3152, 3073, 0, 2963, 0,
+    1813, 1662, 5826, 2825, 1853, 0, 300, 0, 0, 2832, 5443, 0, 2755, 0, 0, 2480,
+    0, 213, 4924, 144, 285, 0, 2291, 0, 0, 0, 0, 4438, 0, 179, 2732, 5527,
+    0, 1706, 3400, 1689, 295, 3252, 5989, 3019, 1846, 0, 218, 2540, 2646, 0, 254, 2721,
+    0, 0, 271, 3009, 6198, 2336, 3567, 7239, 2670, 2678, 315, 155, 5536, 3777, 3179, 5408,
+    2492, 0, 3062, 2997, 2953, 0, 200, 278, 1970, 234, 0, 6231, 3260, 3161, 0, 1605,
+    0, 5526, 0, 0, 1890, 2548, 2710, 3497, 1676, 3551, 4712, 212, 2023, 2823, 2551, 236,
+    0, 131, 301, 0, 0, 0, 178, 0, 2867, 206, 5671, 5747, 6727, 301, 3023, 218,
+    123, 0, 2173, 195, 0, 74, 0, 2998, 6038, 6717, 6082, 2491, 3095, 1961, 4042, 2579,
+    5536, 2667, 4754, 3391, 293, 313, 2204, 257, 0, 5527, 2777, 3286, 262, 2628, 2945, 2442,
+    0, 1600, 195, 2980, 263, 3346, 223, 5113, 0, 293, 2810, 157, 2366, 2921, 3201, 2433,
+    0, 3183, 2670, 2871, 0, 2865, 191, 2382, 2622, 6847, 0, 0, 178, 2640, 1756, 2623,
+    2176, 107, 3273, 4240, 233, 1610, 0, 3329, 83, 0, 4097, 0, 3032, 319, 3196, 0,
+    0, 2604, 190, 3097, 2625, 0, 5455, 2525, 1885, 0, 279, 2592, 5993, 0, 3023, 4059,
+    6386, 171, 5387, 3393, 0, 275, 0, 5097, 3166, 1678, 4876, 304, 1714, 2988, 3250, 0,
+    2291, 0, 0, 0, 0, 2833, 2479, 5746, 0, 2794, 3062, 0, 0, 52, 2338, 2006,
+    0, 155, 0, 303, 175, 6024, 275, 0, 2726, 2754, 0, 5365, 0, 0, 226, 3618,
+    1875, 3228, 4667, 0, 294, 2660, 4646, 222, 64, 222, 4942, 7062, 95, 246, 0, 3173,
+    4429, 0, 2677, 1831, 2506, 6076, 2832, 2699, 322, 2644, 2611, 0, 305, 2358, 124, 2495,
+    2680, 5416, 210, 1706, 5089, 0, 4591, 0, 2569, 0, 2416, 0, 220, 2955, 4013, 252,
+    5186, 5581, 237, 2827, 4296, 85, 23, 0, 1970, 0, 4041, 2552, 279, 2920, 3263, 0,
+    0, 5340, 301, 200, 0, 213, 0, 0, 2833, 0, 2661, 3316, 0, 143, 23, 192,
+    0, 2873, 5895, 3041, 6103, 0, 5803, 121, 307, 6779, 187, 0, 3407, 15, 265, 286,
+    0, 0, 97, 2349, 146, 1952, 0, 308, 2560, 2669, 3355, 0, 207, 2614, 1822, 0,
+    3360, 266, 1602, 2458, 2888, 2831, 3019, 178, 236, 1764, 1743, 0, 0, 197, 0, 0,
+    2144, 5433, 2183, 119, 3611, 6852, 3099, 6435, 1941, 3276, 308, 3051, 4810, 107, 2832, 0,
+    2491, 2887, 113, 0, 4870, 3056, 4241, 135, 2508, 2581, 6416, 286, 0, 3173, 4762, 2799,
+    317, 5665, 2534, 6000, 6040, 3108, 272, 2593, 0, 0, 3025, 220, 3096, 2589, 235, 4426,
+    2217, 0, 0, 0, 0, 3238, 0, 0, 0, 0, 0, 1714, 0, 6359, 2568, 1682,
+    1755, 3172, 3348, 216, 0, 0, 2985, 5527, 3317, 2710, 241, 2514, 0, 132, 0, 0,
+    3004, 4371, 5774, 3187, 2754, 3996, 172, 4894, 3062, 5088, 2910, 0, 2236, 2689, 4867, 47,
+    2282, 2963, 267, 3686, 48, 147, 0, 251, 0, 1772, 3101, 0, 5641, 2579, 4646, 5002,
+    245, 145, 2424, 2677, 2729, 3228, 2606, 310, 0, 2909, 2513, 2931, 3101, 2496, 0, 2271,
+    0, 0, 2920, 1974, 2207, 4216, 0, 0, 2997, 39, 3874, 2943, 0, 0, 182, 5187,
+    2766, 5821, 3263, 144, 2472, 3776, 4218, 3087, 4528, 0, 2616, 2933, 299, 266, 167, 1716,
+    6026, 156, 2481, 213, 4617, 6117, 0, 3227, 2490, 173, 2036, 137, 97, 5581, 0, 275,
+    0, 2788, 269, 314, 2613, 0, 6266, 287, 225, 2909, 59, 3746, 64, 291, 0, 156,
+    278, 4006, 0, 2681, 1600, 0, 2673, 0, 312, 212, 233, 2341, 5122, 23, 258, 285,
+    150, 2556, 0, 4015, 2888, 62, 236, 163, 2699, 4044, 0, 4306, 4718, 0, 4908, 2220,
+    3128, 199, 192, 2027, 262, 0, 212, 298, 6580, 2471, 2700, 2945, 1609, 2919, 2776, 26,
+    2093, 3144, 2491, 137, 2648, 0, 219, 71, 181, 3121, 2933, 2855, 0, 3998, 0, 2879,
+    0, 2529, 187, 3866, 3238, 5316, 2831, 0, 2482, 2347, 2633, 229, 0, 234, 0, 0,
+    194, 38, 88, 302, 3063, 1742, 0, 285, 0, 212, 0, 2766, 0, 2629, 2512, 0,
+    275, 3118, 6352, 3371, 0, 1631, 2589, 3195, 0, 2835, 4490, 3141, 5090, 2942, 0, 240,
+    0, 5309, 2765, 5555, 0, 5256, 310, 3188, 0, 2689, 0, 1707, 1962, 2703, 209, 0,
+    124, 1781, 273, 3054, 0, 4646, 7346, 0, 3197, 220, 1611, 5553, 2429, 2833, 48, 4867,
+    3122, 4755, 0, 0, 3227, 302, 4054, 41, 6057, 0, 1830, 5187, 0, 0, 2622, 229,
+    2946, 0, 7222, 2209, 0, 207, 2799, 5757, 4445, 181, 2153, 2075, 0, 0, 0, 3096,
+    2798, 3154, 211, 2690, 0, 2353, 71, 2846, 0, 2760, 3227, 4209, 2103, 2514, 234, 2787,
+    19, 0, 5151, 2403, 3161, 4726, 2308, 1656, 285, 0, 0, 47, 0, 5526, 0, 4704,
+    2282, 2235, 3874, 6297, 0, 2602, 1920, 224, 175, 3119, 0, 2617, 0, 5967, 180, 1906,
+    2858, 23, 35, 1945, 0, 0, 6686, 0, 172, 239, 6188, 253, 3780, 0, 0, 2908,
+    1904, 96, 47, 0, 192, 5787, 2038, 1606, 279, 0, 6006, 4006, 0, 4492, 0, 0,
+    2644, 0, 2965, 3076, 0, 3156, 0, 0, 2162, 0, 0, 1609, 278, 156, 0, 3063,
+    0, 2964, 0, 187, 3086, 263, 77, 0, 179, 71, 3573, 0, 234, 2536, 5316, 36,
+    3131, 144, 0, 28, 3876, 2272, 2930, 0, 2734, 0, 3989, 184, 3260, 3074, 0, 2952,
+    2527, 1621, 2149, 170, 7008, 0, 2010, 0, 2702, 4261, 295, 289, 3296, 0, 0, 3383,
+    2878, 209, 312, 0, 2647, 0, 0, 5571, 3096, 273, 1632, 0, 4122, 0, 2689, 202,
+    4437, 0, 0, 1774, 0, 152, 5287, 4008, 4428, 2603, 1963, 5711, 1600, 2102, 2977, 0,
+    4969, 3293, 11, 188, 189, 3207, 2948, 278, 7287, 0, 215, 0, 2514, 2909, 0, 2855,
+    2985, 2481, 5932, 307, 4769, 3218, 0, 3164, 0, 3821, 3054, 42, 0, 0, 3839, 2644,
+    0, 2854, 48, 5756, 0, 0, 3018, 2076, 244, 0, 2789, 2084, 0, 0, 3040, 232,
+    305, 320, 0, 205, 3194, 188, 0, 3144, 0, 6232, 231, 218, 4720, 2656, 5976, 6275,
+    2281, 4446, 25, 1808, 3001, 305, 272, 0, 2990, 3556, 0, 0, 297, 1962, 3051, 0,
+    2535, 0, 2337, 3255, 0, 62, 2743, 0, 0, 0, 0, 2316, 194, 256, 4355, 2040,
+    2270, 0, 270, 0, 6679, 6189, 0, 0, 2271, 0, 5635, 109, 0, 2999, 0, 4022,
+    5847, 2484, 2733, 3336, 313, 108, 2536, 0, 5599, 2432, 2205, 281, 2534, 0, 5186, 0,
+    1754, 89, 0, 0, 3175, 304, 2623, 0, 255, 1877, 2482, 0, 2272, 0, 156, 0,
+    2933, 137, 205, 3051, 3262, 2009, 2644, 7010, 4217, 3559, 245, 6799, 192, 207, 2270, 1847,
+    3250, 6688, 0, 2780, 50, 4454, 3867, 2602, 0, 47, 1631, 1963, 0, 1604, 3131, 230,
+    0, 2897, 0, 0, 2149, 2204, 271, 300, 0, 3264, 4171, 234, 251, 2648, 2526, 4877,
+    262, 238, 2106, 2880, 2755, 4152, 0, 0, 2535, 3228, 1895, 5444, 0, 3794, 201, 0,
+    296, 3304, 199, 6021, 0, 3766, 37, 5150, 0, 3823, 96, 2908, 149, 24, 0, 3021,
+    3832, 47, 36, 3143, 2855, 4440, 183, 0, 155, 4430, 15, 2711, 1886, 3428, 2699, 0,
+    2789, 3218, 5750, 0, 0, 0, 2854, 254, 0, 0, 206, 161, 196, 3285, 2225, 207,
+    290, 0, 0, 0, 0, 4878, 0, 0, 4732, 1979, 4261, 3152, 184, 3327, 2936, 0,
+    5976, 0, 4901, 2139, 0, 0, 2788, 3140, 5105, 2835, 0, 59, 0, 4656, 2546, 199,
+    2317, 0, 3053, 80, 2932, 0, 0, 272, 202, 0, 2006, 1965, 0, 0, 5884, 0,
+    1829, 2535, 2375, 309, 0, 3051, 0, 0, 0, 268, 3010, 182, 321, 2480, 2754, 2433,
+    2468, 0, 0, 251, 5648, 171, 5696, 2516, 2366, 0, 1954, 0, 2470, 6069, 84, 2976,
+    2270, 0, 0, 87, 121, 1820, 2271, 0, 3337, 2800, 3240, 6252, 0, 239, 2931, 0,
+    0, 0, 2656, 4482, 3654, 52, 0, 2952, 0, 0, 0, 313, 4234, 2811, 4933, 3239,
+    2110, 6833, 208, 5150, 3647, 3266, 3161, 0, 0, 0, 0, 88, 0, 3044, 0, 3441,
+    0, 2556, 3034, 0, 2530, 211, 177, 1605, 4981, 2605, 5107, 3035, 1758, 191, 0, 0,
+    2402, 291, 133, 4431, 210, 0, 6679, 3073, 95, 0, 205, 6388, 5097, 185, 0, 225,
+    222, 0, 305, 281, 4311, 4426, 264, 199, 3274, 3208, 3128, 2842, 2012, 0, 295, 0,
+    0, 5801, 0, 6498, 14, 1746, 2138, 287, 246, 172, 101, 2956, 2842, 2481, 2710, 270,
+    265, 0, 2788, 5611, 4272, 3786, 3084, 173, 87, 7050, 59, 3603, 0, 0, 6030, 3546,
+    0, 2234, 133, 2501, 0, 0, 3172, 211, 4866, 0, 2854, 138, 12, 0, 85, 3447,
+    230, 1981, 6268, 3769, 0, 237, 6681, 226, 0, 1956, 184, 1875, 0, 296, 1688, 2435,
+    88, 242, 261, 2911, 0, 3216, 3656, 2666, 2471, 2899, 1840, 5030, 3282, 0, 2479, 0,
+    3299, 0, 149, 283, 4869, 265, 3328, 2215, 0, 3902, 4534, 3208, 2590, 3996, 2883, 143,
+    0, 0, 0, 0, 4498, 3308, 317, 3930, 6105, 0, 0, 268, 2369, 5308, 2898, 1833,
+    4226, 0, 2787, 2140, 110, 2944, 146, 0, 200, 4483, 2810, 2868, 2281, 2534, 2821, 0,
+    1823, 0, 2270, 1613, 193, 2406, 238, 0, 219, 0, 2937, 5612, 4208, 2656, 195, 5194,
+    0, 2568, 27, 83, 4895, 2974, 2601, 3044, 3108, 6351, 3612, 1623, 3021, 2184, 1780, 5154,
+    185, 5406, 167, 4426, 2311, 0, 5371, 0, 5773, 0, 3047, 0, 174, 0, 0, 0,
+    4274, 0, 5100, 0, 2953, 2606, 2402, 0, 4656, 1819, 0, 3084, 241, 0, 0, 119,
+    3547, 6695, 2931, 1605, 5810, 0, 5758, 1896, 3788, 3053, 7112, 0, 284, 268, 3018, 146,
+    0, 5203, 203, 2996, 2238, 0, 0, 0, 295, 3018, 188, 132, 0, 3800, 5846, 1812,
+    4647, 17, 194, 1691, 2523, 302, 299, 1605, 5031, 0, 2518, 267, 0, 2513, 221, 4866,
+    2800, 0, 0, 59, 0, 5801, 0, 4656, 5107, 3452, 0, 2000, 2967, 3327, 225, 6421,
+    3090, 6031, 175, 0, 0, 0, 0, 4321, 5202, 3161, 0, 0, 276, 109, 282, 4219,
+    3064, 4939, 3049, 3007, 277, 2845, 201, 311, 3172, 2866, 296, 0, 0, 0, 2539, 213,
+    3649, 214, 108, 3661, 4314, 0, 0, 2843, 2952, 0, 2471, 214, 192, 2657, 173, 192,
+    0, 3310, 131, 1874, 271, 0, 3075, 0, 2083, 3632, 248, 196, 0, 269, 4498, 132,
+    6401, 4783, 3318, 2712, 2140, 189, 6196, 223, 14, 3074, 2524, 295, 0, 0, 66, 258,
+    2843, 110, 280, 63, 0, 0, 2779, 0, 21, 2938, 211, 2787, 2821, 1622, 26, 0,
+    3055, 2987, 290, 262, 174, 2216, 248, 2776, 2755, 6477, 2848, 5986, 262, 265, 5142, 2864,
+    1677, 2096, 0, 61, 5229, 5052, 5995, 71, 0, 3999, 2340, 1699, 210, 138, 4747, 2666,
+    3108, 2801, 185, 109, 0, 11, 2867, 1640, 2864, 1742, 297, 196, 3997, 2470, 0, 3548,
+    2633, 241, 2568, 4500, 3194, 0, 1887, 3153, 3462, 0, 0, 0, 0, 5317, 290, 3273,
+    0, 2637, 2957, 2985, 3018, 0, 235, 2966, 3315, 5333, 1824, 293, 155, 26, 5091, 0,
+    3812, 19, 0, 0, 6366, 2679, 2357, 303, 0, 0, 1613, 0, 2655, 196, 1763, 0,
+    2767, 5166, 311, 2957, 280, 5309, 2834, 2178, 6209, 2820, 3065, 7356, 179, 2864, 312, 3249,
+    0, 0, 2622, 0, 211, 5546, 0, 290, 2831, 2578, 1881, 2848, 190, 2545, 0, 6820,
+    109, 2210, 274, 210, 91, 168, 1819, 0, 0, 5415, 2744, 2348, 3242, 4095, 5767, 0,
+    5854, 214, 4868, 3199, 2625, 2767, 2943, 288, 0, 3022, 2515, 5969, 6215, 108, 87, 2634,
+    0, 2781, 1942, 73, 2470, 233, 2425, 3672, 0, 0, 3987, 119, 2337, 132, 4211, 4507,
+    3932, 3098, 218, 190, 4453, 0, 174, 6045, 5581, 2560, 248, 0, 180, 222, 1925, 2712,
+    1766, 208, 29, 244, 5749, 5144, 2975, 2781, 62, 2440, 260, 0, 2403, 1915, 6742, 3142,
+    6011, 6479, 0, 4784, 2919, 2964, 0, 266, 27, 1624, 2250, 0, 3107, 2864, 196, 2843,
+    3095, 2611, 0, 1809, 2755, 0, 1607, 2736, 229, 290, 0, 3176, 279, 5427, 0, 2678,
+    0, 0, 2470, 107, 3012, 3287, 293, 281, 0, 0, 3064, 2537, 0, 5320, 263, 0,
+    3271, 2216, 2567, 2790, 60, 187, 2802, 0, 0, 219, 2965, 170, 4746, 3063, 131, 2886,
+    3194, 0, 271, 0, 0, 0, 2149, 0, 4278, 176, 201, 3018, 3150, 225, 3405, 0,
+    3491, 0, 0, 5223, 0, 5545, 1652, 260, 2878, 26, 3074, 3106, 143, 0, 2017, 179,
+    0, 0, 1679, 0, 5662, 3382, 2868, 0, 0, 6088, 3831, 4124, 2798, 0, 233, 0,
+    0, 6246, 3185, 2206, 273, 241, 0, 0, 5634, 274, 208, 0, 51, 0, 4087, 5815,
+    3218, 1601, 3565, 0, 3988, 2996, 307, 5867, 190, 2908, 3682, 1744, 155, 233, 6075, 266,
+    0, 72, 310, 3059, 0, 0, 2087, 5760, 2865, 204, 5634, 5977, 2767, 1612, 2475, 2440,
+    3024, 0, 182, 0, 312, 169, 4711, 3195, 2502, 6903, 224, 2359, 2520, 2721, 143, 0,
+    4043, 25, 3077, 5748, 4447, 2725, 0, 3986, 0, 132, 0, 2447, 3586, 11, 167, 4407,
+    208, 35, 0, 232, 217, 108, 4800, 1609, 3169, 0, 3207, 248, 2934, 2881, 2402, 0,
+    5144, 319, 244, 0, 4461, 5378, 0, 0, 3178, 0, 2710, 3000, 303, 1942, 3345, 2480,
+    4648, 0, 0, 4263, 2671, 0, 0, 0, 3295, 0, 5198, 0, 271, 2243, 6280, 303,
+    0, 0, 2888, 304, 2724, 0, 0, 2755, 285, 6220, 2505, 0, 218, 0, 229, 0,
+    0, 2493, 0, 0, 3846, 2843, 3031, 260, 5598, 2645, 5818, 3912, 2205, 3095, 251, 1607,
+    0, 1972, 2930, 1888, 212, 0, 0, 1644, 1839, 3470, 0, 245, 293, 2539, 3353, 3117,
+    179, 2149, 0, 72, 202, 2822, 2477, 2272, 26, 0, 0, 0, 220, 0, 50, 3293,
+    6721, 168, 320, 0, 3250, 5669, 72, 0, 131, 4921, 268, 5675, 175, 252, 6023, 284,
+    2748, 37, 0, 224, 35, 3241, 2912, 2846, 2570, 302, 2703, 3198, 3824, 0, 2798, 2699,
+    274, 13, 190, 306, 0, 6136, 3710, 0, 224, 3287, 4101, 5160, 2881, 0, 3822, 5114,
+    2074, 269, 3218, 1609, 1614, 3272, 2103, 2656, 285, 2842, 3987, 3141, 0, 2865, 155, 24,
+    4710, 2339, 243, 2219, 0, 134, 1745, 160, 2204, 2986, 2228, 4157, 6471, 68, 0, 2546,
+    50, 4657, 0, 109, 2814, 99, 2988, 2792, 2980, 221, 2789, 6973, 2028, 2837, 2836, 5096,
+    3187, 0, 0, 0, 2853, 244, 0, 2336, 0, 0, 3173, 2831, 0, 3381, 0, 4649,
+    5583, 2255, 1678, 2483, 0, 2754, 3777, 241, 0, 2590, 4089, 3014, 38, 2963, 1609, 0,
+    208, 2733, 2402, 147, 2735, 2480, 2976, 5644, 2374, 240, 0, 0, 5921, 0, 3117, 0,
+    159, 16, 0, 2449, 289, 0, 0, 4686, 0, 0, 2139, 85, 3184, 3240, 4673, 4052,
+    3306, 0, 0, 0, 145, 0, 2613, 229, 0, 2822, 0, 198, 1876, 3239, 290, 1601,
+    5161, 5606, 0, 177, 0, 1603, 2997, 2876, 3512, 0, 0, 2470, 2492, 1697, 0, 0,
+    212, 227, 0, 53, 0, 3073, 3022, 2415, 1854, 253, 2583, 0, 0, 1951, 2941, 3337,
+    2882, 155, 2350, 2095, 33, 6723, 0, 0, 4527, 2722, 225, 0, 3180, 0, 0, 0,
+    1607, 3031, 50, 4921, 2921, 2671, 0, 264, 2732, 1605, 283, 4491, 0, 2888, 0, 4427,
+    2987, 0, 0, 2504, 0, 3689, 245, 0, 0, 0, 219, 2245, 4436, 2710, 13, 0,
+    172, 5560, 3321, 1687, 2889, 0, 0, 2215, 2688, 0, 3626, 5126, 143, 269, 96, 2573,
+    2513, 0, 3161, 239, 4065, 1602, 236, 4876, 1742, 0, 184, 3305, 295, 0, 2941, 2645,
+    0, 2579, 6504, 0, 2678, 5582, 3054, 0, 0, 2908, 0, 0, 0, 4659, 0, 1745,
+    4714, 2030, 0, 3296, 0, 2986, 0, 0, 4137, 3768, 3139, 3282, 3283, 0, 0, 302,
+    203, 0, 189, 0, 3381, 5804, 2291, 3192, 0, 0, 3130, 243, 250, 252, 3086, 2072,
+    0, 2853, 111, 0, 314, 0, 0, 1608, 2692, 3026, 2282, 2810, 0, 2985, 2008, 4113,
+    2601, 272, 51, 0, 148, 3336, 2946, 2472, 3164, 0, 3030, 0, 2392, 3262, 194, 4071,
+    2954, 2623, 99, 195, 0, 2892, 4227, 2614, 86, 198, 2168, 3326, 0, 1603, 173, 0,
+    2749, 125, 287, 0, 4484, 5537, 3108, 2417, 1753, 0, 100, 4967, 2732, 1608, 0, 0,
+    0, 4569, 0, 5985, 6350, 3903, 1951, 2094, 168, 6021, 0, 39, 304, 2771, 2349, 0,
+    313, 5096, 0, 2402, 3053, 0, 3261, 0, 0, 0, 241, 0, 0, 100, 0, 0,
+    6772, 2019, 0, 0, 159, 0, 3602, 147, 0, 0, 275, 62, 2638, 0, 3295, 1698,
+    2495, 2657, 0, 320, 3732, 2765, 5087, 0, 0, 3776, 1608, 0, 2515, 222, 4020, 0,
+    2858, 320, 317, 194, 3294, 4481, 5765, 234, 0, 4885, 197, 2898, 3030, 199, 289, 0,
+    4650, 245, 2986, 6186, 269, 3767, 2914, 2072, 0, 227, 2574, 309, 2931, 2513, 1875, 2045,
+    0, 172, 0, 1895, 242, 95, 0, 0, 3305, 0, 3294, 0, 76, 3557, 4564, 0,
+    2281, 311, 2206, 1811, 1941, 0, 0, 0, 2021, 23, 288, 5326, 0, 0, 0, 3139,
+    0, 3196, 2922, 1610, 0, 0, 228, 0, 2723, 83, 0, 3041, 146, 113, 4076, 2691,
+    3386, 5127, 321, 0, 2930, 2953, 2769, 0, 3030, 4661, 2538, 3086, 0, 2813, 50, 3262,
+    6715, 2274, 2713, 0, 0, 1608, 206, 3904, 272, 0, 5554, 0, 3339, 48, 193, 71,
+    0, 161, 0, 2031, 3232, 5003, 2930, 2083, 301, 0, 183, 0, 4816, 173, 49, 4315,
+    99, 4228, 0, 1722, 3601, 3087, 134, 2097, 0, 0, 132, 1809, 292, 3304, 1603, 284,
+    2169, 188, 3108, 1772, 0, 278, 6371, 5539, 61, 0, 1744, 314, 5986, 262, 287, 2777,
+    2756, 3172, 5188, 6361, 0, 3054, 3548, 0, 0, 0, 7036, 4867, 3162, 217, 2506, 1698,
+    0, 0, 0, 0, 0, 0, 0, 241, 2820, 1742, 0, 3155, 2809, 3238, 228, 5087,
+    0, 1755, 2546, 2682, 0, 2968, 2226, 0, 1905, 0, 3186, 3029, 0, 60, 1885, 0,
+    110, 0, 2589, 0, 247, 1633, 277, 185, 267, 2517, 199, 291, 2515, 4307, 309, 0,
+    2491, 4216, 0, 1600, 2898, 5627, 144, 263, 0, 2943, 3175, 255, 0, 188, 0, 0,
+    5602, 0, 3074, 4344, 2733, 3010, 2481, 0, 249, 0, 309, 4581, 2494, 134, 2058, 3096,
+    0, 252, 0, 0, 0, 1793, 72, 1608, 2469, 2159, 0, 0, 306, 223, 2744, 4666,
+    3040, 182, 0, 2512, 266, 187, 0, 0, 287, 134, 191, 83, 2634, 2625, 0, 7098,
+    2782, 0, 228, 2875, 2695, 2927, 277, 1978, 6798, 0, 0, 6230, 1943, 5554, 233, 2085,
+    156, 1610, 315, 0, 62, 2856, 25, 3207, 215, 2738, 2715, 316, 0, 0, 0, 3103,
+    305, 0, 57, 312, 3941, 0, 2556, 3162, 0, 275, 3063, 2338, 3145, 1810, 1830, 3085,
+    0, 4890, 202, 5015, 1625, 4938, 4437, 60, 210, 0, 0, 0, 2768, 2855, 3557, 103,
+    5442, 0, 201, 0, 5889, 1809, 15, 2501, 2766, 3293, 6488, 0, 173, 4821, 254, 0,
+    2668, 0, 168, 0, 284, 1898, 2809, 2897, 252, 3767, 250, 2724, 0, 0, 0, 193,
+    1697, 219, 0, 0, 3547, 4264, 219, 221, 0, 244, 4930, 3008, 5530, 1605, 0, 3186,
+    12, 2645, 250, 4893, 2142, 2227, 5307, 0, 5087, 0, 1940, 5371, 206, 2017, 2537, 3150,
+    2504, 2273, 2308, 3231, 0, 2738, 3174, 3399, 0, 229, 5224, 0, 2842, 0, 2593, 2600,
+    2546, 1961, 214, 1905, 207, 0, 273, 2999, 2519, 0, 7227, 2667, 2589, 0, 201, 6187,
+    2700, 206, 3130, 304, 281, 6022, 284, 4207, 0, 4466, 262, 23, 2777, 3294, 0, 7014,
+    2483, 126, 6102, 0, 100, 0, 0, 2206, 194, 3830, 0, 0, 5846, 0, 247, 2150,
+    3207, 3107, 221, 3129, 160, 259, 0, 1635, 267, 3683, 2976, 2733, 2636, 2547, 2618, 5756,
+    59, 4271, 0, 0, 1754, 3882, 122, 0, 224, 259, 0, 2772, 0, 5862, 2798, 28,
+    3045, 2724, 0, 0, 5526, 6827, 107, 25, 4218, 6242, 0, 131, 3345, 0, 0, 2858,
+    2504, 0, 0, 209, 0, 178, 6693, 3040, 4042, 2790, 2524, 186, 3284, 6748, 3219, 3195,
+    213, 279, 0, 217, 0, 1810, 167, 3020, 5408, 2776, 25, 1609, 5802, 2481, 1907, 0,
+    1838, 5988, 0, 1689, 0, 0, 6115, 5363, 5769, 3019, 0, 0, 2088, 1947, 0, 2603,
+    2998, 226, 0, 289, 0, 2492, 1889, 250, 187, 279, 2723, 0, 2540, 3556, 2502, 196,
+    0, 2765, 0, 5449, 3772, 3073, 0, 0, 3475, 0, 0, 1808, 3063, 251, 0, 2077,
+    167, 0, 2823, 2934, 2900, 2953, 0, 0, 2999, 5378, 2559, 0, 3434, 2930, 290, 4900,
+    179, 0, 4922, 2491, 6038, 121, 1677, 2812, 210, 259, 3233, 3550, 2832, 2424, 2321, 2681,
+    4932, 0, 252, 2581, 2640, 0, 2723, 2357, 261, 202, 4265, 3851, 0, 1961, 0, 2722,
+    3646, 1874, 1829, 273, 2546, 14, 5891, 1821, 4351, 5670, 2627, 211, 5241, 156, 1986, 43,
+    0, 0, 2545, 6023, 2710, 2337, 178, 0, 2866, 2777, 189, 216, 3841, 7058, 2656, 0,
+    178, 3062, 0, 279, 3716, 3021, 2483, 2117, 3129, 6393, 260, 3318, 3392, 0, 0, 0,
+    3273, 3130, 2315, 2667, 0, 0, 6560, 1678, 3329, 274, 256, 0, 6806, 201, 2952, 206,
+    0, 0, 2860, 236, 291, 318, 4428, 230, 6234, 0, 2141, 254, 275, 3284, 3206, 5993,
+    0, 215, 3173, 2988, 2602, 0, 1640, 2677, 2793, 0, 2161, 1604, 4754, 5386, 228, 0,
+    5098, 2842, 107, 297, 2366, 71, 0, 0, 2427, 2215, 2794, 0, 2590, 2743, 120, 5626,
+    0, 306, 0, 3077, 2758, 0, 245, 5978, 2776, 0, 158, 255, 1676, 0, 240, 134,
+    297, 0, 5590, 0, 23, 167, 1706, 4041, 222, 2625, 3558, 3095, 0, 1879, 2490, 0,
+    0, 0, 3793, 268, 2778, 2834, 4665, 196, 0, 2495, 0, 0, 3009, 0, 0, 0,
+    267, 2578, 3228, 146, 0, 4590, 3427, 6294, 0, 220, 2723, 2963, 282, 257, 0, 1815,
+    252, 2902, 322, 1859, 2485, 200, 0, 1849, 4292, 2677, 0, 3526, 2920, 0, 0, 2826,
+    0, 5340, 0, 301, 4542, 4370, 0, 0, 1648, 3062, 0, 2560, 210, 4429, 0, 0,
+    2736, 213, 0, 2614, 3252, 3654, 0, 3062, 2523, 4505, 15, 0, 3354, 0, 2722, 1961,
+    5883, 0, 3262, 3316, 4208, 2799, 1689, 0, 3695, 4927, 3073, 6732, 4966, 0, 155, 2732,
+    97, 0, 36, 2516, 1952, 144, 2710, 2875, 290, 318, 0, 2728, 0, 6068, 0, 206,
+    1820, 0, 2678, 0, 2215, 2579, 257, 3161, 270, 233, 0, 0, 2667, 2036, 273, 1605,
+    2141, 2714, 11, 0, 2226, 139, 4240, 266, 1764, 0, 0, 236, 5747, 308, 2508, 311,
+    226, 0, 0, 2217, 4879, 0, 2415, 0, 5664, 0, 6000, 0, 0, 6848, 0, 2347,
+    2604, 299, 0, 90, 187, 2366, 1681, 3394, 2721, 2545, 3610, 0, 3129, 133, 0, 6394,
+    2490, 2931, 321, 2072, 2810, 286, 4761, 107, 3996, 0, 2514, 5630, 0, 3347, 6273, 2018,
+    2480, 2932, 4647, 2176, 3194, 2623, 2628, 3056, 184, 0, 3097, 4246, 285, 5593, 1607, 3166,
+    0, 0, 0, 132, 248, 2968, 1601, 300, 3331, 5086, 2102, 0, 0, 47, 0, 5759,
+    3253, 0, 2845, 2563, 0, 271, 2605, 3141, 3622, 2205, 6440, 3185, 3317, 0, 2495, 5993,
+    186, 4613, 144, 2757, 2207, 5537, 304, 0, 247, 145, 257, 2160, 5097, 52, 2754, 4967,
+    3443, 0, 156, 5820, 0, 2472, 313, 0, 48, 0, 173, 4041, 4668, 5594, 0, 39,
+    167, 2358, 0, 3776, 0, 2909, 7092, 2613, 3263, 3032, 2416, 2943, 0, 275, 5748, 3786,
+    5812, 0, 5806, 2152, 26, 2368, 287, 1743, 2662, 1688, 23, 222, 64, 0, 3109, 4718,
+    2648, 3573, 3263, 240, 1822, 5089, 71, 304, 0, 0, 2680, 0, 30, 2612, 2145, 98,
+    243, 2875, 306, 0, 2975, 3066, 2281, 0, 224, 4703, 2037, 0, 169, 1897, 0, 6202,
+    5002, 4014, 2705, 1715, 0, 0, 24, 3766, 0, 6025, 1600, 2027, 3053, 0, 0, 3866,
+    1621, 6576, 285, 0, 2526, 184, 285, 3998, 213, 1895, 0, 0, 11, 2730, 315, 0,
+    186, 3296, 0, 0, 0, 311, 3221, 297, 7152, 0, 3041, 2406, 3307, 4526, 2352, 0,
+    3118, 212, 1605, 0, 1609, 146, 190, 0, 278, 120, 0, 0, 5775, 3152, 299, 0,
+    233, 3367, 1764, 6315, 2787, 4490, 110, 187, 301, 2835, 0, 3063, 0, 2831, 212, 0,
+    261, 2589, 2504, 3183, 0, 0, 5342, 5036, 0, 5547, 7041, 0, 238, 2209, 234, 3614,
+    1611, 2234, 4481, 3242, 2185, 2713, 3058, 4251, 197, 0, 2877, 3996, 208, 114, 7342, 0,
+    0, 5540, 120, 3254, 0, 0, 162, 2414, 6002, 192, 310, 3238, 5207, 2723, 2846, 38,
+    229, 0, 3119, 186, 209, 5538, 0, 273, 257, 2968, 1717, 2943, 3089, 315, 3183, 3162,
+    311, 3283, 282, 2743, 2528, 28, 0, 0, 0, 0, 3096, 284, 1603, 2759, 268, 4046,
+    3074, 2336, 1655, 0, 3053, 0, 2618, 2809, 294, 2760, 2616, 2942, 5968, 4931, 0, 5088,
+    0, 2589, 0, 0, 4725, 47, 2513, 0, 267, 0, 3172, 3779, 0, 5067, 6195, 0,
+    4702, 4866, 4436, 283, 2073, 2293, 221, 2684, 1606, 0, 2036, 4094, 0, 1690, 2536, 75,
+    2975, 0, 0, 3069, 3011, 0, 2207, 213, 2875, 0, 95, 2281, 0, 4322, 295, 2985,
+    72, 305, 0, 4308, 1600, 0, 2474, 1919, 182, 5786, 6883, 0, 0, 0, 2666, 2556,
+    0, 0, 0, 3282, 281, 143, 2953, 0, 3998, 3152, 0, 4306, 322, 3075, 2536, 0,
+    2778, 2645, 3102, 0, 120, 3875, 5528, 110, 0, 0, 3989, 0, 0, 2644, 66, 0,
+    191, 2010, 0, 3130, 156, 5141, 2613, 0, 2670, 1621, 0, 2854, 272, 0, 0, 0,
+    2535, 2879, 0, 0, 0, 4129, 5310, 0, 0, 75, 1763, 0, 207, 2706, 4007, 181,
+    3183, 1886, 2527, 2955, 3821, 2342, 2271, 2989, 26, 4437, 262, 2700, 2820, 265, 2919, 307,
+    1608, 2923, 5257, 5931, 3029, 2093, 0, 4000, 61, 2877, 0, 2688, 95, 5011, 184, 0,
+    119, 187, 3131, 0, 41, 5406, 312, 0, 0, 219, 0, 292, 1753, 0, 0, 1742,
+    5470, 0, 2405, 191, 5970, 2635, 0, 0, 3260, 0, 0, 4490, 2837, 2725, 4426, 3272,
+    2778, 0, 294, 0, 0, 5385, 5092, 3546, 2153, 0, 4719, 0, 0, 244, 0, 4446,
+    4757, 0, 0, 0, 0, 2151, 1962, 3231, 3307, 0, 0, 0, 0, 0, 3426, 2589,
+    2955, 4705, 0, 280, 273, 5855, 6944, 289, 30, 2769, 72, 1921, 75, 199, 272, 5692,
+    0, 6188, 0, 3293, 2850, 0, 0, 0, 28, 272, 2615, 249, 6211, 0, 2624, 5635,
+    2484, 6130, 0, 2545, 5846, 2211, 0, 0, 2655, 124, 258, 2558, 2833, 43, 0, 0,
+    0, 3184, 288, 38, 89, 1765, 0, 4217, 251, 0, 54, 4286, 279, 2985, 7020, 283,
+    1754, 3043, 4930, 0, 0, 310, 2270, 3326, 230, 0, 2913, 0, 0, 2529, 2009, 4494,
+    0, 0, 2942, 2550, 5529, 2778, 5584, 3877, 2602, 50, 2094, 3001, 270, 6031, 3131, 178,
+    0, 3175, 4087, 2432, 281, 1602, 1680, 1991, 0, 269, 2524, 3223, 3151, 2869, 5141, 6687,
+    2908, 36, 79, 2620, 171, 0, 228, 3118, 4009, 3282, 1621, 4445, 1711, 4130, 224, 49,
+    1608, 47, 229, 3285, 2647, 0, 71, 4439, 3304, 0, 3029, 0, 0, 246, 0, 3262,
+    3785, 3244, 2316, 187, 0, 0, 0, 1606, 0, 161, 0, 133, 107, 225, 0, 60,
+    184, 191, 5409, 2765, 3141, 322, 0, 4681, 3823, 3991, 4885, 3207, 292, 2007, 2734, 3320,
+    2300, 131, 2571, 4261, 2876, 0, 2803, 0, 192, 199, 2935, 2468, 3566, 0, 85, 179,
+    4446, 3384, 0, 0, 4270, 5096, 3436, 3140, 2900, 3010, 59, 231, 233, 0, 0, 184,
+    0, 0, 3197, 72, 3234, 1611, 3051, 3042, 2919, 0, 2479, 1677, 1964, 3821, 0, 2691,
+    0, 81, 273, 4400, 2375, 0, 2754, 278, 278, 0, 2076, 84, 3041, 217, 3298, 0,
+    0, 1829, 3646, 5493, 71, 5647, 2503, 2516, 0, 176, 2878, 0, 0, 0, 2677, 0,
+    0, 189, 2789, 0, 1819, 246, 3131, 171, 2746, 292, 3184, 0, 180, 0, 3024, 2433,
+    0, 2084, 268, 4482, 2650, 256, 3195, 205, 2357, 0, 0, 4225, 5528, 218, 63, 6908,
+    6811, 0, 0, 291, 0, 25, 1757, 0, 0, 3055, 0, 0, 2743, 1971, 0, 2095,
+    52, 5370, 167, 4448, 2744, 0, 5849, 4877, 255, 120, 0, 3151, 0, 6066, 2992, 182,
+    0, 4176, 0, 2776, 303, 0, 2650, 0, 4058, 3042, 2072, 2570, 0, 2292, 6387, 228,
+    1609, 2243, 209, 3084, 2710, 6230, 4376, 309, 3175, 0, 170, 3020, 2668, 0, 2283, 2536,
+    175, 0, 2234, 0, 0, 0, 161, 2011, 5141, 3095, 2747, 3823, 255, 0, 3795, 0,
+    2605, 3153, 2933, 3583, 3574, 3603, 245, 0, 0, 4430, 3161, 0, 4887, 0, 2402, 3235,
+    2216, 4051, 149, 85, 295, 12, 5810, 1913, 2302, 0, 4596, 211, 191, 0, 50, 3429,
+    238, 1875, 1611, 3172, 2765, 2883, 3098, 2732, 1886, 250, 5325, 2903, 131, 0, 296, 0,
+    2692, 3118, 2901, 3043, 2479, 1966, 227, 237, 3871, 203, 0, 2780, 0, 0, 207, 1746,
+    6021, 2965, 3825, 180, 2225, 207, 2523, 289, 0, 3042, 3007, 204, 0, 2721, 296, 4208,
+    0, 6351, 5918, 0, 45, 2910, 2735, 6680, 1649, 0, 155, 0, 3041, 1780, 0, 6104,
+    306, 0, 254, 36, 2168, 0, 2944, 5105, 3336, 75, 4675, 2701, 2747, 0, 1832, 0,
+    184, 209, 0, 171, 158, 4974, 219, 2139, 0, 3166, 259, 5611, 6194, 2006, 0, 2044,
+    4483, 4746, 3306, 3293, 3655, 2075, 1876, 109, 5832, 2839, 61, 2789, 6470, 1955, 6070, 6862,
+    2525, 0, 1677, 202, 0, 6682, 2310, 52, 61, 0, 247, 2296, 3128, 3565, 0, 3088,
+    12, 3272, 271, 2020, 309, 198, 0, 4880, 4981, 318, 2756, 0, 3770, 0, 2605, 0,
+    0, 298, 2811, 0, 285, 3337, 2480, 0, 2517, 3040, 3037, 0, 0, 54, 0, 0,
+    2721, 0, 5317, 0, 2931, 5308, 170, 158, 2237, 3019, 65, 3778, 185, 5758, 2072, 196,
+    5546, 13, 145, 2954, 0, 4482, 0, 3057, 2600, 0, 0, 2110, 6238, 0, 3018, 203,
+    212, 2348, 0, 0, 0, 2572, 0, 4691, 4866, 246, 0, 2845, 3448, 0, 0, 209,
+    0, 0, 2469, 2958, 0, 6519, 0, 0, 5194, 2580, 2932, 0, 4982, 2160, 0, 2414,
+    250, 5306, 3079, 0, 0, 205, 2996, 247, 2997, 296, 258, 0, 5801, 2666, 259, 1875,
+    255, 2479, 173, 174, 3053, 237, 4562, 222, 1748, 0, 1874, 2942, 2843, 85, 108, 270,
+    109, 316, 184, 3165, 204, 0, 1632, 3909, 251, 0, 3787, 226, 2389, 3112, 1642, 131,
+    0, 217, 3902, 6267, 3041, 37, 2964, 2275, 0, 214, 2668, 0, 4067, 3605, 102, 0,
+    2086, 2170, 5326, 3098, 4206, 4922, 243, 5977, 0, 290, 279, 76, 132, 3318, 5108, 1605,
+    248, 0, 4226, 2054, 261, 1823, 101, 2777, 6365, 0, 3648, 290, 3205, 24, 6204, 2286,
+    40, 4483, 0, 1896, 320, 2711, 3283, 2900, 5766, 119, 0, 0, 2360, 1699, 168, 5980,
+    2637, 189, 0, 2864, 0, 2215, 0, 4538, 11, 0, 280, 297, 254, 0, 0, 196,
+    298, 3174, 2809, 3140, 2801, 1808, 2844, 151, 2847, 4748, 2423, 0, 84, 303, 0, 4499,
+    2787, 2866, 0, 0, 0, 3462, 110, 4349, 5318, 4871, 2468, 200, 2721, 2792, 0, 2985,
+    225, 158, 240, 0, 0, 177, 0, 3610, 2287, 112, 3076, 238, 242, 4975, 2625, 2834,
+    1613, 268, 4485, 0, 2978, 3353, 24, 0, 5536, 1623, 5186, 122, 0, 263, 0, 2348,
+    84, 3165, 0, 0, 84, 203, 179, 2853, 5911, 0, 5032, 3398, 2847, 5145, 0, 4262,
+    2337, 4086, 37, 74, 7162, 4210, 178, 0, 2163, 0, 6708, 2414, 3053, 301, 2469, 4866,
+    3808, 3091, 0, 0, 312, 0, 272, 179, 2756, 3240, 2085, 4221, 270, 284, 4453, 179,
+    1604, 4946, 0, 3668, 3020, 298, 2425, 0, 0, 1661, 0, 319, 3951, 0, 0, 0,
+    190, 3217, 2560, 2468, 264, 3206, 1813, 3547, 282, 2513, 62, 210, 261, 2813, 221, 3315,
+    0, 0, 147, 5362, 3986, 29, 320, 0, 2047, 4438, 0, 197, 2867, 5109, 3098, 218,
+    132, 2170, 0, 0, 282, 66, 0, 0, 0, 6197, 2468, 0, 1941, 4783, 2965, 0,
+    4317, 2611, 0, 241, 172, 3831, 311, 4924, 2404, 0, 0, 4327, 0, 3011, 321, 0,
+    5765, 6367, 4749, 3174, 2953, 0, 302, 0, 0, 0, 2540, 2846, 270, 123, 0, 3575,
+    222, 2802, 6245, 0, 293, 3391, 4501, 257, 293, 3075, 131, 263, 2205, 2505, 195, 0,
+    5158, 4710, 2843, 2779, 2736, 226, 0, 2008, 5142, 0, 1885, 265, 3074, 0, 2535, 84,
+    0, 131, 7237, 5545, 3490, 3230, 110, 0, 0, 1773, 0, 2930, 1622, 0, 0, 177,
+    3095, 3168, 2959, 0, 0, 158, 262, 2712, 0, 4712, 4123, 3205, 3304, 2204, 6109, 5749,
+    0, 24, 2721, 260, 5536, 2877, 2382, 0, 264, 1701, 0, 214, 0, 0, 5472, 3170,
+    5188, 0, 2622, 292, 5416, 2639, 61, 281, 274, 155, 3618, 4939, 0, 144, 5748, 261,
+    2865, 0, 2725, 5113, 174, 0, 5627, 0, 0, 6216, 1676, 5060, 2756, 4460, 0, 2637,
+    3023, 223, 1887, 0, 1753, 3548, 169, 2783, 5757, 2966, 3464, 0, 1610, 0, 2545, 3568,
+    2865, 3029, 0, 2825, 0, 167, 35, 0, 2849, 155, 0, 3140, 218, 2820, 3217, 2974,
+    1600, 0, 2338, 280, 2402, 2138, 3196, 3682, 175, 186, 0, 2960, 2870, 2440, 0, 1756,
+    5309, 2480, 6763, 4657, 0, 4796, 2679, 7128, 2834, 0, 6714, 4894, 5969, 2625, 4648, 5746,
+    0, 98, 2660, 303, 5363, 0, 2655, 143, 249, 0, 2833, 283, 0, 200, 199, 2154,
+    0, 4050, 3845, 3328, 2677, 132, 5854, 0, 191, 2560, 0, 307, 3062, 301, 2228, 4096,
+    233, 3044, 4940, 0, 2712, 4436, 0, 124, 2425, 1831, 257, 2593, 0, 3253, 0, 0,
+    2008, 2784, 2964, 2802, 1839, 0, 6046, 210, 195, 263, 3469, 2975, 3216, 293, 285, 5583,
+    4520, 4646, 3682, 3186, 282, 3319, 3293, 0, 3239, 3007, 1970, 3020, 0, 6075, 178, 2507,
+    119, 202, 7242, 5545, 0, 0, 0, 4263, 194, 2612, 1627, 3176, 3406, 0, 0, 107,
+    179, 5895, 2614, 0, 0, 2912, 320, 279, 5803, 0, 0, 2740, 0, 317, 2889, 2766,
+    2870, 0, 225, 2987, 3117, 0, 3256, 212, 5968, 2748, 1790, 219, 3287, 2703, 0, 2537,
+    252, 3099, 0, 5152, 3276, 1940, 0, 60, 1930, 5527, 49, 155, 24, 1607, 0, 0,
+    0, 135, 12, 245, 4233, 0, 2963, 5967, 4282, 6087, 2986, 3502, 2865, 3045, 4462, 2480,
+    0, 2505, 2568, 221, 2337, 2236, 3230, 2887, 0, 3315, 5099, 3151, 4952, 3024, 2300, 269,
+    0, 0, 5120, 0, 1714, 2941, 0, 218, 6359, 5308, 2220, 186, 2799, 4885, 3139, 3013,
+    0, 3095, 0, 0, 5626, 284, 2754, 3986, 241, 4701, 3198, 2735, 182, 2832, 2336, 0,
+    2727, 2922, 0, 3346, 147, 320, 216, 1676, 0, 122, 1772, 72, 6077, 0, 2910, 3684,
+    0, 4649, 71, 2448, 3003, 1612, 2945, 310, 0, 3043, 159, 0, 3120, 5872, 260, 0,
+    2933, 2677, 4088, 0, 3185, 0, 0, 145, 2790, 2496, 0, 2359, 3195, 224, 0, 1753,
+    0, 6918, 25, 276, 5591, 2801, 4044, 182, 4060, 2934, 236, 0, 157, 0, 3239, 4216,
+    169, 39, 2472, 5378, 2491, 245, 2583, 5802, 0, 53, 1853, 167, 0, 0, 303, 49,
+    1608, 2776, 1609, 97, 119, 3020, 0, 5146, 206, 2559, 4527, 0, 1973, 2888, 229, 2611,
+    6266, 208, 3030, 278, 3712, 2468, 2244, 2925, 3107, 0, 3180, 2402, 2413, 239, 0, 2626,
+    0, 2672, 3073, 3847, 0, 145, 0, 274, 0, 0, 137, 317, 2710, 1679, 285, 2715,
+    0, 0, 2303, 2702, 0, 2556, 0, 2415, 3625, 0, 2542, 0, 0, 2601, 3101, 2699,
+    2230, 0, 2074, 1891, 2513, 2583, 0, 3100, 212, 176, 4013, 5818, 3480, 5114, 0, 2733,
+    0, 5333, 2567, 0, 293, 0, 181, 319, 2592, 2942, 4906, 4886, 0, 4427, 0, 3121,
+    2890, 0, 1687, 3230, 2836, 1743, 0, 2482, 0, 2301, 2493, 119, 3283, 0, 0, 2017,
+    4658, 302, 3305, 4657, 0, 2842, 2613, 2946, 2692, 0, 0, 3271, 4006, 0, 0, 1874,
+    0, 49, 2768, 2838, 5222, 97, 3295, 0, 0, 2799, 0, 0, 5590, 207, 2611, 1602,
+    86, 2703, 3227, 2177, 0, 15, 1781, 220, 2103, 2626, 163, 3361, 0, 2480, 1618, 2865,
+    1878, 2952, 2776, 2748, 0, 160, 0, 2846, 0, 4109, 1608, 3326, 48, 1631, 0, 0,
+    0, 201, 1707, 4053, 0, 2795, 306, 302, 2674, 272, 6557, 278, 252, 291, 3030, 1607,
+    3062, 0, 5985, 168, 0, 4755, 2601, 157, 35, 71, 0, 307, 109, 0, 2912, 3272,
+    0, 2377, 23, 0, 5537, 2417, 0, 2798, 4811, 2760, 1742, 1855, 4529, 310, 1678, 287,
+    228, 0, 2347, 0, 2561, 0, 2159, 0, 2646, 0, 0, 0, 253, 3777, 2567, 0,
+    0, 1945, 2941, 3874, 16, 3019, 6239, 0, 6352, 0, 0, 2017, 2611, 196, 0, 3107,
+    172, 2858, 285, 0, 2864, 0, 2680, 4427, 3122, 0, 145, 35, 0, 0, 2492, 175,
+    193, 134, 4649, 2261, 38, 6295, 0, 0, 0, 2585, 2573, 222, 2807, 0, 2513, 0,
+    0, 1895, 5582, 2997, 212, 159, 3066, 2415, 3076, 0, 3238, 0, 2644, 0, 3112, 2470,
+    0, 2691, 5582, 0, 0, 0, 2732, 2527, 2350, 2722, 49, 2744, 0, 4207, 0, 35,
+    3294, 317, 5326, 2030, 267, 0, 0, 245, 0, 0, 4563, 0, 2734, 4492, 0, 0,
+    246, 2614, 5976, 0, 2930, 3322, 0, 2769, 2911, 0, 251, 3117, 1606, 1743, 320, 6142,
+    1632, 0, 158, 146, 0, 2514, 5340, 2490, 3227, 228, 0, 0, 2689, 2921, 2189, 3903,
+    4072, 76, 48, 1721, 0, 3099, 3040, 2102, 4227, 71, 5592, 0, 0, 2909, 2856, 0,
+    4242, 0, 151, 259, 3054, 0, 2711, 0, 0, 181, 1782, 2947, 3155, 183, 2274, 5986,
+    168, 5539, 297, 5780, 0, 0, 4767, 11, 2743, 4876, 4968, 0, 3283, 270, 156, 284,
+    5756, 2589, 3839, 0, 1809, 5230, 189, 1605, 0, 2084, 35, 2072, 3144, 133, 0, 205,
+    0, 6353, 251, 0, 2990, 2966, 0, 0, 1605, 2854, 207, 1742, 0, 132, 0, 7035,
+    0, 0, 2535, 0, 3194, 0, 5846, 0, 4648, 0, 0, 0, 278, 0, 111, 2503,
+    159, 97, 0, 3988, 3776, 3185, 4343, 0, 6232, 0, 4021, 277, 221, 0, 2039, 5086,
+    2682, 0, 0, 189, 0, 83, 2271, 0, 0, 3229, 3128, 0, 2497, 291, 194, 0,
+    2484, 62, 2733, 86, 4307, 0, 2150, 0, 2159, 2513, 2206, 300, 0, 0, 2349, 39,
+    7009, 2472, 234, 304, 3252, 3766, 0, 2419, 3117, 240, 4577, 3103, 2469, 0, 2857, 0,
+    0, 0, 2205, 2512, 2737, 2644, 0, 5587, 2744, 191, 0, 1602, 198, 1687, 1603, 3557,
+    169, 4718, 4922, 239, 2757, 2694, 0, 311, 3867, 2771, 0, 199, 0, 0, 96, 2634,
+    2880, 0, 0, 25, 5747, 2897, 0, 3654, 4454, 317, 302, 1963, 0, 262, 6186, 4923,
+    172, 1847, 0, 1978, 3937, 320, 36, 0, 2835, 0, 0, 0, 3219, 3227, 2083, 6686,
+    0, 0, 3040, 1895, 2104, 2855, 1941, 238, 3143, 24, 2857, 96, 0, 5774, 128, 0,
+    2190, 0, 2601, 0, 6484, 181, 2407, 4817, 240, 1809, 48, 239, 15, 2502, 0, 2501,
+    0, 0, 5371, 313, 0, 0, 96, 297, 306, 0, 47, 2691, 0, 0, 2404, 0,
+    4772, 1742, 0, 87, 259, 3327, 78, 267, 0, 2611, 3832, 11, 5530, 2225, 251, 0,
+    0, 3345, 3161, 187, 0, 2737, 0, 116, 0, 6251, 219, 0, 0, 216, 250, 0,
+    2953, 0, 3426, 3063, 295, 0, 239, 2273, 5004, 2538, 2930, 2932, 207, 3139, 165, 5696,
+    206, 0, 7046, 262, 2535, 5407, 5539, 3241, 281, 298, 7223, 2966, 0, 3309, 0, 210,
+    0, 0, 3229, 1775, 2293, 250, 4666, 4878, 188, 0, 0, 314, 217, 0, 0, 2743,
+    0, 6022, 197, 2658, 229, 3087, 2206, 2009, 3252, 0, 4307, 144, 315, 273, 3162, 0,
+    205, 0, 2600, 2557, 2952, 2821, 3067, 0, 1606, 2271, 0, 2762, 0, 3881, 0, 198,
+    2842, 2150, 1755, 6826, 291, 1634, 1687, 0, 2790, 2809, 0, 6067, 4455, 2139, 2481, 3390,
+    0, 3034, 3441, 107, 2341, 96, 2685, 1600, 0, 0, 239, 2634, 4309, 1906, 3619, 3073,
+    6376, 0, 2336, 36, 136, 1985, 6679, 25, 2842, 2952, 185, 291, 4271, 3175, 0, 0,
+    2659, 2791, 215, 0, 3786, 0, 4921, 3010, 5967, 0, 0, 3546, 199, 283, 2811, 4850,
+    0, 0, 0, 0, 3208, 0, 3029, 0, 0, 0, 0, 3282, 2666, 0, 5363, 0,
+    3140, 0, 0, 2856, 0, 0, 0, 0, 5768, 0, 0, 194, 3040, 0, 0, 198,
+    2010, 191, 95, 5189, 0, 88, 1809, 1980, 2512, 2623, 0, 1808, 1877, 6800, 0, 0,
+    2537, 3328, 266, 0, 2934, 268, 2900, 0, 0, 0, 4426, 0, 251, 240, 305, 233,
+    174, 294, 2580, 3299, 0, 2812, 2722, 2491, 2668, 5307, 4893, 1840, 1830, 3411, 2547, 3195,
+    2357, 0, 5697, 280, 238, 6023, 0, 2697, 4534, 5021, 0, 4264, 4437, 183, 0, 2273,
+    5371, 2963, 214, 317, 5225, 1996, 5890, 2627, 0, 202, 2714, 210, 2766, 6805, 0, 2557,
+    2534, 1640, 3833, 205, 2739, 5442, 0, 83, 2810, 3556, 1677, 290, 0, 0, 183, 252,
+    0, 1940, 0, 322, 2659, 2139, 0, 1954, 3228, 2270, 219, 279, 3602, 4206, 3612, 7016,
+    2899, 2793, 27, 12, 1623, 193, 112, 0, 2842, 193, 0, 0, 2150, 1604, 3304, 6420,
+    0, 2974, 100, 6190, 295, 35, 3249, 2404, 277, 0, 3021, 3151, 3129, 201, 313, 0,
+    6031, 5967, 275, 2606, 0, 0, 262, 135, 0, 0, 318, 1908, 193, 4471, 0, 3161,
+    6694, 221, 235, 2579, 25, 2502, 284, 0, 0, 2578, 0, 183, 2215, 2934, 284, 5846,
+    167, 4235, 206, 6102, 3125, 0, 192, 3800, 283, 0, 5978, 122, 1676, 2600, 2758, 72,
+    0, 119, 0, 277, 240, 297, 5626, 0, 111, 1754, 59, 221, 0, 0, 245, 3282,
+    2284, 2292, 2845, 4273, 86, 0, 0, 0, 2999, 0, 0, 135, 2490, 2140, 0, 0,
+    0, 32, 4877, 1602, 2965, 5581, 0, 3046, 0, 6838, 2700, 3008, 238, 4219, 2776, 0,
+    178, 2902, 2591, 268, 2800, 193, 0, 4667, 2093, 0, 3345, 2541, 3383, 0, 209, 306,
+    301, 2767, 4869, 4541, 2823, 307, 1841, 2484, 2471, 1608, 0, 2722, 6728, 265, 1609, 2603,
+    0, 2736, 6120, 1689, 23, 182, 2860, 3077, 3030, 3075, 4665, 0, 0, 3184, 2225, 3073,
+    3241, 3262, 1744, 3647, 0, 2936, 215, 167, 1605, 0, 2658, 2486, 71, 0, 158, 223,
+    2721, 2413, 4868, 317, 29, 0, 2848, 5452, 2864, 0, 3194, 3856, 0, 14, 0, 3109,
+    1677, 2078, 1648, 258, 6499, 0, 290, 0, 5848, 5812, 4902, 0, 6194, 0, 3065, 297,
+    0, 5115, 186, 138, 60, 2902, 214, 2875, 1887, 196, 5370, 0, 2470, 0, 1640, 275,
+    295, 5978, 6478, 1829, 3318, 11, 2745, 2027, 5333, 2283, 2842, 0, 0, 311, 63, 0,
+    2548, 2633, 210, 257, 83, 2366, 211, 184, 4364, 0, 1819, 0, 136, 277, 1874, 2139,
+    2018, 0, 2579, 3161, 11, 2501, 0, 315, 2627, 3631, 0, 2514, 6393, 18, 2589, 2215,
+    260, 5088, 2357, 0, 2679, 0, 96, 2690, 156, 2138, 3801, 292, 5629, 3184, 0, 0,
+    0, 0, 2234, 0, 120, 2952, 1601, 1706, 1821, 230, 3330, 0, 2524, 3356, 201, 6816,
+    6209, 89, 2758, 213, 0, 1880, 111, 0, 0, 3931, 4656, 2161, 2711, 135, 0, 5993,
+    1604, 6030, 0, 304, 6399, 112, 7091, 2602, 2569, 5773, 0, 1708, 283, 2744, 5195, 2093,
+    4592, 2569, 0, 180, 228, 0, 2677, 0, 2757, 4428, 2680, 2831, 0, 0, 167, 0,
+    2817, 3662, 0, 5251, 3251, 2834, 3987, 2957, 2652, 2562, 0, 1746, 0, 2662, 265, 2798,
+    0, 0, 186, 3098, 5805, 2205, 6300, 1864, 4506, 2868, 2722, 3562, 222, 3183, 3283, 5165,
+    1743, 2745, 2501, 3238, 0, 0, 4432, 0, 300, 311, 18, 0, 0, 0, 280, 2612,
+    4498, 2864, 3066, 0, 0, 2776, 267, 196, 0, 0, 1648, 4703, 3109, 2844, 0, 0,
+    0, 0, 290, 5341, 1897, 3150, 5746, 2765, 0, 2413, 0, 0, 146, 2678, 5131, 2549,
+    0, 2470, 0, 109, 3064, 0, 182, 227, 289, 5372, 3565, 0, 0, 213, 1605, 0,
+    2736, 3271, 0, 280, 0, 311, 0, 0, 4005, 0, 0, 3063, 0, 4208, 2886, 0,
+    1820, 2084, 2690, 0, 6436, 274, 2732, 0, 4647, 4278, 0, 2734, 5886, 0, 299, 51,
+    170, 2516, 233, 2285, 1764, 266, 2524, 3018, 156, 0, 120, 158, 74, 2835, 3573, 3198,
+    2745, 1697, 270, 3306, 2556, 2713, 1607, 2111, 0, 0, 0, 0, 4870, 5593, 4782, 4987,
+    0, 1650, 114, 4391, 111, 4247, 2978, 3077, 0, 5159, 0, 3194, 0, 5814, 4087, 216,
+    0, 11, 0, 2996, 3183, 135, 2711, 218, 6151, 0, 3117, 5968, 6001, 319, 0, 3057,
+    2087, 5760, 2607, 233, 2340, 3150, 2721, 3240, 6404, 6279, 0, 285, 260, 2648, 2798, 0,
+    6524, 3910, 1727, 0, 0, 5527, 95, 0, 7148, 2469, 0, 2941, 3078, 2600, 3040, 187,
+    0, 13, 204, 248, 2403, 4481, 0, 3988, 24, 5195, 61, 0, 3996, 2528, 2757, 0,
+    0, 2759, 175, 47, 3283, 232, 2969, 193, 2504, 120, 0, 2205, 5634, 0, 2149, 2989,
+    3316, 4702, 0, 2589, 4436, 2578, 2027, 2683, 183, 2725, 2569, 64, 2845, 2207, 3109, 259,
+    0, 0, 4026, 92, 0, 293, 3068, 5966, 115, 0, 294, 2160, 2843, 3253, 2243, 73,
+    0, 3769, 3000, 2755, 2886, 3216, 283, 2473, 255, 0, 182, 3580, 3120, 304, 72, 0,
+    251, 189, 2474, 2954, 0, 0, 6074, 0, 3338, 0, 0, 0, 2832, 56, 4711, 4321,
+    3462, 0, 5818, 3868, 2027, 2493, 5748, 3174, 0, 2908, 1641, 4315, 3282, 0, 0, 4156,
+    3230, 0, 72, 74, 277, 306, 26, 2371, 1753, 322, 3866, 2272, 65, 5643, 4921, 1912,
+    224, 0, 3029, 0, 5310, 2867, 169, 266, 0, 2556, 5526, 155, 198, 0, 1825, 2152,
+    5421, 224, 6743, 306, 2705, 3130, 2125, 2831, 98, 2777, 24, 4792, 3710, 2612, 0, 233,
+    1609, 3221, 0, 115, 1699, 7376, 3999, 4481, 2339, 168, 0, 0, 181, 2622, 0, 0,
+    2923, 141, 0, 2635, 4101, 3275, 1614, 2523, 11, 37, 0, 319, 2007, 0, 2447, 0,
+    0, 2743, 2403, 0, 2944, 1608, 5385, 0, 4050, 73, 190, 258, 2836, 3426, 0, 47,
+    0, 0, 4673, 2018, 0, 312, 187, 217, 2789, 5171, 3206, 1607, 2406, 2688, 177, 5208,
+    1688, 292, 0, 0, 3187, 0, 0, 1612, 175, 0, 2761, 4323, 0, 1812, 4285, 0,
+    2210, 5970, 35, 5691, 3242, 0, 0, 3070, 2970, 110, 2877, 29, 3382, 4704, 244, 4967,
+    321, 225, 3229, 3254, 315, 2814, 240, 2644, 276, 0, 2255, 6882, 2501, 0, 0, 315,
+    2624, 231, 3337, 229, 299, 0, 0, 2469, 73, 2374, 273, 0, 5855, 1601, 4966, 3162,
+    0, 208, 0, 0, 0, 2723, 0, 16, 2803, 5526, 3106, 72, 0, 1601, 220, 2151,
+    176, 1603, 2084, 1606, 99, 0, 0, 0, 189, 2798, 0, 0, 0, 0, 1694, 0,
+    6940, 3184, 2850, 3887, 4445, 5968, 3250, 0, 2558, 0, 0, 247, 53, 4921, 2528, 0,
+    3042, 233, 2336, 2811, 0, 6722, 61, 4436, 36, 0, 3179, 0, 2350, 2423, 6081, 0,
+    0, 0, 266, 2869, 1601, 2143, 2989, 169, 192, 49, 0, 0, 2987, 35, 2670, 2441,
+    253, 312, 0, 0, 1609, 2908, 4785, 3151, 0, 0, 2666, 314, 264, 2226, 2647, 283,
+    3286, 0, 228, 2745, 3785, 4001, 0, 0, 4129, 0, 71, 314, 4065, 2402, 0, 4102,
+    308, 3990, 3174, 0, 0, 2872, 0, 3549, 5946, 5598, 0, 2699, 0, 0, 0, 2853,
+    1680, 0, 2645, 184, 1763, 2300, 0, 0, 272, 1745, 2935, 0, 0, 2018, 0, 5312,
+    0, 3435, 2535, 0, 2582, 4135, 4876, 0, 244, 0, 3217, 3139, 1885, 4680, 0, 0,
+    3381, 3264, 4535, 2503, 217, 131, 3190, 0, 2051, 0, 0, 0, 0, 3118, 2291, 3282,
+    1962, 307, 2923, 2734, 2074, 3298, 0, 1601, 278, 2877, 1610, 0, 0, 1608, 0, 2899,
+    194, 3646, 0, 0, 303, 0, 270, 2405, 2523, 0, 243, 5086, 1753, 2749, 83, 302,
+    0, 2909, 3211, 0, 2649, 2689, 2360, 0, 0, 3196, 7121, 0, 3023, 0, 3030, 0,
+    205, 5105, 3041, 3261, 0, 261, 3602, 2635, 2765, 2138, 143, 2155, 6904, 72, 0, 0,
+    4569, 195, 0, 4447, 0, 171, 0, 209, 0, 0, 0, 0, 144, 4930, 0, 3033,
+    5972, 167, 0, 0, 2822, 0, 3250, 2744, 5361, 0, 0, 0, 224, 2073, 199, 2833,
+    0, 95, 5526, 0, 0, 6699, 1600, 31, 6045, 1602, 219, 148, 0, 2292, 6768, 2991,
+    6066, 4172, 1603, 0, 0, 0, 283, 2725, 3308, 3295, 2657, 0, 0, 3821, 2891, 172,
+    245, 0, 0, 3053, 0, 289, 3142, 294, 124, 2649, 0, 0, 3794, 0, 1609, 231,
+    0, 2986, 0, 300, 86, 1602, 0, 113, 125, 6186, 0, 0, 3768, 0, 170, 2074,
+    5869, 259, 221, 2225, 2045, 0, 309, 227, 3030, 5607, 0, 3008, 3326, 2281, 3428, 176,
+    2302, 173, 0, 282, 0, 0, 0, 2594, 2853, 3216, 2094, 3043, 2568, 0, 4261, 2020,
+    3106, 246, 4660, 2006, 2914, 2591, 0, 1769, 147, 0, 4674, 301, 3033, 4140, 49, 228,
+    3385, 2228, 238, 250, 2769, 3111, 0, 2072, 4547, 0, 3311, 3824, 2688, 0, 5316, 3690,
+    296, 2701, 1608, 50, 0, 2779, 191, 5801, 2876, 0, 0, 194, 0, 3265, 237, 0,
+    2820, 0, 1772, 2523, 0, 3164, 2552, 3646, 85, 322, 0, 207, 204, 0, 279, 322,
+    2963, 0, 4885, 6194, 1744, 134, 0, 5560, 3288, 0, 287, 0, 6069, 161, 0, 235,
+    188, 2919, 73, 100, 76, 5096, 186, 2159, 4934, 3097, 71, 5379, 2029, 0, 2503, 2932,
+    4449, 4570, 2732, 5831, 2746, 0, 3548, 4043, 4216, 0, 0, 0, 0, 236, 0, 3036,
+    3778, 2073, 2993, 180, 309, 2295, 6358, 3029, 217, 2756, 184, 278, 0, 2899, 288, 0,
+    0, 216, 1676, 0, 1698, 249, 0, 2118, 95, 2517, 0, 119, 0, 3298, 5106, 2920,
+    3336, 2677, 0, 0, 292, 219, 0, 2682, 0, 98, 2515, 0, 5306, 0, 294, 0,
+    2898, 0, 131, 61, 4482, 0, 0, 1953, 0, 2655, 276, 2651, 255, 0, 5601, 2787,
+    3043, 4225, 3151, 4342, 0, 0, 172, 0, 0, 1622, 157, 4687, 2057, 4887, 2956, 0,
+    0, 0, 182, 145, 53, 2744, 2469, 6039, 0, 2414, 2558, 2580, 3163, 6238, 0, 2095,
+    0, 3088, 2468, 3038, 258, 0, 0, 0, 0, 2302, 2844, 6203, 171, 3110, 2768, 3283,
+    228, 5554, 0, 0, 0, 5801, 0, 6230, 5150, 2413, 3610, 0, 5326, 7097, 215, 2843,
+    294, 60, 2712, 3737, 4527, 265, 0, 2525, 173, 1601, 3086, 2688, 0, 3101, 0, 0,
+    2732, 193, 203, 2780, 2750, 2083, 2556, 0, 287, 2809, 3604, 1940, 314, 4511, 2933, 4888,
+    2624, 3164, 1747, 3767, 4206, 284, 227, 5009, 5442, 0, 65, 5105, 0, 1811, 201, 259,
+    3657, 0, 1625, 183, 0, 235, 2765, 3150, 250, 0, 1780, 226, 0, 2766, 0, 320,
+    5325, 264, 1787, 2591, 1898, 132, 3097, 0, 249, 5393, 120, 2978, 0, 0, 0, 2820,
+    0, 119, 0, 3163, 270, 0, 3826, 6351, 0, 0, 2028, 280, 95, 3009, 0, 1943,
+    75, 2931, 188, 2770, 163, 288, 0, 3297, 0, 0, 277, 2899, 3205, 4651, 2567, 246,
+    0, 0, 0, 2738, 0, 200, 2168, 0, 0, 2955, 109, 2072, 0, 3340, 0, 2751,
+    0, 150, 5142, 2504, 0, 207, 1876, 2518, 2286, 3398, 1905, 194, 23, 2898, 2112, 235,
+    2778, 84, 4484, 3294, 3316, 0, 2549, 237, 0, 5536, 7014, 6238, 0, 2468, 6474, 0,
+    7217, 157, 2534, 1697, 3117, 179, 177, 2624, 2735, 3198, 247, 258, 0, 0, 298, 0,
+    175, 318, 4086, 0, 55, 2770, 2798, 4983, 1612, 2414, 2558, 3163, 84, 0, 0, 2270,
+    3162, 0, 304, 0, 3090, 0, 3830, 0, 4279, 24, 61, 3129, 0, 2615, 268, 3132,
+    3022, 0, 6240, 2347, 2724, 4207, 242, 5862, 0, 13, 228, 284, 0, 5151, 2086, 1633,
+    196, 2930, 3011, 209, 3122, 173, 209, 257, 2603, 0, 0, 301, 0, 3238, 3789, 0,
+    1810, 4438, 5378, 3020, 3915, 2083, 2655, 0, 1944, 4701, 5567, 287, 221, 134, 121, 3113,
+    3217, 5670, 5966, 5235, 6534, 0, 0, 225, 183, 0, 3556, 2679, 2998, 0, 218, 2469,
+    3150, 0, 170, 1899, 0, 0, 0, 0, 0, 2954, 250, 2404, 0, 2032, 0, 0,
+    0, 159, 259, 123, 255, 3771, 4748, 2723, 0, 3574, 0, 2580, 4270, 258, 0, 2007,
+    251, 59, 3096, 76, 2788, 3106, 1889, 242, 1608, 0, 2897, 2548, 203, 131, 295, 5449,
+    0, 2779, 0, 309, 6196, 0, 4491, 2825, 298, 6888, 2493, 145, 39, 254, 5098, 5746,
+    74, 2701, 3074, 5003, 2898, 263, 2171, 198, 178, 3905, 2948, 1678, 3434, 2964, 5307, 0,
+    2471, 316, 1838, 293, 4229, 178, 4350, 104, 3391, 3133, 232, 3065, 0, 2866, 6109, 5143,
+    1700, 2492, 4486, 107, 5536, 2581, 2743, 3209, 7056, 0, 1613, 5766, 2733, 2777, 5889, 40,
+    168, 2670, 223, 2622, 3174, 2638, 2483, 3007, 1615, 5471, 1821, 201, 3838, 134, 24, 0,
+    277, 254, 261, 303, 176, 3251, 279, 1808, 306, 181, 156, 217, 0, 4095, 4922, 0,
+    0, 3547, 2600, 0, 316, 2019, 2793, 0, 2988, 0, 1604, 0, 0, 3023, 5423, 2669,
+    0, 155, 2859, 188, 0, 4453, 0, 0, 0, 65, 0, 186, 1756, 3463, 0, 0,
+    3618, 0, 193, 5386, 1814, 240, 0, 0, 3229, 2809, 4262, 0, 3400, 318, 254, 2711,
+    0, 211, 4924, 1926, 2644, 6074, 0, 2625, 6231, 0, 3065, 5414, 2679, 189, 5756, 3354,
+    112, 2085, 5306, 0, 0, 2469, 2721, 3558, 282, 4646, 0, 2560, 170, 4978, 4332, 124,
+    191, 0, 2754, 70, 3319, 0, 315, 0, 15, 3062, 3610, 1846, 0, 2921, 180, 178,
+    3317, 282, 0, 2425, 2723, 1604, 0, 2921, 2614, 0, 0, 2358, 6798, 252, 160, 4050,
+    2525, 0, 2677, 4291, 0, 2551, 3967, 1970, 0, 247, 0, 0, 210, 3206, 301, 36,
+    5536, 2813, 0, 0, 0, 0, 4925, 4042, 206, 5826, 3197, 5089, 0, 2677, 3062, 3132,
+    2833, 254, 300, 319, 1961, 7238, 2740, 5142, 304, 5362, 1831, 3212, 3042, 3405, 0, 7061,
+    6038, 1877, 201, 14, 2624, 3567, 2523, 0, 2747, 0, 0, 2404, 0, 5966, 1611, 0,
+    181, 0, 0, 178, 119, 2172, 0, 0, 270, 3831, 5883, 0, 2743, 5765, 0, 0,
+    226, 257, 232, 232, 2525, 3174, 2677, 2506, 312, 5747, 286, 0, 2036, 219, 2888, 0,
+    3276, 107, 0, 139, 2726, 2492, 3151, 4240, 0, 135, 1681, 0, 0, 2024, 2590, 1606,
+    2535, 0, 5527, 2833, 3618, 2932, 3097, 2670, 0, 2800, 2548, 3498, 5664, 303, 3393, 1885,
+    0, 317, 2641, 2226, 5097, 0, 133, 6610, 0, 3073, 1714, 204, 4876, 0, 3023, 299,
+    0, 2218, 3229, 2236, 1605, 0, 3196, 3307, 6718, 0, 241, 0, 0, 0, 2291, 2075,
+    200, 200, 2628, 2646, 0, 3683, 223, 0, 4665, 3002, 2754, 3040, 2910, 3346, 5306, 0,
+    310, 263, 113, 3062, 0, 0, 147, 159, 0, 6076, 197, 0, 2176, 2887, 49, 4611,
+    2832, 0, 0, 2799, 261, 2440, 5857, 3620, 177, 2623, 145, 2495, 3551, 5113, 1610, 4879,
+    0, 167, 0, 3329, 0, 3032, 2727, 182, 6202, 71, 2138, 3136, 2952, 2865, 0, 2525,
+    0, 36, 0, 2472, 0, 2975, 3107, 2827, 2552, 0, 157, 4041, 199, 0, 1839, 7311,
+    120, 2800, 108, 2996, 2945, 6386, 1688, 4754, 2338, 0, 3776, 0, 6047, 3165, 6778, 1676,
+    0, 320, 271, 3239, 0, 6266, 1604, 2661, 1972, 2983, 2646, 2368, 2413, 2557, 0, 5363,
+    5811, 3062, 0, 0, 2710, 3315, 123, 226, 2669, 14, 279, 278, 285, 0, 4426, 2660,
+    198, 157, 2556, 3044, 0, 2810, 0, 0, 0, 2699, 4059, 319, 2077, 4666, 2493, 241,
+    3216, 186, 2611, 95, 2229, 137, 2037, 286, 4013, 212, 88, 294, 6575, 2678, 0, 285,
+    3064, 3121, 0, 35, 0, 0, 181, 0, 107, 5820, 301, 291, 3476, 2567, 2933, 0,
+    39, 1631, 238, 2554, 0, 0, 2482, 3296, 144, 4526, 0, 212, 4810, 0, 2703, 2352,
+    200, 0, 0, 0, 0, 257, 3416, 1682, 3119, 4266, 2799, 0, 5803, 2432, 0, 5099,
+    0, 2612, 195, 0, 0, 3183, 4762, 302, 3008, 5318, 2593, 2590, 3611, 0, 2871, 0,
+    5665, 2376, 2669, 0, 6000, 2754, 98, 3685, 0, 1952, 3228, 3360, 0, 0, 4090, 162,
+    0, 220, 197, 2963, 3227, 267, 2162, 2846, 5187, 2183, 5002, 71, 6093, 5123, 0, 1621,
+    4941, 322, 276, 0, 4052, 0, 5307, 49, 2362, 4960, 1600, 2509, 3304, 4616, 0, 0,
+    0, 0, 6032, 5581, 316, 2920, 4218, 186, 1707, 177, 2339, 2943, 0, 0, 3097, 5381,
+    0, 6417, 4876, 4045, 0, 1716, 0, 2006, 2798, 284, 2759, 235, 3007, 0, 2291, 83,
+    97, 0, 0, 0, 0, 190, 0, 4528, 216, 0, 192, 3101, 75, 1690, 0, 3348,
+    0, 5088, 0, 3874, 4867, 5976, 0, 4006, 4725, 0, 276, 2646, 0, 0, 221, 233,
+    0, 4646, 266, 4371, 16, 123, 285, 2673, 2282, 1632, 4907, 208, 35, 315, 0, 0,
+    254, 0, 2985, 0, 2832, 2556, 236, 3048, 0, 0, 2909, 2710, 157, 278, 182, 0,
+    3064, 5786, 264, 137, 2474, 0, 3076, 2965, 0, 2496, 0, 2559, 0, 172, 145, 2584,
+    2644, 3779, 2678, 4490, 0, 0, 0, 3285, 3122, 0, 2010, 0, 0, 0, 207, 213,
+    120, 2468, 3998, 265, 2734, 2933, 6294, 212, 0, 3030, 3075, 5158, 2413, 0, 0, 2644,
+    238, 1608, 0, 0, 0, 2930, 5334, 5802, 5528, 2799, 2434, 2629, 2006, 2613, 195, 0,
+    0, 1743, 3154, 0, 158, 1611, 150, 2589, 2743, 2716, 0, 291, 2689, 3780, 2675, 0,
+    3167, 3275, 3725, 3188, 2657, 0, 258, 0, 1600, 2879, 2910, 5116, 4015, 2700, 62, 3216,
+    2177, 2630, 181, 2282, 1886, 2946, 1676, 5010, 3144, 0, 0, 320, 0, 1781, 2854, 3183,
+    3260, 3117, 0, 4437, 48, 23, 2592, 0, 119, 3097, 2093, 0, 5470, 119, 2887, 2766,
+    143, 189, 0, 6395, 3194, 1632, 0, 1763, 96, 5994, 1707, 2633, 3272, 0, 181, 205,
+    71, 6352, 3316, 0, 3283, 2491, 83, 0, 0, 28, 195, 297, 2547, 0, 4756, 4867,
+    0, 2957, 3372, 0, 6296, 272, 2617, 280, 0, 0, 4726, 0, 11, 1920, 2855, 2415,
+    194, 0, 0, 1602, 2955, 251, 5090, 224, 0, 0, 0, 2038, 6188, 75, 2848, 4702,
+    0, 5635, 207, 0, 42, 109, 4020, 2271, 0, 4867, 0, 3251, 5553, 0, 199, 0,
+    129, 42, 2484, 1754, 3029, 157, 1709, 0, 0, 0, 4565, 0, 2733, 5186, 187, 6102,
+    228, 2781, 7008, 304, 310, 0, 2920, 0, 38, 1609, 0, 5347, 2418, 292, 171, 220,
+    0, 231, 281, 0, 2602, 0, 2822, 0, 0, 212, 2644, 3867, 2690, 2205, 0, 265,
+    2942, 2347, 3876, 2529, 4209, 0, 310, 3063, 20, 0, 1656, 0, 5151, 0, 196, 0,
+    234, 2864, 2869, 2919, 120, 36, 2617, 5529, 4493, 2680, 0, 0, 5571, 2514, 7347, 0,
+    0, 0, 2702, 2470, 1963, 1765, 1743, 3238, 6686, 0, 4008, 209, 5746, 4703, 96, 5165,
+    2603, 239, 4439, 1895, 2746, 238, 2878, 1606, 3566, 24, 1904, 2647, 3260, 308, 273, 3143,
+    3327, 317, 2587, 2948, 2407, 2527, 3106, 2887, 0, 239, 0, 0, 2986, 0, 0, 2271,
+    3556, 180, 0, 5450, 0, 4646, 2481, 85, 2076, 0, 2007, 280, 0, 15, 0, 240,
+    0, 2571, 0, 5492, 2547, 253, 6372, 1723, 2479, 2734, 87, 0, 0, 2935, 289, 246,
+    0, 3989, 176, 3096, 170, 0, 74, 223, 216, 2490, 4446, 3141, 0, 5308, 0, 2743,
+    3315, 272, 77, 5759, 2316, 0, 2950, 78, 0, 2282, 3187, 6110, 2932, 2977, 268, 3155,
+    251, 4122, 2985, 0, 4768, 4396, 1829, 0, 0, 3382, 206, 2689, 3309, 123, 3197, 0,
+    5647, 2102, 154, 2886, 4969, 2766, 189, 0, 0, 3293, 0, 4355, 5932, 202, 5186, 0,
+    0, 0, 0, 188, 1774, 0, 3118, 0, 4270, 3240, 2855, 0, 181, 7042, 2084, 2909,
+    3131, 2503, 2482, 3867, 48, 255, 0, 3337, 2009, 2626, 156, 207, 0, 4058, 4225, 3076,
+    2644, 3161, 5150, 4031, 4308, 232, 2897, 0, 74, 291, 0, 206, 2656, 0, 0, 265,
+    0, 0, 256, 2685, 193, 0, 2272, 0, 0, 6276, 0, 205, 2821, 0, 193, 203,
+    284, 4454, 2811, 5967, 191, 183, 2842, 6679, 0, 292, 295, 4720, 0, 259, 2149, 62,
+    2880, 11, 3581, 0, 2890, 0, 2403, 250, 0, 2765, 2648, 300, 199, 0, 0, 2234,
+    2476, 3766, 2536, 2919, 0, 2999, 0, 3823, 0, 2650, 5086, 272, 305, 3559, 4440, 0,
+    0, 0, 4430, 3121, 1746, 0, 0, 0, 177, 0, 5966, 0, 175, 2481, 6066, 0,
+    0, 3869, 283, 0, 0, 0, 0, 3557, 0, 6799, 240, 2855, 227, 0, 0, 2526,
+    1631, 2602, 3140, 88, 2974, 2881, 3044, 0, 0, 1979, 306, 5810, 0, 0, 0, 0,
+    5310, 0, 5917, 277, 5307, 3118, 5371, 2835, 209, 3189, 2523, 37, 0, 0, 0, 3282,
+    5696, 1606, 6688, 234, 2107, 280, 214, 268, 4534, 2899, 0, 3426, 1623, 251, 1965, 0,
+    3655, 0, 176, 7252, 246, 0, 202, 2535, 321, 181, 201, 1832, 3029, 4208, 185, 0,
+    2854, 0, 2743, 2622, 0, 238, 3883, 1611, 0, 5648, 2271, 2530, 0, 3274, 3832, 183,
+    3143, 2766, 2433, 2044, 1954, 0, 270, 174, 1757, 167, 317, 5190, 2747, 125, 4153, 219,
+    3293, 2656, 1940, 237, 0, 4217, 2482, 1877, 2075, 0, 6470, 5407, 0, 5153, 27, 319,
+    3151, 2403, 247, 1758, 36, 2310, 2110, 0, 2270, 83, 5598, 0, 3021, 2932, 3205, 5750,
+    3767, 0, 225, 59, 175, 4131, 0, 0, 0, 2605, 4878, 5967, 1605, 0, 4467, 0,
+    6693, 0, 0, 2611, 238, 0, 52, 298, 3328, 0, 47, 289, 3161, 0, 133, 2501,
+    316, 6834, 0, 13, 0, 315, 2591, 0, 0, 0, 2237, 0, 1810, 0, 2765, 0,
+    0, 2481, 2366, 0, 4310, 0, 205, 2811, 0, 267, 2656, 295, 221, 3126, 36, 0,
+    227, 0, 220, 0, 3447, 0, 0, 109, 2531, 3787, 0, 2845, 2800, 1820, 3184, 84,
+    277, 2952, 2854, 4272, 0, 0, 199, 2954, 3250, 3035, 0, 0, 3294, 289, 2012, 0,
+    3044, 88, 209, 3046, 3328, 4656, 6681, 2348, 0, 5317, 184, 0, 0, 133, 1992, 0,
+    2603, 6067, 0, 2471, 0, 4234, 0, 0, 0, 1840, 6021, 2844, 0, 0, 1875, 0,
+    5727, 253, 2006, 0, 2615, 3075, 0, 6388, 4534, 2724, 2647, 169, 2779, 5900, 198, 5846,
+    0, 1677, 87, 0, 0, 264, 6267, 202, 0, 2699, 3051, 3285, 14, 4498, 1833, 2388,
+    4789, 308, 0, 254, 198, 0, 2935, 4426, 0, 303, 3852, 268, 222, 0, 196, 0,
+    0, 95, 2052, 101, 3603, 290, 0, 3546, 0, 5086, 12, 2501, 261, 71, 4483, 6498,
+    5100, 2854, 5766, 4895, 2580, 138, 2864, 3021, 3647, 2470, 0, 35, 2117, 3217, 0, 1699,
+    3084, 3128, 11, 0, 5333, 2311, 40, 5107, 0, 290, 1688, 280, 0, 3768, 1896, 4536,
+    2225, 0, 267, 1887, 297, 2402, 0, 321, 182, 2468, 1640, 3336, 309, 211, 280, 1823,
+    0, 5361, 107, 0, 5318, 1604, 0, 3128, 0, 0, 3161, 305, 0, 0, 311, 3208,
+    0, 0, 1623, 255, 4869, 0, 1956, 2432, 270, 5993, 2568, 6031, 3065, 146, 0, 2534,
+    0, 0, 4877, 3806, 2546, 2486, 100, 0, 4206, 313, 0, 5031, 4866, 0, 7029, 2679,
+    6812, 298, 2281, 0, 2847, 195, 0, 29, 242, 87, 4975, 2967, 2556, 0, 213, 17,
+    274, 0, 0, 3209, 109, 205, 3250, 284, 0, 1879, 2744, 5202, 5773, 0, 185, 2482,
+    3996, 3007, 3047, 4543, 192, 3249, 2606, 0, 4262, 4220, 133, 2913, 235, 6704, 0, 3800,
+    3285, 295, 6081, 0, 6021, 242, 0, 1860, 3987, 0, 2689, 3177, 2781, 0, 4605, 2976,
+    0, 1691, 2944, 4505, 2711, 221, 0, 110, 3266, 3930, 2736, 4945, 5978, 0, 0, 2652,
+    5749, 0, 172, 1689, 2140, 6268, 257, 132, 3661, 300, 17, 3986, 66, 0, 282, 0,
+    2967, 1649, 4911, 0, 2207, 254, 0, 3077, 3271, 3327, 0, 158, 122, 2788, 2965, 0,
+    0, 0, 0, 290, 87, 1773, 3249, 4783, 1811, 146, 196, 316, 2937, 2591, 0, 2678,
+    0, 0, 61, 238, 0, 2866, 73, 0, 3008, 3064, 0, 0, 6714, 2470, 2666, 6366,
+    0, 265, 3150, 1608, 0, 0, 185, 0, 0, 0, 0, 2844, 3030, 4314, 0, 0,
+    182, 241, 174, 3649, 3085, 2471, 321, 0, 2151, 1874, 3142, 4647, 2006, 0, 3018, 2468,
+    2225, 4500, 3490, 214, 84, 0, 0, 1607, 0, 322, 2578, 5229, 2357, 0, 5851, 2867,
+    2178, 0, 0, 200, 51, 258, 0, 74, 0, 5546, 186, 63, 233, 1763, 59, 0,
+    313, 3075, 0, 3548, 26, 261, 2886, 1622, 270, 214, 0, 2957, 5813, 2622, 266, 6477,
+    0, 280, 0, 223, 0, 1612, 3220, 248, 2556, 2096, 3210, 4868, 2405, 91, 109, 2831,
+    7112, 4747, 19, 0, 6520, 6400, 211, 6030, 2721, 2340, 185, 2637, 1687, 2633, 2711, 2725,
+    1887, 83, 0, 2622, 0, 2844, 5757, 11, 3811, 2141, 1610, 2889, 3029, 3988, 4939, 133,
+    96, 3194, 2941, 3196, 172, 2548, 0, 2679, 0, 132, 2848, 3997, 5370, 2974, 2781, 6215,
+    0, 1819, 0, 174, 0, 292, 3390, 2996, 223, 0, 0, 2712, 4657, 194, 0, 0,
+    119, 2864, 6305, 313, 0, 120, 0, 2834, 0, 222, 5966, 0, 5144, 0, 3052, 2958,
+    271, 4278, 0, 6131, 108, 27, 93, 175, 5196, 0, 0, 0, 0, 5634, 0, 282,
+    304, 3242, 228, 196, 2755, 2578, 1897, 226, 2655, 0, 0, 7182, 0, 0, 290, 0,
+    2228, 2470, 0, 5854, 5496, 3282, 0, 2473, 2205, 0, 288, 84, 3108, 2468, 73, 174,
+    2802, 2208, 0, 3315, 0, 174, 0, 0, 95, 3909, 294, 0, 0, 214, 3673, 5223,
+    189, 3186, 0, 72, 4211, 1651, 0, 0, 273, 2083, 0, 5166, 4280, 4278, 1788, 1942,
+    6742, 5545, 2824, 1766, 2868, 2870, 0, 3491, 319, 6194, 5414, 4516, 1601, 180, 179, 5818,
+    4746, 280, 224, 0, 24, 0, 5803, 1916, 5746, 5985, 2766, 2447, 0, 1764, 3153, 2866,
+    261, 1624, 0, 3305, 0, 4795, 275, 2194, 2876, 2767, 2659, 305, 0, 5375, 2666, 5037,
+    3221, 4711, 200, 5758, 2974, 2204, 2738, 26, 312, 3251, 3996, 3682, 2408, 2493, 3565, 2567,
+    2339, 1609, 0, 27, 0, 1614, 1940, 265, 0, 0, 3085, 190, 60, 0, 0, 6246,
+    3988, 232, 4872, 2519, 2142, 0, 2337, 4673, 2767, 4461, 1888, 2217, 4233, 2727, 131, 0,
+    0, 3547, 2534, 0, 0, 0, 0, 0, 260, 5308, 132, 0, 240, 2978, 2886, 5662,
+    4658, 208, 0, 235, 188, 3398, 2017, 194, 3382, 2836, 216, 3139, 4406, 0, 4088, 244,
+    170, 2549, 1612, 4124, 0, 216, 5591, 2970, 3185, 2505, 3018, 2545, 1952, 0, 3120, 2837,
+    0, 274, 315, 6156, 3316, 5642, 16, 3470, 260, 307, 1601, 2504, 2996, 2814, 4951, 2853,
+    2424, 2270, 218, 0, 3081, 3240, 3024, 119, 189, 2998, 74, 1601, 0, 0, 2523, 0,
+    0, 169, 0, 204, 229, 2475, 6039, 1603, 0, 1679, 5236, 2767, 0, 2539, 3095, 268,
+    193, 5160, 223, 2930, 2876, 53, 2359, 108, 3911, 5968, 2559, 2945, 2601, 282, 0, 2403,
+    4436, 6884, 2881, 2350, 5966, 2083, 4527, 0, 259, 183, 5549, 2875, 0, 67, 0, 2149,
+    26, 1942, 0, 6721, 0, 3263, 0, 0, 248, 314, 3250, 0, 2244, 0, 2611, 2987,
+    184, 5987, 0, 2798, 0, 4042, 2832, 243, 3306, 3586, 143, 2671, 3153, 3000, 3711, 0,
+    3200, 5748, 2755, 0, 0, 3198, 0, 4750, 2666, 0, 2788, 0, 4101, 3846, 3576, 283,
+    3271, 258, 2801, 0, 2493, 295, 155, 3286, 1614, 0, 0, 0, 2865, 5598, 2908, 0,
+    2645, 0, 1745, 3284, 0, 3282, 59, 5197, 2614, 5818, 0, 201, 4673, 293, 0, 0,
+    2867, 1645, 0, 97, 2988, 2073, 74, 1678, 0, 175, 5391, 2843, 5311, 2890, 271, 5583,
+    2699, 217, 110, 2218, 2469, 260, 3271, 2291, 0, 0, 277, 0, 3381, 3031, 50, 5669,
+    0, 0, 2923, 2336, 3602, 0, 3273, 0, 188, 3262, 3960, 4107, 0, 2622, 37, 0,
+    256, 307, 2912, 4710, 1952, 4649, 2480, 2545, 3107, 2626, 0, 3261, 2441, 2733, 31, 3275,
+    1608, 0, 3110, 2748, 1607, 0, 0, 48, 0, 2358, 1753, 0, 51, 0, 2570, 194,
+    0, 2449, 310, 229, 220, 2735, 0, 0, 0, 3030, 1607, 2523, 0, 2403, 1607, 6471,
+    4445, 3032, 0, 0, 156, 5825, 2646, 0, 3822, 35, 2692, 0, 0, 0, 2975, 6555,
+    5971, 0, 175, 2822, 0, 2561, 1854, 2028, 6764, 0, 119, 2426, 3353, 0, 281, 274,
+    2987, 3031, 0, 5087, 2688, 2501, 4921, 6051, 0, 315, 256, 225, 125, 208, 0, 1616,
+    2941, 0, 5096, 0, 306, 0, 172, 212, 3295, 3987, 2831, 2611, 16, 0, 253, 252,
+    0, 245, 0, 0, 3022, 3777, 3286, 0, 169, 0, 244, 228, 13, 0, 269, 0,
+    3150, 95, 220, 0, 0, 4563, 3306, 227, 0, 177, 0, 289, 2805, 2573, 0, 27,
+    0, 4050, 1876, 5326, 0, 3118, 3250, 0, 2941, 0, 0, 5606, 2745, 0, 2374, 180,
+    2594, 1951, 284, 0, 5582, 2856, 2350, 0, 2886, 0, 3042, 1606, 308, 2997, 50, 0,
+    2986, 2490, 5663, 2030, 1680, 0, 4071, 0, 168, 0, 172, 2872, 49, 6022, 201, 0,
+    3384, 4682, 51, 2613, 2954, 0, 253, 0, 4659, 3191, 3031, 2911, 6186, 4005, 314, 264,
+    0, 0, 3689, 2723, 2583, 3903, 5327, 294, 1607, 228, 0, 2074, 3821, 13, 76, 2702,
+    151, 2492, 0, 308, 4136, 2102, 3288, 71, 0, 245, 0, 322, 0, 159, 4112, 2699,
+    2688, 2603, 5780, 100, 2472, 134, 314, 188, 0, 198, 0, 3626, 309, 4227, 0, 5560,
+    4715, 202, 2571, 6504, 4876, 2941, 3217, 3111, 3602, 0, 3025, 278, 2920, 1721, 3163, 0,
+    235, 4569, 3073, 0, 0, 0, 143, 2908, 0, 3272, 133, 4831, 0, 5096, 39, 0,
+    0, 3768, 2402, 0, 2417, 0, 248, 0, 0, 2590, 249, 0, 0, 2756, 0, 217,
+    5364, 288, 127, 232, 0, 0, 303, 0, 2945, 1744, 3776, 3346, 256, 4648, 0, 0,
+    2443, 0, 292, 2682, 272, 194, 0, 0, 245, 0, 0, 2515, 145, 148, 2655, 5638,
+    2746, 286, 2729, 0, 1698, 0, 0, 2494, 5600, 0, 96, 2008, 0, 2623, 3336, 99,
+    2996, 86, 0, 2658, 1603, 195, 38, 2931, 0, 0, 3326, 0, 0, 4575, 2513, 2168,
+    0, 172, 0, 3296, 2094, 0, 2469, 2494, 300, 3305, 1951, 0, 0, 182, 284, 3117,
+    173, 5586, 0, 0, 108, 2744, 2349, 157, 5554, 0, 50, 0, 6350, 1602, 5986, 168,
+    0, 4974, 1603, 228, 0, 6230, 4190, 3250, 302, 0, 0, 1687, 0, 0, 220, 271,
+    0, 2413, 0, 239, 2557, 0, 0, 215, 2771, 6024, 0, 13, 3086, 5539, 257, 35,
+    300, 1608, 2657, 234, 6186, 201, 2857, 258, 0, 2810, 0, 0, 3030, 1606, 3936, 2502,
+    0, 2074, 197, 2104, 0, 1603, 2556, 4013, 161, 1811, 287, 3733, 2986, 5141, 0, 0,
+    269, 3064, 99, 2574, 1941, 3249, 1744, 6483, 134, 253, 3139, 3108, 61, 0, 250, 2678,
+    2755, 2613, 113, 0, 60, 0, 221, 0, 35, 183, 3767, 0, 0, 0, 2909, 47,
+    73, 2853, 3601, 2590, 5096, 0, 0, 4580, 1885, 1697, 3294, 250, 3029, 0, 162, 259,
+    0, 2691, 0, 3009, 2737, 6362, 0, 241, 0, 2021, 1742, 4650, 3139, 1755, 1905, 78,
+    2953, 147, 2823, 1940, 3232, 144, 3164, 2538, 0, 0, 314, 0, 322, 2578, 2020, 3150,
+    0, 0, 0, 0, 198, 5363, 301, 0, 2517, 3295, 1978, 3339, 0, 267, 2274, 2019,
+    0, 3196, 0, 3130, 0, 0, 0, 186, 2159, 4966, 3007, 3261, 1898, 99, 2920, 2169,
+    1603, 0, 0, 0, 0, 0, 4482, 6715, 247, 38, 2338, 199, 4307, 2898, 95, 4216,
+    3117, 308, 3143, 136, 3881, 0, 0, 0, 5407, 2667, 0, 2798, 0, 0, 2097, 188,
+    207, 7036, 3129, 3034, 190, 2777, 0, 0, 0, 96, 262, 0, 55, 121, 0, 1687,
+    1633, 0, 2768, 3778, 5087, 2684, 228, 2724, 239, 2894, 51, 1810, 83, 0, 194, 24,
+    3173, 1610, 0, 0, 209, 2615, 5414, 0, 13, 172, 84, 0, 0, 0, 2468, 0,
+    0, 5449, 1772, 3020, 0, 4344, 2515, 103, 0, 2504, 0, 5566, 0, 1606, 4889, 3040,
+    243, 0, 5015, 4437, 0, 0, 2791, 6826, 264, 1600, 5768, 3305, 1601, 2678, 0, 3556,
+    0, 1749, 5150, 0, 250, 0, 305, 1809, 0, 0, 0, 0, 2273, 5316, 0, 4938,
+    3064, 3770, 2738, 0, 134, 2715, 0, 0, 2723, 2625, 0, 2512, 2954, 120, 3546, 95,
+    0, 0, 222, 170, 2537, 3390, 6074, 221, 83, 0, 6239, 2853, 2695, 314, 131, 294,
+    4666, 0, 2812, 3434, 0, 0, 316, 2083, 0, 193, 0, 3216, 1943, 0, 5325, 0,
+    3164, 3186, 240, 6414, 3231, 2659, 3130, 4264, 187, 0, 0, 1875, 183, 2820, 2824, 5442,
+    0, 2168, 3304, 2519, 198, 25, 4349, 316, 1783, 3154, 6354, 5306, 1793, 188, 2766, 0,
+    0, 6102, 0, 2504, 305, 105, 2589, 2546, 277, 3261, 178, 262, 1830, 0, 5889, 254,
+    3074, 5985, 119, 2592, 0, 0, 0, 2963, 7015, 1603, 143, 173, 40, 2777, 1697, 189,
+    4968, 3547, 96, 0, 0, 0, 1754, 2636, 181, 239, 0, 279, 0, 287, 5530, 0,
+    1821, 195, 75, 6727, 3207, 5422, 234, 232, 249, 2955, 1940, 2581, 2088, 4893, 6748, 0,
+    6827, 5087, 0, 185, 194, 4438, 6241, 2017, 0, 0, 1907, 0, 0, 0, 0, 3040,
+    2491, 3157, 2434, 235, 0, 0, 2600, 0, 2308, 3399, 0, 0, 5626, 0, 235, 2772,
+    296, 3830, 3260, 7228, 0, 157, 200, 6560, 2534, 2997, 2579, 1676, 3124, 215, 3558, 0,
+    0, 0, 3920, 0, 4869, 3294, 2521, 0, 2424, 259, 216, 0, 2778, 0, 2726, 5329,
+    3063, 131, 3033, 0, 0, 0, 0, 183, 3610, 4207, 226, 306, 6038, 0, 0, 59,
+    2619, 2636, 2787, 1610, 5151, 250, 2677, 0, 0, 4271, 0, 4328, 1635, 83, 2724, 268,
+    1813, 2547, 2930, 2540, 0, 2142, 2953, 3345, 0, 2773, 0, 2858, 0, 4541, 2934, 301,
+    2483, 3195, 210, 3062, 2083, 2523, 0, 193, 1948, 3233, 1986, 6686, 2277, 275, 3107, 0,
+    215, 4042, 0, 5240, 3556, 2524, 4217, 3317, 167, 0, 0, 1961, 2603, 2235, 214, 2668,
+    3172, 5883, 0, 273, 0, 3304, 1829, 2977, 14, 0, 209, 2614, 2404, 5451, 2284, 2723,
+    0, 0, 2569, 44, 2645, 6023, 2625, 0, 2777, 2485, 5805, 0, 6046, 262, 2842, 258,
+    5756, 4428, 3392, 99, 258, 59, 5106, 0, 2141, 0, 0, 4932, 12, 3355, 2820, 63,
+    5307, 138, 2640, 3716, 1808, 0, 2952, 3173, 0, 2700, 159, 2733, 1756, 2027, 0, 3130,
+    226, 0, 2932, 2073, 5370, 2788, 210, 3550, 0, 2680, 0, 291, 4900, 286, 0, 3186,
+    7057, 185, 277, 2315, 2633, 299, 1838, 4429, 201, 269, 107, 133, 4360, 2491, 3315, 0,
+    3465, 3307, 122, 0, 5848, 23, 2546, 188, 0, 2218, 1953, 5629, 2471, 0, 5891, 210,
+    2347, 0, 3010, 211, 0, 211, 2745, 2627, 0, 1702, 2986, 226, 6393, 0, 0, 0,
+    257, 4656, 0, 0, 249, 200, 0, 2776, 0, 80, 1821, 2483, 3558, 318, 3842, 0,
+    3051, 3129, 6109, 6187, 1912, 5757, 0, 0, 3034, 186, 4591, 196, 5856, 2642, 6806, 6235,
+    290, 0, 0, 3329, 157, 256, 2831, 4456, 2667, 49, 3619, 2495, 0, 2723, 215, 177,
+    0, 2902, 285, 2472, 39, 2826, 318, 5098, 0, 181, 145, 4041, 2816, 2976, 0, 2975,
+    2602, 71, 3008, 2161, 2425, 288, 6202, 0, 1831, 230, 1688, 3238, 275, 1604, 2861, 186,
+    0, 5590, 3654, 5362, 1648, 3096, 5089, 2152, 252, 3560, 2668, 2545, 4665, 60, 214, 2722,
+    0, 0, 289, 2650, 2765, 3793, 4208, 18, 2758, 15, 0, 5443, 2037, 227, 2368, 4926,
+    0, 0, 2226, 1743, 3066, 3118, 180, 0, 2562, 4703, 83, 0, 0, 2645, 180, 101,
+    1877, 2501, 23, 3427, 0, 4754, 3195, 167, 315, 2144, 2667, 12, 0, 0, 0, 4894,
+    0, 3338, 1605, 274, 3119, 0, 0, 121, 5372, 2527, 206, 2508, 3042, 306, 5307, 3008,
+    0, 2309, 0, 3186, 0, 0, 0, 5341, 120, 0, 0, 212, 4526, 0, 0, 2604,
+    5885, 156, 176, 3106, 0, 2582, 1681, 201, 170, 2747, 2510, 0, 2702, 0, 59, 319,
+    0, 0, 3163, 1850, 238, 3834, 2624, 11, 144, 5630, 0, 0, 120, 3318, 186, 2745,
+    277, 122, 0, 3695, 2968, 2111, 1954, 2845, 5545, 2516, 312, 1952, 4246, 2006, 4967, 260,
+    162, 0, 2595, 5097, 4005, 36, 0, 0, 3078, 3129, 1820, 2728, 5593, 1621, 0, 179,
+    5747, 3073, 3284, 0, 6022, 2943, 0, 2667, 3183, 2361, 3621, 6626, 2490, 3412, 5271, 4612,
+    6000, 0, 5812, 4782, 1600, 307, 6435, 0, 5664, 1715, 2636, 14, 3007, 271, 3117, 0,
+    3194, 0, 2337, 0, 167, 0, 5977, 3802, 204, 2759, 284, 204, 2590, 2623, 2604, 0,
+    0, 0, 2490, 320, 215, 4761, 0, 322, 311, 3786, 2765, 0, 90, 2757, 1690, 0,
+    107, 3096, 5366, 0, 216, 6273, 0, 75, 0, 0, 232, 2683, 13, 4668, 221, 0,
+    232, 5380, 0, 2578, 3347, 227, 6266, 2920, 218, 248, 0, 0, 289, 0, 0, 2875,
+    3068, 4370, 0, 121, 2176, 0, 297, 211, 0, 0, 3331, 0, 182, 3294, 2996, 7092,
+    2954, 3000, 2710, 0, 2473, 0, 2037, 2102, 5528, 0, 257, 73, 0, 2666, 0, 184,
+    0, 3444, 0, 2778, 6032, 1842, 2423, 3998, 2754, 2559, 2644, 3316, 0, 2558, 0, 0,
+    5334, 5537, 2413, 120, 4044, 108, 5681, 0, 3075, 2495, 1688, 157, 5086, 2557, 1604, 3647,
+    4490, 205, 0, 2612, 0, 213, 1607, 0, 5319, 3007, 14, 1763, 1874, 1641, 156, 119,
+    2663, 271, 310, 2810, 248, 5470, 198, 292, 2968, 0, 244, 0, 0, 0, 0, 260,
+    299, 47, 2370, 2123, 4790, 3029, 5546, 98, 5143, 3368, 4150, 0, 2713, 4014, 243, 2678,
+    4481, 300, 5256, 0, 37, 2705, 5979, 1822, 35, 3305, 2908, 5994, 2755, 2846, 0, 2103,
+    0, 155, 5421, 321, 114, 0, 1895, 0, 274, 0, 2743, 3273, 5526, 208, 2018, 0,
+    0, 2556, 5101, 3254, 2162, 4755, 2526, 2637, 0, 186, 0, 3316, 4702, 6002, 3766, 3272,
+    0, 0, 1886, 286, 0, 2887, 233, 181, 0, 2590, 190, 3152, 4647, 0, 0, 0,
+    2760, 0, 0, 0, 0, 0, 2160, 3165, 3426, 0, 2490, 2616, 1690, 280, 6315, 2613,
+    2281, 75, 4530, 0, 2546, 0, 300, 3274, 0, 299, 5749, 0, 0, 2847, 0, 267,
+    2834, 5310, 0, 4866, 245, 0, 276, 0, 272, 3615, 1919, 0, 247, 7343, 3185, 2186,
+    0, 251, 0, 316, 110, 3208, 0, 73, 0, 2985, 0, 2480, 4966, 1708, 255, 2339,
+    4725, 310, 0, 28, 289, 0, 38, 5538, 0, 0, 2803, 0, 2374, 3779, 171, 5346,
+    190, 2616, 2943, 0, 197, 0, 5529, 310, 1601, 315, 0, 2415, 0, 1692, 2976, 299,
+    2701, 3875, 2778, 5088, 2942, 0, 3263, 6938, 4129, 0, 4931, 1655, 0, 2528, 2920, 6067,
+    254, 4007, 0, 0, 2996, 7153, 20, 0, 0, 0, 169, 0, 2989, 4492, 208, 0,
+    0, 0, 3069, 1765, 0, 2151, 6195, 0, 0, 177, 3183, 1940, 36, 47, 2717, 3260,
+    0, 3029, 0, 1606, 0, 2919, 2036, 0, 3228, 5491, 209, 2678, 4000, 2647, 3244, 108,
+    2734, 292, 4270, 5406, 61, 0, 0, 2877, 5336, 0, 0, 0, 0, 0, 264, 41,
+    0, 2405, 0, 1607, 0, 0, 0, 0, 2875, 3119, 2468, 4306, 0, 84, 2645, 0,
+    2571, 143, 3141, 4680, 0, 246, 2935, 3315, 4647, 5537, 286, 0, 2018, 321, 2725, 3175,
+    95, 0, 2490, 3989, 2505, 0, 265, 3216, 271, 1763, 2700, 4446, 6130, 3042, 3118, 1621,
+    294, 3085, 240, 3169, 0, 5582, 3549, 75, 3546, 2479, 144, 85, 3220, 0, 2589, 5970,
+    77, 1601, 2955, 2179, 0, 2911, 3435, 5996, 2879, 4392, 0, 5306, 3118, 191, 261, 0,
+    3264, 1611, 3185, 0, 0, 247, 2746, 187, 0, 192, 73, 5931, 0, 2093, 0, 3253,
+    0, 7020, 0, 83, 3052, 148, 0, 143, 0, 3029, 2635, 119, 0, 1600, 96, 4705,
+    181, 125, 2140, 4094, 0, 0, 0, 4058, 0, 189, 95, 1710, 1603, 1610, 41, 0,
+    3196, 4930, 0, 0, 197, 0, 322, 0, 291, 0, 2649, 0, 0, 3131, 3208, 5093,
+    121, 2153, 5529, 4719, 0, 6943, 205, 317, 224, 3152, 1940, 2073, 0, 2336, 169, 3381,
+    1765, 30, 5141, 0, 79, 317, 2618, 313, 286, 1602, 4027, 2292, 231, 0, 4526, 28,
+    5692, 0, 226, 4171, 0, 239, 7117, 0, 0, 72, 0, 2765, 0, 282, 0, 5966,
+    249, 195, 0, 4439, 3222, 1895, 0, 3823, 0, 0, 289, 3580, 0, 2655, 0, 1608,
+    0, 227, 195, 219, 2249, 0, 6212, 0, 0, 2778, 197, 175, 0, 0, 0, 288,
+    2985, 2225, 3868, 2407, 3228, 1964, 3566, 2922, 4286, 5846, 292, 176, 2526, 0, 2550, 203,
+    0, 143, 3315, 3119, 0, 2870, 0, 227, 2009, 2669, 0, 0, 3085, 0, 269, 2822,
+    1601, 3234, 2007, 269, 2919, 231, 3118, 2878, 0, 200, 238, 5583, 0, 3436, 5810, 0,
+    2524, 191, 0, 1611, 6153, 6687, 0, 3042, 2688, 3035, 1767, 0, 2044, 0, 5801, 0,
+    3265, 2453, 0, 5916, 261, 0, 52, 2006, 0, 2657, 1600, 302, 3244, 5005, 291, 287,
+    273, 1621, 2979, 173, 2952, 3260, 5647, 4448, 3227, 3785, 0, 2747, 79, 3646, 0, 0,
+    2645, 3141, 2433, 3293, 1603, 5868, 0, 4217, 1736, 3184, 43, 7071, 209, 4087, 2876, 0,
+    3991, 0, 0, 0, 3273, 258, 5379, 60, 2140, 2503, 0, 6194, 3043, 63, 0, 4933,
+    231, 1757, 0, 123, 0, 2216, 2029, 3128, 0, 0, 2776, 247, 262, 3140, 294, 256,
+    3151, 0, 0, 2900, 0, 1953, 13, 2073, 2891, 0, 2886, 2605, 2966, 4322, 2854, 2992,
+    1677, 95, 0, 3033, 0, 216, 315, 0, 228, 255, 0, 299, 3298, 3020, 3012, 2545,
+    1742, 0, 0, 2095, 0, 0, 0, 3084, 0, 3382, 0, 2295, 0, 2746, 321, 282,
+    2898, 0, 2357, 2302, 192, 2523, 0, 3582, 255, 0, 2998, 4225, 2650, 0, 171, 0,
+    2536, 270, 1600, 0, 2845, 2423, 1971, 0, 191, 2348, 193, 4887, 0, 6358, 2615, 3870,
+    5528, 2811, 0, 1875, 6909, 2558, 6680, 0, 298, 0, 0, 4270, 131, 0, 2011, 6030,
+    4596, 0, 0, 0, 1602, 223, 0, 183, 5317, 2787, 208, 2932, 6801, 0, 2622, 2844,
+    2901, 2423, 3795, 2387, 171, 2671, 2882, 3285, 0, 5766, 3042, 281, 1819, 0, 0, 0,
+    246, 6387, 0, 0, 2357, 11, 2692, 40, 2924, 2919, 2688, 3131, 0, 1611, 3825, 2768,
+    0, 2890, 2735, 0, 3197, 246, 0, 133, 2821, 1832, 3041, 1747, 2732, 0, 0, 109,
+    198, 0, 0, 2747, 2645, 4868, 5478, 0, 2283, 316, 0, 1943, 2668, 0, 0, 2975,
+    2838, 2570, 171, 180, 2051, 2765, 1886, 3106, 0, 6470, 4675, 95, 219, 3337, 1809, 4483,
+    235, 0, 3603, 277, 3260, 3429, 5392, 209, 254, 0, 0, 1913, 2721, 0, 5373, 2699,
+    2965, 294, 85, 0, 4535, 2310, 1677, 0, 0, 0, 290, 2964, 84, 280, 2216, 2479,
+    3151, 3297, 237, 2626, 3098, 319, 2567, 2075, 0, 3284, 0, 4880, 0, 3250, 185, 2468,
+    4262, 3084, 2006, 0, 258, 238, 2537, 0, 2296, 6238, 180, 2545, 3830, 0, 230, 2072,
+    0, 0, 2432, 3319, 122, 237, 227, 170, 0, 2561, 1955, 210, 0, 2624, 0, 84,
+    2149, 321, 1623, 0, 5222, 176, 4103, 2273, 2468, 12, 263, 171, 0, 0, 1876, 3326,
+    246, 2086, 3398, 284, 4051, 2749, 3117, 0, 2978, 0, 3305, 0, 0, 0, 2110, 3293,
+    0, 85, 4537, 3132, 2847, 54, 6033, 6203, 2558, 5832, 3656, 202, 259, 4982, 250, 2206,
+    4219, 0, 4626, 6700, 2094, 2633, 1602, 2615, 133, 2479, 2611, 52, 0, 0, 5811, 3218,
+    6472, 204, 3166, 4207, 2501, 2770, 3896, 2765, 0, 5977, 2286, 125, 235, 0, 0, 3207,
+    0, 185, 2605, 4562, 0, 13, 5758, 0, 3277, 0, 3019, 174, 0, 221, 3788, 59,
+    3285, 316, 1773, 76, 1904, 5318, 5987, 2053, 2170, 231, 227, 25, 5108, 3986, 172, 6267,
+    3098, 0, 0, 0, 0, 297, 184, 11, 203, 3194, 2887, 0, 0, 237, 2572, 230,
+    246, 0, 0, 2591, 2974, 29, 0, 4692, 6204, 310, 1944, 270, 4376, 4975, 2954, 298,
+    2079, 4748, 6365, 3574, 0, 3902, 6500, 222, 2724, 2900, 2512, 0, 3041, 214, 0, 0,
+    0, 0, 6714, 3075, 0, 2327, 5194, 204, 84, 0, 2479, 85, 2779, 203, 0, 2691,
+    1677, 4068, 0, 0, 0, 2468, 2790, 226, 0, 4710, 1874, 5158, 3648, 0, 2809, 4499,
+    2580, 0, 3133, 74, 0, 0, 2538, 2205, 2274, 254, 2701, 0, 7272, 198, 322, 3605,
+    158, 217, 1640, 1838, 180, 102, 1810, 0, 1642, 0, 0, 5546, 2204, 2149, 243, 4206,
+    2853, 203, 0, 3165, 1700, 2119, 298, 145, 5766, 214, 4226, 3241, 258, 3085, 63, 4657,
+    4485, 0, 6021, 0, 2847, 2622, 35, 2866, 2469, 5471, 0, 3768, 318, 1896, 0, 3336,
+    37, 3838, 2139, 40, 261, 3128, 2633, 168, 175, 2085, 3463, 0, 2637, 2937, 3141, 2163,
+    4571, 2019, 2414, 5361, 270, 2546, 5757, 3272, 280, 2725, 3218, 1604, 256, 1610, 2974, 1887,
+    0, 6231, 170, 0, 0, 3058, 230, 0, 0, 174, 2679, 0, 65, 309, 2974, 0,
+    0, 4262, 2791, 203, 3209, 0, 174, 0, 2997, 3807, 2600, 255, 3951, 0, 0, 0,
+    4342, 1925, 242, 0, 6301, 286, 2666, 2834, 4976, 247, 4924, 0, 0, 0, 3098, 2403,
+    5306, 5978, 4866, 292, 24, 2721, 0, 3205, 0, 37, 282, 0, 2482, 5325, 132, 0,
+    2754, 316, 0, 5911, 0, 0, 0, 296, 179, 263, 4086, 66, 3011, 2965, 0, 2710,
+    0, 0, 0, 2721, 4946, 6021, 2512, 2976, 2525, 220, 5158, 6082, 0, 0, 1631, 304,
+    0, 282, 2802, 0, 3240, 24, 0, 1612, 1846, 225, 204, 2693, 119, 0, 2348, 3007,
+    2736, 260, 4556, 0, 2782, 200, 4210, 0, 2857, 84, 4512, 3669, 3239, 2468, 232, 4050,
+    1787, 110, 1606, 3490, 0, 3177, 254, 6714, 0, 0, 0, 5765, 0, 158, 177, 0,
+    2905, 0, 274, 6197, 2048, 180, 5545, 1811, 2889, 0, 5803, 3249, 253, 0, 3153, 264,
+    3276, 1941, 2722, 5536, 61, 197, 0, 5188, 0, 216, 2876, 300, 0, 0, 0, 1940,
+    3567, 0, 3168, 2813, 3682, 2737, 3152, 0, 5976, 2242, 318, 4318, 2888, 171, 0, 308,
+    2666, 4279, 1808, 0, 5627, 0, 4711, 6716, 0, 0, 3128, 0, 298, 3496, 4712, 0,
+    0, 3548, 200, 1633, 3085, 263, 2505, 5120, 4460, 2087, 0, 1605, 0, 0, 5747, 0,
+    0, 2622, 0, 0, 1604, 170, 218, 73, 0, 2337, 3230, 4658, 0, 0, 5308, 5317,
+    2600, 2866, 283, 261, 0, 3391, 1622, 1885, 2959, 2578, 0, 5882, 264, 257, 1661, 2756,
+    0, 0, 223, 0, 4123, 3282, 2623, 222, 111, 260, 3346, 107, 37, 5306, 188, 3120,
+    2424, 319, 2833, 3172, 3196, 2215, 3210, 2022, 3767, 247, 2639, 7127, 96, 0, 2382, 4940,
+    0, 3002, 6132, 3271, 144, 239, 0, 4096, 0, 1610, 3240, 5414, 4233, 4059, 2545, 148,
+    0, 2141, 3032, 83, 3618, 2942, 0, 1753, 2726, 2525, 4988, 2783, 6245, 0, 5591, 274,
+    2008, 232, 204, 2559, 0, 0, 169, 195, 53, 3206, 0, 1789, 0, 3710, 293, 282,
+    5748, 5167, 2479, 313, 3108, 313, 2812, 3031, 178, 2611, 2712, 3007, 2568, 0, 3052, 5548,
+    2975, 0, 0, 294, 241, 0, 5145, 0, 0, 0, 1600, 2557, 2964, 0, 0, 0,
+    249, 0, 2870, 5966, 123, 175, 2890, 5120, 0, 0, 6744, 2655, 2660, 3153, 3568, 0,
+    6386, 2601, 0, 1604, 3845, 0, 0, 0, 0, 2699, 2229, 1808, 0, 0, 0, 1900,
+    0, 2611, 95, 0, 243, 2801, 2251, 263, 2493, 4013, 0, 194, 242, 3223, 132, 274,
+    5746, 3284, 0, 0, 147, 2964, 4436, 119, 0, 24, 5818, 6024, 2802, 226, 2402, 2338,
+    1970, 1601, 5583, 3469, 177, 0, 0, 3230, 1875, 0, 6359, 3173, 4281, 5854, 3271, 3501,
+    0, 2376, 2204, 0, 0, 0, 0, 0, 1615, 3304, 0, 2912, 6103, 2886, 5803, 2626,
+    2866, 5626, 310, 1628, 5152, 0, 5045, 0, 3684, 261, 3406, 2367, 203, 179, 4060, 4658,
+    0, 264, 3085, 6415, 0, 2922, 2480, 4649, 2981, 3360, 311, 2142, 4089, 1676, 234, 37,
+    2748, 3260, 0, 0, 3024, 0, 2836, 1607, 0, 3320, 48, 3315, 0, 319, 2713, 49,
+    5527, 3045, 3271, 1753, 2507, 0, 307, 0, 4701, 6554, 1951, 112, 256, 60, 1607, 4885,
+    2659, 2426, 1714, 4263, 0, 2402, 1679, 314, 35, 0, 3611, 3140, 3273, 3217, 276, 301,
+    2300, 3084, 0, 0, 3206, 0, 2217, 0, 186, 3547, 2561, 0, 2448, 3108, 2941, 235,
+    3986, 2336, 1606, 5968, 2963, 3020, 216, 2646, 218, 3062, 2138, 1853, 2545, 0, 2568, 155,
+    2941, 2933, 5362, 5456, 4867, 0, 0, 172, 2611, 315, 1603, 282, 2998, 0, 0, 2496,
+    0, 0, 3101, 278, 3003, 2613, 0, 0, 2967, 123, 2943, 0, 137, 317, 0, 5802,
+    2559, 3327, 4646, 2490, 0, 2681, 193, 0, 2541, 3591, 2424, 0, 0, 223, 2804, 0,
+    0, 310, 2008, 2282, 16, 195, 3032, 2359, 3216, 6040, 236, 0, 1606, 0, 2832, 0,
+    2350, 241, 0, 183, 5582, 3172, 4042, 3239, 0, 0, 6897, 0, 5250, 2583, 1973, 4528,
+    296, 0, 3230, 0, 3095, 4216, 2592, 4436, 0, 0, 2985, 2838, 0, 0, 2491, 3250,
+    3117, 0, 0, 2801, 229, 2911, 2799, 2204, 0, 0, 0, 49, 0, 3304, 143, 245,
+    314, 4108, 4657, 3202, 0, 3286, 2768, 168, 5628, 6116, 2702, 2672, 228, 0, 76, 264,
+    2821, 2626, 0, 3721, 185, 0, 6295, 1617, 3361, 3284, 62, 0, 1781, 2910, 258, 150,
+    12, 0, 163, 2612, 98, 3275, 0, 2865, 2714, 2699, 71, 0, 266, 2952, 1892, 1753,
+    2700, 291, 2887, 0, 3481, 3144, 2073, 5114, 4886, 2093, 5780, 133, 305, 2875, 0, 35,
+    1678, 3997, 0, 2923, 2855, 2218, 0, 6556, 4811, 3100, 3217, 2633, 5396, 2301, 157, 0,
+    0, 0, 2840, 3107, 0, 2417, 3625, 0, 0, 4427, 0, 6352, 0, 1707, 0, 151,
+    293, 217, 0, 0, 2601, 2567, 3272, 0, 2628, 2545, 2138, 1952, 3315, 4648, 275, 2776,
+    2442, 0, 2017, 219, 0, 194, 0, 2480, 5553, 126, 0, 0, 0, 0, 4646, 2358,
+    3150, 127, 2611, 122, 276, 5590, 3051, 0, 0, 1743, 0, 0, 1878, 3329, 220, 0,
+    3326, 2769, 3032, 86, 0, 2428, 0, 0, 2513, 0, 6056, 4053, 0, 38, 2806, 0,
+    2208, 195, 2594, 2563, 3139, 27, 0, 212, 2975, 3216, 281, 1632, 2469, 2601, 0, 249,
+    214, 0, 5585, 307, 96, 1602, 97, 5828, 288, 2690, 2744, 2159, 2702, 174, 4564, 0,
+    2942, 0, 4209, 2501, 0, 18, 5756, 0, 0, 1687, 0, 3066, 239, 3117, 2617, 3112,
+    302, 2889, 253, 2614, 3227, 2150, 2347, 308, 4754, 0, 0, 3777, 0, 0, 224, 4207,
+    3874, 0, 1603, 0, 180, 0, 0, 188, 172, 49, 1606, 1945, 3289, 243, 239, 3691,
+    3099, 5222, 2997, 6186, 2492, 217, 71, 23, 1904, 3261, 2947, 4922, 4006, 2612, 12, 98,
+    0, 2573, 2857, 4885, 6006, 0, 0, 3219, 3019, 2887, 300, 2502, 0, 0, 0, 6686,
+    2300, 5539, 0, 2691, 0, 3238, 1609, 2585, 2823, 4122, 0, 35, 0, 1742, 0, 0,
+    5407, 0, 2745, 2601, 6371, 0, 263, 2613, 97, 0, 0, 250, 2875, 1722, 2490, 59,
+    77, 277, 4836, 245, 170, 0, 2737, 0, 3305, 1774, 2644, 2767, 1606, 0, 0, 0,
+    2419, 2481, 0, 231, 2102, 1952, 2911, 0, 4648, 202, 251, 122, 322, 2897, 0, 0,
+    2947, 145, 2274, 314, 5711, 2689, 0, 0, 2920, 179, 2635, 0, 48, 2497, 3163, 5986,
+    4243, 3243, 3067, 2514, 207, 3293, 276, 2853, 2974, 0, 2886, 0, 0, 0, 159, 0,
+    0, 3076, 1683, 4576, 2159, 252, 0, 0, 4427, 2472, 3139, 0, 0, 3272, 4307, 39,
+    0, 42, 207, 97, 2966, 0, 5592, 5230, 2909, 14, 0, 3839, 0, 3141, 0, 3007,
+    48, 0, 0, 7035, 0, 3867, 0, 2744, 6274, 1687, 3546, 0, 3261, 0, 0, 0,
+    3107, 0, 6232, 0, 0, 2683, 1877, 1942, 0, 239, 256, 0, 0, 2567, 2337, 4454,
+    0, 5316, 256, 0, 2895, 2017, 0, 3128, 0, 0, 206, 0, 0, 3776, 136, 0,
+    181, 281, 2791, 0, 3390, 251, 2039, 5086, 0, 0, 2989, 2704, 0, 286, 3102, 4718,
+    2482, 38, 2104, 0, 2498, 0, 2999, 0, 7009, 1809, 0, 3173, 5334, 3040, 3766, 193,
+    0, 0, 2513, 232, 262, 2666, 2349, 2656, 0, 0, 3194, 176, 0, 0, 3121, 0,
+    0, 2526, 5325, 3305, 1631, 4021, 220, 0, 0, 0, 2512, 6799, 11, 2603, 246, 297,
+    1874, 6230, 0, 4931, 2857, 240, 0, 2613, 5020, 0, 277, 0, 2733, 0, 2743, 2694,
+    2768, 260, 2529, 5407, 0, 274, 0, 2634, 5307, 197, 115, 3426, 0, 293, 2273, 5976,
+    3822, 2737, 2963, 0, 2105, 4652, 1978, 2854, 0, 0, 237, 4151, 2835, 164, 168, 1606,
+    0, 1941, 1775, 1847, 1954, 37, 5224, 201, 4343, 0, 3154, 253, 48, 0, 3227, 0,
+    4923, 5976, 2271, 3143, 1963, 5774, 193, 0, 2897, 3832, 234, 5442, 5141, 207, 183, 0,
+    0, 1940, 252, 0, 119, 0, 2159, 5750, 7014, 3304, 2635, 0, 4731, 308, 302, 0,
+    3987, 0, 155, 0, 183, 0, 15, 3252, 2761, 0, 2732, 0, 3152, 5530, 2953, 0,
+    295, 3229, 2535, 0, 83, 3781, 6826, 6067, 3161, 2567, 0, 0, 2824, 3107, 0, 0,
+    1687, 6251, 3095, 0, 3882, 202, 4727, 1906, 0, 277, 2634, 239, 96, 4466, 5985, 198,
+    51, 0, 5747, 3297, 3084, 0, 235, 108, 2600, 47, 0, 2966, 0, 188, 0, 0,
+    25, 73, 7224, 0, 3009, 185, 3390, 3031, 206, 199, 2579, 0, 4309, 2856, 0, 3123,
+    2366, 3018, 2480, 0, 0, 2276, 3271, 0, 2072, 0, 0, 210, 3185, 316, 2800, 5328,
+    0, 36, 0, 2810, 144, 2284, 7047, 0, 0, 0, 3345, 240, 4534, 222, 0, 0,
+    249, 295, 169, 1755, 246, 2293, 0, 0, 176, 2619, 6832, 4271, 1896, 1634, 2150, 0,
+    177, 2934, 0, 3328, 2010, 2996, 209, 2942, 251, 183, 88, 0, 268, 2696, 4234, 301,
+    168, 0, 3916, 0, 2634, 23, 0, 83, 1840, 3124, 1985, 0, 6679, 237, 1606, 2623,
+    0, 5097, 215, 0, 4437, 3035, 3434, 3441, 2590, 0, 3647, 313, 2856, 1600, 4922, 0,
+    1798, 3219, 3241, 6498, 3156, 318, 0, 305, 14, 215, 0, 0, 0, 243, 3161, 0,
+    0, 95, 248, 0, 5370, 4878, 0, 0, 60, 3851, 3040, 0, 38, 2404, 0, 5450,
+    63, 3546, 2667, 300, 2569, 0, 5848, 87, 2854, 3109, 3785, 2501, 0, 3989, 205, 12,
+    0, 6023, 138, 3315, 2503, 1808, 0, 215, 271, 101, 0, 275, 2842, 0, 0, 0,
+    214, 2659, 2139, 2537, 4426, 97, 2601, 1601, 1875, 0, 0, 2341, 0, 1980, 0, 3252,
+    313, 12, 0, 298, 4877, 0, 5967, 0, 0, 4356, 2027, 3308, 5306, 2633, 0, 5361,
+    2502, 3008, 213, 3051, 234, 48, 0, 2292, 3185, 2860, 0, 0, 309, 3800, 5890, 0,
+    0, 5406, 2745, 2484, 6102, 3556, 2627, 0, 44, 3401, 0, 7025, 2534, 146, 122, 1830,
+    6066, 286, 1821, 0, 3354, 0, 3140, 2821, 0, 0, 0, 0, 2831, 242, 0, 2270,
+    2494, 1951, 296, 301, 0, 195, 240, 312, 185, 2404, 0, 6694, 169, 4893, 0, 3612,
+    0, 0, 5773, 0, 2336, 0, 0, 2150, 0, 6805, 235, 17, 1754, 3610, 0, 0,
+    3996, 262, 4590, 1604, 2902, 3129, 135, 3219, 0, 112, 2809, 0, 2815, 2606, 157, 7091,
+    5201, 2541, 0, 3195, 6191, 0, 2790, 121, 193, 3661, 238, 132, 186, 3238, 2649, 2502,
+    3266, 4869, 6420, 226, 4441, 0, 0, 183, 2589, 3162, 0, 2722, 3227, 192, 2862, 4542,
+    2501, 4273, 83, 5362, 4235, 317, 2758, 0, 0, 2658, 0, 167, 0, 1648, 5088, 2235,
+    2788, 3084, 216, 197, 4747, 3033, 48, 288, 3559, 2414, 0, 0, 180, 3096, 0, 2009,
+    2580, 3161, 2140, 200, 1912, 0, 4217, 0, 0, 6194, 227, 0, 0, 5408, 4656, 267,
+    0, 3172, 223, 87, 5581, 0, 3064, 3310, 2547, 1997, 0, 0, 2678, 295, 5372, 2936,
+    0, 3228, 182, 0, 3383, 4879, 4314, 3327, 0, 313, 4005, 136, 0, 0, 2543, 2207,
+    0, 2471, 2668, 2977, 298, 5884, 0, 6837, 2435, 3117, 222, 4647, 3338, 1829, 174, 213,
+    170, 6022, 3184, 0, 0, 2557, 258, 0, 5629, 120, 26, 0, 3241, 2169, 0, 2745,
+    0, 2658, 1603, 232, 99, 2294, 0, 0, 279, 5370, 156, 1874, 1605, 0, 4498, 6112,
+    12, 2821, 0, 2556, 2957, 0, 210, 1622, 2952, 0, 0, 187, 5051, 1759, 63, 25,
+    111, 260, 4428, 0, 3601, 3631, 135, 2096, 0, 5536, 4903, 3249, 305, 3317, 4665, 2934,
+    6565, 0, 5812, 6399, 122, 3078, 2834, 6030, 2340, 2637, 5195, 0, 185, 2700, 143, 187,
+    3997, 0, 0, 136, 0, 3055, 1834, 3330, 3561, 1914, 2612, 274, 167, 0, 204, 0,
+    2796, 2579, 73, 0, 2578, 0, 1742, 0, 236, 2757, 5977, 268, 1819, 2634, 0, 2776,
+    2138, 0, 4868, 5365, 249, 13, 3010, 0, 0, 0, 27, 265, 3662, 2208, 5251, 2487,
+    86, 5089, 1600, 2842, 2501, 2283, 2662, 3051, 18, 2820, 4601, 90, 0, 230, 2633, 1880,
+    0, 89, 3037, 1746, 0, 4005, 2864, 0, 6817, 2902, 73, 0, 0, 1859, 2589, 273,
+    0, 255, 290, 3000, 182, 6202, 1912, 2655, 4667, 1602, 0, 3052, 2093, 2473, 299, 3216,
+    2602, 0, 0, 0, 2216, 2161, 2578, 2470, 0, 0, 2505, 3088, 0, 0, 59, 131,
+    3221, 0, 2767, 5757, 2152, 5850, 0, 1706, 1688, 3249, 2798, 4938, 1650, 5526, 2690, 2668,
+    0, 2369, 3603, 5854, 3931, 2963, 0, 47, 4278, 0, 174, 2557, 3316, 4208, 1641, 5319,
+    198, 4433, 5446, 275, 2413, 296, 2722, 180, 4506, 0, 269, 0, 2664, 214, 3109, 2745,
+    311, 0, 6742, 3565, 1942, 2569, 178, 6478, 101, 0, 5087, 0, 4206, 12, 2868, 1624,
+    5374, 5421, 4481, 0, 4896, 0, 2524, 5036, 37, 0, 170, 181, 313, 0, 0, 0,
+    3172, 0, 214, 2974, 196, 2844, 2711, 6209, 6001, 2623, 2908, 0, 1607, 0, 1605, 2027,
+    2607, 114, 5782, 5207, 121, 0, 0, 0, 2567, 1727, 0, 59, 4789, 3056, 0, 60,
+    2549, 211, 3318, 135, 2624, 124, 2536, 2848, 0, 0, 6032, 2713, 2743, 289, 5979, 2018,
+    3095, 236, 3988, 6081, 2516, 260, 0, 299, 3109, 0, 3163, 2272, 0, 5662, 2734, 4870,
+    2017, 0, 4945, 286, 0, 2969, 36, 2502, 0, 1679, 0, 0, 3382, 1601, 3349, 1820,
+    3007, 0, 4786, 122, 0, 0, 276, 300, 2558, 111, 64, 2759, 2160, 0, 25, 2490,
+    2636, 2374, 86, 0, 5814, 2164, 73, 2845, 1601, 2996, 273, 2989, 2093, 0, 0, 3068,
+    4372, 5977, 1691, 179, 1602, 2770, 0, 2798, 0, 0, 4321, 11, 0, 2677, 0, 169,
+    2474, 321, 182, 204, 247, 278, 2831, 0, 0, 2878, 3910, 0, 2337, 3078, 2359, 0,
+    2767, 218, 6279, 3251, 0, 3080, 3150, 2789, 2608, 2084, 5327, 5159, 2757, 2528, 6883, 236,
+    6269, 189, 299, 2843, 3238, 218, 177, 0, 1942, 1641, 4646, 233, 74, 2413, 293, 7149,
+    2666, 0, 5476, 266, 5086, 211, 140, 3999, 4702, 2761, 0, 6525, 2569, 229, 255, 0,
+    2124, 2716, 275, 3549, 0, 2831, 64, 3200, 0, 2919, 264, 4791, 2647, 3000, 3305, 5746,
+    0, 2512, 3207, 2755, 0, 0, 5634, 4101, 0, 2867, 3769, 1614, 2622, 2027, 2149, 3271,
+    0, 3194, 115, 5598, 2242, 4016, 0, 0, 319, 0, 0, 3018, 0, 0, 2645, 248,
+    310, 1607, 0, 0, 0, 231, 2690, 1763, 0, 217, 3573, 1888, 1874, 2018, 1643, 0,
+    2548, 245, 3264, 3462, 0, 2272, 3217, 2536, 169, 0, 2831, 2403, 4673, 0, 136, 3866,
+    260, 1699, 5321, 0, 0, 0, 4156, 0, 0, 5669, 0, 37, 0, 2944, 3031, 0,
+    0, 156, 1601, 3118, 2524, 0, 1826, 175, 0, 3109, 3274, 2578, 2879, 50, 5970, 2469,
+    0, 195, 0, 0, 1602, 117, 0, 223, 2734, 0, 5995, 2637, 3085, 0, 0, 3254,
+    119, 6939, 7113, 0, 3822, 2886, 2285, 2799, 208, 261, 0, 189, 5527, 5910, 3262, 2635,
+    0, 2523, 2910, 0, 155, 3251, 125, 5981, 220, 2649, 72, 0, 23, 215, 83, 2748,
+    2798, 2084, 168, 36, 4050, 5277, 6331, 3012, 160, 3956, 190, 0, 73, 148, 1693, 3987,
+    0, 3887, 225, 5171, 29, 2336, 244, 0, 1657, 6136, 2971, 2834, 307, 144, 2139, 2339,
+    184, 5749, 3777, 2763, 4921, 3120, 4966, 244, 2849, 1600, 0, 0, 5506, 294, 224, 231,
+    95, 5691, 2869, 5560, 4704, 0, 0, 5825, 2405, 0, 231, 245, 253, 1812, 2987, 0,
+    0, 312, 207, 0, 2374, 316, 5105, 0, 0, 3018, 2789, 232, 0, 1609, 289, 0,
+    5643, 205, 0, 308, 227, 0, 0, 0, 2512, 285, 0, 4681, 218, 176, 0, 2690,
+    3106, 282, 0, 244, 2921, 1766, 2480, 2151, 3566, 3009, 4285, 5335, 0, 3511, 2908, 1951,
+    0, 0, 0, 2018, 2996, 254, 2997, 177, 5526, 0, 0, 5606, 2550, 256, 1970, 212,
+    2811, 0, 4710, 0, 3435, 0, 5415, 0, 4135, 0, 0, 6722, 3492, 0, 3228, 0,
+    169, 2523, 3190, 0, 0, 2007, 51, 2688, 171, 3031, 0, 2922, 266, 2725, 108, 35,
+    2524, 1607, 4866, 0, 3220, 3265, 205, 2492, 0, 318, 156, 2877, 5801, 5311, 1601, 0,
+    3315, 233, 173, 2979, 0, 0, 4713, 0, 2441, 0, 3785, 3646, 248, 0, 2688, 2919,
+    2667, 1610, 287, 3218, 3111, 0, 47, 2381, 143, 3321, 4970, 5867, 3689, 5527, 0, 235,
+    1885, 0, 243, 3602, 3731, 2941, 0, 3990, 5106, 0, 2503, 0, 4447, 4065, 2084, 1605,
+    2908, 303, 2525, 0, 2604, 0, 0, 265, 240, 2281, 0, 0, 271, 216, 0, 2029,
+    5972, 47, 0, 0, 0, 6358, 2991, 244, 155, 0, 5364, 2600, 3260, 184, 3381, 5414,
+    5379, 0, 0, 0, 3250, 197, 0, 3768, 0, 3336, 0, 294, 2911, 3298, 219, 0,
+    0, 2074, 0, 5801, 2215, 5637, 1962, 4058, 2886, 0, 0, 3308, 127, 2898, 4866, 0,
+    286, 6905, 1745, 0, 0, 148, 286, 0, 2008, 2649, 86, 0, 2787, 64, 1953, 3120,
+    2853, 2494, 4225, 6075, 2423, 2699, 2156, 121, 2832, 0, 169, 0, 2545, 3206, 0, 2558,
+    5607, 110, 0, 195, 72, 1603, 0, 2899, 2623, 2505, 2891, 3151, 2746, 1951, 258, 2302,
+    2688, 0, 0, 1607, 2336, 2479, 5526, 32, 0, 237, 2844, 308, 2416, 313, 0, 0,
+    6769, 2975, 0, 256, 224, 0, 1768, 6021, 171, 235, 0, 0, 2581, 0, 234, 2557,
+    3655, 4547, 6689, 0, 253, 284, 3142, 0, 1602, 3824, 2924, 3030, 0, 0, 0, 171,
+    2811, 0, 1608, 3033, 2633, 2657, 1602, 0, 1943, 0, 6350, 0, 0, 302, 0, 0,
+    1609, 3253, 2044, 197, 208, 2523, 0, 3794, 0, 0, 2986, 2349, 2966, 0, 0, 1811,
+    2045, 2669, 4674, 2143, 2553, 5429, 0, 0, 1744, 227, 3284, 1941, 2831, 0, 0, 0,
+    0, 0, 113, 0, 3139, 0, 5391, 2454, 189, 0, 3173, 0, 2281, 4660, 0, 0,
+    0, 133, 221, 0, 2568, 0, 3428, 0, 0, 280, 5106, 4315, 47, 0, 0, 246,
+    0, 1676, 3297, 0, 2073, 0, 0, 95, 2876, 302, 2922, 172, 2953, 2295, 2567, 3385,
+    265, 311, 0, 4650, 144, 0, 1603, 6238, 0, 3339, 3247, 198, 85, 3309, 2748, 2095,
+    2535, 1698, 3132, 0, 272, 237, 6358, 3295, 1953, 2712, 294, 4261, 3261, 95, 84, 0,
+    0, 3117, 2689, 99, 0, 2468, 2963, 6471, 295, 0, 110, 220, 230, 237, 5142, 3601,
+    0, 3206, 2909, 1772, 0, 2423, 247, 3043, 2956, 0, 1622, 3130, 0, 321, 180, 2932,
+    6360, 262, 2732, 2768, 191, 6039, 5831, 1755, 3087, 2558, 258, 2899, 83, 4043, 301, 3830,
+    123, 5187, 3036, 5361, 2893, 0, 253, 0, 4216, 0, 143, 3084, 13, 2615, 228, 2271,
+    2624, 2994, 2138, 1742, 4207, 0, 100, 0, 4527, 0, 1633, 53, 3317, 0, 2779, 0,
+    0, 3075, 0, 0, 2756, 0, 0, 0, 2688, 0, 0, 0, 219, 1600, 0, 2633,
+    86, 2780, 1748, 305, 314, 1944, 2655, 1600, 0, 2624, 170, 0, 149, 0, 2515, 65,
+    0, 147, 2679, 2820, 0, 3205, 3164, 5601, 0, 0, 2982, 3736, 0, 2853, 4888, 134,
+    4688, 255, 2057, 3216, 236, 2538, 0, 199, 0, 1602, 0, 6203, 0, 299, 0, 2956,
+    5316, 7097, 249, 2625, 3097, 0, 2591, 298, 2512, 2899, 2580, 203, 2219, 3787, 0, 1898,
+    0, 288, 246, 0, 316, 0, 0, 0, 0, 0, 61, 0, 2926, 2674, 203, 0,
+    0, 2732, 0, 3264, 0, 0, 2738, 0, 0, 235, 309, 1943, 173, 2512, 234, 0,
+    316, 2701, 74, 2821, 4938, 210, 0, 0, 98, 0, 2780, 204, 3340, 312, 2750, 0,
+    2689, 2931, 185, 287, 5554, 3085, 3110, 0, 194, 5143, 5009, 0, 5889, 7217, 5105, 4206,
+    4484, 1603, 2504, 102, 3133, 40, 2809, 3767, 254, 2112, 3604, 0, 0, 2518, 3133, 3261,
+    2670, 1944, 2622, 243, 1623, 157, 173, 2028, 3176, 302, 180, 0, 86, 3065, 3297, 269,
+    2712, 3838, 6053, 0, 6231, 0, 0, 0, 3163, 275, 3113, 3227, 6473, 287, 1957, 5222,
+    99, 2770, 0, 3057, 0, 0, 3547, 0, 0, 258, 1830, 5766, 0, 232, 2138, 5422,
+    2308, 0, 0, 6240, 1625, 287, 0, 0, 2019, 0, 60, 131, 0, 128, 318, 3128,
+    1604, 276, 298, 3260, 173, 298, 2600, 4262, 242, 2898, 2787, 2771, 5098, 5967, 262, 4701,
+    1876, 170, 1905, 2083, 0, 6351, 2414, 23, 2518, 3272, 221, 2537, 107, 2735, 193, 6187,
+    2235, 3198, 3052, 250, 0, 5306, 183, 0, 3399, 0, 0, 0, 3216, 2094, 2206, 0,
+    0, 3830, 3150, 2538, 4042, 1602, 182, 2525, 4327, 247, 6074, 192, 4086, 2617, 2636, 259,
+    2787, 0, 0, 2591, 263, 2964, 0, 0, 2974, 0, 65, 2347, 316, 3207, 174, 287,
+    0, 2865, 1809, 0, 3294, 0, 0, 2086, 3011, 56, 5862, 225, 2724, 1612, 6386, 0,
+    0, 5567, 3195, 76, 2931, 234, 304, 2820, 2930, 173, 0, 2942, 2887, 25, 3009, 300,
+    1621, 5003, 1846, 2524, 0, 2700, 1606, 224, 3650, 0, 0, 167, 98, 1810, 0, 2171,
+    6196, 15, 59, 232, 188, 4207, 3269, 0, 6888, 2977, 0, 0, 5988, 3114, 249, 2779,
+    2128, 4491, 2853, 204, 1773, 5536, 0, 5143, 4428, 3252, 3238, 7277, 1609, 2512, 0, 2655,
+    0, 1701, 2033, 175, 0, 3096, 0, 5113, 131, 2242, 0, 0, 2833, 2888, 217, 288,
+    3838, 210, 0, 2402, 1780, 309, 0, 24, 0, 5756, 226, 2021, 1889, 3550, 303, 3771,
+    3177, 5747, 2548, 3023, 2218, 0, 0, 306, 200, 0, 2227, 0, 0, 4900, 3065, 3618,
+    1697, 6231, 3329, 0, 0, 0, 3464, 1808, 0, 2949, 5670, 288, 2493, 0, 0, 2627,
+    276, 0, 211, 3121, 2976, 2898, 0, 2964, 263, 3391, 0, 4095, 42, 3241, 4350, 2787,
+    3152, 0, 0, 0, 5856, 4230, 177, 5306, 2710, 2469, 6715, 3085, 2534, 4977, 263, 2959,
+    168, 261, 2613, 0, 2733, 3840, 0, 0, 2483, 318, 170, 1887, 0, 2726, 2638, 223,
+    5847, 2639, 6083, 6131, 231, 1604, 3129, 3074, 0, 2623, 2945, 3558, 1610, 264, 2270, 3051,
+    254, 2723, 2085, 256, 1613, 2551, 0, 178, 5150, 2988, 2790, 1946, 230, 160, 0, 0,
+    0, 3906, 4429, 0, 0, 2557, 0, 0, 3966, 2865, 2754, 3052, 2525, 2783, 6233, 3162,
+    0, 1846, 0, 6953, 2791, 2859, 4925, 2204, 1814, 2017, 313, 0, 0, 1604, 2701, 0,
+    1678, 3206, 230, 5316, 3217, 5016, 0, 2139, 0, 4701, 11, 0, 121, 2315, 2602, 5325,
+    6798, 2758, 196, 5746, 149, 226, 252, 5443, 3179, 282, 181, 3567, 2743, 2655, 0, 123,
+    109, 0, 2897, 1886, 0, 3793, 176, 2739, 201, 2721, 2482, 2975, 2788, 215, 5966, 2646,
+    4453, 2250, 2611, 3106, 3427, 319, 3326, 0, 1877, 288, 0, 159, 0, 2512, 0, 1838,
+    2809, 2864, 2600, 0, 119, 145, 1978, 232, 2023, 5151, 290, 2492, 0, 0, 4291, 260,
+    3551, 0, 0, 0, 5664, 3497, 0, 4996, 0, 2813, 0, 4233, 5142, 38, 1970, 2997,
+    2582, 2551, 0, 0, 2470, 3683, 206, 3132, 2007, 0, 274, 0, 0, 6103, 4059, 0,
+    0, 2732, 304, 2722, 276, 3405, 4761, 1961, 0, 177, 5803, 5883, 3229, 3304, 0, 3099,
+    2669, 171, 2931, 0, 2754, 2415, 6717, 4088, 2980, 2516, 6414, 2534, 1952, 2204, 318, 3129,
+    2800, 1681, 3620, 2270, 1808, 0, 2506, 215, 1612, 5417, 3831, 3023, 0, 3611, 6247, 1820,
+    5121, 5527, 107, 264, 60, 2670, 0, 5537, 311, 1605, 320, 3062, 2089, 2183, 5747, 2727,
+    1848, 2604, 3239, 0, 0, 6828, 1885, 0, 0, 2711, 2507, 2921, 2525, 0, 0, 3051,
+    306, 0, 3320, 5380, 235, 0, 36, 2361, 5765, 1605, 3393, 6068, 0, 2600, 313, 5097,
+    3002, 3587, 257, 1714, 200, 211, 0, 3140, 2072, 172, 0, 0, 0, 2975, 3283, 3062,
+    5455, 0, 3217, 2077, 1839, 2842, 2646, 5088, 0, 0, 2215, 0, 3271, 0, 3106, 59,
+    3347, 2545, 0, 3137, 3125, 5966, 3073, 90, 14, 0, 123, 2623, 0, 248, 2985, 287,
+    0, 4646, 2788, 2138, 0, 1604, 0, 4271, 0, 0, 176, 3274, 2833, 2424, 159, 2282,
+    0, 2933, 2291, 0, 0, 2037, 124, 107, 0, 0, 3442, 2557, 4666, 4876, 3317, 3008,
+    0, 0, 137, 1972, 2479, 5194, 2754, 121, 6847, 3031, 2495, 189, 237, 0, 3206, 6025,
+    0, 5334, 226, 1607, 155, 6115, 3216, 200, 2349, 2552, 39, 2007, 2471, 4526, 3296, 2757,
+    5820, 2812, 0, 2416, 0, 111, 0, 0, 2799, 2493, 3239, 2559, 2832, 4240, 6757, 2661,
+    314, 0, 0, 2590, 2672, 3717, 2612, 5553, 62, 3776, 0, 3019, 310, 0, 2854, 2967,
+    0, 243, 150, 2183, 0, 98, 3275, 2669, 0, 2910, 4014, 2754, 2879, 3360, 2810, 279,
+    49, 1808, 0, 0, 1822, 0, 0, 0, 2492, 225, 2713, 0, 0, 107, 0, 320,
+    6575, 97, 197, 2888, 2601, 3611, 0, 3173, 0, 5122, 4426, 3100, 3273, 0, 2887, 2941,
+    0, 1676, 186, 0, 12, 309, 5773, 314, 2338, 0, 2855, 0, 3307, 2217, 0, 177,
+    2406, 2368, 2633, 2887, 2627, 0, 6294, 3417, 4762, 2700, 2291, 190, 0, 3131, 4876, 212,
+    2754, 5090, 299, 211, 4810, 0, 1605, 312, 0, 1690, 3272, 3779, 0, 1707, 194, 3263,
+    3477, 0, 2613, 0, 5099, 172, 0, 2888, 2646, 4267, 0, 1895, 3366, 0, 162, 310,
+    1604, 2921, 315, 16, 225, 71, 2616, 276, 2963, 2943, 3228, 220, 1951, 267, 0, 3047,
+    2809, 3064, 2427, 0, 231, 0, 5002, 216, 2677, 203, 112, 238, 0, 160, 38, 4646,
+    3284, 5538, 0, 5346, 3089, 301, 2562, 4218, 5187, 0, 0, 276, 0, 281, 236, 5201,
+    2006, 5810, 4563, 0, 0, 5581, 0, 1716, 0, 3183, 2690, 2352, 121, 6041, 208, 0,
+    4041, 2138, 3206, 4209, 144, 17, 2036, 5362, 2528, 4052, 0, 266, 0, 6416, 2942, 2614,
+    1632, 0, 0, 2758, 308, 1655, 0, 3162, 0, 244, 126, 2434, 3874, 195, 0, 97,
+    87, 4529, 3613, 0, 0, 6195, 180, 3107, 3019, 4045, 2567, 233, 4921, 2673, 1606, 239,
+    2681, 192, 0, 4665, 213, 1904, 286, 108, 0, 1600, 0, 3216, 0, 0, 4006, 0,
+    1721, 2584, 0, 0, 2887, 312, 3175, 137, 0, 0, 0, 241, 2492, 143, 3205, 3101,
+    3627, 3097, 2481, 0, 4306, 2592, 0, 0, 4832, 271, 0, 2491, 2644, 3998, 4876, 5994,
+    2933, 0, 2291, 2348, 2629, 2340, 3119, 144, 2221, 2886, 0, 0, 3989, 5802, 2909, 0,
+    3151, 2547, 2714, 0, 107, 0, 5317, 0, 0, 0, 1709, 0, 2490, 191, 194, 0,
+    0, 77, 0, 2799, 0, 4490, 5090, 0, 266, 98, 3371, 0, 5553, 0, 0, 278,
+    311, 2612, 2987, 5786, 322, 0, 75, 2955, 2702, 244, 1621, 150, 3188, 2689, 0, 0,
+    1603, 4646, 0, 0, 3307, 3293, 2910, 2177, 5117, 0, 2093, 2946, 7346, 0, 1600, 0,
+    1941, 5010, 202, 170, 41, 0, 2897, 303, 0, 2920, 5186, 48, 0, 0, 157, 2635,
+    0, 0, 190, 0, 2209, 3054, 292, 2946, 275, 92, 252, 71, 4756, 3052, 6396, 0,
+    0, 2820, 2766, 0, 2617, 3316, 2418, 0, 0, 219, 317, 6273, 207, 2138, 108, 265,
+    3867, 4719, 100, 2634, 3272, 4867, 0, 5529, 2567, 3076, 5931, 174, 12, 2700, 0, 0,
+    5969, 0, 0, 2282, 284, 3029, 0, 276, 2526, 0, 231, 0, 3231, 7008, 224, 232,
+    1920, 23, 1743, 3107, 185, 28, 271, 2038, 0, 1904, 1765, 4703, 6210, 0, 6188, 0,
+    2249, 4439, 5976, 6186, 2999, 0, 122, 0, 0, 4020, 2655, 3216, 206, 3121, 0, 0,
+    2964, 48, 299, 5165, 0, 0, 0, 241, 0, 285, 0, 0, 3087, 0, 208, 288,
+    2482, 1609, 3139, 0, 4094, 263, 249, 2985, 5319, 3122, 4930, 212, 5634, 0, 5846, 6007,
+    143, 4217, 2878, 3119, 234, 187, 0, 5316, 0, 2009, 3876, 0, 42, 1754, 0, 0,
+    0, 0, 1631, 0, 0, 3304, 6110, 3096, 300, 0, 6687, 3063, 37, 27, 176, 0,
+    3704, 2524, 3187, 0, 4493, 98, 3382, 3172, 2612, 251, 0, 310, 4150, 1600, 224, 272,
+    1621, 197, 2979, 2974, 0, 0, 0, 177, 1774, 3255, 2603, 0, 5004, 0, 209, 0,
+    1609, 1608, 2271, 1963, 183, 1606, 3238, 0, 197, 2776, 168, 0, 2766, 2948, 273, 83,
+    2920, 0, 2076, 3556, 1732, 0, 3141, 5750, 5189, 0, 3143, 3152, 78, 5407, 233, 0,
+    2942, 2875, 2854, 199, 60, 0, 190, 2503, 246, 0, 0, 1757, 279, 3140, 5976, 266,
+    0, 0, 221, 2855, 317, 237, 5759, 0, 5598, 0, 0, 0, 0, 3881, 0, 6275,
+    2900, 2952, 4867, 3986, 2282, 0, 3029, 0, 2854, 0, 0, 2502, 2347, 1677, 0, 0,
+    0, 2514, 0, 0, 2886, 4720, 2880, 276, 4446, 3232, 2985, 62, 208, 4397, 0, 0,
+    0, 3054, 3010, 3581, 0, 0, 281, 0, 0, 178, 0, 0, 4270, 7043, 3123, 296,
+    0, 0, 0, 2635, 4345, 4702, 219, 2366, 1829, 0, 292, 2475, 171, 0, 0, 3295,
+    0, 2644, 1744, 0, 0, 0, 2855, 209, 2767, 2482, 2011, 2316, 2677, 0, 0, 4308,
+    5528, 3869, 2357, 5159, 5150, 0, 256, 88, 236, 1971, 240, 2528, 281, 2650, 0, 3076,
+    1940, 2204, 0, 3044, 207, 4931, 3328, 2919, 0, 0, 6800, 2536, 4008, 6679, 3084, 3251,
+    0, 0, 74, 2272, 2707, 1631, 0, 169, 201, 291, 2149, 2822, 0, 3189, 0, 0,
+    2622, 72, 4234, 4534, 2789, 2106, 1600, 2880, 0, 4272, 4032, 3084, 3260, 4152, 0, 5444,
+    176, 1886, 3197, 6833, 1794, 5477, 0, 6387, 3823, 181, 264, 14, 4886, 3766, 62, 2601,
+    2743, 0, 0, 0, 2776, 1940, 305, 2481, 2747, 3218, 224, 2766, 2602, 1611, 2570, 4430,
+    3603, 267, 246, 2501, 3546, 87, 3557, 0, 3098, 268, 0, 0, 0, 3154, 2648, 1832,
+    2854, 2075, 0, 2547, 2657, 5967, 230, 1979, 0, 237, 0, 134, 1896, 3217, 2403, 1745,
+    0, 2479, 0, 2310, 2007, 85, 0, 138, 0, 0, 0, 0, 2901, 2835, 1609, 4736,
+    0, 0, 0, 3161, 0, 0, 175, 3426, 0, 2732, 0, 2855, 6067, 3051, 3308, 2234,
+    5361, 2535, 272, 1965, 0, 2799, 0, 3293, 2735, 5917, 2479, 216, 0, 3381, 6470, 295,
+    6104, 251, 222, 213, 0, 0, 0, 0, 298, 122, 0, 7021, 2765, 146, 215, 2635,
+    2930, 5882, 1955, 2897, 0, 4051, 2821, 281, 171, 2270, 3239, 158, 3337, 1876, 242, 5153,
+    270, 3009, 23, 2110, 0, 195, 3306, 202, 3251, 0, 0, 2656, 5611, 3293, 0, 2589,
+    2012, 5605, 1820, 289, 3194, 0, 3892, 0, 3021, 202, 0, 0, 0, 185, 2530, 199,
+    0, 2822, 3046, 1697, 36, 85, 225, 5811, 1636, 52, 0, 47, 227, 235, 3996, 11,
+    4878, 6693, 3140, 0, 3084, 2657, 185, 2889, 0, 2603, 5758, 0, 4981, 6388, 2605, 3266,
+    0, 223, 4541, 0, 0, 4427, 133, 2721, 3260, 2336, 0, 0, 3019, 297, 3277, 2647,
+    6267, 0, 0, 2504, 132, 3556, 2481, 0, 0, 0, 3106, 17, 12, 0, 5460, 206,
+    3336, 285, 0, 2007, 203, 0, 0, 2986, 3106, 5086, 2967, 0, 3044, 2788, 0, 2572,
+    246, 3128, 87, 3327, 3447, 5107, 85, 0, 0, 59, 0, 2481, 0, 3806, 2078, 0,
+    2854, 259, 0, 3021, 1607, 230, 1698, 3031, 184, 3902, 2834, 6681, 4132, 0, 1993, 0,
+    2479, 0, 2547, 88, 4656, 1875, 2160, 1688, 4536, 0, 237, 2207, 2432, 3768, 2667, 0,
+    0, 0, 2471, 2367, 2579, 0, 2205, 0, 63, 2963, 5406, 1874, 0, 2052, 0, 3310,
+    270, 3086, 2486, 0, 0, 0, 309, 176, 243, 2656, 3095, 2977, 169, 51, 293, 3648,
+    318, 5849, 268, 214, 4498, 2941, 5370, 2944, 102, 5546, 2602, 174, 5229, 214, 3318, 2897,
+    255, 4066, 174, 1622, 3073, 205, 202, 2503, 4226, 1823, 2821, 0, 2935, 0, 3785, 2072,
+    0, 0, 2847, 5031, 2117, 2656, 2732, 4426, 2974, 1821, 3205, 109, 0, 97, 0, 4483,
+    168, 4975, 1811, 12, 121, 4747, 0, 6561, 316, 2637, 306, 3661, 0, 0, 298, 0,
+    0, 3997, 133, 0, 3249, 2997, 185, 0, 155, 2853, 297, 0, 11, 5361, 3021, 2891,
+    0, 2633, 0, 4877, 26, 3047, 6499, 0, 2281, 4314, 6021, 3053, 6425, 0, 2781, 0,
+    1896, 3161, 0, 3242, 2651, 295, 0, 0, 0, 3147, 2494, 2086, 0, 2515, 2699, 2488,
+    6066, 62, 0, 0, 3052, 206, 286, 2578, 196, 236, 252, 242, 187, 2820, 17, 2388,
+    89, 254, 4866, 223, 0, 230, 2644, 0, 0, 1879, 0, 3437, 0, 0, 0, 6813,
+    3327, 3294, 87, 6300, 2967, 2348, 290, 4597, 3250, 203, 3172, 211, 303, 2877, 24, 0,
+    4552, 2046, 5854, 2414, 296, 2689, 5202, 3282, 0, 0, 0, 2151, 2470, 73, 0, 2913,
+    0, 1605, 0, 273, 4220, 4314, 253, 288, 3667, 5411, 0, 2208, 1602, 2602, 0, 214,
+    0, 174, 48, 1649, 4278, 197, 0, 4210, 1689, 1942, 2468, 192, 3086, 0, 238, 2006,
+    0, 3930, 283, 308, 2809, 2813, 180, 0, 3987, 3338, 0, 206, 0, 0, 5968, 2436,
+    4505, 0, 2140, 0, 0, 2568, 1941, 6477, 110, 3049, 0, 0, 0, 6714, 1624, 0,
+    2580, 5086, 313, 2111, 3177, 0, 3128, 0, 0, 2711, 304, 2405, 270, 1913, 4783, 182,
+    6194, 2938, 4316, 275, 4987, 4782, 321, 298, 61, 3767, 0, 6366, 3205, 2831, 0, 5583,
+    0, 3107, 2974, 3210, 6245, 5373, 3108, 66, 60, 185, 5781, 2567, 5765, 3162, 0, 222,
+    107, 0, 274, 0, 0, 0, 0, 226, 3672, 0, 133, 0, 3055, 0, 2226, 0,
+    5317, 241, 1603, 0, 3988, 3997, 4500, 0, 1874, 170, 0, 0, 146, 99, 0, 3548,
+    209, 172, 1601, 0, 109, 1622, 2546, 3317, 2958, 309, 1679, 2516, 220, 0, 0, 2535,
+    214, 3018, 4123, 2017, 222, 5327, 1763, 272, 213, 260, 3120, 4881, 0, 2271, 5057, 0,
+    91, 5427, 5196, 6030, 2505, 0, 0, 27, 307, 2481, 0, 3079, 2996, 265, 1819, 0,
+    0, 144, 2877, 5757, 315, 3332, 5813, 108, 0, 0, 2634, 5627, 0, 223, 6035, 2639,
+    204, 2848, 2473, 0, 2957, 7093, 91, 2831, 3909, 300, 5977, 1753, 169, 6075, 0, 2300,
+    0, 4868, 253, 84, 1885, 5309, 119, 2666, 2844, 0, 232, 2359, 4939, 2724, 5252, 0,
+    1688, 2152, 1942, 2408, 4211, 2781, 200, 1788, 5144, 0, 1600, 0, 0, 5748, 174, 2833,
+    2689, 3176, 312, 248, 3128, 1614, 249, 242, 5969, 2868, 3282, 1810, 0, 0, 146, 132,
+    0, 132, 3000, 0, 22, 196, 6521, 1915, 2864, 2655, 6705, 6743, 6205, 27, 199, 261,
+    0, 2666, 3142, 222, 0, 0, 1624, 5634, 2660, 0, 3238, 0, 2755, 0, 194, 3271,
+    0, 279, 0, 2820, 4280, 0, 1888, 3088, 5854, 0, 0, 1642, 2645, 1897, 3271, 0,
+    2809, 0, 3172, 5669, 2886, 0, 2470, 0, 267, 86, 107, 2802, 0, 0, 2549, 3547,
+    2593, 178, 5096, 3469, 299, 132, 2338, 2227, 271, 0, 4517, 3173, 0, 283, 2866, 4673,
+    234, 0, 2512, 4263, 2204, 50, 245, 95, 3085, 4206, 104, 5223, 256, 5545, 0, 124,
+    179, 1626, 1602, 2546, 1607, 4710, 37, 0, 2944, 0, 4124, 26, 4923, 0, 0, 2870,
+    274, 49, 0, 2970, 6882, 5320, 0, 3398, 0, 189, 2748, 279, 2216, 3209, 2912, 4746,
+    6215, 125, 4658, 4701, 3184, 3059, 1607, 2483, 0, 2339, 3243, 0, 3007, 0, 3262, 3227,
+    156, 2150, 3052, 0, 3996, 6156, 267, 3822, 220, 4873, 2972, 2976, 2507, 5980, 6087, 0,
+    4042, 132, 4885, 3024, 2475, 6284, 2520, 192, 3219, 2919, 2876, 0, 213, 3013, 290, 4951,
+    0, 5861, 0, 5526, 4795, 2336, 0, 3952, 1679, 3565, 186, 2941, 2502, 0, 0, 2337,
+    0, 5825, 3986, 60, 2083, 1764, 2142, 218, 208, 0, 0, 1942, 67, 0, 2767, 3682,
+    190, 0, 26, 160, 242, 0, 322, 244, 3260, 2636, 5378, 4461, 3008, 2987, 213, 2374,
+    4385, 0, 3777, 184, 3153, 74, 3470, 0, 0, 2492, 289, 244, 5987, 0, 278, 6721,
+    3082, 0, 3217, 2908, 5642, 2207, 227, 2666, 4086, 2677, 2626, 0, 1951, 1607, 0, 4107,
+    2801, 2359, 236, 3095, 2886, 274, 236, 3178, 177, 0, 0, 263, 2477, 0, 2539, 0,
+    2843, 0, 0, 0, 273, 229, 2997, 0, 6893, 2823, 1644, 0, 234, 0, 2930, 2832,
+    131, 4427, 4680, 0, 2149, 308, 264, 5237, 0, 1888, 3184, 5746, 2491, 0, 26, 0,
+    3549, 5549, 51, 229, 68, 3110, 2837, 3251, 1763, 2867, 256, 260, 2204, 5669, 2658, 0,
+    1961, 0, 2798, 0, 305, 0, 0, 169, 188, 0, 2441, 0, 2545, 293, 3846, 2622,
+    0, 4751, 4050, 3220, 0, 2998, 2881, 2583, 3200, 5802, 1616, 4161, 0, 0, 2242, 2688,
+    5971, 143, 3822, 0, 0, 0, 3183, 2921, 0, 3100, 2865, 289, 0, 0, 3315, 2765,
+    229, 2403, 2548, 2570, 2941, 2141, 2480, 3625, 3602, 3711, 2523, 4886, 2336, 3051, 0, 3032,
+    2426, 2028, 3273, 0, 3218, 0, 0, 2301, 0, 275, 2792, 47, 3987, 5160, 2988, 1890,
+    2908, 1745, 6038, 279, 0, 3150, 3391, 6051, 2008, 4657, 175, 3381, 0, 178, 1678, 5364,
+    23, 2733, 0, 231, 0, 71, 5385, 0, 0, 5590, 0, 4649, 120, 3119, 223, 2534,
+    2805, 0, 6141, 2837, 0, 0, 31, 0, 126, 2168, 148, 5636, 307, 2611, 5913, 2641,
+    2623, 2270, 2735, 5752, 286, 3306, 0, 3353, 215, 220, 160, 1878, 0, 2494, 86, 23,
+    3251, 285, 0, 1603, 195, 3326, 2876, 5481, 207, 4712, 0, 3577, 0, 0, 229, 6555,
+    2614, 0, 6504, 3516, 156, 1854, 1876, 0, 1951, 256, 0, 97, 0, 0, 2601, 3992,
+    273, 220, 1706, 4041, 2825, 5827, 2889, 4287, 1609, 4445, 212, 313, 5606, 3206, 0, 109,
+    0, 0, 1607, 3117, 0, 3111, 2347, 3316, 187, 0, 225, 2660, 5177, 2997, 0, 2557,
+    253, 0, 51, 61, 0, 201, 3022, 0, 6765, 2871, 2778, 0, 2832, 3031, 3062, 3019,
+    3690, 252, 218, 1680, 146, 209, 13, 2987, 2788, 1952, 3569, 196, 4427, 0, 0, 168,
+    1602, 285, 197, 2349, 2492, 0, 234, 2573, 0, 212, 281, 0, 0, 2986, 2494, 2358,
+    0, 1744, 6350, 5126, 278, 269, 308, 3150, 2453, 3777, 1941, 307, 2553, 2910, 4714, 1970,
+    6615, 3139, 273, 2571, 3025, 245, 2941, 310, 0, 299, 2600, 2853, 5582, 0, 3263, 3174,
+    33, 2274, 255, 2469, 4659, 2954, 2681, 318, 251, 2030, 2217, 5663, 4071, 50, 0, 2443,
+    6359, 39, 2875, 2579, 3232, 2945, 4227, 3095, 0, 3903, 0, 3384, 0, 2029, 2728, 0,
+    2534, 0, 171, 4648, 2931, 3051, 0, 132, 2514, 0, 2746, 0, 2982, 0, 3261, 0,
+    3821, 2777, 2921, 0, 3139, 245, 2667, 3295, 0, 151, 48, 2922, 3346, 2911, 2384, 2270,
+    5592, 2604, 4922, 35, 0, 2509, 0, 4241, 2947, 0, 2876, 2601, 0, 0, 1714, 0,
+    2691, 0, 0, 0, 198, 4225, 2169, 4061, 145, 0, 144, 3601, 97, 4575, 0, 245,
+    0, 1603, 100, 1698, 2711, 0, 0, 3073, 0, 3087, 3262, 1951, 3322, 0, 7035, 0,
+    0, 5819, 3261, 2472, 0, 3026, 50, 0, 5096, 3263, 155, 2909, 243, 0, 3130, 3250,
+    5087, 5096, 217, 286, 36, 2931, 239, 2892, 6024, 1755, 287, 0, 228, 2699, 0, 2613,
+    0, 0, 59, 0, 287, 0, 3306, 3732, 303, 207, 13, 0, 2074, 2700, 3776, 64,
+    2515, 0, 4343, 0, 2138, 1600, 26, 0, 0, 0, 3128, 121, 2832, 0, 0, 2625,
+    0, 2496, 2791, 2875, 2104, 0, 3107, 5600, 0, 1747, 0, 2019, 0, 0, 246, 0,
+    5325, 240, 285, 5586, 245, 2349, 2513, 168, 134, 2479, 85, 3766, 0, 3018, 112, 2644,
+    0, 1943, 321, 2704, 2590, 4676, 0, 5186, 0, 2512, 0, 0, 6361, 2737, 0, 237,
+    0, 0, 3216, 3296, 2469, 2925, 50, 2853, 0, 302, 1602, 4013, 0, 4974, 2694, 261,
+    221, 2085, 0, 161, 2634, 0, 253, 0, 2857, 0, 305, 0, 1604, 0, 0, 0,
+    2570, 0, 316, 212, 96, 308, 0, 3362, 3262, 2835, 4490, 2831, 0, 1608, 48, 3339,
+    1603, 5774, 0, 2517, 272, 0, 0, 2810, 4816, 0, 5554, 0, 2750, 234, 4923, 1941,
+    173, 99, 5765, 0, 3601, 173, 2788, 3110, 6483, 3030, 3261, 3197, 97, 204, 0, 202,
+    2787, 3936, 3052, 0, 0, 210, 113, 1611, 0, 243, 3108, 1697, 0, 197, 2169, 38,
+    3767, 247, 281, 272, 0, 3174, 0, 0, 2097, 0, 287, 5530, 2404, 249, 229, 0,
+    55, 47, 2308, 5087, 1605, 0, 2075, 0, 0, 0, 2504, 270, 0, 0, 241, 0,
+    7036, 2615, 0, 6239, 288, 47, 172, 2893, 2655, 5539, 3778, 0, 0, 0, 2735, 173,
+    2017, 2351, 2020, 0, 1742, 4651, 0, 13, 147, 2535, 220, 1687, 2600, 1830, 0, 4878,
+    0, 267, 7222, 3040, 2517, 1905, 225, 0, 3915, 1885, 1606, 3087, 4938, 0, 28, 0,
+    253, 0, 0, 0, 0, 3830, 0, 0, 103, 3390, 0, 276, 4482, 5328, 0, 3260,
+    2547, 0, 199, 250, 5187, 4307, 144, 4271, 0, 0, 2616, 303, 57, 0, 3139, 2636,
+    0, 0, 3294, 2235, 4216, 3196, 3064, 108, 0, 3305, 4207, 3208, 59, 1755, 1772, 2787,
+    0, 3074, 0, 0, 1610, 0, 1634, 3874, 2909, 2293, 6748, 2724, 2695, 228, 0, 152,
+    0, 0, 248, 2634, 0, 2853, 0, 83, 314, 211, 5141, 1985, 1945, 0, 0, 215,
+    4006, 0, 0, 167, 2755, 6074, 2524, 3164, 2856, 184, 0, 0, 1810, 0, 2824, 2987,
+    5566, 271, 4847, 198, 312, 2977, 2865, 0, 4437, 199, 41, 0, 3205, 0, 168, 0,
+    7273, 40, 305, 284, 3144, 3839, 2898, 234, 202, 0, 4968, 3770, 1838, 1809, 4428, 0,
+    5316, 2341, 103, 0, 134, 0, 1700, 2659, 0, 0, 0, 268, 2546, 5406, 0, 2338,
+    1808, 0, 0, 0, 1784, 0, 1830, 2954, 0, 221, 0, 3052, 0, 2512, 3295, 3606,
+    0, 2432, 198, 4426, 2537, 226, 0, 0, 0, 0, 3018, 2076, 2227, 2019, 2738, 2655,
+    4812, 1600, 288, 194, 0, 0, 0, 0, 5985, 3231, 0, 301, 5768, 282, 2273, 0,
+    0, 2483, 4264, 0, 311, 5087, 1962, 3186, 6187, 2315, 0, 3040, 0, 5890, 0, 4349,
+    0, 6187, 4262, 2534, 0, 7227, 302, 249, 3400, 3051, 0, 2519, 88, 0, 2627, 2206,
+    3558, 3463, 0, 2168, 2949, 2777, 3305, 262, 3074, 131, 0, 6355, 3130, 295, 272, 1676,
+    4429, 3129, 1754, 4893, 2415, 318, 1604, 2667, 0, 3196, 2612, 25, 2534, 6805, 6234, 50,
+    5151, 168, 108, 2636, 98, 0, 135, 1610, 5098, 2858, 83, 7015, 215, 5408, 0, 2723,
+    3129, 2815, 248, 262, 2772, 5141, 0, 0, 2540, 2963, 3222, 6031, 2602, 5967, 2625, 6082,
+    0, 2161, 4947, 0, 193, 6189, 1907, 230, 1986, 264, 2083, 2758, 0, 0, 2504, 2502,
+    3355, 0, 2908, 5362, 2859, 183, 4217, 3304, 3345, 2638, 5989, 192, 0, 0, 306, 1813,
+    262, 2235, 3009, 0, 5626, 2820, 0, 3427, 3793, 271, 2964, 2755, 263, 5443, 216, 2790,
+    3119, 1947, 2640, 5756, 1676, 259, 3040, 2777, 192, 4438, 0, 60, 1829, 3285, 0, 4665,
+    0, 2976, 2977, 1604, 3130, 5316, 0, 59, 3097, 161, 187, 4041, 2270, 2953, 79, 107,
+    210, 276, 182, 121, 0, 1776, 305, 6232, 0, 2934, 234, 0, 4261, 0, 0, 0,
+    0, 3550, 188, 0, 0, 0, 3383, 3186, 59, 2953, 2540, 157, 249, 2471, 176, 2930,
+    2582, 0, 3063, 2491, 6727, 121, 2277, 0, 185, 1608, 2315, 0, 3252, 199, 1963, 3233,
+    5802, 0, 1961, 0, 2559, 5812, 4900, 0, 273, 5629, 241, 3010, 0, 0, 1847, 5883,
+    5416, 6068, 2658, 2468, 231, 0, 143, 136, 233, 3041, 2516, 0, 4428, 0, 0, 145,
+    6806, 1820, 3841, 0, 210, 2777, 215, 2027, 296, 1743, 2726, 3055, 2556, 2714, 3129, 2823,
+    0, 5747, 1819, 4901, 3019, 0, 1756, 2667, 3166, 3173, 2141, 2952, 5848, 2842, 3106, 3034,
+    1610, 3619, 6686, 190, 2506, 4932, 2413, 1808, 5113, 83, 2433, 2728, 291, 3051, 2491, 0,
+    2816, 3392, 107, 0, 320, 3274, 23, 3097, 0, 52, 3441, 0, 2798, 4361, 190, 107,
+    0, 2234, 210, 0, 3056, 0, 3560, 0, 0, 6386, 89, 2710, 0, 3283, 0, 6393,
+    2604, 0, 0, 0, 0, 0, 4868, 1954, 2668, 60, 0, 214, 2534, 0, 5365, 2485,
+    131, 2733, 2283, 0, 3157, 0, 2794, 18, 0, 296, 3295, 2176, 2623, 4667, 2625, 248,
+    2645, 5590, 196, 2956, 2902, 0, 222, 5150, 5086, 0, 225, 2595, 2037, 3008, 2780, 101,
+    0, 0, 119, 2495, 1877, 1875, 23, 3186, 0, 1912, 12, 2216, 3317, 2602, 3330, 0,
+    3206, 3195, 0, 2592, 0, 109, 275, 2754, 271, 6679, 290, 313, 0, 2723, 157, 0,
+    3172, 167, 230, 121, 315, 1706, 2582, 5537, 4526, 2557, 4591, 2501, 4429, 210, 0, 72,
+    3307, 2613, 2745, 2560, 3654, 6022, 0, 201, 2579, 0, 5445, 2722, 1849, 0, 2416, 4005,
+    252, 0, 2788, 3041, 149, 5805, 2612, 0, 2144, 2347, 162, 2368, 6103, 1743, 4208, 0,
+    1831, 2864, 269, 15, 5105, 0, 0, 1648, 243, 0, 2569, 196, 3018, 2868, 2204, 0,
+    2776, 167, 0, 1822, 6435, 0, 0, 134, 3129, 0, 2680, 4431, 2931, 236, 0, 2661,
+    1605, 5319, 3019, 4761, 2667, 4656, 3238, 303, 6625, 3173, 3565, 2516, 0, 4894, 211, 190,
+    2309, 2470, 206, 2734, 0, 286, 2508, 2534, 6852, 3273, 186, 2491, 312, 224, 3051, 2217,
+    0, 2887, 0, 4870, 2406, 0, 1609, 3413, 0, 0, 0, 0, 2604, 167, 299, 0,
+    299, 3695, 0, 1895, 5885, 0, 5758, 0, 0, 171, 2765, 0, 4457, 1690, 0, 0,
+    2711, 0, 0, 0, 3096, 2236, 1715, 2215, 2702, 1820, 2285, 216, 131, 5801, 3348, 6315,
+    5030, 5308, 0, 2184, 2490, 5593, 4246, 0, 0, 4668, 0, 306, 0, 3068, 2968, 227,
+    0, 244, 0, 38, 3239, 3306, 5591, 3612, 0, 2963, 3172, 2845, 289, 5309, 3443, 4371,
+    143, 310, 0, 2606, 2843, 0, 0, 3835, 3089, 4236, 2730, 5538, 2102, 0, 5097, 2616,
+    4967, 2160, 3078, 208, 189, 229, 0, 211, 2424, 275, 3318, 218, 296, 2842, 3073, 2757,
+    3647, 2151, 3263, 3746, 2788, 2942, 5088, 276, 0, 0, 7147, 2996, 4044, 6266, 0, 0,
+    6195, 0, 2616, 3786, 1874, 0, 156, 2503, 0, 14, 2989, 6040, 2528, 0, 2471, 246,
+    3573, 0, 6026, 108, 4702, 1641, 260, 167, 2084, 2986, 131, 1606, 3274, 2138, 2569, 173,
+    259, 2637, 59, 64, 0, 4015, 269, 4790, 5107, 2681, 0, 3220, 2944, 2875, 0, 0,
+    0, 23, 0, 85, 0, 0, 0, 1822, 3769, 0, 2755, 236, 286, 0, 2479, 3229,
+    0, 1843, 2220, 3194, 3307, 3119, 0, 274, 257, 0, 4129, 4306, 0, 3766, 5994, 293,
+    2581, 3216, 2801, 4656, 2027, 2491, 0, 271, 110, 184, 0, 36, 2864, 156, 196, 11,
+    191, 2943, 7342, 0, 0, 155, 1824, 3086, 5979, 2700, 3074, 144, 5546, 0, 250, 2979,
+    0, 290, 0, 4498, 4490, 0, 0, 2760, 0, 4528, 2985, 0, 2490, 2879, 6591, 3367,
+    0, 300, 3866, 75, 2036, 2810, 179, 0, 255, 2629, 0, 2578, 1621, 2846, 312, 2601,
+    2590, 297, 3614, 0, 2526, 0, 3998, 2834, 4481, 0, 2185, 97, 3199, 2370, 5256, 2831,
+    2103, 2846, 0, 168, 307, 0, 0, 0, 5773, 1613, 1600, 2625, 41, 0, 320, 0,
+    0, 4094, 0, 2406, 0, 319, 181, 5910, 5538, 0, 0, 5102, 2523, 2162, 4704, 3663,
+    0, 0, 0, 7152, 3294, 3316, 5749, 3803, 2635, 0, 0, 3018, 1692, 0, 3053, 2778,
+    2153, 3096, 2611, 5691, 5091, 2209, 275, 5529, 225, 0, 219, 244, 317, 0, 2337, 229,
+    3151, 6209, 4209, 2820, 19, 62, 208, 190, 0, 0, 2684, 3052, 1656, 3069, 267, 61,
+    1919, 2490, 181, 0, 28, 2514, 0, 1765, 231, 2527, 0, 225, 4966, 73, 4755, 1708,
+    2281, 203, 208, 23, 2036, 0, 0, 211, 252, 3222, 1607, 0, 247, 0, 276, 3029,
+    322, 4322, 288, 2249, 3229, 0, 0, 292, 249, 1812, 4866, 0, 47, 0, 2985, 0,
+    156, 4647, 0, 0, 0, 108, 2550, 4007, 269, 4306, 0, 4270, 2952, 321, 299, 205,
+    0, 2985, 7414, 5846, 2527, 2802, 186, 3119, 213, 4784, 233, 77, 300, 2877, 4492, 4285,
+    0, 3141, 0, 0, 3086, 5526, 2524, 3435, 2811, 5142, 248, 0, 47, 3875, 120, 2007,
+    1605, 3168, 2920, 0, 2647, 5545, 0, 0, 5335, 2505, 0, 0, 0, 2225, 2760, 1728,
+    0, 271, 3785, 0, 4969, 291, 0, 3183, 1600, 3211, 2908, 312, 41, 2755, 1601, 2102,
+    245, 2503, 6006, 3244, 60, 3185, 0, 3640, 0, 5996, 0, 0, 179, 4000, 3253, 0,
+    4122, 36, 0, 155, 5415, 3260, 0, 2340, 0, 2381, 143, 0, 1621, 4921, 176, 0,
+    5791, 0, 3990, 2876, 0, 0, 0, 0, 2018, 3152, 198, 0, 0, 197, 3208, 2787,
+    1885, 2402, 309, 3096, 2854, 2899, 143, 1940, 95, 2725, 3018, 223, 2900, 0, 5092, 3546,
+    4719, 320, 231, 0, 0, 0, 4446, 75, 244, 0, 2514, 2546, 0, 2006, 0, 5748,
+    169, 2778, 311, 167, 2886, 281, 0, 35, 0, 0, 4705, 3298, 0, 218, 2180, 5692,
+    2891, 6211, 2153, 0, 2955, 0, 0, 1962, 0, 2480, 303, 5141, 0, 0, 1600, 0,
+    0, 0, 0, 190, 3228, 205, 0, 171, 283, 1603, 0, 0, 0, 2440, 2211, 0,
+    0, 0, 7118, 6066, 0, 0, 0, 2657, 0, 0, 294, 4393, 0, 3580, 0, 5537,
+    2649, 7010, 156, 108, 0, 2634, 0, 3868, 0, 6903, 2930, 100, 4930, 0, 320, 6045,
+    171, 0, 5528, 3033, 0, 0, 2040, 0, 0, 208, 2357, 3304, 0, 72, 2526, 248,
+    30, 0, 224, 312, 0, 3084, 0, 5144, 5583, 0, 0, 47, 3131, 0, 1767, 79,
+    2336, 4877, 3294, 257, 4028, 4674, 3042, 0, 144, 3293, 0, 5476, 2747, 6688, 0, 0,
+    1895, 261, 1971, 5526, 1608, 0, 2292, 0, 2755, 0, 284, 2912, 3287, 0, 0, 3175,
+    0, 3794, 3823, 192, 2964, 1621, 0, 281, 2809, 0, 231, 0, 0, 3255, 1611, 263,
+    2570, 3029, 2648, 187, 3142, 3260, 271, 2479, 95, 5428, 4261, 246, 0, 107, 12, 2656,
+    242, 0, 3428, 0, 2073, 1886, 221, 1677, 155, 3152, 2225, 191, 2986, 5409, 3173, 2140,
+    3382, 237, 0, 2568, 3106, 294, 3008, 246, 2965, 3234, 0, 0, 2981, 2591, 6358, 0,
+    4171, 176, 2546, 292, 302, 245, 303, 230, 0, 2901, 202, 6799, 85, 2835, 4732, 2878,
+    233, 0, 273, 0, 2295, 1964, 0, 81, 143, 241, 158, 85, 265, 0, 3012, 191,
+    186, 0, 0, 192, 0, 4087, 237, 0, 1608, 1772, 2735, 122, 3646, 3208, 0, 2480,
+    4051, 171, 0, 0, 2006, 2447, 0, 46, 317, 147, 1876, 5868, 1744, 1953, 2976, 0,
+    6069, 0, 267, 190, 208, 3184, 0, 219, 0, 2901, 3888, 5847, 3293, 3293, 258, 5831,
+    0, 6908, 4216, 202, 4426, 2882, 3043, 2897, 4043, 5528, 4933, 2502, 2095, 2011, 0, 2924,
+    0, 0, 5811, 52, 0, 5370, 3306, 0, 0, 2605, 2992, 4104, 2883, 2530, 0, 3035,
+    266, 0, 0, 0, 235, 224, 0, 0, 0, 0, 191, 0, 6498, 47, 5916, 219,
+    3019, 0, 3277, 1687, 2721, 0, 228, 2688, 2671, 0, 3194, 0, 6387, 185, 2919, 4448,
+    2515, 297, 3795, 2243, 2657, 0, 0, 0, 5801, 0, 203, 11, 0, 236, 2710, 1875,
+    0, 3175, 0, 0, 0, 3228, 63, 173, 2572, 5582, 2283, 2580, 2645, 2998, 4686, 0,
+    246, 96, 2536, 0, 83, 0, 2513, 4868, 6680, 2051, 2822, 2679, 0, 2956, 4887, 0,
+    0, 131, 0, 2302, 3429, 3088, 3546, 191, 203, 0, 206, 284, 0, 2219, 3085, 0,
+    294, 4535, 95, 1981, 2888, 6030, 2479, 85, 0, 237, 5194, 72, 1886, 2432, 1819, 3118,
+    3264, 0, 221, 0, 209, 0, 0, 5009, 0, 0, 302, 230, 0, 120, 2545, 0,
+    2732, 3042, 0, 3227, 192, 2624, 2205, 0, 265, 0, 6138, 2650, 2749, 243, 3902, 2692,
+    287, 3825, 3197, 3041, 269, 6203, 0, 2387, 3020, 3183, 3656, 4206, 214, 3604, 0, 2997,
+    3337, 174, 4065, 209, 178, 0, 2747, 258, 0, 0, 171, 4226, 5966, 0, 3326, 2140,
+    5326, 2847, 5985, 4483, 1896, 0, 317, 1742, 235, 2735, 2028, 259, 262, 0, 1609, 2776,
+    0, 2839, 219, 279, 6351, 1608, 0, 275, 168, 0, 2094, 3073, 2637, 1677, 0, 3205,
+    6033, 0, 0, 298, 2974, 2423, 5361, 3057, 5194, 1956, 2633, 3297, 2789, 180, 0, 5222,
+    0, 2765, 0, 3128, 76, 227, 0, 1780, 0, 286, 0, 270, 6421, 2787, 0, 0,
+    0, 0, 0, 2072, 2813, 0, 6238, 2898, 0, 5371, 1876, 0, 2257, 2110, 2518, 0,
+    222, 1944, 0, 216, 2691, 2286, 2853, 2770, 3381, 3133, 0, 0, 0, 0, 23, 4691,
+    203, 0, 5158, 2357, 2284, 133, 242, 3228, 0, 4562, 2834, 0, 4869, 2572, 298, 1745,
+    2348, 4274, 2513, 3090, 4548, 246, 4748, 3788, 4376, 4086, 2822, 54, 3321, 1819, 3316, 0,
+    0, 0, 0, 3452, 2889, 4982, 0, 0, 6701, 250, 0, 0, 1697, 2937, 0, 220,
+    296, 2657, 3240, 5968, 2086, 2538, 2479, 85, 3268, 4491, 2724, 0, 0, 2859, 0, 3062,
+    4219, 5765, 6472, 2403, 2504, 204, 187, 2930, 2468, 173, 84, 237, 2952, 192, 184, 146,
+    2149, 175, 197, 183, 2347, 65, 3649, 230, 308, 4279, 3273, 210, 0, 4315, 193, 6509,
+    3227, 2045, 291, 2931, 0, 5108, 0, 180, 3902, 0, 3098, 2242, 2170, 1941, 3198, 37,
+    2435, 3054, 269, 287, 273, 5229, 250, 4067, 63, 4226, 6714, 2939, 259, 3128, 1809, 170,
+    258, 2274, 0, 0, 0, 2216, 2031, 2776, 274, 1612, 262, 6365, 222, 0, 3768, 2900,
+    5986, 3838, 0, 3932, 2622, 2867, 2579, 222, 1742, 0, 2633, 0, 1677, 5756, 4867, 0,
+    263, 0, 0, 3086, 0, 2505, 0, 0, 223, 283, 298, 0, 4976, 309, 0, 5166,
+    267, 0, 291, 4499, 2096, 107, 170, 0, 2947, 2646, 2493, 2787, 3230, 0, 1698, 132,
+    3282, 0, 3391, 2898, 1613, 1885, 0, 3074, 1640, 0, 217, 255, 277, 2966, 3574, 3336,
+    5746, 4342, 6021, 4485, 0, 0, 3098, 5309, 97, 1602, 7356, 6231, 203, 0, 156, 2601,
+    2733, 0, 2964, 0, 2120, 2732, 1753, 4710, 5627, 145, 2483, 2206, 2638, 306, 3096, 0,
+    4228, 318, 0, 1622, 144, 4095, 3207, 2512, 3098, 2469, 4572, 0, 2943, 5810, 169, 298,
+    0, 2782, 0, 3055, 168, 213, 2832, 0, 2894, 2965, 316, 0, 0, 191, 5757, 0,
+    5203, 0, 204, 1811, 0, 180, 2721, 270, 3007, 0, 0, 285, 2403, 0, 5969, 3053,
+    2515, 2825, 2897, 2736, 5317, 2820, 2085, 287, 1600, 4453, 0, 232, 252, 3052, 4210, 0,
+    297, 4924, 0, 3194, 0, 11, 210, 254, 2693, 1846, 252, 6197, 3341, 0, 158, 4866,
+    0, 2809, 0, 0, 2047, 1661, 0, 0, 0, 6742, 4747, 3174, 249, 2721, 0, 242,
+    3557, 3271, 2847, 0, 132, 0, 6479, 15, 2501, 2721, 1809, 3168, 315, 2906, 304, 225,
+    2965, 4317, 3496, 62, 25, 0, 0, 0, 0, 3165, 3567, 5854, 3184, 3904, 2723, 2250,
+    0, 0, 2022, 24, 2205, 2843, 3128, 0, 132, 2736, 263, 2802, 1925, 219, 2666, 0,
+    175, 2701, 2537, 3086, 259, 1787, 48, 6246, 2813, 3668, 206, 1605, 2338, 6196, 1970, 206,
+    170, 84, 2204, 2868, 3132, 5765, 234, 4513, 5545, 2149, 2074, 7237, 2204, 110, 3241, 4263,
+    0, 1625, 304, 179, 3073, 2113, 177, 2273, 0, 2600, 4658, 0, 7218, 2468, 6716, 2980,
+    2941, 4701, 25, 3682, 3767, 4123, 1607, 7106, 0, 2593, 169, 0, 5536, 253, 49, 37,
+    4940, 5936, 0, 0, 0, 24, 0, 0, 229, 2206, 223, 3141, 3210, 0, 3118, 5527,
+    5152, 3286, 0, 1885, 3250, 3150, 0, 2348, 232, 2942, 0, 4876, 2963, 3218, 264, 0,
+    2506, 2756, 218, 0, 6022, 2721, 2842, 0, 2226, 0, 2525, 2337, 3548, 204, 3207, 0,
+    4096, 4460, 0, 3154, 4711, 0, 2139, 4059, 2546, 0, 1606, 0, 2790, 2520, 5188, 2087,
+    0, 247, 3176, 1905, 0, 2300, 306, 3986, 6280, 61, 3023, 0, 3260, 3217, 0, 5977,
+    2934, 6076, 297, 0, 2481, 3002, 0, 0, 2724, 0, 0, 2402, 2866, 2754, 0, 0,
+    278, 2008, 2960, 2291, 5767, 0, 0, 0, 2833, 3405, 5363, 0, 0, 0, 2066, 3153,
+    24, 148, 303, 3345, 2699, 4157, 0, 202, 226, 0, 0, 0, 6220, 11, 124, 0,
+    2495, 1714, 2801, 3240, 0, 0, 2359, 2634, 304, 236, 0, 1808, 0, 2876, 0, 3831,
+    3085, 2440, 257, 2784, 3239, 2205, 2204, 2856, 1810, 6889, 0, 2681, 1972, 2870, 3874, 2832,
+    1633, 3469, 195, 263, 2491, 5802, 293, 184, 2812, 5145, 297, 1839, 177, 200, 0, 312,
+    6753, 3135, 2661, 229, 2338, 0, 5548, 0, 273, 2836, 2964, 0, 3586, 4263, 178, 4436,
+    307, 3406, 2722, 261, 0, 7308, 1627, 69, 5889, 264, 315, 0, 3250, 2843, 3845, 2539,
+    1889, 272, 275, 3008, 2976, 1689, 0, 2710, 213, 2810, 0, 37, 0, 2888, 2611, 2809,
+    0, 6554, 3051, 0, 3315, 172, 0, 3275, 0, 1604, 305, 3710, 0, 5432, 207, 1901,
+    3547, 3611, 300, 2426, 4426, 0, 0, 3218, 2227, 112, 160, 0, 3360, 5114, 319, 3287,
+    2842, 2593, 6116, 257, 3173, 3230, 2142, 2301, 2074, 283, 4710, 0, 2656, 244, 3249, 0,
+    1676, 3206, 2546, 0, 0, 1961, 2568, 2139, 0, 0, 6415, 2792, 2999, 0, 3209, 1679,
+    3986, 0, 2626, 5751, 5590, 3475, 1878, 1615, 0, 2347, 0, 3618, 4657, 2836, 186, 0,
+    2215, 0, 0, 3108, 0, 220, 0, 111, 2483, 126, 2376, 2754, 3684, 0, 5626, 3014,
+    4649, 241, 0, 3170, 0, 4089, 2480, 172, 267, 3282, 60, 0, 0, 147, 314, 0,
+    0, 3045, 2492, 2578, 322, 233, 2534, 0, 213, 0, 2677, 1753, 4218, 2804, 23, 307,
+    279, 5864, 6092, 0, 307, 4436, 195, 5581, 2601, 0, 3262, 2502, 5378, 24, 2943, 6023,
+    2997, 0, 4042, 0, 3022, 5826, 5161, 2920, 0, 186, 0, 1853, 308, 1973, 4216, 2861,
+    3219, 177, 0, 0, 2876, 147, 2270, 3164, 0, 4052, 0, 3062, 1602, 2402, 3512, 3020,
+    97, 3777, 86, 241, 0, 0, 2714, 4427, 0, 6723, 0, 2008, 2722, 3019, 4265, 0,
+    119, 0, 107, 2159, 3180, 0, 2710, 2801, 0, 0, 2584, 264, 3689, 0, 2889, 0,
+    158, 0, 2245, 0, 4957, 0, 2890, 2998, 2888, 194, 0, 0, 3552, 236, 4427, 0,
+    0, 3304, 0, 3101, 2681, 2542, 4906, 1891, 192, 0, 0, 0, 3626, 301, 199, 4006,
+    1605, 0, 3480, 137, 0, 0, 5114, 6611, 2933, 2491, 3238, 2832, 2875, 0, 3140, 59,
+    0, 3203, 0, 0, 5582, 6038, 35, 2865, 245, 0, 283, 2799, 120, 0, 188, 2663,
+    3230, 3107, 2658, 1961, 1781, 0, 0, 0, 4657, 245, 0, 3282, 5628, 2215, 2911, 0,
+    0, 4648, 2628, 95, 71, 4886, 2442, 3041, 2612, 0, 0, 0, 3316, 2514, 84, 2768,
+    0, 4240, 2921, 2689, 2301, 3319, 0, 150, 3188, 3722, 48, 0, 2626, 283, 1601, 178,
+    5250, 2366, 5592, 3054, 2946, 4646, 0, 2141, 2083, 111, 2568, 2589, 0, 3329, 2952, 0,
+    2008, 1678, 291, 5553, 0, 3032, 2795, 0, 314, 2545, 0, 2138, 48, 279, 0, 294,
+    6394, 275, 195, 5993, 2909, 0, 0, 2910, 1753, 6056, 3139, 4754, 2766, 0, 0, 3108,
+    3261, 49, 3239, 2617, 0, 311, 1707, 4041, 71, 0, 3063, 0, 4427, 156, 4967, 47,
+    6350, 2704, 6352, 4867, 0, 0, 5388, 0, 2561, 5802, 322, 0, 311, 0, 0, 0,
+    241, 2567, 2776, 5086, 2892, 2282, 278, 5804, 49, 0, 2428, 0, 286, 224, 222, 3128,
+    281, 2468, 2769, 2611, 23, 2955, 28, 0, 2680, 0, 0, 0, 0, 0, 0, 6295,
+    4053, 2807, 4020, 285, 2495, 1904, 240, 24, 12, 0, 1743, 0, 2358, 0, 0, 98,
+    0, 3172, 220, 5585, 3109, 187, 2513, 7008, 71, 3066, 0, 4564, 3164, 0, 1608, 278,
+    5127, 2778, 0, 2038, 1875, 5340, 3122, 0, 2512, 0, 304, 2721, 0, 296, 3273, 2017,
+    187, 5316, 2744, 212, 2349, 3766, 2601, 4300, 292, 2838, 0, 0, 0, 0, 194, 2347,
+    0, 2737, 0, 0, 5756, 197, 3041, 2634, 0, 0, 4207, 209, 5774, 2922, 3700, 1952,
+    3227, 4661, 0, 4650, 49, 2875, 0, 234, 231, 2459, 0, 266, 5272, 1764, 2835, 0,
+    0, 3056, 4867, 146, 310, 48, 0, 2189, 2603, 0, 168, 302, 6274, 1941, 1963, 5562,
+    2947, 120, 0, 4481, 113, 308, 0, 273, 4242, 4885, 233, 5592, 3096, 0, 2713, 3996,
+    0, 0, 97, 5539, 3107, 0, 4767, 3556, 42, 1774, 0, 0, 2217, 2300, 6000, 1687,
+    0, 2404, 0, 7035, 258, 2568, 3143, 0, 3108, 0, 0, 3054, 3183, 3155, 0, 1742,
+    35, 0, 2614, 0, 2744, 0, 2514, 0, 1684, 0, 0, 0, 3099, 3040, 5230, 59,
+    0, 2105, 0, 4763, 71, 239, 0, 1722, 2567, 6371, 2855, 3776, 241, 4931, 2601, 295,
+    5307, 0, 288, 2644, 2916, 2600, 144, 156, 2989, 3102, 1632, 2968, 0, 2985, 145, 2073,
+    0, 2017, 2282, 0, 5002, 3087, 201, 0, 2768, 2966, 2682, 3018, 0, 2769, 227, 207,
+    2482, 39, 2943, 0, 3150, 4021, 3067, 0, 4344, 2472, 2207, 3172, 281, 0, 5759, 296,
+    188, 0, 7041, 4307, 0, 0, 0, 5822, 2909, 2733, 278, 0, 0, 0, 3076, 0,
+    0, 0, 2150, 72, 2293, 2856, 2497, 0, 2536, 2953, 1755, 2159, 4718, 62, 0, 2744,
+    2613, 2897, 3867, 0, 2634, 4076, 2694, 0, 0, 168, 1874, 3305, 1631, 131, 2272, 0,
+    2996, 0, 64, 6230, 26, 0, 1943, 0, 173, 2857, 233, 0, 164, 6679, 108, 3390,
+    2875, 0, 215, 2706, 0, 0, 1600, 0, 4151, 3117, 2824, 4454, 2083, 266, 207, 2931,
+    0, 2953, 207, 0, 0, 3219, 248, 1793, 3103, 2777, 3766, 262, 135, 4923, 0, 48,
+    0, 2688, 305, 0, 1609, 4821, 3194, 2787, 1809, 3998, 2481, 0, 181, 3040, 2648, 1830,
+    285, 0, 207, 11, 3557, 0, 0, 252, 297, 0, 0, 2743, 2800, 5406, 0, 1979,
+    2857, 0, 0, 209, 196, 5976, 15, 271, 0, 3661, 0, 180, 0, 2341, 2704, 0,
+    0, 2737, 2855, 2789, 4490, 212, 3293, 3118, 2567, 2831, 4426, 0, 2835, 219, 3426, 0,
+    179, 6251, 3088, 234, 0, 116, 251, 0, 0, 2273, 28, 5696, 3141, 0, 3107, 0,
+    0, 2535, 0, 252, 0, 0, 3242, 5690, 3150, 5882, 5985, 201, 60, 3197, 206, 0,
+    7223, 202, 3051, 6320, 2017, 38, 2271, 5307, 251, 0, 3399, 0, 0, 3229, 2624, 0,
+    7046, 2159, 1611, 3782, 2758, 2209, 2337, 229, 3021, 319, 0, 7014, 72, 2270, 2206, 0,
+    3228, 4207, 2354, 0, 262, 3830, 2656, 2579, 0, 251, 0, 3337, 1604, 0, 0, 0,
+    14, 176, 0, 2762, 198, 47, 0, 2423, 2150, 4445, 246, 5747, 2772, 2590, 0, 2618,
+    190, 6031, 0, 2529, 2942, 2605, 3882, 3129, 96, 1635, 1609, 62, 4728, 2635, 224, 3832,
+    239, 49, 5097, 2634, 83, 2558, 2502, 3163, 36, 0, 1985, 25, 0, 133, 5224, 1606,
+    183, 2790, 237, 3173, 2858, 3146, 4878, 168, 0, 0, 296, 281, 0, 2856, 0, 192,
+    3219, 0, 204, 193, 2788, 2235, 0, 3156, 4309, 112, 4930, 1906, 6693, 0, 71, 0,
+    52, 5988, 6832, 3785, 0, 199, 0, 6188, 4234, 3345, 240, 4272, 0, 4466, 0, 225,
+    0, 3821, 0, 0, 157, 5408, 0, 2547, 3095, 2800, 184, 268, 4130, 3989, 0, 2854,
+    1991, 0, 3328, 0, 293, 3040, 3208, 59, 2503, 0, 0, 0, 2623, 2934, 4656, 0,
+    0, 7026, 3074, 251, 0, 312, 184, 222, 2897, 2930, 3434, 182, 0, 121, 2471, 7291,
+    5141, 1840, 5726, 0, 3383, 2276, 179, 303, 0, 2140, 0, 0, 0, 2010, 0, 4534,
+    1838, 278, 283, 3185, 307, 2823, 2656, 3298, 1688, 202, 240, 2413, 217, 0, 6805, 0,
+    1604, 4428, 0, 5848, 0, 252, 108, 6066, 2117, 2557, 2367, 305, 5406, 131, 3646, 2076,
+    43, 0, 309, 14, 0, 155, 210, 0, 0, 3851, 0, 216, 88, 2659, 244, 3241,
+    0, 3252, 2810, 0, 0, 3041, 4426, 205, 2556, 0, 143, 4721, 3161, 169, 4437, 0,
+    2842, 2150, 2793, 0, 0, 2283, 3021, 0, 0, 1819, 295, 5581, 6560, 0, 0, 0,
+    3055, 268, 4357, 5747, 206, 4446, 236, 2139, 2075, 2744, 2990, 4877, 2402, 0, 0, 0,
+    3084, 0, 211, 0, 2678, 0, 136, 35, 270, 2977, 6694, 5141, 3173, 5098, 0, 2292,
+    6190, 2480, 2072, 3559, 2860, 3195, 0, 50, 87, 3053, 0, 2432, 4647, 4922, 0, 3051,
+    1754, 0, 272, 3354, 0, 2602, 0, 295, 2281, 240, 2161, 2501, 2733, 167, 2481, 89,
+    0, 230, 1996, 0, 2485, 3165, 4866, 6811, 0, 17, 2534, 0, 2009, 1879, 0, 3007,
+    3610, 0, 4974, 267, 3327, 0, 1912, 3793, 2590, 320, 3095, 3161, 3800, 0, 0, 0,
+    2502, 0, 0, 268, 6031, 3427, 210, 293, 2902, 2216, 4590, 0, 0, 0, 2484, 2225,
+    161, 0, 2541, 3172, 2897, 183, 193, 0, 2798, 0, 213, 2843, 4217, 2815, 0, 167,
+    2963, 3310, 298, 192, 4314, 0, 0, 5444, 0, 6022, 2986, 1706, 2913, 3823, 4542, 2294,
+    155, 275, 2732, 83, 0, 107, 238, 0, 1689, 252, 0, 2722, 4505, 0, 2745, 3285,
+    3195, 2658, 296, 2569, 0, 2701, 2612, 3109, 0, 0, 5410, 6477, 4430, 254, 0, 66,
+    0, 15, 2336, 1605, 3997, 2821, 207, 167, 2176, 277, 0, 3930, 3631, 2013, 199, 2568,
+    0, 2027, 0, 6194, 3161, 2215, 59, 0, 0, 4902, 269, 3140, 4005, 1859, 1648, 5096,
+    0, 3565, 304, 264, 0, 313, 2844, 5781, 309, 2936, 5333, 185, 23, 0, 295, 0,
+    236, 6068, 4442, 2234, 5813, 6848, 206, 119, 2754, 136, 61, 4879, 3056, 0, 241, 0,
+    0, 0, 2468, 146, 299, 3018, 0, 1829, 3041, 0, 3394, 2734, 2072, 2516, 2480, 218,
+    3306, 0, 1760, 301, 275, 1820, 5850, 0, 2433, 5306, 0, 0, 3347, 2285, 4370, 0,
+    3216, 111, 5993, 0, 2848, 276, 0, 5088, 135, 4482, 6025, 189, 0, 2952, 2957, 0,
+    3036, 0, 3184, 5308, 0, 1763, 84, 3252, 0, 90, 3166, 2623, 1880, 6816, 2996, 3331,
+    0, 0, 2831, 3548, 0, 7092, 2700, 4667, 0, 6399, 2757, 3238, 52, 0, 217, 2414,
+    251, 5378, 1706, 0, 0, 0, 2093, 3078, 0, 174, 4981, 0, 0, 2580, 2776, 2589,
+    181, 6389, 4868, 96, 2216, 3162, 2678, 0, 2668, 0, 1819, 0, 0, 0, 0, 3055,
+    0, 239, 3010, 2963, 0, 132, 293, 0, 3274, 5195, 195, 211, 214, 313, 1641, 265,
+    5086, 248, 2662, 2149, 1914, 1746, 0, 4506, 114, 2710, 2501, 3096, 5089, 0, 0, 4014,
+    64, 2809, 222, 2569, 3109, 0, 279, 4206, 0, 2513, 0, 27, 12, 0, 101, 4789,
+    0, 2956, 0, 1897, 4208, 2712, 0, 5634, 3769, 0, 0, 0, 226, 3176, 5581, 6202,
+    182, 135, 1875, 1624, 23, 0, 0, 0, 2549, 2864, 0, 4602, 2027, 2470, 3249, 290,
+    5342, 0, 2780, 0, 0, 3603, 3218, 3573, 3283, 0, 155, 218, 2831, 5979, 0, 3866,
+    18, 0, 2690, 4432, 196, 0, 0, 149, 0, 144, 0, 0, 0, 187, 6106, 0,
+    0, 3178, 5320, 2944, 0, 3227, 2579, 1650, 2168, 86, 3041, 312, 0, 200, 4870, 156,
+    0, 236, 2369, 0, 2745, 179, 2285, 1823, 1835, 2578, 2868, 0, 26, 0, 0, 2556,
+    2669, 1764, 1691, 0, 4483, 6451, 2339, 114, 4746, 3565, 6519, 2490, 2878, 5910, 4897, 2931,
+    1942, 2605, 3058, 0, 3089, 0, 2919, 73, 2414, 3172, 4251, 312, 0, 135, 2093, 3996,
+    2755, 307, 2406, 0, 0, 2447, 182, 2767, 2524, 273, 1608, 0, 5207, 2607, 4481, 2523,
+    4871, 190, 2474, 7148, 119, 5861, 179, 3040, 168, 0, 2645, 3315, 2518, 5758, 4647, 2635,
+    268, 244, 3162, 0, 0, 4945, 0, 0, 5276, 5536, 5884, 213, 3988, 2759, 1602, 0,
+    1812, 0, 2969, 2239, 5088, 0, 3096, 208, 1717, 0, 301, 3018, 3187, 280, 0, 320,
+    4278, 0, 5036, 225, 1655, 0, 2589, 2978, 231, 0, 2845, 3068, 2683, 267, 0, 2700,
+    2569, 3109, 64, 244, 6524, 6195, 2513, 218, 132, 0, 2759, 143, 1600, 3172, 4381, 0,
+    2798, 2160, 3318, 5642, 3022, 2996, 140, 2690, 2831, 182, 317, 0, 2207, 3011, 3227, 2998,
+    266, 0, 0, 3220, 143, 2151, 3080, 2953, 0, 66, 173, 5262, 2474, 2539, 2027, 0,
+    2548, 3194, 1888, 217, 3294, 2018, 3910, 1874, 7114, 245, 146, 2930, 0, 3573, 0, 0,
+    123, 0, 2536, 2811, 131, 0, 0, 5526, 0, 0, 108, 3866, 233, 293, 6270, 3095,
+    0, 260, 1825, 2864, 3200, 156, 1614, 2272, 0, 6883, 0, 26, 2170, 193, 6721, 300,
+    4101, 0, 2798, 2524, 248, 2765, 0, 2637, 2556, 189, 262, 2777, 0, 271, 183, 2908,
+    2006, 47, 0, 5669, 3999, 1601, 0, 2611, 1699, 5995, 223, 6136, 5470, 2867, 5536, 2879,
+    245, 4749, 3822, 2622, 2670, 2093, 5776, 2919, 3153, 11, 3575, 115, 312, 2908, 2381, 289,
+    3987, 196, 6330, 2865, 2886, 0, 0, 2850, 229, 0, 187, 2255, 0, 1643, 3251, 141,
+    0, 0, 2761, 71, 5385, 132, 1742, 0, 0, 3063, 2645, 244, 2503, 2988, 5981, 0,
+    2843, 0, 5309, 155, 0, 5171, 2337, 0, 3381, 0, 2425, 0, 3238, 1885, 2402, 0,
+    277, 4673, 4321, 0, 0, 2792, 0, 0, 175, 0, 291, 319, 3188, 0, 0, 1678,
+    303, 0, 124, 2834, 2733, 1962, 0, 0, 2837, 0, 4094, 273, 2787, 0, 2625, 2899,
+    2833, 278, 3353, 3106, 2869, 4704, 5643, 2649, 5746, 176, 2165, 2469, 0, 2210, 73, 2358,
+    0, 3319, 2677, 0, 2849, 3062, 0, 229, 1921, 0, 2512, 285, 191, 0, 5691, 2690,
+    3207, 2154, 72, 0, 4939, 5606, 2480, 0, 5912, 0, 2084, 0, 3462, 179, 2578, 0,
+    225, 252, 256, 4212, 0, 4286, 1607, 171, 2550, 4009, 2743, 190, 2822, 0, 6045, 4050,
+    210, 3117, 1766, 224, 3957, 0, 62, 74, 25, 5749, 0, 1970, 4921, 284, 5526, 212,
+    2798, 30, 3142, 0, 302, 0, 4785, 0, 0, 178, 2869, 250, 208, 2524, 0, 5825,
+    4445, 0, 2734, 6763, 3031, 2987, 39, 6687, 0, 156, 29, 0, 2501, 47, 2560, 187,
+    2765, 2551, 0, 0, 3877, 1609, 5819, 3991, 1666, 51, 3095, 279, 2986, 0, 2343, 0,
+    5427, 1745, 113, 0, 319, 0, 5527, 289, 4713, 3174, 0, 2143, 3276, 2155, 6166, 0,
+    4783, 3063, 2272, 2614, 0, 35, 2591, 0, 50, 0, 0, 2734, 2505, 5106, 3228, 219,
+    13, 0, 0, 2568, 2887, 135, 4681, 246, 71, 3493, 2954, 4135, 259, 5663, 2941, 4659,
+    6358, 1772, 244, 1971, 0, 1962, 0, 3384, 0, 2878, 2980, 1601, 147, 184, 0, 35,
+    4125, 3253, 281, 1680, 294, 1953, 0, 0, 2779, 5867, 2494, 85, 4261, 5717, 3245, 191,
+    229, 237, 0, 2877, 3190, 2677, 0, 0, 3262, 159, 2383, 0, 278, 2799, 0, 2892,
+    2910, 0, 2523, 155, 2139, 3821, 3682, 2876, 179, 155, 0, 2963, 0, 3646, 151, 198,
+    2832, 6075, 0, 4447, 3024, 2600, 3566, 169, 0, 207, 6904, 0, 310, 145, 0, 189,
+    100, 221, 3195, 95, 0, 4569, 36, 2084, 4216, 3602, 0, 4058, 143, 4043, 0, 5748,
+    1698, 2743, 218, 167, 2789, 0, 2725, 3207, 1951, 0, 0, 0, 2402, 2991, 182, 0,
+    5526, 3001, 0, 0, 0, 3062, 0, 6768, 219, 25, 303, 3073, 256, 243, 2472, 2536,
+    4648, 0, 0, 2480, 0, 321, 3036, 0, 0, 2019, 2924, 320, 3601, 0, 5361, 3336,
+    0, 255, 5637, 0, 2515, 0, 1955, 0, 235, 283, 0, 1606, 4261, 0, 0, 285,
+    0, 2679, 0, 0, 3794, 320, 2932, 2523, 147, 4866, 2688, 6351, 3095, 3776, 2931, 2699,
+    178, 47, 0, 3305, 2074, 2513, 2228, 2908, 212, 2933, 0, 0, 0, 3471, 0, 173,
+    0, 2649, 137, 247, 0, 3428, 0, 3228, 3033, 2302, 0, 2811, 203, 4675, 2536, 0,
+    4974, 2219, 0, 0, 2853, 242, 0, 3296, 202, 0, 2482, 236, 0, 2281, 181, 0,
+    0, 0, 0, 5600, 205, 3385, 3264, 2912, 1608, 3265, 2799, 302, 0, 0, 0, 50,
+    172, 0, 317, 0, 1631, 3086, 2810, 297, 2780, 5415, 0, 3339, 2732, 2624, 3824, 2748,
+    2103, 287, 2375, 1966, 107, 3262, 3110, 2703, 0, 0, 3655, 4804, 2523, 2952, 245, 302,
+    2336, 220, 173, 0, 110, 2846, 99, 36, 0, 0, 0, 155, 3030, 242, 291, 5105,
+    0, 2044, 0, 207, 2423, 2656, 3227, 0, 269, 1944, 2028, 287, 5554, 61, 3767, 0,
+    258, 3206, 1780, 0, 0, 6977, 3249, 4051, 275, 1603, 6089, 184, 219, 6360, 2139, 2839,
+    0, 1876, 0, 2754, 4187, 2020, 0, 0, 0, 0, 321, 0, 241, 2789, 0, 262,
+    0, 253, 5976, 2735, 2215, 198, 2993, 0, 2480, 0, 3297, 161, 1744, 1632, 2932, 5187,
+    2756, 298, 95, 0, 0, 2899, 2898, 2787, 0, 0, 0, 2931, 1676, 2633, 2517, 3295,
+    23, 4649, 35, 1905, 2578, 0, 5801, 1772, 285, 110, 294, 0, 3778, 0, 6021, 2351,
+    3294, 0, 0, 1612, 5601, 301, 1687, 238, 243, 0, 2866, 4482, 4687, 199, 5143, 0,
+    2655, 2057, 2965, 1622, 2956, 4491, 0, 4216, 261, 2583, 0, 3139, 0, 53, 0, 2415,
+    3448, 0, 2095, 3076, 6505, 54, 0, 5566, 2898, 0, 2853, 0, 0, 2926, 3043, 0,
+    0, 0, 2724, 3133, 3238, 2734, 212, 3196, 2347, 228, 2673, 4527, 3267, 240, 96, 6682,
+    0, 4938, 268, 3787, 0, 0, 158, 2930, 0, 3053, 287, 83, 0, 173, 3648, 0,
+    239, 2688, 134, 0, 0, 0, 1810, 0, 0, 2780, 205, 2715, 0, 247, 284, 2689,
+    4866, 2622, 1610, 3112, 2888, 0, 2513, 65, 3164, 0, 0, 0, 2712, 4888, 4437, 149,
+    3605, 313, 102, 1748, 235, 5105, 1780, 0, 0, 0, 3038, 2281, 0, 284, 210, 1605,
+    0, 238, 5032, 2909, 6471, 175, 2030, 282, 3903, 0, 288, 311, 0, 0, 6231, 0,
+    5966, 3283, 1602, 3838, 7097, 0, 1896, 0, 184, 0, 5756, 0, 6351, 0, 240, 0,
+    0, 309, 249, 2738, 0, 205, 257, 0, 0, 2537, 2227, 2417, 0, 3308, 2138, 3770,
+    3075, 2624, 0, 2899, 295, 1898, 2483, 272, 2215, 2946, 0, 2493, 3186, 302, 3074, 180,
+    2589, 4349, 4227, 5222, 2898, 2535, 2751, 194, 1601, 0, 110, 1782, 263, 6238, 2787, 2518,
+    6187, 0, 170, 2638, 221, 2853, 2271, 0, 0, 86, 221, 3130, 0, 0, 4484, 283,
+    262, 261, 265, 1608, 1697, 5985, 2964, 6102, 168, 2733, 2094, 6353, 0, 1623, 3097, 5186,
+    0, 3326, 0, 0, 0, 2866, 0, 304, 0, 0, 2636, 0, 0, 2976, 2931, 3074,
+    156, 0, 0, 5151, 0, 0, 3053, 3113, 316, 2021, 183, 2205, 5801, 0, 2756, 1613,
+    5326, 3065, 131, 0, 258, 0, 2545, 284, 0, 0, 0, 6240, 3547, 2558, 2779, 6046,
+    7162, 2679, 4453, 2897, 4946, 2858, 0, 0, 2504, 25, 0, 1846, 2535, 2770, 0, 76,
+    4229, 0, 2809, 0, 98, 221, 204, 2820, 2083, 193, 1813, 280, 238, 287, 0, 4438,
+    96, 4701, 0, 2721, 5567, 2513, 0, 199, 0, 3194, 3771, 60, 317, 24, 234, 6196,
+    0, 0, 5109, 249, 0, 2646, 1946, 2655, 11, 0, 250, 83, 216, 0, 315, 15,
+    3550, 0, 0, 0, 288, 222, 2032, 2865, 6367, 3163, 5150, 311, 2934, 0, 0, 4327,
+    2271, 297, 0, 259, 282, 0, 5449, 2998, 3063, 268, 2930, 146, 3327, 2953, 0, 0,
+    2538, 0, 0, 2701, 0, 0, 3905, 0, 2779, 5883, 2813, 2540, 5416, 206, 3302, 304,
+    6038, 0, 5765, 3199, 5142, 272, 2559, 223, 295, 2712, 210, 193, 2932, 6715, 5003, 304,
+    183, 4501, 1961, 3840, 6245, 4455, 3132, 1605, 1809, 110, 5967, 2843, 3130, 1742, 3054, 5231,
+    0, 277, 1622, 120, 233, 1887, 7056, 2614, 4350, 0, 262, 2966, 5536, 1829, 265, 188,
+    2171, 2959, 5986, 61, 0, 6109, 1773, 3286, 2670, 2098, 232, 3183, 0, 7037, 0, 3240,
+    2952, 4095, 5756, 4932, 2506, 1701, 2204, 107, 217, 2639, 2783, 1613, 0, 3250, 0, 1895,
+    0, 1742, 0, 0, 3023, 215, 2424, 0, 187, 2756, 291, 3133, 0, 2525, 131, 2898,
+    1885, 2821, 24, 0, 3464, 0, 0, 2315, 3618, 2699, 5097, 3392, 2842, 1756, 3284, 277,
+    0, 0, 4701, 2440, 3009, 0, 290, 2855, 3073, 2842, 2771, 4453, 2679, 265, 0, 3175,
+    2961, 0, 2613, 0, 1978, 2754, 3065, 0, 1678, 0, 2988, 0, 280, 2402, 2206, 2485,
+    2512, 210, 4307, 249, 2469, 2625, 2833, 1754, 0, 3945, 0, 6216, 226, 3558, 185, 0,
+    170, 2291, 4429, 1814, 2545, 2832, 72, 2655, 5386, 0, 0, 0, 0, 0, 191, 199,
+    2820, 196, 2739, 2495, 3044, 0, 0, 233, 0, 4041, 288, 0, 62, 4291, 3239, 4925,
+    2826, 5856, 2085, 0, 2358, 0, 3195, 2701, 3328, 0, 3411, 25, 3207, 0, 124, 0,
+    2733, 182, 167, 200, 2560, 2785, 2551, 1839, 2425, 173, 1605, 2234, 5307, 6022, 0, 229,
+    0, 178, 5142, 3134, 0, 280, 1877, 3132, 1848, 3020, 252, 0, 254, 5017, 6749, 0,
+    3654, 279, 2688, 214, 1609, 15, 318, 2073, 3176, 201, 1831, 3229, 2888, 2368, 4208, 1809,
+    3273, 4894, 0, 181, 174, 177, 3287, 2534, 3099, 0, 0, 2710, 2669, 2810, 2338, 3129,
+    175, 219, 0, 3831, 1605, 193, 0, 3405, 2710, 3174, 7242, 6798, 232, 2501, 2727, 6233,
+    2740, 1679, 264, 3611, 2226, 172, 5121, 107, 306, 6256, 2743, 281, 5152, 259, 6414, 60,
+    1681, 131, 5371, 0, 2507, 206, 2593, 2309, 6000, 4264, 2974, 0, 2217, 2975, 225, 5664,
+    0, 5099, 0, 0, 2997, 3241, 2604, 5967, 2582, 0, 0, 0, 0, 2754, 5662, 2492,
+    250, 0, 27, 2490, 0, 0, 0, 0, 0, 0, 3833, 2722, 0, 4462, 2270, 283,
+    2206, 3074, 4701, 2600, 2236, 4426, 5846, 0, 0, 2880, 2723, 2537, 0, 0, 3831, 3683,
+    314, 2800, 0, 3228, 3207, 3282, 4088, 6023, 3106, 3013, 2865, 220, 2963, 0, 0, 0,
+    0, 0, 0, 36, 3620, 6077, 3045, 72, 176, 25, 0, 0, 3442, 267, 0, 2361,
+    3062, 306, 2525, 0, 5581, 109, 0, 4611, 4271, 159, 2727, 0, 145, 2139, 2677, 0,
+    4218, 3073, 1715, 2702, 2920, 3163, 1987, 0, 0, 2402, 2943, 2090, 1612, 1972, 4044, 0,
+    3263, 39, 0, 2007, 0, 192, 0, 167, 3020, 59, 2481, 3136, 1839, 2767, 2790, 0,
+    177, 2416, 3786, 2757, 1677, 6829, 4052, 150, 2681, 5146, 0, 3801, 4490, 0, 2471, 213,
+    6266, 0, 0, 0, 1609, 2842, 6115, 2842, 3345, 6918, 0, 2672, 236, 14, 159, 266,
+    2646, 189, 306, 224, 196, 2244, 3272, 2864, 233, 2888, 2493, 277, 2845, 3847, 71, 5363,
+    1808, 2492, 38, 3476, 2077, 5333, 1841, 290, 2542, 257, 0, 145, 0, 2493, 286, 137,
+    3625, 2491, 1822, 107, 0, 0, 225, 2230, 3998, 184, 2710, 2812, 0, 2037, 2470, 0,
+    131, 11, 217, 3416, 160, 5115, 5802, 322, 175, 0, 2865, 5099, 5090, 2934, 0, 2581,
+    2349, 3194, 4526, 200, 4666, 2722, 307, 0, 3776, 211, 3296, 3019, 2220, 0, 0, 197,
+    5680, 2799, 2910, 1640, 0, 2526, 2627, 2646, 0, 0, 3100, 3021, 311, 3319, 0, 3366,
+    0, 2810, 2669, 4646, 2656, 3718, 297, 0, 0, 0, 0, 260, 2754, 182, 0, 220,
+    5553, 2921, 315, 0, 6575, 3613, 2357, 0, 112, 3041, 49, 300, 2103, 2933, 2177, 315,
+    16, 0, 4266, 6807, 1604, 2946, 2846, 0, 2427, 2589, 2613, 1878, 48, 2711, 0, 2102,
+    4045, 274, 6393, 3054, 4755, 253, 275, 3317, 111, 3154, 109, 2795, 0, 71, 0, 2744,
+    186, 0, 0, 0, 1855, 5773, 3283, 167, 2946, 2988, 5538, 3271, 71, 0, 2985, 4876,
+    3152, 0, 2215, 0, 308, 0, 2291, 2072, 224, 2487, 5836, 0, 2209, 2760, 3053, 3249,
+    5749, 1676, 2758, 1690, 5978, 4233, 2616, 0, 1919, 0, 6645, 2282, 285, 0, 0, 2139,
+    245, 2578, 3019, 2646, 0, 0, 0, 0, 0, 0, 301, 159, 2673, 16, 0, 0,
+    303, 196, 299, 2864, 2036, 0, 0, 1904, 5201, 28, 2281, 0, 0, 4866, 2942, 0,
+    3779, 3987, 2492, 3077, 4966, 312, 212, 0, 2965, 0, 3122, 5896, 290, 0, 0, 4563,
+    1609, 2678, 0, 4665, 2018, 0, 0, 0, 38, 0, 2470, 3064, 0, 278, 4306, 4725,
+    2527, 3875, 238, 1605, 0, 2736, 2347, 2415, 4529, 3048, 187, 1707, 0, 0, 3063, 2603,
+    0, 0, 41, 0, 3777, 0, 3206, 0, 2675, 0, 35, 0, 144, 3307, 3696, 0,
+    188, 4492, 0, 3283, 2215, 0, 195, 2878, 1632, 296, 244, 6294, 2006, 5759, 2732, 6736,
+    209, 0, 3167, 3172, 0, 3183, 6273, 311, 0, 0, 310, 2714, 197, 51, 4007, 1648,
+    2722, 3636, 5116, 233, 61, 273, 0, 5561, 0, 5812, 158, 2875, 2177, 266, 95, 1600,
+    2921, 0, 23, 2340, 0, 2996, 2614, 123, 5010, 3155, 213, 2855, 2405, 311, 2514, 3097,
+    2725, 0, 1721, 1941, 3238, 0, 2721, 2711, 3054, 4072, 6395, 172, 3141, 257, 243, 4756,
+    320, 3099, 309, 120, 0, 4876, 3556, 0, 189, 278, 3546, 0, 2291, 2138, 233, 108,
+    2072, 4391, 0, 4446, 0, 0, 0, 0, 0, 0, 0, 4719, 294, 0, 2630, 0,
+    3249, 0, 2282, 75, 2497, 1601, 0, 0, 0, 2985, 111, 0, 91, 3231, 2567, 3140,
+    219, 3107, 2955, 0, 2039, 5537, 0, 0, 0, 159, 129, 4669, 281, 5916, 0, 0,
+    6130, 4343, 3150, 271, 2589, 4020, 0, 3304, 0, 0, 0, 3988, 0, 0, 283, 5195,
+    0, 1709, 0, 39, 241, 314, 3087, 281, 4967, 0, 0, 207, 272, 0, 156, 5186,
+    72, 72, 1754, 0, 2482, 2205, 2472, 3162, 144, 0, 2564, 3282, 0, 322, 251, 3076,
+    304, 6210, 0, 265, 2493, 2149, 207, 2757, 3867, 5529, 2644, 0, 0, 0, 2617, 0,
+    222, 2272, 3293, 3131, 2705, 30, 0, 0, 0, 0, 7009, 5807, 2809, 0, 3029, 2680,
+    1600, 3029, 2407, 98, 2612, 62, 4026, 78, 0, 1743, 0, 4150, 0, 2880, 4703, 2481,
+    1964, 0, 3175, 4493, 3557, 197, 224, 0, 0, 305, 0, 0, 3766, 0, 3823, 3869,
+    226, 6316, 1608, 4817, 120, 2190, 0, 24, 2855, 6186, 1621, 187, 2648, 0, 1941, 3260,
+    3029, 2547, 2339, 292, 5306, 0, 0, 3218, 172, 0, 4439, 0, 3382, 311, 194, 0,
+    191, 280, 2282, 0, 5492, 0, 0, 292, 5976, 0, 5634, 0, 190, 233, 320, 0,
+    0, 0, 292, 5004, 4270, 0, 0, 266, 146, 4867, 2789, 0, 2835, 200, 2009, 0,
+    4921, 78, 1895, 2747, 0, 231, 0, 0, 3187, 1765, 0, 2713, 3232, 0, 0, 5165,
+    208, 0, 4731, 1609, 317, 1631, 116, 2887, 0, 4481, 251, 0, 4396, 2985, 2897, 2930,
+    3293, 3337, 202, 4087, 95, 0, 0, 184, 179, 2977, 2271, 314, 0, 314, 2668, 5189,
+    199, 3304, 0, 6152, 0, 2766, 16, 0, 2952, 59, 1829, 3240, 0, 281, 5641, 294,
+    3184, 42, 62, 2011, 0, 5882, 7042, 2433, 252, 3087, 2528, 0, 5528, 4772, 2481, 3040,
+    63, 0, 315, 1603, 166, 268, 5647, 5159, 1601, 12, 1757, 0, 1733, 4931, 2762, 3162,
+    3020, 258, 0, 0, 0, 4031, 2471, 0, 5968, 3151, 1634, 1755, 2971, 4436, 0, 6387,
+    3175, 2987, 0, 0, 52, 2732, 4702, 4921, 0, 0, 2073, 3029, 2685, 3178, 305, 0,
+    47, 0, 2880, 228, 301, 0, 0, 0, 225, 0, 133, 206, 0, 0, 0, 292,
+    2095, 3581, 5847, 0, 0, 4308, 2605, 0, 3881, 3010, 2650, 2476, 2243, 0, 291, 1980,
+    295, 0, 2998, 2776, 2953, 0, 3145, 3121, 266, 143, 194, 0, 2855, 0, 74, 0,
+    0, 3095, 2635, 0, 0, 2708, 6104, 2536, 235, 84, 2482, 3161, 2854, 5598, 3557, 0,
+    191, 3328, 3044, 240, 0, 0, 284, 68, 2547, 233, 178, 26, 88, 2901, 6680, 131,
+    0, 5370, 6800, 0, 0, 1875, 72, 0, 1745, 4129, 122, 5310, 0, 3118, 0, 0,
+    0, 293, 0, 2602, 2692, 223, 309, 3189, 3381, 0, 268, 3073, 2766, 0, 262, 0,
+    0, 0, 288, 4534, 0, 2923, 2777, 99, 1608, 2897, 1688, 4102, 209, 202, 2766, 1609,
+    317, 268, 0, 3030, 0, 2743, 1600, 1886, 3197, 2668, 5406, 181, 0, 0, 2367, 0,
+    0, 2387, 2930, 209, 5442, 1832, 1611, 1753, 194, 171, 125, 249, 1940, 1830, 180, 2622,
+    252, 227, 3021, 0, 3426, 4483, 0, 0, 0, 0, 2075, 6230, 5532, 3602, 0, 2837,
+    0, 72, 0, 2822, 3261, 3251, 6470, 12, 155, 5172, 5371, 4893, 3667, 2789, 2310, 3046,
+    2603, 0, 2484, 0, 4426, 0, 5970, 5153, 2402, 3231, 6420, 3053, 175, 3161, 2308, 3106,
+    4706, 1677, 0, 303, 209, 0, 3084, 0, 3062, 6693, 0, 0, 0, 229, 2624, 258,
+    3151, 0, 0, 2657, 0, 5087, 2110, 206, 284, 122, 2677, 3295, 170, 3337, 0, 0,
+    295, 2765, 2237, 2967, 0, 2256, 7022, 3327, 2357, 0, 0, 0, 0, 3318, 5086, 4562,
+    0, 2281, 2072, 0, 2986, 3126, 0, 59, 17, 2423, 0, 71, 54, 0, 246, 221,
+    87, 2572, 4273, 1908, 1820, 3893, 49, 191, 289, 5605, 100, 176, 2547, 179, 0, 230,
+    36, 1608, 2935, 2602, 2531, 250, 2558, 4428, 3046, 3007, 296, 209, 192, 2603, 5811, 2216,
+    2666, 228, 0, 32, 2007, 2479, 178, 2913, 0, 237, 0, 5977, 4885, 0, 4131, 4219,
+    2936, 1689, 224, 5326, 0, 3310, 3785, 2140, 219, 3383, 202, 6699, 4541, 0, 2117, 1992,
+    0, 6120, 204, 2776, 1609, 0, 2160, 0, 0, 3902, 304, 2647, 0, 0, 279, 3030,
+    76, 2052, 275, 317, 2503, 0, 3194, 5409, 0, 3098, 0, 4314, 3556, 110, 2897, 65,
+    0, 0, 1744, 0, 184, 218, 4066, 2769, 134, 1940, 5333, 279, 2821, 0, 2078, 254,
+    1897, 2326, 188, 4226, 6365, 2656, 2568, 222, 211, 61, 0, 259, 2900, 2854, 6499, 3108,
+    4930, 2481, 0, 3163, 3274, 3438, 0, 1698, 0, 185, 6267, 4887, 295, 0, 1677, 6031,
+    17, 4536, 2799, 11, 3768, 278, 0, 307, 0, 297, 217, 3997, 4975, 217, 241, 0,
+    23, 0, 5318, 3195, 4499, 5810, 0, 259, 3548, 0, 3646, 309, 0, 0, 3009, 146,
+    213, 1874, 3018, 2651, 0, 205, 3336, 0, 2999, 0, 0, 0, 6812, 158, 1640, 0,
+    0, 0, 5251, 2755, 5086, 310, 2677, 3041, 292, 5309, 2118, 206, 2486, 255, 1763, 145,
+    5599, 4710, 0, 203, 2831, 0, 1819, 201, 0, 2944, 0, 0, 0, 167, 1879, 3330,
+    2847, 1821, 3055, 0, 37, 0, 0, 0, 2469, 182, 2744, 230, 4570, 2721, 319, 11,
+    5849, 5746, 7091, 270, 201, 5993, 6066, 0, 0, 2602, 3047, 232, 119, 0, 6704, 89,
+    133, 2161, 2072, 228, 3053, 2085, 0, 108, 2952, 155, 0, 5757, 3062, 109, 4180, 4220,
+    320, 2151, 2413, 3098, 4210, 161, 0, 132, 3185, 3796, 174, 245, 196, 2776, 4316, 222,
+    304, 3931, 2515, 285, 2712, 3120, 0, 4866, 4598, 2802, 0, 2781, 3162, 1689, 0, 3086,
+    2699, 4505, 0, 1811, 0, 0, 132, 0, 5978, 50, 3128, 2556, 181, 254, 2225, 3073,
+    6478, 2046, 270, 3128, 134, 85, 0, 0, 0, 2834, 1913, 0, 3430, 2967, 87, 290,
+    1649, 2904, 0, 6300, 267, 0, 0, 0, 4278, 0, 0, 3767, 0, 3172, 2480, 3021,
+    2470, 5341, 0, 26, 3205, 238, 4877, 0, 298, 0, 2799, 3806, 0, 291, 0, 4553,
+    182, 201, 4646, 214, 1624, 2736, 0, 133, 3174, 0, 0, 215, 0, 27, 2006, 2701,
+    0, 4511, 2468, 2589, 5545, 84, 0, 2205, 169, 5223, 2732, 0, 2652, 3490, 2996, 2366,
+    4123, 179, 0, 0, 3338, 213, 158, 0, 2111, 0, 0, 207, 2516, 1697, 321, 0,
+    0, 4460, 5056, 6194, 4746, 6238, 0, 1820, 0, 2504, 318, 3227, 156, 5669, 2159, 6714,
+    6866, 24, 3565, 4782, 270, 2348, 306, 3996, 0, 0, 2473, 2607, 4987, 91, 312, 3220,
+    2556, 0, 1604, 4247, 0, 0, 0, 3243, 1764, 297, 11, 0, 2798, 0, 4882, 0,
+    2072, 187, 0, 185, 208, 131, 61, 6404, 2756, 2919, 248, 2667, 177, 2087, 2517, 133,
+    253, 3023, 0, 0, 3315, 2721, 2998, 158, 220, 3128, 2724, 2405, 3988, 35, 0, 172,
+    2958, 132, 2877, 3845, 0, 3548, 6279, 5378, 0, 0, 3063, 271, 0, 3162, 285, 2603,
+    2062, 3253, 2969, 0, 244, 3057, 1810, 0, 5969, 5861, 0, 0, 4711, 5414, 2337, 0,
+    4795, 4377, 4922, 5086, 3088, 0, 267, 3469, 121, 4748, 5968, 3079, 6520, 3020, 0, 56,
+    0, 0, 3185, 222, 3120, 257, 2845, 93, 0, 2414, 2589, 0, 2644, 5363, 2207, 279,
+    1626, 265, 3769, 2844, 226, 229, 0, 0, 1888, 148, 2723, 5306, 2473, 2580, 251, 65,
+    2870, 2930, 107, 2843, 2008, 1897, 3909, 7102, 124, 6074, 5196, 286, 273, 2525, 195, 213,
+    169, 4516, 293, 259, 2205, 174, 0, 5767, 2149, 2712, 1899, 0, 1788, 6882, 2812, 0,
+    2689, 0, 27, 103, 4436, 5548, 0, 274, 2336, 26, 4206, 4263, 316, 146, 0, 3142,
+    0, 3007, 3176, 2809, 0, 2944, 1642, 0, 4156, 0, 2798, 1942, 178, 0, 0, 226,
+    1764, 6743, 2546, 1688, 200, 0, 24, 5235, 0, 0, 3209, 2152, 2833, 0, 261, 6206,
+    3822, 2866, 3283, 3710, 3996, 1614, 3218, 2483, 5751, 2666, 0, 3547, 3221, 2908, 0, 3353,
+    6087, 155, 153, 0, 11, 0, 4445, 0, 2581, 0, 0, 186, 4658, 189, 0, 2970,
+    5213, 280, 2406, 143, 0, 0, 200, 108, 2358, 2549, 272, 5761, 2988, 0, 5421, 2792,
+    279, 2978, 71, 0, 0, 197, 4886, 5980, 4872, 254, 3574, 2535, 3987, 218, 208, 187,
+    0, 242, 5042, 3986, 194, 0, 5642, 3063, 3398, 5385, 0, 84, 5308, 13, 5626, 2271,
+    2669, 47, 1812, 5775, 0, 2974, 5911, 282, 307, 1662, 0, 2733, 1676, 2480, 3092, 2922,
+    1678, 2877, 0, 0, 119, 0, 143, 4086, 1753, 2448, 2644, 2141, 0, 4649, 2414, 0,
+    315, 3610, 0, 0, 3243, 4280, 2666, 302, 0, 2142, 4673, 229, 273, 285, 0, 179,
+    96, 3040, 6038, 3162, 5236, 5863, 3022, 2723, 4951, 3184, 0, 0, 0, 2475, 3317, 0,
+    212, 0, 2876, 6071, 2151, 26, 0, 278, 29, 234, 123, 2767, 0, 1853, 0, 5378,
+    301, 4924, 132, 3117, 4042, 3062, 0, 0, 5825, 1961, 0, 283, 2083, 3953, 245, 225,
+    189, 2677, 119, 238, 67, 0, 6722, 199, 0, 51, 218, 4323, 0, 5549, 4436, 6198,
+    24, 3511, 0, 2890, 2836, 0, 3282, 2987, 2933, 0, 2342, 0, 0, 2404, 0, 317,
+    0, 4285, 195, 2614, 1607, 3142, 0, 239, 2998, 3211, 2953, 0, 0, 2540, 301, 2941,
+    2666, 0, 0, 3161, 0, 0, 0, 0, 4001, 4712, 3011, 3576, 1890, 2801, 86, 3711,
+    4750, 0, 2548, 256, 0, 2226, 5582, 3294, 0, 268, 1600, 0, 269, 3990, 0, 137,
+    2592, 0, 0, 3391, 245, 50, 2552, 178, 3821, 5663, 2837, 255, 188, 2301, 0, 6141,
+    6894, 226, 1602, 0, 0, 0, 223, 2535, 299, 2777, 3095, 155, 0, 5312, 260, 4657,
+    0, 0, 3307, 2218, 2867, 49, 0, 1763, 2271, 2640, 5628, 0, 31, 2626, 0, 157,
+    133, 2670, 2768, 0, 0, 39, 2877, 2923, 2622, 3262, 2382, 3242, 4107, 0, 1680, 1616,
+    200, 207, 2821, 5819, 0, 3602, 2865, 3201, 2952, 0, 2570, 3110, 198, 0, 119, 71,
+    0, 0, 0, 2794, 150, 185, 0, 0, 3618, 285, 2402, 229, 5473, 2494, 2545, 2825,
+    6555, 5855, 2523, 3023, 5096, 322, 5387, 2725, 291, 3032, 0, 1753, 5176, 0, 3251, 4680,
+    273, 0, 1678, 186, 2975, 2472, 0, 1951, 0, 4445, 175, 4041, 2919, 2417, 2871, 2561,
+    3043, 0, 0, 278, 0, 1974, 2515, 6764, 0, 0, 2625, 269, 3315, 303, 292, 5089,
+    2567, 0, 199, 184, 1934, 2833, 0, 74, 2019, 265, 2660, 0, 305, 320, 1743, 2017,
+    0, 2358, 2260, 2028, 4646, 2611, 210, 2560, 0, 2677, 31, 2680, 0, 4427, 283, 0,
+    0, 191, 2931, 5636, 3066, 3184, 2735, 0, 1970, 3549, 124, 5804, 6045, 0, 3776, 159,
+    2872, 2805, 4050, 0, 3111, 2513, 245, 4296, 3271, 0, 0, 0, 163, 145, 1876, 2143,
+    3326, 3305, 5585, 0, 4674, 86, 0, 0, 5340, 0, 5746, 50, 2911, 3296, 5827, 2614,
+    0, 0, 5663, 0, 272, 0, 280, 178, 0, 120, 1602, 212, 0, 2094, 0, 0,
+    3407, 247, 4660, 0, 3150, 0, 1680, 2594, 3384, 302, 51, 3008, 3319, 2744, 4140, 201,
+    5592, 4207, 97, 4043, 2876, 2810, 0, 2300, 193, 2769, 5986, 0, 174, 71, 3601, 3031,
+    272, 1952, 3821, 0, 256, 3262, 307, 227, 3570, 3690, 2974, 3276, 0, 2270, 2746, 3183,
+    6616, 0, 219, 161, 0, 0, 0, 0, 4885, 0, 1603, 25, 0, 0, 173, 3067,
+    0, 5539, 0, 0, 2941, 287, 0, 2887, 279, 3108, 2360, 2571, 2534, 3151, 2765, 0,
+    3776, 0, 3295, 186, 3040, 0, 6359, 243, 49, 2601, 278, 5096, 0, 35, 2351, 113,
+    0, 289, 5379, 0, 1607, 267, 3073, 3111, 0, 0, 1605, 4097, 241, 284, 1714, 0,
+    0, 1742, 2508, 3025, 4648, 2029, 0, 0, 0, 2886, 0, 0, 0, 2691, 0, 184,
+    159, 3346, 0, 0, 3004, 2020, 217, 4241, 1682, 2947, 2169, 4449, 147, 75, 2919, 2517,
+    2613, 221, 0, 277, 2729, 3043, 2677, 2682, 310, 207, 2746, 1621, 2832, 2945, 0, 0,
+    2469, 145, 199, 2875, 5600, 5586, 1610, 3099, 2933, 4482, 3184, 2704, 59, 4575, 0, 0,
+    1744, 319, 245, 5821, 39, 167, 182, 1772, 0, 2494, 4062, 2472, 0, 0, 4225, 4216,
+    83, 3306, 2910, 3117, 238, 53, 4307, 0, 2644, 2898, 3139, 0, 2744, 2853, 0, 292,
+    284, 50, 261, 240, 0, 120, 2496, 2778, 5528, 6230, 4718, 2925, 228, 2699, 168, 2694,
+    4974, 4013, 3778, 0, 0, 5677, 2413, 310, 268, 0, 2085, 2915, 2876, 3316, 0, 3075,
+    285, 209, 109, 2715, 0, 196, 0, 3117, 2724, 320, 0, 3826, 0, 0, 0, 13,
+    3183, 0, 71, 48, 0, 4923, 3101, 2556, 2600, 2104, 212, 4437, 2750, 3936, 2074, 4490,
+    0, 2857, 2570, 6580, 134, 3426, 3194, 181, 0, 0, 1809, 181, 2378, 0, 2765, 2955,
+    0, 0, 0, 0, 3074, 28, 2469, 5325, 221, 2846, 220, 3150, 284, 0, 2482, 171,
+    0, 297, 221, 0, 196, 289, 0, 6483, 2028, 0, 6239, 0, 0, 5087, 3272, 3121,
+    0, 3604, 55, 251, 0, 1886, 0, 0, 0, 0, 282, 0, 0, 5009, 0, 119,
+    3778, 1747, 311, 2273, 75, 4813, 260, 227, 3231, 0, 2615, 0, 3363, 3306, 2735, 2692,
+    0, 0, 0, 109, 0, 163, 2535, 2589, 0, 4651, 5096, 7222, 1707, 198, 2168, 2517,
+    0, 4054, 3064, 6187, 2752, 3130, 0, 0, 0, 207, 272, 2777, 13, 302, 2483, 0,
+    0, 2711, 5617, 2020, 274, 6352, 0, 0, 99, 2953, 295, 4482, 2206, 0, 1603, 0,
+    2353, 1687, 0, 0, 0, 0, 61, 250, 5765, 2722, 13, 35, 7014, 0, 3117, 2760,
+    2636, 243, 212, 6067, 262, 38, 0, 198, 310, 0, 253, 1945, 1781, 0, 5976, 285,
+    2778, 0, 96, 3780, 2858, 4983, 2086, 0, 6826, 3874, 2954, 4491, 11, 1605, 289, 172,
+    168, 2634, 3040, 1906, 2743, 2600, 3770, 239, 3110, 5747, 25, 36, 2615, 1606, 55, 0,
+    0, 0, 0, 209, 0, 2737, 0, 1754, 1885, 0, 0, 5449, 2965, 0, 202, 1697,
+    0, 2644, 4726, 4438, 3390, 3076, 0, 5787, 5529, 240, 198, 2954, 3139, 2575, 4006, 2504,
+    2790, 0, 103, 321, 0, 6534, 0, 3113, 3345, 0, 5566, 3122, 0, 2469, 280, 2856,
+    0, 0, 1631, 187, 3271, 5187, 0, 1876, 2734, 0, 216, 2678, 40, 0, 0, 1808,
+    3063, 3018, 2545, 249, 2168, 0, 2655, 1632, 0, 111, 2930, 1604, 0, 1756, 2948, 2623,
+    0, 4270, 251, 1611, 2853, 1829, 0, 1783, 210, 0, 210, 3173, 4877, 2695, 247, 3434,
+    0, 288, 152, 2315, 3233, 0, 3915, 2559, 313, 4922, 4437, 0, 3042, 0, 2479, 1610,
+    0, 0, 0, 2276, 0, 3206, 5848, 233, 273, 2812, 0, 2909, 2404, 198, 0, 4349,
+    0, 0, 2557, 2076, 2777, 6023, 0, 108, 4968, 0, 2996, 0, 105, 0, 2338, 3144,
+    2659, 0, 6109, 2975, 2711, 158, 270, 189, 0, 4486, 3261, 2010, 0, 6354, 0, 1700,
+    40, 168, 2084, 0, 3130, 0, 205, 76, 2941, 1607, 255, 215, 2854, 0, 0, 2638,
+    205, 3839, 7015, 2842, 0, 0, 2746, 6805, 5756, 272, 1808, 291, 0, 217, 3164, 5151,
+    0, 0, 0, 0, 2793, 0, 3463, 0, 2535, 0, 2019, 2484, 3284, 3249, 4355, 248,
+    4022, 234, 3040, 0, 2527, 5141, 0, 60, 0, 240, 6189, 131, 0, 2292, 0, 2502,
+    83, 0, 0, 0, 2865, 2733, 0, 2776, 271, 6102, 4262, 0, 3354, 5810, 3558, 5966,
+    2755, 2424, 3197, 2234, 0, 5626, 304, 3400, 0, 2644, 0, 2625, 0, 0, 321, 167,
+    0, 311, 0, 2815, 2225, 72, 203, 0, 0, 0, 2469, 1676, 5186, 0, 0, 6232,
+    2205, 1847, 1754, 88, 196, 3282, 3610, 0, 255, 3009, 251, 107, 2723, 0, 2636, 3867,
+    0, 4429, 290, 2859, 194, 2823, 0, 2540, 2425, 1604, 3174, 2773, 4454, 2963, 112, 2902,
+    0, 0, 0, 4438, 0, 0, 3196, 0, 247, 2953, 1813, 2083, 193, 0, 261, 210,
+    5627, 2277, 0, 0, 4217, 3233, 4440, 238, 301, 2625, 199, 3042, 238, 3129, 183, 24,
+    2172, 182, 2560, 224, 306, 4941, 5451, 1831, 2404, 5362, 6686, 321, 4208, 0, 167, 2138,
+    96, 1833, 15, 0, 83, 2710, 6727, 2936, 189, 262, 6076, 2658, 2777, 5150, 3130, 222,
+    3441, 0, 0, 0, 7061, 3195, 2722, 2433, 3186, 6194, 317, 87, 0, 1611, 2747, 0,
+    3096, 4591, 0, 2667, 0, 2075, 313, 270, 2226, 6252, 0, 2506, 190, 0, 4665, 2640,
+    2726, 2309, 272, 1756, 3216, 0, 4879, 83, 175, 0, 136, 5317, 52, 282, 0, 3174,
+    4360, 3205, 2535, 249, 2491, 2932, 2604, 206, 3143, 5884, 0, 3097, 2294, 1963, 185, 4901,
+    0, 0, 298, 277, 1829, 2338, 3393, 6847, 131, 1885, 2582, 301, 0, 188, 7238, 1605,
+    0, 2236, 0, 265, 2215, 0, 0, 6111, 5629, 2160, 3073, 185, 0, 0, 315, 3832,
+    3240, 239, 0, 3184, 0, 0, 3206, 2952, 157, 13, 0, 2957, 3327, 2821, 0, 2702,
+    1601, 2726, 6778, 1758, 1648, 3619, 0, 0, 0, 4667, 266, 1603, 135, 0, 2642, 3355,
+    5967, 306, 0, 0, 5895, 1676, 3034, 0, 5097, 0, 98, 2974, 1831, 0, 2700, 0,
+    261, 83, 1610, 2592, 0, 2943, 0, 6679, 2348, 6030, 2842, 2234, 214, 215, 4456, 2093,
+    3175, 2757, 0, 0, 2827, 0, 1875, 167, 2037, 0, 2490, 0, 210, 2667, 6386, 2844,
+    3786, 2416, 199, 0, 109, 1706, 0, 275, 0, 0, 0, 3078, 0, 6266, 2661, 2987,
+    2668, 60, 305, 3654, 2865, 0, 80, 3560, 2501, 2138, 4431, 1609, 18, 5802, 3272, 3041,
+    3044, 1840, 143, 98, 1746, 0, 196, 191, 0, 0, 3285, 0, 2810, 5590, 184, 236,
+    276, 1822, 1743, 2645, 2491, 2229, 101, 0, 2759, 1877, 290, 3084, 3328, 3186, 0, 0,
+    2144, 157, 261, 12, 280, 297, 5307, 3019, 216, 40, 182, 282, 23, 2470, 0, 145,
+    2942, 2581, 2864, 2508, 3216, 0, 315, 311, 280, 5372, 0, 2864, 4534, 0, 2309, 3139,
+    1777, 2690, 193, 2997, 4894, 4526, 2432, 201, 2593, 4870, 214, 5318, 2579, 0, 4208, 0,
+    2964, 2468, 174, 2556, 2524, 6202, 0, 0, 0, 2534, 2413, 263, 240, 3165, 0, 3685,
+    6435, 1623, 2347, 0, 2285, 1954, 11, 5758, 0, 0, 131, 2713, 290, 1608, 0, 194,
+    2184, 300, 27, 88, 2745, 0, 3612, 0, 219, 4481, 2369, 0, 122, 5030, 2612, 3030,
+    0, 2986, 0, 3261, 0, 28, 6695, 0, 2963, 284, 135, 4895, 3283, 0, 2978, 3129,
+    3317, 1912, 5967, 3254, 3097, 3834, 3238, 0, 2616, 2728, 2606, 2162, 5538, 320, 186, 0,
+    1609, 4044, 0, 5113, 0, 2875, 4616, 0, 3348, 3800, 119, 0, 4218, 3195, 0, 5154,
+    2811, 0, 3053, 2604, 167, 3152, 2036, 0, 2765, 1605, 1716, 6001, 0, 3150, 4005, 0,
+    0, 2238, 3295, 1690, 2845, 3068, 267, 3412, 282, 6266, 216, 5749, 2510, 0, 6032, 221,
+    5100, 0, 2846, 227, 0, 2072, 0, 0, 0, 3986, 3285, 0, 2569, 2683, 0, 59,
+    236, 64, 0, 0, 5107, 0, 0, 23, 2886, 269, 2281, 0, 276, 5591, 0, 3283,
+    0, 4371, 0, 2985, 289, 109, 4321, 2591, 0, 3048, 0, 0, 2526, 277, 4237, 157,
+    299, 3030, 0, 2831, 4790, 0, 2027, 2415, 0, 71, 2474, 228, 1842, 0, 0, 2471,
+    2767, 0, 2559, 3194, 2491, 121, 181, 2779, 0, 120, 3075, 3307, 2798, 5537, 4498, 0,
+    3647, 4656, 0, 189, 233, 2323, 182, 2405, 213, 0, 0, 0, 0, 2468, 3860, 1874,
+    2867, 14, 0, 1641, 74, 174, 0, 2413, 196, 2527, 1608, 4528, 3097, 274, 0, 0,
+    0, 1824, 3632, 2629, 0, 2556, 260, 2403, 2123, 214, 3766, 134, 0, 5546, 0, 2204,
+    1699, 2846, 2347, 0, 2162, 3167, 2703, 3573, 5052, 188, 3999, 110, 61, 2877, 0, 2103,
+    0, 2470, 2622, 5333, 139, 0, 11, 3238, 2581, 2864, 5470, 217, 5158, 0, 6590, 4015,
+    5256, 320, 6209, 4702, 2637, 3866, 3304, 0, 2038, 0, 4907, 0, 0, 41, 5101, 322,
+    5691, 3096, 229, 3283, 211, 119, 2725, 3546, 3462, 283, 3106, 5757, 0, 2490, 2848, 2153,
+    0, 0, 0, 3029, 0, 0, 0, 0, 0, 2679, 2210, 19, 1887, 260, 4306, 3802,
+    2974, 176, 2957, 292, 175, 2514, 2798, 0, 0, 2589, 2178, 75, 2760, 6296, 5091, 0,
+    311, 0, 255, 2631, 0, 0, 5590, 5970, 2007, 1920, 2834, 1881, 0, 0, 2711, 0,
+    0, 0, 7008, 0, 0, 0, 1743, 6081, 0, 109, 23, 0, 0, 6130, 2469, 73,
+    2744, 5773, 274, 0, 4966, 2732, 1708, 0, 181, 157, 0, 215, 5910, 0, 0, 7112,
+    72, 1868, 6938, 6268, 2084, 2565, 0, 172, 281, 0, 228, 4050, 322, 0, 4704, 3282,
+    309, 2716, 3987, 0, 2938, 2781, 2802, 314, 156, 1692, 5529, 3229, 0, 2578, 0, 0,
+    3086, 0, 3664, 144, 29, 3098, 4969, 5749, 5491, 4209, 0, 3162, 4492, 4507, 0, 20,
+    0, 2490, 3096, 4784, 2527, 196, 3876, 0, 1765, 0, 0, 2869, 0, 2616, 77, 36,
+    1607, 1621, 0, 3140, 47, 3066, 0, 224, 134, 319, 179, 4008, 0, 0, 2766, 5144,
+    0, 0, 2678, 0, 1656, 0, 5286, 256, 0, 1600, 2470, 201, 259, 1895, 0, 250,
+    0, 3276, 307, 0, 0, 3271, 1940, 2965, 3174, 0, 2864, 187, 4768, 0, 2680, 2736,
+    292, 0, 3169, 0, 2647, 2505, 0, 317, 299, 2734, 0, 2878, 4755, 0, 0, 35,
+    3491, 3029, 2018, 231, 2337, 176, 158, 4270, 4278, 51, 0, 4647, 3018, 0, 3566, 3435,
+    36, 244, 219, 0, 0, 0, 286, 0, 2490, 5308, 191, 3009, 2514, 3239, 2889, 0,
+    6151, 3294, 216, 2711, 1962, 273, 77, 2407, 189, 0, 2102, 2179, 1601, 312, 0, 2007,
+    0, 4392, 218, 0, 0, 0, 4122, 4087, 2996, 0, 3001, 292, 2523, 3185, 0, 0,
+    0, 233, 247, 0, 266, 0, 2778, 5867, 1607, 0, 181, 0, 3293, 7117, 2340, 2243,
+    2721, 2381, 2743, 0, 260, 3129, 2725, 0, 3151, 2667, 318, 4171, 2941, 100, 2405, 5545,
+    108, 243, 97, 5847, 5406, 2084, 3043, 63, 0, 3988, 4058, 274, 1729, 4447, 3198, 205,
+    0, 2503, 0, 3646, 52, 5537, 1940, 3249, 156, 2526, 248, 0, 5370, 0, 252, 169,
+    1606, 0, 5526, 3020, 5528, 3106, 5547, 245, 3308, 5748, 47, 0, 3151, 4027, 4877, 0,
+    300, 0, 2991, 4800, 1612, 0, 197, 41, 5966, 2601, 228, 300, 0, 12, 5361, 271,
+    259, 0, 2476, 2292, 3229, 2912, 2649, 304, 0, 2755, 250, 3119, 2998, 0, 0, 3580,
+    2699, 3228, 3766, 3222, 2908, 3282, 0, 3033, 191, 0, 2890, 1895, 205, 0, 3794, 0,
+    251, 2228, 1886, 0, 0, 3428, 2339, 0, 0, 121, 2648, 3868, 2801, 155, 284, 2611,
+    0, 6066, 2493, 2074, 0, 181, 131, 2302, 6069, 4921, 72, 2811, 0, 5818, 0, 1609,
+    3265, 6799, 0, 4261, 0, 2901, 2526, 0, 221, 7380, 1979, 0, 3118, 1767, 3271, 36,
+    5583, 0, 2692, 144, 2546, 0, 224, 0, 192, 2881, 0, 306, 3042, 316, 24, 0,
+    209, 2626, 0, 3208, 6688, 1608, 2732, 0, 0, 0, 0, 261, 3824, 4101, 3655, 178,
+    35, 5326, 1965, 3030, 2835, 2375, 2409, 2295, 1611, 2480, 2523, 1614, 0, 205, 79, 0,
+    190, 0, 1603, 2747, 4310, 2357, 0, 209, 198, 1606, 0, 171, 0, 279, 2743, 180,
+    0, 0, 0, 4878, 2044, 2140, 3030, 0, 5371, 95, 4673, 0, 5531, 2789, 0, 0,
+    0, 2073, 2530, 6358, 3337, 317, 0, 4426, 219, 1953, 1600, 3035, 2580, 294, 0, 2447,
+    0, 48, 5407, 231, 2006, 0, 208, 0, 0, 0, 1608, 3297, 0, 2853, 0, 2992,
+    0, 0, 2899, 3382, 0, 0, 1874, 0, 243, 2336, 0, 0, 2836, 0, 2293, 0,
+    1676, 0, 95, 315, 0, 2255, 0, 170, 3229, 0, 0, 0, 0, 3309, 2932, 2611,
+    0, 2572, 294, 240, 282, 0, 0, 0, 319, 99, 172, 1606, 47, 246, 0, 0,
+    1677, 6238, 3228, 16, 3151, 1601, 1603, 0, 0, 0, 0, 268, 0, 0, 1622, 0,
+    0, 0, 0, 6681, 228, 0, 0, 235, 53, 85, 3787, 3447, 6039, 0, 0, 2677,
+    291, 4272, 2095, 5947, 3062, 5582, 0, 250, 3889, 2350, 0, 249, 2490, 2952, 294, 5811,
+    0, 2532, 0, 0, 3304, 2882, 2479, 6030, 3139, 2051, 4527, 36, 0, 235, 237, 5977,
+    0, 284, 0, 2803, 2956, 242, 301, 0, 2911, 1819, 149, 0, 3208, 0, 228, 2688,
+    143, 2671, 314, 0, 0, 3902, 2647, 265, 3546, 0, 3286, 0, 4065, 222, 1780, 2820,
+    309, 65, 3035, 3161, 0, 270, 0, 76, 257, 192, 4103, 198, 0, 0, 3656, 3317,
+    2283, 0, 226, 0, 2140, 4535, 134, 2645, 0, 4226, 0, 2225, 0, 3097, 0, 0,
+    0, 314, 2591, 2935, 0, 6203, 95, 184, 4876, 4921, 230, 0, 0, 3260, 2900, 5392,
+    0, 4426, 0, 6351, 2624, 294, 95, 2655, 3381, 265, 299, 1677, 35, 2216, 171, 4933,
+    0, 5194, 0, 296, 0, 317, 2901, 157, 0, 1608, 0, 0, 217, 2833, 6498, 2899,
+    0, 0, 200, 0, 0, 2545, 3030, 2931, 204, 0, 5318, 191, 194, 219, 2006, 0,
+    0, 124, 2441, 1640, 2749, 3194, 0, 238, 158, 0, 194, 3172, 288, 2518, 0, 0,
+    100, 0, 203, 37, 1623, 4484, 0, 0, 0, 279, 125, 0, 133, 258, 0, 0,
+    3228, 5846, 2094, 1956, 5222, 4206, 2847, 0, 205, 6472, 0, 3075, 3090, 0, 0, 5031,
+    0, 2975, 1745, 3326, 3304, 0, 2822, 5810, 0, 0, 0, 0, 186, 0, 2414, 1819,
+    0, 6052, 2513, 2558, 5584, 6700, 4569, 0, 2469, 1602, 0, 3602, 4868, 270, 145, 0,
+    6031, 242, 0, 60, 0, 2633, 1687, 5202, 83, 5087, 320, 0, 4869, 235, 6196, 284,
+    2502, 11, 4976, 2504, 0, 2952, 264, 3904, 2591, 0, 0, 2679, 297, 0, 192, 61,
+    285, 304, 2770, 3029, 2045, 2083, 291, 2072, 4701, 3227, 193, 5801, 300, 3053, 3065, 1944,
+    269, 173, 221, 2150, 257, 227, 132, 2721, 183, 5978, 0, 0, 6186, 2284, 2031, 4219,
+    96, 133, 2348, 2140, 3150, 2572, 3251, 63, 5326, 246, 0, 3386, 0, 258, 4315, 0,
+    3008, 5166, 2900, 258, 2965, 262, 6366, 2657, 2776, 228, 3288, 3011, 2736, 2937, 5986, 23,
+    0, 0, 2844, 201, 0, 49, 3930, 1677, 85, 0, 0, 2765, 304, 298, 3219, 3119,
+    2479, 2205, 2809, 1603, 1608, 2633, 2691, 302, 265, 0, 1742, 6477, 237, 2769, 0, 4549,
+    1905, 71, 76, 2468, 3183, 2548, 249, 5158, 0, 3649, 277, 230, 5003, 110, 0, 4571,
+    2274, 3030, 84, 179, 0, 0, 158, 2823, 0, 1640, 287, 2966, 169, 2920, 180, 3199,
+    5746, 0, 1773, 136, 2149, 2357, 6510, 2119, 322, 177, 5536, 3133, 5188, 258, 188, 6714,
+    2658, 0, 24, 3618, 63, 3548, 3007, 2538, 0, 0, 5229, 5471, 188, 2943, 186, 3023,
+    3336, 0, 217, 4095, 0, 83, 3768, 2622, 0, 0, 0, 2096, 24, 120, 3838, 1744,
+    0, 280, 2756, 5370, 0, 0, 4747, 2633, 0, 2679, 278, 0, 6400, 2721, 306, 2898,
+    218, 1613, 3218, 1687, 0, 96, 297, 2682, 170, 0, 74, 0, 11, 0, 2403, 0,
+    4500, 4868, 259, 4453, 0, 6231, 2515, 0, 4711, 0, 1698, 1887, 0, 3217, 1819, 2867,
+    6215, 255, 2791, 2283, 1877, 210, 2008, 3811, 4342, 5363, 0, 0, 2712, 0, 5969, 0,
+    0, 223, 180, 6131, 6798, 182, 3128, 0, 59, 2744, 203, 2469, 2666, 0, 183, 0,
+    170, 0, 5442, 1809, 0, 5325, 2743, 3282, 2905, 5767, 3240, 0, 0, 3074, 0, 2903,
+    2844, 124, 5527, 148, 3098, 228, 2085, 2868, 1925, 2723, 3316, 3077, 2812, 0, 2512, 2833,
+    120, 3390, 160, 315, 95, 2413, 3405, 2205, 3251, 0, 6488, 204, 2537, 2693, 195, 3086,
+    2556, 0, 265, 2843, 193, 2958, 2644, 3162, 4658, 2824, 2964, 5307, 3007, 175, 293, 170,
+    6246, 5015, 4512, 263, 3183, 254, 0, 1625, 3132, 0, 4436, 201, 0, 0, 2149, 215,
+    259, 2701, 4263, 1811, 0, 3941, 1651, 0, 2736, 2766, 0, 178, 5223, 250, 180, 1846,
+    0, 3168, 277, 3065, 24, 0, 2058, 0, 4746, 279, 0, 2336, 181, 0, 3767, 3831,
+    4228, 5966, 0, 6742, 1940, 3174, 3567, 2666, 119, 0, 232, 2659, 0, 0, 1787, 2997,
+    3194, 280, 3565, 207, 3009, 0, 3207, 272, 283, 5496, 2738, 11, 0, 1697, 74, 0,
+    155, 218, 0, 5120, 3128, 2965, 3230, 4279, 165, 0, 5760, 0, 7098, 3496, 204, 37,
+    3342, 4406, 186, 2087, 0, 0, 2782, 0, 3788, 170, 4461, 2549, 2519, 2492, 2273, 1898,
+    2721, 232, 6716, 0, 2836, 0, 0, 3272, 25, 0, 3986, 2600, 4711, 5626, 297, 5308,
+    306, 247, 0, 0, 7219, 5985, 0, 0, 3683, 0, 2922, 0, 1676, 0, 2480, 0,
+    0, 318, 4088, 2114, 5306, 232, 0, 225, 216, 2022, 0, 0, 2579, 1612, 0, 3095,
+    0, 5327, 2677, 2978, 4993, 3345, 0, 0, 3250, 3556, 289, 1753, 2440, 307, 2921, 1606,
+    2727, 2981, 3062, 2088, 209, 4956, 0, 5197, 2724, 2142, 5527, 232, 171, 0, 2942, 6827,
+    5378, 4233, 263, 2525, 1633, 204, 0, 0, 310, 1972, 2539, 0, 2934, 36, 5968, 0,
+    2843, 301, 0, 2504, 0, 3911, 47, 2603, 0, 3020, 1839, 304, 1810, 175, 119, 0,
+    0, 0, 4436, 3135, 317, 2800, 5548, 2149, 6721, 303, 5363, 257, 5966, 119, 4967, 0,
+    155, 67, 0, 259, 5449, 2646, 3241, 2890, 112, 250, 183, 2667, 215, 5769, 0, 3360,
+    2998, 1889, 2244, 3772, 6074, 2275, 0, 6023, 24, 3315, 37, 293, 0, 2403, 0, 1900,
+    0, 0, 2933, 3846, 4005, 5160, 2569, 2077, 63, 226, 4666, 246, 251, 286, 193, 2801,
+    0, 1808, 2964, 2867, 137, 283, 0, 2923, 2483, 0, 3184, 3118, 5414, 121, 0, 2592,
+    6890, 2842, 0, 3282, 0, 245, 2812, 3611, 2349, 2866, 2836, 3230, 85, 3209, 4265, 200,
+    5628, 74, 3042, 2546, 2479, 2699, 1678, 177, 279, 5114, 5311, 2139, 2799, 316, 277, 4351,
+    0, 6754, 2723, 2074, 2590, 0, 49, 169, 4876, 178, 261, 4059, 2301, 0, 253, 3475,
+    5889, 1602, 0, 4657, 2910, 0, 264, 3716, 3320, 150, 0, 49, 2493, 1615, 0, 2754,
+    0, 6554, 2626, 4089, 37, 254, 0, 71, 2832, 0, 308, 177, 2622, 255, 162, 3045,
+    197, 1604, 0, 1753, 3353, 3008, 1707, 2449, 6092, 0, 3547, 5424, 2793, 0, 3240, 0,
+    189, 2831, 5862, 0, 0, 108, 4710, 71, 157, 291, 5921, 3141, 4052, 4876, 2581, 5773,
+    2776, 3239, 0, 3022, 318, 6294, 0, 3217, 0, 0, 0, 0, 3249, 0, 268, 0,
+    2568, 0, 1815, 3586, 2814, 3161, 2291, 2402, 175, 0, 0, 240, 3315, 0, 0, 1676,
+    3107, 186, 2646, 2919, 0, 0, 2567, 278, 0, 5362, 225, 5804, 3558, 0, 3250, 2722,
+    172, 282, 2501, 0, 6415, 4436, 285, 2909, 0, 315, 264, 5386, 4427, 2680, 16, 241,
+    2017, 2689, 0, 1607, 1743, 3066, 180, 278, 0, 0, 3108, 2611, 14, 2860, 2723, 2008,
+    4292, 212, 0, 0, 2804, 2513, 5340, 2876, 0, 2677, 2710, 6038, 2678, 3317, 195, 220,
+    301, 0, 5126, 1605, 292, 0, 0, 0, 1854, 0, 2744, 2358, 0, 5826, 123, 3064,
+    3184, 4042, 2561, 4563, 2594, 120, 238, 0, 3118, 0, 6732, 144, 4216, 0, 3042, 3230,
+    302, 6022, 3213, 322, 3626, 4659, 0, 0, 0, 4136, 5316, 0, 2006, 286, 0, 321,
+    49, 1961, 147, 0, 300, 195, 170, 3205, 4207, 0, 5628, 253, 120, 0, 0, 35,
+    2392, 2402, 0, 4112, 264, 257, 0, 5883, 314, 169, 0, 3286, 2523, 2614, 2745, 0,
+    4240, 111, 71, 1600, 1821, 2141, 3721, 1632, 0, 148, 3164, 0, 3553, 2074, 0, 5592,
+    0, 0, 0, 1721, 226, 3183, 0, 1753, 3108, 2300, 0, 2592, 2218, 0, 314, 4831,
+    247, 0, 4071, 3097, 2568, 0, 2932, 0, 299, 3710, 2340, 195, 6612, 2601, 1681, 2946,
+    0, 3217, 0, 2226, 3025, 298, 2633, 270, 6394, 0, 0, 177, 0, 0, 2291, 2434,
+    13, 204, 0, 312, 197, 3689, 3150, 4336, 0, 3140, 2628, 0, 0, 2036, 0, 241,
+    0, 0, 278, 4646, 2644, 2545, 6048, 2617, 2729, 159, 157, 227, 0, 147, 5364, 75,
+    145, 2578, 0, 2689, 3076, 322, 2955, 0, 200, 2975, 3227, 0, 207, 0, 1940, 127,
+    5250, 2472, 4020, 3067, 3329, 3032, 4564, 0, 0, 0, 3867, 0, 4648, 5553, 73, 2954,
+    2806, 2920, 0, 2159, 5820, 4041, 2008, 302, 194, 88, 195, 0, 39, 0, 2418, 2563,
+    311, 1875, 3216, 0, 0, 0, 2945, 0, 0, 5585, 4754, 3239, 5806, 0, 2744, 0,
+    6230, 207, 0, 1688, 0, 0, 292, 3776, 4718, 0, 0, 109, 6350, 0, 2662, 3029,
+    2914, 2889, 0, 2152, 3117, 0, 2682, 3117, 172, 0, 0, 0, 0, 2680, 0, 3316,
+    5858, 0, 186, 2368, 0, 194, 1743, 3041, 0, 49, 5526, 4703, 198, 2769, 61, 320,
+    0, 2612, 181, 257, 0, 120, 2145, 3155, 3040, 48, 0, 98, 143, 0, 2704, 6186,
+    0, 0, 1603, 113, 3084, 2037, 71, 4481, 4816, 2083, 3221, 0, 1600, 3260, 285, 1904,
+    2713, 0, 4885, 2908, 3108, 3279, 2887, 297, 11, 2596, 2743, 0, 0, 0, 2300, 0,
+    0, 280, 212, 2568, 6576, 0, 261, 6371, 0, 0, 4526, 1683, 0, 6000, 6440, 1722,
+    3305, 314, 84, 3150, 2305, 0, 0, 294, 2737, 5316, 4650, 5562, 0, 95, 207, 4867,
+    231, 0, 12, 0, 2282, 3701, 2964, 114, 3187, 0, 0, 241, 0, 0, 0, 1952,
+    3008, 0, 3164, 78, 162, 0, 209, 251, 1601, 0, 1621, 2968, 2985, 122, 299, 2857,
+    310, 0, 1774, 5002, 255, 3382, 192, 3249, 276, 2271, 3119, 3229, 0, 2363, 0, 0,
+    0, 0, 0, 7041, 1772, 3067, 0, 2947, 186, 305, 25, 75, 282, 0, 3316, 2159,
+    5382, 0, 0, 0, 2352, 2766, 0, 2977, 6067, 0, 73, 0, 97, 2759, 284, 5273,
+    4216, 4764, 42, 0, 2601, 198, 2557, 3007, 4889, 2495, 6230, 1690, 0, 2920, 2744, 3252,
+    0, 1687, 4725, 0, 2567, 2855, 6274, 0, 188, 3107, 0, 4931, 0, 0, 4580, 0,
+    4966, 2634, 221, 0, 0, 0, 239, 0, 0, 2895, 0, 3779, 172, 5747, 0, 2943,
+    3029, 235, 1940, 0, 292, 1808, 266, 2989, 233, 0, 2498, 0, 0, 0, 2919, 2017,
+    0, 2856, 199, 36, 3390, 4308, 0, 3102, 2666, 2474, 0, 5756, 5786, 4344, 240, 2684,
+    2768, 3145, 0, 62, 0, 3121, 3998, 264, 2715, 2534, 5334, 168, 0, 2875, 182, 3881,
+    5994, 3557, 0, 0, 2768, 2934, 2623, 313, 4490, 3075, 2270, 95, 2644, 5598, 2482, 5442,
+    0, 240, 3206, 0, 0, 321, 5224, 3328, 37, 0, 0, 2083, 0, 0, 268, 0,
+    5150, 0, 2556, 209, 120, 5310, 2613, 1631, 0, 201, 263, 219, 3434, 1763, 3107, 74,
+    210, 4046, 2602, 294, 2733, 3189, 2694, 2468, 314, 2706, 2105, 88, 72, 109, 4437, 1604,
+    5257, 2897, 1943, 174, 84, 1601, 1874, 3150, 1886, 181, 5011, 4151, 4757, 2204, 3164, 2010,
+    48, 125, 2778, 0, 3264, 247, 2622, 7014, 207, 0, 0, 0, 0, 0, 5556, 2743,
+    15, 3196, 0, 5756, 0, 0, 258, 0, 252, 0, 3426, 0, 0, 0, 2159, 3154,
+    2635, 3272, 1793, 0, 2404, 148, 0, 2788, 2766, 2747, 119, 0, 0, 5105, 205, 0,
+    4930, 0, 0, 2765, 195, 4727, 1610, 2150, 0, 2842, 295, 0, 2618, 2138, 28, 272,
+    2567, 175, 2974, 0, 3107, 3781, 290, 0, 2403, 270, 2073, 2772, 0, 75, 224, 5967,
+    2856, 206, 6693, 4466, 0, 1602, 6188, 6241, 2502, 0, 0, 2955, 0, 0, 2292, 2470,
+    188, 0, 1907, 5690, 6832, 0, 235, 2858, 2017, 2778, 261, 0, 2484, 289, 0, 6102,
+    7020, 171, 283, 131, 2481, 240, 3399, 5882, 194, 217, 0, 0, 0, 0, 231, 227,
+    1609, 0, 3124, 0, 0, 38, 0, 0, 0, 3830, 4207, 1754, 0, 2619, 310, 6067,
+    0, 5605, 0, 1820, 0, 2225, 2270, 2942, 2800, 0, 0, 0, 176, 0, 3239, 0,
+    2534, 3610, 246, 0, 0, 2869, 268, 4234, 3033, 0, 1991, 0, 2529, 36, 0, 0,
+    4494, 3293, 4541, 2774, 2897, 3282, 2138, 2930, 1635, 3646, 251, 2634, 209, 3141, 237, 193,
+    3882, 2823, 4439, 2603, 1606, 179, 238, 2276, 5088, 183, 4922, 3118, 5097, 0, 0, 2688,
+    5333, 5801, 173, 3244, 2722, 0, 168, 0, 0, 83, 5450, 0, 167, 0, 317, 230,
+    252, 2647, 3556, 3315, 0, 6321, 0, 83, 3274, 0, 3785, 2734, 0, 136, 202, 4130,
+    14, 2404, 0, 0, 2503, 5106, 3989, 2788, 0, 3128, 3265, 0, 0, 2366, 2935, 1811,
+    0, 59, 180, 2854, 258, 2656, 5240, 7057, 3197, 2337, 6194, 4446, 1605, 3434, 0, 0,
+    3021, 4270, 211, 295, 0, 0, 0, 3042, 287, 3146, 0, 3436, 43, 3768, 3851, 1765,
+    5307, 4932, 206, 0, 80, 0, 0, 277, 246, 2990, 2073, 2076, 0, 2479, 85, 0,
+    1838, 3185, 4542, 3392, 44, 2294, 2590, 2601, 2471, 6560, 0, 14, 2999, 3216, 4656, 111,
+    2746, 282, 3298, 2860, 5849, 2423, 3336, 319, 0, 1757, 0, 4926, 6110, 1611, 2963, 0,
+    232, 201, 7025, 1821, 2733, 260, 2367, 216, 3095, 4356, 2810, 255, 0, 255, 240, 1953,
+    3354, 6021, 0, 0, 0, 6811, 2944, 0, 0, 2898, 4225, 1829, 135, 4722, 1879, 0,
+    3163, 3219, 0, 2776, 2558, 0, 0, 169, 4176, 188, 0, 274, 0, 2700, 0, 6030,
+    3610, 0, 3823, 2650, 268, 4877, 5747, 97, 4590, 0, 3034, 133, 0, 293, 265, 2844,
+    0, 0, 0, 2757, 3073, 0, 0, 2847, 316, 0, 1706, 5098, 5966, 0, 2826, 1859,
+    4314, 211, 0, 2234, 0, 2502, 204, 2897, 4441, 0, 0, 2688, 5141, 171, 2862, 2787,
+    3661, 225, 1604, 2732, 0, 0, 3654, 1689, 2501, 4430, 0, 0, 1605, 252, 5089, 2699,
+    6202, 3793, 0, 15, 2690, 254, 2747, 2800, 203, 5341, 2557, 0, 2225, 108, 2006, 3559,
+    290, 87, 155, 0, 0, 216, 2485, 180, 0, 4596, 0, 267, 4647, 17, 0, 0,
+    5810, 0, 0, 3284, 1746, 3161, 0, 182, 3427, 0, 3327, 3118, 0, 1608, 2470, 196,
+    5372, 4217, 276, 2294, 0, 0, 4879, 236, 238, 0, 1832, 280, 3042, 3271, 3297, 311,
+    157, 206, 306, 5581, 182, 0, 0, 0, 3338, 0, 2523, 2009, 298, 0, 4208, 7256,
+    321, 295, 84, 2624, 1649, 2579, 2468, 2549, 2480, 0, 145, 2285, 205, 0, 2413, 1912,
+    0, 14, 2556, 319, 1611, 0, 2745, 2433, 248, 0, 2658, 0, 0, 2072, 213, 0,
+    0, 0, 2075, 0, 90, 2468, 1897, 2810, 0, 2711, 313, 237, 0, 2111, 3030, 3166,
+    6194, 271, 1759, 135, 0, 0, 2978, 2423, 4246, 0, 0, 2615, 0, 4005, 2556, 119,
+    3573, 311, 5901, 2668, 2558, 3621, 3140, 35, 2932, 23, 52, 0, 3163, 4880, 0, 2605,
+    5781, 5317, 3007, 136, 0, 185, 133, 2336, 0, 3997, 6032, 5097, 4981, 0, 4612, 5993,
+    1715, 0, 304, 313, 0, 5414, 2623, 2941, 172, 3109, 247, 3988, 6470, 13, 0, 0,
+    2590, 3205, 0, 204, 0, 0, 0, 0, 2237, 3786, 2958, 3085, 0, 0, 0, 2759,
+    0, 0, 2160, 5089, 0, 2845, 232, 3347, 0, 0, 5142, 0, 3909, 2662, 0, 2569,
+    0, 64, 2800, 222, 3283, 0, 2755, 5775, 3037, 0, 6030, 0, 4782, 0, 1606, 0,
+    2954, 0, 2014, 226, 2623, 90, 6267, 5581, 315, 0, 4601, 2886, 2348, 6202, 0, 0,
+    303, 0, 1875, 0, 0, 2027, 1641, 2963, 0, 108, 0, 2473, 3079, 0, 4896, 27,
+    261, 0, 2557, 266, 213, 190, 2798, 1604, 6390, 100, 0, 2176, 0, 7092, 228, 316,
+    214, 157, 203, 0, 3331, 3285, 309, 2208, 174, 109, 0, 198, 0, 3866, 3041, 1688,
+    146, 1834, 1914, 0, 2413, 1624, 74, 200, 5470, 301, 0, 0, 135, 254, 6204, 14,
+    5374, 4370, 3084, 2831, 2701, 264, 0, 2664, 101, 248, 1764, 3603, 2556, 0, 3996, 0,
+    4206, 11, 5143, 4483, 4789, 12, 261, 2678, 0, 5036, 208, 5766, 3142, 2866, 40, 1823,
+    35, 280, 2864, 138, 3150, 0, 114, 2622, 271, 1614, 2974, 319, 1699, 3064, 133, 4014,
+    0, 4680, 0, 3162, 0, 1607, 0, 107, 0, 0, 182, 2414, 2403, 0, 217, 0,
+    0, 2468, 2759, 84, 3056, 2755, 3547, 0, 3238, 1604, 4262, 0, 5318, 4871, 4975, 3398,
+    4647, 187, 2798, 5910, 0, 122, 114, 0, 6002, 132, 2524, 3106, 236, 2432, 2579, 3216,
+    2342, 0, 0, 176, 3210, 0, 3205, 0, 0, 0, 6269, 0, 0, 0, 0, 3187,
+    2490, 2578, 2878, 2589, 5642, 3096, 0, 2978, 1919, 0, 267, 175, 2809, 86, 2700, 0,
+    0, 0, 5306, 0, 2513, 0, 3254, 2163, 5421, 282, 3462, 0, 0, 2469, 73, 6450,
+    5581, 119, 0, 241, 1608, 2093, 273, 316, 1602, 0, 0, 3011, 4221, 140, 0, 0,
+    4322, 72, 143, 6081, 3575, 0, 2608, 282, 181, 5207, 208, 2474, 96, 6034, 298, 266,
+    0, 0, 0, 5088, 0, 5758, 4945, 1691, 195, 239, 263, 5861, 1942, 3285, 0, 2710,
+    0, 221, 3875, 0, 64, 156, 5825, 2468, 213, 1603, 2964, 5987, 2767, 0, 2083, 5749,
+    0, 66, 0, 26, 0, 182, 0, 2502, 2879, 4382, 189, 4007, 0, 254, 21, 3227,
+    0, 3986, 29, 2987, 2867, 2569, 0, 300, 2170, 275, 200, 6883, 0, 3109, 6195, 0,
+    0, 3951, 2844, 189, 140, 0, 0, 0, 0, 5066, 0, 0, 250, 264, 3566, 4749,
+    2919, 3276, 0, 2678, 0, 2670, 2779, 0, 259, 3064, 312, 4000, 2242, 84, 3063, 1609,
+    2847, 2690, 2888, 3490, 244, 4042, 194, 0, 187, 2734, 3165, 1655, 2536, 5158, 1874, 0,
+    2548, 1742, 3549, 2645, 0, 1643, 74, 5536, 0, 4783, 190, 1888, 5336, 2018, 3139, 0,
+    322, 2798, 5261, 0, 2626, 0, 3822, 0, 0, 0, 260, 3216, 118, 3956, 35, 2272,
+    3169, 6714, 1601, 96, 2837, 188, 5669, 0, 0, 2822, 47, 3188, 0, 2524, 214, 3001,
+    0, 0, 2589, 223, 2622, 0, 2580, 1962, 2657, 273, 0, 2849, 2879, 2337, 2523, 5306,
+    7113, 176, 2218, 224, 3602, 2833, 0, 2831, 5971, 3196, 2405, 300, 5472, 0, 3315, 174,
+    0, 181, 2093, 0, 229, 2550, 2725, 189, 2570, 1609, 119, 2623, 5757, 4445, 5855, 1610,
+    2381, 2028, 3032, 4939, 269, 2523, 3029, 0, 243, 0, 2679, 5113, 0, 2154, 3987, 239,
+    2960, 4657, 2403, 2974, 2975, 0, 0, 195, 1606, 0, 134, 175, 3250, 0, 2637, 0,
+    5526, 0, 6943, 0, 1930, 3238, 0, 0, 263, 219, 0, 319, 2834, 313, 0, 2789,
+    2611, 0, 3308, 0, 3381, 1763, 0, 6687, 2735, 0, 0, 178, 5361, 2524, 283, 3151,
+    5636, 2611, 1607, 0, 0, 0, 0, 3306, 0, 2699, 2908, 5912, 95, 2853, 0, 0,
+    2649, 4261, 3566, 0, 3282, 3288, 0, 123, 0, 4050, 2869, 0, 1876, 2886, 0, 0,
+    0, 2164, 2228, 2784, 2512, 3271, 2877, 289, 5606, 0, 2249, 71, 0, 0, 0, 0,
+    0, 3031, 187, 2690, 0, 5663, 294, 4213, 2734, 2550, 256, 3239, 3063, 4286, 1710, 2886,
+    0, 200, 4094, 2870, 2204, 0, 4058, 1970, 0, 1766, 2536, 2811, 1667, 2272, 0, 0,
+    3265, 0, 0, 179, 1680, 183, 3384, 2878, 51, 0, 4681, 0, 193, 2822, 0, 5803,
+    5746, 2889, 2766, 0, 3492, 0, 0, 0, 2524, 3153, 201, 0, 0, 0, 0, 2732,
+    2669, 65, 0, 2919, 256, 273, 3821, 30, 119, 3276, 2375, 2979, 0, 2523, 227, 0,
+    3655, 2453, 310, 0, 1952, 1744, 1964, 4058, 3336, 1940, 4087, 2360, 245, 244, 2408, 3682,
+    5106, 0, 5527, 6680, 3320, 0, 2645, 276, 2505, 183, 0, 0, 4713, 3275, 3062, 4952,
+    6358, 189, 3024, 4974, 2084, 269, 289, 0, 0, 2571, 3712, 0, 2044, 277, 5308, 5120,
+    4448, 256, 0, 3187, 0, 5379, 2600, 216, 2657, 218, 0, 3003, 0, 2941, 235, 3207,
+    184, 2029, 319, 2932, 0, 0, 4013, 294, 2743, 0, 2899, 95, 2727, 2441, 0, 3309,
+    0, 3346, 5637, 2579, 3120, 1676, 3106, 3731, 7186, 3991, 35, 0, 2765, 3295, 0, 238,
+    2886, 2282, 0, 260, 2986, 0, 123, 6130, 4867, 4126, 0, 172, 2746, 2383, 2991, 3001,
+    1953, 2006, 2985, 2699, 53, 4527, 5600, 2559, 3095, 4658, 25, 0, 137, 3582, 1622, 5748,
+    2424, 0, 4225, 0, 2494, 169, 0, 2832, 0, 2945, 2933, 4186, 0, 0, 3304, 2272,
+    0, 155, 2536, 3043, 301, 0, 1951, 149, 0, 0, 193, 3228, 3568, 3870, 50, 5819,
+    1971, 6039, 0, 2493, 5676, 0, 228, 274, 226, 2910, 3117, 4060, 255, 0, 6024, 2732,
+    284, 2882, 5105, 13, 2613, 0, 215, 3825, 256, 0, 2799, 2780, 3153, 2611, 0, 168,
+    4796, 2688, 0, 2890, 0, 0, 0, 0, 2765, 0, 0, 0, 0, 2908, 2671, 2601,
+    6021, 235, 227, 0, 2074, 289, 284, 258, 2820, 0, 2523, 1747, 62, 0, 0, 2857,
+    0, 3224, 235, 0, 3284, 36, 134, 161, 0, 0, 47, 97, 314, 0, 3294, 1780,
+    221, 2645, 2044, 0, 3472, 0, 2626, 0, 0, 6351, 0, 257, 0, 0, 207, 5391,
+    2646, 2281, 4649, 0, 0, 0, 2931, 2633, 0, 2139, 0, 3271, 0, 38, 306, 2838,
+    0, 2591, 0, 2887, 1606, 288, 0, 0, 2899, 4866, 2737, 3106, 0, 0, 0, 5702,
+    0, 3361, 0, 0, 2377, 3778, 0, 3075, 2723, 198, 176, 0, 2912, 0, 0, 0,
+    319, 3339, 2748, 0, 277, 321, 0, 3337, 0, 0, 2020, 238, 1608, 2517, 0, 194,
+    48, 0, 2749, 4675, 3601, 125, 1955, 206, 310, 3272, 0, 0, 0, 5553, 99, 3030,
+    1607, 157, 4811, 212, 318, 2006, 6471, 0, 1623, 4482, 184, 3008, 4562, 6051, 0, 2110,
+    2426, 220, 252, 2480, 1697, 0, 110, 5765, 183, 1603, 0, 2561, 3117, 0, 4051, 0,
+    2558, 258, 253, 2853, 5801, 5187, 243, 0, 5151, 3767, 0, 0, 1632, 0, 0, 2336,
+    2351, 239, 96, 4982, 186, 0, 96, 173, 315, 2941, 6239, 172, 16, 0, 284, 61,
+    205, 2481, 2611, 2765, 3036, 0, 54, 2501, 0, 6360, 5361, 83, 2756, 2504, 180, 280,
+    0, 193, 13, 287, 0, 2633, 3065, 2932, 0, 3787, 289, 4701, 1944, 1885, 2590, 0,
+    4866, 0, 184, 221, 223, 308, 5326, 11, 2615, 0, 0, 2887, 3305, 2954, 0, 3064,
+    0, 1748, 2678, 250, 243, 0, 0, 0, 0, 2281, 0, 309, 3150, 5108, 2956, 1904,
+    0, 0, 0, 2583, 0, 247, 3139, 2490, 227, 2591, 2053, 2911, 2811, 0, 2679, 2030,
+    0, 2546, 0, 0, 0, 242, 6365, 3770, 0, 0, 2624, 102, 1605, 0, 1606, 6074,
+    2578, 3903, 240, 0, 0, 2853, 2674, 2779, 3264, 5422, 6021, 5361, 228, 2702, 2780, 120,
+    0, 4938, 2899, 76, 2724, 0, 0, 4537, 304, 3326, 2102, 249, 2853, 0, 3300, 4701,
+    1773, 0, 1782, 3216, 0, 1623, 7272, 2689, 110, 198, 1613, 0, 1946, 0, 0, 4227,
+    4499, 3605, 188, 149, 5143, 3133, 1810, 243, 238, 3463, 3183, 102, 3144, 312, 3293, 4349,
+    4327, 3261, 35, 6353, 1896, 35, 4485, 202, 0, 2656, 5186, 180, 0, 151, 2338, 0,
+    0, 3176, 0, 2540, 2856, 270, 40, 2857, 261, 217, 0, 0, 2909, 3838, 0, 0,
+    0, 2833, 2019, 2898, 5976, 24, 0, 2809, 3249, 0, 6506, 232, 0, 2417, 48, 0,
+    13, 4648, 0, 321, 1887, 256, 2138, 3547, 3076, 277, 0, 1700, 314, 2756, 6231, 0,
+    194, 268, 86, 4453, 4866, 4946, 0, 3807, 4968, 255, 0, 0, 2679, 0, 0, 170,
+    3065, 6187, 0, 2659, 3937, 2931, 1813, 2518, 3196, 4262, 280, 0, 73, 2546, 2094, 3648,
+    239, 221, 2771, 2513, 0, 4438, 2999, 0, 2469, 0, 2853, 3305, 0, 2866, 3558, 0,
+    0, 0, 170, 0, 0, 247, 0, 3173, 0, 2281, 3209, 1602, 0, 0, 170, 0,
+    6686, 2723, 2636, 124, 2150, 300, 2482, 0, 216, 5142, 311, 1603, 3269, 5222, 0, 1687,
+    83, 1610, 0, 60, 267, 1877, 0, 0, 2953, 5316, 0, 2701, 0, 302, 6082, 2976,
+    0, 96, 3132, 3075, 2782, 160, 0, 0, 5307, 2083, 1631, 272, 3316, 193, 2779, 5526,
+    4217, 2712, 0, 173, 0, 2502, 234, 2104, 295, 128, 0, 0, 183, 204, 313, 98,
+    5099, 2843, 2866, 3074, 3114, 1773, 3052, 110, 0, 3304, 3219, 0, 249, 201, 287, 1622,
+    181, 1846, 5966, 279, 3831, 213, 2535, 0, 6484, 265, 262, 2271, 3249, 0, 0, 37,
+    2743, 183, 1701, 232, 259, 5986, 0, 7237, 2525, 61, 0, 5188, 250, 5407, 177, 0,
+    0, 2820, 0, 0, 3177, 0, 288, 0, 2226, 2639, 6109, 1742, 2737, 175, 2492, 0,
+    6245, 232, 315, 2966, 3007, 5232, 1601, 0, 2787, 3065, 0, 3186, 2538, 3139, 0, 3550,
+    2501, 4900, 199, 2997, 277, 2823, 321, 2315, 6715, 3134, 2582, 3548, 3464, 131, 249, 4460,
+    299, 2791, 5976, 1887, 60, 2655, 2491, 185, 0, 3085, 276, 3229, 3129, 2898, 2756, 2959,
+    1775, 73, 78, 3010, 3273, 0, 0, 0, 0, 0, 0, 2658, 0, 2021, 188, 261,
+    0, 0, 0, 2366, 3328, 0, 5306, 0, 0, 3840, 2625, 6826, 178, 247, 120, 4307,
+    2921, 0, 2800, 0, 2655, 0, 2440, 2099, 306, 0, 0, 0, 0, 0, 3619, 7038,
+    0, 3029, 2425, 6233, 36, 7127, 1612, 83, 288, 242, 0, 1687, 2726, 239, 3044, 5150,
+    2865, 1610, 2141, 2622, 4455, 4940, 215, 0, 3052, 3034, 2639, 0, 233, 2545, 2666, 0,
+    0, 1839, 2783, 0, 1678, 0, 1809, 210, 279, 3084, 2988, 0, 5966, 1756, 0, 4701,
+    3390, 0, 0, 0, 2712, 5016, 5145, 0, 0, 3020, 4233, 313, 6046, 275, 0, 249,
+    5895, 264, 2998, 5768, 0, 214, 0, 6376, 3084, 226, 5443, 175, 0, 0, 14, 5325,
+    0, 5363, 282, 3199, 2646, 223, 0, 0, 96, 0, 3845, 1789, 0, 18, 6386, 1831,
+    0, 2493, 95, 5121, 101, 2739, 5225, 1877, 2501, 0, 4429, 2309, 201, 222, 23, 2402,
+    12, 0, 288, 242, 137, 2229, 2537, 107, 2655, 60, 225, 3546, 5307, 83, 1978, 3217,
+    4281, 2659, 3008, 3074, 0, 131, 0, 200, 3186, 2551, 286, 220, 4264, 162, 2349, 183,
+    3501, 1601, 1848, 2645, 5967, 4526, 3411, 2507, 3130, 2812, 3051, 3132, 0, 3684, 2766, 0,
+    195, 0, 2347, 236, 0, 2037, 0, 146, 2512, 187, 177, 3198, 3207, 3118, 2866, 0,
+    0, 3250, 0, 0, 5590, 2745, 6103, 0, 7016, 2824, 4666, 0, 122, 0, 119, 150,
+    2534, 2865, 193, 2754, 2614, 0, 197, 5985, 2980, 0, 49, 2821, 4088, 4894, 1612, 0,
+    0, 2933, 3833, 2270, 3032, 177, 264, 169, 0, 0, 2875, 0, 72, 2448, 3611, 0,
+    0, 2710, 6040, 6828, 2089, 186, 1602, 2727, 71, 5802, 308, 25, 273, 5152, 277, 0,
+    235, 4471, 3099, 1679, 0, 3045, 0, 4044, 4233, 289, 60, 2699, 182, 5380, 2600, 3195,
+    0, 2291, 167, 5758, 2217, 3096, 0, 5662, 0, 2424, 1853, 132, 2507, 2604, 1676, 2579,
+    1690, 3125, 145, 6414, 0, 4235, 0, 3020, 5773, 3217, 2765, 2788, 4761, 6750, 2646, 0,
+    185, 5591, 1609, 5872, 0, 3345, 6257, 16, 6266, 315, 2545, 2672, 0, 282, 2073, 227,
+    0, 278, 0, 3924, 0, 0, 123, 231, 4271, 0, 2183, 3046, 3263, 0, 0, 224,
+    3106, 3442, 175, 2590, 2967, 59, 3327, 4906, 2934, 209, 2493, 2678, 2669, 176, 2541, 3100,
+    2603, 303, 301, 216, 1954, 121, 4869, 0, 1988, 0, 3064, 5456, 1841, 2358, 193, 3284,
+    2434, 2559, 0, 26, 0, 0, 6023, 131, 215, 2007, 160, 183, 6728, 144, 0, 0,
+    3137, 39, 2688, 3717, 174, 3647, 3241, 4528, 2027, 214, 120, 1874, 5818, 0, 5680, 14,
+    0, 3250, 2006, 156, 195, 2633, 258, 3856, 0, 211, 2581, 2471, 0, 5115, 3315, 0,
+    238, 306, 0, 2864, 2672, 260, 0, 0, 3019, 3776, 5848, 287, 63, 1604, 3318, 3109,
+    2943, 2177, 185, 4108, 2592, 2821, 0, 2703, 1808, 1822, 2817, 2846, 1617, 2103, 0, 172,
+    0, 3263, 2842, 2492, 2909, 2490, 0, 5370, 3625, 2875, 257, 2946, 107, 3284, 0, 1600,
+    223, 270, 3997, 300, 0, 0, 3008, 4755, 6393, 2613, 3100, 109, 2139, 1678, 3766, 2340,
+    225, 0, 0, 0, 2590, 2073, 0, 3163, 5546, 0, 173, 0, 216, 5396, 2865, 2291,
+    0, 3296, 285, 3019, 2616, 0, 0, 0, 0, 0, 2486, 0, 314, 2627, 2760, 1941,
+    1708, 0, 5090, 212, 2745, 0, 0, 3366, 2831, 75, 0, 0, 1952, 2646, 0, 2545,
+    255, 3356, 2787, 0, 16, 2942, 322, 2415, 6295, 0, 0, 2988, 159, 0, 126, 3613,
+    196, 112, 5553, 0, 0, 157, 145, 2834, 73, 0, 2628, 2754, 0, 6556, 1878, 2920,
+    2920, 2578, 290, 2207, 73, 5773, 5538, 0, 2208, 5346, 4529, 3242, 0, 322, 5994, 2562,
+    0, 207, 2975, 318, 3032, 38, 6808, 2563, 0, 2644, 3141, 2470, 0, 0, 4592, 171,
+    186, 3286, 214, 2350, 2637, 2767, 5165, 2322, 0, 265, 3316, 2758, 2722, 2680, 2688, 18,
+    256, 3662, 174, 288, 0, 2501, 2732, 4209, 5362, 73, 4563, 5201, 4646, 0, 5805, 5529,
+    2527, 4492, 0, 286, 3029, 1743, 6186, 0, 0, 292, 2505, 38, 0, 2614, 0, 155,
+    0, 2683, 0, 237, 0, 303, 4665, 0, 1904, 3777, 4703, 189, 0, 2036, 0, 3278,
+    2678, 2888, 172, 3988, 2189, 47, 1607, 1605, 0, 292, 5372, 0, 4876, 0, 0, 0,
+    0, 0, 3019, 3099, 3260, 0, 299, 2974, 3131, 2711, 1765, 6006, 0, 0, 1942, 280,
+    3382, 0, 0, 3697, 3296, 3155, 2578, 0, 4767, 2282, 0, 2291, 6022, 0, 1721, 4647,
+    60, 286, 321, 4270, 2745, 170, 2567, 0, 2547, 1606, 0, 0, 2072, 0, 246, 0,
+    180, 95, 1648, 0, 6436, 0, 0, 305, 300, 260, 0, 5780, 2595, 0, 2468, 0,
+    2985, 1601, 244, 0, 84, 77, 184, 4306, 120, 111, 0, 0, 2102, 0, 2673, 2887,
+    197, 2946, 6273, 310, 0, 0, 4005, 5561, 4967, 5406, 5977, 294, 3117, 3185, 312, 3637,
+    314, 5537, 2977, 0, 274, 3801, 5812, 253, 1727, 0, 5195, 1601, 2340, 2497, 0, 3163,
+    3078, 4718, 13, 0, 0, 0, 0, 1940, 0, 169, 247, 0, 0, 3580, 0, 3249,
+    0, 2490, 2492, 197, 2649, 4122, 2472, 204, 2831, 7411, 0, 2920, 2419, 0, 307, 41,
+    2757, 0, 3776, 2767, 0, 2138, 159, 4026, 0, 0, 1942, 108, 1940, 0, 3249, 4719,
+    1912, 2919, 2996, 232, 2613, 0, 0, 0, 0, 308, 4576, 0, 0, 0, 0, 4343,
+    27, 2880, 5367, 0, 92, 3208, 4670, 6210, 0, 0, 292, 3231, 3152, 0, 2567, 62,
+    2954, 0, 2492, 256, 286, 3000, 3107, 0, 2039, 0, 2473, 0, 1864, 197, 39, 5748,
+    0, 5634, 38, 0, 0, 0, 2908, 0, 2855, 2336, 78, 235, 6186, 3304, 125, 241,
+    3271, 209, 2482, 3221, 0, 3102, 316, 5407, 3033, 198, 3868, 2407, 3262, 1941, 7009, 188,
+    0, 47, 0, 164, 240, 1895, 5319, 272, 3119, 3316, 144, 192, 5310, 0, 5583, 0,
+    1641, 74, 88, 2270, 0, 3557, 6799, 311, 1754, 0, 0, 3118, 309, 2613, 1631, 209,
+    0, 0, 5004, 1600, 260, 3031, 0, 208, 0, 268, 144, 3085, 0, 2612, 98, 37,
+    2526, 5141, 3131, 5555, 4150, 172, 1606, 4481, 2481, 261, 197, 0, 0, 181, 2930, 115,
+    1732, 5598, 2534, 0, 2713, 2912, 0, 2622, 5442, 1611, 3121, 2743, 3249, 3154, 274, 0,
+    253, 2547, 2499, 0, 3822, 2602, 0, 5541, 3216, 5208, 1621, 0, 0, 220, 314, 2339,
+    271, 2668, 3152, 2018, 1940, 95, 107, 0, 0, 220, 0, 0, 4731, 144, 3426, 0,
+    0, 0, 6317, 292, 1603, 190, 0, 3162, 0, 0, 0, 294, 0, 160, 2761, 0,
+    1601, 3382, 0, 3987, 3881, 0, 0, 0, 175, 2970, 258, 3205, 0, 0, 5979, 199,
+    2009, 0, 2403, 0, 3140, 4921, 3029, 1600, 299, 2809, 0, 276, 295, 298, 0, 0,
+    0, 4219, 3232, 308, 3012, 0, 0, 2985, 5605, 59, 3054, 2901, 282, 253, 73, 1600,
+    2987, 2374, 1820, 0, 50, 227, 5105, 0, 5882, 0, 0, 84, 2754, 0, 0, 2468,
+    3123, 6067, 277, 1829, 5641, 1906, 3196, 38, 289, 2492, 0, 5189, 0, 0, 4309, 0,
+    3887, 194, 188, 0, 0, 3010, 4966, 0, 5528, 316, 5159, 234, 5847, 2747, 0, 0,
+    266, 4931, 2942, 36, 2011, 2952, 3035, 2528, 0, 3260, 2234, 1951, 0, 2705, 0, 2529,
+    191, 6800, 0, 0, 4129, 0, 0, 2010, 0, 291, 235, 300, 209, 4702, 0, 0,
+    233, 264, 2647, 1745, 2718, 0, 3189, 3172, 0, 6387, 3031, 5020, 2603, 2919, 51, 2666,
+    1755, 1819, 0, 62, 5477, 3293, 2880, 1606, 0, 0, 4437, 2897, 202, 1634, 0, 316,
+    0, 6152, 0, 0, 0, 0, 100, 2855, 0, 0, 0, 3274, 4868, 3128, 2776, 2051,
+    3145, 2688, 317, 211, 143, 1886, 0, 2283, 0, 5086, 2710, 2766, 0, 3435, 2645, 2935,
+    252, 2018, 0, 0, 0, 2854, 3546, 3260, 243, 1940, 5811, 3556, 3217, 200, 219, 0,
+    0, 1600, 2908, 6498, 294, 0, 12, 0, 3602, 0, 180, 0, 0, 3021, 95, 0,
+    195, 31, 0, 5970, 1601, 3304, 0, 3768, 1875, 2999, 3381, 235, 3231, 1980, 177, 231,
+    3118, 0, 0, 209, 0, 3250, 3151, 0, 0, 0, 2624, 296, 0, 0, 5173, 7021,
+    263, 6137, 4535, 5306, 3892, 0, 223, 2432, 258, 0, 2749, 4102, 0, 5635, 148, 119,
+    2367, 1610, 0, 206, 1830, 0, 205, 2635, 6102, 3336, 0, 2930, 234, 0, 2623, 99,
+    171, 1821, 45, 0, 2847, 0, 2484, 4930, 0, 12, 319, 0, 281, 0, 2494, 221,
+    2216, 2975, 0, 305, 5532, 2547, 0, 1754, 0, 109, 0, 3326, 5605, 0, 224, 2073,
+    0, 0, 83, 1603, 0, 1602, 3046, 0, 2168, 4893, 313, 0, 2094, 0, 72, 6837,
+    133, 0, 5318, 4172, 2308, 6699, 2633, 1602, 0, 5096, 4707, 178, 5846, 0, 125, 1951,
+    2649, 6420, 6021, 2557, 2503, 290, 2699, 2770, 0, 0, 17, 2765, 0, 2481, 5746, 0,
+    1689, 133, 0, 1609, 122, 2657, 4869, 0, 227, 3601, 3030, 3285, 1608, 5370, 0, 2479,
+    3556, 0, 3172, 0, 95, 2235, 2225, 317, 2284, 204, 87, 232, 0, 2986, 3051, 0,
+    0, 1744, 2572, 176, 0, 246, 3073, 3338, 2967, 234, 3327, 0, 3033, 3293, 0, 0,
+    0, 4273, 0, 0, 3098, 1677, 3437, 2078, 11, 214, 200, 230, 0, 84, 2900, 182,
+    2326, 0, 0, 2160, 2768, 2602, 4547, 0, 0, 2007, 4314, 85, 2470, 2776, 172, 2936,
+    296, 173, 2691, 5801, 0, 249, 226, 3235, 2538, 288, 2996, 230, 4541, 0, 3383, 2547,
+    2468, 0, 2953, 2151, 0, 2668, 3321, 238, 0, 2006, 2366, 3646, 2977, 0, 0, 3785,
+    1874, 3062, 4934, 3902, 6358, 2435, 4428, 2118, 0, 3106, 2274, 4066, 180, 0, 0, 7075,
+    2897, 0, 2486, 1603, 0, 4747, 0, 276, 231, 99, 313, 258, 5106, 63, 131, 0,
+    1821, 248, 4570, 0, 89, 262, 2169, 12, 2656, 0, 1640, 0, 1829, 3220, 2556, 2952,
+    228, 2073, 2603, 201, 2777, 3768, 3318, 4226, 3261, 0, 230, 0, 157, 1650, 2096, 291,
+    3194, 3667, 0, 3336, 6194, 0, 2809, 5993, 3295, 2633, 144, 0, 6399, 185, 133, 3997,
+    1604, 2746, 297, 271, 5087, 1698, 170, 5414, 3021, 108, 0, 216, 0, 3111, 0, 196,
+    0, 2999, 2864, 2985, 0, 0, 6300, 0, 0, 2776, 2787, 0, 237, 290, 1953, 255,
+    4987, 1600, 2423, 2922, 2791, 2515, 4342, 0, 122, 2651, 225, 2602, 0, 5978, 321, 2357,
+    3163, 226, 0, 0, 173, 2488, 230, 3931, 203, 4597, 3051, 0, 0, 0, 2558, 3037,
+    0, 5599, 134, 0, 0, 89, 0, 196, 3330, 222, 0, 4881, 2844, 1897, 0, 5325,
+    0, 0, 1811, 2668, 206, 2625, 2473, 6203, 249, 2512, 171, 3077, 2834, 0, 0, 6499,
+    1787, 6030, 0, 0, 316, 62, 2602, 2208, 7091, 204, 0, 2799, 2161, 288, 2693, 4552,
+    0, 0, 0, 180, 2337, 3243, 2736, 4646, 3797, 2087, 174, 3274, 4210, 190, 1688, 2732,
+    4511, 3128, 1746, 146, 2111, 0, 316, 200, 3657, 270, 254, 0, 0, 4208, 213, 3338,
+    1624, 4887, 3073, 0, 2516, 5086, 5251, 158, 3085, 1913, 179, 0, 3142, 0, 210, 6021,
+    3284, 27, 0, 6742, 0, 5810, 101, 2700, 2046, 3431, 3007, 0, 2152, 3261, 254, 211,
+    12, 2974, 0, 3221, 0, 3163, 3194, 293, 208, 3095, 5373, 2666, 318, 3996, 0, 3547,
+    4782, 6238, 2504, 2468, 259, 3561, 281, 3128, 0, 11, 2924, 4316, 297, 5142, 0, 6001,
+    298, 264, 3272, 2549, 2607, 2904, 1697, 246, 5760, 2624, 3340, 280, 5421, 133, 37, 265,
+    5308, 170, 2721, 2751, 0, 287, 5087, 5317, 0, 2891, 179, 2072, 7217, 1820, 59, 0,
+    194, 3185, 0, 4658, 84, 0, 2845, 220, 2600, 0, 237, 2112, 2348, 3117, 122, 2611,
+    132, 2969, 4630, 2516, 232, 310, 0, 4279, 5545, 1764, 2423, 4123, 0, 247, 1943, 0,
+    3767, 0, 3216, 2978, 267, 4711, 3294, 3007, 0, 2142, 0, 3830, 0, 2558, 3398, 5327,
+    3210, 0, 6033, 0, 0, 55, 91, 3253, 2589, 0, 2160, 6478, 119, 2877, 4938, 1811,
+    2636, 1899, 2787, 2972, 2580, 0, 0, 2615, 4207, 0, 2473, 2942, 180, 59, 2525, 2876,
+    218, 2609, 4321, 0, 306, 2944, 119, 5977, 0, 1633, 308, 3462, 0, 253, 303, 0,
+    3195, 1810, 1688, 189, 169, 304, 96, 0, 5414, 143, 3205, 0, 2152, 6279, 4042, 5987,
+    0, 0, 65, 5548, 232, 0, 1606, 239, 13, 3128, 26, 35, 1942, 4285, 0, 6074,
+    222, 0, 2402, 155, 0, 2954, 0, 4378, 6205, 2944, 0, 2063, 3153, 2890, 4748, 0,
+    7103, 315, 0, 211, 0, 0, 2124, 297, 2480, 0, 0, 6743, 4791, 2666, 0, 24,
+    283, 211, 5767, 1944, 6882, 318, 0, 0, 3789, 0, 0, 0, 5335, 1605, 0, 0,
+    0, 203, 316, 3910, 3574, 3952, 11, 2801, 155, 1808, 2724, 2403, 6888, 3769, 226, 169,
+    5041, 0, 320, 1888, 225, 4263, 74, 107, 3242, 198, 3469, 5086, 267, 2836, 0, 2227,
+    0, 1838, 5311, 0, 0, 0, 37, 293, 1642, 5321, 104, 0, 3549, 1763, 187, 1615,
+    5143, 3095, 2218, 40, 4156, 0, 5669, 3063, 261, 1626, 4206, 0, 2970, 3293, 5889, 177,
+    0, 146, 204, 202, 2622, 2986, 213, 108, 254, 167, 0, 2545, 2626, 0, 5855, 2689,
+    3987, 0, 248, 0, 0, 5471, 3838, 0, 2426, 2414, 230, 5212, 0, 2570, 2483, 2637,
+    3315, 2667, 0, 2877, 1604, 5423, 175, 3059, 3547, 119, 2656, 3315, 273, 3254, 107, 229,
+    3822, 2976, 2546, 1604, 256, 6231, 3162, 274, 2701, 0, 0, 3085, 2523, 2849, 2723, 215,
+    2568, 2975, 271, 188, 0, 2561, 0, 4710, 1699, 0, 0, 0, 2644, 2602, 3999, 4445,
+    0, 3018, 0, 2886, 1693, 4924, 269, 0, 1961, 3120, 5751, 0, 195, 0, 68, 3986,
+    5826, 5306, 0, 5861, 5098, 123, 5362, 0, 1812, 4436, 0, 0, 0, 0, 3178, 6939,
+    3185, 2735, 0, 241, 242, 2611, 5911, 0, 0, 0, 2754, 0, 3306, 2941, 3689, 4086,
+    0, 272, 2770, 0, 2866, 0, 0, 2480, 0, 0, 4332, 147, 5748, 0, 2666, 2028,
+    0, 2804, 0, 4050, 5663, 316, 2886, 2008, 2525, 0, 5863, 1926, 0, 0, 0, 3184,
+    303, 51, 0, 2151, 121, 0, 0, 254, 0, 3271, 3009, 234, 3304, 311, 169, 4135,
+    6893, 0, 1663, 3549, 286, 2336, 177, 0, 3018, 2834, 4680, 0, 0, 4216, 0, 0,
+    6199, 3252, 0, 300, 1680, 2582, 2814, 2535, 282, 2204, 201, 0, 3011, 2415, 1763, 1846,
+    0, 0, 3142, 0, 0, 0, 0, 0, 2710, 1952, 5628, 256, 2405, 0, 3111, 2919,
+    96, 2271, 3567, 108, 37, 307, 0, 3821, 2242, 3220, 2571, 2141, 239, 1607, 2877, 0,
+    3152, 318, 2888, 0, 4886, 132, 2923, 4712, 197, 2360, 2837, 310, 0, 0, 0, 248,
+    3276, 26, 0, 1890, 1753, 3551, 2667, 29, 6610, 2548, 3618, 0, 200, 2919, 0, 5415,
+    2725, 3023, 5747, 6722, 35, 3511, 6081, 0, 2505, 1876, 3140, 0, 0, 3990, 5379, 271,
+    2670, 0, 4447, 2218, 208, 5582, 5968, 3185, 2604, 3206, 227, 2301, 0, 3391, 0, 0,
+    5972, 3346, 0, 183, 4042, 302, 0, 4657, 2628, 0, 0, 3283, 0, 2029, 3002, 263,
+    2833, 5306, 0, 4648, 223, 199, 107, 31, 5364, 0, 2442, 0, 2714, 0, 0, 0,
+    3329, 4059, 3242, 2382, 0, 3032, 2746, 2641, 3120, 299, 2525, 305, 2623, 2252, 5636, 6133,
+    2176, 176, 0, 3250, 3184, 0, 83, 4098, 0, 3106, 2871, 6024, 5819, 4527, 3227, 0,
+    121, 0, 2726, 5746, 0, 2975, 2008, 0, 3043, 0, 195, 2494, 86, 5804, 2552, 0,
+    2945, 286, 229, 169, 0, 3008, 5585, 0, 273, 241, 0, 3326, 1608, 5537, 50, 0,
+    228, 0, 2416, 178, 3117, 1602, 5675, 0, 226, 4013, 0, 0, 2613, 3289, 3084, 271,
+    3117, 4754, 2557, 2914, 6350, 2094, 0, 0, 245, 0, 2876, 1742, 1768, 1970, 4225, 0,
+    0, 13, 2660, 2699, 0, 2594, 49, 2704, 127, 0, 0, 0, 123, 2805, 2769, 3824,
+    3569, 3225, 2857, 95, 284, 2611, 4427, 33, 98, 0, 86, 2889, 1600, 3611, 0, 222,
+    0, 161, 1951, 2376, 2362, 0, 200, 208, 0, 134, 4660, 3307, 143, 322, 0, 2982,
+    0, 0, 2571, 197, 2553, 0, 221, 0, 2300, 2143, 0, 6615, 0, 4297, 319, 227,
+    1602, 0, 0, 12, 3051, 0, 3690, 0, 2612, 0, 0, 5096, 313, 0, 208, 1682,
+    0, 3294, 0, 2217, 2887, 0, 0, 317, 3408, 2919, 4885, 186, 0, 3273, 2737, 264,
+    2691, 193, 5857, 4061, 2922, 4650, 1952, 2534, 2590, 1603, 3360, 4482, 4674, 184, 3778, 122,
+    3272, 146, 2458, 4090, 0, 2669, 0, 0, 168, 0, 3601, 292, 2821, 4041, 2517, 5653,
+    307, 2029, 4810, 2748, 276, 0, 3320, 2270, 2746, 190, 4241, 71, 2509, 3227, 2183, 0,
+    3067, 0, 276, 3184, 0, 3111, 231, 0, 2169, 2876, 72, 198, 2020, 5592, 0, 2876,
+    0, 6039, 0, 185, 0, 0, 0, 53, 2989, 42, 235, 1809, 3263, 7014, 0, 2897,
+    2351, 245, 97, 2601, 0, 4762, 216, 5381, 5765, 243, 13, 3026, 2744, 1609, 3117, 0,
+    255, 1714, 1747, 2567, 269, 0, 1687, 5756, 0, 2017, 4931, 0, 4225, 310, 172, 0,
+    243, 2504, 5088, 6359, 132, 2095, 2735, 0, 2615, 0, 3005, 6230, 2893, 1742, 217, 239,
+    3390, 0, 0, 0, 0, 3175, 321, 291, 3736, 4646, 2788, 7035, 0, 2933, 3043, 0,
+    5538, 2853, 123, 0, 2496, 1600, 2559, 3183, 0, 59, 3305, 0, 86, 1885, 2692, 2875,
+    38, 2206, 2678, 0, 4888, 4043, 2733, 3139, 3064, 1975, 0, 5334, 0, 0, 5821, 4867,
+    0, 0, 2304, 0, 2482, 2832, 0, 0, 0, 277, 2765, 3150, 1606, 1602, 0, 3110,
+    0, 0, 0, 0, 3275, 247, 2469, 2613, 2694, 1874, 0, 289, 3262, 3307, 0, 2219,
+    2853, 0, 2768, 0, 0, 0, 3207, 143, 227, 252, 191, 0, 3780, 0, 48, 0,
+    0, 2674, 4490, 0, 0, 50, 0, 2910, 3362, 258, 0, 314, 150, 2966, 0, 4651,
+    2879, 62, 0, 25, 163, 0, 0, 75, 0, 2821, 198, 2168, 2955, 1943, 0, 0,
+    0, 2750, 1621, 0, 0, 4923, 40, 0, 0, 2570, 0, 6581, 3144, 2093, 3110, 0,
+    5985, 3261, 0, 2700, 0, 4484, 0, 185, 207, 2338, 3604, 2633, 174, 109, 1707, 6352,
+    6473, 2630, 2635, 2824, 0, 0, 2501, 5009, 2915, 3317, 0, 15, 3084, 223, 281, 3249,
+    0, 3305, 2028, 0, 1781, 0, 4812, 1809, 3316, 0, 2085, 55, 2855, 2887, 2567, 3272,
+    5090, 4726, 6187, 2735, 2778, 2019, 0, 269, 73, 0, 0, 168, 0, 0, 0, 2537,
+    5087, 3040, 194, 2615, 86, 259, 310, 0, 246, 206, 0, 0, 128, 5529, 13, 6240,
+    3399, 0, 4565, 220, 0, 196, 2017, 3052, 2517, 4262, 209, 5690, 3915, 61, 2600, 0,
+    5151, 4438, 250, 0, 2655, 3241, 281, 2578, 212, 103, 3305, 38, 2564, 2820, 1876, 5347,
+    219, 2529, 0, 249, 0, 3085, 20, 5328, 0, 57, 5187, 2353, 176, 3113, 3830, 0,
+    0, 2954, 2636, 2273, 174, 2206, 3150, 2985, 0, 1602, 2942, 288, 83, 0, 0, 4055,
+    2771, 2469, 261, 28, 2502, 1610, 247, 168, 251, 0, 7222, 4207, 255, 0, 3207, 2723,
+    0, 180, 4270, 2086, 96, 1632, 237, 253, 2634, 1945, 0, 60, 193, 230, 3434, 2617,
+    2600, 2711, 239, 2276, 4217, 4491, 0, 1774, 282, 2790, 1985, 4922, 0, 170, 183, 2856,
+    6109, 0, 25, 83, 0, 76, 0, 2171, 0, 0, 2948, 1606, 3156, 321, 5766, 1621,
+    5988, 2887, 3130, 7056, 5787, 4006, 2139, 4646, 2974, 3115, 308, 3785, 4840, 1723, 153, 1756,
+    3052, 202, 0, 0, 0, 0, 6686, 0, 3174, 0, 3304, 1700, 0, 40, 0, 2777,
+    2512, 2490, 3018, 60, 2820, 5450, 2076, 0, 168, 0, 0, 3874, 3989, 2854, 2638, 3463,
+    0, 0, 1904, 0, 0, 2503, 0, 77, 0, 2655, 0, 0, 260, 1677, 0, 2691,
+    4355, 2315, 198, 3185, 0, 2019, 249, 2900, 1838, 2538, 6372, 277, 0, 0, 0, 217,
+    288, 188, 2812, 2491, 185, 242, 0, 2576, 5003, 1808, 0, 0, 297, 0, 2947, 3298,
+    3010, 321, 0, 0, 202, 7288, 2791, 0, 0, 2404, 4262, 3076, 5802, 231, 1601, 0,
+    42, 5186, 0, 3400, 307, 0, 0, 2625, 2996, 0, 0, 0, 6386, 3839, 2009, 3206,
+    3085, 2726, 6232, 232, 275, 171, 274, 48, 2810, 2469, 168, 3354, 6066, 2656, 261, 206,
+    0, 230, 5528, 2638, 0, 256, 2357, 3867, 83, 0, 108, 4720, 169, 3610, 0, 0,
+    4454, 0, 215, 1610, 0, 2085, 0, 1604, 6798, 5113, 3683, 2859, 3559, 2859, 5408, 0,
+    0, 0, 3966, 0, 5747, 5976, 17, 0, 3040, 2886, 3121, 210, 0, 2600, 248, 2909,
+    60, 2139, 3042, 0, 0, 4440, 2668, 112, 2999, 4925, 0, 4023, 0, 5443, 0, 0,
+    2963, 2854, 0, 0, 6189, 0, 5141, 2501, 6805, 3084, 0, 3197, 2215, 5626, 1831, 214,
+    0, 201, 4665, 0, 0, 3793, 4977, 2755, 4217, 0, 0, 3497, 2658, 2747, 245, 1676,
+    0, 0, 4429, 1877, 87, 2526, 0, 2545, 5316, 2540, 0, 111, 23, 3143, 2512, 0,
+    1886, 12, 270, 2075, 5307, 2901, 3271, 2949, 2482, 0, 5372, 315, 1611, 1604, 0, 2739,
+    234, 3427, 5590, 240, 2953, 272, 0, 2309, 0, 2425, 260, 0, 2479, 0, 1963, 282,
+    2722, 2023, 0, 4879, 2535, 3233, 158, 3031, 298, 0, 0, 0, 6111, 1776, 301, 1607,
+    313, 216, 2338, 1847, 6022, 0, 223, 131, 0, 0, 37, 2294, 2645, 0, 6103, 0,
+    2506, 3832, 183, 2481, 2347, 2745, 5581, 300, 2777, 0, 1954, 0, 271, 5190, 2644, 1631,
+    6717, 3262, 171, 237, 2965, 122, 247, 2557, 220, 3130, 213, 274, 0, 0, 162, 2735,
+    5976, 0, 0, 4005, 0, 3393, 0, 0, 190, 1808, 2667, 3196, 0, 1758, 0, 0,
+    4901, 2640, 3293, 3166, 6253, 2506, 0, 0, 3284, 167, 2700, 3129, 202, 3238, 3140, 185,
+    0, 4467, 261, 3173, 2875, 83, 136, 1885, 1605, 2721, 5113, 2336, 0, 3328, 2865, 2604,
+    52, 0, 0, 1610, 0, 6068, 0, 5811, 0, 311, 2726, 2600, 6847, 2794, 0, 2623,
+    0, 2987, 0, 5365, 257, 6386, 0, 0, 0, 0, 3441, 227, 253, 289, 216, 185,
+    1676, 3125, 2661, 0, 2138, 111, 3347, 88, 5758, 0, 2215, 5627, 0, 0, 6266, 2366,
+    0, 210, 203, 0, 0, 0, 244, 3035, 2625, 2589, 0, 0, 0, 2531, 3010, 0,
+    1604, 3097, 308, 90, 2545, 2424, 1601, 4234, 3620, 5591, 3044, 0, 2997, 0, 2321, 222,
+    5194, 2077, 4666, 0, 199, 156, 0, 283, 4534, 1875, 107, 87, 1840, 3186, 3084, 0,
+    2557, 0, 6679, 24, 5803, 301, 2559, 237, 1706, 120, 313, 2479, 0, 0, 3031, 5150,
+    2508, 0, 3647, 1743, 3318, 0, 264, 4431, 0, 0, 2560, 1874, 2757, 5445, 0, 1833,
+    3206, 0, 0, 3217, 0, 1641, 6025, 14, 2162, 305, 2975, 2205, 3088, 3852, 0, 2580,
+    0, 2661, 27, 3041, 3284, 2688, 101, 95, 4206, 0, 222, 143, 4789, 5546, 2501, 0,
+    12, 2703, 5455, 0, 2854, 0, 4895, 121, 0, 0, 2680, 2432, 214, 3603, 0, 1822,
+    0, 4014, 5967, 4667, 236, 174, 213, 2846, 3205, 0, 3019, 135, 0, 2941, 1802, 0,
+    98, 6388, 3766, 2612, 274, 2963, 1607, 2581, 168, 0, 5100, 3097, 6032, 2637, 1896, 5122,
+    3051, 298, 0, 0, 5361, 3173, 2491, 2759, 6294, 5591, 0, 2974, 2579, 2590, 0, 187,
+    2997, 3883, 6105, 236, 0, 5979, 2612, 98, 75, 2490, 0, 0, 195, 266, 122, 0,
+    5626, 146, 2534, 4870, 0, 0, 6416, 3348, 2578, 0, 0, 2821, 0, 286, 0, 0,
+    0, 2490, 4702, 0, 131, 0, 86, 2093, 1603, 2716, 1676, 242, 0, 6696, 2627, 2012,
+    5155, 1602, 0, 2713, 182, 203, 4218, 5030, 3089, 185, 311, 7147, 73, 2491, 0, 0,
+    5773, 3047, 157, 235, 1951, 0, 0, 112, 322, 2348, 3996, 120, 4371, 2963, 3195, 1604,
+    2285, 1860, 313, 2242, 0, 3172, 4236, 0, 275, 2415, 3084, 145, 0, 167, 2562, 2474,
+    296, 0, 0, 1691, 3240, 2920, 5758, 2767, 1716, 3183, 4528, 4945, 2606, 2184, 4543, 0,
+    0, 0, 64, 3056, 3661, 0, 2036, 2616, 3272, 4209, 6268, 0, 3327, 2468, 1655, 234,
+    0, 2788, 3030, 2413, 2758, 2434, 6195, 0, 0, 0, 197, 2569, 0, 2937, 0, 0,
+    276, 2690, 6202, 47, 87, 286, 59, 0, 3139, 5968, 256, 269, 267, 5107, 1743, 23,
+    1941, 2678, 0, 2986, 3167, 2967, 2681, 2527, 3177, 0, 0, 292, 216, 2018, 177, 0,
+    2953, 236, 0, 3205, 3612, 1608, 214, 139, 0, 5158, 2592, 2207, 3216, 298, 4647, 2027,
+    286, 2471, 3573, 0, 0, 0, 4015, 299, 3866, 4656, 2272, 4314, 1874, 4306, 2491, 0,
+    3097, 3165, 275, 321, 0, 263, 2536, 2505, 1607, 0, 5317, 17, 0, 5538, 0, 3230,
+    2347, 3318, 258, 0, 2490, 2138, 0, 0, 3295, 0, 4498, 222, 0, 0, 63, 174,
+    220, 1622, 2777, 1601, 5091, 77, 2821, 26, 0, 1895, 0, 2957, 1824, 3633, 5995, 2524,
+    2875, 3261, 0, 0, 5691, 223, 5309, 2629, 0, 0, 4278, 2831, 223, 260, 1603, 0,
+    2178, 2381, 98, 3253, 1606, 5053, 23, 3130, 274, 0, 3238, 181, 2340, 0, 2633, 185,
+    7346, 0, 1609, 0, 2093, 144, 3371, 0, 262, 0, 0, 3997, 41, 247, 2846, 109,
+    300, 2834, 0, 2864, 3249, 5406, 308, 228, 3096, 197, 2418, 2798, 211, 275, 1753, 0,
+    0, 169, 2781, 2767, 0, 0, 2848, 266, 5537, 3096, 0, 0, 0, 2153, 1940, 2760,
+    5748, 6305, 5165, 273, 5757, 1600, 2820, 196, 4209, 1656, 2514, 229, 19, 0, 2789, 3052,
+    0, 3152, 300, 0, 3663, 1709, 0, 0, 5969, 6209, 2249, 0, 276, 0, 2869, 5590,
+    2586, 0, 2578, 134, 3242, 2886, 1882, 2490, 176, 23, 1743, 2038, 4703, 2655, 2527, 3222,
+    0, 5746, 0, 5351, 305, 214, 36, 3229, 0, 0, 0, 2204, 132, 1920, 2470, 2512,
+    3216, 0, 0, 2407, 2802, 2624, 0, 0, 0, 0, 3271, 5854, 0, 0, 7008, 0,
+    3119, 2734, 0, 2690, 73, 0, 27, 0, 2964, 0, 4211, 256, 2649, 3066, 0, 0,
+    3106, 174, 263, 2637, 2703, 2526, 2208, 1970, 180, 3491, 144, 316, 3031, 6011, 179, 4122,
+    4008, 3228, 0, 2514, 0, 224, 3876, 1766, 5545, 4886, 4704, 0, 0, 4784, 51, 2942,
+    49, 77, 173, 0, 1624, 6687, 2524, 2007, 3265, 4930, 3566, 98, 5037, 156, 2702, 2102,
+    92, 3085, 209, 5583, 2612, 3261, 1607, 2974, 1621, 2979, 192, 0, 144, 0, 3255, 2711,
+    181, 2991, 0, 0, 2300, 2647, 307, 3107, 5540, 1606, 3012, 1609, 2505, 287, 0, 5932,
+    3140, 170, 60, 5527, 205, 0, 2503, 2140, 1600, 0, 0, 2612, 0, 2017, 0, 0,
+    1728, 5407, 2084, 0, 6151, 0, 0, 0, 260, 2743, 1603, 0, 3988, 156, 95, 2337,
+    189, 0, 0, 0, 3018, 0, 0, 3096, 0, 231, 243, 2875, 2600, 157, 4094, 244,
+    2831, 6275, 1679, 1888, 1600, 4058, 3382, 3294, 3986, 6358, 250, 3152, 184, 218, 3260, 2941,
+    3229, 0, 0, 4124, 2336, 3120, 274, 0, 276, 294, 0, 0, 1962, 1601, 0, 2514,
+    307, 259, 3001, 0, 2886, 2996, 0, 0, 3655, 3800, 4308, 0, 0, 1953, 0, 5847,
+    217, 0, 0, 3581, 204, 3070, 2635, 6075, 278, 2787, 0, 5716, 2747, 2475, 0, 2832,
+    0, 2881, 0, 2648, 2359, 0, 245, 2494, 108, 2801, 0, 0, 4969, 6903, 191, 5528,
+    2912, 3869, 2767, 0, 6884, 0, 256, 234, 5547, 3239, 1971, 319, 3195, 169, 0, 0,
+    0, 2688, 5748, 248, 0, 2526, 2528, 0, 0, 167, 0, 5526, 36, 235, 0, 5144,
+    47, 0, 2989, 4427, 229, 2491, 1819, 0, 2919, 59, 2835, 4877, 3260, 0, 6799, 2204,
+    0, 2924, 0, 4152, 2908, 2072, 3304, 300, 3766, 2106, 2671, 2523, 235, 0, 5428, 232,
+    0, 3271, 2626, 2755, 3200, 4508, 3275, 0, 3794, 4101, 2409, 0, 2292, 5476, 4673, 2283,
+    2743, 1942, 0, 2645, 0, 1942, 0, 0, 176, 0, 271, 6688, 47, 4866, 4801, 2648,
+    0, 226, 3106, 2044, 3546, 1614, 3470, 3428, 1886, 219, 6066, 3260, 181, 245, 1606, 0,
+    1979, 2732, 3129, 3304, 2811, 160, 0, 260, 6136, 5750, 2624, 2225, 0, 2546, 3426, 2301,
+    3031, 0, 0, 0, 2901, 3151, 0, 0, 0, 4261, 1607, 2007, 2480, 0, 6088, 0,
+    275, 50, 2932, 0, 3309, 47, 3172, 0, 0, 37, 2912, 0, 0, 2853, 2375, 1955,
+    82, 207, 0, 2281, 0, 3229, 2216, 6833, 3822, 0, 318, 2545, 2339, 2748, 208, 1965,
+    2667, 0, 6974, 171, 0, 2891, 0, 2803, 190, 61, 205, 220, 220, 99, 0, 2006,
+    0, 2635, 0, 2976, 0, 0, 23, 4921, 2423, 5846, 0, 0, 0, 6471, 254, 2899,
+    125, 215, 3888, 1603, 0, 5531, 0, 6067, 2975, 4426, 0, 0, 0, 258, 2558, 0,
+    1602, 3326, 317, 3035, 307, 2336, 274, 296, 5825, 97, 5096, 2835, 12, 2159, 2601, 0,
+    2633, 2530, 2647, 2952, 0, 0, 0, 0, 264, 36, 235, 0, 47, 244, 305, 5361,
+    291, 253, 4427, 309, 0, 2997, 4878, 3175, 0, 0, 2889, 3777, 0, 0, 2992, 0,
+    0, 2903, 133, 2633, 0, 237, 3787, 0, 0, 2455, 5507, 2293, 0, 0, 0, 0,
+    0, 0, 253, 308, 0, 2611, 0, 2052, 308, 2284, 3228, 203, 0, 0, 2583, 3009,
+    2756, 0, 0, 176, 1951, 198, 0, 246, 121, 230, 2935, 4686, 0, 1677, 0, 0,
+    4272, 0, 2492, 0, 0, 95, 2956, 0, 3546, 191, 3447, 2900, 3106, 4682, 2072, 0,
+    5582, 3051, 0, 2572, 2479, 35, 0, 0, 2580, 2414, 3206, 249, 85, 3031, 5194, 4536,
+    0, 0, 0, 0, 51, 1607, 2691, 2883, 6681, 238, 84, 0, 227, 3987, 3264, 4051,
+    265, 3648, 0, 2284, 4206, 2911, 0, 2809, 0, 2468, 4065, 192, 3162, 3326, 2140, 3321,
+    0, 48, 288, 0, 318, 2689, 0, 0, 0, 143, 2921, 0, 3133, 1640, 2514, 180,
+    2712, 5229, 0, 230, 3129, 1956, 4922, 2941, 2357, 2667, 170, 3902, 3217, 0, 6504, 63,
+    1780, 0, 4226, 3602, 4569, 0, 0, 1745, 149, 243, 102, 242, 3176, 251, 2274, 2503,
+    180, 3304, 2441, 3308, 1623, 3768, 4426, 0, 0, 2633, 97, 0, 2601, 156, 121, 2909,
+    0, 3381, 4747, 3261, 3336, 5370, 0, 3838, 0, 12, 0, 205, 4877, 232, 0, 3283,
+    5361, 170, 3218, 0, 107, 219, 100, 234, 0, 6052, 6231, 127, 235, 3806, 2292, 2908,
+    0, 148, 0, 1944, 2931, 0, 0, 0, 0, 0, 0, 5978, 2701, 192, 1896, 99,
+    0, 248, 2494, 1608, 1603, 286, 59, 2623, 195, 2651, 2791, 5810, 271, 204, 0, 1819,
+    221, 0, 2006, 2518, 2513, 86, 302, 0, 257, 0, 3228, 2168, 2349, 0, 84, 3317,
+    6351, 1951, 5325, 5536, 0, 0, 2754, 0, 2965, 5801, 2094, 5031, 1602, 5086, 0, 0,
+    2853, 0, 313, 0, 179, 238, 265, 2636, 2591, 3077, 3649, 3008, 2512, 0, 2937, 3162,
+    3930, 0, 4548, 316, 2557, 3007, 5316, 2844, 2414, 0, 2736, 0, 0, 0, 0, 5406,
+    0, 2657, 234, 6021, 0, 2045, 0, 2006, 4869, 2634, 2693, 0, 1846, 2952, 301, 6498,
+    3030, 2149, 204, 1811, 294, 0, 98, 192, 1744, 48, 242, 5202, 1773, 173, 5584, 287,
+    2820, 3227, 0, 3052, 0, 291, 158, 1649, 269, 180, 0, 2771, 0, 3075, 197, 6196,
+    1941, 6245, 4923, 0, 2538, 3139, 249, 0, 47, 225, 0, 258, 3273, 3272, 2096, 2140,
+    6194, 1887, 0, 2939, 186, 0, 2953, 0, 0, 83, 299, 6477, 2031, 0, 2998, 0,
+    5229, 262, 2021, 3087, 2216, 4315, 0, 288, 232, 211, 123, 0, 0, 63, 3128, 3904,
+    2655, 2666, 3387, 0, 298, 3194, 218, 3390, 0, 4747, 178, 0, 5317, 3128, 2633, 3301,
+    3339, 2548, 1687, 1742, 0, 4746, 170, 0, 11, 4711, 2614, 2958, 2894, 3177, 3098, 2721,
+    5306, 3172, 99, 0, 0, 296, 3601, 0, 2600, 295, 2898, 276, 2787, 4500, 6509, 6715,
+    3095, 4228, 1874, 0, 2966, 0, 0, 0, 0, 3161, 2867, 0, 1622, 0, 0, 2404,
+    0, 0, 0, 0, 37, 0, 0, 1603, 262, 0, 0, 0, 2776, 0, 2097, 0,
+    5327, 3219, 7036, 2943, 5536, 0, 4453, 2150, 6131, 2348, 2525, 6030, 5414, 4095, 228, 223,
+    2622, 2639, 3199, 2865, 0, 144, 0, 204, 2942, 2868, 2844, 0, 1613, 215, 3055, 0,
+    6742, 119, 3909, 310, 0, 5196, 5977, 6187, 0, 0, 4701, 3251, 0, 1819, 0, 2659,
+    2693, 1755, 0, 175, 96, 2634, 304, 3000, 2515, 0, 0, 265, 232, 0, 4868, 2791,
+    3052, 5746, 3672, 0, 2820, 3183, 215, 1606, 131, 0, 0, 2283, 1749, 210, 2512, 5767,
+    3040, 0, 1915, 2059, 1678, 0, 2655, 5325, 226, 2965, 0, 180, 0, 286, 0, 242,
+    247, 305, 0, 249, 6366, 2250, 2625, 0, 155, 1809, 303, 0, 5985, 24, 2824, 1633,
+    1600, 2768, 1898, 2833, 3119, 143, 6215, 1698, 293, 7099, 5087, 2988, 0, 2169, 190, 2402,
+    1808, 3077, 2738, 288, 2677, 0, 177, 0, 0, 2790, 3316, 191, 2358, 2843, 124, 4088,
+    4938, 2537, 3831, 0, 0, 3942, 1978, 316, 318, 297, 0, 3018, 200, 2700, 2964, 263,
+    236, 3341, 170, 177, 2736, 2549, 3107, 6246, 2832, 0, 2273, 169, 3051, 0, 3085, 2519,
+    0, 74, 1625, 3405, 0, 296, 2270, 178, 0, 104, 2900, 3132, 4263, 2113, 241, 6489,
+    5223, 264, 5422, 210, 5889, 4280, 254, 2868, 2504, 2980, 173, 0, 3398, 2534, 0, 3074,
+    3198, 5968, 37, 3986, 60, 3767, 5087, 216, 2727, 5320, 3586, 0, 131, 0, 2906, 1612,
+    3065, 6156, 2206, 2777, 2149, 59, 0, 219, 1830, 108, 2996, 2836, 3240, 3565, 3547, 3611,
+    3218, 5527, 6827, 2088, 4992, 3060, 2150, 112, 1697, 318, 2626, 7218, 2142, 4710, 2507, 1604,
+    193, 135, 0, 3315, 248, 1679, 204, 2539, 4042, 6889, 0, 262, 23, 2604, 3217, 2568,
+    269, 0, 3151, 3108, 2843, 2520, 2539, 2843, 25, 2403, 232, 159, 0, 1905, 3194, 2502,
+    242, 5362, 67, 11, 271, 5160, 4701, 0, 297, 4436, 2216, 2799, 0, 4271, 4233, 183,
+    0, 5166, 192, 2611, 5818, 5329, 0, 3013, 250, 0, 175, 3124, 259, 3219, 5966, 2235,
+    288, 147, 2721, 176, 2636, 2547, 6414, 123, 2787, 0, 0, 2985, 2910, 3345, 0, 6074,
+    5987, 4328, 4893, 59, 2773, 0, 2814, 2008, 279, 0, 3119, 1972, 195, 296, 3251, 4461,
+    0, 2677, 2724, 0, 3920, 0, 0, 2934, 121, 2788, 0, 236, 1986, 5662, 2493, 3195,
+    6748, 0, 1788, 2524, 5862, 3172, 145, 3230, 2823, 2007, 39, 182, 2600, 4216, 0, 304,
+    1810, 1644, 1839, 2471, 3241, 169, 293, 3776, 2492, 2867, 2977, 4428, 0, 319, 3304, 2149,
+    0, 2132, 2336, 0, 121, 7281, 0, 0, 0, 177, 0, 5628, 6721, 6753, 0, 2275,
+    5481, 3716, 264, 3846, 2658, 0, 4265, 2545, 306, 4107, 0, 167, 2923, 6115, 24, 0,
+    60, 2622, 37, 4352, 0, 226, 3773, 1808, 0, 0, 285, 3019, 0, 0, 2714, 74,
+    3022, 3625, 1889, 3100, 1753, 320, 181, 0, 2699, 4657, 35, 3475, 0, 3218, 212, 0,
+    211, 5971, 2227, 5114, 211, 2403, 0, 2548, 4710, 231, 69, 3180, 208, 2074, 136, 3141,
+    3217, 3550, 2556, 0, 0, 3135, 0, 281, 2139, 2579, 2792, 175, 2546, 155, 3140, 1616,
+    0, 0, 2301, 3296, 0, 2413, 2218, 227, 44, 2627, 2842, 1702, 0, 0, 4900, 0,
+    318, 223, 0, 3095, 210, 2921, 256, 5364, 2799, 3042, 0, 2861, 23, 230, 2138, 6350,
+    3319, 0, 0, 3084, 171, 2501, 2483, 1604, 16, 0, 0, 2602, 126, 225, 2976, 2646,
+    2641, 215, 0, 0, 2723, 4646, 0, 2008, 177, 2427, 160, 5527, 0, 0, 3216, 0,
+    6806, 2374, 3206, 6084, 2804, 220, 3240, 4052, 1878, 315, 195, 5856, 2562, 0, 3558, 4563,
+    3022, 0, 3227, 3250, 3329, 0, 2798, 3184, 3239, 3465, 0, 6957, 0, 0, 2161, 2892,
+    6555, 2667, 0, 2754, 2814, 1816, 2816, 0, 6350, 0, 1706, 4050, 2350, 2594, 0, 5362,
+    0, 6022, 143, 3117, 2758, 0, 0, 5443, 0, 2975, 2871, 3353, 5804, 1854, 2204, 0,
+    0, 49, 0, 225, 169, 0, 2616, 2722, 0, 253, 2836, 5553, 2889, 4429, 3777, 2876,
+    3306, 3626, 0, 2660, 3689, 167, 3009, 286, 4427, 0, 264, 2745, 246, 172, 2888, 2612,
+    71, 35, 0, 121, 1721, 2699, 0, 2857, 6733, 2492, 312, 285, 2074, 2361, 12, 6611,
+    1600, 4659, 2887, 3278, 2300, 0, 0, 2644, 2965, 0, 303, 5271, 6273, 85, 0, 237,
+    1681, 2415, 212, 171, 4714, 299, 3552, 2582, 1904, 5126, 5780, 0, 5769, 3019, 4005, 0,
+    3230, 0, 1952, 2569, 5883, 0, 0, 2922, 0, 0, 0, 0, 253, 2037, 2291, 2714,
+    283, 320, 1820, 231, 3317, 0, 271, 0, 3695, 1961, 299, 1602, 3095, 2516, 0, 4665,
+    122, 3346, 0, 318, 2215, 276, 0, 0, 4293, 293, 0, 0, 0, 0, 197, 244,
+    2689, 5592, 2921, 310, 2443, 0, 0, 0, 2667, 4240, 158, 2141, 5561, 0, 303, 111,
+    2946, 0, 3067, 3293, 148, 5812, 4071, 0, 5418, 302, 1941, 2509, 2996, 5820, 3027, 202,
+    2008, 4575, 5380, 300, 0, 2909, 2728, 0, 0, 0, 195, 2604, 0, 2568, 2945, 0,
+    0, 6394, 218, 0, 3527, 4761, 3108, 5366, 0, 4967, 205, 3250, 3283, 2744, 3025, 4876,
+    2832, 1605, 189, 107, 2567, 0, 3107, 5756, 0, 0, 0, 2601, 0, 2084, 0, 185,
+    155, 3274, 2989, 0, 2843, 272, 0, 241, 0, 0, 5634, 0, 0, 3164, 2271, 6230,
+    257, 0, 0, 0, 41, 248, 5086, 90, 2567, 269, 218, 0, 2017, 0, 47, 147,
+    239, 4754, 172, 0, 6186, 64, 2496, 5334, 246, 0, 4343, 0, 2569, 2623, 2074, 4020,
+    3121, 3732, 113, 4668, 194, 286, 0, 2535, 313, 6024, 2495, 2754, 4013, 241, 0, 121,
+    5186, 0, 2612, 0, 0, 2479, 314, 0, 1875, 2482, 2733, 3272, 0, 4041, 3108, 0,
+    1631, 2416, 2557, 237, 3041, 5319, 2303, 155, 3305, 4725, 197, 3205, 2613, 190, 0, 1874,
+    2663, 0, 0, 5806, 3249, 0, 3700, 0, 0, 0, 48, 2368, 2205, 2596, 3150, 0,
+    1602, 0, 0, 302, 1822, 0, 2339, 0, 4526, 241, 98, 1754, 2897, 243, 253, 0,
+    1943, 4650, 144, 4150, 4481, 0, 2083, 2769, 0, 174, 113, 78, 0, 5562, 2578, 71,
+    0, 322, 0, 3164, 186, 162, 5272, 3008, 291, 207, 2146, 0, 4816, 1600, 0, 3087,
+    168, 199, 0, 0, 4530, 5605, 2920, 2159, 1941, 3143, 1895, 73, 2914, 0, 6577, 4966,
+    2217, 2887, 2644, 2635, 239, 0, 0, 0, 15, 0, 24, 2568, 2705, 6441, 298, 2974,
+    3029, 0, 5882, 3779, 0, 188, 190, 5976, 278, 208, 1690, 0, 3273, 2567, 0, 4763,
+    4867, 87, 0, 3107, 0, 0, 6239, 2282, 2512, 6315, 5690, 0, 188, 0, 85, 2831,
+    0, 2222, 194, 2689, 241, 0, 0, 0, 5002, 0, 206, 276, 0, 47, 172, 0,
+    0, 2017, 2968, 292, 3881, 208, 0, 272, 2942, 0, 231, 2985, 4047, 3108, 0, 0,
+    0, 2682, 0, 0, 0, 2952, 5346, 0, 0, 2535, 0, 0, 4344, 3067, 1829, 3830,
+    0, 310, 3123, 0, 5641, 0, 3172, 3151, 2943, 2352, 231, 6042, 0, 2271, 38, 0,
+    3087, 317, 0, 2528, 7041, 3240, 3227, 6361, 2151, 4216, 220, 49, 0, 312, 176, 5150,
+    296, 1755, 0, 1772, 2616, 0, 246, 2744, 4207, 0, 4931, 3054, 0, 84, 147, 0,
+    3205, 1634, 0, 2855, 0, 253, 3154, 95, 266, 3785, 168, 2634, 5097, 2036, 2811, 4702,
+    2875, 5526, 1606, 314, 193, 83, 3145, 5967, 0, 2083, 6066, 1600, 0, 183, 199, 168,
+    3260, 1601, 294, 2908, 0, 0, 0, 303, 62, 0, 2768, 0, 3164, 2856, 2234, 4306,
+    237, 265, 277, 88, 1943, 5786, 0, 312, 0, 0, 2766, 230, 5994, 2858, 192, 0,
+    143, 3220, 0, 0, 2406, 191, 2689, 0, 1885, 3119, 0, 3557, 0, 0, 2854, 0,
+    233, 298, 0, 3989, 0, 3998, 2468, 1745, 263, 0, 222, 1940, 4968, 143, 2503, 305,
+    4490, 234, 0, 96, 5316, 3434, 1608, 0, 3103, 0, 3381, 0, 2772, 299, 0, 2567,
+    0, 0, 6188, 75, 6320, 2512, 1793, 3107, 0, 2879, 3175, 1621, 219, 2955, 0, 0,
+    5690, 0, 0, 0, 0, 0, 0, 4705, 1838, 194, 317, 260, 0, 5307, 5746, 5258,
+    2858, 0, 235, 0, 2150, 2822, 2017, 1962, 223, 3298, 5556, 3316, 4758, 0, 0, 0,
+    169, 207, 201, 1635, 0, 171, 7227, 2209, 2930, 144, 0, 0, 2308, 41, 0, 2367,
+    0, 7020, 2635, 27, 281, 0, 274, 5012, 0, 2534, 0, 0, 3830, 0, 0, 3399,
+    2778, 5756, 171, 3227, 4893, 0, 4719, 2270, 4207, 0, 219, 209, 1830, 4930, 72, 0,
+    2502, 3033, 0, 0, 2618, 0, 3252, 268, 0, 5747, 1605, 1947, 5151, 3052, 2820, 0,
+    1600, 0, 0, 0, 2153, 224, 2930, 1765, 0, 0, 5526, 0, 28, 6693, 3084, 0,
+    2810, 240, 0, 5967, 1907, 5098, 0, 4439, 0, 2603, 2083, 249, 3610, 193, 2899, 0,
+    3260, 6686, 2655, 3793, 2501, 0, 3222, 5581, 0, 1607, 0, 0, 0, 17, 0, 0,
+    217, 132, 3556, 3157, 192, 0, 0, 284, 2481, 2986, 5106, 0, 5846, 176, 0, 6110,
+    6811, 202, 3206, 3327, 2009, 0, 113, 3119, 4270, 267, 302, 2550, 5408, 0, 3173, 0,
+    3219, 2800, 258, 230, 277, 263, 216, 2235, 0, 3436, 0, 3271, 3252, 0, 0, 87,
+    2602, 0, 179, 2964, 2524, 2557, 251, 0, 295, 2294, 1604, 85, 1991, 3310, 2897, 2204,
+    4261, 2930, 59, 313, 2979, 1621, 2007, 2073, 298, 291, 221, 4495, 2479, 0, 3427, 2657,
+    2404, 213, 0, 0, 0, 3293, 2591, 2779, 2471, 2977, 0, 3244, 269, 109, 1838, 5713,
+    191, 4656, 3785, 201, 2745, 0, 0, 4217, 234, 237, 5005, 290, 79, 188, 252, 147,
+    3619, 5891, 1953, 2733, 3194, 2897, 2503, 3141, 2821, 2876, 6068, 43, 0, 4428, 2963, 0,
+    11, 0, 2999, 0, 0, 4880, 0, 0, 196, 0, 0, 2656, 15, 0, 1821, 14,
+    2076, 3140, 6560, 0, 3841, 2864, 0, 231, 4932, 4721, 3793, 3383, 2337, 2941, 1677, 311,
+    3034, 2117, 0, 4446, 2336, 1698, 3997, 136, 240, 0, 2470, 0, 206, 2854, 4130, 1808,
+    0, 297, 2990, 3051, 185, 6066, 0, 2688, 0, 0, 3646, 0, 2589, 6234, 2733, 2886,
+    3392, 2700, 1609, 0, 5098, 0, 0, 0, 219, 2860, 1757, 0, 3173, 211, 2650, 2623,
+    0, 60, 171, 0, 0, 0, 2534, 5089, 0, 2270, 0, 203, 252, 0, 3010, 2793,
+    2515, 0, 2485, 2679, 2800, 206, 0, 256, 3560, 236, 3021, 5599, 0, 2357, 0, 0,
+    2011, 3239, 3338, 0, 2580, 2602, 0, 3095, 6202, 2956, 2732, 5373, 0, 0, 4596, 6801,
+    0, 0, 230, 0, 1877, 3427, 0, 0, 4656, 293, 0, 3330, 203, 268, 2485, 2711,
+    2965, 0, 0, 5141, 229, 89, 2176, 6470, 3042, 1604, 0, 2204, 313, 5801, 206, 4177,
+    2963, 3088, 2668, 3264, 6387, 281, 2208, 0, 1879, 0, 5444, 2479, 2897, 0, 109, 180,
+    3795, 1832, 1849, 0, 174, 1706, 3084, 4430, 3206, 2780, 0, 0, 246, 2285, 1689, 2747,
+    1913, 287, 319, 196, 173, 252, 3128, 3603, 3654, 3274, 2624, 3823, 2788, 14, 5410, 4206,
+    27, 0, 12, 0, 15, 0, 2075, 6863, 2111, 3197, 5105, 114, 3429, 3086, 1886, 2423,
+    4505, 2138, 3098, 3161, 2557, 2974, 3073, 1624, 2864, 135, 85, 2842, 4782, 3073, 2963, 201,
+    237, 2878, 275, 2759, 0, 0, 3216, 3767, 298, 295, 0, 6032, 0, 6625, 2678, 0,
+    133, 2534, 4740, 5747, 3056, 2605, 2996, 0, 0, 206, 3051, 236, 0, 0, 3297, 1612,
+    236, 1602, 2623, 2735, 4647, 6104, 2590, 182, 0, 1954, 0, 0, 2579, 2711, 187, 122,
+    2480, 2366, 266, 2898, 2072, 204, 0, 2601, 0, 2470, 0, 0, 158, 171, 2931, 0,
+    2516, 181, 220, 0, 23, 86, 0, 3347, 2810, 0, 3089, 2891, 0, 0, 1820, 0,
+    6070, 1876, 297, 2800, 3443, 52, 3294, 2490, 0, 0, 232, 0, 73, 0, 51, 202,
+    4246, 3198, 3331, 97, 90, 2176, 2013, 3205, 307, 0, 273, 5811, 2787, 290, 0, 3166,
+    3163, 2606, 0, 0, 2405, 214, 0, 1607, 4370, 4981, 0, 0, 2473, 0, 0, 0,
+    7092, 5088, 5861, 108, 3238, 185, 253, 2086, 304, 1715, 211, 2724, 2347, 5758, 6389, 2721,
+    5097, 275, 3128, 2027, 1942, 59, 6519, 3019, 6500, 2788, 6267, 0, 2930, 3769, 1642, 1688,
+    2413, 271, 0, 1609, 108, 2662, 0, 0, 146, 2569, 0, 3786, 14, 309, 1810, 157,
+    275, 3249, 5143, 4376, 3266, 3165, 246, 2842, 248, 2138, 64, 3109, 6195, 5461, 2997, 0,
+    0, 4790, 2242, 308, 2123, 0, 287, 2079, 3139, 173, 0, 2479, 3573, 5194, 0, 0,
+    3088, 2580, 0, 276, 0, 5335, 1897, 138, 1604, 3064, 1875, 0, 5966, 1605, 35, 237,
+    0, 23, 3647, 2755, 0, 0, 1888, 0, 213, 0, 203, 245, 3282, 3902, 1874, 0,
+    2548, 0, 2205, 225, 2471, 0, 85, 3216, 251, 0, 0, 0, 4014, 2227, 0, 0,
+    3866, 214, 243, 2493, 4206, 24, 0, 4226, 102, 2524, 0, 3041, 2163, 0, 2272, 3367,
+    5669, 2898, 0, 0, 3614, 0, 174, 2964, 263, 2601, 2689, 2944, 0, 0, 3074, 7342,
+    3205, 0, 223, 2831, 2432, 301, 1764, 3209, 0, 213, 267, 316, 4483, 190, 2847, 0,
+    3318, 0, 5775, 6034, 0, 306, 2733, 0, 114, 168, 2637, 3822, 2483, 1823, 0, 2590,
+    97, 135, 0, 4975, 2185, 0, 3261, 3996, 3238, 2853, 0, 0, 0, 4094, 2339, 2976,
+    2879, 4647, 3018, 156, 5980, 300, 1708, 6301, 3987, 0, 2834, 2787, 1613, 2974, 2798, 242,
+    3162, 3251, 3238, 0, 3058, 0, 4871, 7152, 211, 1606, 3007, 0, 6204, 0, 0, 0,
+    1601, 0, 1692, 0, 0, 2759, 132, 224, 2406, 2875, 286, 2789, 0, 5088, 1655, 2701,
+    0, 267, 3187, 2474, 3549, 0, 2809, 0, 1812, 2734, 2690, 0, 4381, 84, 5746, 0,
+    2348, 5911, 1919, 4086, 0, 254, 311, 2886, 0, 0, 2249, 19, 3064, 2513, 6195, 252,
+    276, 203, 3184, 3172, 0, 3178, 5765, 0, 226, 0, 0, 4222, 2721, 264, 3566, 0,
+    315, 0, 3271, 6197, 3240, 240, 304, 5642, 197, 2886, 3875, 0, 4647, 3091, 15, 0,
+    0, 0, 0, 2468, 0, 2170, 1601, 222, 5158, 4783, 4210, 0, 108, 0, 99, 4285,
+    6038, 1603, 0, 0, 0, 234, 2550, 3227, 1605, 208, 248, 2813, 1611, 2207, 0, 0,
+    283, 0, 0, 2291, 3490, 5581, 2512, 0, 1763, 0, 256, 2437, 51, 66, 5142, 206,
+    0, 2524, 0, 5581, 4921, 1961, 1941, 5968, 26, 3142, 3177, 2382, 1607, 2850, 3096, 182,
+    2755, 2556, 2645, 2987, 156, 2879, 0, 2979, 2242, 5536, 0, 271, 143, 2505, 5415, 3211,
+    3018, 0, 2204, 0, 0, 2700, 0, 0, 140, 0, 3205, 2342, 0, 0, 2670, 0,
+    5527, 4712, 4000, 5931, 143, 0, 189, 263, 5317, 3286, 107, 0, 222, 2941, 3161, 0,
+    0, 6211, 2093, 4749, 4094, 0, 96, 0, 1742, 3063, 0, 4058, 187, 3990, 0, 0,
+    0, 195, 0, 2959, 0, 176, 244, 295, 0, 3106, 1885, 3391, 2600, 0, 3575, 1661,
+    141, 4096, 2837, 233, 223, 5309, 5092, 4123, 0, 5385, 5996, 0, 3381, 4007, 260, 184,
+    6714, 0, 3188, 0, 3253, 30, 0, 2690, 0, 5636, 311, 0, 0, 1962, 314, 213,
+    0, 1608, 2639, 2886, 273, 241, 144, 4876, 4988, 4322, 2833, 0, 3001, 0, 3120, 239,
+    5757, 0, 0, 0, 0, 266, 2072, 2690, 1931, 4939, 2832, 178, 2798, 274, 4797, 3868,
+    0, 0, 6687, 2783, 0, 2494, 2440, 124, 0, 3052, 194, 3469, 0, 2964, 0, 2154,
+    2986, 0, 1600, 2870, 0, 3580, 5748, 108, 2634, 1951, 100, 5167, 2825, 4286, 1971, 0,
+    1666, 215, 4041, 1970, 0, 0, 2523, 0, 208, 2869, 120, 169, 0, 5526, 200, 2550,
+    6045, 0, 0, 6075, 3223, 30, 0, 47, 2888, 2908, 3239, 1767, 0, 5969, 6744, 2655,
+    190, 0, 0, 2660, 0, 0, 2822, 2524, 2272, 0, 305, 235, 5746, 2710, 2338, 0,
+    2453, 3040, 3295, 248, 0, 2919, 47, 271, 2765, 0, 0, 3568, 4445, 2755, 2657, 279,
+    0, 2669, 2593, 0, 5802, 0, 5427, 0, 1753, 3315, 2251, 2878, 0, 0, 289, 0,
+    2536, 2029, 3309, 3287, 263, 3271, 0, 0, 2645, 0, 2211, 2044, 107, 2748, 5663, 187,
+    3991, 0, 2204, 0, 2734, 269, 2281, 3063, 0, 0, 3173, 0, 0, 5120, 0, 2217,
+    4263, 3051, 0, 3187, 176, 72, 0, 0, 0, 4490, 4886, 0, 4060, 1680, 3406, 2624,
+    2408, 2912, 2932, 3382, 4125, 0, 2981, 2878, 278, 3024, 179, 3106, 4885, 1744, 0, 6763,
+    4051, 0, 0, 0, 4426, 3682, 2375, 2746, 0, 0, 3821, 4674, 1607, 266, 241, 273,
+    60, 3256, 2270, 0, 1608, 3012, 6087, 3601, 3228, 267, 2507, 3273, 2963, 71, 0, 0,
+    0, 220, 322, 0, 97, 3150, 0, 4087, 229, 49, 4261, 2677, 71, 3062, 3384, 318,
+    233, 5855, 189, 4225, 1964, 134, 1603, 3129, 2536, 2337, 4953, 2360, 262, 110, 0, 0,
+    188, 0, 12, 1609, 3986, 5187, 218, 1714, 2811, 2534, 2351, 193, 2920, 256, 243, 2633,
+    3306, 25, 2502, 2941, 5819, 183, 2991, 5361, 296, 0, 3263, 0, 208, 4043, 0, 6908,
+    0, 0, 2789, 2743, 0, 0, 4212, 0, 278, 3153, 2601, 2919, 192, 0, 3591, 97,
+    2788, 2336, 0, 0, 217, 182, 0, 0, 233, 2853, 2765, 0, 3003, 0, 2671, 0,
+    3095, 5600, 2243, 308, 2491, 289, 3336, 309, 0, 0, 0, 0, 2925, 236, 266, 255,
+    0, 6359, 4448, 0, 1747, 6472, 0, 227, 245, 2853, 3239, 1971, 0, 5598, 2710, 2681,
+    2933, 1973, 2536, 121, 3471, 0, 3139, 2645, 0, 2756, 4675, 2888, 0, 2051, 3228, 2583,
+    0, 50, 5676, 0, 229, 2469, 0, 2272, 2219, 0, 2204, 2822, 2838, 2832, 0, 4974,
+    2426, 0, 0, 0, 2496, 2882, 3191, 2523, 1609, 4051, 184, 5553, 4535, 319, 2413, 0,
+    3275, 2614, 176, 3264, 2799, 3825, 2672, 2884, 3106, 0, 3361, 1896, 224, 2626, 2085, 0,
+    5105, 0, 2571, 3713, 2689, 2780, 2556, 3319, 48, 238, 2899, 4811, 3100, 6051, 149, 269,
+    3604, 2657, 2712, 0, 36, 0, 243, 2570, 72, 5114, 2749, 3162, 3262, 0, 3261, 1955,
+    0, 0, 0, 5009, 48, 2006, 6351, 1780, 281, 0, 250, 0, 3174, 6680, 259, 207,
+    134, 0, 3054, 180, 0, 61, 201, 0, 4657, 59, 0, 2028, 2909, 275, 2766, 0,
+    54, 5832, 0, 0, 4658, 0, 2138, 2839, 3275, 0, 1623, 2579, 3767, 0, 215, 2910,
+    4165, 2139, 0, 3308, 5361, 0, 4867, 0, 0, 0, 2789, 0, 2932, 126, 4427, 2611,
+    2501, 3326, 2377, 5616, 0, 2615, 0, 220, 2282, 0, 5560, 285, 4562, 0, 224, 160,
+    28, 2765, 2517, 2735, 0, 2480, 2779, 0, 5222, 0, 6187, 0, 3306, 4053, 13, 170,
+    0, 2853, 0, 221, 2159, 227, 0, 23, 207, 1904, 0, 2020, 2110, 0, 1876, 0,
+    1602, 2986, 3216, 97, 2601, 0, 278, 4482, 0, 289, 0, 3294, 217, 212, 0, 307,
+    0, 4262, 0, 1609, 0, 4691, 4006, 2954, 2591, 247, 86, 0, 0, 2931, 3075, 2636,
+    3337, 316, 168, 0, 242, 253, 5316, 184, 5230, 2347, 2798, 0, 3874, 0, 4982, 2281,
+    3019, 0, 2811, 234, 6021, 5801, 173, 2634, 0, 205, 0, 3267, 3053, 1632, 0, 2086,
+    0, 0, 4649, 3691, 2657, 3778, 0, 1697, 0, 2820, 2504, 2492, 204, 2856, 2889, 0,
+    287, 2574, 3052, 0, 167, 0, 1810, 202, 321, 5566, 2603, 3112, 102, 288, 0, 1700,
+    1605, 3648, 232, 0, 0, 0, 269, 3238, 4866, 6505, 4836, 249, 0, 243, 1773, 3605,
+    0, 252, 3054, 4922, 0, 209, 3052, 2281, 184, 3556, 259, 288, 40, 0, 5766, 35,
+    0, 0, 0, 250, 0, 242, 3770, 121, 249, 151, 0, 5108, 4867, 1945, 2998, 4067,
+    3768, 0, 1896, 308, 4499, 1887, 4491, 2655, 299, 4648, 0, 6365, 2076, 310, 0, 2723,
+    2899, 3903, 3086, 2514, 198, 3018, 4227, 0, 251, 2315, 0, 48, 131, 3463, 0, 2215,
+    276, 3336, 3300, 4349, 54, 2282, 206, 0, 4427, 2812, 2898, 0, 2985, 2787, 2947, 245,
+    1622, 110, 0, 3139, 2911, 2546, 3065, 0, 0, 2724, 1782, 0, 0, 255, 2909, 2019,
+    2996, 156, 4342, 0, 0, 247, 2853, 189, 3547, 3839, 2866, 0, 97, 3076, 2482, 4485,
+    178, 2857, 238, 0, 261, 0, 2732, 5186, 3209, 296, 240, 73, 2601, 2866, 7035, 6353,
+    2894, 2638, 6232, 3172, 5150, 0, 4976, 4701, 1678, 6082, 0, 0, 1787, 0, 0, 249,
+    0, 0, 2525, 1978, 60, 279, 0, 207, 0, 0, 0, 0, 0, 293, 0, 0,
+    168, 2704, 284, 0, 1631, 5086, 0, 2782, 0, 268, 3249, 215, 2149, 2498, 4453, 248,
+    3052, 2502, 0, 0, 2515, 0, 0, 0, 62, 0, 2859, 2820, 0, 0, 0, 4021,
+    3668, 4438, 110, 1811, 254, 5325, 5443, 3305, 1813, 221, 309, 2513, 3766, 2756, 5626, 4866,
+    0, 0, 2512, 0, 2098, 0, 6021, 3053, 1676, 2047, 0, 2104, 0, 252, 240, 61,
+    1612, 155, 2755, 0, 302, 168, 3938, 3009, 5316, 0, 3218, 5976, 282, 0, 0, 0,
+    3496, 0, 0, 0, 0, 1847, 2737, 288, 2358, 0, 2634, 48, 0, 0, 4317, 202,
+    2953, 110, 3051, 2723, 0, 3075, 0, 2540, 2756, 1775, 3132, 61, 234, 0, 0, 4279,
+    2022, 0, 321, 6245, 2030, 3557, 2988, 2677, 197, 0, 4652, 272, 301, 295, 0, 2835,
+    137, 7237, 0, 4923, 3074, 3130, 4946, 0, 3143, 7037, 236, 6716, 206, 6377, 0, 1963,
+    5231, 247, 1622, 312, 5142, 4429, 2843, 177, 6485, 2658, 261, 2959, 2271, 0, 251, 2779,
+    0, 3293, 5882, 0, 3210, 262, 3085, 3831, 2433, 2404, 2791, 0, 0, 265, 2523, 3196,
+    2578, 264, 2809, 5188, 0, 1613, 2481, 0, 2338, 2270, 0, 2535, 3129, 3161, 190, 2656
+};
+
+/*
+** Perfect hash for 5-card non-flush hands (6175 rank
+** multisets), keyed on the sum of quinary[] over the cards.
+** See find_fast5q() in pokereval.h.
+*/
+const unsigned short hash5q_adjust[] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 4, 0,
+    0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 2, 0, 0, 5, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 1, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 4, 1, 0,
+    0, 1, 0, 1, 1, 0, 0, 0, 0, 4, 0, 0, 1, 0, 1, 0,
+    0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 2, 0, 0, 0, 0, 2,
+    1, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 4, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 4, 1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 2, 0, 0, 0, 4, 3,
+    0, 0, 3, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 1,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 1, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0,
+    0, 1, 1, 0, 0, 0, 1, 5, 2, 0, 0, 0, 0, 1, 2, 0,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 1, 1, 0,
+    3, 0, 0, 1, 0, 0, 1, 0, 4, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 1, 0,
+    0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 2, 0, 2, 0, 0, 3,
+    0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 5, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 5,
+    3, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 2, 2, 0, 0, 0, 1,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    1, 2, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 2, 0, 2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 1, 0, 1, 0, 0, 1,
+    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 1, 3, 1, 0, 0, 0, 0, 1, 0, 1, 2, 0, 1, 0,
+    0, 2, 0, 1, 2, 0, 1, 2, 0, 0, 1, 2, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0, 0, 1, 1, 2,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 4, 2, 0, 0, 0,
+    0, 0, 4, 1, 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 1, 0,
+    1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 7, 1, 0, 2, 0, 0, 1, 2,
+    0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 3, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 2,
+    2, 2, 1, 0, 1, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 0,
+    2, 0, 2, 0, 0, 0, 4, 0, 0, 0, 3, 0, 6, 0, 1, 1,
+    0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 3, 0, 0, 1, 2, 0, 0, 0, 2, 2, 0, 1, 1, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 5, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 1, 3, 2, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1,
+    1, 0, 0, 0, 0, 0, 6, 2, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+    0, 0, 0, 0, 2, 0, 2, 1, 1, 0, 0, 0, 0, 1, 0, 0,
+    0, 3, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 4, 2, 0, 1,
+    0, 4, 1, 0, 0, 4, 1, 2, 0, 0, 1, 0, 0, 0, 0, 1,
+    1, 1, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 4, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1,
+    0, 0, 0, 0, 1, 0, 1, 1, 4, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 2, 0, 2, 2, 0, 2, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 3, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 1, 1, 1, 0, 1,
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 1, 5,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 0, 0,
+    4, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 1, 2, 0, 2, 0, 1, 3, 0, 0, 0, 0, 0, 1,
+    0, 2, 1, 1, 0, 1, 0, 2, 0, 0, 0, 0, 4, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 1, 0, 4, 3, 0, 0, 1, 1, 0, 0, 0, 0, 1,
+    0, 0, 1, 0, 0, 0, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 1, 0, 0, 0, 1, 0, 0, 4, 0, 1, 1, 0, 0, 2,
+    0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0,
+    0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 1, 0,
+    0, 0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1,
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 7,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 1, 1, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 1, 2, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1, 0, 3,
+    2, 3, 0, 2, 1, 0, 2, 1, 0, 0, 0, 0, 1, 3, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 1, 2, 0, 2, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 2, 0, 0, 1, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 1, 2, 0, 0, 1,
+    0, 0, 1, 4, 0, 2, 0, 2, 4, 0, 1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 4, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 4, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 1, 5, 0, 0, 0, 0, 0, 12, 2, 0,
+    3, 1, 1, 1, 2, 0, 0, 4, 0, 0, 0, 0, 2, 4, 0, 0,
+    0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 1, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+    0, 0, 1, 0, 1, 0, 2, 0, 2, 0, 1, 2, 2, 0, 0, 1,
+    0, 4, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 1, 1, 0, 1, 1,
+    0, 2, 0, 0, 4, 0, 0, 3, 2, 0, 1, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 5, 0, 0, 0, 2, 1,
+    0, 0, 1, 0, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 1, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 2,
+    0, 0, 0, 3, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 1, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 1, 2,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    1, 4, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 1, 4, 1, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 2, 1,
+    1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0,
+    2, 2, 1, 0, 0, 1, 1, 2, 0, 2, 0, 0, 0, 1, 4, 0,
+    0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+    1, 0, 0, 3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 1, 2, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 1, 0, 0, 0,
+    2, 1, 2, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0,
+    0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 1, 4, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    1, 1, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 3, 1, 0, 2, 1, 3,
+    0, 1, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 13, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+    0, 0, 1, 0, 1, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 1,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 3, 1, 3, 1, 0, 1, 0, 0,
+    0, 2, 1, 0, 3, 6, 0, 4, 0, 0, 1, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 2,
+    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 1, 0, 1, 0, 1, 0,
+    0, 2, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 0, 0, 0, 0, 3,
+    0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 2, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0,
+    4, 0, 0, 0, 2, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 2, 0, 1, 0, 0, 1, 0, 0, 0, 2, 0, 1, 2, 2,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 1, 2,
+    0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+    0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 3, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 2, 0,
+    0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 5, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 2, 0, 0, 0, 0, 6, 0, 0, 2, 0,
+    1, 0, 0, 6, 1, 0, 3, 3, 0, 0, 0, 3, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 1, 0, 2, 2, 0, 4, 0, 0, 3, 0,
+    0, 2, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0,
+    1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+    1, 0, 3, 0, 0, 1, 1, 0, 2, 0, 1, 2, 1, 0, 0, 1,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 2, 0, 2,
+    4, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 4, 2, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 3,
+    1, 0, 0, 1, 5, 0, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 2,
+    0, 0, 1, 0, 0, 0, 3, 0, 2, 0, 2, 1, 0, 0, 9, 1,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2,
+    0, 0, 2, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0,
+    0, 1, 0, 4, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 1, 0,
+    1, 1, 0, 0, 0, 0, 0, 5, 0, 0, 0, 1, 0, 0, 0, 7,
+    0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 3, 1, 0,
+    1, 0, 1, 0, 0, 0, 0, 0, 2, 3, 1, 0, 2, 0, 1, 2,
+    0, 2, 1, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 7, 0, 2,
+    2, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 0, 2, 1, 0, 2,
+    0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 1, 1,
+    1, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 3, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 3, 0, 0, 0, 0, 4, 0, 0, 2, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+    0, 0, 0, 1, 2, 2, 11, 0, 0, 3, 1, 6, 0, 0, 0, 0,
+    1, 0, 0, 2, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 0, 3, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2,
+    0, 0, 0, 2, 1, 0, 0, 0, 1, 3, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 1, 2, 0, 0, 0, 0, 0, 3, 2, 0, 0,
+    0, 1, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 1, 0, 1, 1, 0, 1, 0, 0, 3, 0, 0, 0, 1, 0, 5,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 4, 1, 1, 5, 0,
+    0, 0, 0, 3, 1, 1, 1, 0, 0, 1, 2, 2, 0, 0, 1, 0,
+    0, 1, 0, 1, 0, 0, 0, 3, 2, 0, 1, 3, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 0, 1, 0, 0, 0, 1, 0, 0, 1, 2, 0,
+    0, 0, 0, 0, 2, 0, 4, 0, 1, 1, 0, 2, 0, 1, 0, 3,
+    1, 0, 0, 2, 3, 2, 0, 0, 3, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 8, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 1, 2,
+    0, 0, 2, 1, 0, 0, 6, 1, 0, 0, 0, 3, 0, 1, 0, 0,
+    0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 2, 0, 0, 1, 6, 0,
+    0, 10, 0, 0, 0, 8, 0, 0, 0, 0, 2, 2, 0, 1, 0, 0,
+    1, 2, 0, 1, 1, 1, 0, 3, 0, 1, 0, 1, 4, 0, 0, 0,
+    2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3,
+    1, 0, 0, 0, 1, 0, 4, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    0, 1, 0, 2, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 3, 0, 0,
+    0, 4, 0, 0, 1, 3, 0, 4, 0, 3, 0, 1, 0, 1, 0, 0,
+    2, 0, 1, 2, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 4,
+    0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 3, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 6, 2, 0
+};
+
+const unsigned short hash5q_values[] =
+{
+    4350, 4503, 2898, 2787, 0, 0, 4095, 4230, 0, 0, 0, 0, 4453, 3820, 1814, 0,
+    6218, 1929, 0, 2551, 4335, 2250, 4291, 0, 0, 0, 5142, 0, 3405, 0, 3831, 3212,
+    4996, 7438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2440, 0,
+    0, 0, 0, 0, 3137, 6047, 0, 6757, 5771, 5896, 5483, 0, 0, 0, 5437, 0,
+    0, 0, 0, 0, 5924, 0, 0, 3015, 0, 0, 0, 5878, 0, 5836, 0, 6930,
+    0, 1857, 0, 0, 2888, 2673, 2710, 0, 3533, 6647, 0, 3627, 5686, 6739, 0, 0,
+    2946, 0, 0, 4121, 5117, 5010, 2177, 4074, 6396, 4756, 0, 0, 0, 0, 0, 0,
+    0, 2269, 4020, 0, 0, 4568, 0, 0, 0, 0, 0, 4493, 0, 0, 3324, 0,
+    7420, 5563, 0, 3155, 6375, 0, 0, 4867, 0, 0, 0, 0, 0, 0, 0, 4345,
+    0, 0, 0, 0, 0, 0, 0, 3762, 0, 0, 1794, 0, 3145, 4827, 3557, 0,
+    0, 4736, 6324, 0, 5558, 0, 7389, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1636, 0, 1910, 0, 5460, 0, 0, 0, 0, 0, 0, 0, 1993, 4132, 0,
+    5729, 0, 0, 7332, 0, 5892, 0, 0, 2117, 0, 3021, 0, 0, 0, 0, 0,
+    0, 0, 7033, 2488, 1879, 6813, 0, 0, 1863, 4220, 6705, 3050, 4546, 4505, 0, 0,
+    0, 0, 0, 0, 4914, 0, 6630, 0, 0, 0, 0, 2366, 0, 0, 0, 0,
+    91, 5252, 0, 0, 5993, 0, 0, 7093, 0, 0, 6308, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4257, 3059, 5775, 6879,
+    5761, 0, 132, 6284, 0, 0, 0, 2972, 3178, 5642, 4645, 4325, 0, 2478, 0, 0,
+    5549, 26, 68, 5237, 0, 0, 4751, 5075, 4003, 0, 0, 0, 0, 0, 5385, 2837,
+    0, 7400, 0, 7372, 2213, 5220, 229, 5177, 0, 0, 4445, 3964, 6952, 6765, 0, 0,
+    0, 0, 0, 0, 5799, 0, 0, 0, 0, 4685, 3384, 0, 307, 0, 3821, 0,
+    0, 0, 0, 2360, 0, 6913, 0, 0, 0, 3005, 0, 0, 0, 0, 0, 0,
+    0, 4676, 0, 0, 5678, 0, 2915, 0, 3262, 6182, 0, 161, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5661, 0, 5618, 0, 0, 0, 0, 0, 57,
+    4985, 0, 0, 0, 0, 5566, 4847, 0, 6536, 3606, 0, 0, 0, 0, 0, 0,
+    153, 1784, 4349, 2168, 4488, 0, 6355, 7015, 0, 0, 0, 0, 0, 3040, 0, 0,
+    1813, 0, 4438, 0, 0, 0, 4331, 0, 2953, 2540, 3923, 0, 0, 6727, 0, 7297,
+    262, 2777, 6109, 0, 0, 0, 1756, 0, 0, 3468, 0, 0, 0, 2625, 0, 0,
+    0, 3355, 0, 0, 2425, 0, 0, 6046, 0, 0, 7248, 5895, 0, 0, 0, 0,
+    5434, 6260, 2309, 6852, 0, 7265, 0, 2508, 0, 0, 0, 0, 0, 5875, 6078, 4478,
+    6924, 167, 3195, 4618, 6790, 0, 0, 3746, 0, 0, 0, 4909, 0, 1843, 5683, 0,
+    0, 0, 3863, 0, 2703, 2103, 5256, 6591, 2846, 5102, 2162, 4755, 0, 0, 3803, 2760,
+    0, 0, 6298, 0, 0, 0, 0, 0, 0, 2586, 0, 4533, 0, 0, 2527, 4492,
+    0, 0, 7414, 0, 0, 0, 0, 0, 3283, 0, 0, 0, 0, 0, 0, 2040,
+    0, 0, 0, 0, 7010, 2422, 0, 0, 0, 0, 0, 0, 0, 0, 5292, 6676,
+    0, 2407, 4778, 0, 0, 4732, 0, 0, 2201, 7383, 0, 0, 7195, 0, 5543, 1740,
+    0, 0, 0, 2992, 0, 0, 3175, 0, 0, 0, 4312, 0, 0, 0, 0, 0,
+    2883, 0, 0, 0, 4104, 5029, 0, 0, 0, 0, 219, 0, 0, 0, 0, 5371,
+    0, 0, 0, 2257, 0, 0, 0, 0, 6701, 6846, 4629, 4219, 3900, 2001, 0, 0,
+    7458, 3788, 0, 0, 0, 0, 2082, 6503, 0, 0, 3301, 0, 1640, 0, 0, 0,
+    0, 2357, 0, 7356, 6821, 0, 0, 5203, 0, 0, 5978, 0, 3932, 6304, 0, 0,
+    6479, 0, 2906, 3077, 0, 0, 0, 0, 0, 0, 158, 0, 0, 0, 0, 0,
+    0, 0, 5760, 6410, 0, 6280, 0, 0, 0, 4408, 6220, 0, 0, 5199, 0, 0,
+    0, 0, 3913, 0, 7308, 5548, 0, 0, 1901, 24, 0, 5502, 0, 0, 0, 0,
+    0, 2836, 0, 5049, 0, 0, 4089, 7206, 6162, 7178, 4957, 0, 0, 0, 0, 0,
+    4436, 0, 0, 2245, 0, 0, 0, 0, 0, 6901, 0, 0, 0, 5315, 0, 0,
+    2392, 7408, 3722, 2923, 1753, 0, 0, 5181, 0, 0, 5975, 0, 6773, 0, 0, 5859,
+    0, 3536, 4300, 5127, 0, 0, 2594, 0, 2914, 4146, 6179, 4661, 0, 3694, 0, 0,
+    4076, 2300, 1684, 1722, 0, 0, 0, 0, 0, 0, 0, 0, 3067, 4582, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3103, 0, 4891, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5224, 207, 0, 7014, 2159, 0, 5843, 3782, 0, 3882, 4728,
+    4466, 0, 6243, 0, 0, 6661, 4857, 0, 0, 0, 4922, 251, 3434, 3919, 0, 0,
+    7291, 1801, 0, 3851, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2860, 3404,
+    0, 240, 3354, 0, 0, 3610, 0, 0, 0, 0, 0, 0, 5246, 0, 0, 2404,
+    0, 7067, 0, 6848, 0, 0, 295, 7259, 0, 3394, 7084, 2294, 0, 0, 0, 0,
+    0, 0, 4614, 0, 2828, 0, 6784, 0, 0, 2662, 0, 0, 4602, 0, 0, 0,
+    5342, 0, 0, 1835, 0, 0, 0, 0, 5036, 114, 4897, 0, 6640, 5207, 1717, 6451,
+    2239, 2759, 0, 0, 0, 0, 0, 0, 4375, 0, 0, 0, 6270, 0, 7341, 6883,
+    2556, 0, 0, 0, 4019, 141, 6601, 0, 0, 0, 0, 0, 0, 0, 0, 3380,
+    0, 1921, 0, 0, 0, 1712, 0, 0, 0, 0, 3877, 1660, 4009, 0, 0, 0,
+    6672, 7446, 5494, 3566, 0, 0, 0, 0, 0, 0, 0, 5299, 0, 0, 5935, 7189,
+    0, 0, 0, 0, 2991, 0, 0, 0, 0, 5637, 0, 0, 0, 0, 0, 0,
+    3872, 0, 4187, 0, 0, 0, 0, 0, 5918, 0, 0, 0, 0, 2044, 0, 0,
+    0, 0, 2932, 0, 3309, 0, 0, 0, 0, 0, 0, 0, 3039, 0, 0, 0,
+    0, 0, 3787, 0, 0, 0, 1748, 0, 0, 0, 0, 0, 3300, 5709, 0, 0,
+    0, 0, 5620, 1960, 1623, 5032, 6054, 0, 0, 7162, 6709, 0, 0, 0, 0, 0,
+    0, 0, 0, 5109, 2591, 0, 6367, 0, 0, 3075, 3653, 0, 4501, 0, 0, 0,
+    1701, 0, 0, 0, 0, 0, 0, 0, 0, 3817, 3065, 2961, 0, 6216, 0, 7129,
+    0, 0, 0, 0, 5017, 2785, 0, 0, 0, 1791, 0, 0, 0, 5499, 0, 2740,
+    0, 0, 3503, 4283, 0, 0, 0, 0, 4088, 0, 6159, 5000, 4233, 6829, 2727, 2090,
+    0, 3136, 0, 0, 7318, 6550, 0, 2244, 0, 0, 2230, 2493, 0, 0, 0, 0,
+    6761, 3718, 306, 7404, 0, 1619, 0, 7214, 0, 6994, 0, 0, 0, 0, 1855, 2646,
+    16, 315, 0, 0, 3530, 6645, 6041, 2818, 0, 2350, 6736, 0, 0, 0, 2676, 4118,
+    0, 0, 3630, 4072, 5780, 1721, 0, 2291, 0, 0, 0, 0, 0, 130, 0, 0,
+    4578, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3292, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 78, 0, 322, 5004, 7424, 5565, 0, 5189, 0, 0, 0, 0,
+    3881, 0, 2685, 3029, 0, 0, 4851, 4348, 0, 0, 0, 0, 0, 6800, 0, 0,
+    3765, 5557, 7386, 1797, 3154, 2766, 0, 0, 1940, 0, 0, 0, 6328, 4739, 0, 1908,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1639, 0, 2603, 0, 7329, 0,
+    3556, 5453, 0, 0, 0, 0, 2326, 0, 0, 0, 5894, 0, 0, 7078, 0, 2486,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4598, 0, 0, 0,
+    0, 0, 5341, 4553, 0, 0, 5886, 0, 2111, 0, 4782, 270, 4987, 0, 4882, 6634,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5255, 94, 0, 0, 0, 7096,
+    2152, 6882, 0, 0, 6206, 6743, 0, 0, 0, 6595, 0, 0, 6461, 0, 0, 0,
+    0, 0, 2970, 0, 4643, 6036, 3007, 4323, 0, 0, 0, 0, 1695, 6287, 0, 0,
+    0, 0, 5072, 0, 0, 4001, 0, 3549, 2666, 0, 0, 0, 5079, 0, 0, 5473,
+    0, 0, 119, 0, 0, 0, 0, 0, 0, 6949, 0, 5636, 7375, 0, 0, 0,
+    5360, 2805, 0, 6966, 0, 2872, 0, 1770, 0, 0, 3246, 2571, 3315, 6616, 5869, 3111,
+    0, 5379, 0, 2029, 4422, 0, 0, 0, 2746, 0, 4062, 0, 4225, 0, 6917, 0,
+    0, 0, 5677, 4197, 3738, 3598, 0, 0, 1747, 0, 4679, 0, 0, 0, 0, 0,
+    3363, 4651, 2463, 5660, 0, 5617, 0, 0, 0, 0, 55, 4983, 0, 2615, 0, 13,
+    0, 0, 0, 0, 6534, 0, 0, 0, 0, 0, 0, 0, 2399, 0, 0, 0,
+    3609, 4843, 4486, 5766, 0, 0, 0, 1700, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4979, 0, 0, 0, 3968, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2025, 0, 3499, 1777, 0, 0, 7301, 6719, 0, 0, 0, 5113, 83, 2726,
+    0, 0, 0, 0, 6386, 0, 7312, 0, 0, 0, 0, 0, 2229, 0, 0, 0,
+    7262, 0, 0, 0, 6103, 0, 0, 0, 7210, 2511, 6264, 4475, 4616, 0, 6855, 4961,
+    0, 216, 3348, 0, 0, 0, 4907, 2424, 0, 6040, 0, 0, 0, 6026, 3860, 0,
+    3749, 0, 3726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6296,
+    0, 7348, 6572, 0, 0, 2565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2588, 0, 0, 0, 0, 0, 77, 2102, 4122, 7418, 2702, 4969, 0, 0,
+    0, 2420, 0, 0, 6277, 0, 0, 0, 2043, 0, 0, 0, 0, 7013, 0, 6799,
+    2526, 0, 0, 3255, 7380, 2198, 6688, 6016, 5542, 7192, 0, 3152, 0, 0, 4735, 0,
+    0, 0, 0, 0, 0, 0, 4310, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5026, 0, 0, 0, 0, 0, 0, 3546, 0, 294, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6843, 0, 235, 0, 0, 0, 5514, 0, 0, 2284,
+    0, 0, 0, 0, 4549, 2005, 5742, 0, 6175, 5851, 0, 0, 6510, 63, 258, 5229,
+    0, 2096, 5370, 4747, 0, 0, 0, 0, 4606, 0, 2905, 0, 7359, 6825, 0, 0,
+    5206, 2693, 5166, 0, 3674, 3935, 0, 6742, 0, 6482, 0, 0, 6455, 0, 3342, 6246,
+    0, 0, 170, 0, 0, 4406, 0, 0, 0, 5197, 0, 0, 204, 3911, 5977, 6283,
+    0, 0, 0, 6223, 3586, 3000, 0, 0, 0, 0, 0, 0, 2135, 7284, 0, 0,
+    0, 0, 0, 0, 6160, 5424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2804, 7181, 0, 6960, 0, 177, 0, 0, 0, 0, 5956, 5487, 0, 0,
+    6612, 4831, 4716, 3217, 0, 0, 5973, 0, 5364, 148, 6147, 7143, 0, 0, 2008, 195,
+    5185, 0, 6350, 0, 4191, 6777, 0, 3734, 0, 0, 4304, 0, 3540, 5130, 0, 0,
+    4650, 4664, 3701, 2922, 0, 2460, 0, 0, 0, 4079, 0, 4580, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4889, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5403, 0, 0, 0, 0, 0, 0, 6241, 5690, 0, 0,
+    7229, 3124, 5845, 5348, 0, 0, 0, 0, 2774, 0, 0, 1949, 0, 0, 6664, 4861,
+    0, 0, 0, 0, 0, 0, 0, 0, 1838, 0, 7295, 44, 0, 0, 3843, 0,
+    4722, 6560, 6236, 0, 0, 0, 5098, 2863, 0, 0, 3793, 0, 0, 0, 3427, 0,
+    0, 0, 0, 7256, 0, 3252, 0, 7081, 0, 0, 6068, 0, 6851, 0, 4612, 0,
+    0, 3397, 0, 0, 0, 0, 3347, 2623, 0, 3331, 0, 0, 0, 313, 0, 6025,
+    0, 0, 2665, 0, 0, 0, 0, 0, 0, 6637, 0, 0, 0, 0, 0, 0,
+    0, 1720, 0, 2187, 7344, 0, 0, 0, 7154, 5468, 6432, 0, 0, 0, 4382, 0,
+    0, 0, 140, 5336, 0, 0, 0, 6129, 0, 0, 3377, 0, 2879, 6605, 2700, 2093,
+    4094, 1710, 0, 0, 0, 0, 5094, 0, 0, 0, 6213, 1924, 0, 0, 2249, 0,
+    2690, 4213, 2550, 3880, 4012, 1667, 2524, 5296, 6166, 6013, 4286, 7428, 7186, 0, 3991, 6687,
+    0, 0, 0, 0, 5941, 0, 0, 0, 3870, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4168, 0,
+    0, 5920, 0, 0, 0, 0, 0, 0, 5754, 5832, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3523, 0, 0, 0, 4693, 0, 5739, 0, 0, 6506, 7272, 102, 243,
+    4069, 0, 1896, 0, 0, 0, 5361, 3308, 0, 2853, 0, 0, 5622, 0, 5035, 0,
+    0, 0, 7165, 6713, 4946, 4557, 3670, 0, 0, 0, 0, 5112, 0, 0, 0, 6370,
+    0, 4504, 0, 6245, 0, 0, 1622, 2959, 0, 0, 2639, 7127, 0, 0, 0, 0,
+    2783, 0, 2820, 0, 1789, 6219, 249, 2655, 0, 5854, 0, 0, 4281, 0, 3501, 0,
+    0, 0, 0, 0, 0, 0, 6157, 0, 0, 0, 0, 0, 5662, 0, 5330, 1679,
+    0, 5456, 0, 0, 0, 0, 1988, 0, 0, 0, 0, 3138, 5484, 6553, 3202, 7322,
+    1617, 5438, 1893, 3100, 3482, 5396, 0, 0, 0, 0, 0, 0, 6144, 0, 6808, 1878,
+    6098, 3982, 6998, 0, 1858, 5828, 0, 0, 3777, 3019, 0, 0, 2492, 0, 6648, 3534,
+    6620, 0, 6740, 0, 3697, 0, 0, 0, 2921, 0, 3637, 4075, 4576, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 286, 0, 0, 0, 2349, 0, 0, 0, 0, 0,
+    0, 0, 0, 2466, 0, 0, 5774, 0, 0, 0, 0, 0, 0, 3232, 0, 0,
+    0, 0, 7225, 3123, 5641, 0, 7048, 0, 0, 0, 0, 0, 3763, 0, 0, 0,
+    4855, 0, 0, 0, 0, 0, 0, 0, 1980, 0, 5559, 7390, 0, 0, 0, 1830,
+    5173, 0, 4893, 5532, 0, 0, 4707, 0, 1911, 6192, 6420, 0, 0, 0, 2235, 4273,
+    0, 0, 2547, 0, 3383, 0, 0, 6120, 0, 7075, 7305, 0, 4428, 0, 0, 0,
+    0, 2319, 0, 0, 0, 0, 0, 0, 2489, 0, 3330, 0, 0, 2602, 0, 0,
+    0, 0, 5447, 0, 0, 0, 0, 0, 0, 0, 6631, 0, 0, 0, 0, 0,
+    5888, 0, 0, 0, 5614, 5278, 5814, 0, 0, 0, 7150, 0, 0, 0, 0, 0,
+    6526, 2063, 3128, 3459, 4378, 7103, 5335, 0, 5321, 0, 0, 0, 0, 2944, 4156, 1827,
+    0, 6599, 0, 0, 6465, 1693, 0, 0, 6332, 0, 1812, 0, 0, 0, 2973, 3093,
+    4326, 1663, 4285, 2151, 3511, 0, 6199, 6722, 5076, 0, 0, 3211, 0, 0, 0, 4004,
+    0, 3990, 0, 0, 0, 0, 0, 5938, 7373, 0, 0, 2214, 0, 0, 0, 6963,
+    0, 0, 1768, 6045, 3142, 0, 3225, 0, 6019, 0, 5430, 0, 0, 0, 0, 0,
+    0, 2982, 0, 3248, 0, 0, 0, 5871, 0, 0, 6914, 5831, 4425, 0, 2893, 0,
+    3736, 3595, 0, 0, 6931, 1975, 4689, 0, 0, 5679, 0, 4201, 0, 0, 0, 0,
+    3110, 5009, 2570, 0, 6581, 2028, 0, 0, 0, 0, 2735, 0, 3306, 4055, 5619, 1876,
+    0, 0, 0, 0, 0, 58, 2086, 4986, 4491, 3280, 0, 0, 4840, 6537, 0, 6514,
+    0, 0, 0, 0, 0, 2401, 0, 0, 0, 0, 0, 4489, 4977, 168, 0, 2638,
+    0, 0, 3966, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2023,
+    3497, 2813, 4828, 0, 6717, 5765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5455, 5627, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7316,
+    0, 0, 0, 0, 0, 5435, 3478, 3173, 4268, 3418, 7266, 0, 0, 0, 0, 0,
+    2963, 5155, 4479, 6095, 6696, 4965, 4619, 4218, 0, 0, 0, 0, 0, 0, 0, 2681,
+    4910, 0, 0, 2491, 0, 0, 0, 0, 3864, 0, 3730, 3633, 6569, 7346, 0, 0,
+    0, 275, 0, 0, 0, 0, 0, 6299, 0, 0, 0, 0, 0, 0, 3544, 0,
+    0, 2347, 0, 0, 0, 3705, 0, 0, 3238, 0, 0, 0, 0, 5759, 0, 0,
+    6275, 4258, 5596, 4398, 0, 5716, 0, 0, 0, 7044, 156, 0, 0, 0, 4801, 5547,
+    0, 4033, 0, 0, 0, 0, 0, 0, 0, 0, 1979, 0, 2835, 7384, 1965, 2202,
+    7196, 5544, 0, 0, 6974, 5531, 0, 0, 0, 47, 4878, 0, 0, 0, 0, 4313,
+    0, 4272, 3447, 0, 6681, 0, 0, 0, 0, 3208, 2345, 2388, 0, 0, 0, 0,
+    4426, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2002, 6031, 2913, 192, 0, 3268, 6173, 0, 5412, 0, 0, 0, 0, 0, 5744,
+    0, 0, 0, 0, 0, 5853, 0, 5058, 5813, 6822, 3055, 0, 0, 0, 0, 3672,
+    2283, 0, 2059, 0, 6522, 2907, 7099, 4610, 5320, 0, 0, 3942, 4518, 0, 6489, 5223,
+    2868, 0, 0, 0, 4746, 0, 0, 6459, 2520, 0, 4461, 4874, 0, 0, 4409, 0,
+    4386, 0, 5200, 0, 2539, 5160, 3914, 2843, 2149, 6721, 2132, 7281, 0, 3773, 0, 3846,
+    0, 3578, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3353, 2449, 7179, 0,
+    0, 6957, 0, 1671, 0, 0, 225, 0, 5517, 0, 0, 0, 0, 0, 4714, 0,
+    0, 7249, 0, 0, 6145, 5958, 2384, 5418, 0, 0, 0, 0, 5182, 3027, 0, 2402,
+    2892, 6774, 0, 3732, 7146, 0, 0, 6925, 0, 0, 0, 6791, 0, 4195, 0, 0,
+    6441, 6577, 2146, 4816, 113, 0, 2568, 3108, 0, 0, 0, 241, 0, 147, 0, 0,
+    1772, 4047, 0, 4583, 4216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4892, 0,
+    0, 2222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7227, 0, 7007, 0,
+    0, 0, 0, 0, 2772, 6244, 0, 1947, 0, 0, 6662, 4858, 0, 0, 0, 0,
+    0, 0, 0, 0, 5576, 0, 5293, 0, 0, 4779, 3841, 0, 6234, 0, 2990, 5756,
+    0, 0, 4362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2897, 4458, 0, 4177,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 0, 3414, 7260, 0, 0,
+    7085, 4246, 6863, 3836, 0, 5097, 0, 4615, 0, 0, 0, 0, 0, 3786, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3299, 0, 2370, 0, 0, 0, 0, 2185, 7342,
+    0, 0, 6002, 6429, 7152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 213, 0, 6127, 0, 0, 0, 0, 5791, 6602, 3641, 142, 0, 0, 0, 0,
+    2589, 5092, 0, 3188, 2181, 4394, 6211, 0, 0, 6411, 1713, 7119, 0, 0, 0, 0,
+    1931, 30, 4797, 4029, 0, 0, 0, 5495, 0, 0, 3063, 0, 0, 2878, 0, 5300,
+    1964, 7440, 4087, 0, 7190, 6155, 4953, 0, 0, 4448, 0, 0, 0, 0, 0, 0,
+    2243, 0, 0, 0, 3873, 2536, 0, 0, 6680, 4165, 0, 0, 3825, 7394, 2387, 3713,
+    0, 0, 0, 6346, 6984, 0, 0, 5926, 0, 0, 0, 3337, 0, 0, 0, 3520,
+    4691, 0, 0, 0, 3267, 0, 0, 0, 0, 0, 0, 0, 4067, 0, 184, 4147,
+    0, 5741, 0, 0, 0, 0, 0, 0, 0, 0, 2121, 4573, 0, 0, 0, 6710,
+    3053, 0, 3668, 0, 0, 2281, 0, 0, 0, 0, 0, 0, 0, 3938, 4561, 0,
+    4514, 110, 6485, 6377, 7237, 61, 5188, 0, 0, 0, 2756, 0, 4460, 0, 0, 0,
+    2962, 0, 2067, 0, 7130, 7107, 0, 4940, 0, 2786, 0, 5145, 0, 1792, 3845, 0,
+    0, 0, 0, 0, 0, 0, 4284, 3504, 0, 0, 0, 0, 0, 3684, 0, 2448,
+    0, 0, 0, 0, 0, 0, 0, 0, 6551, 7319, 3181, 0, 2998, 0, 0, 1891,
+    5247, 2322, 131, 3480, 0, 0, 7068, 3204, 6142, 1620, 0, 1678, 2795, 6096, 2988, 6995,
+    5389, 0, 0, 0, 0, 0, 0, 0, 0, 4593, 3985, 1865, 5340, 6785, 5830, 0,
+    0, 0, 0, 0, 5132, 2189, 0, 3099, 6624, 4767, 0, 6437, 0, 0, 0, 0,
+    0, 0, 0, 145, 0, 4579, 5822, 39, 0, 0, 3776, 4718, 0, 0, 0, 320,
+    0, 0, 6585, 0, 0, 3296, 0, 0, 0, 0, 0, 0, 0, 0, 166, 7223,
+    0, 0, 7046, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4852, 0, 0, 0,
+    0, 0, 0, 0, 2719, 0, 5573, 7447, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3231, 0, 0, 4358, 6190, 5635, 0, 7027, 0, 0, 0, 0, 0, 4173, 0,
+    0, 0, 0, 4443, 0, 5454, 0, 0, 0, 2936, 0, 0, 0, 2318, 0, 0,
+    1829, 0, 6114, 7079, 2952, 4935, 1761, 0, 0, 0, 6399, 0, 0, 0, 2234, 2776,
+    0, 0, 1746, 0, 0, 0, 0, 0, 0, 3658, 2369, 7270, 4208, 1650, 0, 0,
+    6873, 5276, 5613, 2313, 6001, 0, 0, 7148, 0, 0, 0, 0, 0, 0, 6524, 3456,
+    0, 3080, 0, 0, 0, 0, 0, 0, 0, 0, 1825, 0, 3194, 1699, 6596, 11,
+    0, 6462, 0, 0, 6330, 0, 0, 5263, 0, 2851, 0, 0, 2166, 7115, 0, 0,
+    3818, 1696, 1927, 5749, 3958, 0, 4333, 29, 0, 0, 0, 0, 0, 0, 0, 3494,
+    4135, 5080, 0, 7436, 2877, 0, 0, 0, 2725, 0, 0, 4447, 0, 0, 0, 0,
+    0, 6134, 283, 0, 4805, 3282, 2228, 0, 6967, 0, 0, 0, 1771, 0, 3824, 5304,
+    0, 0, 2412, 7200, 0, 0, 6978, 0, 0, 5923, 4423, 0, 0, 5877, 0, 0,
+    0, 6928, 4687, 6039, 0, 0, 0, 4198, 0, 0, 3739, 3599, 0, 0, 0, 2304,
+    0, 0, 0, 0, 0, 0, 4119, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2267, 0, 0, 4566, 0, 0, 0, 5326, 0, 0, 0, 0,
+    2171, 5965, 76, 5003, 4844, 0, 6373, 7056, 6518, 0, 0, 0, 217, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4980, 0, 0, 3969, 6798, 2085, 4925, 3946, 4825, 0,
+    6493, 0, 0, 0, 0, 0, 0, 0, 0, 3500, 2026, 0, 0, 6720, 0, 3683,
+    0, 0, 0, 0, 3620, 0, 0, 0, 0, 0, 7313, 0, 0, 0, 0, 0,
+    0, 2812, 2321, 3476, 0, 7330, 4266, 3416, 0, 0, 0, 0, 0, 0, 6093, 0,
+    4962, 0, 0, 0, 5626, 0, 1676, 0, 0, 0, 0, 3048, 0, 1861, 0, 4544,
+    0, 0, 0, 0, 0, 3167, 4912, 3727, 0, 0, 0, 3097, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6573, 7349, 0, 0, 0, 2566, 6306, 5165, 0, 5807,
+    2680, 1743, 4703, 0, 5136, 0, 0, 2599, 0, 6445, 0, 0, 3709, 4255, 5595, 4396,
+    0, 0, 0, 1734, 7042, 0, 0, 0, 0, 6278, 0, 0, 4031, 2476, 3071, 3581,
+    0, 0, 0, 0, 0, 0, 0, 0, 5073, 0, 0, 0, 0, 0, 181, 0,
+    0, 0, 0, 5701, 0, 0, 0, 3229, 0, 0, 0, 7023, 2803, 0, 3894, 6950,
+    0, 0, 0, 0, 5950, 0, 5798, 0, 0, 0, 4683, 2052, 2935, 0, 0, 3439,
+    4536, 0, 0, 0, 0, 0, 0, 205, 0, 0, 0, 0, 4877, 0, 0, 4181,
+    0, 0, 2653, 0, 3806, 2225, 0, 0, 0, 0, 238, 5743, 0, 2006, 2456, 1649,
+    0, 5056, 6194, 7089, 0, 6867, 0, 0, 2298, 0, 0, 0, 0, 0, 0, 0,
+    6520, 3079, 6030, 4607, 0, 0, 0, 0, 0, 3675, 4516, 0, 0, 0, 0, 0,
+    0, 0, 0, 6456, 0, 0, 4872, 0, 5043, 0, 0, 0, 2978, 0, 5214, 0,
+    0, 0, 3954, 0, 0, 0, 0, 0, 0, 4390, 0, 0, 3576, 4329, 0, 3921,
+    6895, 74, 2867, 2136, 7285, 0, 4107, 0, 0, 0, 0, 3466, 6555, 0, 0, 175,
+    0, 0, 1935, 0, 2260, 0, 0, 6085, 4050, 0, 0, 6961, 1675, 7246, 0, 0,
+    7460, 0, 3571, 0, 0, 0, 4717, 3276, 3025, 0, 0, 0, 0, 0, 3346, 2443,
+    7144, 2386, 6922, 5874, 0, 3250, 6788, 0, 0, 4192, 6024, 0, 3735, 0, 0, 0,
+    0, 2303, 0, 0, 0, 0, 0, 0, 0, 2378, 0, 0, 0, 0, 0, 4814,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4531, 0,
+    0, 0, 0, 0, 0, 3164, 0, 0, 0, 0, 4968, 5404, 0, 0, 0, 0,
+    0, 0, 0, 194, 0, 7230, 0, 6065, 0, 0, 0, 0, 5151, 2775, 2083, 0,
+    5290, 5575, 6686, 6009, 1950, 4776, 6381, 3157, 0, 0, 0, 0, 0, 0, 188, 4360,
+    0, 0, 0, 3844, 3619, 0, 6237, 0, 0, 0, 4456, 0, 0, 0, 3560, 0,
+    0, 0, 0, 0, 0, 0, 5027, 0, 3412, 201, 0, 0, 3834, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2800, 0, 0, 0, 4627, 6844, 4238, 0,
+    0, 0, 5733, 0, 0, 5904, 0, 0, 2080, 6501, 4790, 2123, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 7345, 2188, 0, 7155, 6938, 1869, 6433, 6302,
+    0, 21, 3665, 0, 0, 0, 2678, 6666, 0, 0, 0, 0, 4647, 2438, 0, 0,
+    7117, 4392, 1730, 3645, 2340, 2179, 5996, 6408, 0, 5095, 0, 0, 0, 0, 4027, 6214,
+    0, 3580, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5500, 0, 0,
+    6153, 0, 0, 0, 0, 3187, 0, 0, 0, 0, 5652, 7443, 0, 0, 0, 0,
+    0, 3890, 0, 0, 0, 0, 0, 0, 5947, 5480, 0, 0, 5598, 2051, 0, 5313,
+    5392, 4169, 4535, 7406, 0, 0, 2749, 6140, 0, 0, 6472, 0, 6349, 6988, 0, 0,
+    0, 0, 2765, 0, 0, 227, 0, 0, 3524, 4694, 0, 4144, 0, 5740, 3692, 0,
+    0, 0, 0, 0, 4070, 2119, 4571, 0, 3768, 0, 0, 0, 3336, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6021, 0, 4558, 3671, 4512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2115, 7220, 0, 247, 0,
+    4994, 0, 5414, 0, 0, 0, 0, 0, 0, 0, 0, 2071, 3917, 0, 0, 7111,
+    0, 0, 6891, 1799, 0, 0, 0, 6755, 2866, 0, 0, 0, 0, 0, 2142, 6554,
+    0, 0, 3402, 6415, 0, 0, 282, 0, 4337, 0, 0, 0, 0, 0, 4042, 5244,
+    6116, 7065, 5991, 5084, 0, 0, 0, 0, 3554, 1894, 0, 3483, 2218, 0, 2628, 0,
+    0, 2442, 3983, 0, 3329, 2545, 6056, 2428, 6971, 6782, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6621, 0, 0, 0, 0, 0, 0, 0, 0, 6638, 2363,
+    5274, 5383, 0, 0, 4765, 0, 0, 0, 0, 0, 4373, 0, 0, 0, 5824, 5334,
+    5687, 0, 0, 0, 0, 0, 2706, 2105, 4017, 4151, 164, 6589, 0, 0, 0, 0,
+    0, 3378, 0, 6322, 0, 7226, 0, 0, 38, 0, 6832, 7049, 1658, 2942, 2620, 2529,
+    0, 0, 5572, 1606, 0, 3156, 0, 0, 0, 0, 0, 3989, 0, 0, 0, 0,
+    4356, 0, 5934, 0, 0, 0, 7025, 0, 0, 0, 0, 0, 6193, 0, 0, 4441,
+    0, 3559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6112,
+    0, 0, 0, 1759, 3140, 0, 2320, 0, 0, 0, 0, 0, 0, 0, 0, 3037,
+    0, 0, 2015, 0, 0, 6391, 5901, 5448, 0, 0, 0, 101, 5374, 1914, 4789, 2312,
+    0, 0, 0, 0, 6108, 0, 1958, 0, 0, 0, 6877, 5279, 4637, 5615, 0, 7151,
+    0, 4945, 0, 0, 0, 0, 3460, 6527, 4916, 0, 0, 0, 0, 3651, 1874, 1643,
+    0, 0, 5261, 1828, 0, 2849, 5995, 2164, 2637, 7113, 5981, 0, 6333, 3956, 3815, 6310,
+    0, 0, 5912, 0, 0, 0, 0, 0, 0, 0, 0, 3492, 0, 0, 0, 5497,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4127, 3185, 7439, 3120, 0,
+    0, 0, 0, 0, 0, 5748, 0, 0, 0, 4809, 0, 3226, 0, 0, 2410, 5431,
+    5583, 3473, 0, 5391, 0, 7402, 0, 0, 3259, 2748, 0, 7212, 6471, 6091, 0, 6982,
+    6360, 0, 0, 3016, 0, 0, 0, 0, 0, 6932, 0, 4690, 0, 0, 0, 0,
+    2926, 2674, 4116, 0, 0, 0, 3628, 0, 0, 0, 0, 0, 0, 128, 0, 0,
+    0, 0, 0, 3326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5525, 0, 0,
+    0, 0, 0, 0, 6515, 0, 0, 0, 0, 0, 2274, 3325, 0, 0, 5712, 5233,
+    0, 7039, 2100, 0, 0, 0, 0, 0, 0, 4346, 0, 2791, 0, 5325, 0, 0,
+    1978, 0, 2697, 0, 1848, 1795, 3950, 4829, 6751, 0, 6497, 0, 0, 0, 5530, 4737,
+    6258, 5121, 0, 0, 6414, 0, 0, 0, 0, 0, 0, 4271, 3442, 1637, 0, 3925,
+    7327, 0, 0, 0, 6115, 0, 0, 0, 0, 1808, 0, 3479, 0, 0, 3419, 4269,
+    5893, 2627, 3366, 0, 0, 3613, 2427, 0, 0, 3206, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2714, 7412, 6632, 5812, 0, 0, 0, 0, 0, 5368, 0, 0, 5253, 92, 4671, 0,
+    3216, 7094, 0, 2597, 5319, 0, 5809, 0, 2705, 98, 4150, 3706, 0, 5140, 0, 1732,
+    0, 0, 6449, 0, 6318, 0, 0, 5597, 4259, 3070, 4399, 0, 0, 7045, 5159, 6285,
+    4931, 2528, 0, 4702, 5070, 4034, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7021, 0, 2635, 0, 0, 0, 3892, 6947, 0, 0, 5694, 0,
+    5511, 0, 5358, 0, 0, 0, 0, 0, 0, 3437, 0, 0, 0, 0, 5952, 5800,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2891, 0, 2651, 0, 0, 0,
+    0, 6915, 0, 0, 0, 0, 0, 0, 4185, 0, 5413, 3798, 4677, 2046, 3432, 1913,
+    5373, 0, 4316, 0, 3312, 2297, 0, 0, 0, 0, 0, 6073, 5059, 6871, 0, 4631,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6523, 0, 0, 3088, 0, 0, 0,
+    1642, 0, 3607, 4519, 4206, 1626, 0, 5041, 0, 5212, 0, 0, 5980, 0, 3952, 4875,
+    0, 0, 0, 0, 5911, 4387, 0, 0, 0, 5863, 0, 0, 6893, 0, 0, 0,
+    0, 0, 0, 0, 0, 3579, 0, 0, 0, 0, 5671, 0, 0, 0, 223, 0,
+    0, 0, 0, 4099, 0, 0, 0, 0, 1672, 0, 1939, 5746, 5518, 0, 3569, 2253,
+    1970, 0, 4298, 2554, 7250, 0, 0, 3409, 4241, 0, 6178, 7208, 5527, 2509, 5944, 6853,
+    0, 3028, 0, 6359, 0, 0, 0, 0, 0, 6079, 2832, 6926, 0, 0, 0, 2496,
+    6792, 0, 2925, 3747, 3275, 0, 0, 0, 0, 0, 4812, 0, 0, 0, 0, 0,
+    0, 0, 2380, 0, 0, 0, 0, 0, 0, 2353, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2587, 5787, 0, 0, 0, 0, 0, 0, 5711, 0, 0, 0,
+    7289, 2950, 2909, 6063, 0, 0, 0, 0, 0, 0, 0, 2041, 0, 4024, 7011, 0,
+    0, 0, 0, 5316, 0, 0, 234, 0, 1847, 5577, 1963, 5294, 0, 0, 4780, 0,
+    4733, 6385, 6254, 4901, 0, 0, 0, 4363, 0, 0, 0, 0, 0, 5150, 3441, 0,
+    0, 4459, 5024, 6679, 0, 0, 305, 1803, 4431, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3415, 0, 2534, 3837, 0, 3612, 0, 6841, 4236, 0, 2606, 0, 0, 3266,
+    0, 5465, 0, 0, 0, 0, 0, 0, 2003, 5735, 2471, 0, 0, 0, 5906, 0,
+    0, 0, 0, 0, 5054, 0, 0, 0, 0, 211, 0, 0, 3663, 19, 7357, 6823,
+    1883, 0, 5351, 5204, 0, 0, 3933, 1873, 4509, 0, 4784, 6480, 0, 0, 6670, 3642,
+    1728, 5783, 0, 0, 0, 0, 3018, 0, 2182, 0, 0, 4395, 0, 0, 6412, 7120,
+    0, 6903, 108, 6281, 5144, 6221, 0, 0, 4030, 0, 2755, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7441, 2339, 0, 2447, 0, 0, 3888, 0, 0, 0,
+    0, 0, 0, 0, 5508, 5645, 0, 0, 0, 0, 0, 0, 5485, 0, 0, 0,
+    0, 5949, 6138, 0, 0, 0, 0, 0, 0, 6985, 0, 6347, 7409, 0, 0, 0,
+    0, 0, 0, 5183, 0, 0, 0, 6775, 0, 0, 0, 2045, 2574, 269, 2986, 5128,
+    0, 0, 4662, 2031, 4315, 3388, 3311, 4148, 3904, 0, 4077, 0, 0, 4574, 2122, 4228,
+    0, 0, 0, 0, 0, 0, 0, 2515, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3086, 0, 4515, 2113, 1625, 7218, 0, 3767, 0, 4992, 0, 0, 0,
+    0, 0, 0, 0, 0, 3294, 0, 2068, 0, 0, 5862, 7108, 0, 0, 6889, 0,
+    4859, 5769, 6753, 5569, 0, 0, 0, 0, 0, 0, 0, 0, 5670, 0, 4353, 0,
+    0, 0, 0, 0, 2976, 0, 0, 0, 0, 2861, 0, 1817, 0, 0, 0, 3182,
+    4341, 0, 0, 0, 3552, 3528, 0, 4294, 5248, 1961, 6734, 0, 3215, 7069, 6849, 2141,
+    4240, 0, 0, 0, 3395, 5390, 6394, 0, 0, 0, 0, 0, 0, 2495, 0, 2829,
+    4041, 0, 6786, 6050, 2663, 2368, 0, 0, 0, 0, 3273, 6635, 5272, 0, 2217, 6000,
+    0, 4763, 0, 0, 0, 0, 0, 0, 2365, 1718, 2352, 6936, 0, 3263, 0, 0,
+    0, 0, 3757, 0, 0, 0, 6586, 5786, 0, 0, 5689, 0, 3375, 0, 0, 6320,
+    0, 6603, 5259, 5013, 0, 0, 4759, 0, 0, 0, 2618, 0, 1922, 28, 0, 0,
+    0, 0, 0, 0, 0, 0, 3878, 0, 1991, 7448, 4010, 5574, 4496, 4130, 0, 7426,
+    0, 0, 0, 0, 0, 4446, 2076, 0, 4359, 0, 0, 0, 0, 7028, 0, 6811,
+    0, 0, 0, 0, 0, 5141, 0, 0, 3823, 4444, 4430, 0, 0, 0, 0, 0,
+    4741, 0, 0, 5919, 0, 0, 0, 0, 2433, 0, 1762, 0, 2013, 0, 0, 2605,
+    0, 6389, 0, 5462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6106, 0, 5903, 0, 0, 0, 0, 6874, 2314, 3058, 0, 0, 0, 0, 2287, 0,
+    0, 5033, 4641, 0, 3172, 7163, 6711, 4223, 0, 0, 0, 0, 66, 2170, 4783, 5110,
+    0, 4920, 4749, 6368, 0, 0, 0, 4502, 0, 0, 0, 5309, 5264, 7367, 2852, 0,
+    2167, 7116, 4939, 2154, 6217, 3819, 6763, 3959, 6314, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3495, 0, 4125, 0, 7437, 0, 3682, 0, 0, 0, 2337, 0,
+    0, 6289, 0, 0, 3003, 4806, 0, 0, 0, 0, 0, 0, 3471, 293, 7320, 5551,
+    0, 5482, 0, 0, 3257, 5436, 0, 155, 6089, 0, 0, 6979, 2840, 0, 7405, 0,
+    0, 0, 7215, 0, 0, 6996, 0, 0, 0, 1856, 0, 0, 0, 0, 0, 0,
+    2573, 3112, 0, 0, 2030, 5582, 0, 0, 3903, 0, 151, 4120, 6646, 4073, 1782, 4227,
+    0, 0, 0, 6353, 0, 0, 0, 0, 2268, 0, 0, 0, 0, 2513, 0, 0,
+    0, 0, 0, 0, 302, 0, 0, 6185, 0, 0, 5231, 0, 0, 5986, 2098, 7037,
+    0, 1742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2696, 0,
+    0, 0, 3947, 4853, 6749, 5768, 6494, 0, 0, 0, 0, 0, 2273, 5697, 6256, 0,
+    5227, 0, 0, 0, 7018, 0, 0, 0, 0, 4473, 2790, 1909, 0, 25, 0, 0,
+    0, 0, 0, 0, 0, 0, 2934, 2543, 1841, 0, 7331, 6730, 3929, 7303, 3858, 0,
+    0, 5115, 0, 2842, 0, 0, 6393, 2139, 0, 0, 2487, 3801, 0, 3358, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2722, 0, 1648, 0, 0, 0, 6629, 6857, 1605,
+    0, 0, 5887, 0, 2215, 0, 0, 0, 0, 0, 4669, 0, 0, 3078, 0, 0,
+    0, 0, 6796, 0, 3751, 0, 0, 0, 5137, 0, 0, 0, 311, 0, 6446, 0,
+    6316, 2713, 6597, 117, 7378, 0, 0, 0, 5210, 1735, 6463, 0, 2763, 0, 2971, 0,
+    0, 3072, 0, 4324, 0, 0, 0, 0, 0, 0, 233, 0, 266, 4129, 0, 5074,
+    4102, 4002, 0, 0, 0, 0, 0, 0, 0, 0, 5693, 0, 7024, 0, 2256, 2212,
+    4930, 72, 0, 3895, 6951, 0, 0, 6699, 0, 0, 1609, 7456, 0, 0, 0, 0,
+    0, 0, 3440, 0, 0, 3247, 0, 0, 3646, 0, 0, 5870, 6912, 0, 0, 0,
+    2994, 0, 0, 0, 4182, 0, 2654, 3796, 0, 2302, 0, 3430, 0, 0, 4199, 0,
+    0, 0, 0, 0, 0, 0, 0, 6071, 0, 6868, 3057, 0, 0, 0, 2299, 0,
+    0, 2286, 0, 0, 0, 0, 56, 4984, 4635, 0, 0, 0, 3791, 6535, 5235, 65,
+    0, 0, 0, 1899, 4748, 0, 0, 309, 0, 0, 0, 0, 0, 4487, 5044, 0,
+    7361, 0, 0, 5215, 3162, 7173, 3955, 0, 0, 4924, 0, 0, 0, 0, 3011, 0,
+    0, 0, 0, 0, 0, 6896, 0, 0, 0, 0, 0, 2670, 0, 4097, 0, 0,
+    3618, 0, 0, 0, 3002, 0, 1936, 6225, 0, 0, 5857, 124, 2552, 4296, 0, 0,
+    178, 7314, 0, 3407, 0, 3572, 5433, 6176, 5505, 0, 0, 0, 5665, 0, 1682, 0,
+    0, 3320, 0, 4092, 7211, 4617, 3062, 4963, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2247, 3101, 4908, 0, 2933, 0, 0, 0, 150, 2799, 0, 0, 3728, 5929, 0,
+    1781, 0, 0, 4815, 0, 5840, 6352, 0, 4726, 3780, 6297, 0, 0, 0, 0, 0,
+    3542, 6656, 0, 0, 0, 0, 0, 1632, 0, 0, 0, 0, 7287, 2948, 0, 4081,
+    1725, 0, 0, 0, 0, 0, 0, 0, 0, 4022, 0, 3076, 2644, 2421, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6252, 6382, 0, 272,
+    0, 0, 2271, 7254, 0, 5696, 5192, 5648, 0, 0, 0, 3885, 0, 4469, 0, 0,
+    4311, 0, 0, 3147, 199, 0, 0, 0, 3044, 88, 0, 1840, 4534, 5028, 1833, 1807,
+    3854, 0, 0, 4895, 0, 0, 0, 0, 5100, 0, 0, 0, 2238, 3800, 0, 0,
+    0, 0, 6845, 4239, 2000, 0, 0, 5734, 0, 0, 6268, 7339, 0, 0, 0, 0,
+    5052, 0, 2331, 0, 0, 0, 0, 0, 5852, 0, 0, 6820, 0, 1881, 0, 0,
+    0, 0, 1870, 0, 0, 3666, 4507, 22, 4608, 0, 290, 6667, 2470, 5344, 0, 0,
+    0, 0, 0, 0, 2196, 0, 5039, 0, 2711, 6457, 1731, 7184, 0, 0, 5785, 0,
+    4407, 0, 0, 0, 0, 5198, 0, 0, 0, 3912, 0, 0, 6886, 0, 2881, 0,
+    0, 0, 4101, 5777, 0, 0, 0, 0, 4673, 0, 0, 0, 0, 0, 0, 6161,
+    2255, 5644, 0, 0, 0, 3891, 0, 0, 4921, 0, 0, 0, 0, 7452, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5957, 2441, 0, 0, 7407, 0, 0, 3602, 5180,
+    0, 5974, 6052, 6772, 0, 0, 0, 5639, 0, 0, 0, 0, 0, 0, 0, 0,
+    3386, 4193, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4581, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4890, 5015, 0, 1751, 0, 0, 1898, 0, 0, 0, 2738, 0, 0, 0, 0, 0,
+    0, 7221, 2116, 5623, 0, 4995, 7167, 2088, 6827, 4856, 6242, 2504, 5568, 0, 6545, 0,
+    250, 0, 0, 0, 6074, 0, 0, 6892, 4351, 0, 0, 6756, 0, 3716, 1704, 0,
+    0, 0, 0, 0, 1815, 0, 0, 0, 0, 0, 3558, 0, 5856, 4338, 0, 0,
+    3526, 4292, 2816, 0, 6732, 0, 0, 0, 3213, 0, 0, 0, 0, 3555, 5664, 0,
+    2582, 1681, 5630, 0, 0, 0, 0, 0, 2730, 4613, 0, 0, 0, 0, 6048, 0,
+    0, 5897, 0, 0, 257, 0, 2037, 2232, 0, 0, 0, 4526, 0, 0, 0, 0,
+    0, 0, 0, 5837, 5275, 5880, 5384, 6639, 0, 4766, 0, 3779, 4725, 0, 2684, 0,
+    0, 0, 0, 6650, 0, 6044, 5688, 0, 0, 0, 0, 3761, 6600, 5257, 5011, 0,
+    5994, 0, 4757, 0, 0, 0, 6323, 3379, 0, 0, 0, 0, 0, 1711, 0, 0,
+    0, 0, 0, 2621, 0, 4494, 0, 0, 0, 5493, 0, 0, 0, 0, 0, 0,
+    0, 0, 3234, 81, 7429, 5007, 5647, 0, 7073, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3118, 3871, 4596, 6803, 0, 0, 3042, 7392,
+    0, 1832, 0, 2747, 0, 0, 6470, 2075, 0, 4745, 4880, 0, 0, 0, 0, 2237,
+    0, 0, 0, 0, 0, 2016, 0, 0, 0, 0, 6392, 0, 7335, 0, 6267, 0,
+    6204, 0, 0, 2328, 0, 0, 0, 0, 0, 0, 0, 2432, 0, 0, 0, 0,
+    6034, 4638, 6708, 4221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4917, 0, 0,
+    4559, 0, 0, 2468, 0, 0, 0, 0, 3170, 0, 5472, 0, 4990, 0, 0, 0,
+    0, 0, 2960, 0, 6311, 0, 7371, 7128, 0, 0, 0, 2784, 0, 0, 5169, 1790,
+    0, 2870, 0, 6746, 0, 0, 0, 0, 5762, 4282, 5120, 3502, 5308, 0, 4658, 0,
+    4417, 4128, 0, 0, 0, 6158, 4060, 0, 0, 7317, 6293, 5550, 0, 0, 3153, 0,
+    3593, 0, 0, 0, 0, 3474, 0, 0, 2838, 3203, 7403, 2626, 3361, 319, 7213, 1618,
+    2426, 6993, 0, 0, 0, 0, 6051, 0, 0, 2611, 0, 0, 0, 2807, 0, 0,
+    5829, 0, 0, 0, 0, 0, 0, 2396, 0, 0, 0, 0, 4838, 6622, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4577, 0, 0, 0, 0, 0, 0, 0, 0,
+    2704, 2916, 3291, 2104, 2857, 0, 0, 0, 0, 0, 0, 0, 2737, 0, 4654, 2467,
+    1775, 0, 0, 5234, 0, 0, 0, 2101, 7040, 96, 6826, 239, 0, 0, 4850, 3390,
+    0, 6539, 0, 0, 0, 0, 0, 2698, 0, 0, 0, 2824, 6752, 5225, 0, 5985,
+    2659, 0, 7016, 0, 0, 6259, 0, 4471, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2541, 2815, 3926, 0, 6728, 183, 5452, 0, 0, 3856, 0, 0, 0, 0,
+    0, 0, 0, 0, 5629, 7306, 0, 0, 0, 3356, 0, 0, 0, 6567, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1912, 0, 0, 5372, 0, 0, 7268, 0,
+    2745, 0, 0, 0, 0, 4005, 6633, 7413, 6861, 4621, 0, 0, 0, 0, 5369, 3351,
+    2683, 0, 0, 4672, 0, 0, 0, 0, 0, 0, 1641, 6029, 6594, 3755, 7376, 115,
+    0, 0, 3249, 0, 6460, 5208, 0, 5979, 0, 6319, 0, 2761, 0, 0, 0, 5910,
+    0, 0, 1694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3190, 0, 0, 0, 0, 0, 0, 4972, 0, 0, 0, 0, 0,
+    0, 0, 0, 5695, 0, 0, 5512, 5359, 0, 0, 5607, 0, 3033, 0, 1769, 0,
+    5302, 4547, 0, 6691, 6020, 6172, 7198, 0, 0, 5106, 0, 0, 6358, 2993, 2073, 0,
+    0, 0, 0, 1953, 0, 0, 6916, 0, 0, 0, 4196, 0, 2688, 3737, 0, 2924,
+    0, 0, 3799, 6203, 0, 0, 3433, 0, 0, 0, 2624, 3340, 0, 0, 0, 0,
+    2423, 0, 6033, 4632, 0, 0, 0, 0, 0, 3789, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3302, 0, 0, 0, 0, 3133, 6516, 7279, 2130, 5471, 0, 0, 0,
+    0, 5423, 0, 0, 0, 0, 0, 0, 4978, 7365, 0, 0, 0, 3967, 7177, 0,
+    6955, 2701, 254, 1846, 0, 0, 0, 0, 0, 0, 0, 2024, 3498, 6249, 6610, 6718,
+    0, 0, 0, 5306, 4411, 0, 4100, 7138, 4059, 2525, 0, 0, 0, 7311, 0, 0,
+    6229, 226, 3589, 0, 2254, 2555, 0, 4299, 0, 0, 3360, 0, 3410, 2669, 2458, 4090,
+    4960, 6164, 3611, 7209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3725, 2393, 0, 5490, 0, 0, 0, 4834,
+    5401, 0, 0, 0, 0, 0, 0, 3319, 7347, 5553, 0, 0, 2564, 5347, 5842, 0,
+    0, 0, 0, 0, 0, 0, 0, 1904, 2887, 3545, 6660, 0, 1723, 0, 0, 3707,
+    0, 0, 1774, 4585, 2951, 7290, 4085, 42, 0, 0, 4720, 6276, 0, 0, 0, 0,
+    0, 0, 4025, 0, 0, 2482, 0, 0, 0, 1631, 0, 0, 0, 0, 7252, 0,
+    0, 0, 5190, 0, 0, 5976, 3883, 6255, 0, 4467, 0, 0, 0, 5882, 0, 3126,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1804, 0, 3852, 3149, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6563,
+    0, 0, 0, 6427, 0, 0, 5466, 0, 0, 87, 0, 2967, 0, 2330, 4314, 2004,
+    0, 0, 3310, 6126, 7087, 0, 0, 0, 0, 5055, 3997, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1884, 3334, 4605, 6824, 0, 2208, 214, 3673, 4211, 174, 4510, 0,
+    2194, 1624, 5037, 0, 6454, 6011, 6643, 7182, 0, 0, 0, 0, 0, 0, 0, 0,
+    3243, 0, 0, 0, 0, 0, 0, 5861, 6884, 0, 4388, 0, 0, 0, 0, 5338,
+    0, 0, 0, 0, 0, 0, 260, 5669, 0, 4163, 0, 0, 5779, 0, 0, 0,
+    0, 0, 0, 5752, 0, 0, 0, 0, 5606, 5509, 5646, 0, 0, 3518, 4289, 1673,
+    0, 51, 3031, 1607, 0, 0, 6169, 0, 0, 3994, 2941, 0, 0, 4715, 0, 6504,
+    5638, 6146, 0, 2385, 0, 2494, 0, 0, 1951, 5184, 0, 0, 6776, 0, 4190, 3733,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3389, 0, 0, 3339, 0, 0,
+    3601, 0, 0, 0, 0, 2351, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1749,
+    0, 3139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 7275, 3261, 0,
+    0, 0, 0, 5422, 0, 0, 0, 7228, 0, 0, 5329, 5625, 0, 0, 2773, 0,
+    7171, 1948, 4949, 1986, 0, 5570, 4860, 0, 6549, 0, 1702, 0, 0, 0, 4900, 0,
+    0, 0, 0, 4354, 0, 0, 0, 3842, 2642, 6235, 215, 0, 7132, 3977, 6806, 0,
+    1818, 0, 0, 0, 0, 4429, 0, 3009, 4295, 3529, 0, 0, 3506, 6735, 0, 3695,
+    0, 318, 0, 0, 2667, 2728, 0, 0, 2604, 0, 0, 0, 0, 5458, 0, 0,
+    0, 0, 0, 121, 0, 0, 0, 2416, 0, 0, 0, 5899, 0, 0, 0, 0,
+    5441, 0, 2581, 5398, 0, 0, 0, 0, 0, 0, 2186, 7343, 7153, 3317, 5346, 5538,
+    6042, 5839, 0, 0, 0, 0, 0, 3758, 2036, 0, 0, 0, 6654, 4306, 0, 3307,
+    0, 5014, 0, 0, 3643, 0, 6604, 5260, 0, 41, 0, 4760, 4719, 5093, 0, 2153,
+    4705, 6212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4497, 79,
+    1621, 5005, 7427, 0, 7071, 0, 0, 0, 0, 0, 0, 0, 5721, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5847, 6801, 0, 0, 0, 5478, 0, 0, 0, 0,
+    0, 0, 0, 0, 1983, 4742, 0, 2901, 7395, 0, 0, 0, 0, 0, 6986, 5534,
+    0, 0, 0, 0, 0, 6423, 0, 0, 5463, 4276, 4692, 2572, 3454, 4376, 2327, 246,
+    85, 5194, 0, 0, 3902, 6123, 0, 4068, 4226, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 203, 0, 0, 6712, 4224, 3091, 4556, 3669, 4210, 1661,
+    0, 0, 6197, 3168, 0, 0, 3205, 0, 4988, 0, 0, 0, 0, 0, 0, 0,
+    0, 7368, 5936, 0, 0, 2348, 0, 0, 0, 0, 0, 5167, 5969, 2069, 6744, 5767,
+    0, 0, 0, 7109, 0, 0, 0, 5323, 0, 0, 0, 4159, 2981, 0, 0, 0,
+    0, 0, 0, 5764, 5751, 6290, 0, 0, 0, 4421, 0, 0, 0, 3591, 0, 0,
+    1973, 3514, 5163, 0, 5552, 5082, 7321, 6725, 0, 0, 3481, 1892, 5114, 4886, 0, 0,
+    2841, 4657, 0, 6143, 0, 0, 0, 6097, 0, 2806, 4053, 6997, 6969, 0, 0, 0,
+    0, 0, 3279, 4427, 0, 0, 0, 0, 4836, 6619, 0, 0, 0, 0, 0, 0,
+    2398, 0, 0, 0, 0, 0, 0, 2601, 0, 0, 0, 2895, 0, 0, 3741, 0,
+    0, 0, 5823, 0, 0, 0, 0, 0, 0, 2918, 4652, 2465, 0, 0, 4823, 6587,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7224, 0, 0, 0, 5328, 7047, 0,
+    0, 0, 0, 0, 1985, 0, 2856, 0, 4854, 0, 6543, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5228, 0, 0, 0, 7019, 0, 0, 6805, 2150, 0, 3971,
+    2502, 6694, 4474, 6191, 0, 0, 0, 0, 0, 0, 0, 2544, 0, 2823, 0, 6731,
+    2658, 7304, 0, 3859, 0, 0, 3631, 0, 6565, 136, 0, 0, 0, 0, 0, 0,
+    0, 0, 3359, 0, 0, 0, 0, 0, 1706, 0, 5446, 0, 0, 0, 0, 0,
+    0, 0, 0, 6858, 0, 3056, 0, 7271, 2579, 2285, 0, 3349, 0, 5277, 4253, 6875,
+    0, 7149, 4625, 0, 0, 0, 0, 6027, 0, 64, 0, 3109, 3752, 2569, 2027, 6525,
+    0, 0, 0, 3866, 0, 0, 1826, 2831, 7379, 118, 7351, 6331, 6464, 5211, 6598, 5171,
+    0, 2764, 0, 0, 4704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4970, 0, 0, 2343, 0, 0, 0, 0, 0, 0, 0, 0, 5718,
+    0, 3001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4807, 6689, 2908, 3224,
+    6170, 6018, 5429, 0, 0, 0, 0, 0, 0, 1968, 5305, 0, 0, 0, 0, 7201,
+    0, 6980, 0, 0, 0, 2995, 0, 0, 0, 2057, 0, 0, 5601, 3450, 2956, 4688,
+    0, 4200, 7097, 6684, 0, 0, 2780, 0, 149, 0, 1780, 5105, 0, 0, 0, 6351,
+    0, 0, 0, 0, 0, 2518, 2931, 0, 0, 0, 0, 0, 0, 3090, 0, 3269,
+    173, 2128, 0, 3792, 6196, 0, 6513, 7277, 3771, 0, 0, 0, 3303, 0, 0, 0,
+    0, 0, 0, 0, 3199, 7362, 0, 1613, 0, 0, 7174, 0, 6953, 3677, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3948, 6247, 3074, 3132, 7244, 2980, 6495, 0,
+    0, 0, 5417, 0, 0, 0, 0, 4464, 0, 0, 4415, 0, 6226, 0, 3587, 0,
+    7142, 0, 6920, 1972, 1839, 0, 5148, 7315, 0, 0, 0, 3849, 3287, 3477, 107, 6575,
+    3417, 0, 5099, 4267, 0, 0, 0, 2754, 4093, 6094, 2452, 4052, 0, 4964, 0, 4045,
+    0, 0, 0, 0, 0, 3278, 2248, 0, 0, 0, 4832, 0, 2221, 0, 0, 0,
+    3729, 0, 2395, 6149, 0, 0, 0, 0, 0, 0, 7005, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6657, 3543, 0, 0, 5808, 0, 0, 3704, 0, 0, 0, 0,
+    2192, 3054, 4082, 5138, 4774, 6447, 0, 1726, 2282, 2985, 0, 4397, 4819, 0, 0, 0,
+    4589, 0, 7043, 0, 0, 0, 0, 0, 2880, 62, 4032, 0, 0, 2855, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7255, 7232, 0, 281, 5193, 0, 0, 5153, 0,
+    6693, 3886, 4470, 0, 0, 0, 0, 2481, 4864, 0, 0, 0, 0, 0, 0, 0,
+    0, 202, 5951, 3293, 0, 3855, 0, 0, 2656, 0, 0, 6561, 0, 0, 2999, 6425,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4183, 0, 0, 6124, 1689,
+    5411, 0, 0, 0, 0, 0, 2332, 0, 0, 0, 0, 0, 0, 7090, 0, 5057,
+    4249, 3332, 6869, 0, 0, 6406, 0, 0, 0, 0, 6521, 222, 0, 4795, 0, 4609,
+    1897, 0, 5345, 0, 0, 4517, 146, 0, 2197, 1764, 6458, 5040, 3996, 5281, 6005, 7185,
+    7157, 4951, 4873, 0, 0, 0, 0, 4385, 0, 0, 0, 2207, 0, 0, 0, 0,
+    0, 6887, 0, 0, 0, 4161, 0, 0, 2342, 6608, 3711, 3577, 0, 0, 0, 6341,
+    0, 0, 3242, 5855, 0, 0, 0, 0, 0, 0, 1670, 4287, 33, 1937, 3516, 5516,
+    0, 0, 6167, 0, 0, 0, 0, 3992, 0, 0, 1680, 4142, 7461, 0, 5943, 5663,
+    0, 0, 0, 3026, 0, 0, 4451, 0, 0, 0, 0, 5640, 0, 0, 5600, 245,
+    0, 0, 50, 5586, 4974, 4194, 0, 0, 3936, 0, 0, 3828, 0, 0, 6483, 0,
+    5096, 5833, 0, 0, 3778, 2379, 2020, 2517, 0, 0, 0, 4482, 0, 0, 0, 4696,
+    0, 0, 0, 0, 0, 0, 0, 0, 1752, 103, 7273, 3770, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5624, 0, 0, 0, 0, 0, 0, 0, 0, 4947, 7168,
+    0, 0, 0, 0, 6546, 0, 0, 0, 0, 2277, 0, 0, 3233, 0, 2174, 7240,
+    3130, 6383, 1705, 7063, 5416, 2640, 0, 0, 4361, 2794, 0, 0, 0, 0, 0, 0,
+    4457, 0, 7136, 2560, 4943, 4591, 3981, 210, 6780, 0, 0, 1831, 0, 0, 0, 0,
+    4894, 2144, 0, 0, 6435, 3510, 3413, 3835, 0, 2236, 3687, 0, 0, 0, 2731, 0,
+    4044, 0, 0, 0, 0, 0, 6266, 7325, 0, 0, 0, 0, 3485, 2233, 2220, 2324,
+    0, 5905, 0, 0, 0, 0, 0, 0, 0, 6100, 0, 0, 7001, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 6651, 1871, 2415, 0, 0, 0, 0, 0, 0,
+    2717, 6668, 5288, 3640, 0, 0, 4770, 0, 0, 4393, 0, 0, 2180, 0, 0, 0,
+    5537, 7118, 0, 0, 0, 0, 0, 0, 0, 0, 4171, 4028, 0, 0, 1895, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5720, 82, 0, 5008, 7051, 7074, 6154, 0,
+    0, 4933, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 0,
+    6804, 1981, 0, 0, 7393, 5948, 0, 3656, 0, 5533, 0, 6983, 0, 0, 5706, 3151,
+    0, 6421, 0, 0, 0, 5846, 0, 0, 3452, 4274, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6121, 0, 0, 2939, 2900, 2329, 1677, 0, 0, 0, 0, 0, 0,
+    0, 2120, 4572, 0, 0, 0, 0, 6402, 0, 0, 0, 3813, 0, 1925, 3098, 0,
+    0, 0, 2965, 0, 4560, 4513, 0, 2736, 0, 0, 1653, 0, 3171, 0, 7431, 5815,
+    4991, 0, 2087, 2721, 4711, 0, 0, 0, 0, 2066, 6529, 0, 6132, 0, 304, 7106,
+    0, 2205, 0, 5170, 0, 0, 4157, 6747, 0, 0, 3710, 0, 6468, 0, 0, 0,
+    0, 6335, 0, 0, 5921, 4418, 0, 0, 0, 3240, 0, 0, 5161, 3512, 5968, 2814,
+    3180, 6723, 0, 0, 4339, 3594, 0, 0, 0, 0, 3230, 0, 0, 4138, 5085, 5628,
+    0, 4114, 0, 0, 0, 0, 0, 0, 5388, 0, 0, 0, 0, 0, 0, 2265,
+    0, 0, 2808, 4564, 6972, 5585, 0, 0, 0, 49, 2769, 0, 5963, 71, 4885, 0,
+    6623, 4839, 0, 6371, 0, 0, 0, 278, 0, 0, 2682, 2364, 0, 0, 6934, 0,
+    0, 2744, 0, 0, 4204, 6230, 0, 3745, 0, 0, 4821, 6584, 2306, 0, 0, 0,
+    0, 0, 0, 4655, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6540, 0, 0, 0, 0, 0, 2276, 0, 0, 5726,
+    5242, 0, 0, 0, 0, 7059, 0, 0, 0, 0, 4357, 2793, 0, 0, 0, 7026,
+    0, 0, 0, 0, 268, 0, 0, 4590, 3975, 0, 4542, 4442, 0, 1859, 4928, 0,
+    0, 0, 3161, 0, 0, 0, 4879, 0, 0, 0, 6113, 0, 0, 0, 1760, 0,
+    0, 3623, 6568, 0, 0, 0, 0, 0, 5089, 0, 0, 0, 0, 6202, 0, 0,
+    0, 0, 5902, 7269, 3421, 0, 0, 0, 0, 6872, 135, 4251, 0, 0, 6032, 4622,
+    0, 0, 0, 0, 3352, 0, 0, 0, 4639, 0, 2474, 182, 0, 0, 0, 0,
+    2413, 0, 2716, 0, 5068, 4918, 0, 5470, 0, 0, 0, 0, 0, 0, 0, 5262,
+    2850, 0, 7114, 2165, 0, 7355, 3957, 2798, 0, 0, 6312, 6945, 2869, 0, 0, 0,
+    0, 5795, 0, 0, 0, 2734, 3493, 4681, 0, 0, 0, 5717, 4401, 0, 0, 4973,
+    0, 189, 2084, 4058, 0, 0, 0, 4804, 0, 0, 0, 4036, 0, 3584, 0, 0,
+    0, 0, 0, 0, 0, 5303, 6692, 1966, 2454, 2411, 2523, 7199, 3655, 6977, 0, 0,
+    0, 5703, 0, 0, 0, 5657, 0, 0, 0, 0, 3448, 0, 0, 2811, 0, 6682,
+    0, 0, 0, 0, 2389, 0, 0, 0, 2055, 0, 0, 0, 2899, 4539, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 284, 0, 3809, 0, 221,
+    0, 0, 0, 0, 0, 4327, 0, 0, 2779, 5745, 0, 0, 1773, 2131, 6517, 7280,
+    0, 5061, 0, 0, 0, 0, 1887, 3464, 0, 2679, 0, 0, 0, 0, 6131, 0,
+    0, 0, 0, 6083, 3681, 3945, 6956, 4521, 7242, 6492, 0, 0, 0, 0, 0, 0,
+    0, 0, 6250, 4462, 0, 0, 3198, 4412, 0, 1612, 5872, 7139, 0, 0, 6918, 0,
+    0, 0, 5146, 0, 5966, 3590, 0, 3847, 0, 0, 3927, 0, 5680, 5818, 0, 0,
+    0, 4110, 0, 0, 0, 0, 2450, 0, 0, 6558, 0, 0, 0, 0, 0, 0,
+    0, 2262, 0, 0, 0, 4563, 0, 0, 4529, 0, 0, 0, 0, 0, 5960, 3286,
+    0, 0, 0, 4835, 5402, 0, 0, 4876, 0, 0, 0, 0, 2446, 0, 0, 0,
+    0, 0, 0, 6062, 6794, 0, 0, 0, 0, 0, 6186, 5135, 4817, 2190, 6007, 2598,
+    4772, 6444, 0, 0, 3708, 0, 0, 0, 0, 0, 2920, 1733, 4586, 0, 0, 0,
+    0, 0, 0, 0, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3189, 0, 5022, 0, 0, 5442, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7022, 7236, 3127, 0, 0, 5605, 3893, 3046, 6839, 0, 209, 5578, 4541, 0, 7454,
+    0, 3160, 0, 0, 2078, 6499, 3438, 0, 0, 0, 4365, 0, 0, 0, 0, 0,
+    1821, 0, 0, 0, 6564, 0, 0, 4180, 6428, 2652, 0, 3563, 0, 0, 6300, 0,
+    0, 0, 0, 0, 0, 0, 3338, 0, 0, 7088, 6866, 2436, 4247, 0, 0, 0,
+    6404, 133, 0, 0, 0, 0, 0, 0, 3335, 0, 4633, 0, 0, 2473, 0, 0,
+    0, 1688, 2371, 0, 0, 4793, 2126, 0, 0, 3221, 0, 6003, 0, 5421, 0, 0,
+    5042, 0, 0, 0, 0, 5213, 5285, 0, 0, 0, 7161, 3953, 6941, 0, 0, 0,
+    4389, 0, 0, 5792, 5339, 0, 6894, 0, 4680, 0, 1763, 5312, 0, 0, 4164, 5266,
+    0, 5999, 7122, 0, 0, 0, 0, 0, 6345, 1934, 31, 0, 0, 0, 0, 0,
+    0, 0, 1674, 4290, 0, 4140, 3519, 0, 7459, 3570, 3690, 2453, 0, 0, 5503, 0,
+    3995, 4449, 0, 0, 0, 0, 0, 5654, 5945, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3826, 0, 0, 0, 0, 0, 0, 0, 5394, 0, 0,
+    5928, 0, 0, 0, 0, 2752, 4813, 6475, 0, 0, 5835, 3117, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4700, 2954, 0, 0, 3915, 0, 0, 0, 198, 0,
+    0, 106, 7276, 40, 0, 0, 0, 0, 0, 3463, 2019, 0, 4262, 3400, 0, 3305,
+    0, 0, 0, 0, 0, 6082, 0, 4950, 0, 0, 2172, 7238, 0, 5989, 6380, 7061,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7133, 3196, 2643, 1610,
+    4941, 6778, 3978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3186,
+    3507, 1805, 5803, 0, 0, 0, 3685, 0, 0, 0, 0, 5124, 0, 0, 0, 6418,
+    0, 0, 5459, 0, 0, 5591, 4371, 4237, 2323, 2559, 0, 4528, 7337, 0, 0, 6119,
+    0, 0, 4015, 0, 0, 3284, 5399, 3489, 0, 0, 0, 0, 2631, 3373, 0, 0,
+    0, 0, 2431, 3664, 1868, 6059, 0, 0, 4209, 20, 0, 1656, 6665, 0, 5286, 0,
+    0, 0, 6006, 4768, 0, 2490, 0, 0, 0, 0, 3644, 0, 5932, 5784, 0, 1729,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 300, 2108, 4154, 0, 0, 0, 0, 5407, 0, 0, 0, 0, 5750,
+    0, 0, 5722, 0, 0, 0, 0, 0, 3889, 7055, 6835, 2532, 0, 0, 0, 3035,
+    7450, 0, 0, 0, 0, 0, 95, 6498, 0, 0, 1984, 5705, 0, 6139, 0, 0,
+    1956, 7030, 0, 0, 5535, 6987, 0, 0, 0, 0, 6424, 0, 4869, 0, 0, 0,
+    4277, 2937, 0, 0, 0, 0, 3455, 0, 0, 0, 2435, 0, 3649, 0, 0, 0,
+    0, 0, 6400, 2633, 0, 0, 0, 3811, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 180, 1651, 0, 1917, 5496, 5376, 0, 0, 0, 0,
+    0, 0, 0, 2114, 7219, 5327, 0, 4993, 3081, 7435, 5817, 0, 0, 0, 0, 232,
+    0, 0, 2070, 0, 0, 6533, 0, 7110, 0, 6890, 5324, 0, 1646, 5311, 0, 6754,
+    4160, 37, 0, 7397, 0, 5217, 4710, 0, 0, 3961, 6339, 5984, 0, 0, 3014, 0,
+    2374, 4336, 0, 0, 0, 5164, 3515, 0, 6726, 4136, 5083, 264, 3689, 4112, 0, 0,
+    3626, 3553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 0, 0, 0, 0,
+    0, 6970, 0, 0, 0, 0, 0, 0, 5524, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5879, 3323, 5562, 5273, 0, 0, 0, 5382, 0, 4764, 6363, 0,
+    2896, 0, 0, 3742, 4344, 0, 0, 6937, 2305, 0, 0, 0, 2768, 3759, 2929, 1943,
+    1793, 3107, 4824, 6588, 0, 0, 0, 0, 6321, 2567, 0, 0, 0, 0, 2017, 3399,
+    0, 0, 0, 3830, 0, 1635, 4207, 2619, 0, 0, 0, 0, 0, 0, 5988, 5240,
+    0, 7057, 0, 0, 0, 0, 0, 0, 5714, 0, 0, 5891, 0, 0, 0, 0,
+    0, 0, 0, 0, 3972, 0, 4926, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1851, 0, 0, 0, 0, 0, 0, 4743, 3621, 6627, 5747, 0,
+    0, 0, 0, 0, 0, 0, 2014, 0, 90, 0, 2176, 3445, 4370, 7092, 6390, 7333,
+    2557, 0, 0, 0, 0, 4014, 0, 0, 0, 0, 0, 0, 6107, 3425, 0, 3369,
+    0, 4254, 6876, 3616, 0, 4636, 0, 3089, 0, 1655, 5088, 0, 0, 0, 0, 6195,
+    5066, 4915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5931,
+    7352, 0, 0, 0, 0, 0, 6309, 6943, 0, 0, 7369, 0, 0, 5356, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2979, 0, 5797, 0, 0, 1737, 0, 0,
+    0, 0, 4126, 0, 5719, 0, 4405, 2886, 3582, 1971, 0, 0, 256, 6910, 6291, 0,
+    0, 4808, 0, 4040, 0, 0, 0, 0, 4675, 3472, 0, 0, 5702, 0, 3258, 0,
+    1969, 5656, 1955, 0, 6090, 4051, 0, 6981, 0, 0, 0, 0, 3897, 0, 0, 3277,
+    0, 0, 0, 0, 0, 2053, 0, 3451, 4537, 6685, 3648, 0, 0, 2391, 3605, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3807, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3270, 0, 0, 0, 0, 0, 2049, 0, 0, 3177, 0, 4319,
+    0, 3314, 0, 0, 0, 5232, 0, 0, 0, 2099, 5065, 7038, 0, 0, 0, 0,
+    0, 0, 3678, 3052, 0, 0, 0, 0, 0, 288, 0, 0, 0, 3949, 0, 0,
+    6496, 7245, 1629, 5046, 4525, 6750, 0, 7203, 5152, 6257, 60, 2507, 4465, 4701, 0, 0,
+    3013, 0, 0, 0, 6077, 3924, 2359, 6921, 6898, 5149, 0, 0, 0, 0, 2672, 4108,
+    3850, 0, 3625, 0, 0, 6556, 0, 5673, 0, 0, 0, 0, 0, 0, 160, 126,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5521, 0, 0, 0, 2997,
+    0, 0, 2585, 0, 0, 0, 3322, 0, 2444, 0, 6859, 4244, 5561, 7411, 0, 6060,
+    5367, 0, 0, 0, 4343, 0, 2039, 4670, 0, 2499, 0, 7009, 0, 6797, 0, 3753,
+    0, 0, 0, 197, 4820, 5139, 1941, 2193, 6448, 4775, 0, 6317, 0, 4731, 0, 0,
+    0, 0, 0, 0, 144, 3087, 0, 0, 1634, 1755, 0, 0, 0, 1600, 5020, 0,
+    0, 0, 2341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7233, 5890,
+    0, 0, 0, 0, 0, 6837, 2308, 0, 3260, 5510, 0, 0, 0, 3158, 0, 0,
+    0, 0, 0, 1998, 0, 7457, 5580, 2977, 0, 0, 0, 0, 0, 0, 0, 4904,
+    0, 0, 0, 0, 4369, 0, 0, 3561, 230, 89, 5251, 6818, 5599, 2161, 4184, 7091,
+    0, 0, 3797, 3931, 0, 4434, 6478, 3431, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2516, 6072, 1820, 4250, 6870, 4630, 0, 2609, 0, 6407, 0, 6279, 0, 3274, 0,
+    5086, 0, 2124, 4791, 0, 3769, 0, 0, 0, 0, 2373, 0, 0, 0, 0, 0,
+    0, 5282, 0, 0, 2406, 0, 7158, 0, 6939, 0, 0, 0, 7363, 0, 0, 5353,
+    0, 7175, 0, 0, 0, 0, 0, 0, 0, 4787, 3220, 0, 5794, 5997, 0, 5415,
+    0, 0, 0, 0, 0, 6342, 0, 5270, 4098, 0, 0, 0, 7126, 0, 2157, 6906,
+    6227, 6770, 1938, 34, 0, 4297, 2252, 0, 4674, 0, 2553, 2143, 0, 0, 3408, 4660,
+    6177, 7444, 4143, 5653, 0, 0, 2876, 0, 0, 0, 4043, 4452, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2219, 0, 0, 0, 5488, 0, 3829, 2750,
+    3604, 0, 0, 6473, 0, 0, 6991, 0, 0, 5930, 0, 0, 0, 0, 0, 0,
+    5841, 0, 0, 4697, 0, 0, 0, 0, 0, 0, 0, 0, 3115, 2576, 6658, 0,
+    0, 2034, 0, 0, 0, 3907, 2949, 0, 4083, 4231, 0, 7288, 0, 0, 0, 0,
+    0, 0, 0, 0, 2859, 0, 4023, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7241, 2175, 0, 0, 0, 6384, 7064, 4997, 6847, 2506, 6253, 0, 3393, 1885,
+    0, 0, 0, 0, 0, 0, 6076, 0, 0, 4944, 0, 2827, 6758, 6781, 3148, 1802,
+    2338, 2661, 0, 0, 0, 0, 0, 5122, 0, 0, 2593, 6416, 0, 0, 0, 3688,
+    0, 0, 0, 0, 0, 0, 1716, 0, 5464, 0, 0, 6117, 0, 0, 236, 0,
+    0, 2325, 3486, 2584, 0, 7340, 0, 5802, 2629, 3371, 0, 5053, 0, 5118, 2429, 0,
+    6057, 6397, 0, 0, 0, 5590, 0, 1882, 1920, 2038, 23, 0, 1872, 7008, 0, 0,
+    0, 3876, 4508, 0, 6669, 4008, 0, 5289, 0, 7421, 0, 4771, 0, 6641, 3096, 0,
+    2514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2707, 0,
+    4152, 2106, 0, 3766, 0, 2648, 0, 0, 0, 6325, 0, 0, 0, 0, 5778, 5917,
+    0, 0, 0, 0, 7052, 0, 6833, 2530, 0, 0, 0, 0, 2293, 5507, 0, 0,
+    0, 0, 0, 0, 0, 0, 1994, 4133, 7453, 0, 0, 0, 0, 5406, 0, 0,
+    0, 0, 0, 5707, 0, 0, 0, 0, 0, 0, 7034, 3228, 5031, 6814, 5584, 0,
+    5202, 6706, 0, 0, 0, 3930, 0, 0, 6477, 2140, 0, 0, 3387, 6366, 2940, 0,
+    0, 0, 4500, 0, 0, 0, 0, 0, 1819, 0, 0, 0, 0, 4868, 6403, 0,
+    3814, 0, 6215, 0, 1915, 0, 0, 2216, 0, 0, 0, 0, 0, 0, 0, 1654,
+    0, 0, 0, 0, 6880, 7432, 3060, 3565, 0, 0, 0, 0, 0, 2289, 0, 0,
+    0, 6530, 7169, 0, 0, 0, 0, 3083, 1644, 3135, 69, 5238, 5481, 6547, 2275, 4752,
+    3218, 0, 0, 5982, 4352, 2792, 0, 6336, 0, 7401, 0, 0, 0, 5913, 5221, 0,
+    0, 1816, 3965, 1854, 6766, 5178, 3022, 0, 3527, 4340, 0, 4293, 0, 0, 5126, 6733,
+    0, 4659, 4139, 3214, 0, 0, 4115, 0, 4071, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 303, 0, 2266, 0, 0, 0, 0, 0, 6049, 0, 0, 5898, 0, 0,
+    5439, 6183, 0, 0, 0, 0, 0, 0, 0, 0, 6361, 0, 0, 0, 0, 0,
+    5881, 6935, 5838, 0, 0, 0, 0, 0, 2927, 3756, 0, 0, 2715, 0, 4848, 6652,
+    0, 0, 0, 2307, 0, 0, 0, 0, 5556, 5258, 5012, 0, 4758, 1785, 0, 0,
+    6356, 0, 0, 0, 0, 0, 2858, 1907, 0, 0, 0, 0, 0, 0, 0, 0,
+    4495, 2930, 0, 0, 5713, 5243, 0, 7298, 0, 0, 7060, 0, 4932, 0, 0, 0,
+    0, 3392, 0, 0, 2733, 2485, 0, 0, 0, 0, 0, 0, 0, 2826, 0, 4929,
+    1849, 0, 252, 3654, 0, 15, 0, 4740, 0, 6625, 6261, 5699, 5885, 0, 0, 0,
+    0, 0, 0, 0, 0, 3443, 3624, 0, 1715, 3073, 5461, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7336, 1844, 0, 0, 3422, 0, 3367, 2810, 0, 3614, 6592,
+    0, 0, 0, 5103, 0, 0, 0, 0, 3804, 0, 1919, 267, 4640, 5581, 4322, 4222,
+    0, 0, 0, 3875, 0, 0, 4007, 0, 4919, 5069, 7415, 4000, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7366, 0, 2211, 6130, 0, 0, 0, 0, 6313, 6946,
+    0, 0, 0, 0, 0, 0, 6677, 0, 0, 187, 0, 0, 0, 0, 0, 0,
+    4402, 273, 0, 5916, 5763, 5868, 1741, 0, 6908, 6288, 0, 0, 0, 0, 4419, 4037,
+    0, 0, 3585, 0, 2272, 0, 0, 5676, 0, 2884, 0, 0, 0, 0, 4105, 0,
+    0, 0, 0, 0, 2789, 5704, 2839, 0, 0, 0, 5658, 2258, 5616, 0, 4562, 2110,
+    4982, 3901, 54, 6702, 0, 0, 0, 0, 0, 5954, 0, 5108, 0, 2056, 0, 6365,
+    0, 0, 4540, 2397, 0, 4499, 0, 0, 0, 4485, 0, 0, 0, 0, 0, 0,
+    0, 0, 3810, 0, 0, 4866, 2047, 0, 0, 0, 2917, 4317, 3313, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5062, 0, 0, 0, 0, 3548, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6541, 0, 2712, 3134, 4522, 7309, 1627, 3176,
+    1902, 5432, 0, 0, 0, 0, 0, 5226, 0, 0, 0, 0, 7017, 5050, 0, 0,
+    4958, 7207, 3045, 5864, 1853, 5378, 4472, 3020, 0, 0, 0, 0, 0, 3928, 2542, 4906,
+    0, 6729, 6902, 5672, 0, 0, 3857, 0, 3723, 4111, 0, 2865, 0, 0, 0, 6559,
+    0, 0, 0, 0, 3357, 6295, 2263, 0, 2358, 0, 0, 4301, 3537, 0, 0, 0,
+    0, 2614, 0, 6180, 0, 0, 6856, 4242, 0, 5667, 0, 1685, 0, 0, 0, 0,
+    0, 159, 0, 0, 2497, 4623, 0, 2472, 0, 6795, 0, 3750, 2419, 0, 0, 0,
+    0, 3104, 0, 0, 0, 0, 0, 0, 0, 5555, 116, 7377, 0, 0, 5541, 5209,
+    0, 0, 2354, 0, 2762, 0, 4729, 3783, 1906, 0, 0, 0, 0, 4309, 5788, 0,
+    0, 0, 0, 2010, 0, 0, 4437, 5023, 0, 7292, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2484, 6102, 0, 0, 0, 1754, 0, 0, 6840, 1996,
+    0, 0, 5579, 7455, 0, 0, 317, 0, 0, 0, 0, 4902, 0, 3236, 0, 5884,
+    4366, 5650, 0, 0, 5850, 0, 291, 6816, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4432, 3564, 0, 4603, 2904, 0, 0, 0, 0, 0, 0, 1836, 0, 0, 0,
+    0, 4898, 0, 0, 6452, 2607, 0, 0, 0, 0, 2240, 0, 2969, 2845, 0, 4634,
+    4321, 2160, 0, 0, 3910, 3790, 6271, 5908, 0, 0, 2127, 0, 4794, 0, 297, 3999,
+    0, 0, 0, 3462, 0, 0, 0, 0, 7360, 0, 2210, 3254, 7172, 0, 0, 6081,
+    0, 6942, 0, 0, 0, 0, 0, 4785, 6673, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5267, 3245, 0, 0, 2405, 5867, 7123, 6904, 2155, 0, 4413, 5972, 6768, 6224,
+    0, 0, 7140, 0, 0, 0, 0, 0, 0, 5675, 4188, 0, 0, 0, 0, 5504,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4091, 0, 5655, 6165, 0, 3184,
+    0, 3043, 0, 53, 4527, 2095, 0, 0, 2246, 0, 0, 0, 0, 0, 0, 4888,
+    0, 0, 5395, 0, 2692, 7410, 0, 2394, 2753, 0, 0, 4484, 7003, 0, 6476, 6055,
+    0, 0, 0, 6240, 0, 0, 0, 0, 3113, 2575, 6655, 0, 0, 2032, 0, 3150,
+    0, 3905, 0, 0, 4229, 4080, 0, 1724, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4587, 0, 2469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5018,
+    0, 0, 0, 0, 0, 3174, 0, 2741, 0, 7253, 0, 0, 0, 0, 5191, 0,
+    0, 0, 5001, 3884, 4611, 4468, 2091, 6830, 0, 0, 4862, 0, 5770, 0, 0, 5363,
+    2077, 4666, 0, 0, 0, 1806, 0, 0, 3853, 3719, 6762, 0, 0, 0, 0, 0,
+    0, 5125, 0, 0, 6419, 6294, 0, 0, 0, 0, 0, 0, 301, 0, 3531, 0,
+    7338, 6737, 0, 0, 0, 0, 2434, 0, 5116, 139, 0, 2592, 0, 6395, 0, 0,
+    5632, 2632, 3374, 0, 0, 157, 0, 0, 1709, 0, 0, 0, 0, 0, 2418, 0,
+    0, 3066, 0, 0, 5343, 5492, 0, 0, 0, 0, 0, 0, 2195, 5038, 0, 0,
+    0, 5540, 7425, 6644, 7183, 0, 0, 0, 0, 0, 0, 2686, 0, 0, 0, 4308,
+    0, 0, 3869, 6885, 0, 0, 5310, 0, 2709, 2109, 0, 7387, 2743, 0, 6606, 4155,
+    0, 0, 3426, 0, 6329, 0, 0, 0, 0, 0, 0, 0, 0, 6067, 0, 0,
+    6836, 36, 2647, 2533, 0, 1992, 4131, 7451, 0, 0, 0, 0, 0, 0, 0, 5737,
+    0, 0, 0, 0, 0, 0, 5849, 7031, 0, 6812, 0, 0, 0, 6704, 2292, 0,
+    0, 0, 0, 2903, 0, 0, 0, 4599, 0, 0, 0, 4554, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4883, 0, 0, 0, 0, 0, 0, 2958, 0,
+    0, 0, 5196, 0, 2844, 0, 3909, 265, 0, 0, 1788, 1750, 0, 0, 1918, 6207,
+    0, 5377, 280, 0, 4280, 2549, 0, 0, 2288, 6037, 3398, 0, 0, 6156, 7166, 4644,
+    0, 0, 0, 0, 6544, 0, 67, 5236, 0, 5987, 4750, 0, 0, 0, 0, 0,
+    3201, 7398, 0, 1647, 1616, 5474, 1703, 2622, 0, 0, 5218, 0, 5176, 2403, 5971, 3962,
+    0, 6764, 0, 0, 7134, 5915, 0, 0, 3979, 0, 0, 5827, 0, 2873, 0, 0,
+    0, 0, 0, 0, 0, 0, 3508, 6617, 0, 0, 0, 0, 0, 3004, 0, 0,
+    0, 2729, 2945, 4575, 4063, 0, 0, 0, 0, 0, 0, 7323, 2231, 3290, 2074, 2699,
+    4013, 0, 0, 0, 0, 0, 0, 0, 0, 3364, 2464, 0, 7216, 0, 0, 6999,
+    0, 0, 0, 6364, 6239, 172, 0, 0, 0, 0, 4846, 6649, 0, 6043, 0, 0,
+    3760, 0, 0, 314, 0, 152, 0, 0, 1783, 3144, 0, 6354, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5451, 0, 0, 0, 0, 0, 5006, 80, 0, 0, 0, 5715, 1778,
+    7302, 0, 7072, 0, 0, 0, 3034, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6802, 1877, 0, 5307, 0, 5698, 7263, 1852, 0, 0, 0, 1954, 0, 0,
+    0, 4744, 6628, 6265, 4476, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3446,
+    7334, 1842, 0, 0, 3647, 0, 14, 0, 3861, 0, 6590, 138, 0, 0, 0, 5101,
+    0, 0, 2590, 3802, 0, 3370, 0, 0, 0, 3617, 1708, 5773, 0, 0, 1692, 0,
+    0, 0, 0, 0, 0, 0, 3064, 5491, 0, 0, 0, 0, 0, 0, 3169, 0,
+    0, 0, 0, 4989, 7419, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7370,
+    0, 0, 5357, 0, 3868, 5168, 0, 0, 0, 1767, 0, 6745, 2199, 7381, 0, 6017,
+    6466, 7193, 1738, 0, 0, 0, 4416, 0, 3382, 0, 3012, 0, 0, 0, 0, 0,
+    6911, 6292, 0, 0, 2882, 0, 0, 0, 3592, 2671, 2919, 4103, 2645, 0, 0, 0,
+    0, 3192, 0, 0, 0, 0, 125, 0, 0, 0, 0, 0, 0, 3898, 0, 6700,
+    0, 0, 0, 0, 5515, 289, 0, 5609, 0, 0, 0, 0, 0, 4550, 0, 5962,
+    3321, 0, 4837, 5560, 0, 0, 6511, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255, 4342, 0, 0, 4976, 0, 0, 4202, 2782, 0, 3743, 0, 0, 1787, 1811, 2050,
+    4320, 0, 4279, 0, 4653, 321, 2022, 3496, 3343, 0, 0, 6716, 0, 0, 0, 3210,
+    0, 0, 0, 0, 1633, 0, 0, 0, 6538, 7307, 0, 0, 0, 1900, 0, 0,
+    0, 0, 0, 0, 1630, 3085, 5047, 261, 5889, 1615, 0, 0, 7204, 3547, 4956, 5425,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5866, 3973, 0, 5826, 0, 6899,
+    0, 0, 0, 0, 0, 3721, 0, 0, 0, 0, 0, 6613, 5674, 0, 0, 0,
+    0, 0, 5250, 2563, 6566, 3032, 2975, 5858, 0, 4754, 0, 0, 0, 0, 0, 3289,
+    0, 0, 0, 0, 4305, 3541, 1683, 5666, 0, 0, 3702, 1952, 2461, 0, 0, 6860,
+    4245, 0, 4620, 0, 0, 0, 6274, 3350, 0, 0, 0, 0, 3102, 0, 0, 2500,
+    0, 0, 6028, 2613, 0, 0, 3754, 0, 0, 0, 0, 0, 0, 0, 3272, 0,
+    0, 0, 3781, 4727, 0, 0, 7353, 0, 0, 0, 5349, 2356, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5450, 0, 5790, 0, 0, 0, 0, 0, 0, 0, 0,
+    4971, 0, 0, 7296, 45, 0, 0, 0, 0, 4723, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2009, 0, 0, 0, 1999, 3235, 4217, 3304, 6171, 5649, 6690, 7257,
+    7082, 0, 0, 0, 4905, 0, 0, 0, 0, 3010, 0, 0, 0, 0, 0, 0,
+    4601, 6819, 0, 0, 2668, 0, 0, 0, 1834, 0, 4435, 3603, 12, 0, 0, 4896,
+    0, 6450, 0, 0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 2610, 0,
+    1691, 5758, 6269, 5469, 0, 0, 0, 4383, 0, 0, 2333, 0, 0, 0, 0, 0,
+    3318, 2129, 7278, 5546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2834, 0,
+    0, 7364, 0, 0, 5354, 7176, 0, 6954, 3679, 4214, 1668, 1766, 0, 0, 5297, 4788,
+    0, 6014, 0, 7187, 4713, 6248, 2505, 0, 0, 4410, 0, 0, 7137, 3253, 2383, 0,
+    6075, 2158, 169, 6907, 0, 0, 4186, 6228, 6771, 0, 3731, 3588, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2912, 0, 6163, 0, 0, 0, 0, 0, 0, 0,
+    2336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2583, 0, 0, 0,
+    5489, 5959, 0, 0, 0, 4833, 0, 0, 6507, 5400, 0, 6053, 0, 0, 6150, 0,
+    0, 0, 86, 5222, 0, 7006, 2094, 1602, 2771, 0, 0, 0, 0, 1946, 0, 0,
+    0, 6659, 2691, 3116, 0, 2577, 2035, 0, 2021, 2538, 3908, 0, 6715, 4084, 4232, 4584,
+    3840, 0, 0, 0, 0, 6233, 0, 0, 0, 0, 0, 5016, 0, 0, 0, 0,
+    2512, 0, 0, 2739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4998, 0,
+    2089, 6828, 0, 2600, 0, 7234, 3125, 0, 5331, 0, 0, 0, 0, 0, 0, 0,
+    1989, 0, 0, 4865, 6759, 5772, 0, 3717, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1604, 6809, 6562, 112, 2562, 6426, 2817, 5201, 0, 5362, 0, 2758,
+    0, 0, 0, 4665, 0, 0, 0, 3535, 6741, 0, 6125, 5631, 3698, 0, 0, 0,
+    0, 3638, 5119, 0, 0, 0, 6398, 0, 6273, 2138, 0, 0, 3333, 6210, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2612, 6642, 0, 7422, 0,
+    0, 0, 0, 0, 0, 0, 0, 276, 5283, 0, 0, 0, 0, 7159, 0, 0,
+    0, 0, 0, 2989, 3764, 0, 5337, 5477, 0, 0, 0, 0, 0, 0, 0, 0,
+    6326, 4162, 0, 0, 6609, 7391, 0, 0, 0, 0, 5174, 6343, 0, 0, 0, 4708,
+    0, 0, 0, 3106, 176, 4288, 3517, 0, 5736, 6168, 1995, 2007, 4134, 0, 0, 0,
+    2503, 3993, 7076, 4066, 3785, 0, 0, 0, 0, 0, 3298, 0, 0, 0, 0, 6066,
+    0, 0, 6815, 4597, 0, 0, 6707, 4552, 3667, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5834, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2064, 2580, 6205, 4698, 7104, 4379, 0, 0,
+    0, 0, 0, 104, 7274, 0, 0, 0, 0, 6035, 3061, 0, 0, 0, 0, 0,
+    242, 2290, 0, 0, 0, 0, 7170, 4086, 3094, 4948, 0, 0, 1664, 70, 6548, 6200,
+    5239, 5077, 0, 2242, 1890, 4753, 2548, 4712, 0, 0, 3391, 0, 0, 0, 6141, 0,
+    2382, 2641, 3976, 7131, 5179, 7374, 6964, 2825, 2871, 0, 6767, 3251, 2660, 0, 0, 0,
+    0, 0, 3505, 6615, 0, 0, 0, 0, 2983, 0, 0, 0, 0, 0, 0, 0,
+    4061, 0, 1714, 0, 5457, 0, 3006, 0, 0, 3596, 0, 0, 0, 5821, 1976, 0,
+    0, 7326, 0, 0, 0, 3362, 2462, 5440, 0, 6582, 5397, 3487, 0, 0, 0, 0,
+    0, 0, 0, 0, 220, 6101, 4056, 7002, 5187, 0, 0, 0, 3874, 253, 7222, 1945,
+    308, 4006, 4849, 6653, 0, 4841, 0, 0, 0, 0, 0, 0, 0, 2689, 154, 0,
+    0, 1786, 0, 3839, 0, 6357, 0, 6232, 0, 0, 0, 6189, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1776, 0, 3143, 0, 7299, 0, 0,
+    0, 0, 0, 0, 2317, 0, 0, 0, 0, 0, 0, 7053, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5445, 0, 0, 0, 0, 0, 0, 1982, 0, 0, 6262,
+    5700, 0, 7267, 3051, 0, 0, 5612, 2270, 2184, 5156, 5030, 0, 4480, 7147, 6422, 6697,
+    0, 0, 2788, 0, 3453, 59, 5107, 4275, 0, 4656, 0, 1845, 6122, 0, 0, 4498,
+    3865, 1824, 0, 3634, 6593, 0, 0, 6570, 5104, 0, 5091, 0, 3805, 0, 0, 6209,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7433, 5816, 2996, 0, 0, 0,
+    0, 0, 0, 0, 248, 0, 6531, 4802, 5476, 5634, 271, 6015, 0, 5428, 0, 5322,
+    0, 0, 4158, 0, 0, 0, 7385, 2203, 0, 6469, 190, 7197, 6337, 0, 6975, 208,
+    4420, 0, 0, 0, 0, 0, 0, 5162, 4686, 3513, 0, 0, 0, 3191, 6724, 2885,
+    0, 0, 4106, 143, 0, 4065, 1745, 0, 0, 0, 0, 3381, 0, 0, 0, 0,
+    2259, 0, 0, 5608, 2822, 0, 0, 0, 4548, 6703, 2657, 0, 0, 6174, 5522, 0,
+    0, 0, 6509, 0, 0, 0, 0, 0, 5964, 0, 0, 0, 0, 0, 0, 0,
+    0, 1698, 0, 2894, 0, 0, 3740, 0, 0, 5603, 0, 2060, 0, 0, 0, 7100,
+    4205, 0, 0, 6490, 5554, 4822, 3943, 3341, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2521, 1905, 0, 0, 0, 0, 0, 0, 0, 0, 2724, 0, 0, 0,
+    1810, 0, 2133, 7310, 0, 6542, 1903, 3774, 1889, 7282, 3475, 2227, 4265, 2546, 0, 0,
+    3209, 0, 2483, 0, 4959, 6092, 3970, 7180, 0, 6958, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6611, 0, 6038, 0, 0, 0, 5883, 0, 0, 3724, 0,
+    0, 0, 5419, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5860, 0, 5820,
+    4302, 3538, 0, 0, 5806, 0, 3700, 0, 2459, 0, 2147, 6578, 5668, 0, 3423, 6442,
+    1686, 0, 0, 0, 5002, 5594, 4252, 2968, 0, 4624, 2943, 7041, 4048, 0, 0, 0,
+    0, 0, 0, 2875, 0, 3105, 0, 0, 3998, 0, 2223, 0, 0, 4490, 0, 0,
+    0, 0, 7350, 0, 0, 0, 2209, 5844, 0, 0, 0, 3784, 4730, 6188, 0, 0,
+    0, 0, 0, 6663, 0, 0, 0, 0, 0, 0, 0, 0, 7293, 3244, 0, 5796,
+    43, 0, 3141, 0, 4721, 2316, 0, 0, 0, 4403, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3131, 4178, 4038, 0, 5444, 0, 0, 0, 5410, 0, 0, 0, 0,
+    0, 1967, 3237, 0, 7261, 0, 5651, 0, 5611, 7086, 3166, 6864, 0, 0, 4981, 52,
+    0, 0, 0, 0, 0, 0, 6519, 3449, 4604, 0, 6683, 1875, 0, 0, 0, 2390,
+    1837, 3041, 0, 1823, 0, 4483, 4899, 0, 0, 0, 6453, 0, 6430, 4871, 0, 2241,
+    0, 0, 0, 4381, 0, 0, 296, 0, 0, 0, 0, 0, 6128, 0, 6272, 0,
+    0, 0, 0, 3575, 2335, 0, 0, 0, 0, 0, 0, 0, 5063, 0, 0, 0,
+    0, 0, 5757, 0, 3676, 4212, 1666, 0, 1932, 4798, 0, 3223, 0, 6012, 0, 5427,
+    2802, 0, 4523, 5545, 7243, 179, 0, 0, 0, 5301, 0, 5940, 7191, 4954, 4463, 3024,
+    0, 218, 4414, 0, 0, 0, 0, 7141, 6919, 0, 3095, 0, 0, 0, 0, 5147,
+    4166, 4189, 0, 3848, 0, 3714, 0, 0, 0, 0, 0, 0, 5753, 0, 0, 0,
+    2480, 4649, 2377, 2451, 0, 0, 0, 0, 3521, 0, 0, 0, 5519, 0, 0, 0,
+    0, 0, 0, 0, 0, 6505, 0, 0, 2911, 0, 6148, 5961, 0, 0, 0, 0,
+    0, 7004, 0, 0, 2417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5588,
+    0, 0, 0, 0, 3939, 4818, 3227, 2191, 0, 0, 6486, 5539, 4773, 0, 0, 6378,
+    0, 0, 0, 0, 0, 2966, 0, 0, 4588, 4307, 0, 0, 0, 0, 0, 4455,
+    0, 0, 0, 0, 5019, 0, 1809, 0, 0, 0, 4264, 2537, 2742, 0, 0, 3411,
+    7231, 0, 0, 3833, 2206, 0, 0, 3207, 0, 2092, 6831, 1987, 4863, 0, 0, 0,
+    3345, 6552, 0, 0, 0, 0, 0, 0, 0, 5731, 0, 0, 3241, 6023, 2279, 0,
+    5848, 0, 3720, 6807, 0, 0, 4367, 2796, 0, 0, 0, 0, 0, 0, 0, 0,
+    4594, 2902, 3532, 2819, 1866, 0, 6738, 5805, 3696, 0, 0, 0, 5133, 3636, 0, 0,
+    6438, 0, 0, 0, 0, 5633, 0, 5593, 4391, 111, 4248, 0, 5195, 6405, 0, 4967,
+    0, 2757, 0, 0, 0, 4026, 0, 0, 0, 0, 0, 0, 0, 2372, 0, 0,
+    0, 0, 0, 6004, 4481, 5280, 0, 6152, 7156, 0, 0, 0, 0, 0, 0, 0,
+    2687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2720, 5946, 6607, 5793,
+    0, 7388, 0, 0, 6340, 0, 5172, 0, 5268, 0, 5970, 4706, 0, 0, 7124, 0,
+    0, 0, 0, 0, 224, 32, 0, 4174, 0, 0, 0, 0, 0, 5409, 0, 0,
+    0, 0, 4141, 0, 5738, 0, 5723, 0, 0, 0, 7080, 0, 4570, 4936, 2118, 4450,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4887, 0, 0, 4600, 0, 0, 0,
+    4555, 2732, 3827, 4511, 3659, 0, 0, 0, 0, 6989, 0, 0, 4884, 3297, 2072, 6238,
+    0, 0, 0, 0, 3457, 2062, 4695, 4377, 0, 7102, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6208, 0, 3574, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2414, 0, 3092, 0, 0, 0, 2809, 1662, 1928, 6198, 0, 3179, 0, 4334,
+    0, 0, 0, 0, 0, 0, 7239, 2173, 5081, 0, 5536, 7062, 5937, 5475, 0, 0,
+    0, 3023, 0, 5387, 0, 0, 0, 2833, 0, 7135, 6135, 4942, 0, 3980, 0, 0,
+    6779, 6968, 2874, 0, 279, 0, 0, 0, 0, 0, 0, 0, 6618, 3509, 0, 0,
+    4424, 0, 3686, 2376, 0, 2677, 2362, 0, 6929, 4064, 1974, 0, 0, 7324, 0, 0,
+    0, 0, 0, 3600, 6580, 137, 3484, 5685, 0, 0, 0, 0, 2910, 0, 163, 3365,
+    4054, 6099, 0, 7000, 1707, 0, 0, 0, 0, 0, 0, 0, 285, 0, 0, 0,
+    4567, 3122, 0, 212, 0, 0, 0, 0, 5571, 5287, 0, 2400, 0, 4769, 4845, 0,
+    6374, 0, 0, 0, 0, 0, 4355, 0, 5186, 0, 0, 0, 0, 0, 0, 3867,
+    0, 4454, 0, 0, 0, 0, 4440, 4826, 0, 0, 0, 0, 0, 0, 0, 0,
+    2535, 0, 1779, 0, 3832, 6111, 0, 7050, 1758, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3328, 0, 0, 5728, 0, 0, 7264, 5900,
+    0, 0, 0, 0, 0, 5154, 2311, 0, 5967, 4477, 0, 6695, 0, 7032, 0, 0,
+    0, 0, 0, 3049, 0, 0, 1862, 0, 4545, 0, 0, 0, 3862, 4913, 2938, 3632,
+    0, 0, 5333, 0, 0, 0, 0, 0, 0, 6574, 2178, 2957, 6401, 2848, 7112, 109,
+    0, 0, 3812, 2781, 0, 6307, 2864, 196, 0, 0, 0, 0, 0, 0, 0, 0,
+    1652, 4278, 0, 3491, 0, 0, 7430, 6878, 4256, 6151, 0, 0, 0, 0, 3988, 0,
+    0, 4800, 0, 6528, 0, 3082, 0, 0, 2477, 0, 0, 0, 0, 0, 0, 0,
+    0, 3200, 2200, 7382, 6467, 1614, 7194, 2409, 6334, 6973, 0, 0, 7399, 0, 0, 0,
+    5219, 0, 0, 0, 0, 3963, 0, 0, 5825, 0, 0, 2987, 0, 0, 0, 2344,
+    0, 0, 0, 0, 4684, 4137, 3193, 0, 4113, 0, 0, 0, 0, 4569, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 2264, 0, 3288, 0, 0, 5610, 0, 0, 0,
+    0, 0, 4551, 1608, 2457, 3030, 0, 0, 1744, 0, 0, 6512, 0, 0, 0, 0,
+    0, 0, 3295, 0, 0, 5602, 2058, 0, 0, 0, 7098, 228, 4203, 3744, 3941, 0,
+    0, 0, 6488, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3344, 2519, 0,
+    0, 0, 0, 1697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 259,
+    5449, 4330, 3772, 0, 0, 3922, 0, 0, 5241, 0, 0, 0, 2137, 7286, 7058, 0,
+    0, 0, 0, 5426, 5386, 3467, 0, 0, 0, 0, 0, 0, 0, 0, 2723, 3974,
+    6086, 0, 4927, 6962, 0, 0, 0, 7247, 0, 0, 0, 0, 2226, 0, 6614, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3622, 7145, 2361, 6923, 0, 0, 0, 6789,
+    0, 0, 0, 0, 0, 0, 2145, 6576, 3008, 3420, 6440, 5682, 0, 0, 2596, 3703,
+    0, 162, 0, 0, 0, 0, 186, 0, 4046, 0, 0, 1690, 0, 0, 0, 3069,
+    0, 0, 0, 0, 0, 0, 4532, 120, 0, 3183, 0, 5067, 0, 0, 0, 0,
+    0, 0, 0, 5405, 0, 0, 0, 0, 75, 0, 7354, 2955, 0, 7020, 0, 5350,
+    3316, 5529, 6944, 2778, 0, 0, 1765, 0, 4439, 5291, 0, 6675, 6010, 4777, 0, 4270,
+    3436, 0, 0, 0, 0, 0, 4400, 6110, 1739, 46, 0, 1757, 4724, 0, 0, 0,
+    4035, 4176, 0, 0, 2650, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3197, 7258, 1611, 0, 0, 7083, 0, 6862, 2310, 0, 0, 0, 2296, 0, 0, 0,
+    0, 0, 0, 3899, 0, 4628, 5811, 0, 0, 0, 0, 5953, 0, 0, 0, 0,
+    0, 2081, 6502, 2054, 4538, 0, 0, 0, 5318, 0, 0, 0, 3165, 0, 2847, 0,
+    4975, 2163, 0, 0, 6434, 3951, 0, 3808, 6303, 3285, 0, 0, 4384, 0, 2334, 0,
+    5158, 0, 84, 3490, 0, 0, 6714, 2439, 5060, 6409, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1930, 0, 4796, 0, 0, 0, 0, 1669, 3680, 4215, 4520,
+    0, 0, 0, 0, 5298, 3568, 2408, 5501, 7188, 0, 4952, 0, 0, 0, 5048, 0,
+    0, 0, 7205, 5942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2890, 0,
+    2801, 3712, 0, 0, 6900, 0, 0, 0, 5314, 0, 4170, 4109, 0, 5925, 0, 0,
+    6557, 4811, 0, 0, 2561, 5755, 0, 0, 2261, 0, 0, 0, 0, 0, 0, 0,
+    0, 3525, 0, 0, 4145, 0, 7462, 3693, 0, 0, 0, 0, 0, 6508, 35, 0,
+    0, 0, 0, 4648, 0, 0, 0, 2445, 0, 0, 6061, 5587, 0, 0, 0, 0,
+    0, 0, 3937, 0, 0, 6484, 0, 0, 0, 0, 6376, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1687, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3918, 0, 0, 5021, 0, 1800, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7235, 3403, 0, 5332, 0, 0, 0,
+    193, 4235, 6838, 0, 5730, 1990, 5245, 2278, 3159, 0, 5992, 0, 7066, 0, 0, 0,
+    0, 0, 277, 4364, 0, 0, 0, 0, 0, 0, 0, 0, 4592, 6810, 0, 3984,
+    1864, 2501, 3562, 3662, 18, 6783, 0, 0, 0, 5131, 0, 0, 2595, 6436, 0, 6022,
+    0, 0, 3699, 0, 0, 0, 3639, 0, 5782, 1727, 0, 0, 0, 0, 0, 0,
+    4374, 3068, 0, 0, 0, 0, 0, 0, 0, 5907, 0, 0, 4792, 2125, 0, 0,
+    4018, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2578, 0, 0, 5284, 73, 4966,
+    0, 7160, 0, 3887, 6940, 0, 1659, 0, 6671, 2718, 0, 0, 0, 7445, 0, 0,
+    0, 2018, 3435, 0, 0, 1601, 0, 5265, 6137, 7121, 5998, 2381, 0, 0, 6344, 5175,
+    0, 0, 0, 4172, 4709, 0, 0, 2649, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3265, 0, 0, 0, 0, 7077, 0, 4934, 0, 0, 2295, 0, 0, 5725,
+    0, 0, 0, 3038, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3657,
+    0, 0, 0, 0, 0, 5393, 0, 0, 0, 5708, 0, 2751, 1959, 6474, 7217, 2112,
+    0, 6992, 2558, 3163, 0, 3461, 0, 2770, 0, 0, 1944, 0, 2065, 4699, 4380, 0,
+    0, 0, 7105, 0, 6888, 3652, 0, 0, 0, 5143, 0, 0, 0, 3838, 0, 0,
+    0, 6231, 0, 0, 3816, 0, 0, 1926, 0, 0, 0, 4332, 0, 316, 0, 0,
+    0, 1665, 0, 0, 6201, 5078, 3567, 0, 5498, 0, 3551, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4999, 5939, 0, 6133, 0, 0, 0, 0, 6965, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 200, 0, 0, 6760, 0, 5922, 2984, 0,
+    5876, 4810, 5123, 2183, 0, 5381, 6417, 4762, 0, 0, 0, 3017, 0, 0, 3597, 0,
+    6933, 0, 5684, 1977, 0, 0, 6118, 0, 0, 2675, 4117, 0, 0, 3629, 3488, 6583,
+    0, 0, 0, 0, 2630, 5090, 3372, 0, 129, 4646, 4057, 0, 4565, 2430, 6058, 0,
+    0, 2617, 0, 0, 0, 3281, 0, 0, 0, 0, 4842, 0, 6372, 0, 0, 0,
+    0, 0, 0, 310, 5564, 7423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4347, 0, 3121, 0, 0, 0, 0, 0, 0, 0, 2708, 2107, 4153, 1796, 0,
+    4830, 0, 0, 0, 0, 0, 6327, 4738, 0, 0, 0, 0, 0, 0, 0, 0,
+    7054, 2531, 6834, 2012, 6388, 1638, 4234, 5727, 0, 7328, 0, 0, 0, 0, 0, 2854,
+    0, 0, 0, 0, 0, 0, 0, 6105, 2367, 7029, 5157, 0, 0, 0, 0, 3047,
+    3084, 0, 1860, 0, 4543, 3661, 17, 0, 6698, 0, 3327, 4911, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2821, 0, 3635, 185, 5781, 6571, 0, 0, 0, 0,
+    0, 6305, 0, 0, 5254, 93, 0, 0, 0, 0, 7095, 0, 0, 0, 0, 0,
+    27, 5375, 1916, 2974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4124, 0, 7434,
+    4642, 4260, 6881, 0, 2475, 2767, 0, 6286, 1942, 0, 0, 0, 4803, 6532, 0, 5071,
+    0, 1645, 1888, 3470, 0, 0, 0, 0, 7396, 0, 274, 6136, 5216, 3822, 6088, 5983,
+    6976, 6338, 3987, 3960, 6948, 0, 5914, 0, 0, 0, 0, 3271, 0, 0, 0, 4682,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2346, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5819, 0, 0, 0, 0, 5523,
+    0, 0, 2455, 0, 0, 4678, 0, 0, 0, 0, 0, 0, 0, 6184, 5659, 0,
+    99, 1603, 0, 2169, 7036, 2097, 0, 6362, 0, 0, 0, 0, 0, 0, 0, 5604,
+    2061, 0, 0, 0, 2928, 7101, 4938, 2695, 3944, 0, 6748, 0, 3608, 6491, 0, 0,
+    0, 0, 5087, 0, 0, 0, 0, 2522, 6187, 2636, 0, 0, 0, 4328, 0, 0,
+    0, 3920, 0, 0, 0, 0, 0, 0, 7283, 2134, 0, 3775, 0, 3550, 0, 0,
+    2315, 3465, 0, 7300, 0, 0, 0, 0, 0, 0, 0, 0, 6959, 6084, 0, 0,
+    5443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1850, 0, 0, 0, 7251,
+    6854, 6263, 5380, 3129, 5420, 5271, 6626, 2510, 4761, 0, 0, 5366, 5873, 0, 0, 0,
+    6080, 4668, 0, 3444, 5681, 6927, 0, 0, 6793, 0, 0, 3748, 0, 0, 1822, 0,
+    2148, 6579, 0, 3424, 3368, 6443, 0, 6315, 0, 0, 3615, 0, 0, 0, 0, 0,
+    0, 4049, 4530, 2616, 0, 0, 0, 0, 0, 0, 0, 0, 299, 0, 0, 2224,
+    0, 0, 0, 0, 0, 0, 7417, 0, 0, 0, 0, 0, 0, 6064, 0, 0,
+    0, 5692, 0, 2042, 0, 3222, 5355, 0, 7012, 3119, 6008, 0, 0, 0, 0, 0,
+    0, 0, 5295, 6678, 1736, 0, 0, 4781, 231, 4734, 0, 0, 4404, 0, 0, 0,
+    0, 2011, 0, 5528, 6909, 0, 0, 0, 0, 6387, 4039, 4179, 5025, 0, 3795, 0,
+    0, 1886, 3429, 0, 0, 0, 0, 0, 0, 6104, 0, 3896, 171, 0, 6070, 0,
+    6865, 4626, 0, 0, 0, 0, 6842, 5513, 0, 0, 0, 0, 2079, 0, 6500, 0,
+    2479, 237, 0, 0, 5955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6431, 6301, 0, 0, 0, 0, 0, 7358, 5810, 0, 0, 5205, 0, 0, 0, 0,
+    3934, 2437, 2048, 0, 6481, 0, 4318, 0, 298, 0, 5317, 0, 0, 0, 0, 4123,
+    5064, 0, 0, 0, 4096, 6413, 0, 0, 0, 6282, 0, 0, 6222, 0, 4799, 1933,
+    0, 263, 2251, 0, 2964, 3469, 0, 0, 4263, 1628, 5045, 3406, 4524, 3256, 7202, 7442,
+    0, 6087, 0, 0, 4955, 0, 3986, 0, 0, 0, 0, 0, 0, 5865, 0, 0,
+    6897, 0, 0, 0, 0, 2204, 0, 4167, 5486, 0, 3715, 0, 0, 0, 2301, 0,
+    0, 6348, 0, 0, 5927, 0, 0, 0, 0, 0, 0, 3239, 0, 3522, 0, 0,
+    2889, 5804, 3691, 5520, 0, 3539, 4303, 5129, 0, 0, 0, 0, 4663, 4149, 0, 6181,
+    4243, 5592, 2947, 5230, 4078, 0, 97, 7035, 0, 0, 0, 0, 0, 0, 0, 2498,
+    4021, 0, 0, 0, 5589, 0, 0, 2694, 0, 0, 0, 3940, 6487, 48, 0, 4923,
+    0, 0, 0, 6379, 0, 6251, 0, 0, 0, 0, 0, 0, 2355, 0, 0, 0,
+    0, 0, 3916, 2634, 0, 0, 0, 0, 1798, 3146, 0, 5789, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7294, 3401, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2862, 0, 0, 3219, 0, 0, 5990, 0, 5408, 0, 0, 1997, 0, 0, 5732, 2280,
+    5249, 0, 0, 0, 6850, 7070, 4903, 5051, 0, 0, 4368, 2797, 3396, 5365, 0, 0,
+    0, 1880, 6817, 4667, 0, 0, 4595, 0, 2830, 1867, 0, 6787, 4433, 2664, 0, 4506,
+    0, 0, 5134, 0, 6636, 0, 6439, 0, 0, 4870, 0, 0, 0, 0, 0, 4372,
+    2608, 0, 0, 1719, 0, 5467, 0, 0, 0, 0, 0, 0, 4016, 0, 0, 3573,
+    0, 0, 5909, 0, 0, 0, 3376, 0, 0, 0, 5776, 0, 0, 0, 0, 0,
+    0, 0, 1657, 0, 5506, 1923, 5643, 5352, 5691, 0, 0, 0, 0, 0, 3879, 0,
+    4786, 0, 312, 4011, 0, 7449, 5933, 6674, 0, 0, 0, 244, 0, 0, 5269, 0,
+    0, 0, 0, 7125, 1962, 2156, 6905, 0, 6769, 0, 5526, 0, 4175, 0, 0, 0,
+    3794, 0, 0, 0, 3428, 0, 4261, 0, 0, 3385, 5724, 0, 2375, 0, 0, 0,
+    6069, 0, 4937, 3036, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3264, 0, 0, 0, 0, 3660, 0, 1957, 0, 0, 0, 0, 6990,
+    0, 5710, 0, 0, 0, 0, 0, 5621, 0, 5034, 0, 3458, 0, 0, 5801, 7164,
+    5567, 3650, 287, 3114, 0, 0, 5111, 0, 2033, 0, 6369, 0, 0, 3906, 0, 0
+};
+
+/*
+** The card at each position 0-51 of the init_deck() order.
+*/
+const int index_cards[52] =
+{
+    0x00018202, 0x00028303, 0x00048405, 0x00088507, 0x0010860b, 0x0020870d,
+    0x00408811, 0x00808913, 0x01008a17, 0x02008b1d, 0x04008c1f, 0x08008d25,
+    0x10008e29, 0x00014202, 0x00024303, 0x00044405, 0x00084507, 0x0010460b,
+    0x0020470d, 0x00404811, 0x00804913, 0x01004a17, 0x02004b1d, 0x04004c1f,
+    0x08004d25, 0x10004e29, 0x00012202, 0x00022303, 0x00042405, 0x00082507,
+    0x0010260b, 0x0020270d, 0x00402811, 0x00802913, 0x01002a17, 0x02002b1d,
+    0x04002c1f, 0x08002d25, 0x10002e29, 0x00011202, 0x00021303, 0x00041405,
+    0x00081507, 0x0010160b, 0x0020170d, 0x00401811, 0x00801913, 0x01001a17,
+    0x02001b1d, 0x04001c1f, 0x08001d25, 0x10001e29
+};
+
+/*
+** Sum of quinary[] over the ranks in a 13-bit rank mask m:
+** quinary_lo[m & 0x7f] + quinary_hi[m >> 7].
+*/
+const unsigned quinary_lo[128] =
+{
+    0, 1, 5, 6, 25, 26, 30, 31,
+    125, 126, 130, 131, 150, 151, 155, 156,
+    625, 626, 630, 631, 650, 651, 655, 656,
+    750, 751, 755, 756, 775, 776, 780, 781,
+    3125, 3126, 3130, 3131, 3150, 3151, 3155, 3156,
+    3250, 3251, 3255, 3256, 3275, 3276, 3280, 3281,
+    3750, 3751, 3755, 3756, 3775, 3776, 3780, 3781,
+    3875, 3876, 3880, 3881, 3900, 3901, 3905, 3906,
+    15625, 15626, 15630, 15631, 15650, 15651, 15655, 15656,
+    15750, 15751, 15755, 15756, 15775, 15776, 15780, 15781,
+    16250, 16251, 16255, 16256, 16275, 16276, 16280, 16281,
+    16375, 16376, 16380, 16381, 16400, 16401, 16405, 16406,
+    18750, 18751, 18755, 18756, 18775, 18776, 18780, 18781,
+    18875, 18876, 18880, 18881, 18900, 18901, 18905, 18906,
+    19375, 19376, 19380, 19381, 19400, 19401, 19405, 19406,
+    19500, 19501, 19505, 19506, 19525, 19526, 19530, 19531
+};
+
+const unsigned quinary_hi[64] =
+{
+    0, 78125, 390625, 468750, 1953125, 2031250, 2343750, 2421875,
+    9765625, 9843750, 10156250, 10234375, 11718750, 11796875, 12109375, 12187500,
+    48828125, 48906250, 49218750, 49296875, 50781250, 50859375, 51171875, 51250000,
+    58593750, 58671875, 58984375, 59062500, 60546875, 60625000, 60937500, 61015625,
+    244140625, 244218750, 244531250, 244609375, 246093750, 246171875, 246484375, 246562500,
+    253906250, 253984375, 254296875, 254375000, 255859375, 255937500, 256250000, 256328125,
+    292968750, 293046875, 293359375, 293437500, 294921875, 295000000, 295312500, 295390625,
+    302734375, 302812500, 303125000, 303203125, 304687500, 304765625, 305078125, 305156250
+};
+
+/*
+** Category (bits 24-27), primary rank (20-23), secondary
+** rank (16-19) and kicker rank mask (0-12) of each value
+** 1-7462.  See hand_class() in poker.h.
+*/
+const unsigned hand_classes[7463] =
+{
+    0x0000000, 0x1e00000, 0x1d00000, 0x1c00000, 0x1b00000, 0x1a00000, 0x1900000, 0x1800000,
+    0x1700000, 0x1600000, 0x1500000, 0x2e00800, 0x2e00400, 0x2e00200, 0x2e00100, 0x2e00080,
+    0x2e00040, 0x2e00020, 0x2e00010, 0x2e00008, 0x2e00004, 0x2e00002, 0x2e00001, 0x2d01000,
+    0x2d00400, 0x2d00200, 0x2d00100, 0x2d00080, 0x2d00040, 0x2d00020, 0x2d00010, 0x2d00008,
+    0x2d00004, 0x2d00002, 0x2d00001, 0x2c01000, 0x2c00800, 0x2c00200, 0x2c00100, 0x2c00080,
+    0x2c00040, 0x2c00020, 0x2c00010, 0x2c00008, 0x2c00004, 0x2c00002, 0x2c00001, 0x2b01000,
+    0x2b00800, 0x2b00400, 0x2b00100, 0x2b00080, 0x2b00040, 0x2b00020, 0x2b00010, 0x2b00008,
+    0x2b00004, 0x2b00002, 0x2b00001, 0x2a01000, 0x2a00800, 0x2a00400, 0x2a00200, 0x2a00080,
+    0x2a00040, 0x2a00020, 0x2a00010, 0x2a00008, 0x2a00004, 0x2a00002, 0x2a00001, 0x2901000,
+    0x2900800, 0x2900400, 0x2900200, 0x2900100, 0x2900040, 0x2900020, 0x2900010, 0x2900008,
+    0x2900004, 0x2900002, 0x2900001, 0x2801000, 0x2800800, 0x2800400, 0x2800200, 0x2800100,
+    0x2800080, 0x2800020, 0x2800010, 0x2800008, 0x2800004, 0x2800002, 0x2800001, 0x2701000,
+    0x2700800, 0x2700400, 0x2700200, 0x2700100, 0x2700080, 0x2700040, 0x2700010, 0x2700008,
+    0x2700004, 0x2700002, 0x2700001, 0x2601000, 0x2600800, 0x2600400, 0x2600200, 0x2600100,
+    0x2600080, 0x2600040, 0x2600020, 0x2600008, 0x2600004, 0x2600002, 0x2600001, 0x2501000,
+    0x2500800, 0x2500400, 0x2500200, 0x2500100, 0x2500080, 0x2500040, 0x2500020, 0x2500010,
+    0x2500004, 0x2500002, 0x2500001, 0x2401000, 0x2400800, 0x2400400, 0x2400200, 0x2400100,
+    0x2400080, 0x2400040, 0x2400020, 0x2400010, 0x2400008, 0x2400002, 0x2400001, 0x2301000,
+    0x2300800, 0x2300400, 0x2300200, 0x2300100, 0x2300080, 0x2300040, 0x2300020, 0x2300010,
+    0x2300008, 0x2300004, 0x2300001, 0x2201000, 0x2200800, 0x2200400, 0x2200200, 0x2200100,
+    0x2200080, 0x2200040, 0x2200020, 0x2200010, 0x2200008, 0x2200004, 0x2200002, 0x3ed0000,
+    0x3ec0000, 0x3eb0000, 0x3ea0000, 0x3e90000, 0x3e80000, 0x3e70000, 0x3e60000, 0x3e50000,
+    0x3e40000, 0x3e30000, 0x3e20000, 0x3de0000, 0x3dc0000, 0x3db0000, 0x3da0000, 0x3d90000,
+    0x3d80000, 0x3d70000, 0x3d60000, 0x3d50000, 0x3d40000, 0x3d30000, 0x3d20000, 0x3ce0000,
+    0x3cd0000, 0x3cb0000, 0x3ca0000, 0x3c90000, 0x3c80000, 0x3c70000, 0x3c60000, 0x3c50000,
+    0x3c40000, 0x3c30000, 0x3c20000, 0x3be0000, 0x3bd0000, 0x3bc0000, 0x3ba0000, 0x3b90000,
+    0x3b80000, 0x3b70000, 0x3b60000, 0x3b50000, 0x3b40000, 0x3b30000, 0x3b20000, 0x3ae0000,
+    0x3ad0000, 0x3ac0000, 0x3ab0000, 0x3a90000, 0x3a80000, 0x3a70000, 0x3a60000, 0x3a50000,
+    0x3a40000, 0x3a30000, 0x3a20000, 0x39e0000, 0x39d0000, 0x39c0000, 0x39b0000, 0x39a0000,
+    0x3980000, 0x3970000, 0x3960000, 0x3950000, 0x3940000, 0x3930000, 0x3920000, 0x38e0000,
+    0x38d0000, 0x38c0000, 0x38b0000, 0x38a0000, 0x3890000, 0x3870000, 0x3860000, 0x3850000,
+    0x3840000, 0x3830000, 0x3820000, 0x37e0000, 0x37d0000, 0x37c0000, 0x37b0000, 0x37a0000,
+    0x3790000, 0x3780000, 0x3760000, 0x3750000, 0x3740000, 0x3730000, 0x3720000, 0x36e0000,
+    0x36d0000, 0x36c0000, 0x36b0000, 0x36a0000, 0x3690000, 0x3680000, 0x3670000, 0x3650000,
+    0x3640000, 0x3630000, 0x3620000, 0x35e0000, 0x35d0000, 0x35c0000, 0x35b0000, 0x35a0000,
+    0x3590000, 0x3580000, 0x3570000, 0x3560000, 0x3540000, 0x3530000, 0x3520000, 0x34e0000,
+    0x34d0000, 0x34c0000, 0x34b0000, 0x34a0000, 0x3490000, 0x3480000, 0x3470000, 0x3460000,
+    0x3450000, 0x3430000, 0x3420000, 0x33e0000, 0x33d0000, 0x33c0000, 0x33b0000, 0x33a0000,
+    0x3390000, 0x3380000, 0x3370000, 0x3360000, 0x3350000, 0x3340000, 0x3320000, 0x32e0000,
+    0x32d0000, 0x32c0000, 0x32b0000, 0x32a0000, 0x3290000, 0x3280000, 0x3270000, 0x3260000,
+    0x3250000, 0x3240000, 0x3230000, 0x4e00e80, 0x4e00e40, 0x4e00e20, 0x4e00e10, 0x4e00e08,
+    0x4e00e04, 0x4e00e02, 0x4e00e01, 0x4e00d80, 0x4e00d40, 0x4e00d20, 0x4e00d10, 0x4e00d08,
+    0x4e00d04, 0x4e00d02, 0x4e00d01, 0x4e00cc0, 0x4e00ca0, 0x4e00c90, 0x4e00c88, 0x4e00c84,
+    0x4e00c82, 0x4e00c81, 0x4e00c60, 0x4e00c50, 0x4e00c48, 0x4e00c44, 0x4e00c42, 0x4e00c41,
+    0x4e00c30, 0x4e00c28, 0x4e00c24, 0x4e00c22, 0x4e00c21, 0x4e00c18, 0x4e00c14, 0x4e00c12,
+    0x4e00c11, 0x4e00c0c, 0x4e00c0a, 0x4e00c09, 0x4e00c06, 0x4e00c05, 0x4e00c03, 0x4e00b80,
+    0x4e00b40, 0x4e00b20, 0x4e00b10, 0x4e00b08, 0x4e00b04, 0x4e00b02, 0x4e00b01, 0x4e00ac0,
+    0x4e00aa0, 0x4e00a90, 0x4e00a88, 0x4e00a84, 0x4e00a82, 0x4e00a81, 0x4e00a60, 0x4e00a50,
+    0x4e00a48, 0x4e00a44, 0x4e00a42, 0x4e00a41, 0x4e00a30, 0x4e00a28, 0x4e00a24, 0x4e00a22,
+    0x4e00a21, 0x4e00a18, 0x4e00a14, 0x4e00a12, 0x4e00a11, 0x4e00a0c, 0x4e00a0a, 0x4e00a09,
+    0x4e00a06, 0x4e00a05, 0x4e00a03, 0x4e009c0, 0x4e009a0, 0x4e00990, 0x4e00988, 0x4e00984,
+    0x4e00982, 0x4e00981, 0x4e00960, 0x4e00950, 0x4e00948, 0x4e00944, 0x4e00942, 0x4e00941,
+    0x4e00930, 0x4e00928, 0x4e00924, 0x4e00922, 0x4e00921, 0x4e00918, 0x4e00914, 0x4e00912,
+    0x4e00911, 0x4e0090c, 0x4e0090a, 0x4e00909, 0x4e00906, 0x4e00905, 0x4e00903, 0x4e008e0,
+    0x4e008d0, 0x4e008c8, 0x4e008c4, 0x4e008c2, 0x4e008c1, 0x4e008b0, 0x4e008a8, 0x4e008a4,
+    0x4e008a2, 0x4e008a1, 0x4e00898, 0x4e00894, 0x4e00892, 0x4e00891, 0x4e0088c, 0x4e0088a,
+    0x4e00889, 0x4e00886, 0x4e00885, 0x4e00883, 0x4e00870, 0x4e00868, 0x4e00864, 0x4e00862,
+    0x4e00861, 0x4e00858, 0x4e00854, 0x4e00852, 0x4e00851, 0x4e0084c, 0x4e0084a, 0x4e00849,
+    0x4e00846, 0x4e00845, 0x4e00843, 0x4e00838, 0x4e00834, 0x4e00832, 0x4e00831, 0x4e0082c,
+    0x4e0082a, 0x4e00829, 0x4e00826, 0x4e00825, 0x4e00823, 0x4e0081c, 0x4e0081a, 0x4e00819,
+    0x4e00816, 0x4e00815, 0x4e00813, 0x4e0080e, 0x4e0080d, 0x4e0080b, 0x4e00807, 0x4e00780,
+    0x4e00740, 0x4e00720, 0x4e00710, 0x4e00708, 0x4e00704, 0x4e00702, 0x4e00701, 0x4e006c0,
+    0x4e006a0, 0x4e00690, 0x4e00688, 0x4e00684, 0x4e00682, 0x4e00681, 0x4e00660, 0x4e00650,
+    0x4e00648, 0x4e00644, 0x4e00642, 0x4e00641, 0x4e00630, 0x4e00628, 0x4e00624, 0x4e00622,
+    0x4e00621, 0x4e00618, 0x4e00614, 0x4e00612, 0x4e00611, 0x4e0060c, 0x4e0060a, 0x4e00609,
+    0x4e00606, 0x4e00605, 0x4e00603, 0x4e005c0, 0x4e005a0, 0x4e00590, 0x4e00588, 0x4e00584,
+    0x4e00582, 0x4e00581, 0x4e00560, 0x4e00550, 0x4e00548, 0x4e00544, 0x4e00542, 0x4e00541,
+    0x4e00530, 0x4e00528, 0x4e00524, 0x4e00522, 0x4e00521, 0x4e00518, 0x4e00514, 0x4e00512,
+    0x4e00511, 0x4e0050c, 0x4e0050a, 0x4e00509, 0x4e00506, 0x4e00505, 0x4e00503, 0x4e004e0,
+    0x4e004d0, 0x4e004c8, 0x4e004c4, 0x4e004c2, 0x4e004c1, 0x4e004b0, 0x4e004a8, 0x4e004a4,
+    0x4e004a2, 0x4e004a1, 0x4e00498, 0x4e00494, 0x4e00492, 0x4e00491, 0x4e0048c, 0x4e0048a,
+    0x4e00489, 0x4e00486, 0x4e00485, 0x4e00483, 0x4e00470, 0x4e00468, 0x4e00464, 0x4e00462,
+    0x4e00461, 0x4e00458, 0x4e00454, 0x4e00452, 0x4e00451, 0x4e0044c, 0x4e0044a, 0x4e00449,
+    0x4e00446, 0x4e00445, 0x4e00443, 0x4e00438, 0x4e00434, 0x4e00432, 0x4e00431, 0x4e0042c,
+    0x4e0042a, 0x4e00429, 0x4e00426, 0x4e00425, 0x4e00423, 0x4e0041c, 0x4e0041a, 0x4e00419,
+    0x4e00416, 0x4e00415, 0x4e00413, 0x4e0040e, 0x4e0040d, 0x4e0040b, 0x4e00407, 0x4e003c0,
+    0x4e003a0, 0x4e00390, 0x4e00388, 0x4e00384, 0x4e00382, 0x4e00381, 0x4e00360, 0x4e00350,
+    0x4e00348, 0x4e00344, 0x4e00342, 0x4e00341, 0x4e00330, 0x4e00328, 0x4e00324, 0x4e00322,
+    0x4e00321, 0x4e00318, 0x4e00314, 0x4e00312, 0x4e00311, 0x4e0030c, 0x4e0030a, 0x4e00309,
+    0x4e00306, 0x4e00305, 0x4e00303, 0x4e002e0, 0x4e002d0, 0x4e002c8, 0x4e002c4, 0x4e002c2,
+    0x4e002c1, 0x4e002b0, 0x4e002a8, 0x4e002a4, 0x4e002a2, 0x4e002a1, 0x4e00298, 0x4e00294,
+    0x4e00292, 0x4e00291, 0x4e0028c, 0x4e0028a, 0x4e00289, 0x4e00286, 0x4e00285, 0x4e00283,
+    0x4e00270, 0x4e00268, 0x4e00264, 0x4e00262, 0x4e00261, 0x4e00258, 0x4e00254, 0x4e00252,
+    0x4e00251, 0x4e0024c, 0x4e0024a, 0x4e00249, 0x4e00246, 0x4e00245, 0x4e00243, 0x4e00238,
+    0x4e00234, 0x4e00232, 0x4e00231, 0x4e0022c, 0x4e0022a, 0x4e00229, 0x4e00226, 0x4e00225,
+    0x4e00223, 0x4e0021c, 0x4e0021a, 0x4e00219, 0x4e00216, 0x4e00215, 0x4e00213, 0x4e0020e,
+    0x4e0020d, 0x4e0020b, 0x4e00207, 0x4e001e0, 0x4e001d0, 0x4e001c8, 0x4e001c4, 0x4e001c2,
+    0x4e001c1, 0x4e001b0, 0x4e001a8, 0x4e001a4, 0x4e001a2, 0x4e001a1, 0x4e00198, 0x4e00194,
+    0x4e00192, 0x4e00191, 0x4e0018c, 0x4e0018a, 0x4e00189, 0x4e00186, 0x4e00185, 0x4e00183,
+    0x4e00170, 0x4e00168, 0x4e00164, 0x4e00162, 0x4e00161, 0x4e00158, 0x4e00154, 0x4e00152,
+    0x4e00151, 0x4e0014c, 0x4e0014a, 0x4e00149, 0x4e00146, 0x4e00145, 0x4e00143, 0x4e00138,
+    0x4e00134, 0x4e00132, 0x4e00131, 0x4e0012c, 0x4e0012a, 0x4e00129, 0x4e00126, 0x4e00125,
+    0x4e00123, 0x4e0011c, 0x4e0011a, 0x4e00119, 0x4e00116, 0x4e00115, 0x4e00113, 0x4e0010e,
+    0x4e0010d, 0x4e0010b, 0x4e00107, 0x4e000f0, 0x4e000e8, 0x4e000e4, 0x4e000e2, 0x4e000e1,
+    0x4e000d8, 0x4e000d4, 0x4e000d2, 0x4e000d1, 0x4e000cc, 0x4e000ca, 0x4e000c9, 0x4e000c6,
+    0x4e000c5, 0x4e000c3, 0x4e000b8, 0x4e000b4, 0x4e000b2, 0x4e000b1, 0x4e000ac, 0x4e000aa,
+    0x4e000a9, 0x4e000a6, 0x4e000a5, 0x4e000a3, 0x4e0009c, 0x4e0009a, 0x4e00099, 0x4e00096,
+    0x4e00095, 0x4e00093, 0x4e0008e, 0x4e0008d, 0x4e0008b, 0x4e00087, 0x4e00078, 0x4e00074,
+    0x4e00072, 0x4e00071, 0x4e0006c, 0x4e0006a, 0x4e00069, 0x4e00066, 0x4e00065, 0x4e00063,
+    0x4e0005c, 0x4e0005a, 0x4e00059, 0x4e00056, 0x4e00055, 0x4e00053, 0x4e0004e, 0x4e0004d,
+    0x4e0004b, 0x4e00047, 0x4e0003c, 0x4e0003a, 0x4e00039, 0x4e00036, 0x4e00035, 0x4e00033,
+    0x4e0002e, 0x4e0002d, 0x4e0002b, 0x4e00027, 0x4e0001e, 0x4e0001d, 0x4e0001b, 0x4e00017,
+    0x4d00740, 0x4d00720, 0x4d00710, 0x4d00708, 0x4d00704, 0x4d00702, 0x4d00701, 0x4d006c0,
+    0x4d006a0, 0x4d00690, 0x4d00688, 0x4d00684, 0x4d00682, 0x4d00681, 0x4d00660, 0x4d00650,
+    0x4d00648, 0x4d00644, 0x4d00642, 0x4d00641, 0x4d00630, 0x4d00628, 0x4d00624, 0x4d00622,
+    0x4d00621, 0x4d00618, 0x4d00614, 0x4d00612, 0x4d00611, 0x4d0060c, 0x4d0060a, 0x4d00609,
+    0x4d00606, 0x4d00605, 0x4d00603, 0x4d005c0, 0x4d005a0, 0x4d00590, 0x4d00588, 0x4d00584,
+    0x4d00582, 0x4d00581, 0x4d00560, 0x4d00550, 0x4d00548, 0x4d00544, 0x4d00542, 0x4d00541,
+    0x4d00530, 0x4d00528, 0x4d00524, 0x4d00522, 0x4d00521, 0x4d00518, 0x4d00514, 0x4d00512,
+    0x4d00511, 0x4d0050c, 0x4d0050a, 0x4d00509, 0x4d00506, 0x4d00505, 0x4d00503, 0x4d004e0,
+    0x4d004d0, 0x4d004c8, 0x4d004c4, 0x4d004c2, 0x4d004c1, 0x4d004b0, 0x4d004a8, 0x4d004a4,
+    0x4d004a2, 0x4d004a1, 0x4d00498, 0x4d00494, 0x4d00492, 0x4d00491, 0x4d0048c, 0x4d0048a,
+    0x4d00489, 0x4d00486, 0x4d00485, 0x4d00483, 0x4d00470, 0x4d00468, 0x4d00464, 0x4d00462,
+    0x4d00461, 0x4d00458, 0x4d00454, 0x4d00452, 0x4d00451, 0x4d0044c, 0x4d0044a, 0x4d00449,
+    0x4d00446, 0x4d00445, 0x4d00443, 0x4d00438, 0x4d00434, 0x4d00432, 0x4d00431, 0x4d0042c,
+    0x4d0042a, 0x4d00429, 0x4d00426, 0x4d00425, 0x4d00423, 0x4d0041c, 0x4d0041a, 0x4d00419,
+    0x4d00416, 0x4d00415, 0x4d00413, 0x4d0040e, 0x4d0040d, 0x4d0040b, 0x4d00407, 0x4d003c0,
+    0x4d003a0, 0x4d00390, 0x4d00388, 0x4d00384, 0x4d00382, 0x4d00381, 0x4d00360, 0x4d00350,
+    0x4d00348, 0x4d00344, 0x4d00342, 0x4d00341, 0x4d00330, 0x4d00328, 0x4d00324, 0x4d00322,
+    0x4d00321, 0x4d00318, 0x4d00314, 0x4d00312, 0x4d00311, 0x4d0030c, 0x4d0030a, 0x4d00309,
+    0x4d00306, 0x4d00305, 0x4d00303, 0x4d002e0, 0x4d002d0, 0x4d002c8, 0x4d002c4, 0x4d002c2,
+    0x4d002c1, 0x4d002b0, 0x4d002a8, 0x4d002a4, 0x4d002a2, 0x4d002a1, 0x4d00298, 0x4d00294,
+    0x4d00292, 0x4d00291, 0x4d0028c, 0x4d0028a, 0x4d00289, 0x4d00286, 0x4d00285, 0x4d00283,
+    0x4d00270, 0x4d00268, 0x4d00264, 0x4d00262, 0x4d00261, 0x4d00258, 0x4d00254, 0x4d00252,
+    0x4d00251, 0x4d0024c, 0x4d0024a, 0x4d00249, 0x4d00246, 0x4d00245, 0x4d00243, 0x4d00238,
+    0x4d00234, 0x4d00232, 0x4d00231, 0x4d0022c, 0x4d0022a, 0x4d00229, 0x4d00226, 0x4d00225,
+    0x4d00223, 0x4d0021c, 0x4d0021a, 0x4d00219, 0x4d00216, 0x4d00215, 0x4d00213, 0x4d0020e,
+    0x4d0020d, 0x4d0020b, 0x4d00207, 0x4d001e0, 0x4d001d0, 0x4d001c8, 0x4d001c4, 0x4d001c2,
+    0x4d001c1, 0x4d001b0, 0x4d001a8, 0x4d001a4, 0x4d001a2, 0x4d001a1, 0x4d00198, 0x4d00194,
+    0x4d00192, 0x4d00191, 0x4d0018c, 0x4d0018a, 0x4d00189, 0x4d00186, 0x4d00185, 0x4d00183,
+    0x4d00170, 0x4d00168, 0x4d00164, 0x4d00162, 0x4d00161, 0x4d00158, 0x4d00154, 0x4d00152,
+    0x4d00151, 0x4d0014c, 0x4d0014a, 0x4d00149, 0x4d00146, 0x4d00145, 0x4d00143, 0x4d00138,
+    0x4d00134, 0x4d00132, 0x4d00131, 0x4d0012c, 0x4d0012a, 0x4d00129, 0x4d00126, 0x4d00125,
+    0x4d00123, 0x4d0011c, 0x4d0011a, 0x4d00119, 0x4d00116, 0x4d00115, 0x4d00113, 0x4d0010e,
+    0x4d0010d, 0x4d0010b, 0x4d00107, 0x4d000f0, 0x4d000e8, 0x4d000e4, 0x4d000e2, 0x4d000e1,
+    0x4d000d8, 0x4d000d4, 0x4d000d2, 0x4d000d1, 0x4d000cc, 0x4d000ca, 0x4d000c9, 0x4d000c6,
+    0x4d000c5, 0x4d000c3, 0x4d000b8, 0x4d000b4, 0x4d000b2, 0x4d000b1, 0x4d000ac, 0x4d000aa,
+    0x4d000a9, 0x4d000a6, 0x4d000a5, 0x4d000a3, 0x4d0009c, 0x4d0009a, 0x4d00099, 0x4d00096,
+    0x4d00095, 0x4d00093, 0x4d0008e, 0x4d0008d, 0x4d0008b, 0x4d00087, 0x4d00078, 0x4d00074,
+    0x4d00072, 0x4d00071, 0x4d0006c, 0x4d0006a, 0x4d00069, 0x4d00066, 0x4d00065, 0x4d00063,
+    0x4d0005c, 0x4d0005a, 0x4d00059, 0x4d00056, 0x4d00055, 0x4d00053, 0x4d0004e, 0x4d0004d,
+    0x4d0004b, 0x4d00047, 0x4d0003c, 0x4d0003a, 0x4d00039, 0x4d00036, 0x4d00035, 0x4d00033,
+    0x4d0002e, 0x4d0002d, 0x4d0002b, 0x4d00027, 0x4d0001e, 0x4d0001d, 0x4d0001b, 0x4d00017,
+    0x4d0000f, 0x4c003a0, 0x4c00390, 0x4c00388, 0x4c00384, 0x4c00382, 0x4c00381, 0x4c00360,
+    0x4c00350, 0x4c00348, 0x4c00344, 0x4c00342, 0x4c00341, 0x4c00330, 0x4c00328, 0x4c00324,
+    0x4c00322, 0x4c00321, 0x4c00318, 0x4c00314, 0x4c00312, 0x4c00311, 0x4c0030c, 0x4c0030a,
+    0x4c00309, 0x4c00306, 0x4c00305, 0x4c00303, 0x4c002e0, 0x4c002d0, 0x4c002c8, 0x4c002c4,
+    0x4c002c2, 0x4c002c1, 0x4c002b0, 0x4c002a8, 0x4c002a4, 0x4c002a2, 0x4c002a1, 0x4c00298,
+    0x4c00294, 0x4c00292, 0x4c00291, 0x4c0028c, 0x4c0028a, 0x4c00289, 0x4c00286, 0x4c00285,
+    0x4c00283, 0x4c00270, 0x4c00268, 0x4c00264, 0x4c00262, 0x4c00261, 0x4c00258, 0x4c00254,
+    0x4c00252, 0x4c00251, 0x4c0024c, 0x4c0024a, 0x4c00249, 0x4c00246, 0x4c00245, 0x4c00243,
+    0x4c00238, 0x4c00234, 0x4c00232, 0x4c00231, 0x4c0022c, 0x4c0022a, 0x4c00229, 0x4c00226,
+    0x4c00225, 0x4c00223, 0x4c0021c, 0x4c0021a, 0x4c00219, 0x4c00216, 0x4c00215, 0x4c00213,
+    0x4c0020e, 0x4c0020d, 0x4c0020b, 0x4c00207, 0x4c001e0, 0x4c001d0, 0x4c001c8, 0x4c001c4,
+    0x4c001c2, 0x4c001c1, 0x4c001b0, 0x4c001a8, 0x4c001a4, 0x4c001a2, 0x4c001a1, 0x4c00198,
+    0x4c00194, 0x4c00192, 0x4c00191, 0x4c0018c, 0x4c0018a, 0x4c00189, 0x4c00186, 0x4c00185,
+    0x4c00183, 0x4c00170, 0x4c00168, 0x4c00164, 0x4c00162, 0x4c00161, 0x4c00158, 0x4c00154,
+    0x4c00152, 0x4c00151, 0x4c0014c, 0x4c0014a, 0x4c00149, 0x4c00146, 0x4c00145, 0x4c00143,
+    0x4c00138, 0x4c00134, 0x4c00132, 0x4c00131, 0x4c0012c, 0x4c0012a, 0x4c00129, 0x4c00126,
+    0x4c00125, 0x4c00123, 0x4c0011c, 0x4c0011a, 0x4c00119, 0x4c00116, 0x4c00115, 0x4c00113,
+    0x4c0010e, 0x4c0010d, 0x4c0010b, 0x4c00107, 0x4c000f0, 0x4c000e8, 0x4c000e4, 0x4c000e2,
+    0x4c000e1, 0x4c000d8, 0x4c000d4, 0x4c000d2, 0x4c000d1, 0x4c000cc, 0x4c000ca, 0x4c000c9,
+    0x4c000c6, 0x4c000c5, 0x4c000c3, 0x4c000b8, 0x4c000b4, 0x4c000b2, 0x4c000b1, 0x4c000ac,
+    0x4c000aa, 0x4c000a9, 0x4c000a6, 0x4c000a5, 0x4c000a3, 0x4c0009c, 0x4c0009a, 0x4c00099,
+    0x4c00096, 0x4c00095, 0x4c00093, 0x4c0008e, 0x4c0008d, 0x4c0008b, 0x4c00087, 0x4c00078,
+    0x4c00074, 0x4c00072, 0x4c00071, 0x4c0006c, 0x4c0006a, 0x4c00069, 0x4c00066, 0x4c00065,
+    0x4c00063, 0x4c0005c, 0x4c0005a, 0x4c00059, 0x4c00056, 0x4c00055, 0x4c00053, 0x4c0004e,
+    0x4c0004d, 0x4c0004b, 0x4c00047, 0x4c0003c, 0x4c0003a, 0x4c00039, 0x4c00036, 0x4c00035,
+    0x4c00033, 0x4c0002e, 0x4c0002d, 0x4c0002b, 0x4c00027, 0x4c0001e, 0x4c0001d, 0x4c0001b,
+    0x4c00017, 0x4c0000f, 0x4b001d0, 0x4b001c8, 0x4b001c4, 0x4b001c2, 0x4b001c1, 0x4b001b0,
+    0x4b001a8, 0x4b001a4, 0x4b001a2, 0x4b001a1, 0x4b00198, 0x4b00194, 0x4b00192, 0x4b00191,
+    0x4b0018c, 0x4b0018a, 0x4b00189, 0x4b00186, 0x4b00185, 0x4b00183, 0x4b00170, 0x4b00168,
+    0x4b00164, 0x4b00162, 0x4b00161, 0x4b00158, 0x4b00154, 0x4b00152, 0x4b00151, 0x4b0014c,
+    0x4b0014a, 0x4b00149, 0x4b00146, 0x4b00145, 0x4b00143, 0x4b00138, 0x4b00134, 0x4b00132,
+    0x4b00131, 0x4b0012c, 0x4b0012a, 0x4b00129, 0x4b00126, 0x4b00125, 0x4b00123, 0x4b0011c,
+    0x4b0011a, 0x4b00119, 0x4b00116, 0x4b00115, 0x4b00113, 0x4b0010e, 0x4b0010d, 0x4b0010b,
+    0x4b00107, 0x4b000f0, 0x4b000e8, 0x4b000e4, 0x4b000e2, 0x4b000e1, 0x4b000d8, 0x4b000d4,
+    0x4b000d2, 0x4b000d1, 0x4b000cc, 0x4b000ca, 0x4b000c9, 0x4b000c6, 0x4b000c5, 0x4b000c3,
+    0x4b000b8, 0x4b000b4, 0x4b000b2, 0x4b000b1, 0x4b000ac, 0x4b000aa, 0x4b000a9, 0x4b000a6,
+    0x4b000a5, 0x4b000a3, 0x4b0009c, 0x4b0009a, 0x4b00099, 0x4b00096, 0x4b00095, 0x4b00093,
+    0x4b0008e, 0x4b0008d, 0x4b0008b, 0x4b00087, 0x4b00078, 0x4b00074, 0x4b00072, 0x4b00071,
+    0x4b0006c, 0x4b0006a, 0x4b00069, 0x4b00066, 0x4b00065, 0x4b00063, 0x4b0005c, 0x4b0005a,
+    0x4b00059, 0x4b00056, 0x4b00055, 0x4b00053, 0x4b0004e, 0x4b0004d, 0x4b0004b, 0x4b00047,
+    0x4b0003c, 0x4b0003a, 0x4b00039, 0x4b00036, 0x4b00035, 0x4b00033, 0x4b0002e, 0x4b0002d,
+    0x4b0002b, 0x4b00027, 0x4b0001e, 0x4b0001d, 0x4b0001b, 0x4b00017, 0x4b0000f, 0x4a000e8,
+    0x4a000e4, 0x4a000e2, 0x4a000e1, 0x4a000d8, 0x4a000d4, 0x4a000d2, 0x4a000d1, 0x4a000cc,
+    0x4a000ca, 0x4a000c9, 0x4a000c6, 0x4a000c5, 0x4a000c3, 0x4a000b8, 0x4a000b4, 0x4a000b2,
+    0x4a000b1, 0x4a000ac, 0x4a000aa, 0x4a000a9, 0x4a000a6, 0x4a000a5, 0x4a000a3, 0x4a0009c,
+    0x4a0009a, 0x4a00099, 0x4a00096, 0x4a00095, 0x4a00093, 0x4a0008e, 0x4a0008d, 0x4a0008b,
+    0x4a00087, 0x4a00078, 0x4a00074, 0x4a00072, 0x4a00071, 0x4a0006c, 0x4a0006a, 0x4a00069,
+    0x4a00066, 0x4a00065, 0x4a00063, 0x4a0005c, 0x4a0005a, 0x4a00059, 0x4a00056, 0x4a00055,
+    0x4a00053, 0x4a0004e, 0x4a0004d, 0x4a0004b, 0x4a00047, 0x4a0003c, 0x4a0003a, 0x4a00039,
+    0x4a00036, 0x4a00035, 0x4a00033, 0x4a0002e, 0x4a0002d, 0x4a0002b, 0x4a00027, 0x4a0001e,
+    0x4a0001d, 0x4a0001b, 0x4a00017, 0x4a0000f, 0x4900074, 0x4900072, 0x4900071, 0x490006c,
+    0x490006a, 0x4900069, 0x4900066, 0x4900065, 0x4900063, 0x490005c, 0x490005a, 0x4900059,
+    0x4900056, 0x4900055, 0x4900053, 0x490004e, 0x490004d, 0x490004b, 0x4900047, 0x490003c,
+    0x490003a, 0x4900039, 0x4900036, 0x4900035, 0x4900033, 0x490002e, 0x490002d, 0x490002b,
+    0x4900027, 0x490001e, 0x490001d, 0x490001b, 0x4900017, 0x490000f, 0x480003a, 0x4800039,
+    0x4800036, 0x4800035, 0x4800033, 0x480002e, 0x480002d, 0x480002b, 0x4800027, 0x480001e,
+    0x480001d, 0x480001b, 0x4800017, 0x480000f, 0x470001d, 0x470001b, 0x4700017, 0x470000f,
+    0x5e00000, 0x5d00000, 0x5c00000, 0x5b00000, 0x5a00000, 0x5900000, 0x5800000, 0x5700000,
+    0x5600000, 0x5500000, 0x6e00c00, 0x6e00a00, 0x6e00900, 0x6e00880, 0x6e00840, 0x6e00820,
+    0x6e00810, 0x6e00808, 0x6e00804, 0x6e00802, 0x6e00801, 0x6e00600, 0x6e00500, 0x6e00480,
+    0x6e00440, 0x6e00420, 0x6e00410, 0x6e00408, 0x6e00404, 0x6e00402, 0x6e00401, 0x6e00300,
+    0x6e00280, 0x6e00240, 0x6e00220, 0x6e00210, 0x6e00208, 0x6e00204, 0x6e00202, 0x6e00201,
+    0x6e00180, 0x6e00140, 0x6e00120, 0x6e00110, 0x6e00108, 0x6e00104, 0x6e00102, 0x6e00101,
+    0x6e000c0, 0x6e000a0, 0x6e00090, 0x6e00088, 0x6e00084, 0x6e00082, 0x6e00081, 0x6e00060,
+    0x6e00050, 0x6e00048, 0x6e00044, 0x6e00042, 0x6e00041, 0x6e00030, 0x6e00028, 0x6e00024,
+    0x6e00022, 0x6e00021, 0x6e00018, 0x6e00014, 0x6e00012, 0x6e00011, 0x6e0000c, 0x6e0000a,
+    0x6e00009, 0x6e00006, 0x6e00005, 0x6e00003, 0x6d01400, 0x6d01200, 0x6d01100, 0x6d01080,
+    0x6d01040, 0x6d01020, 0x6d01010, 0x6d01008, 0x6d01004, 0x6d01002, 0x6d01001, 0x6d00600,
+    0x6d00500, 0x6d00480, 0x6d00440, 0x6d00420, 0x6d00410, 0x6d00408, 0x6d00404, 0x6d00402,
+    0x6d00401, 0x6d00300, 0x6d00280, 0x6d00240, 0x6d00220, 0x6d00210, 0x6d00208, 0x6d00204,
+    0x6d00202, 0x6d00201, 0x6d00180, 0x6d00140, 0x6d00120, 0x6d00110, 0x6d00108, 0x6d00104,
+    0x6d00102, 0x6d00101, 0x6d000c0, 0x6d000a0, 0x6d00090, 0x6d00088, 0x6d00084, 0x6d00082,
+    0x6d00081, 0x6d00060, 0x6d00050, 0x6d00048, 0x6d00044, 0x6d00042, 0x6d00041, 0x6d00030,
+    0x6d00028, 0x6d00024, 0x6d00022, 0x6d00021, 0x6d00018, 0x6d00014, 0x6d00012, 0x6d00011,
+    0x6d0000c, 0x6d0000a, 0x6d00009, 0x6d00006, 0x6d00005, 0x6d00003, 0x6c01800, 0x6c01200,
+    0x6c01100, 0x6c01080, 0x6c01040, 0x6c01020, 0x6c01010, 0x6c01008, 0x6c01004, 0x6c01002,
+    0x6c01001, 0x6c00a00, 0x6c00900, 0x6c00880, 0x6c00840, 0x6c00820, 0x6c00810, 0x6c00808,
+    0x6c00804, 0x6c00802, 0x6c00801, 0x6c00300, 0x6c00280, 0x6c00240, 0x6c00220, 0x6c00210,
+    0x6c00208, 0x6c00204, 0x6c00202, 0x6c00201, 0x6c00180, 0x6c00140, 0x6c00120, 0x6c00110,
+    0x6c00108, 0x6c00104, 0x6c00102, 0x6c00101, 0x6c000c0, 0x6c000a0, 0x6c00090, 0x6c00088,
+    0x6c00084, 0x6c00082, 0x6c00081, 0x6c00060, 0x6c00050, 0x6c00048, 0x6c00044, 0x6c00042,
+    0x6c00041, 0x6c00030, 0x6c00028, 0x6c00024, 0x6c00022, 0x6c00021, 0x6c00018, 0x6c00014,
+    0x6c00012, 0x6c00011, 0x6c0000c, 0x6c0000a, 0x6c00009, 0x6c00006, 0x6c00005, 0x6c00003,
+    0x6b01800, 0x6b01400, 0x6b01100, 0x6b01080, 0x6b01040, 0x6b01020, 0x6b01010, 0x6b01008,
+    0x6b01004, 0x6b01002, 0x6b01001, 0x6b00c00, 0x6b00900, 0x6b00880, 0x6b00840, 0x6b00820,
+    0x6b00810, 0x6b00808, 0x6b00804, 0x6b00802, 0x6b00801, 0x6b00500, 0x6b00480, 0x6b00440,
+    0x6b00420, 0x6b00410, 0x6b00408, 0x6b00404, 0x6b00402, 0x6b00401, 0x6b00180, 0x6b00140,
+    0x6b00120, 0x6b00110, 0x6b00108, 0x6b00104, 0x6b00102, 0x6b00101, 0x6b000c0, 0x6b000a0,
+    0x6b00090, 0x6b00088, 0x6b00084, 0x6b00082, 0x6b00081, 0x6b00060, 0x6b00050, 0x6b00048,
+    0x6b00044, 0x6b00042, 0x6b00041, 0x6b00030, 0x6b00028, 0x6b00024, 0x6b00022, 0x6b00021,
+    0x6b00018, 0x6b00014, 0x6b00012, 0x6b00011, 0x6b0000c, 0x6b0000a, 0x6b00009, 0x6b00006,
+    0x6b00005, 0x6b00003, 0x6a01800, 0x6a01400, 0x6a01200, 0x6a01080, 0x6a01040, 0x6a01020,
+    0x6a01010, 0x6a01008, 0x6a01004, 0x6a01002, 0x6a01001, 0x6a00c00, 0x6a00a00, 0x6a00880,
+    0x6a00840, 0x6a00820, 0x6a00810, 0x6a00808, 0x6a00804, 0x6a00802, 0x6a00801, 0x6a00600,
+    0x6a00480, 0x6a00440, 0x6a00420, 0x6a00410, 0x6a00408, 0x6a00404, 0x6a00402, 0x6a00401,
+    0x6a00280, 0x6a00240, 0x6a00220, 0x6a00210, 0x6a00208, 0x6a00204, 0x6a00202, 0x6a00201,
+    0x6a000c0, 0x6a000a0, 0x6a00090, 0x6a00088, 0x6a00084, 0x6a00082, 0x6a00081, 0x6a00060,
+    0x6a00050, 0x6a00048, 0x6a00044, 0x6a00042, 0x6a00041, 0x6a00030, 0x6a00028, 0x6a00024,
+    0x6a00022, 0x6a00021, 0x6a00018, 0x6a00014, 0x6a00012, 0x6a00011, 0x6a0000c, 0x6a0000a,
+    0x6a00009, 0x6a00006, 0x6a00005, 0x6a00003, 0x6901800, 0x6901400, 0x6901200, 0x6901100,
+    0x6901040, 0x6901020, 0x6901010, 0x6901008, 0x6901004, 0x6901002, 0x6901001, 0x6900c00,
+    0x6900a00, 0x6900900, 0x6900840, 0x6900820, 0x6900810, 0x6900808, 0x6900804, 0x6900802,
+    0x6900801, 0x6900600, 0x6900500, 0x6900440, 0x6900420, 0x6900410, 0x6900408, 0x6900404,
+    0x6900402, 0x6900401, 0x6900300, 0x6900240, 0x6900220, 0x6900210, 0x6900208, 0x6900204,
+    0x6900202, 0x6900201, 0x6900140, 0x6900120, 0x6900110, 0x6900108, 0x6900104, 0x6900102,
+    0x6900101, 0x6900060, 0x6900050, 0x6900048, 0x6900044, 0x6900042, 0x6900041, 0x6900030,
+    0x6900028, 0x6900024, 0x6900022, 0x6900021, 0x6900018, 0x6900014, 0x6900012, 0x6900011,
+    0x690000c, 0x690000a, 0x6900009, 0x6900006, 0x6900005, 0x6900003, 0x6801800, 0x6801400,
+    0x6801200, 0x6801100, 0x6801080, 0x6801020, 0x6801010, 0x6801008, 0x6801004, 0x6801002,
+    0x6801001, 0x6800c00, 0x6800a00, 0x6800900, 0x6800880, 0x6800820, 0x6800810, 0x6800808,
+    0x6800804, 0x6800802, 0x6800801, 0x6800600, 0x6800500, 0x6800480, 0x6800420, 0x6800410,
+    0x6800408, 0x6800404, 0x6800402, 0x6800401, 0x6800300, 0x6800280, 0x6800220, 0x6800210,
+    0x6800208, 0x6800204, 0x6800202, 0x6800201, 0x6800180, 0x6800120, 0x6800110, 0x6800108,
+    0x6800104, 0x6800102, 0x6800101, 0x68000a0, 0x6800090, 0x6800088, 0x6800084, 0x6800082,
+    0x6800081, 0x6800030, 0x6800028, 0x6800024, 0x6800022, 0x6800021, 0x6800018, 0x6800014,
+    0x6800012, 0x6800011, 0x680000c, 0x680000a, 0x6800009, 0x6800006, 0x6800005, 0x6800003,
+    0x6701800, 0x6701400, 0x6701200, 0x6701100, 0x6701080, 0x6701040, 0x6701010, 0x6701008,
+    0x6701004, 0x6701002, 0x6701001, 0x6700c00, 0x6700a00, 0x6700900, 0x6700880, 0x6700840,
+    0x6700810, 0x6700808, 0x6700804, 0x6700802, 0x6700801, 0x6700600, 0x6700500, 0x6700480,
+    0x6700440, 0x6700410, 0x6700408, 0x6700404, 0x6700402, 0x6700401, 0x6700300, 0x6700280,
+    0x6700240, 0x6700210, 0x6700208, 0x6700204, 0x6700202, 0x6700201, 0x6700180, 0x6700140,
+    0x6700110, 0x6700108, 0x6700104, 0x6700102, 0x6700101, 0x67000c0, 0x6700090, 0x6700088,
+    0x6700084, 0x6700082, 0x6700081, 0x6700050, 0x6700048, 0x6700044, 0x6700042, 0x6700041,
+    0x6700018, 0x6700014, 0x6700012, 0x6700011, 0x670000c, 0x670000a, 0x6700009, 0x6700006,
+    0x6700005, 0x6700003, 0x6601800, 0x6601400, 0x6601200, 0x6601100, 0x6601080, 0x6601040,
+    0x6601020, 0x6601008, 0x6601004, 0x6601002, 0x6601001, 0x6600c00, 0x6600a00, 0x6600900,
+    0x6600880, 0x6600840, 0x6600820, 0x6600808, 0x6600804, 0x6600802, 0x6600801, 0x6600600,
+    0x6600500, 0x6600480, 0x6600440, 0x6600420, 0x6600408, 0x6600404, 0x6600402, 0x6600401,
+    0x6600300, 0x6600280, 0x6600240, 0x6600220, 0x6600208, 0x6600204, 0x6600202, 0x6600201,
+    0x6600180, 0x6600140, 0x6600120, 0x6600108, 0x6600104, 0x6600102, 0x6600101, 0x66000c0,
+    0x66000a0, 0x6600088, 0x6600084, 0x6600082, 0x6600081, 0x6600060, 0x6600048, 0x6600044,
+    0x6600042, 0x6600041, 0x6600028, 0x6600024, 0x6600022, 0x6600021, 0x660000c, 0x660000a,
+    0x6600009, 0x6600006, 0x6600005, 0x6600003, 0x6501800, 0x6501400, 0x6501200, 0x6501100,
+    0x6501080, 0x6501040, 0x6501020, 0x6501010, 0x6501004, 0x6501002, 0x6501001, 0x6500c00,
+    0x6500a00, 0x6500900, 0x6500880, 0x6500840, 0x6500820, 0x6500810, 0x6500804, 0x6500802,
+    0x6500801, 0x6500600, 0x6500500, 0x6500480, 0x6500440, 0x6500420, 0x6500410, 0x6500404,
+    0x6500402, 0x6500401, 0x6500300, 0x6500280, 0x6500240, 0x6500220, 0x6500210, 0x6500204,
+    0x6500202, 0x6500201, 0x6500180, 0x6500140, 0x6500120, 0x6500110, 0x6500104, 0x6500102,
+    0x6500101, 0x65000c0, 0x65000a0, 0x6500090, 0x6500084, 0x6500082, 0x6500081, 0x6500060,
+    0x6500050, 0x6500044, 0x6500042, 0x6500041, 0x6500030, 0x6500024, 0x6500022, 0x6500021,
+    0x6500014, 0x6500012, 0x6500011, 0x6500006, 0x6500005, 0x6500003, 0x6401800, 0x6401400,
+    0x6401200, 0x6401100, 0x6401080, 0x6401040, 0x6401020, 0x6401010, 0x6401008, 0x6401002,
+    0x6401001, 0x6400c00, 0x6400a00, 0x6400900, 0x6400880, 0x6400840, 0x6400820, 0x6400810,
+    0x6400808, 0x6400802, 0x6400801, 0x6400600, 0x6400500, 0x6400480, 0x6400440, 0x6400420,
+    0x6400410, 0x6400408, 0x6400402, 0x6400401, 0x6400300, 0x6400280, 0x6400240, 0x6400220,
+    0x6400210, 0x6400208, 0x6400202, 0x6400201, 0x6400180, 0x6400140, 0x6400120, 0x6400110,
+    0x6400108, 0x6400102, 0x6400101, 0x64000c0, 0x64000a0, 0x6400090, 0x6400088, 0x6400082,
+    0x6400081, 0x6400060, 0x6400050, 0x6400048, 0x6400042, 0x6400041, 0x6400030, 0x6400028,
+    0x6400022, 0x6400021, 0x6400018, 0x6400012, 0x6400011, 0x640000a, 0x6400009, 0x6400003,
+    0x6301800, 0x6301400, 0x6301200, 0x6301100, 0x6301080, 0x6301040, 0x6301020, 0x6301010,
+    0x6301008, 0x6301004, 0x6301001, 0x6300c00, 0x6300a00, 0x6300900, 0x6300880, 0x6300840,
+    0x6300820, 0x6300810, 0x6300808, 0x6300804, 0x6300801, 0x6300600, 0x6300500, 0x6300480,
+    0x6300440, 0x6300420, 0x6300410, 0x6300408, 0x6300404, 0x6300401, 0x6300300, 0x6300280,
+    0x6300240, 0x6300220, 0x6300210, 0x6300208, 0x6300204, 0x6300201, 0x6300180, 0x6300140,
+    0x6300120, 0x6300110, 0x6300108, 0x6300104, 0x6300101, 0x63000c0, 0x63000a0, 0x6300090,
+    0x6300088, 0x6300084, 0x6300081, 0x6300060, 0x6300050, 0x6300048, 0x6300044, 0x6300041,
+    0x6300030, 0x6300028, 0x6300024, 0x6300021, 0x6300018, 0x6300014, 0x6300011, 0x630000c,
+    0x6300009, 0x6300005, 0x6201800, 0x6201400, 0x6201200, 0x6201100, 0x6201080, 0x6201040,
+    0x6201020, 0x6201010, 0x6201008, 0x6201004, 0x6201002, 0x6200c00, 0x6200a00, 0x6200900,
+    0x6200880, 0x6200840, 0x6200820, 0x6200810, 0x6200808, 0x6200804, 0x6200802, 0x6200600,
+    0x6200500, 0x6200480, 0x6200440, 0x6200420, 0x6200410, 0x6200408, 0x6200404, 0x6200402,
+    0x6200300, 0x6200280, 0x6200240, 0x6200220, 0x6200210, 0x6200208, 0x6200204, 0x6200202,
+    0x6200180, 0x6200140, 0x6200120, 0x6200110, 0x6200108, 0x6200104, 0x6200102, 0x62000c0,
+    0x62000a0, 0x6200090, 0x6200088, 0x6200084, 0x6200082, 0x6200060, 0x6200050, 0x6200048,
+    0x6200044, 0x6200042, 0x6200030, 0x6200028, 0x6200024, 0x6200022, 0x6200018, 0x6200014,
+    0x6200012, 0x620000c, 0x620000a, 0x6200006, 0x7ed0400, 0x7ed0200, 0x7ed0100, 0x7ed0080,
+    0x7ed0040, 0x7ed0020, 0x7ed0010, 0x7ed0008, 0x7ed0004, 0x7ed0002, 0x7ed0001, 0x7ec0800,
+    0x7ec0200, 0x7ec0100, 0x7ec0080, 0x7ec0040, 0x7ec0020, 0x7ec0010, 0x7ec0008, 0x7ec0004,
+    0x7ec0002, 0x7ec0001, 0x7eb0800, 0x7eb0400, 0x7eb0100, 0x7eb0080, 0x7eb0040, 0x7eb0020,
+    0x7eb0010, 0x7eb0008, 0x7eb0004, 0x7eb0002, 0x7eb0001, 0x7ea0800, 0x7ea0400, 0x7ea0200,
+    0x7ea0080, 0x7ea0040, 0x7ea0020, 0x7ea0010, 0x7ea0008, 0x7ea0004, 0x7ea0002, 0x7ea0001,
+    0x7e90800, 0x7e90400, 0x7e90200, 0x7e90100, 0x7e90040, 0x7e90020, 0x7e90010, 0x7e90008,
+    0x7e90004, 0x7e90002, 0x7e90001, 0x7e80800, 0x7e80400, 0x7e80200, 0x7e80100, 0x7e80080,
+    0x7e80020, 0x7e80010, 0x7e80008, 0x7e80004, 0x7e80002, 0x7e80001, 0x7e70800, 0x7e70400,
+    0x7e70200, 0x7e70100, 0x7e70080, 0x7e70040, 0x7e70010, 0x7e70008, 0x7e70004, 0x7e70002,
+    0x7e70001, 0x7e60800, 0x7e60400, 0x7e60200, 0x7e60100, 0x7e60080, 0x7e60040, 0x7e60020,
+    0x7e60008, 0x7e60004, 0x7e60002, 0x7e60001, 0x7e50800, 0x7e50400, 0x7e50200, 0x7e50100,
+    0x7e50080, 0x7e50040, 0x7e50020, 0x7e50010, 0x7e50004, 0x7e50002, 0x7e50001, 0x7e40800,
+    0x7e40400, 0x7e40200, 0x7e40100, 0x7e40080, 0x7e40040, 0x7e40020, 0x7e40010, 0x7e40008,
+    0x7e40002, 0x7e40001, 0x7e30800, 0x7e30400, 0x7e30200, 0x7e30100, 0x7e30080, 0x7e30040,
+    0x7e30020, 0x7e30010, 0x7e30008, 0x7e30004, 0x7e30001, 0x7e20800, 0x7e20400, 0x7e20200,
+    0x7e20100, 0x7e20080, 0x7e20040, 0x7e20020, 0x7e20010, 0x7e20008, 0x7e20004, 0x7e20002,
+    0x7dc1000, 0x7dc0200, 0x7dc0100, 0x7dc0080, 0x7dc0040, 0x7dc0020, 0x7dc0010, 0x7dc0008,
+    0x7dc0004, 0x7dc0002, 0x7dc0001, 0x7db1000, 0x7db0400, 0x7db0100, 0x7db0080, 0x7db0040,
+    0x7db0020, 0x7db0010, 0x7db0008, 0x7db0004, 0x7db0002, 0x7db0001, 0x7da1000, 0x7da0400,
+    0x7da0200, 0x7da0080, 0x7da0040, 0x7da0020, 0x7da0010, 0x7da0008, 0x7da0004, 0x7da0002,
+    0x7da0001, 0x7d91000, 0x7d90400, 0x7d90200, 0x7d90100, 0x7d90040, 0x7d90020, 0x7d90010,
+    0x7d90008, 0x7d90004, 0x7d90002, 0x7d90001, 0x7d81000, 0x7d80400, 0x7d80200, 0x7d80100,
+    0x7d80080, 0x7d80020, 0x7d80010, 0x7d80008, 0x7d80004, 0x7d80002, 0x7d80001, 0x7d71000,
+    0x7d70400, 0x7d70200, 0x7d70100, 0x7d70080, 0x7d70040, 0x7d70010, 0x7d70008, 0x7d70004,
+    0x7d70002, 0x7d70001, 0x7d61000, 0x7d60400, 0x7d60200, 0x7d60100, 0x7d60080, 0x7d60040,
+    0x7d60020, 0x7d60008, 0x7d60004, 0x7d60002, 0x7d60001, 0x7d51000, 0x7d50400, 0x7d50200,
+    0x7d50100, 0x7d50080, 0x7d50040, 0x7d50020, 0x7d50010, 0x7d50004, 0x7d50002, 0x7d50001,
+    0x7d41000, 0x7d40400, 0x7d40200, 0x7d40100, 0x7d40080, 0x7d40040, 0x7d40020, 0x7d40010,
+    0x7d40008, 0x7d40002, 0x7d40001, 0x7d31000, 0x7d30400, 0x7d30200, 0x7d30100, 0x7d30080,
+    0x7d30040, 0x7d30020, 0x7d30010, 0x7d30008, 0x7d30004, 0x7d30001, 0x7d21000, 0x7d20400,
+    0x7d20200, 0x7d20100, 0x7d20080, 0x7d20040, 0x7d20020, 0x7d20010, 0x7d20008, 0x7d20004,
+    0x7d20002, 0x7cb1000, 0x7cb0800, 0x7cb0100, 0x7cb0080, 0x7cb0040, 0x7cb0020, 0x7cb0010,
+    0x7cb0008, 0x7cb0004, 0x7cb0002, 0x7cb0001, 0x7ca1000, 0x7ca0800, 0x7ca0200, 0x7ca0080,
+    0x7ca0040, 0x7ca0020, 0x7ca0010, 0x7ca0008, 0x7ca0004, 0x7ca0002, 0x7ca0001, 0x7c91000,
+    0x7c90800, 0x7c90200, 0x7c90100, 0x7c90040, 0x7c90020, 0x7c90010, 0x7c90008, 0x7c90004,
+    0x7c90002, 0x7c90001, 0x7c81000, 0x7c80800, 0x7c80200, 0x7c80100, 0x7c80080, 0x7c80020,
+    0x7c80010, 0x7c80008, 0x7c80004, 0x7c80002, 0x7c80001, 0x7c71000, 0x7c70800, 0x7c70200,
+    0x7c70100, 0x7c70080, 0x7c70040, 0x7c70010, 0x7c70008, 0x7c70004, 0x7c70002, 0x7c70001,
+    0x7c61000, 0x7c60800, 0x7c60200, 0x7c60100, 0x7c60080, 0x7c60040, 0x7c60020, 0x7c60008,
+    0x7c60004, 0x7c60002, 0x7c60001, 0x7c51000, 0x7c50800, 0x7c50200, 0x7c50100, 0x7c50080,
+    0x7c50040, 0x7c50020, 0x7c50010, 0x7c50004, 0x7c50002, 0x7c50001, 0x7c41000, 0x7c40800,
+    0x7c40200, 0x7c40100, 0x7c40080, 0x7c40040, 0x7c40020, 0x7c40010, 0x7c40008, 0x7c40002,
+    0x7c40001, 0x7c31000, 0x7c30800, 0x7c30200, 0x7c30100, 0x7c30080, 0x7c30040, 0x7c30020,
+    0x7c30010, 0x7c30008, 0x7c30004, 0x7c30001, 0x7c21000, 0x7c20800, 0x7c20200, 0x7c20100,
+    0x7c20080, 0x7c20040, 0x7c20020, 0x7c20010, 0x7c20008, 0x7c20004, 0x7c20002, 0x7ba1000,
+    0x7ba0800, 0x7ba0400, 0x7ba0080, 0x7ba0040, 0x7ba0020, 0x7ba0010, 0x7ba0008, 0x7ba0004,
+    0x7ba0002, 0x7ba0001, 0x7b91000, 0x7b90800, 0x7b90400, 0x7b90100, 0x7b90040, 0x7b90020,
+    0x7b90010, 0x7b90008, 0x7b90004, 0x7b90002, 0x7b90001, 0x7b81000, 0x7b80800, 0x7b80400,
+    0x7b80100, 0x7b80080, 0x7b80020, 0x7b80010, 0x7b80008, 0x7b80004, 0x7b80002, 0x7b80001,
+    0x7b71000, 0x7b70800, 0x7b70400, 0x7b70100, 0x7b70080, 0x7b70040, 0x7b70010, 0x7b70008,
+    0x7b70004, 0x7b70002, 0x7b70001, 0x7b61000, 0x7b60800, 0x7b60400, 0x7b60100, 0x7b60080,
+    0x7b60040, 0x7b60020, 0x7b60008, 0x7b60004, 0x7b60002, 0x7b60001, 0x7b51000, 0x7b50800,
+    0x7b50400, 0x7b50100, 0x7b50080, 0x7b50040, 0x7b50020, 0x7b50010, 0x7b50004, 0x7b50002,
+    0x7b50001, 0x7b41000, 0x7b40800, 0x7b40400, 0x7b40100, 0x7b40080, 0x7b40040, 0x7b40020,
+    0x7b40010, 0x7b40008, 0x7b40002, 0x7b40001, 0x7b31000, 0x7b30800, 0x7b30400, 0x7b30100,
+    0x7b30080, 0x7b30040, 0x7b30020, 0x7b30010, 0x7b30008, 0x7b30004, 0x7b30001, 0x7b21000,
+    0x7b20800, 0x7b20400, 0x7b20100, 0x7b20080, 0x7b20040, 0x7b20020, 0x7b20010, 0x7b20008,
+    0x7b20004, 0x7b20002, 0x7a91000, 0x7a90800, 0x7a90400, 0x7a90200, 0x7a90040, 0x7a90020,
+    0x7a90010, 0x7a90008, 0x7a90004, 0x7a90002, 0x7a90001, 0x7a81000, 0x7a80800, 0x7a80400,
+    0x7a80200, 0x7a80080, 0x7a80020, 0x7a80010, 0x7a80008, 0x7a80004, 0x7a80002, 0x7a80001,
+    0x7a71000, 0x7a70800, 0x7a70400, 0x7a70200, 0x7a70080, 0x7a70040, 0x7a70010, 0x7a70008,
+    0x7a70004, 0x7a70002, 0x7a70001, 0x7a61000, 0x7a60800, 0x7a60400, 0x7a60200, 0x7a60080,
+    0x7a60040, 0x7a60020, 0x7a60008, 0x7a60004, 0x7a60002, 0x7a60001, 0x7a51000, 0x7a50800,
+    0x7a50400, 0x7a50200, 0x7a50080, 0x7a50040, 0x7a50020, 0x7a50010, 0x7a50004, 0x7a50002,
+    0x7a50001, 0x7a41000, 0x7a40800, 0x7a40400, 0x7a40200, 0x7a40080, 0x7a40040, 0x7a40020,
+    0x7a40010, 0x7a40008, 0x7a40002, 0x7a40001, 0x7a31000, 0x7a30800, 0x7a30400, 0x7a30200,
+    0x7a30080, 0x7a30040, 0x7a30020, 0x7a30010, 0x7a30008, 0x7a30004, 0x7a30001, 0x7a21000,
+    0x7a20800, 0x7a20400, 0x7a20200, 0x7a20080, 0x7a20040, 0x7a20020, 0x7a20010, 0x7a20008,
+    0x7a20004, 0x7a20002, 0x7981000, 0x7980800, 0x7980400, 0x7980200, 0x7980100, 0x7980020,
+    0x7980010, 0x7980008, 0x7980004, 0x7980002, 0x7980001, 0x7971000, 0x7970800, 0x7970400,
+    0x7970200, 0x7970100, 0x7970040, 0x7970010, 0x7970008, 0x7970004, 0x7970002, 0x7970001,
+    0x7961000, 0x7960800, 0x7960400, 0x7960200, 0x7960100, 0x7960040, 0x7960020, 0x7960008,
+    0x7960004, 0x7960002, 0x7960001, 0x7951000, 0x7950800, 0x7950400, 0x7950200, 0x7950100,
+    0x7950040, 0x7950020, 0x7950010, 0x7950004, 0x7950002, 0x7950001, 0x7941000, 0x7940800,
+    0x7940400, 0x7940200, 0x7940100, 0x7940040, 0x7940020, 0x7940010, 0x7940008, 0x7940002,
+    0x7940001, 0x7931000, 0x7930800, 0x7930400, 0x7930200, 0x7930100, 0x7930040, 0x7930020,
+    0x7930010, 0x7930008, 0x7930004, 0x7930001, 0x7921000, 0x7920800, 0x7920400, 0x7920200,
+    0x7920100, 0x7920040, 0x7920020, 0x7920010, 0x7920008, 0x7920004, 0x7920002, 0x7871000,
+    0x7870800, 0x7870400, 0x7870200, 0x7870100, 0x7870080, 0x7870010, 0x7870008, 0x7870004,
+    0x7870002, 0x7870001, 0x7861000, 0x7860800, 0x7860400, 0x7860200, 0x7860100, 0x7860080,
+    0x7860020, 0x7860008, 0x7860004, 0x7860002, 0x7860001, 0x7851000, 0x7850800, 0x7850400,
+    0x7850200, 0x7850100, 0x7850080, 0x7850020, 0x7850010, 0x7850004, 0x7850002, 0x7850001,
+    0x7841000, 0x7840800, 0x7840400, 0x7840200, 0x7840100, 0x7840080, 0x7840020, 0x7840010,
+    0x7840008, 0x7840002, 0x7840001, 0x7831000, 0x7830800, 0x7830400, 0x7830200, 0x7830100,
+    0x7830080, 0x7830020, 0x7830010, 0x7830008, 0x7830004, 0x7830001, 0x7821000, 0x7820800,
+    0x7820400, 0x7820200, 0x7820100, 0x7820080, 0x7820020, 0x7820010, 0x7820008, 0x7820004,
+    0x7820002, 0x7761000, 0x7760800, 0x7760400, 0x7760200, 0x7760100, 0x7760080, 0x7760040,
+    0x7760008, 0x7760004, 0x7760002, 0x7760001, 0x7751000, 0x7750800, 0x7750400, 0x7750200,
+    0x7750100, 0x7750080, 0x7750040, 0x7750010, 0x7750004, 0x7750002, 0x7750001, 0x7741000,
+    0x7740800, 0x7740400, 0x7740200, 0x7740100, 0x7740080, 0x7740040, 0x7740010, 0x7740008,
+    0x7740002, 0x7740001, 0x7731000, 0x7730800, 0x7730400, 0x7730200, 0x7730100, 0x7730080,
+    0x7730040, 0x7730010, 0x7730008, 0x7730004, 0x7730001, 0x7721000, 0x7720800, 0x7720400,
+    0x7720200, 0x7720100, 0x7720080, 0x7720040, 0x7720010, 0x7720008, 0x7720004, 0x7720002,
+    0x7651000, 0x7650800, 0x7650400, 0x7650200, 0x7650100, 0x7650080, 0x7650040, 0x7650020,
+    0x7650004, 0x7650002, 0x7650001, 0x7641000, 0x7640800, 0x7640400, 0x7640200, 0x7640100,
+    0x7640080, 0x7640040, 0x7640020, 0x7640008, 0x7640002, 0x7640001, 0x7631000, 0x7630800,
+    0x7630400, 0x7630200, 0x7630100, 0x7630080, 0x7630040, 0x7630020, 0x7630008, 0x7630004,
+    0x7630001, 0x7621000, 0x7620800, 0x7620400, 0x7620200, 0x7620100, 0x7620080, 0x7620040,
+    0x7620020, 0x7620008, 0x7620004, 0x7620002, 0x7541000, 0x7540800, 0x7540400, 0x7540200,
+    0x7540100, 0x7540080, 0x7540040, 0x7540020, 0x7540010, 0x7540002, 0x7540001, 0x7531000,
+    0x7530800, 0x7530400, 0x7530200, 0x7530100, 0x7530080, 0x7530040, 0x7530020, 0x7530010,
+    0x7530004, 0x7530001, 0x7521000, 0x7520800, 0x7520400, 0x7520200, 0x7520100, 0x7520080,
+    0x7520040, 0x7520020, 0x7520010, 0x7520004, 0x7520002, 0x7431000, 0x7430800, 0x7430400,
+    0x7430200, 0x7430100, 0x7430080, 0x7430040, 0x7430020, 0x7430010, 0x7430008, 0x7430001,
+    0x7421000, 0x7420800, 0x7420400, 0x7420200, 0x7420100, 0x7420080, 0x7420040, 0x7420020,
+    0x7420010, 0x7420008, 0x7420002, 0x7321000, 0x7320800, 0x7320400, 0x7320200, 0x7320100,
+    0x7320080, 0x7320040, 0x7320020, 0x7320010, 0x7320008, 0x7320004, 0x8e00e00, 0x8e00d00,
+    0x8e00c80, 0x8e00c40, 0x8e00c20, 0x8e00c10, 0x8e00c08, 0x8e00c04, 0x8e00c02, 0x8e00c01,
+    0x8e00b00, 0x8e00a80, 0x8e00a40, 0x8e00a20, 0x8e00a10, 0x8e00a08, 0x8e00a04, 0x8e00a02,
+    0x8e00a01, 0x8e00980, 0x8e00940, 0x8e00920, 0x8e00910, 0x8e00908, 0x8e00904, 0x8e00902,
+    0x8e00901, 0x8e008c0, 0x8e008a0, 0x8e00890, 0x8e00888, 0x8e00884, 0x8e00882, 0x8e00881,
+    0x8e00860, 0x8e00850, 0x8e00848, 0x8e00844, 0x8e00842, 0x8e00841, 0x8e00830, 0x8e00828,
+    0x8e00824, 0x8e00822, 0x8e00821, 0x8e00818, 0x8e00814, 0x8e00812, 0x8e00811, 0x8e0080c,
+    0x8e0080a, 0x8e00809, 0x8e00806, 0x8e00805, 0x8e00803, 0x8e00700, 0x8e00680, 0x8e00640,
+    0x8e00620, 0x8e00610, 0x8e00608, 0x8e00604, 0x8e00602, 0x8e00601, 0x8e00580, 0x8e00540,
+    0x8e00520, 0x8e00510, 0x8e00508, 0x8e00504, 0x8e00502, 0x8e00501, 0x8e004c0, 0x8e004a0,
+    0x8e00490, 0x8e00488, 0x8e00484, 0x8e00482, 0x8e00481, 0x8e00460, 0x8e00450, 0x8e00448,
+    0x8e00444, 0x8e00442, 0x8e00441, 0x8e00430, 0x8e00428, 0x8e00424, 0x8e00422, 0x8e00421,
+    0x8e00418, 0x8e00414, 0x8e00412, 0x8e00411, 0x8e0040c, 0x8e0040a, 0x8e00409, 0x8e00406,
+    0x8e00405, 0x8e00403, 0x8e00380, 0x8e00340, 0x8e00320, 0x8e00310, 0x8e00308, 0x8e00304,
+    0x8e00302, 0x8e00301, 0x8e002c0, 0x8e002a0, 0x8e00290, 0x8e00288, 0x8e00284, 0x8e00282,
+    0x8e00281, 0x8e00260, 0x8e00250, 0x8e00248, 0x8e00244, 0x8e00242, 0x8e00241, 0x8e00230,
+    0x8e00228, 0x8e00224, 0x8e00222, 0x8e00221, 0x8e00218, 0x8e00214, 0x8e00212, 0x8e00211,
+    0x8e0020c, 0x8e0020a, 0x8e00209, 0x8e00206, 0x8e00205, 0x8e00203, 0x8e001c0, 0x8e001a0,
+    0x8e00190, 0x8e00188, 0x8e00184, 0x8e00182, 0x8e00181, 0x8e00160, 0x8e00150, 0x8e00148,
+    0x8e00144, 0x8e00142, 0x8e00141, 0x8e00130, 0x8e00128, 0x8e00124, 0x8e00122, 0x8e00121,
+    0x8e00118, 0x8e00114, 0x8e00112, 0x8e00111, 0x8e0010c, 0x8e0010a, 0x8e00109, 0x8e00106,
+    0x8e00105, 0x8e00103, 0x8e000e0, 0x8e000d0, 0x8e000c8, 0x8e000c4, 0x8e000c2, 0x8e000c1,
+    0x8e000b0, 0x8e000a8, 0x8e000a4, 0x8e000a2, 0x8e000a1, 0x8e00098, 0x8e00094, 0x8e00092,
+    0x8e00091, 0x8e0008c, 0x8e0008a, 0x8e00089, 0x8e00086, 0x8e00085, 0x8e00083, 0x8e00070,
+    0x8e00068, 0x8e00064, 0x8e00062, 0x8e00061, 0x8e00058, 0x8e00054, 0x8e00052, 0x8e00051,
+    0x8e0004c, 0x8e0004a, 0x8e00049, 0x8e00046, 0x8e00045, 0x8e00043, 0x8e00038, 0x8e00034,
+    0x8e00032, 0x8e00031, 0x8e0002c, 0x8e0002a, 0x8e00029, 0x8e00026, 0x8e00025, 0x8e00023,
+    0x8e0001c, 0x8e0001a, 0x8e00019, 0x8e00016, 0x8e00015, 0x8e00013, 0x8e0000e, 0x8e0000d,
+    0x8e0000b, 0x8e00007, 0x8d01600, 0x8d01500, 0x8d01480, 0x8d01440, 0x8d01420, 0x8d01410,
+    0x8d01408, 0x8d01404, 0x8d01402, 0x8d01401, 0x8d01300, 0x8d01280, 0x8d01240, 0x8d01220,
+    0x8d01210, 0x8d01208, 0x8d01204, 0x8d01202, 0x8d01201, 0x8d01180, 0x8d01140, 0x8d01120,
+    0x8d01110, 0x8d01108, 0x8d01104, 0x8d01102, 0x8d01101, 0x8d010c0, 0x8d010a0, 0x8d01090,
+    0x8d01088, 0x8d01084, 0x8d01082, 0x8d01081, 0x8d01060, 0x8d01050, 0x8d01048, 0x8d01044,
+    0x8d01042, 0x8d01041, 0x8d01030, 0x8d01028, 0x8d01024, 0x8d01022, 0x8d01021, 0x8d01018,
+    0x8d01014, 0x8d01012, 0x8d01011, 0x8d0100c, 0x8d0100a, 0x8d01009, 0x8d01006, 0x8d01005,
+    0x8d01003, 0x8d00700, 0x8d00680, 0x8d00640, 0x8d00620, 0x8d00610, 0x8d00608, 0x8d00604,
+    0x8d00602, 0x8d00601, 0x8d00580, 0x8d00540, 0x8d00520, 0x8d00510, 0x8d00508, 0x8d00504,
+    0x8d00502, 0x8d00501, 0x8d004c0, 0x8d004a0, 0x8d00490, 0x8d00488, 0x8d00484, 0x8d00482,
+    0x8d00481, 0x8d00460, 0x8d00450, 0x8d00448, 0x8d00444, 0x8d00442, 0x8d00441, 0x8d00430,
+    0x8d00428, 0x8d00424, 0x8d00422, 0x8d00421, 0x8d00418, 0x8d00414, 0x8d00412, 0x8d00411,
+    0x8d0040c, 0x8d0040a, 0x8d00409, 0x8d00406, 0x8d00405, 0x8d00403, 0x8d00380, 0x8d00340,
+    0x8d00320, 0x8d00310, 0x8d00308, 0x8d00304, 0x8d00302, 0x8d00301, 0x8d002c0, 0x8d002a0,
+    0x8d00290, 0x8d00288, 0x8d00284, 0x8d00282, 0x8d00281, 0x8d00260, 0x8d00250, 0x8d00248,
+    0x8d00244, 0x8d00242, 0x8d00241, 0x8d00230, 0x8d00228, 0x8d00224, 0x8d00222, 0x8d00221,
+    0x8d00218, 0x8d00214, 0x8d00212, 0x8d00211, 0x8d0020c, 0x8d0020a, 0x8d00209, 0x8d00206,
+    0x8d00205, 0x8d00203, 0x8d001c0, 0x8d001a0, 0x8d00190, 0x8d00188, 0x8d00184, 0x8d00182,
+    0x8d00181, 0x8d00160, 0x8d00150, 0x8d00148, 0x8d00144, 0x8d00142, 0x8d00141, 0x8d00130,
+    0x8d00128, 0x8d00124, 0x8d00122, 0x8d00121, 0x8d00118, 0x8d00114, 0x8d00112, 0x8d00111,
+    0x8d0010c, 0x8d0010a, 0x8d00109, 0x8d00106, 0x8d00105, 0x8d00103, 0x8d000e0, 0x8d000d0,
+    0x8d000c8, 0x8d000c4, 0x8d000c2, 0x8d000c1, 0x8d000b0, 0x8d000a8, 0x8d000a4, 0x8d000a2,
+    0x8d000a1, 0x8d00098, 0x8d00094, 0x8d00092, 0x8d00091, 0x8d0008c, 0x8d0008a, 0x8d00089,
+    0x8d00086, 0x8d00085, 0x8d00083, 0x8d00070, 0x8d00068, 0x8d00064, 0x8d00062, 0x8d00061,
+    0x8d00058, 0x8d00054, 0x8d00052, 0x8d00051, 0x8d0004c, 0x8d0004a, 0x8d00049, 0x8d00046,
+    0x8d00045, 0x8d00043, 0x8d00038, 0x8d00034, 0x8d00032, 0x8d00031, 0x8d0002c, 0x8d0002a,
+    0x8d00029, 0x8d00026, 0x8d00025, 0x8d00023, 0x8d0001c, 0x8d0001a, 0x8d00019, 0x8d00016,
+    0x8d00015, 0x8d00013, 0x8d0000e, 0x8d0000d, 0x8d0000b, 0x8d00007, 0x8c01a00, 0x8c01900,
+    0x8c01880, 0x8c01840, 0x8c01820, 0x8c01810, 0x8c01808, 0x8c01804, 0x8c01802, 0x8c01801,
+    0x8c01300, 0x8c01280, 0x8c01240, 0x8c01220, 0x8c01210, 0x8c01208, 0x8c01204, 0x8c01202,
+    0x8c01201, 0x8c01180, 0x8c01140, 0x8c01120, 0x8c01110, 0x8c01108, 0x8c01104, 0x8c01102,
+    0x8c01101, 0x8c010c0, 0x8c010a0, 0x8c01090, 0x8c01088, 0x8c01084, 0x8c01082, 0x8c01081,
+    0x8c01060, 0x8c01050, 0x8c01048, 0x8c01044, 0x8c01042, 0x8c01041, 0x8c01030, 0x8c01028,
+    0x8c01024, 0x8c01022, 0x8c01021, 0x8c01018, 0x8c01014, 0x8c01012, 0x8c01011, 0x8c0100c,
+    0x8c0100a, 0x8c01009, 0x8c01006, 0x8c01005, 0x8c01003, 0x8c00b00, 0x8c00a80, 0x8c00a40,
+    0x8c00a20, 0x8c00a10, 0x8c00a08, 0x8c00a04, 0x8c00a02, 0x8c00a01, 0x8c00980, 0x8c00940,
+    0x8c00920, 0x8c00910, 0x8c00908, 0x8c00904, 0x8c00902, 0x8c00901, 0x8c008c0, 0x8c008a0,
+    0x8c00890, 0x8c00888, 0x8c00884, 0x8c00882, 0x8c00881, 0x8c00860, 0x8c00850, 0x8c00848,
+    0x8c00844, 0x8c00842, 0x8c00841, 0x8c00830, 0x8c00828, 0x8c00824, 0x8c00822, 0x8c00821,
+    0x8c00818, 0x8c00814, 0x8c00812, 0x8c00811, 0x8c0080c, 0x8c0080a, 0x8c00809, 0x8c00806,
+    0x8c00805, 0x8c00803, 0x8c00380, 0x8c00340, 0x8c00320, 0x8c00310, 0x8c00308, 0x8c00304,
+    0x8c00302, 0x8c00301, 0x8c002c0, 0x8c002a0, 0x8c00290, 0x8c00288, 0x8c00284, 0x8c00282,
+    0x8c00281, 0x8c00260, 0x8c00250, 0x8c00248, 0x8c00244, 0x8c00242, 0x8c00241, 0x8c00230,
+    0x8c00228, 0x8c00224, 0x8c00222, 0x8c00221, 0x8c00218, 0x8c00214, 0x8c00212, 0x8c00211,
+    0x8c0020c, 0x8c0020a, 0x8c00209, 0x8c00206, 0x8c00205, 0x8c00203, 0x8c001c0, 0x8c001a0,
+    0x8c00190, 0x8c00188, 0x8c00184, 0x8c00182, 0x8c00181, 0x8c00160, 0x8c00150, 0x8c00148,
+    0x8c00144, 0x8c00142, 0x8c00141, 0x8c00130, 0x8c00128, 0x8c00124, 0x8c00122, 0x8c00121,
+    0x8c00118, 0x8c00114, 0x8c00112, 0x8c00111, 0x8c0010c, 0x8c0010a, 0x8c00109, 0x8c00106,
+    0x8c00105, 0x8c00103, 0x8c000e0, 0x8c000d0, 0x8c000c8, 0x8c000c4, 0x8c000c2, 0x8c000c1,
+    0x8c000b0, 0x8c000a8, 0x8c000a4, 0x8c000a2, 0x8c000a1, 0x8c00098, 0x8c00094, 0x8c00092,
+    0x8c00091, 0x8c0008c, 0x8c0008a, 0x8c00089, 0x8c00086, 0x8c00085, 0x8c00083, 0x8c00070,
+    0x8c00068, 0x8c00064, 0x8c00062, 0x8c00061, 0x8c00058, 0x8c00054, 0x8c00052, 0x8c00051,
+    0x8c0004c, 0x8c0004a, 0x8c00049, 0x8c00046, 0x8c00045, 0x8c00043, 0x8c00038, 0x8c00034,
+    0x8c00032, 0x8c00031, 0x8c0002c, 0x8c0002a, 0x8c00029, 0x8c00026, 0x8c00025, 0x8c00023,
+    0x8c0001c, 0x8c0001a, 0x8c00019, 0x8c00016, 0x8c00015, 0x8c00013, 0x8c0000e, 0x8c0000d,
+    0x8c0000b, 0x8c00007, 0x8b01c00, 0x8b01900, 0x8b01880, 0x8b01840, 0x8b01820, 0x8b01810,
+    0x8b01808, 0x8b01804, 0x8b01802, 0x8b01801, 0x8b01500, 0x8b01480, 0x8b01440, 0x8b01420,
+    0x8b01410, 0x8b01408, 0x8b01404, 0x8b01402, 0x8b01401, 0x8b01180, 0x8b01140, 0x8b01120,
+    0x8b01110, 0x8b01108, 0x8b01104, 0x8b01102, 0x8b01101, 0x8b010c0, 0x8b010a0, 0x8b01090,
+    0x8b01088, 0x8b01084, 0x8b01082, 0x8b01081, 0x8b01060, 0x8b01050, 0x8b01048, 0x8b01044,
+    0x8b01042, 0x8b01041, 0x8b01030, 0x8b01028, 0x8b01024, 0x8b01022, 0x8b01021, 0x8b01018,
+    0x8b01014, 0x8b01012, 0x8b01011, 0x8b0100c, 0x8b0100a, 0x8b01009, 0x8b01006, 0x8b01005,
+    0x8b01003, 0x8b00d00, 0x8b00c80, 0x8b00c40, 0x8b00c20, 0x8b00c10, 0x8b00c08, 0x8b00c04,
+    0x8b00c02, 0x8b00c01, 0x8b00980, 0x8b00940, 0x8b00920, 0x8b00910, 0x8b00908, 0x8b00904,
+    0x8b00902, 0x8b00901, 0x8b008c0, 0x8b008a0, 0x8b00890, 0x8b00888, 0x8b00884, 0x8b00882,
+    0x8b00881, 0x8b00860, 0x8b00850, 0x8b00848, 0x8b00844, 0x8b00842, 0x8b00841, 0x8b00830,
+    0x8b00828, 0x8b00824, 0x8b00822, 0x8b00821, 0x8b00818, 0x8b00814, 0x8b00812, 0x8b00811,
+    0x8b0080c, 0x8b0080a, 0x8b00809, 0x8b00806, 0x8b00805, 0x8b00803, 0x8b00580, 0x8b00540,
+    0x8b00520, 0x8b00510, 0x8b00508, 0x8b00504, 0x8b00502, 0x8b00501, 0x8b004c0, 0x8b004a0,
+    0x8b00490, 0x8b00488, 0x8b00484, 0x8b00482, 0x8b00481, 0x8b00460, 0x8b00450, 0x8b00448,
+    0x8b00444, 0x8b00442, 0x8b00441, 0x8b00430, 0x8b00428, 0x8b00424, 0x8b00422, 0x8b00421,
+    0x8b00418, 0x8b00414, 0x8b00412, 0x8b00411, 0x8b0040c, 0x8b0040a, 0x8b00409, 0x8b00406,
+    0x8b00405, 0x8b00403, 0x8b001c0, 0x8b001a0, 0x8b00190, 0x8b00188, 0x8b00184, 0x8b00182,
+    0x8b00181, 0x8b00160, 0x8b00150, 0x8b00148, 0x8b00144, 0x8b00142, 0x8b00141, 0x8b00130,
+    0x8b00128, 0x8b00124, 0x8b00122, 0x8b00121, 0x8b00118, 0x8b00114, 0x8b00112, 0x8b00111,
+    0x8b0010c, 0x8b0010a, 0x8b00109, 0x8b00106, 0x8b00105, 0x8b00103, 0x8b000e0, 0x8b000d0,
+    0x8b000c8, 0x8b000c4, 0x8b000c2, 0x8b000c1, 0x8b000b0, 0x8b000a8, 0x8b000a4, 0x8b000a2,
+    0x8b000a1, 0x8b00098, 0x8b00094, 0x8b00092, 0x8b00091, 0x8b0008c, 0x8b0008a, 0x8b00089,
+    0x8b00086, 0x8b00085, 0x8b00083, 0x8b00070, 0x8b00068, 0x8b00064, 0x8b00062, 0x8b00061,
+    0x8b00058, 0x8b00054, 0x8b00052, 0x8b00051, 0x8b0004c, 0x8b0004a, 0x8b00049, 0x8b00046,
+    0x8b00045, 0x8b00043, 0x8b00038, 0x8b00034, 0x8b00032, 0x8b00031, 0x8b0002c, 0x8b0002a,
+    0x8b00029, 0x8b00026, 0x8b00025, 0x8b00023, 0x8b0001c, 0x8b0001a, 0x8b00019, 0x8b00016,
+    0x8b00015, 0x8b00013, 0x8b0000e, 0x8b0000d, 0x8b0000b, 0x8b00007, 0x8a01c00, 0x8a01a00,
+    0x8a01880, 0x8a01840, 0x8a01820, 0x8a01810, 0x8a01808, 0x8a01804, 0x8a01802, 0x8a01801,
+    0x8a01600, 0x8a01480, 0x8a01440, 0x8a01420, 0x8a01410, 0x8a01408, 0x8a01404, 0x8a01402,
+    0x8a01401, 0x8a01280, 0x8a01240, 0x8a01220, 0x8a01210, 0x8a01208, 0x8a01204, 0x8a01202,
+    0x8a01201, 0x8a010c0, 0x8a010a0, 0x8a01090, 0x8a01088, 0x8a01084, 0x8a01082, 0x8a01081,
+    0x8a01060, 0x8a01050, 0x8a01048, 0x8a01044, 0x8a01042, 0x8a01041, 0x8a01030, 0x8a01028,
+    0x8a01024, 0x8a01022, 0x8a01021, 0x8a01018, 0x8a01014, 0x8a01012, 0x8a01011, 0x8a0100c,
+    0x8a0100a, 0x8a01009, 0x8a01006, 0x8a01005, 0x8a01003, 0x8a00e00, 0x8a00c80, 0x8a00c40,
+    0x8a00c20, 0x8a00c10, 0x8a00c08, 0x8a00c04, 0x8a00c02, 0x8a00c01, 0x8a00a80, 0x8a00a40,
+    0x8a00a20, 0x8a00a10, 0x8a00a08, 0x8a00a04, 0x8a00a02, 0x8a00a01, 0x8a008c0, 0x8a008a0,
+    0x8a00890, 0x8a00888, 0x8a00884, 0x8a00882, 0x8a00881, 0x8a00860, 0x8a00850, 0x8a00848,
+    0x8a00844, 0x8a00842, 0x8a00841, 0x8a00830, 0x8a00828, 0x8a00824, 0x8a00822, 0x8a00821,
+    0x8a00818, 0x8a00814, 0x8a00812, 0x8a00811, 0x8a0080c, 0x8a0080a, 0x8a00809, 0x8a00806,
+    0x8a00805, 0x8a00803, 0x8a00680, 0x8a00640, 0x8a00620, 0x8a00610, 0x8a00608, 0x8a00604,
+    0x8a00602, 0x8a00601, 0x8a004c0, 0x8a004a0, 0x8a00490, 0x8a00488, 0x8a00484, 0x8a00482,
+    0x8a00481, 0x8a00460, 0x8a00450, 0x8a00448, 0x8a00444, 0x8a00442, 0x8a00441, 0x8a00430,
+    0x8a00428, 0x8a00424, 0x8a00422, 0x8a00421, 0x8a00418, 0x8a00414, 0x8a00412, 0x8a00411,
+    0x8a0040c, 0x8a0040a, 0x8a00409, 0x8a00406, 0x8a00405, 0x8a00403, 0x8a002c0, 0x8a002a0,
+    0x8a00290, 0x8a00288, 0x8a00284, 0x8a00282, 0x8a00281, 0x8a00260, 0x8a00250, 0x8a00248,
+    0x8a00244, 0x8a00242, 0x8a00241, 0x8a00230, 0x8a00228, 0x8a00224, 0x8a00222, 0x8a00221,
+    0x8a00218, 0x8a00214, 0x8a00212, 0x8a00211, 0x8a0020c, 0x8a0020a, 0x8a00209, 0x8a00206,
+    0x8a00205, 0x8a00203, 0x8a000e0, 0x8a000d0, 0x8a000c8, 0x8a000c4, 0x8a000c2, 0x8a000c1,
+    0x8a000b0, 0x8a000a8, 0x8a000a4, 0x8a000a2, 0x8a000a1, 0x8a00098, 0x8a00094, 0x8a00092,
+    0x8a00091, 0x8a0008c, 0x8a0008a, 0x8a00089, 0x8a00086, 0x8a00085, 0x8a00083, 0x8a00070,
+    0x8a00068, 0x8a00064, 0x8a00062, 0x8a00061, 0x8a00058, 0x8a00054, 0x8a00052, 0x8a00051,
+    0x8a0004c, 0x8a0004a, 0x8a00049, 0x8a00046, 0x8a00045, 0x8a00043, 0x8a00038, 0x8a00034,
+    0x8a00032, 0x8a00031, 0x8a0002c, 0x8a0002a, 0x8a00029, 0x8a00026, 0x8a00025, 0x8a00023,
+    0x8a0001c, 0x8a0001a, 0x8a00019, 0x8a00016, 0x8a00015, 0x8a00013, 0x8a0000e, 0x8a0000d,
+    0x8a0000b, 0x8a00007, 0x8901c00, 0x8901a00, 0x8901900, 0x8901840, 0x8901820, 0x8901810,
+    0x8901808, 0x8901804, 0x8901802, 0x8901801, 0x8901600, 0x8901500, 0x8901440, 0x8901420,
+    0x8901410, 0x8901408, 0x8901404, 0x8901402, 0x8901401, 0x8901300, 0x8901240, 0x8901220,
+    0x8901210, 0x8901208, 0x8901204, 0x8901202, 0x8901201, 0x8901140, 0x8901120, 0x8901110,
+    0x8901108, 0x8901104, 0x8901102, 0x8901101, 0x8901060, 0x8901050, 0x8901048, 0x8901044,
+    0x8901042, 0x8901041, 0x8901030, 0x8901028, 0x8901024, 0x8901022, 0x8901021, 0x8901018,
+    0x8901014, 0x8901012, 0x8901011, 0x890100c, 0x890100a, 0x8901009, 0x8901006, 0x8901005,
+    0x8901003, 0x8900e00, 0x8900d00, 0x8900c40, 0x8900c20, 0x8900c10, 0x8900c08, 0x8900c04,
+    0x8900c02, 0x8900c01, 0x8900b00, 0x8900a40, 0x8900a20, 0x8900a10, 0x8900a08, 0x8900a04,
+    0x8900a02, 0x8900a01, 0x8900940, 0x8900920, 0x8900910, 0x8900908, 0x8900904, 0x8900902,
+    0x8900901, 0x8900860, 0x8900850, 0x8900848, 0x8900844, 0x8900842, 0x8900841, 0x8900830,
+    0x8900828, 0x8900824, 0x8900822, 0x8900821, 0x8900818, 0x8900814, 0x8900812, 0x8900811,
+    0x890080c, 0x890080a, 0x8900809, 0x8900806, 0x8900805, 0x8900803, 0x8900700, 0x8900640,
+    0x8900620, 0x8900610, 0x8900608, 0x8900604, 0x8900602, 0x8900601, 0x8900540, 0x8900520,
+    0x8900510, 0x8900508, 0x8900504, 0x8900502, 0x8900501, 0x8900460, 0x8900450, 0x8900448,
+    0x8900444, 0x8900442, 0x8900441, 0x8900430, 0x8900428, 0x8900424, 0x8900422, 0x8900421,
+    0x8900418, 0x8900414, 0x8900412, 0x8900411, 0x890040c, 0x890040a, 0x8900409, 0x8900406,
+    0x8900405, 0x8900403, 0x8900340, 0x8900320, 0x8900310, 0x8900308, 0x8900304, 0x8900302,
+    0x8900301, 0x8900260, 0x8900250, 0x8900248, 0x8900244, 0x8900242, 0x8900241, 0x8900230,
+    0x8900228, 0x8900224, 0x8900222, 0x8900221, 0x8900218, 0x8900214, 0x8900212, 0x8900211,
+    0x890020c, 0x890020a, 0x8900209, 0x8900206, 0x8900205, 0x8900203, 0x8900160, 0x8900150,
+    0x8900148, 0x8900144, 0x8900142, 0x8900141, 0x8900130, 0x8900128, 0x8900124, 0x8900122,
+    0x8900121, 0x8900118, 0x8900114, 0x8900112, 0x8900111, 0x890010c, 0x890010a, 0x8900109,
+    0x8900106, 0x8900105, 0x8900103, 0x8900070, 0x8900068, 0x8900064, 0x8900062, 0x8900061,
+    0x8900058, 0x8900054, 0x8900052, 0x8900051, 0x890004c, 0x890004a, 0x8900049, 0x8900046,
+    0x8900045, 0x8900043, 0x8900038, 0x8900034, 0x8900032, 0x8900031, 0x890002c, 0x890002a,
+    0x8900029, 0x8900026, 0x8900025, 0x8900023, 0x890001c, 0x890001a, 0x8900019, 0x8900016,
+    0x8900015, 0x8900013, 0x890000e, 0x890000d, 0x890000b, 0x8900007, 0x8801c00, 0x8801a00,
+    0x8801900, 0x8801880, 0x8801820, 0x8801810, 0x8801808, 0x8801804, 0x8801802, 0x8801801,
+    0x8801600, 0x8801500, 0x8801480, 0x8801420, 0x8801410, 0x8801408, 0x8801404, 0x8801402,
+    0x8801401, 0x8801300, 0x8801280, 0x8801220, 0x8801210, 0x8801208, 0x8801204, 0x8801202,
+    0x8801201, 0x8801180, 0x8801120, 0x8801110, 0x8801108, 0x8801104, 0x8801102, 0x8801101,
+    0x88010a0, 0x8801090, 0x8801088, 0x8801084, 0x8801082, 0x8801081, 0x8801030, 0x8801028,
+    0x8801024, 0x8801022, 0x8801021, 0x8801018, 0x8801014, 0x8801012, 0x8801011, 0x880100c,
+    0x880100a, 0x8801009, 0x8801006, 0x8801005, 0x8801003, 0x8800e00, 0x8800d00, 0x8800c80,
+    0x8800c20, 0x8800c10, 0x8800c08, 0x8800c04, 0x8800c02, 0x8800c01, 0x8800b00, 0x8800a80,
+    0x8800a20, 0x8800a10, 0x8800a08, 0x8800a04, 0x8800a02, 0x8800a01, 0x8800980, 0x8800920,
+    0x8800910, 0x8800908, 0x8800904, 0x8800902, 0x8800901, 0x88008a0, 0x8800890, 0x8800888,
+    0x8800884, 0x8800882, 0x8800881, 0x8800830, 0x8800828, 0x8800824, 0x8800822, 0x8800821,
+    0x8800818, 0x8800814, 0x8800812, 0x8800811, 0x880080c, 0x880080a, 0x8800809, 0x8800806,
+    0x8800805, 0x8800803, 0x8800700, 0x8800680, 0x8800620, 0x8800610, 0x8800608, 0x8800604,
+    0x8800602, 0x8800601, 0x8800580, 0x8800520, 0x8800510, 0x8800508, 0x8800504, 0x8800502,
+    0x8800501, 0x88004a0, 0x8800490, 0x8800488, 0x8800484, 0x8800482, 0x8800481, 0x8800430,
+    0x8800428, 0x8800424, 0x8800422, 0x8800421, 0x8800418, 0x8800414, 0x8800412, 0x8800411,
+    0x880040c, 0x880040a, 0x8800409, 0x8800406, 0x8800405, 0x8800403, 0x8800380, 0x8800320,
+    0x8800310, 0x8800308, 0x8800304, 0x8800302, 0x8800301, 0x88002a0, 0x8800290, 0x8800288,
+    0x8800284, 0x8800282, 0x8800281, 0x8800230, 0x8800228, 0x8800224, 0x8800222, 0x8800221,
+    0x8800218, 0x8800214, 0x8800212, 0x8800211, 0x880020c, 0x880020a, 0x8800209, 0x8800206,
+    0x8800205, 0x8800203, 0x88001a0, 0x8800190, 0x8800188, 0x8800184, 0x8800182, 0x8800181,
+    0x8800130, 0x8800128, 0x8800124, 0x8800122, 0x8800121, 0x8800118, 0x8800114, 0x8800112,
+    0x8800111, 0x880010c, 0x880010a, 0x8800109, 0x8800106, 0x8800105, 0x8800103, 0x88000b0,
+    0x88000a8, 0x88000a4, 0x88000a2, 0x88000a1, 0x8800098, 0x8800094, 0x8800092, 0x8800091,
+    0x880008c, 0x880008a, 0x8800089, 0x8800086, 0x8800085, 0x8800083, 0x8800038, 0x8800034,
+    0x8800032, 0x8800031, 0x880002c, 0x880002a, 0x8800029, 0x8800026, 0x8800025, 0x8800023,
+    0x880001c, 0x880001a, 0x8800019, 0x8800016, 0x8800015, 0x8800013, 0x880000e, 0x880000d,
+    0x880000b, 0x8800007, 0x8701c00, 0x8701a00, 0x8701900, 0x8701880, 0x8701840, 0x8701810,
+    0x8701808, 0x8701804, 0x8701802, 0x8701801, 0x8701600, 0x8701500, 0x8701480, 0x8701440,
+    0x8701410, 0x8701408, 0x8701404, 0x8701402, 0x8701401, 0x8701300, 0x8701280, 0x8701240,
+    0x8701210, 0x8701208, 0x8701204, 0x8701202, 0x8701201, 0x8701180, 0x8701140, 0x8701110,
+    0x8701108, 0x8701104, 0x8701102, 0x8701101, 0x87010c0, 0x8701090, 0x8701088, 0x8701084,
+    0x8701082, 0x8701081, 0x8701050, 0x8701048, 0x8701044, 0x8701042, 0x8701041, 0x8701018,
+    0x8701014, 0x8701012, 0x8701011, 0x870100c, 0x870100a, 0x8701009, 0x8701006, 0x8701005,
+    0x8701003, 0x8700e00, 0x8700d00, 0x8700c80, 0x8700c40, 0x8700c10, 0x8700c08, 0x8700c04,
+    0x8700c02, 0x8700c01, 0x8700b00, 0x8700a80, 0x8700a40, 0x8700a10, 0x8700a08, 0x8700a04,
+    0x8700a02, 0x8700a01, 0x8700980, 0x8700940, 0x8700910, 0x8700908, 0x8700904, 0x8700902,
+    0x8700901, 0x87008c0, 0x8700890, 0x8700888, 0x8700884, 0x8700882, 0x8700881, 0x8700850,
+    0x8700848, 0x8700844, 0x8700842, 0x8700841, 0x8700818, 0x8700814, 0x8700812, 0x8700811,
+    0x870080c, 0x870080a, 0x8700809, 0x8700806, 0x8700805, 0x8700803, 0x8700700, 0x8700680,
+    0x8700640, 0x8700610, 0x8700608, 0x8700604, 0x8700602, 0x8700601, 0x8700580, 0x8700540,
+    0x8700510, 0x8700508, 0x8700504, 0x8700502, 0x8700501, 0x87004c0, 0x8700490, 0x8700488,
+    0x8700484, 0x8700482, 0x8700481, 0x8700450, 0x8700448, 0x8700444, 0x8700442, 0x8700441,
+    0x8700418, 0x8700414, 0x8700412, 0x8700411, 0x870040c, 0x870040a, 0x8700409, 0x8700406,
+    0x8700405, 0x8700403, 0x8700380, 0x8700340, 0x8700310, 0x8700308, 0x8700304, 0x8700302,
+    0x8700301, 0x87002c0, 0x8700290, 0x8700288, 0x8700284, 0x8700282, 0x8700281, 0x8700250,
+    0x8700248, 0x8700244, 0x8700242, 0x8700241, 0x8700218, 0x8700214, 0x8700212, 0x8700211,
+    0x870020c, 0x870020a, 0x8700209, 0x8700206, 0x8700205, 0x8700203, 0x87001c0, 0x8700190,
+    0x8700188, 0x8700184, 0x8700182, 0x8700181, 0x8700150, 0x8700148, 0x8700144, 0x8700142,
+    0x8700141, 0x8700118, 0x8700114, 0x8700112, 0x8700111, 0x870010c, 0x870010a, 0x8700109,
+    0x8700106, 0x8700105, 0x8700103, 0x87000d0, 0x87000c8, 0x87000c4, 0x87000c2, 0x87000c1,
+    0x8700098, 0x8700094, 0x8700092, 0x8700091, 0x870008c, 0x870008a, 0x8700089, 0x8700086,
+    0x8700085, 0x8700083, 0x8700058, 0x8700054, 0x8700052, 0x8700051, 0x870004c, 0x870004a,
+    0x8700049, 0x8700046, 0x8700045, 0x8700043, 0x870001c, 0x870001a, 0x8700019, 0x8700016,
+    0x8700015, 0x8700013, 0x870000e, 0x870000d, 0x870000b, 0x8700007, 0x8601c00, 0x8601a00,
+    0x8601900, 0x8601880, 0x8601840, 0x8601820, 0x8601808, 0x8601804, 0x8601802, 0x8601801,
+    0x8601600, 0x8601500, 0x8601480, 0x8601440, 0x8601420, 0x8601408, 0x8601404, 0x8601402,
+    0x8601401, 0x8601300, 0x8601280, 0x8601240, 0x8601220, 0x8601208, 0x8601204, 0x8601202,
+    0x8601201, 0x8601180, 0x8601140, 0x8601120, 0x8601108, 0x8601104, 0x8601102, 0x8601101,
+    0x86010c0, 0x86010a0, 0x8601088, 0x8601084, 0x8601082, 0x8601081, 0x8601060, 0x8601048,
+    0x8601044, 0x8601042, 0x8601041, 0x8601028, 0x8601024, 0x8601022, 0x8601021, 0x860100c,
+    0x860100a, 0x8601009, 0x8601006, 0x8601005, 0x8601003, 0x8600e00, 0x8600d00, 0x8600c80,
+    0x8600c40, 0x8600c20, 0x8600c08, 0x8600c04, 0x8600c02, 0x8600c01, 0x8600b00, 0x8600a80,
+    0x8600a40, 0x8600a20, 0x8600a08, 0x8600a04, 0x8600a02, 0x8600a01, 0x8600980, 0x8600940,
+    0x8600920, 0x8600908, 0x8600904, 0x8600902, 0x8600901, 0x86008c0, 0x86008a0, 0x8600888,
+    0x8600884, 0x8600882, 0x8600881, 0x8600860, 0x8600848, 0x8600844, 0x8600842, 0x8600841,
+    0x8600828, 0x8600824, 0x8600822, 0x8600821, 0x860080c, 0x860080a, 0x8600809, 0x8600806,
+    0x8600805, 0x8600803, 0x8600700, 0x8600680, 0x8600640, 0x8600620, 0x8600608, 0x8600604,
+    0x8600602, 0x8600601, 0x8600580, 0x8600540, 0x8600520, 0x8600508, 0x8600504, 0x8600502,
+    0x8600501, 0x86004c0, 0x86004a0, 0x8600488, 0x8600484, 0x8600482, 0x8600481, 0x8600460,
+    0x8600448, 0x8600444, 0x8600442, 0x8600441, 0x8600428, 0x8600424, 0x8600422, 0x8600421,
+    0x860040c, 0x860040a, 0x8600409, 0x8600406, 0x8600405, 0x8600403, 0x8600380, 0x8600340,
+    0x8600320, 0x8600308, 0x8600304, 0x8600302, 0x8600301, 0x86002c0, 0x86002a0, 0x8600288,
+    0x8600284, 0x8600282, 0x8600281, 0x8600260, 0x8600248, 0x8600244, 0x8600242, 0x8600241,
+    0x8600228, 0x8600224, 0x8600222, 0x8600221, 0x860020c, 0x860020a, 0x8600209, 0x8600206,
+    0x8600205, 0x8600203, 0x86001c0, 0x86001a0, 0x8600188, 0x8600184, 0x8600182, 0x8600181,
+    0x8600160, 0x8600148, 0x8600144, 0x8600142, 0x8600141, 0x8600128, 0x8600124, 0x8600122,
+    0x8600121, 0x860010c, 0x860010a, 0x8600109, 0x8600106, 0x8600105, 0x8600103, 0x86000e0,
+    0x86000c8, 0x86000c4, 0x86000c2, 0x86000c1, 0x86000a8, 0x86000a4, 0x86000a2, 0x86000a1,
+    0x860008c, 0x860008a, 0x8600089, 0x8600086, 0x8600085, 0x8600083, 0x8600068, 0x8600064,
+    0x8600062, 0x8600061, 0x860004c, 0x860004a, 0x8600049, 0x8600046, 0x8600045, 0x8600043,
+    0x860002c, 0x860002a, 0x8600029, 0x8600026, 0x8600025, 0x8600023, 0x860000e, 0x860000d,
+    0x860000b, 0x8600007, 0x8501c00, 0x8501a00, 0x8501900, 0x8501880, 0x8501840, 0x8501820,
+    0x8501810, 0x8501804, 0x8501802, 0x8501801, 0x8501600, 0x8501500, 0x8501480, 0x8501440,
+    0x8501420, 0x8501410, 0x8501404, 0x8501402, 0x8501401, 0x8501300, 0x8501280, 0x8501240,
+    0x8501220, 0x8501210, 0x8501204, 0x8501202, 0x8501201, 0x8501180, 0x8501140, 0x8501120,
+    0x8501110, 0x8501104, 0x8501102, 0x8501101, 0x85010c0, 0x85010a0, 0x8501090, 0x8501084,
+    0x8501082, 0x8501081, 0x8501060, 0x8501050, 0x8501044, 0x8501042, 0x8501041, 0x8501030,
+    0x8501024, 0x8501022, 0x8501021, 0x8501014, 0x8501012, 0x8501011, 0x8501006, 0x8501005,
+    0x8501003, 0x8500e00, 0x8500d00, 0x8500c80, 0x8500c40, 0x8500c20, 0x8500c10, 0x8500c04,
+    0x8500c02, 0x8500c01, 0x8500b00, 0x8500a80, 0x8500a40, 0x8500a20, 0x8500a10, 0x8500a04,
+    0x8500a02, 0x8500a01, 0x8500980, 0x8500940, 0x8500920, 0x8500910, 0x8500904, 0x8500902,
+    0x8500901, 0x85008c0, 0x85008a0, 0x8500890, 0x8500884, 0x8500882, 0x8500881, 0x8500860,
+    0x8500850, 0x8500844, 0x8500842, 0x8500841, 0x8500830, 0x8500824, 0x8500822, 0x8500821,
+    0x8500814, 0x8500812, 0x8500811, 0x8500806, 0x8500805, 0x8500803, 0x8500700, 0x8500680,
+    0x8500640, 0x8500620, 0x8500610, 0x8500604, 0x8500602, 0x8500601, 0x8500580, 0x8500540,
+    0x8500520, 0x8500510, 0x8500504, 0x8500502, 0x8500501, 0x85004c0, 0x85004a0, 0x8500490,
+    0x8500484, 0x8500482, 0x8500481, 0x8500460, 0x8500450, 0x8500444, 0x8500442, 0x8500441,
+    0x8500430, 0x8500424, 0x8500422, 0x8500421, 0x8500414, 0x8500412, 0x8500411, 0x8500406,
+    0x8500405, 0x8500403, 0x8500380, 0x8500340, 0x8500320, 0x8500310, 0x8500304, 0x8500302,
+    0x8500301, 0x85002c0, 0x85002a0, 0x8500290, 0x8500284, 0x8500282, 0x8500281, 0x8500260,
+    0x8500250, 0x8500244, 0x8500242, 0x8500241, 0x8500230, 0x8500224, 0x8500222, 0x8500221,
+    0x8500214, 0x8500212, 0x8500211, 0x8500206, 0x8500205, 0x8500203, 0x85001c0, 0x85001a0,
+    0x8500190, 0x8500184, 0x8500182, 0x8500181, 0x8500160, 0x8500150, 0x8500144, 0x8500142,
+    0x8500141, 0x8500130, 0x8500124, 0x8500122, 0x8500121, 0x8500114, 0x8500112, 0x8500111,
+    0x8500106, 0x8500105, 0x8500103, 0x85000e0, 0x85000d0, 0x85000c4, 0x85000c2, 0x85000c1,
+    0x85000b0, 0x85000a4, 0x85000a2, 0x85000a1, 0x8500094, 0x8500092, 0x8500091, 0x8500086,
+    0x8500085, 0x8500083, 0x8500070, 0x8500064, 0x8500062, 0x8500061, 0x8500054, 0x8500052,
+    0x8500051, 0x8500046, 0x8500045, 0x8500043, 0x8500034, 0x8500032, 0x8500031, 0x8500026,
+    0x8500025, 0x8500023, 0x8500016, 0x8500015, 0x8500013, 0x8500007, 0x8401c00, 0x8401a00,
+    0x8401900, 0x8401880, 0x8401840, 0x8401820, 0x8401810, 0x8401808, 0x8401802, 0x8401801,
+    0x8401600, 0x8401500, 0x8401480, 0x8401440, 0x8401420, 0x8401410, 0x8401408, 0x8401402,
+    0x8401401, 0x8401300, 0x8401280, 0x8401240, 0x8401220, 0x8401210, 0x8401208, 0x8401202,
+    0x8401201, 0x8401180, 0x8401140, 0x8401120, 0x8401110, 0x8401108, 0x8401102, 0x8401101,
+    0x84010c0, 0x84010a0, 0x8401090, 0x8401088, 0x8401082, 0x8401081, 0x8401060, 0x8401050,
+    0x8401048, 0x8401042, 0x8401041, 0x8401030, 0x8401028, 0x8401022, 0x8401021, 0x8401018,
+    0x8401012, 0x8401011, 0x840100a, 0x8401009, 0x8401003, 0x8400e00, 0x8400d00, 0x8400c80,
+    0x8400c40, 0x8400c20, 0x8400c10, 0x8400c08, 0x8400c02, 0x8400c01, 0x8400b00, 0x8400a80,
+    0x8400a40, 0x8400a20, 0x8400a10, 0x8400a08, 0x8400a02, 0x8400a01, 0x8400980, 0x8400940,
+    0x8400920, 0x8400910, 0x8400908, 0x8400902, 0x8400901, 0x84008c0, 0x84008a0, 0x8400890,
+    0x8400888, 0x8400882, 0x8400881, 0x8400860, 0x8400850, 0x8400848, 0x8400842, 0x8400841,
+    0x8400830, 0x8400828, 0x8400822, 0x8400821, 0x8400818, 0x8400812, 0x8400811, 0x840080a,
+    0x8400809, 0x8400803, 0x8400700, 0x8400680, 0x8400640, 0x8400620, 0x8400610, 0x8400608,
+    0x8400602, 0x8400601, 0x8400580, 0x8400540, 0x8400520, 0x8400510, 0x8400508, 0x8400502,
+    0x8400501, 0x84004c0, 0x84004a0, 0x8400490, 0x8400488, 0x8400482, 0x8400481, 0x8400460,
+    0x8400450, 0x8400448, 0x8400442, 0x8400441, 0x8400430, 0x8400428, 0x8400422, 0x8400421,
+    0x8400418, 0x8400412, 0x8400411, 0x840040a, 0x8400409, 0x8400403, 0x8400380, 0x8400340,
+    0x8400320, 0x8400310, 0x8400308, 0x8400302, 0x8400301, 0x84002c0, 0x84002a0, 0x8400290,
+    0x8400288, 0x8400282, 0x8400281, 0x8400260, 0x8400250, 0x8400248, 0x8400242, 0x8400241,
+    0x8400230, 0x8400228, 0x8400222, 0x8400221, 0x8400218, 0x8400212, 0x8400211, 0x840020a,
+    0x8400209, 0x8400203, 0x84001c0, 0x84001a0, 0x8400190, 0x8400188, 0x8400182, 0x8400181,
+    0x8400160, 0x8400150, 0x8400148, 0x8400142, 0x8400141, 0x8400130, 0x8400128, 0x8400122,
+    0x8400121, 0x8400118, 0x8400112, 0x8400111, 0x840010a, 0x8400109, 0x8400103, 0x84000e0,
+    0x84000d0, 0x84000c8, 0x84000c2, 0x84000c1, 0x84000b0, 0x84000a8, 0x84000a2, 0x84000a1,
+    0x8400098, 0x8400092, 0x8400091, 0x840008a, 0x8400089, 0x8400083, 0x8400070, 0x8400068,
+    0x8400062, 0x8400061, 0x8400058, 0x8400052, 0x8400051, 0x840004a, 0x8400049, 0x8400043,
+    0x8400038, 0x8400032, 0x8400031, 0x840002a, 0x8400029, 0x8400023, 0x840001a, 0x8400019,
+    0x8400013, 0x840000b, 0x8301c00, 0x8301a00, 0x8301900, 0x8301880, 0x8301840, 0x8301820,
+    0x8301810, 0x8301808, 0x8301804, 0x8301801, 0x8301600, 0x8301500, 0x8301480, 0x8301440,
+    0x8301420, 0x8301410, 0x8301408, 0x8301404, 0x8301401, 0x8301300, 0x8301280, 0x8301240,
+    0x8301220, 0x8301210, 0x8301208, 0x8301204, 0x8301201, 0x8301180, 0x8301140, 0x8301120,
+    0x8301110, 0x8301108, 0x8301104, 0x8301101, 0x83010c0, 0x83010a0, 0x8301090, 0x8301088,
+    0x8301084, 0x8301081, 0x8301060, 0x8301050, 0x8301048, 0x8301044, 0x8301041, 0x8301030,
+    0x8301028, 0x8301024, 0x8301021, 0x8301018, 0x8301014, 0x8301011, 0x830100c, 0x8301009,
+    0x8301005, 0x8300e00, 0x8300d00, 0x8300c80, 0x8300c40, 0x8300c20, 0x8300c10, 0x8300c08,
+    0x8300c04, 0x8300c01, 0x8300b00, 0x8300a80, 0x8300a40, 0x8300a20, 0x8300a10, 0x8300a08,
+    0x8300a04, 0x8300a01, 0x8300980, 0x8300940, 0x8300920, 0x8300910, 0x8300908, 0x8300904,
+    0x8300901, 0x83008c0, 0x83008a0, 0x8300890, 0x8300888, 0x8300884, 0x8300881, 0x8300860,
+    0x8300850, 0x8300848, 0x8300844, 0x8300841, 0x8300830, 0x8300828, 0x8300824, 0x8300821,
+    0x8300818, 0x8300814, 0x8300811, 0x830080c, 0x8300809, 0x8300805, 0x8300700, 0x8300680,
+    0x8300640, 0x8300620, 0x8300610, 0x8300608, 0x8300604, 0x8300601, 0x8300580, 0x8300540,
+    0x8300520, 0x8300510, 0x8300508, 0x8300504, 0x8300501, 0x83004c0, 0x83004a0, 0x8300490,
+    0x8300488, 0x8300484, 0x8300481, 0x8300460, 0x8300450, 0x8300448, 0x8300444, 0x8300441,
+    0x8300430, 0x8300428, 0x8300424, 0x8300421, 0x8300418, 0x8300414, 0x8300411, 0x830040c,
+    0x8300409, 0x8300405, 0x8300380, 0x8300340, 0x8300320, 0x8300310, 0x8300308, 0x8300304,
+    0x8300301, 0x83002c0, 0x83002a0, 0x8300290, 0x8300288, 0x8300284, 0x8300281, 0x8300260,
+    0x8300250, 0x8300248, 0x8300244, 0x8300241, 0x8300230, 0x8300228, 0x8300224, 0x8300221,
+    0x8300218, 0x8300214, 0x8300211, 0x830020c, 0x8300209, 0x8300205, 0x83001c0, 0x83001a0,
+    0x8300190, 0x8300188, 0x8300184, 0x8300181, 0x8300160, 0x8300150, 0x8300148, 0x8300144,
+    0x8300141, 0x8300130, 0x8300128, 0x8300124, 0x8300121, 0x8300118, 0x8300114, 0x8300111,
+    0x830010c, 0x8300109, 0x8300105, 0x83000e0, 0x83000d0, 0x83000c8, 0x83000c4, 0x83000c1,
+    0x83000b0, 0x83000a8, 0x83000a4, 0x83000a1, 0x8300098, 0x8300094, 0x8300091, 0x830008c,
+    0x8300089, 0x8300085, 0x8300070, 0x8300068, 0x8300064, 0x8300061, 0x8300058, 0x8300054,
+    0x8300051, 0x830004c, 0x8300049, 0x8300045, 0x8300038, 0x8300034, 0x8300031, 0x830002c,
+    0x8300029, 0x8300025, 0x830001c, 0x8300019, 0x8300015, 0x830000d, 0x8201c00, 0x8201a00,
+    0x8201900, 0x8201880, 0x8201840, 0x8201820, 0x8201810, 0x8201808, 0x8201804, 0x8201802,
+    0x8201600, 0x8201500, 0x8201480, 0x8201440, 0x8201420, 0x8201410, 0x8201408, 0x8201404,
+    0x8201402, 0x8201300, 0x8201280, 0x8201240, 0x8201220, 0x8201210, 0x8201208, 0x8201204,
+    0x8201202, 0x8201180, 0x8201140, 0x8201120, 0x8201110, 0x8201108, 0x8201104, 0x8201102,
+    0x82010c0, 0x82010a0, 0x8201090, 0x8201088, 0x8201084, 0x8201082, 0x8201060, 0x8201050,
+    0x8201048, 0x8201044, 0x8201042, 0x8201030, 0x8201028, 0x8201024, 0x8201022, 0x8201018,
+    0x8201014, 0x8201012, 0x820100c, 0x820100a, 0x8201006, 0x8200e00, 0x8200d00, 0x8200c80,
+    0x8200c40, 0x8200c20, 0x8200c10, 0x8200c08, 0x8200c04, 0x8200c02, 0x8200b00, 0x8200a80,
+    0x8200a40, 0x8200a20, 0x8200a10, 0x8200a08, 0x8200a04, 0x8200a02, 0x8200980, 0x8200940,
+    0x8200920, 0x8200910, 0x8200908, 0x8200904, 0x8200902, 0x82008c0, 0x82008a0, 0x8200890,
+    0x8200888, 0x8200884, 0x8200882, 0x8200860, 0x8200850, 0x8200848, 0x8200844, 0x8200842,
+    0x8200830, 0x8200828, 0x8200824, 0x8200822, 0x8200818, 0x8200814, 0x8200812, 0x820080c,
+    0x820080a, 0x8200806, 0x8200700, 0x8200680, 0x8200640, 0x8200620, 0x8200610, 0x8200608,
+    0x8200604, 0x8200602, 0x8200580, 0x8200540, 0x8200520, 0x8200510, 0x8200508, 0x8200504,
+    0x8200502, 0x82004c0, 0x82004a0, 0x8200490, 0x8200488, 0x8200484, 0x8200482, 0x8200460,
+    0x8200450, 0x8200448, 0x8200444, 0x8200442, 0x8200430, 0x8200428, 0x8200424, 0x8200422,
+    0x8200418, 0x8200414, 0x8200412, 0x820040c, 0x820040a, 0x8200406, 0x8200380, 0x8200340,
+    0x8200320, 0x8200310, 0x8200308, 0x8200304, 0x8200302, 0x82002c0, 0x82002a0, 0x8200290,
+    0x8200288, 0x8200284, 0x8200282, 0x8200260, 0x8200250, 0x8200248, 0x8200244, 0x8200242,
+    0x8200230, 0x8200228, 0x8200224, 0x8200222, 0x8200218, 0x8200214, 0x8200212, 0x820020c,
+    0x820020a, 0x8200206, 0x82001c0, 0x82001a0, 0x8200190, 0x8200188, 0x8200184, 0x8200182,
+    0x8200160, 0x8200150, 0x8200148, 0x8200144, 0x8200142, 0x8200130, 0x8200128, 0x8200124,
+    0x8200122, 0x8200118, 0x8200114, 0x8200112, 0x820010c, 0x820010a, 0x8200106, 0x82000e0,
+    0x82000d0, 0x82000c8, 0x82000c4, 0x82000c2, 0x82000b0, 0x82000a8, 0x82000a4, 0x82000a2,
+    0x8200098, 0x8200094, 0x8200092, 0x820008c, 0x820008a, 0x8200086, 0x8200070, 0x8200068,
+    0x8200064, 0x8200062, 0x8200058, 0x8200054, 0x8200052, 0x820004c, 0x820004a, 0x8200046,
+    0x8200038, 0x8200034, 0x8200032, 0x820002c, 0x820002a, 0x8200026, 0x820001c, 0x820001a,
+    0x8200016, 0x820000e, 0x9e00e80, 0x9e00e40, 0x9e00e20, 0x9e00e10, 0x9e00e08, 0x9e00e04,
+    0x9e00e02, 0x9e00e01, 0x9e00d80, 0x9e00d40, 0x9e00d20, 0x9e00d10, 0x9e00d08, 0x9e00d04,
+    0x9e00d02, 0x9e00d01, 0x9e00cc0, 0x9e00ca0, 0x9e00c90, 0x9e00c88, 0x9e00c84, 0x9e00c82,
+    0x9e00c81, 0x9e00c60, 0x9e00c50, 0x9e00c48, 0x9e00c44, 0x9e00c42, 0x9e00c41, 0x9e00c30,
+    0x9e00c28, 0x9e00c24, 0x9e00c22, 0x9e00c21, 0x9e00c18, 0x9e00c14, 0x9e00c12, 0x9e00c11,
+    0x9e00c0c, 0x9e00c0a, 0x9e00c09, 0x9e00c06, 0x9e00c05, 0x9e00c03, 0x9e00b80, 0x9e00b40,
+    0x9e00b20, 0x9e00b10, 0x9e00b08, 0x9e00b04, 0x9e00b02, 0x9e00b01, 0x9e00ac0, 0x9e00aa0,
+    0x9e00a90, 0x9e00a88, 0x9e00a84, 0x9e00a82, 0x9e00a81, 0x9e00a60, 0x9e00a50, 0x9e00a48,
+    0x9e00a44, 0x9e00a42, 0x9e00a41, 0x9e00a30, 0x9e00a28, 0x9e00a24, 0x9e00a22, 0x9e00a21,
+    0x9e00a18, 0x9e00a14, 0x9e00a12, 0x9e00a11, 0x9e00a0c, 0x9e00a0a, 0x9e00a09, 0x9e00a06,
+    0x9e00a05, 0x9e00a03, 0x9e009c0, 0x9e009a0, 0x9e00990, 0x9e00988, 0x9e00984, 0x9e00982,
+    0x9e00981, 0x9e00960, 0x9e00950, 0x9e00948, 0x9e00944, 0x9e00942, 0x9e00941, 0x9e00930,
+    0x9e00928, 0x9e00924, 0x9e00922, 0x9e00921, 0x9e00918, 0x9e00914, 0x9e00912, 0x9e00911,
+    0x9e0090c, 0x9e0090a, 0x9e00909, 0x9e00906, 0x9e00905, 0x9e00903, 0x9e008e0, 0x9e008d0,
+    0x9e008c8, 0x9e008c4, 0x9e008c2, 0x9e008c1, 0x9e008b0, 0x9e008a8, 0x9e008a4, 0x9e008a2,
+    0x9e008a1, 0x9e00898, 0x9e00894, 0x9e00892, 0x9e00891, 0x9e0088c, 0x9e0088a, 0x9e00889,
+    0x9e00886, 0x9e00885, 0x9e00883, 0x9e00870, 0x9e00868, 0x9e00864, 0x9e00862, 0x9e00861,
+    0x9e00858, 0x9e00854, 0x9e00852, 0x9e00851, 0x9e0084c, 0x9e0084a, 0x9e00849, 0x9e00846,
+    0x9e00845, 0x9e00843, 0x9e00838, 0x9e00834, 0x9e00832, 0x9e00831, 0x9e0082c, 0x9e0082a,
+    0x9e00829, 0x9e00826, 0x9e00825, 0x9e00823, 0x9e0081c, 0x9e0081a, 0x9e00819, 0x9e00816,
+    0x9e00815, 0x9e00813, 0x9e0080e, 0x9e0080d, 0x9e0080b, 0x9e00807, 0x9e00780, 0x9e00740,
+    0x9e00720, 0x9e00710, 0x9e00708, 0x9e00704, 0x9e00702, 0x9e00701, 0x9e006c0, 0x9e006a0,
+    0x9e00690, 0x9e00688, 0x9e00684, 0x9e00682, 0x9e00681, 0x9e00660, 0x9e00650, 0x9e00648,
+    0x9e00644, 0x9e00642, 0x9e00641, 0x9e00630, 0x9e00628, 0x9e00624, 0x9e00622, 0x9e00621,
+    0x9e00618, 0x9e00614, 0x9e00612, 0x9e00611, 0x9e0060c, 0x9e0060a, 0x9e00609, 0x9e00606,
+    0x9e00605, 0x9e00603, 0x9e005c0, 0x9e005a0, 0x9e00590, 0x9e00588, 0x9e00584, 0x9e00582,
+    0x9e00581, 0x9e00560, 0x9e00550, 0x9e00548, 0x9e00544, 0x9e00542, 0x9e00541, 0x9e00530,
+    0x9e00528, 0x9e00524, 0x9e00522, 0x9e00521, 0x9e00518, 0x9e00514, 0x9e00512, 0x9e00511,
+    0x9e0050c, 0x9e0050a, 0x9e00509, 0x9e00506, 0x9e00505, 0x9e00503, 0x9e004e0, 0x9e004d0,
+    0x9e004c8, 0x9e004c4, 0x9e004c2, 0x9e004c1, 0x9e004b0, 0x9e004a8, 0x9e004a4, 0x9e004a2,
+    0x9e004a1, 0x9e00498, 0x9e00494, 0x9e00492, 0x9e00491, 0x9e0048c, 0x9e0048a, 0x9e00489,
+    0x9e00486, 0x9e00485, 0x9e00483, 0x9e00470, 0x9e00468, 0x9e00464, 0x9e00462, 0x9e00461,
+    0x9e00458, 0x9e00454, 0x9e00452, 0x9e00451, 0x9e0044c, 0x9e0044a, 0x9e00449, 0x9e00446,
+    0x9e00445, 0x9e00443, 0x9e00438, 0x9e00434, 0x9e00432, 0x9e00431, 0x9e0042c, 0x9e0042a,
+    0x9e00429, 0x9e00426, 0x9e00425, 0x9e00423, 0x9e0041c, 0x9e0041a, 0x9e00419, 0x9e00416,
+    0x9e00415, 0x9e00413, 0x9e0040e, 0x9e0040d, 0x9e0040b, 0x9e00407, 0x9e003c0, 0x9e003a0,
+    0x9e00390, 0x9e00388, 0x9e00384, 0x9e00382, 0x9e00381, 0x9e00360, 0x9e00350, 0x9e00348,
+    0x9e00344, 0x9e00342, 0x9e00341, 0x9e00330, 0x9e00328, 0x9e00324, 0x9e00322, 0x9e00321,
+    0x9e00318, 0x9e00314, 0x9e00312, 0x9e00311, 0x9e0030c, 0x9e0030a, 0x9e00309, 0x9e00306,
+    0x9e00305, 0x9e00303, 0x9e002e0, 0x9e002d0, 0x9e002c8, 0x9e002c4, 0x9e002c2, 0x9e002c1,
+    0x9e002b0, 0x9e002a8, 0x9e002a4, 0x9e002a2, 0x9e002a1, 0x9e00298, 0x9e00294, 0x9e00292,
+    0x9e00291, 0x9e0028c, 0x9e0028a, 0x9e00289, 0x9e00286, 0x9e00285, 0x9e00283, 0x9e00270,
+    0x9e00268, 0x9e00264, 0x9e00262, 0x9e00261, 0x9e00258, 0x9e00254, 0x9e00252, 0x9e00251,
+    0x9e0024c, 0x9e0024a, 0x9e00249, 0x9e00246, 0x9e00245, 0x9e00243, 0x9e00238, 0x9e00234,
+    0x9e00232, 0x9e00231, 0x9e0022c, 0x9e0022a, 0x9e00229, 0x9e00226, 0x9e00225, 0x9e00223,
+    0x9e0021c, 0x9e0021a, 0x9e00219, 0x9e00216, 0x9e00215, 0x9e00213, 0x9e0020e, 0x9e0020d,
+    0x9e0020b, 0x9e00207, 0x9e001e0, 0x9e001d0, 0x9e001c8, 0x9e001c4, 0x9e001c2, 0x9e001c1,
+    0x9e001b0, 0x9e001a8, 0x9e001a4, 0x9e001a2, 0x9e001a1, 0x9e00198, 0x9e00194, 0x9e00192,
+    0x9e00191, 0x9e0018c, 0x9e0018a, 0x9e00189, 0x9e00186, 0x9e00185, 0x9e00183, 0x9e00170,
+    0x9e00168, 0x9e00164, 0x9e00162, 0x9e00161, 0x9e00158, 0x9e00154, 0x9e00152, 0x9e00151,
+    0x9e0014c, 0x9e0014a, 0x9e00149, 0x9e00146, 0x9e00145, 0x9e00143, 0x9e00138, 0x9e00134,
+    0x9e00132, 0x9e00131, 0x9e0012c, 0x9e0012a, 0x9e00129, 0x9e00126, 0x9e00125, 0x9e00123,
+    0x9e0011c, 0x9e0011a, 0x9e00119, 0x9e00116, 0x9e00115, 0x9e00113, 0x9e0010e, 0x9e0010d,
+    0x9e0010b, 0x9e00107, 0x9e000f0, 0x9e000e8, 0x9e000e4, 0x9e000e2, 0x9e000e1, 0x9e000d8,
+    0x9e000d4, 0x9e000d2, 0x9e000d1, 0x9e000cc, 0x9e000ca, 0x9e000c9, 0x9e000c6, 0x9e000c5,
+    0x9e000c3, 0x9e000b8, 0x9e000b4, 0x9e000b2, 0x9e000b1, 0x9e000ac, 0x9e000aa, 0x9e000a9,
+    0x9e000a6, 0x9e000a5, 0x9e000a3, 0x9e0009c, 0x9e0009a, 0x9e00099, 0x9e00096, 0x9e00095,
+    0x9e00093, 0x9e0008e, 0x9e0008d, 0x9e0008b, 0x9e00087, 0x9e00078, 0x9e00074, 0x9e00072,
+    0x9e00071, 0x9e0006c, 0x9e0006a, 0x9e00069, 0x9e00066, 0x9e00065, 0x9e00063, 0x9e0005c,
+    0x9e0005a, 0x9e00059, 0x9e00056, 0x9e00055, 0x9e00053, 0x9e0004e, 0x9e0004d, 0x9e0004b,
+    0x9e00047, 0x9e0003c, 0x9e0003a, 0x9e00039, 0x9e00036, 0x9e00035, 0x9e00033, 0x9e0002e,
+    0x9e0002d, 0x9e0002b, 0x9e00027, 0x9e0001e, 0x9e0001d, 0x9e0001b, 0x9e00017, 0x9d00740,
+    0x9d00720, 0x9d00710, 0x9d00708, 0x9d00704, 0x9d00702, 0x9d00701, 0x9d006c0, 0x9d006a0,
+    0x9d00690, 0x9d00688, 0x9d00684, 0x9d00682, 0x9d00681, 0x9d00660, 0x9d00650, 0x9d00648,
+    0x9d00644, 0x9d00642, 0x9d00641, 0x9d00630, 0x9d00628, 0x9d00624, 0x9d00622, 0x9d00621,
+    0x9d00618, 0x9d00614, 0x9d00612, 0x9d00611, 0x9d0060c, 0x9d0060a, 0x9d00609, 0x9d00606,
+    0x9d00605, 0x9d00603, 0x9d005c0, 0x9d005a0, 0x9d00590, 0x9d00588, 0x9d00584, 0x9d00582,
+    0x9d00581, 0x9d00560, 0x9d00550, 0x9d00548, 0x9d00544, 0x9d00542, 0x9d00541, 0x9d00530,
+    0x9d00528, 0x9d00524, 0x9d00522, 0x9d00521, 0x9d00518, 0x9d00514, 0x9d00512, 0x9d00511,
+    0x9d0050c, 0x9d0050a, 0x9d00509, 0x9d00506, 0x9d00505, 0x9d00503, 0x9d004e0, 0x9d004d0,
+    0x9d004c8, 0x9d004c4, 0x9d004c2, 0x9d004c1, 0x9d004b0, 0x9d004a8, 0x9d004a4, 0x9d004a2,
+    0x9d004a1, 0x9d00498, 0x9d00494, 0x9d00492, 0x9d00491, 0x9d0048c, 0x9d0048a, 0x9d00489,
+    0x9d00486, 0x9d00485, 0x9d00483, 0x9d00470, 0x9d00468, 0x9d00464, 0x9d00462, 0x9d00461,
+    0x9d00458, 0x9d00454, 0x9d00452, 0x9d00451, 0x9d0044c, 0x9d0044a, 0x9d00449, 0x9d00446,
+    0x9d00445, 0x9d00443, 0x9d00438, 0x9d00434, 0x9d00432, 0x9d00431, 0x9d0042c, 0x9d0042a,
+    0x9d00429, 0x9d00426, 0x9d00425, 0x9d00423, 0x9d0041c, 0x9d0041a, 0x9d00419, 0x9d00416,
+    0x9d00415, 0x9d00413, 0x9d0040e, 0x9d0040d, 0x9d0040b, 0x9d00407, 0x9d003c0, 0x9d003a0,
+    0x9d00390, 0x9d00388, 0x9d00384, 0x9d00382, 0x9d00381, 0x9d00360, 0x9d00350, 0x9d00348,
+    0x9d00344, 0x9d00342, 0x9d00341, 0x9d00330, 0x9d00328, 0x9d00324, 0x9d00322, 0x9d00321,
+    0x9d00318, 0x9d00314, 0x9d00312, 0x9d00311, 0x9d0030c, 0x9d0030a, 0x9d00309, 0x9d00306,
+    0x9d00305, 0x9d00303, 0x9d002e0, 0x9d002d0, 0x9d002c8, 0x9d002c4, 0x9d002c2, 0x9d002c1,
+    0x9d002b0, 0x9d002a8, 0x9d002a4, 0x9d002a2, 0x9d002a1, 0x9d00298, 0x9d00294, 0x9d00292,
+    0x9d00291, 0x9d0028c, 0x9d0028a, 0x9d00289, 0x9d00286, 0x9d00285, 0x9d00283, 0x9d00270,
+    0x9d00268, 0x9d00264, 0x9d00262, 0x9d00261, 0x9d00258, 0x9d00254, 0x9d00252, 0x9d00251,
+    0x9d0024c, 0x9d0024a, 0x9d00249, 0x9d00246, 0x9d00245, 0x9d00243, 0x9d00238, 0x9d00234,
+    0x9d00232, 0x9d00231, 0x9d0022c, 0x9d0022a, 0x9d00229, 0x9d00226, 0x9d00225, 0x9d00223,
+    0x9d0021c, 0x9d0021a, 0x9d00219, 0x9d00216, 0x9d00215, 0x9d00213, 0x9d0020e, 0x9d0020d,
+    0x9d0020b, 0x9d00207, 0x9d001e0, 0x9d001d0, 0x9d001c8, 0x9d001c4, 0x9d001c2, 0x9d001c1,
+    0x9d001b0, 0x9d001a8, 0x9d001a4, 0x9d001a2, 0x9d001a1, 0x9d00198, 0x9d00194, 0x9d00192,
+    0x9d00191, 0x9d0018c, 0x9d0018a, 0x9d00189, 0x9d00186, 0x9d00185, 0x9d00183, 0x9d00170,
+    0x9d00168, 0x9d00164, 0x9d00162, 0x9d00161, 0x9d00158, 0x9d00154, 0x9d00152, 0x9d00151,
+    0x9d0014c, 0x9d0014a, 0x9d00149, 0x9d00146, 0x9d00145, 0x9d00143, 0x9d00138, 0x9d00134,
+    0x9d00132, 0x9d00131, 0x9d0012c, 0x9d0012a, 0x9d00129, 0x9d00126, 0x9d00125, 0x9d00123,
+    0x9d0011c, 0x9d0011a, 0x9d00119, 0x9d00116, 0x9d00115, 0x9d00113, 0x9d0010e, 0x9d0010d,
+    0x9d0010b, 0x9d00107, 0x9d000f0, 0x9d000e8, 0x9d000e4, 0x9d000e2, 0x9d000e1, 0x9d000d8,
+    0x9d000d4, 0x9d000d2, 0x9d000d1, 0x9d000cc, 0x9d000ca, 0x9d000c9, 0x9d000c6, 0x9d000c5,
+    0x9d000c3, 0x9d000b8, 0x9d000b4, 0x9d000b2, 0x9d000b1, 0x9d000ac, 0x9d000aa, 0x9d000a9,
+    0x9d000a6, 0x9d000a5, 0x9d000a3, 0x9d0009c, 0x9d0009a, 0x9d00099, 0x9d00096, 0x9d00095,
+    0x9d00093, 0x9d0008e, 0x9d0008d, 0x9d0008b, 0x9d00087, 0x9d00078, 0x9d00074, 0x9d00072,
+    0x9d00071, 0x9d0006c, 0x9d0006a, 0x9d00069, 0x9d00066, 0x9d00065, 0x9d00063, 0x9d0005c,
+    0x9d0005a, 0x9d00059, 0x9d00056, 0x9d00055, 0x9d00053, 0x9d0004e, 0x9d0004d, 0x9d0004b,
+    0x9d00047, 0x9d0003c, 0x9d0003a, 0x9d00039, 0x9d00036, 0x9d00035, 0x9d00033, 0x9d0002e,
+    0x9d0002d, 0x9d0002b, 0x9d00027, 0x9d0001e, 0x9d0001d, 0x9d0001b, 0x9d00017, 0x9d0000f,
+    0x9c003a0, 0x9c00390, 0x9c00388, 0x9c00384, 0x9c00382, 0x9c00381, 0x9c00360, 0x9c00350,
+    0x9c00348, 0x9c00344, 0x9c00342, 0x9c00341, 0x9c00330, 0x9c00328, 0x9c00324, 0x9c00322,
+    0x9c00321, 0x9c00318, 0x9c00314, 0x9c00312, 0x9c00311, 0x9c0030c, 0x9c0030a, 0x9c00309,
+    0x9c00306, 0x9c00305, 0x9c00303, 0x9c002e0, 0x9c002d0, 0x9c002c8, 0x9c002c4, 0x9c002c2,
+    0x9c002c1, 0x9c002b0, 0x9c002a8, 0x9c002a4, 0x9c002a2, 0x9c002a1, 0x9c00298, 0x9c00294,
+    0x9c00292, 0x9c00291, 0x9c0028c, 0x9c0028a, 0x9c00289, 0x9c00286, 0x9c00285, 0x9c00283,
+    0x9c00270, 0x9c00268, 0x9c00264, 0x9c00262, 0x9c00261, 0x9c00258, 0x9c00254, 0x9c00252,
+    0x9c00251, 0x9c0024c, 0x9c0024a, 0x9c00249, 0x9c00246, 0x9c00245, 0x9c00243, 0x9c00238,
+    0x9c00234, 0x9c00232, 0x9c00231, 0x9c0022c, 0x9c0022a, 0x9c00229, 0x9c00226, 0x9c00225,
+    0x9c00223, 0x9c0021c, 0x9c0021a, 0x9c00219, 0x9c00216, 0x9c00215, 0x9c00213, 0x9c0020e,
+    0x9c0020d, 0x9c0020b, 0x9c00207, 0x9c001e0, 0x9c001d0, 0x9c001c8, 0x9c001c4, 0x9c001c2,
+    0x9c001c1, 0x9c001b0, 0x9c001a8, 0x9c001a4, 0x9c001a2, 0x9c001a1, 0x9c00198, 0x9c00194,
+    0x9c00192, 0x9c00191, 0x9c0018c, 0x9c0018a, 0x9c00189, 0x9c00186, 0x9c00185, 0x9c00183,
+    0x9c00170, 0x9c00168, 0x9c00164, 0x9c00162, 0x9c00161, 0x9c00158, 0x9c00154, 0x9c00152,
+    0x9c00151, 0x9c0014c, 0x9c0014a, 0x9c00149, 0x9c00146, 0x9c00145, 0x9c00143, 0x9c00138,
+    0x9c00134, 0x9c00132, 0x9c00131, 0x9c0012c, 0x9c0012a, 0x9c00129, 0x9c00126, 0x9c00125,
+    0x9c00123, 0x9c0011c, 0x9c0011a, 0x9c00119, 0x9c00116, 0x9c00115, 0x9c00113, 0x9c0010e,
+    0x9c0010d, 0x9c0010b, 0x9c00107, 0x9c000f0, 0x9c000e8, 0x9c000e4, 0x9c000e2, 0x9c000e1,
+    0x9c000d8, 0x9c000d4, 0x9c000d2, 0x9c000d1, 0x9c000cc, 0x9c000ca, 0x9c000c9, 0x9c000c6,
+    0x9c000c5, 0x9c000c3, 0x9c000b8, 0x9c000b4, 0x9c000b2, 0x9c000b1, 0x9c000ac, 0x9c000aa,
+    0x9c000a9, 0x9c000a6, 0x9c000a5, 0x9c000a3, 0x9c0009c, 0x9c0009a, 0x9c00099, 0x9c00096,
+    0x9c00095, 0x9c00093, 0x9c0008e, 0x9c0008d, 0x9c0008b, 0x9c00087, 0x9c00078, 0x9c00074,
+    0x9c00072, 0x9c00071, 0x9c0006c, 0x9c0006a, 0x9c00069, 0x9c00066, 0x9c00065, 0x9c00063,
+    0x9c0005c, 0x9c0005a, 0x9c00059, 0x9c00056, 0x9c00055, 0x9c00053, 0x9c0004e, 0x9c0004d,
+    0x9c0004b, 0x9c00047, 0x9c0003c, 0x9c0003a, 0x9c00039, 0x9c00036, 0x9c00035, 0x9c00033,
+    0x9c0002e, 0x9c0002d, 0x9c0002b, 0x9c00027, 0x9c0001e, 0x9c0001d, 0x9c0001b, 0x9c00017,
+    0x9c0000f, 0x9b001d0, 0x9b001c8, 0x9b001c4, 0x9b001c2, 0x9b001c1, 0x9b001b0, 0x9b001a8,
+    0x9b001a4, 0x9b001a2, 0x9b001a1, 0x9b00198, 0x9b00194, 0x9b00192, 0x9b00191, 0x9b0018c,
+    0x9b0018a, 0x9b00189, 0x9b00186, 0x9b00185, 0x9b00183, 0x9b00170, 0x9b00168, 0x9b00164,
+    0x9b00162, 0x9b00161, 0x9b00158, 0x9b00154, 0x9b00152, 0x9b00151, 0x9b0014c, 0x9b0014a,
+    0x9b00149, 0x9b00146, 0x9b00145, 0x9b00143, 0x9b00138, 0x9b00134, 0x9b00132, 0x9b00131,
+    0x9b0012c, 0x9b0012a, 0x9b00129, 0x9b00126, 0x9b00125, 0x9b00123, 0x9b0011c, 0x9b0011a,
+    0x9b00119, 0x9b00116, 0x9b00115, 0x9b00113, 0x9b0010e, 0x9b0010d, 0x9b0010b, 0x9b00107,
+    0x9b000f0, 0x9b000e8, 0x9b000e4, 0x9b000e2, 0x9b000e1, 0x9b000d8, 0x9b000d4, 0x9b000d2,
+    0x9b000d1, 0x9b000cc, 0x9b000ca, 0x9b000c9, 0x9b000c6, 0x9b000c5, 0x9b000c3, 0x9b000b8,
+    0x9b000b4, 0x9b000b2, 0x9b000b1, 0x9b000ac, 0x9b000aa, 0x9b000a9, 0x9b000a6, 0x9b000a5,
+    0x9b000a3, 0x9b0009c, 0x9b0009a, 0x9b00099, 0x9b00096, 0x9b00095, 0x9b00093, 0x9b0008e,
+    0x9b0008d, 0x9b0008b, 0x9b00087, 0x9b00078, 0x9b00074, 0x9b00072, 0x9b00071, 0x9b0006c,
+    0x9b0006a, 0x9b00069, 0x9b00066, 0x9b00065, 0x9b00063, 0x9b0005c, 0x9b0005a, 0x9b00059,
+    0x9b00056, 0x9b00055, 0x9b00053, 0x9b0004e, 0x9b0004d, 0x9b0004b, 0x9b00047, 0x9b0003c,
+    0x9b0003a, 0x9b00039, 0x9b00036, 0x9b00035, 0x9b00033, 0x9b0002e, 0x9b0002d, 0x9b0002b,
+    0x9b00027, 0x9b0001e, 0x9b0001d, 0x9b0001b, 0x9b00017, 0x9b0000f, 0x9a000e8, 0x9a000e4,
+    0x9a000e2, 0x9a000e1, 0x9a000d8, 0x9a000d4, 0x9a000d2, 0x9a000d1, 0x9a000cc, 0x9a000ca,
+    0x9a000c9, 0x9a000c6, 0x9a000c5, 0x9a000c3, 0x9a000b8, 0x9a000b4, 0x9a000b2, 0x9a000b1,
+    0x9a000ac, 0x9a000aa, 0x9a000a9, 0x9a000a6, 0x9a000a5, 0x9a000a3, 0x9a0009c, 0x9a0009a,
+    0x9a00099, 0x9a00096, 0x9a00095, 0x9a00093, 0x9a0008e, 0x9a0008d, 0x9a0008b, 0x9a00087,
+    0x9a00078, 0x9a00074, 0x9a00072, 0x9a00071, 0x9a0006c, 0x9a0006a, 0x9a00069, 0x9a00066,
+    0x9a00065, 0x9a00063, 0x9a0005c, 0x9a0005a, 0x9a00059, 0x9a00056, 0x9a00055, 0x9a00053,
+    0x9a0004e, 0x9a0004d, 0x9a0004b, 0x9a00047, 0x9a0003c, 0x9a0003a, 0x9a00039, 0x9a00036,
+    0x9a00035, 0x9a00033, 0x9a0002e, 0x9a0002d, 0x9a0002b, 0x9a00027, 0x9a0001e, 0x9a0001d,
+    0x9a0001b, 0x9a00017, 0x9a0000f, 0x9900074, 0x9900072, 0x9900071, 0x990006c, 0x990006a,
+    0x9900069, 0x9900066, 0x9900065, 0x9900063, 0x990005c, 0x990005a, 0x9900059, 0x9900056,
+    0x9900055, 0x9900053, 0x990004e, 0x990004d, 0x990004b, 0x9900047, 0x990003c, 0x990003a,
+    0x9900039, 0x9900036, 0x9900035, 0x9900033, 0x990002e, 0x990002d, 0x990002b, 0x9900027,
+    0x990001e, 0x990001d, 0x990001b, 0x9900017, 0x990000f, 0x980003a, 0x9800039, 0x9800036,
+    0x9800035, 0x9800033, 0x980002e, 0x980002d, 0x980002b, 0x9800027, 0x980001e, 0x980001d,
+    0x980001b, 0x9800017, 0x980000f, 0x970001d, 0x970001b, 0x9700017, 0x970000f
+};
+
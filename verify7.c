@@ -0,0 +1,369 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "poker.h"
+#include "pokereval.h"
+#include "cards.h"
+#include "enumerate.h"
+#include "table7.h"
+
+/****************************************************************
+    This code checks eval_7hand, and every other seven-card
+    evaluator, over all 133,784,560 seven-card hands.  eval_7hand
+    is the reference: its category counts must match the known
+    ones, and each other evaluator must give exactly its value on
+    every hand.  The first hand an evaluator gets wrong is printed.
+
+        verify7 [--threads n] [-e name]... [-t table7.bin]
+                [-w counts.txt | -v counts.txt]
+
+    -e checks only the named evaluators (the reference always
+    runs); -t adds a table written by mktable7.  -w writes the
+    number of hands of each value 1-7462, and -v checks them
+    against a file written earlier, so a change to the reference
+    itself shows up too.  The threads default to one per CPU.
+****************************************************************/
+
+#define MAX_CANDIDATES  16
+
+// Known seven-card category counts, and the number of distinct
+// values that seven cards can make.
+static const uint64_t expected_freq[10] =
+{
+    0, 41584, 224848, 3473184, 4047644, 6180020, 6461620, 31433400,
+    58627800, 23294460
+};
+
+#define DISTINCT_VALUES  4824
+
+static struct table7 table;
+
+static unsigned short
+eval_7cards_inline(int *hand)
+{
+    return eval_7cards(hand);
+}
+
+static unsigned short
+eval_mask_ints(int *hand)
+{
+    return eval_mask(hand_mask(hand, 7));
+}
+
+static unsigned short
+eval_index_ints(int *hand)
+{
+    uint8_t idx[7];
+
+    pack_hand(hand, 7, idx);
+    return eval_index(idx, 7);
+}
+
+static unsigned short
+eval_partial_ints(int *hand)
+{
+    struct eval_partial p;
+
+    eval_partial_init(&p, hand, 5);
+    return eval_partial_hole(&p, hand[5], hand[6], 7);
+}
+
+static unsigned short
+eval_showdown_ints(int *hand)
+{
+    int hole[1][2] = { { hand[5], hand[6] } };
+    unsigned short v;
+
+    eval_showdown(hand, (const int (*)[2])hole, 1, &v);
+    return v;
+}
+
+static unsigned short
+eval_hilo8_ints(int *hand)
+{
+    unsigned short lo;
+
+    return eval_hilo8(hand, 7, &lo);
+}
+
+static unsigned short
+table7_ints(int *hand)
+{
+    return table7_eval(&table, hand);
+}
+
+struct candidate
+{
+    const char *name;
+    unsigned short (*eval)(int *hand);
+};
+
+static const struct candidate candidates[] =
+{
+    { "eval_7hand_fast", eval_7hand_fast },
+    { "eval_7cards",     eval_7cards_inline },
+    { "eval_mask",       eval_mask_ints },
+    { "eval_index",      eval_index_ints },
+    { "eval_partial",    eval_partial_ints },
+    { "eval_showdown",   eval_showdown_ints },
+    { "eval_hilo8",      eval_hilo8_ints },
+    { "table7",          table7_ints },
+    { NULL, NULL }
+};
+
+struct job
+{
+    const struct candidate *run[MAX_CANDIDATES];
+    int nrun;
+};
+
+// Per-thread results, merged at the end.
+struct tally
+{
+    unsigned long counts[7463];         // reference values
+    uint64_t bad[MAX_CANDIDATES];
+    int first[MAX_CANDIDATES][7];       // a hand each one got wrong
+};
+
+static void
+visit(const int *cards, void *local, void *arg)
+{
+    const struct job *job = arg;
+    struct tally *t = local;
+    int hand[7];
+
+    memcpy(hand, cards, sizeof(hand));
+    unsigned short ref = eval_7hand(hand);
+    t->counts[ref]++;
+
+    for (int i = 0; i < job->nrun; i++)
+        if (job->run[i]->eval(hand) != ref && !t->bad[i]++)
+            memcpy(t->first[i], cards, sizeof(hand));
+}
+
+static void
+merge(void *total, const void *local, void *arg)
+{
+    struct tally *t = total;
+    const struct tally *l = local;
+
+    (void)arg;
+    for (int v = 0; v <= 7462; v++)
+        t->counts[v] += l->counts[v];
+    for (int i = 0; i < MAX_CANDIDATES; i++)
+    {
+        if (!t->bad[i] && l->bad[i])
+            memcpy(t->first[i], l->first[i], sizeof(t->first[i]));
+        t->bad[i] += l->bad[i];
+    }
+}
+
+static int
+write_counts(const char *path, const unsigned long *counts)
+{
+    FILE *f = fopen(path, "w");
+
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    for (int v = 1; v <= 7462; v++)
+        fprintf(f, "%d %lu\n", v, counts[v]);
+    if (fclose(f) != 0) {
+        perror(path);
+        return -1;
+    }
+    return 0;
+}
+
+// Returns the number of values whose count differs from the
+// file, or -1 if the file cannot be read.
+static int
+check_counts(const char *path, const unsigned long *counts)
+{
+    FILE *f = fopen(path, "r");
+    unsigned long n;
+    int v, bad = 0, seen = 0;
+
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    while (fscanf(f, "%d %lu", &v, &n) == 2)
+    {
+        if (v < 1 || v > 7462)
+            break;
+        if (counts[v] != n)
+        {
+            if (!bad)
+                fprintf(stderr, "value %d: %lu hands, %s has %lu\n",
+                        v, counts[v], path, n);
+            bad++;
+        }
+        seen++;
+    }
+    fclose(f);
+    if (seen != 7462) {
+        fprintf(stderr, "%s: not a per-value count file\n", path);
+        return -1;
+    }
+    return bad;
+}
+
+static double
+seconds_since(struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *names[MAX_CANDIDATES], *table_path = NULL;
+    const char *write_path = NULL, *verify_path = NULL;
+    int nnames = 0, nthreads = 0, usage = 0, failed = 0;
+    struct job job;
+    struct tally *total;
+    struct timespec start;
+    int deck[52];
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--threads") && i+1 < argc)
+            nthreads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-e") && i+1 < argc && nnames < MAX_CANDIDATES)
+            names[nnames++] = argv[++i];
+        else if (!strcmp(argv[i], "-t") && i+1 < argc)
+            table_path = argv[++i];
+        else if (!strcmp(argv[i], "-w") && i+1 < argc)
+            write_path = argv[++i];
+        else if (!strcmp(argv[i], "-v") && i+1 < argc)
+            verify_path = argv[++i];
+        else
+            usage = 1;
+    }
+    if (usage || nthreads < 0 || (write_path && verify_path)) {
+        fprintf(stderr, "usage: verify7 [--threads n] [-e name]... [-t table7.bin]\n"
+                        "               [-w counts.txt | -v counts.txt]\n");
+        return 1;
+    }
+
+    if (table_path && table7_open(&table, table_path) < 0) {
+        fprintf(stderr, "%s: not a version %d table file\n", table_path, TABLE7_VERSION);
+        return 1;
+    }
+
+    // Pick the candidates: the named ones, or all of them, with
+    // table7 only when there is a table to read.
+    job.nrun = 0;
+    for (const struct candidate *c = candidates; c->name; c++)
+    {
+        int wanted = !nnames;
+
+        for (int i = 0; i < nnames; i++)
+            if (!strcmp(names[i], c->name))
+                wanted = 1;
+        if (c->eval == table7_ints && !table_path)
+            wanted = 0;
+        if (wanted)
+            job.run[job.nrun++] = c;
+    }
+    for (int i = 0; i < nnames; i++)
+    {
+        int known = 0;
+
+        for (const struct candidate *c = candidates; c->name; c++)
+            known |= !strcmp(names[i], c->name);
+        if (!known) {
+            fprintf(stderr, "unknown evaluator %s; they are:", names[i]);
+            for (const struct candidate *c = candidates; c->name; c++)
+                fprintf(stderr, " %s", c->name);
+            fprintf(stderr, "\n");
+            return 1;
+        }
+    }
+
+    total = calloc(1, sizeof(*total));
+    if (!total) {
+        perror("calloc");
+        return 1;
+    }
+
+    struct enum_spec spec = {
+        .pool = deck, .npool = 52, .k = 7, .nthreads = nthreads,
+        .visit = visit, .merge = merge, .local_size = sizeof(struct tally),
+        .arg = &job,
+    };
+
+    init_deck(deck);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (enum_run(&spec, total) < 0) {
+        fprintf(stderr, "enumeration failed\n");
+        return 1;
+    }
+    printf("%d hands, %d evaluators besides eval_7hand, in %.1f s\n\n",
+           TABLE7_ENTRIES, job.nrun, seconds_since(&start));
+
+    // The reference: categories and distinct values.
+    uint64_t freq[10] = { 0 };
+    int distinct = 0;
+
+    freq[0] = total->counts[0];
+    for (int v = 1; v <= 7462; v++)
+    {
+        freq[hand_rank(v)] += total->counts[v];
+        distinct += total->counts[v] != 0;
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        if (i == 0 && !freq[0])
+            continue;
+        printf("%15s: %10llu%s\n", i ? value_str[i] : "No value",
+               (unsigned long long)freq[i],
+               freq[i] == expected_freq[i] ? "" : "  <-- wrong");
+        failed |= freq[i] != expected_freq[i];
+    }
+    printf("%15s: %10d%s\n\n", "Distinct values", distinct,
+           distinct == DISTINCT_VALUES ? "" : "  <-- wrong");
+    failed |= distinct != DISTINCT_VALUES;
+
+    if (write_path && write_counts(write_path, total->counts) < 0)
+        failed = 1;
+    if (verify_path)
+    {
+        int bad = check_counts(verify_path, total->counts);
+
+        if (bad)
+            failed = 1;
+        if (bad >= 0)
+            printf("per-value counts: %d of 7462 differ from %s\n\n", bad, verify_path);
+    }
+
+    // Everything else, bit for bit against eval_7hand.
+    for (int i = 0; i < job.nrun; i++)
+    {
+        if (!total->bad[i])
+        {
+            printf("%-16s ok\n", job.run[i]->name);
+            continue;
+        }
+
+        char buf[32];
+        int *h = total->first[i];
+
+        format_hand(buf, h, 7);
+        printf("%-16s %llu hands differ, e.g. %s: %d, eval_7hand %d\n",
+               job.run[i]->name, (unsigned long long)total->bad[i], buf,
+               job.run[i]->eval(h), eval_7hand(h));
+        failed = 1;
+    }
+
+    if (table_path)
+        table7_close(&table);
+    free(total);
+    return failed;
+}